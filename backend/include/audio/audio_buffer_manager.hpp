@@ -1,5 +1,6 @@
 #pragma once
 
+#include "audio/audio_segment.hpp"
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -37,14 +38,15 @@ public:
   };
 
   /**
-   * Per-utterance buffer information
+   * Per-utterance buffer information. Audio is held as shared segments:
+   * appending a segment, trimming a full circular buffer and reading the
+   * buffer back copy no samples.
    */
   struct UtteranceBuffer {
-    std::vector<float> audioData;
+    AudioSegmentBuilder audioData;
     std::chrono::steady_clock::time_point startTime;
     mutable std::chrono::steady_clock::time_point lastAccessTime;
     size_t maxSizeSamples;
-    size_t writePosition;
     bool isActive;
     bool isCircular;
 
@@ -53,6 +55,9 @@ public:
 
     // Buffer operations
     bool addAudioData(const std::vector<float> &audio);
+    bool addAudioData(const AudioSegment &audio);
+    AudioSegment getSegment() const;
+    AudioSegment getRecentSegment(size_t sampleCount) const;
     std::vector<float> getAudioData() const;
     std::vector<float> getRecentAudioData(size_t sampleCount) const;
     void clear();
@@ -101,8 +106,15 @@ public:
    * Audio data management (thread-safe)
    */
   bool addAudioData(uint32_t utteranceId, const std::vector<float> &audio);
+  bool addAudioData(uint32_t utteranceId, const AudioSegment &audio);
   std::vector<float> getBufferedAudio(uint32_t utteranceId);
   std::vector<float> getRecentAudio(uint32_t utteranceId, size_t sampleCount);
+
+  /**
+   * Zero-copy access; materialise only where contiguous samples are needed
+   */
+  AudioSegment getBufferedSegment(uint32_t utteranceId);
+  AudioSegment getRecentSegment(uint32_t utteranceId, size_t sampleCount);
   bool hasUtterance(uint32_t utteranceId) const;
 
   /**
@@ -147,8 +159,9 @@ private:
   // Configuration
   BufferConfig config_;
 
-  // Buffer storage (thread-safe)
-  mutable std::mutex bufferMutex_;
+  // Buffer storage (thread-safe). Recursive: public entry points call each
+  // other and the statistics helpers with the lock held
+  mutable std::recursive_mutex bufferMutex_;
   std::unordered_map<uint32_t, std::unique_ptr<UtteranceBuffer>>
       utteranceBuffers_;
 
@@ -162,6 +175,8 @@ private:
   std::chrono::steady_clock::time_point lastCleanupTime_;
 
   // Internal helper methods
+  template <typename Audio>
+  bool addAudioDataInternal(uint32_t utteranceId, const Audio &audio);
   bool shouldCleanup() const;
   void performCleanup();
   size_t calculateMaxSamples(size_t maxSizeMB) const;
@@ -2,6 +2,7 @@
 
 #include "audio/audio_quality_analyzer.hpp"
 #include "audio/adaptive_audio_processor.hpp"
+#include "audio/dsp_graph.hpp"
 #include <vector>
 #include <memory>
 #include <string>
@@ -253,6 +254,12 @@ public:
     std::vector<float> preprocessRealTimeChunk(const std::vector<float>& audioChunk);
     void resetRealTimeState();
     
+    // In-place real-time path through the DSP graph; allocation-free once initialized.
+    // Adaptive processing works on vectors and only runs in the copying paths.
+    void preprocessRealTimeChunkInPlace(SampleSpan audioChunk);
+    size_t getProcessingLatencySamples() const;
+    const DspGraph& getDspGraph() const { return graph_; }
+    
     // Individual processing components
     std::vector<float> applyNoiseReduction(const std::vector<float>& audioData);
     std::vector<float> applyVolumeNormalization(const std::vector<float>& audioData);
@@ -317,6 +324,28 @@ private:
     size_t bufferPosition_;
     bool realTimeInitialized_;
     
+    // DSP graph; the nodes are rebuilt only when the set of stages changes
+    struct GraphLayout {
+        bool noiseReduction = false;
+        int noiseMode = 0;
+        bool volumeNormalization = false;
+        bool echoCancellation = false;
+        int echoMode = 0;
+        size_t echoFilterLength = 0;
+        int sampleRate = 0;
+        size_t blockSize = 0;
+        
+        bool operator==(const GraphLayout& other) const;
+    };
+    
+    mutable std::mutex graphMutex_;
+    DspGraph graph_;
+    GraphLayout graphLayout_;
+    size_t graphBlockSize_;
+    DspNode* noiseNode_;
+    FusedDynamicsNode* dynamicsNode_;
+    DspNode* echoNode_;
+    
     // Statistics
     mutable std::mutex statsMutex_;
     PreprocessingStatistics stats_;
@@ -328,6 +357,11 @@ private:
     void initializeComponents();
     void initializePresets();
     
+    // DSP graph management (callers hold graphMutex_)
+    GraphLayout describeGraphLayout() const;
+    void updateGraph(bool forceRebuild);
+    void configureGraphNodes();
+    
     // Processing pipeline
     std::vector<float> applyProcessingPipeline(const std::vector<float>& audioData,
                                               std::vector<std::string>& appliedFilters,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "audio/frame_features.hpp"
 #include <vector>
 #include <string>
 #include <memory>
@@ -181,7 +182,7 @@ private:
     // FFT and spectral analysis
     std::vector<std::complex<float>> fftBuffer_;
     std::vector<float> windowFunction_;
-    std::vector<float> melFilterBank_;
+    std::shared_ptr<const FrameAnalysisTables> melTables_;
     
     // Real-time analysis state
     std::vector<float> analysisBuffer_;
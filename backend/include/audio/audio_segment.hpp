@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace audio {
+
+/**
+ * Pool of fixed-size sample blocks backing AudioSegment. Blocks return to
+ * the pool when the last segment referencing them goes away.
+ */
+class AudioBlockPool {
+public:
+    static constexpr size_t BLOCK_SAMPLES = 4096;
+
+    static AudioBlockPool& instance();
+
+    std::shared_ptr<float> acquire();
+
+    size_t getPooledBlocks() const;
+    size_t getAllocatedBlocks() const;
+
+private:
+    AudioBlockPool() = default;
+    void release(float* block);
+
+    mutable std::mutex mutex_;
+    std::vector<float*> free_;
+    size_t allocated_ = 0;
+    size_t maxPooled_ = 1024;
+};
+
+// Samples written into segments vs. copied back out to contiguous buffers
+struct AudioCopyStats {
+    uint64_t ingestedSamples = 0;
+    uint64_t materializedSamples = 0;
+
+    uint64_t copiedBytes() const { return (ingestedSamples + materializedSamples) * sizeof(float); }
+};
+
+/**
+ * Immutable, reference-counted audio: a chain of views into pooled blocks.
+ * Copying, slicing and appending segments share the blocks; samples are
+ * only copied when materialised into a contiguous buffer, which should
+ * happen at the inference boundary.
+ */
+class AudioSegment {
+public:
+    struct Chunk {
+        std::shared_ptr<const float> block;
+        size_t offset = 0;
+        size_t count = 0;
+
+        const float* data() const { return block.get() + offset; }
+    };
+
+    AudioSegment() = default;
+
+    // Copies the samples into pooled blocks
+    static AudioSegment copyOf(const float* samples, size_t count);
+    static AudioSegment copyOf(const std::vector<float>& samples) { return copyOf(samples.data(), samples.size()); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const std::vector<Chunk>& chunks() const { return chunks_; }
+
+    // Zero-copy views
+    AudioSegment slice(size_t begin, size_t count) const;
+    AudioSegment tail(size_t count) const;
+    void append(const AudioSegment& other);
+
+    // Contiguous samples without copying; nullptr if the segment spans blocks
+    const float* contiguousData() const;
+
+    // Contiguous copies, counted in the copy statistics
+    void copyTo(float* out) const;
+    std::vector<float> toVector() const;
+
+    static AudioCopyStats getCopyStats();
+    static void resetCopyStats();
+
+private:
+    friend class AudioSegmentBuilder;
+
+    void appendChunk(const Chunk& chunk);
+
+    std::vector<Chunk> chunks_;
+    size_t size_ = 0;
+};
+
+/**
+ * Append-only writer for a growing segment, e.g. an utterance being
+ * captured. Snapshots share the partially filled tail block: the builder
+ * only ever writes past the samples a snapshot can see.
+ */
+class AudioSegmentBuilder {
+public:
+    AudioSegmentBuilder() = default;
+    // One writer per tail block
+    AudioSegmentBuilder(const AudioSegmentBuilder&) = delete;
+    AudioSegmentBuilder& operator=(const AudioSegmentBuilder&) = delete;
+    AudioSegmentBuilder(AudioSegmentBuilder&&) = default;
+    AudioSegmentBuilder& operator=(AudioSegmentBuilder&&) = default;
+
+    void append(const float* samples, size_t count);
+    void append(const std::vector<float>& samples) { append(samples.data(), samples.size()); }
+    void append(const AudioSegment& segment);
+
+    size_t size() const { return sealed_.size() + (tailUsed_ - tailStart_); }
+    bool empty() const { return size() == 0; }
+
+    // Drops all but the most recent samples without copying
+    void keepLast(size_t count);
+
+    AudioSegment snapshot() const;
+    // Returns the segment and starts a new one
+    AudioSegment release();
+    void clear();
+
+private:
+    void sealTail();
+
+    AudioSegment sealed_;
+    std::shared_ptr<float> tail_;
+    size_t tailStart_ = 0;
+    size_t tailUsed_ = 0;
+};
+
+} // namespace audio
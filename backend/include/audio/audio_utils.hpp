@@ -12,6 +12,8 @@
 
 namespace audio {
 
+struct SignalStats;
+
 // Audio format specifications
 enum class AudioCodec { PCM_16, PCM_24, PCM_32, FLOAT_32, UNKNOWN };
 
@@ -182,6 +184,9 @@ public:
 private:
   static std::vector<float> computeFFT(const std::vector<float> &samples);
   static float findPeakAmplitude(const std::vector<float> &samples);
+  static float dynamicRange(float peakAmplitude, float noiseFloor);
+  static float zeroCrossingsPerSecond(const SignalStats &stats,
+                                      uint32_t sampleRate);
 };
 
 // Noise detector and analyzer
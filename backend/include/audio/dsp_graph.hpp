@@ -0,0 +1,360 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace audio {
+
+// Non-owning view over contiguous samples (std::span<float> once we move to C++20)
+class SampleSpan {
+public:
+    SampleSpan() : data_(nullptr), size_(0) {}
+    SampleSpan(float* data, size_t size) : data_(data), size_(size) {}
+    SampleSpan(std::vector<float>& samples) : data_(samples.data()), size_(samples.size()) {}
+
+    float* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    float* begin() const { return data_; }
+    float* end() const { return data_ + size_; }
+    float& operator[](size_t index) const { return data_[index]; }
+
+    SampleSpan subspan(size_t offset, size_t count) const {
+        if (offset >= size_) return SampleSpan();
+        return SampleSpan(data_ + offset, count < size_ - offset ? count : size_ - offset);
+    }
+
+private:
+    float* data_;
+    size_t size_;
+};
+
+// Processing stage in a DspGraph. All state is allocated in prepare(); process()
+// works in place on blocks no longer than the negotiated block size.
+class DspNode {
+public:
+    virtual ~DspNode() = default;
+
+    virtual const char* getName() const = 0;
+
+    // Granularity the node needs; the graph rounds its block size up to a multiple
+    virtual size_t getBlockQuantum() const { return 1; }
+    virtual size_t getLatencySamples() const { return 0; }
+
+    virtual void prepare(int sampleRate, size_t blockSize) = 0;
+    virtual void process(SampleSpan block) = 0;
+    virtual void reset() = 0;
+
+    void setBypassed(bool bypassed) { bypassed_ = bypassed; }
+    bool isBypassed() const { return bypassed_; }
+
+private:
+    bool bypassed_ = false;
+};
+
+// Linear chain of in-place nodes sharing one negotiated block size
+class DspGraph {
+public:
+    DspGraph();
+    ~DspGraph() = default;
+
+    DspGraph(const DspGraph&) = delete;
+    DspGraph& operator=(const DspGraph&) = delete;
+
+    // Graph construction; nodes added after prepare() are prepared immediately
+    DspNode* addNode(std::unique_ptr<DspNode> node);
+    DspNode* findNode(const std::string& name) const;
+    void clear();
+
+    // Negotiates the block size once and allocates node state; returns the block size
+    size_t prepare(int sampleRate, size_t requestedBlockSize);
+    bool isPrepared() const { return prepared_; }
+
+    // Runs every node over the samples in place, one block at a time
+    void process(SampleSpan samples);
+    void reset();
+
+    size_t getBlockSize() const { return blockSize_; }
+    int getSampleRate() const { return sampleRate_; }
+    size_t getNodeCount() const { return nodes_.size(); }
+    size_t getLatencySamples() const;
+    uint64_t getBlocksProcessed() const { return blocksProcessed_; }
+
+private:
+    std::vector<std::unique_ptr<DspNode>> nodes_;
+    int sampleRate_;
+    size_t blockSize_;
+    bool prepared_;
+    uint64_t blocksProcessed_;
+};
+
+// Per-sample kernels shared by the standalone nodes and FusedDynamicsNode
+
+struct AgcKernel {
+    float targetRMS = 0.1f;
+    float currentGain = 1.0f;
+    float currentRMS = 0.0f;
+    float blockGain = 1.0f;
+
+    // Updates the smoothed level from the block before any sample is touched
+    void beginBlock(const float* samples, size_t count);
+    float tick(float sample) const { return sample * blockGain; }
+    void reset();
+};
+
+struct CompressorKernel {
+    float ratio = 2.0f;
+    float threshold = 0.7f;
+    float attackCoeff = 1.0f;
+    float releaseCoeff = 1.0f;
+    float gain = 1.0f;
+
+    void setTimes(int sampleRate, float attackSeconds, float releaseSeconds);
+    float tick(float sample) {
+        float level = sample < 0.0f ? -sample : sample;
+        float target = 1.0f;
+        if (level > threshold) {
+            target = (threshold + (level - threshold) / ratio) / level;
+        }
+        float coeff = target < gain ? attackCoeff : releaseCoeff;
+        gain += coeff * (target - gain);
+        return sample * gain;
+    }
+    void reset() { gain = 1.0f; }
+};
+
+// Compresses the sibilant band (high-passed at ~5 kHz) and removes half of the excess
+struct DeEsserKernel {
+    float threshold = 0.0316f;  // -30 dB
+    float ratio = 6.0f;
+    float amount = 0.5f;
+    float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+    float x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f;
+
+    void setSampleRate(int sampleRate, float cutoffHz = 5000.0f);
+    float tick(float sample) {
+        float band = b0 * sample + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1; x1 = sample;
+        y2 = y1; y1 = band;
+        float level = band < 0.0f ? -band : band;
+        if (level <= threshold) {
+            return sample;
+        }
+        float compressed = threshold + (level - threshold) / ratio;
+        float reduction = (level - compressed) * (band < 0.0f ? -1.0f : 1.0f);
+        return sample - reduction * amount;
+    }
+    void reset() { x1 = x2 = y1 = y2 = 0.0f; }
+};
+
+struct LimiterKernel {
+    float threshold = 0.95f;
+    float tick(float sample) const {
+        return sample > threshold ? threshold : (sample < -threshold ? -threshold : sample);
+    }
+};
+
+// Standalone dynamics nodes
+
+class AutomaticGainNode : public DspNode {
+public:
+    explicit AutomaticGainNode(float targetRMS = 0.1f);
+    const char* getName() const override { return "agc"; }
+    void prepare(int sampleRate, size_t blockSize) override;
+    void process(SampleSpan block) override;
+    void reset() override { kernel_.reset(); }
+
+    void setTargetRMS(float targetRMS) { kernel_.targetRMS = targetRMS; }
+    float getCurrentGain() const { return kernel_.currentGain; }
+
+private:
+    AgcKernel kernel_;
+};
+
+class CompressorNode : public DspNode {
+public:
+    CompressorNode(float ratio = 2.0f, float threshold = 0.7f,
+                   float attackSeconds = 0.01f, float releaseSeconds = 0.1f);
+    const char* getName() const override { return "compressor"; }
+    void prepare(int sampleRate, size_t blockSize) override;
+    void process(SampleSpan block) override;
+    void reset() override { kernel_.reset(); }
+
+    void setParameters(float ratio, float threshold, float attackSeconds, float releaseSeconds);
+
+private:
+    CompressorKernel kernel_;
+    int sampleRate_;
+    float attackSeconds_;
+    float releaseSeconds_;
+};
+
+class DeEsserNode : public DspNode {
+public:
+    const char* getName() const override { return "de_esser"; }
+    void prepare(int sampleRate, size_t blockSize) override;
+    void process(SampleSpan block) override;
+    void reset() override { kernel_.reset(); }
+
+private:
+    DeEsserKernel kernel_;
+};
+
+class LimiterNode : public DspNode {
+public:
+    explicit LimiterNode(float threshold = 0.95f) { kernel_.threshold = threshold; }
+    const char* getName() const override { return "limiter"; }
+    void prepare(int, size_t) override {}
+    void process(SampleSpan block) override;
+    void reset() override {}
+
+private:
+    LimiterKernel kernel_;
+};
+
+// Gain, compression, de-essing and limiting in a single pass over the block
+class FusedDynamicsNode : public DspNode {
+public:
+    struct Config {
+        bool enableAGC = true;
+        bool enableCompression = true;
+        bool enableDeEsser = false;
+        bool enableLimiter = false;
+        float targetRMS = 0.1f;
+        float compressionRatio = 2.0f;
+        float compressionThreshold = 0.7f;
+        float attackSeconds = 0.01f;
+        float releaseSeconds = 0.1f;
+        float limiterThreshold = 0.95f;
+    };
+
+    FusedDynamicsNode();
+    explicit FusedDynamicsNode(const Config& config);
+    const char* getName() const override { return "dynamics"; }
+    void prepare(int sampleRate, size_t blockSize) override;
+    void process(SampleSpan block) override;
+    void reset() override;
+
+    // Parameter changes keep the envelope state
+    void setConfig(const Config& config);
+    const Config& getConfig() const { return config_; }
+    float getCurrentGain() const { return agc_.currentGain; }
+
+private:
+    Config config_;
+    int sampleRate_;
+    AgcKernel agc_;
+    CompressorKernel compressor_;
+    DeEsserKernel deEsser_;
+    LimiterKernel limiter_;
+};
+
+// Noise reduction nodes
+
+class NoiseGateNode : public DspNode {
+public:
+    explicit NoiseGateNode(float thresholdDb = -40.0f);
+    const char* getName() const override { return "noise_gate"; }
+    void prepare(int, size_t) override {}
+    void process(SampleSpan block) override;
+    void reset() override {}
+    void setThresholdDb(float thresholdDb);
+
+private:
+    float thresholdLinear_;
+};
+
+class WienerFilterNode : public DspNode {
+public:
+    explicit WienerFilterNode(float smoothingFactor = 0.1f, float noisePower = 0.01f)
+        : smoothingFactor_(smoothingFactor), noisePower_(noisePower) {}
+    const char* getName() const override { return "wiener"; }
+    void prepare(int, size_t) override {}
+    void process(SampleSpan block) override;
+    void reset() override {}
+    void setSmoothingFactor(float smoothingFactor) { smoothingFactor_ = smoothingFactor; }
+
+private:
+    float smoothingFactor_;
+    float noisePower_;
+};
+
+// Streaming STFT spectral subtraction (Hann window, 50% overlap-add). A sample is
+// final only once the next frame is added, so output lags input by one frame.
+class SpectralSubtractionNode : public DspNode {
+public:
+    explicit SpectralSubtractionNode(size_t frameSize = 1024, float alpha = 2.0f, float beta = 0.01f);
+    const char* getName() const override { return "spectral_subtraction"; }
+    size_t getLatencySamples() const override { return frameSize_; }
+    void prepare(int sampleRate, size_t blockSize) override;
+    void process(SampleSpan block) override;
+    void reset() override;
+
+    void setAlpha(float alpha) { alpha_ = alpha; }
+    void setBeta(float beta) { beta_ = beta; }
+
+    // Magnitude profile with frameSize / 2 bins, as kept by NoiseReductionFilter
+    void setNoiseProfile(const std::vector<float>& magnitudes);
+    void updateNoiseProfile(SampleSpan noise);
+    const std::vector<float>& getNoiseProfile() const { return noiseProfile_; }
+
+private:
+    size_t frameSize_;
+    size_t hopSize_;
+    float alpha_;
+    float beta_;
+
+    std::vector<float> window_;
+    std::vector<float> noiseProfile_;
+    std::vector<float> inputFifo_;
+    std::vector<float> outputFifo_;
+    std::vector<float> overlap_;
+    std::vector<std::complex<float>> spectrum_;
+    std::vector<std::complex<float>> twiddles_;
+    std::vector<size_t> bitReverse_;
+    size_t fifoPosition_;
+
+    void processFrame();
+    void fft(bool inverse);
+};
+
+// Adaptive echo cancellation (LMS / NLMS) over a circular input history, or
+// autocorrelation-based suppression within each block
+class EchoCancellerNode : public DspNode {
+public:
+    enum class Mode { LMS, NLMS, SUPPRESSION };
+
+    EchoCancellerNode(Mode mode = Mode::LMS, size_t filterLength = 512, float convergenceRate = 0.01f,
+                      float suppressionStrength = 0.7f);
+    const char* getName() const override { return "echo_canceller"; }
+    void prepare(int sampleRate, size_t blockSize) override;
+    void process(SampleSpan block) override;
+    void reset() override;
+
+    void setConvergenceRate(float rate) { convergenceRate_ = rate; }
+    void setSuppressionStrength(float strength) { suppressionStrength_ = strength; }
+    Mode getMode() const { return mode_; }
+
+private:
+    Mode mode_;
+    size_t filterLength_;
+    float convergenceRate_;
+    float suppressionStrength_;
+    int sampleRate_;
+
+    std::vector<float> filter_;
+    std::vector<float> history_;  // Twice the filter length so a window is always contiguous
+    size_t historyPosition_;
+    float historyPower_;
+    std::vector<float> autocorrelation_;
+
+    void processAdaptive(SampleSpan block);
+    void processSuppression(SampleSpan block);
+};
+
+} // namespace audio
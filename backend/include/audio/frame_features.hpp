@@ -0,0 +1,218 @@
+#pragma once
+
+#include "audio/signal_statistics.hpp"
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace audio {
+
+// Per-frame features; consumers declare the set they read as a bit mask
+enum class FrameFeature : uint32_t {
+    RMS = 1u << 0,
+    PEAK = 1u << 1,
+    ZERO_CROSSING_RATE = 1u << 2,
+    MAGNITUDE_SPECTRUM = 1u << 3,
+    POWER_SPECTRUM = 1u << 4,
+    SPECTRAL_CENTROID = 1u << 5,
+    SPECTRAL_BANDWIDTH = 1u << 6,
+    SPECTRAL_ROLLOFF = 1u << 7,
+    SPECTRAL_FLATNESS = 1u << 8,
+    MEL_ENERGIES = 1u << 9,
+    MFCC = 1u << 10
+};
+
+constexpr size_t FRAME_FEATURE_COUNT = 11;
+
+using FrameFeatureSet = uint32_t;
+
+constexpr FrameFeatureSet operator|(FrameFeature a, FrameFeature b) {
+    return static_cast<FrameFeatureSet>(a) | static_cast<FrameFeatureSet>(b);
+}
+constexpr FrameFeatureSet operator|(FrameFeatureSet set, FrameFeature feature) {
+    return set | static_cast<FrameFeatureSet>(feature);
+}
+constexpr bool hasFeature(FrameFeatureSet set, FrameFeature feature) {
+    return (set & static_cast<FrameFeatureSet>(feature)) != 0;
+}
+
+struct FrameAnalysisConfig {
+    int sampleRate = 16000;
+    size_t frameSize = 512;        // Samples per frame; the FFT is the next power of two
+    size_t hopSize = 512;          // Samples between frame starts
+    size_t melBands = 26;
+    size_t mfccCoefficients = 13;
+    float rolloffPercent = 0.85f;
+};
+
+/**
+ * Tables shared by every frame of one configuration: analysis window, FFT
+ * twiddles, mel filter bank and DCT matrix. Immutable once built, so one
+ * instance serves any number of threads.
+ */
+class FrameAnalysisTables {
+public:
+    static std::shared_ptr<const FrameAnalysisTables> create(const FrameAnalysisConfig& config);
+
+    const FrameAnalysisConfig& getConfig() const { return config_; }
+    size_t getFFTSize() const { return fftSize_; }
+    size_t getBinCount() const { return fftSize_ / 2 + 1; }
+    float binFrequency(size_t bin) const;
+
+    // Hann-windowed, zero-padded FFT of up to fftSize samples
+    void forwardFFT(const float* samples, size_t count, std::vector<std::complex<float>>& out) const;
+    void melEnergies(const std::vector<float>& powerSpectrum, std::vector<float>& out) const;
+    void dct(const std::vector<float>& logMel, std::vector<float>& out) const;
+
+private:
+    explicit FrameAnalysisTables(const FrameAnalysisConfig& config);
+
+    struct MelFilter {
+        size_t firstBin = 0;
+        std::vector<float> weights;
+    };
+
+    FrameAnalysisConfig config_;
+    size_t fftSize_;
+    std::vector<float> window_;
+    std::vector<size_t> bitReverse_;
+    std::vector<std::complex<float>> twiddles_;
+    std::vector<MelFilter> melFilters_;
+    std::vector<float> dctMatrix_;     // mfccCoefficients x melBands
+};
+
+/**
+ * Features of one frame, each computed on first access and kept for the
+ * frame's lifetime. Spectral features share one FFT, MFCCs reuse the power
+ * spectrum. Not thread-safe.
+ */
+class FrameFeatures {
+public:
+    explicit FrameFeatures(std::shared_ptr<const FrameAnalysisTables> tables);
+    FrameFeatures(std::shared_ptr<const FrameAnalysisTables> tables, const float* samples, size_t count);
+
+    // Replaces the frame; buffers are kept for the next frame
+    void assign(const float* samples, size_t count, uint64_t index = 0);
+
+    const std::vector<float>& samples() const { return samples_; }
+    size_t size() const { return samples_.size(); }
+    uint64_t index() const { return index_; }
+    int sampleRate() const { return tables_->getConfig().sampleRate; }
+    float binFrequency(size_t bin) const { return tables_->binFrequency(bin); }
+
+    float rms();
+    float peak();
+    float zeroCrossingRate();
+    const std::vector<float>& magnitudeSpectrum();
+    const std::vector<float>& powerSpectrum();
+    float spectralCentroid();
+    float spectralBandwidth();
+    float spectralRolloff();
+    float spectralFlatness();
+    const std::vector<float>& melEnergies();
+    const std::vector<float>& mfcc();
+
+    // Computes the given features now, e.g. those every subscriber declared
+    void compute(FrameFeatureSet features);
+    FrameFeatureSet computed() const { return computed_; }
+
+    // Features computed over every frame assigned to this object
+    const std::array<uint64_t, FRAME_FEATURE_COUNT>& getComputationCounts() const { return computations_; }
+
+private:
+    bool begin(FrameFeature feature);
+    const SignalStats& timeDomainStats();
+
+    std::shared_ptr<const FrameAnalysisTables> tables_;
+    std::vector<float> samples_;
+    uint64_t index_ = 0;
+    FrameFeatureSet computed_ = 0;
+    std::array<uint64_t, FRAME_FEATURE_COUNT> computations_{};
+
+    SignalStats timeDomain_;
+    bool timeDomainReady_ = false;
+    float rms_ = 0.0f;
+    float peak_ = 0.0f;
+    float zeroCrossingRate_ = 0.0f;
+    float centroid_ = 0.0f;
+    float bandwidth_ = 0.0f;
+    float rolloff_ = 0.0f;
+    float flatness_ = 0.0f;
+    std::vector<std::complex<float>> fft_;
+    std::vector<float> magnitude_;
+    std::vector<float> power_;
+    std::vector<float> mel_;
+    std::vector<float> mfcc_;
+};
+
+/**
+ * Per-session frame feature pipeline
+ *
+ * Audio pushed in is cut into frames of the configured size and hop. Each
+ * frame is analysed once: the union of the features subscribers declared is
+ * computed up front, anything else a subscriber reads is computed lazily and
+ * then shared with the subscribers after it. Subscribers run in subscription
+ * order on the pushing thread and must not subscribe or unsubscribe from
+ * inside the callback.
+ */
+class FrameFeatureBus {
+public:
+    using Subscriber = std::function<void(FrameFeatures& frame)>;
+    using SubscriptionId = uint64_t;
+
+    struct Stats {
+        uint64_t frames = 0;
+        std::array<uint64_t, FRAME_FEATURE_COUNT> computations{};
+    };
+
+    explicit FrameFeatureBus(const FrameAnalysisConfig& config = FrameAnalysisConfig{});
+
+    FrameFeatureBus(const FrameFeatureBus&) = delete;
+    FrameFeatureBus& operator=(const FrameFeatureBus&) = delete;
+
+    SubscriptionId subscribe(FrameFeatureSet declared, Subscriber subscriber);
+    void unsubscribe(SubscriptionId id);
+    size_t getSubscriberCount() const;
+    FrameFeatureSet getDeclaredFeatures() const;
+
+    // Returns the number of frames published
+    size_t push(const float* samples, size_t count);
+    size_t push(const std::vector<float>& samples) { return push(samples.data(), samples.size()); }
+
+    // Drops samples still waiting for a complete frame
+    void reset();
+
+    // Features of an already framed block, sharing this bus's tables
+    FrameFeatures analyze(const float* samples, size_t count) const;
+    FrameFeatures analyze(const std::vector<float>& samples) const { return analyze(samples.data(), samples.size()); }
+
+    const FrameAnalysisConfig& getConfig() const { return tables_->getConfig(); }
+    std::shared_ptr<const FrameAnalysisTables> getTables() const { return tables_; }
+    Stats getStats() const;
+
+private:
+    struct Subscription {
+        SubscriptionId id;
+        FrameFeatureSet declared;
+        Subscriber subscriber;
+    };
+
+    std::shared_ptr<const FrameAnalysisTables> tables_;
+
+    mutable std::mutex mutex_;
+    std::vector<Subscription> subscriptions_;
+    FrameFeatureSet declared_ = 0;
+    SubscriptionId nextId_ = 1;
+
+    std::vector<float> pending_;
+    size_t pendingOffset_ = 0;
+    FrameFeatures frame_;
+    uint64_t frames_ = 0;
+};
+
+} // namespace audio
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "audio/streaming_optimizer.hpp"
+#include "utils/timer_service.hpp"
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -276,7 +277,7 @@ private:
   // Monitoring configuration
   int updateIntervalMs_;
   std::atomic<bool> monitoring_;
-  std::unique_ptr<std::thread> monitoringThread_;
+  speechrnt::utils::TimerService::TimerId monitoringTimer_;
 
   // Current resources
   mutable std::mutex resourcesMutex_;
@@ -286,7 +287,7 @@ private:
   std::vector<std::function<void(const SystemResources &)>> resourceCallbacks_;
 
   // Private methods
-  void monitoringLoop();
+  void sampleResources();
   SystemResources measureSystemResources();
   void notifyResourceChange(const SystemResources &resources);
   float getCpuUsage() const;
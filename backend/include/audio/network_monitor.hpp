@@ -1,5 +1,6 @@
 #pragma once
 
+#include "utils/timer_service.hpp"
 #include <atomic>
 #include <chrono>
 #include <functional>
@@ -118,7 +119,7 @@ private:
 
   // Monitoring state
   std::atomic<bool> monitoring_;
-  std::unique_ptr<std::thread> monitoringThread_;
+  speechrnt::utils::TimerService::TimerId monitoringTimer_;
 
   // Metrics storage
   mutable std::mutex metricsMutex_;
@@ -135,7 +136,7 @@ private:
   std::atomic<uint64_t> qualityChanges_;
 
   // Private methods
-  void monitoringLoop();
+  void runMeasurement();
   NetworkMetrics measureNetworkConditions();
   NetworkQuality classifyNetworkQuality(const NetworkMetrics &metrics) const;
   void notifyConditionChange(const NetworkMetrics &metrics,
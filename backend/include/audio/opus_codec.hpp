@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace audio {
+
+/**
+ * Opus encoder settings
+ */
+struct OpusCodecConfig {
+    int sampleRate;       // Codec rate: 8000, 12000, 16000, 24000 or 48000
+    int channels;         // 1 or 2
+    int bitrate;          // Target bitrate in bits per second
+    int frameDurationMs;  // 10, 20, 40 or 60
+    int complexity;       // 0-10, trades CPU for quality
+    bool enableFec;       // In-band forward error correction
+
+    OpusCodecConfig()
+        : sampleRate(16000), channels(1), bitrate(24000), frameDurationMs(20),
+          complexity(5), enableFec(true) {}
+
+    bool isValid() const;
+    int getFrameSamples() const { return sampleRate * frameDurationMs / 1000; }
+};
+
+/**
+ * Streaming Opus decoder. Holds the decoder state of one stream, so packets
+ * must be fed in sequence order.
+ */
+class OpusStreamDecoder {
+public:
+    OpusStreamDecoder();
+    ~OpusStreamDecoder();
+
+    OpusStreamDecoder(const OpusStreamDecoder&) = delete;
+    OpusStreamDecoder& operator=(const OpusStreamDecoder&) = delete;
+
+    /**
+     * Whether the build includes Opus support
+     */
+    static bool isAvailable();
+
+    bool initialize(int sampleRate, int channels = 1);
+    bool isInitialized() const { return decoder_ != nullptr; }
+
+    /**
+     * Decode one packet into normalized float samples (interleaved)
+     */
+    bool decode(std::string_view packet, std::vector<float>& samples);
+
+    /**
+     * Synthesize one frame of packet-loss concealment audio
+     */
+    bool concealLoss(std::vector<float>& samples);
+
+    void reset();
+
+    int getSampleRate() const { return sampleRate_; }
+    int getChannels() const { return channels_; }
+    const std::string& getLastError() const { return lastError_; }
+
+private:
+    void* decoder_;
+    int sampleRate_;
+    int channels_;
+    int lastFrameSamples_;
+    std::string lastError_;
+};
+
+/**
+ * Streaming Opus encoder. Accepts arbitrary-sized blocks at any input rate,
+ * resamples linearly to the codec rate and emits one packet per full frame.
+ */
+class OpusStreamEncoder {
+public:
+    OpusStreamEncoder();
+    ~OpusStreamEncoder();
+
+    OpusStreamEncoder(const OpusStreamEncoder&) = delete;
+    OpusStreamEncoder& operator=(const OpusStreamEncoder&) = delete;
+
+    bool initialize(const OpusCodecConfig& config);
+    bool isInitialized() const { return encoder_ != nullptr; }
+
+    /**
+     * Encode samples captured at inputSampleRate
+     * @return number of packets appended
+     */
+    size_t encode(const std::vector<float>& samples, int inputSampleRate,
+                  std::vector<std::vector<uint8_t>>& packets);
+
+    /**
+     * Encode the buffered partial frame, padded with silence
+     * @return number of packets appended
+     */
+    size_t flush(std::vector<std::vector<uint8_t>>& packets);
+
+    void reset();
+
+    bool setBitrate(int bitrate);
+    const OpusCodecConfig& getConfig() const { return config_; }
+    const std::string& getLastError() const { return lastError_; }
+
+    /**
+     * Closest rate Opus can encode natively
+     */
+    static int nearestSupportedSampleRate(int sampleRate);
+
+private:
+    void* encoder_;
+    OpusCodecConfig config_;
+    std::vector<float> pending_;
+    std::string lastError_;
+
+    // Linear resampler state
+    double resamplePosition_;
+    float resampleLast_;
+
+    void resample(const std::vector<float>& input, int inputSampleRate);
+    bool encodeFrame(const float* frame, std::vector<std::vector<uint8_t>>& packets);
+};
+
+} // namespace audio
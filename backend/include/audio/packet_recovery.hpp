@@ -191,6 +191,34 @@ public:
    */
   size_t detectSequenceGaps(std::vector<uint32_t> &missingSequences) const;
 
+  /**
+   * Consume a chunk directly when it is the next expected one and nothing is
+   * buffered, so in-order streams never touch the reorder map
+   * @param sequenceNumber Sequence number of the incoming chunk
+   * @return true if the chunk was consumed in order
+   */
+  bool tryAdvanceInOrder(uint32_t sequenceNumber);
+
+  /**
+   * Give up on missing chunks once the oldest buffered chunk has waited
+   * longer than maxWaitMs, resuming from the lowest buffered sequence number
+   * @param maxWaitMs Maximum time to wait for a missing chunk
+   * @return number of sequence numbers skipped
+   */
+  size_t skipStalledGap(int maxWaitMs);
+
+  /**
+   * Set the next sequence number expected from the stream
+   * @param sequenceNumber Next expected sequence number
+   */
+  void setExpectedSequenceNumber(uint32_t sequenceNumber);
+
+  /**
+   * Get the next sequence number expected from the stream
+   * @return next expected sequence number
+   */
+  uint32_t getExpectedSequenceNumber() const;
+
   /**
    * Get reorder buffer statistics
    * @return map of buffer statistics
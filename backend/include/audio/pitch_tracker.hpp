@@ -0,0 +1,111 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace audio {
+
+struct PitchTrackerConfig {
+    int sampleRate = 16000;
+    size_t frameSize = 1024;       // Analysis window in samples
+    size_t hopSize = 512;          // Samples between frame starts
+    float minFrequency = 80.0f;
+    float maxFrequency = 500.0f;
+    float peakThreshold = 0.9f;    // MPM: first key maximum within this fraction of the highest
+    float clarityThreshold = 0.7f; // Normalised peak height needed to call a frame voiced
+    float silenceRms = 0.005f;     // Frames quieter than this are unvoiced
+};
+
+// Pitch of one analysis frame
+struct PitchEstimate {
+    uint64_t frameIndex = 0;
+    float frequency = 0.0f;        // Hz; 0 when unvoiced
+    float clarity = 0.0f;          // Normalised autocorrelation at the chosen period, <= 1
+    bool voiced = false;
+};
+
+/**
+ * Running summary of a pitch track. Contours of consecutive stretches of
+ * audio merge into the contour of the whole, so consumers can fold in
+ * per-chunk deltas instead of re-analysing an utterance.
+ */
+struct PitchContour {
+    uint64_t frames = 0;
+    uint64_t voicedFrames = 0;
+    double mean = 0.0;             // Of voiced frequencies
+    double m2 = 0.0;               // Sum of squared deviations from the mean
+    float minFrequency = 0.0f;
+    float maxFrequency = 0.0f;
+    // Jitter: mean relative period change between consecutive voiced frames
+    double periodChangeSum = 0.0;
+    uint64_t periodChanges = 0;
+    float firstFrequency = 0.0f;   // First and last voiced frequency, to join merged contours
+    float lastFrequency = 0.0f;
+    bool firstVoiced = false;      // Whether the first and last frames were voiced
+    bool lastVoiced = false;
+
+    void add(const PitchEstimate& estimate);
+    void merge(const PitchContour& next);
+    void clear() { *this = PitchContour(); }
+
+    float stdDev() const;
+    float range() const { return voicedFrames > 0 ? maxFrequency - minFrequency : 0.0f; }
+    float jitter() const { return periodChanges > 0 ? static_cast<float>(periodChangeSum / periodChanges) : 0.0f; }
+    float voicedRatio() const { return frames > 0 ? static_cast<float>(voicedFrames) / frames : 0.0f; }
+};
+
+/**
+ * Streaming pitch tracker using the McLeod Pitch Method
+ *
+ * Audio is pushed in chunks of any size and analysed in overlapping frames.
+ * Each frame's normalised square difference function comes from an
+ * FFT-based autocorrelation, O(N log N) rather than O(N * lags). All
+ * buffers are sized at construction; analysing a frame allocates nothing.
+ * One tracker holds one stream's state and is not thread-safe.
+ */
+class PitchTracker {
+public:
+    using FrameCallback = std::function<void(const PitchEstimate& estimate)>;
+
+    explicit PitchTracker(const PitchTrackerConfig& config = PitchTrackerConfig{});
+
+    // Returns the number of frames analysed; each is added to the contour
+    size_t push(const float* samples, size_t count, const FrameCallback& onFrame = nullptr);
+    size_t push(const std::vector<float>& samples, const FrameCallback& onFrame = nullptr) {
+        return push(samples.data(), samples.size(), onFrame);
+    }
+
+    // Pitch of a single frame of up to frameSize samples, outside the stream
+    PitchEstimate analyze(const float* samples, size_t count);
+
+    const PitchContour& getContour() const { return contour_; }
+    const PitchTrackerConfig& getConfig() const { return config_; }
+    uint64_t getFrameCount() const { return frameIndex_; }
+
+    // Starts a new stream; buffers are kept
+    void reset();
+
+private:
+    void fft(std::vector<std::complex<float>>& data) const;
+
+    PitchTrackerConfig config_;
+    size_t fftSize_;
+    size_t minLag_;
+    size_t maxLag_;
+    std::vector<size_t> bitReverse_;
+    std::vector<std::complex<float>> twiddles_;
+
+    std::vector<float> pending_;               // Samples of the frame being filled
+    size_t pendingCount_ = 0;
+    std::vector<std::complex<float>> spectrum_;
+    std::vector<float> nsdf_;
+    std::vector<size_t> keyMaxima_;
+
+    uint64_t frameIndex_ = 0;
+    PitchContour contour_;
+};
+
+} // namespace audio
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "audio/network_monitor.hpp"
+#include "utils/timer_service.hpp"
 #include <atomic>
 #include <functional>
 #include <map>
@@ -272,9 +273,9 @@ private:
   std::shared_ptr<QualityDegradationManager> degradationManager_;
   std::shared_ptr<NetworkMonitor> networkMonitor_;
 
-  // Control thread
+  // Control timer
   std::atomic<bool> controlActive_;
-  std::unique_ptr<std::thread> controlThread_;
+  speechrnt::utils::TimerService::TimerId controlTimer_;
   int updateIntervalMs_;
 
   // Configuration
@@ -296,7 +297,7 @@ private:
   std::atomic<uint64_t> resourceAdjustments_;
 
   // Private methods
-  void controlLoop();
+  void runControlCycle();
   void performQualityControl();
   bool shouldAdjustForNetwork(NetworkQuality quality,
                               const NetworkMetrics &metrics) const;
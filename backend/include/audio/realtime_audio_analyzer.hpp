@@ -1,5 +1,7 @@
 #pragma once
 
+#include "audio/frame_features.hpp"
+#include "utils/spsc_ring_buffer.hpp"
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -202,6 +204,12 @@ private:
   float updateNoiseGateEnvelope(float input);
 };
 
+// Where RealTimeAudioAnalyzer analyses pushed audio
+enum class AnalysisThreading {
+  WORKER,       // A worker drains whole frames from a lock-free ring in batches
+  CALLER_THREAD // Frames are analysed inside processAudioChunk as they fill
+};
+
 // Main real-time audio analyzer class
 class RealTimeAudioAnalyzer {
 public:
@@ -214,11 +222,24 @@ public:
   void shutdown();
   bool isInitialized() const { return initialized_; }
 
-  // Audio processing
+  // Choose before initialize(); the default is WORKER
+  void setAnalysisThreading(AnalysisThreading threading);
+  AnalysisThreading getAnalysisThreading() const { return threading_; }
+
+  // Audio processing. Audio is analysed in whole frames of bufferSize
+  // samples. In WORKER mode pushes go through a single-producer ring, so
+  // they must all come from one thread at a time; CALLER_THREAD mode
+  // accepts any thread and serialises the analysis.
   void processAudioSample(float sample);
   void processAudioChunk(const std::vector<float> &chunk);
   void processAudioChunk(const float *samples, size_t count);
 
+  // Analyse the frames of a session feature bus instead of polling the
+  // internal buffer; features are shared with the bus's other subscribers
+  void attachFeatureBus(std::shared_ptr<FrameFeatureBus> bus);
+  void detachFeatureBus();
+  static FrameFeatureSet getRequiredFeatures();
+
   // Real-time metrics access
   RealTimeMetrics getCurrentMetrics() const;
   std::vector<RealTimeMetrics> getMetricsHistory(size_t samples) const;
@@ -246,6 +267,8 @@ public:
   uint32_t getSampleRate() const { return sampleRate_; }
   void setBufferSize(size_t bufferSize);
   size_t getBufferSize() const { return bufferSize_; }
+  // Metrics, level and spectral callbacks fire at most once per interval
+  // of analysed audio
   void setUpdateInterval(std::chrono::milliseconds interval);
 
   // Analysis parameters
@@ -286,13 +309,21 @@ private:
   std::atomic<bool> initialized_;
   std::atomic<bool> running_;
   std::atomic<bool> effectsEnabled_;
+  AnalysisThreading threading_;
 
   // Processing components
-  std::unique_ptr<CircularBuffer<float>> audioBuffer_;
+  std::unique_ptr<speechrnt::utils::SpscRingBuffer<float>> audioRing_;
   std::unique_ptr<CircularBuffer<RealTimeMetrics>> metricsBuffer_;
-  std::unique_ptr<RealTimeFFT> fftProcessor_;
+  std::shared_ptr<const FrameAnalysisTables> frameTables_;
+  std::atomic<uint64_t> frameTablesVersion_;
   std::unique_ptr<AudioEffectsProcessor> effectsProcessor_;
 
+  // Attached session feature bus
+  mutable std::mutex featureBusMutex_;
+  std::shared_ptr<FrameFeatureBus> featureBus_;
+  FrameFeatureBus::SubscriptionId featureSubscription_;
+  std::atomic<bool> featureBusAttached_;
+
   // Analysis parameters
   float noiseFloorThreshold_;
   float silenceThreshold_;
@@ -305,6 +336,15 @@ private:
   AudioLevelMetrics currentLevels_;
   SpectralAnalysis currentSpectral_;
 
+  // Frame assembly, owned by whichever thread analyses
+  std::mutex frameMutex_; // CALLER_THREAD mode only
+  std::vector<float> frameBuffer_;
+  size_t frameFill_;
+  std::unique_ptr<FrameFeatures> frame_;
+  uint64_t frameVersion_; // Tables version frame_ was built with
+  uint64_t frameIndex_;
+  size_t samplesSinceNotify_;
+
   // Level tracking
   float runningAverage_;
   float peakHold_;
@@ -316,6 +356,7 @@ private:
   float spectralFluxAccumulator_;
 
   // Dropout detection
+  float previousDropoutLevel_;
   mutable std::mutex dropoutMutex_;
   std::vector<AudioDropout> detectedDropouts_;
   std::chrono::steady_clock::time_point lastAudioTime_;
@@ -337,13 +378,21 @@ private:
   void processingLoop();
 
   // Analysis functions
-  void updateLevelMetrics(const std::vector<float> &samples);
-  void updateSpectralAnalysis(const std::vector<float> &samples);
-  void updateNoiseEstimation(const std::vector<float> &samples);
+  void rebuildFrameTables();
+  void enqueueAudio(const float *samples, size_t count);
+  void assembleFrames(const float *samples, size_t count);
+  size_t drainAudioRing();
+  void refreshFrame();
+  void analyzeBufferedFrame();
+  void analyzeFrame(FrameFeatures &frame);
+  void updateLevelMetrics(FrameFeatures &frame);
+  void updateSpectralAnalysis(FrameFeatures &frame);
+  void updateNoiseEstimation(FrameFeatures &frame);
   void updateSpeechDetection(const AudioLevelMetrics &levels,
                              const SpectralAnalysis &spectral);
-  void detectDropouts(const std::vector<float> &samples);
-  void updatePerformanceMetrics(std::chrono::microseconds processingTime);
+  void detectDropouts(FrameFeatures &frame);
+  void updatePerformanceMetrics(std::chrono::microseconds processingTime,
+                                size_t samplesProcessed);
 
   // Callback notification
   void notifyMetricsCallbacks(const RealTimeMetrics &metrics);
@@ -351,25 +400,11 @@ private:
   void notifySpectralCallbacks(const SpectralAnalysis &spectral);
 
   // Helper functions
-  float calculateRMS(const std::vector<float> &samples);
-  float calculatePeak(const std::vector<float> &samples);
-  float calculateSpectralCentroid(const std::vector<float> &spectrum,
-                                  uint32_t sampleRate);
-  float calculateSpectralBandwidth(const std::vector<float> &spectrum,
-                                   float centroid, uint32_t sampleRate);
-  float calculateSpectralRolloff(const std::vector<float> &spectrum,
-                                 uint32_t sampleRate,
-                                 float rolloffPercent = 0.85f);
-  float calculateSpectralFlatness(const std::vector<float> &spectrum);
   float calculateSpectralFlux(const std::vector<float> &currentSpectrum,
                               const std::vector<float> &previousSpectrum);
-  std::vector<float> calculateMFCC(const std::vector<float> &spectrum,
-                                   uint32_t sampleRate);
-  float estimateNoiseLevel(const std::vector<float> &samples);
+  float estimateNoiseLevel(float rms);
   float calculateSpeechProbability(const AudioLevelMetrics &levels,
                                    const SpectralAnalysis &spectral);
-  bool detectClipping(const std::vector<float> &samples, float threshold);
-  bool detectSilence(const std::vector<float> &samples, float threshold);
 };
 
 } // namespace audio
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace audio {
+
+// Instruction sets the statistics kernels are built for, in ascending order
+enum class SimdLevel { SCALAR, SSE2, AVX2, AVX512 };
+
+const char* simdLevelName(SimdLevel level);
+
+struct SignalStatsThresholds {
+    float clipping = 0.95f;   // |x| >= clipping counts as clipped
+    float silence = 0.01f;    // |x| < silence counts as silent
+};
+
+// Time-domain statistics of one buffer, gathered in a single sweep
+struct SignalStats {
+    size_t count = 0;
+    double sumSquares = 0.0;
+    float peak = 0.0f;                 // Largest |x|
+    size_t zeroCrossings = 0;          // Sign changes between neighbours, x >= 0 vs. x < 0
+    size_t clippedSamples = 0;
+    size_t silentSamples = 0;
+    size_t silenceRuns = 0;            // Maximal runs of consecutive silent samples
+    size_t longestSilenceRun = 0;
+
+    float rms() const {
+        return count > 0 ? static_cast<float>(std::sqrt(sumSquares / static_cast<double>(count))) : 0.0f;
+    }
+    // Crossings per neighbouring pair, in [0, 1]
+    float zeroCrossingRate() const {
+        return count > 1 ? static_cast<float>(zeroCrossings) / static_cast<float>(count - 1) : 0.0f;
+    }
+    float silentFraction() const {
+        return count > 0 ? static_cast<float>(silentSamples) / static_cast<float>(count) : 0.0f;
+    }
+};
+
+/**
+ * Fused signal statistics kernels with runtime dispatch
+ *
+ * The kernel for the widest instruction set the CPU supports is picked on
+ * first use; every level produces the same counts, and sums that agree to
+ * float rounding. Kernels only exist for x86 builds with GCC or Clang, other
+ * targets use the scalar loop.
+ */
+class SignalStatistics {
+public:
+    static SignalStats compute(const float* samples, size_t count,
+                               const SignalStatsThresholds& thresholds = SignalStatsThresholds{});
+    static SignalStats compute(const std::vector<float>& samples,
+                               const SignalStatsThresholds& thresholds = SignalStatsThresholds{}) {
+        return compute(samples.data(), samples.size(), thresholds);
+    }
+
+    static SimdLevel getSupportedLevel();
+    static SimdLevel getActiveLevel();
+    // Forces a level, clamped to what the CPU supports; for tests and benchmarks
+    static SimdLevel setActiveLevel(SimdLevel level);
+};
+
+} // namespace audio
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "audio/frame_features.hpp"
 #include <memory>
 #include <mutex>
 #include <string>
@@ -34,6 +35,8 @@ public:
 
   // Audio processing
   float processSamples(const std::vector<float> &samples);
+  // Same as processSamples, reading energy and spectrum from shared features
+  float processFrame(FrameFeatures &frame);
   void reset(); // Reset internal state
 
   // Configuration
@@ -67,6 +70,7 @@ private:
   std::unique_ptr<OnnxSession> onnxSession_;
 
   // Energy-based VAD fallback
+  std::shared_ptr<const FrameAnalysisTables> frameTables_;
   float energyThreshold_;
   std::vector<float> energyHistory_;
   size_t energyHistorySize_;
@@ -80,10 +84,7 @@ private:
   void unloadSileroModel();
 
   float processSileroVad(const std::vector<float> &samples);
-  float processEnergyBasedVad(const std::vector<float> &samples);
-
-  float calculateRmsEnergy(const std::vector<float> &samples);
-  float calculateSpectralCentroid(const std::vector<float> &samples);
+  float processEnergyBasedVad(FrameFeatures &frame);
 
   void updateStatistics(bool usedSilero, float confidence,
                         double processingTimeMs);
@@ -114,6 +115,7 @@ public:
 
   void configure(const Config &config);
   float detectVoiceActivity(const std::vector<float> &samples);
+  float detectVoiceActivity(FrameFeatures &frame);
   void reset();
 
 private:
@@ -121,9 +123,8 @@ private:
   float adaptiveThreshold_;
   std::vector<float> energyHistory_;
   std::vector<float> spectralHistory_;
+  std::shared_ptr<const FrameAnalysisTables> frameTables_;
 
-  float calculateEnergy(const std::vector<float> &samples);
-  float calculateSpectralFeatures(const std::vector<float> &samples);
   void updateAdaptiveThreshold(float currentEnergy);
 };
 
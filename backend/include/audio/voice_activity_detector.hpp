@@ -1,5 +1,7 @@
 #pragma once
 
+#include "audio/audio_segment.hpp"
+#include "audio/frame_features.hpp"
 #include <vector>
 #include <functional>
 #include <memory>
@@ -60,6 +62,9 @@ class VoiceActivityDetector {
 public:
     using VadCallback = std::function<void(const VadEvent& event)>;
     using UtteranceCallback = std::function<void(uint32_t utteranceId, const std::vector<float>& audioData)>;
+    // Shares the captured samples; preferred over UtteranceCallback, which
+    // materialises a contiguous copy
+    using UtteranceSegmentCallback = std::function<void(uint32_t utteranceId, const AudioSegment& audio)>;
     
     explicit VoiceActivityDetector(const VadConfig& config = VadConfig{});
     ~VoiceActivityDetector();
@@ -76,11 +81,20 @@ public:
     // Callback registration
     void setVadCallback(VadCallback callback);
     void setUtteranceCallback(UtteranceCallback callback);
+    void setUtteranceSegmentCallback(UtteranceSegmentCallback callback);
     
     // Audio processing
     void processAudio(const std::vector<float>& audioData);
     void processAudioChunk(const std::vector<float>& audioData, std::chrono::steady_clock::time_point timestamp);
     
+    // Session feature bus: the VAD runs on the bus's frames and shares their
+    // features with the session's other per-frame consumers. Audio then goes
+    // to the bus instead of processAudio.
+    void attachFeatureBus(std::shared_ptr<FrameFeatureBus> bus);
+    void detachFeatureBus();
+    void processFrame(FrameFeatures& frame);
+    static FrameFeatureSet getRequiredFeatures();
+    
     // State management
     VadState getCurrentState() const { return currentState_; }
     uint32_t getCurrentUtteranceId() const { return currentUtteranceId_; }
@@ -93,6 +107,7 @@ public:
     
     // Utterance management
     std::vector<float> getCurrentUtteranceAudio() const;
+    AudioSegment getCurrentUtteranceSegment() const;
     void forceUtteranceEnd(); // Force end current utterance
     void reset(); // Reset to IDLE state
     
@@ -139,11 +154,12 @@ private:
     
     // Audio buffering for current utterance
     mutable std::mutex audioMutex_;
-    std::vector<float> currentUtteranceAudio_;
+    AudioSegmentBuilder currentUtteranceAudio_;
     
     // Callbacks
     VadCallback vadCallback_;
     UtteranceCallback utteranceCallback_;
+    UtteranceSegmentCallback utteranceSegmentCallback_;
     
     // Statistics
     mutable std::mutex statsMutex_;
@@ -156,6 +172,10 @@ private:
     std::unique_ptr<SileroVadImpl> sileroVad_;
     std::unique_ptr<EnergyBasedVAD> energyBasedVad_;
     
+    // Attached session feature bus
+    std::shared_ptr<FrameFeatureBus> featureBus_;
+    FrameFeatureBus::SubscriptionId featureSubscription_;
+    
     // Internal methods
     void transitionToState(VadState newState, float confidence);
     void processStateTransition(VadState newState, float confidence);
@@ -167,6 +187,7 @@ private:
     
     // Audio analysis
     float analyzeSpeechProbability(const std::vector<float>& audioData);
+    void updateVadState(const std::vector<float>& audioData, float speechProbability);
     bool shouldTransitionToSpeaking() const;
     bool shouldTransitionToPause() const;
     bool shouldTransitionToIdle() const;
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace core {
+
+/**
+ * Pipeline stages whose load the admission controller tracks
+ */
+enum class AdmissionStage {
+    TRANSCRIPTION = 0,
+    TRANSLATION = 1,
+    SYNTHESIS = 2
+};
+
+enum class AdmissionDecision {
+    ADMIT,      // Full feature set
+    DEGRADE,    // Admitted with some features turned off
+    REJECT      // No capacity; client should retry later
+};
+
+/**
+ * Features a session runs with
+ * Degraded sessions give up the most expensive features first.
+ */
+struct SessionProfile {
+    bool partialResults = true;    // Streaming partial transcriptions
+    bool reducedModel = false;     // Smaller, faster STT model
+    bool speechSynthesis = true;   // TTS of the translation
+
+    bool isFullQuality() const { return partialResults && !reducedModel && speechSynthesis; }
+};
+
+/**
+ * Outcome of an admission check
+ */
+struct AdmissionResult {
+    AdmissionDecision decision = AdmissionDecision::ADMIT;
+    SessionProfile profile;
+    std::string reason;
+    double predictedLatencyMs = 0.0;     // Utterance latency once admitted
+    double predictedUtilization = 0.0;   // Pipeline utilization once admitted
+    uint32_t retryAfterMs = 0;           // Only set when rejected
+};
+
+/**
+ * Admission controller configuration
+ */
+struct AdmissionConfig {
+    size_t workerCount = 0;                  // Jobs the host runs in parallel; 0 = hardware concurrency
+    double latencySloMs = 1500.0;            // End-to-end target for one utterance
+    double targetUtilization = 0.7;          // Full-quality sessions admitted up to this
+    double maxUtilization = 0.9;             // Degraded sessions admitted up to this
+    double shedLatencyFactor = 2.0;          // New work is shed past latencySloMs times this
+    size_t maxSessions = 64;
+    std::chrono::milliseconds window{10000}; // Busy time window behind the utilization estimate
+    double serviceTimeAlpha = 0.2;           // EWMA smoothing of per-stage service times
+    size_t minSamples = 5;                   // Samples in the window before measurements replace defaults
+
+    // Used until enough samples exist: per-job service time, and ms of work
+    // one full-quality session generates per second
+    std::array<double, 3> defaultServiceTimeMs{{400.0, 80.0, 250.0}};
+    std::array<double, 3> defaultSessionDemandMs{{250.0, 30.0, 100.0}};
+
+    double partialResultsShare = 0.4;   // Share of STT work spent on partial results
+    double reducedModelFactor = 0.35;   // Cost of the reduced STT model relative to the default
+    uint32_t minRetryAfterMs = 2000;
+};
+
+/**
+ * Central admission control and load shedding
+ *
+ * Stages report measured service times and queue depth changes; from those
+ * the controller keeps per-stage EWMA service times and the busy time over a
+ * sliding window. Utilization is busy time over (window x workers), falling
+ * back to a per-session default demand until a stage has samples, and the
+ * latency of an utterance is predicted per stage as its service time plus
+ * the time to drain the queue ahead of it plus an M/M/c-style waiting term
+ * that grows as utilization approaches one.
+ *
+ * A new session is admitted at full quality if that keeps utilization under
+ * targetUtilization and latency under the SLO; otherwise progressively
+ * cheaper profiles are tried up to maxUtilization, and the session is
+ * rejected with a retry hint if none fits.
+ */
+class AdmissionController {
+public:
+    static constexpr size_t STAGE_COUNT = 3;
+
+    /**
+     * Statistics for health endpoints
+     */
+    struct Stats {
+        size_t activeSessions = 0;
+        size_t degradedSessions = 0;
+        size_t workerCount = 0;
+        double utilization = 0.0;
+        double predictedLatencyMs = 0.0;
+        bool acceptingWork = true;
+        std::array<double, STAGE_COUNT> serviceTimeMs{};
+        std::array<double, STAGE_COUNT> busyMsPerSecond{};
+        std::array<size_t, STAGE_COUNT> queueDepth{};
+        uint64_t admitted = 0;
+        uint64_t degraded = 0;
+        uint64_t rejected = 0;
+        uint64_t shed = 0;
+        AdmissionResult lastDecision;
+    };
+
+    static AdmissionController& getInstance();
+
+    explicit AdmissionController(const AdmissionConfig& config = AdmissionConfig{});
+
+    AdmissionController(const AdmissionController&) = delete;
+    AdmissionController& operator=(const AdmissionController&) = delete;
+
+    void setConfig(const AdmissionConfig& config);
+    AdmissionConfig getConfig() const;
+
+    /**
+     * Record one job's service time (time on a worker, excluding queueing)
+     */
+    void recordServiceTime(AdmissionStage stage, double serviceTimeMs);
+
+    /**
+     * Adjust a stage's queue depth; +1 on enqueue, -1 on dequeue
+     */
+    void adjustQueueDepth(AdmissionStage stage, int delta);
+
+    /**
+     * Decide whether a new session fits, without registering it
+     */
+    AdmissionResult evaluateNewSession() const;
+
+    /**
+     * Evaluate and, unless rejected, register a new session
+     */
+    AdmissionResult admitSession(const std::string& sessionId);
+
+    void releaseSession(const std::string& sessionId);
+
+    /**
+     * Whether admitted sessions may start new work
+     * False once utilization passes maxUtilization or predicted latency passes
+     * the shedding limit; callers drop or defer the work.
+     */
+    bool canAcceptWork() const;
+
+    /**
+     * Count work shed because canAcceptWork() returned false
+     */
+    void recordShed();
+
+    Stats getStats() const;
+
+    /**
+     * Statistics as a JSON object
+     */
+    std::string exportStatusJSON() const;
+
+    static std::string decisionToString(AdmissionDecision decision);
+    static std::string stageToString(AdmissionStage stage);
+
+private:
+    struct StageState {
+        double serviceTimeMs = 0.0;
+        size_t samples = 0;
+        size_t queueDepth = 0;
+        std::deque<std::pair<std::chrono::steady_clock::time_point, double>> window;
+        double windowBusyMs = 0.0;
+    };
+
+    using Demand = std::array<double, STAGE_COUNT>;
+
+    void pruneWindowLocked(std::chrono::steady_clock::time_point now) const;
+    size_t workersLocked() const;
+    double serviceTimeLocked(size_t stage) const;
+    double busyRateLocked(size_t stage) const;
+    Demand stageCost(const SessionProfile& profile) const;
+    Demand equivalentSessionsLocked() const;
+    bool hasMeasurementsLocked(size_t stage) const;
+    Demand stageLoadLocked() const;
+    Demand sessionDemandLocked() const;
+    double utilizationLocked(const Demand& extra) const;
+    double predictLatencyLocked(const SessionProfile& profile, double utilization) const;
+    AdmissionResult evaluateLocked() const;
+    bool canAcceptWorkLocked() const;
+
+    AdmissionConfig config_;
+    mutable std::mutex mutex_;
+    mutable std::array<StageState, STAGE_COUNT> stages_;
+    std::unordered_map<std::string, SessionProfile> sessions_;
+    std::chrono::steady_clock::time_point started_;
+
+    uint64_t admitted_ = 0;
+    uint64_t degraded_ = 0;
+    uint64_t rejected_ = 0;
+    uint64_t shed_ = 0;
+    AdmissionResult lastDecision_;
+};
+
+} // namespace core
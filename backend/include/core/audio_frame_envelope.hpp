@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace audio {
+class AudioChunkReorderBuffer;
+}
+
+namespace core {
+
+/**
+ * Codec of the payload carried by a binary audio frame
+ */
+enum class AudioFrameCodec : uint8_t {
+    PCM_S16LE = 0,  // 16-bit signed little-endian PCM
+    PCM_F32LE = 1,  // 32-bit float little-endian PCM
+    OPUS = 2        // Opus packet
+};
+
+/**
+ * Per-frame flags
+ */
+namespace AudioFrameFlags {
+    constexpr uint16_t END_OF_UTTERANCE = 1u << 0;   // Client ended the utterance (e.g. push-to-talk release)
+    constexpr uint16_t START_OF_UTTERANCE = 1u << 1; // First frame of a new utterance
+    constexpr uint16_t DISCONTINUITY = 1u << 2;      // Sequence restarted; do not wait for older frames
+}
+
+/**
+ * Decoded audio frame header
+ */
+struct AudioFrameHeader {
+    uint8_t version = 1;
+    AudioFrameCodec codec = AudioFrameCodec::PCM_S16LE;
+    uint32_t sampleRate = 16000;
+    uint16_t flags = 0;
+    uint32_t sequenceNumber = 0;
+    uint64_t captureTimestampUs = 0; // Client wall clock, microseconds since Unix epoch; 0 if unknown
+
+    bool hasFlag(uint16_t flag) const { return (flags & flag) != 0; }
+};
+
+/**
+ * Parsed view over a binary frame. The payload aliases the input buffer.
+ */
+struct AudioFrameView {
+    bool hasEnvelope = false;
+    AudioFrameHeader header;
+    std::string_view payload;
+};
+
+enum class AudioFrameParseResult {
+    LEGACY_RAW,  // No envelope; the whole frame is raw PCM
+    ENVELOPE,    // Valid envelope
+    MALFORMED    // Envelope magic present but the header is invalid
+};
+
+/**
+ * Versioned binary envelope for WebSocket audio frames.
+ *
+ * Layout (little-endian, 24 bytes for version 1):
+ *   0  magic "SRAF"
+ *   4  uint8  version
+ *   5  uint8  header size in bytes (payload starts here)
+ *   6  uint8  codec (AudioFrameCodec)
+ *   7  uint8  sample rate id
+ *   8  uint16 flags (AudioFrameFlags)
+ *   10 uint16 reserved
+ *   12 uint32 sequence number
+ *   16 uint64 capture timestamp (microseconds since Unix epoch)
+ *
+ * Newer minor revisions may append fields; parsers skip up to the declared
+ * header size. Frames without the magic are treated as legacy raw PCM.
+ */
+class AudioFrameEnvelope {
+public:
+    static constexpr uint8_t VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 24;
+
+    /**
+     * Parse a binary frame without copying the payload
+     */
+    static AudioFrameParseResult parse(std::string_view data, AudioFrameView& out);
+
+    /**
+     * Build an enveloped frame (used by clients, tools and tests)
+     */
+    static std::vector<uint8_t> serialize(const AudioFrameHeader& header, std::string_view payload);
+
+    /**
+     * Map between sample rates and their one-byte ids; unknown values map to 0
+     */
+    static uint8_t sampleRateToId(uint32_t sampleRate);
+    static uint32_t sampleRateFromId(uint8_t id);
+
+    /**
+     * Bytes per sample for PCM codecs, 0 for compressed codecs
+     */
+    static size_t bytesPerSample(AudioFrameCodec codec);
+};
+
+/**
+ * Restores sequence order of enveloped frames and decodes their payload.
+ *
+ * In-order frames are decoded straight from the input view; only
+ * out-of-order frames are parked in an AudioChunkReorderBuffer. A missing
+ * frame holds delivery back for at most gapWaitMs before it is counted as
+ * lost and skipped. Compressed payloads are decoded in sequence order through
+ * the installed decoder, which is also asked to conceal skipped frames.
+ */
+class AudioFrameSequencer {
+public:
+    struct OrderedFrame {
+        uint32_t sequenceNumber = 0;
+        std::vector<float> samples;
+        bool endOfUtterance = false;
+    };
+
+    /**
+     * Decodes one compressed payload; an empty payload requests one frame of
+     * loss concealment
+     */
+    using PayloadDecoder = std::function<bool(std::string_view payload, std::vector<float>& samples)>;
+
+    struct Statistics {
+        uint64_t framesReceived = 0;
+        uint64_t framesInOrder = 0;
+        uint64_t framesReordered = 0;
+        uint64_t framesLate = 0;   // Arrived after their slot was skipped or delivered
+        uint64_t framesLost = 0;   // Sequence numbers skipped after waiting
+        uint64_t framesConcealed = 0;
+        uint64_t decodeErrors = 0;
+    };
+
+    explicit AudioFrameSequencer(size_t maxBufferedFrames = 50, int reorderTimeoutMs = 500,
+                                 int gapWaitMs = 120);
+    ~AudioFrameSequencer();
+
+    AudioFrameSequencer(const AudioFrameSequencer&) = delete;
+    AudioFrameSequencer& operator=(const AudioFrameSequencer&) = delete;
+
+    /**
+     * Accept an enveloped frame and append every frame that is now
+     * deliverable, in order, to ready.
+     * Returns false if the payload is not a whole number of PCM samples or
+     * the codec is compressed and no decoder is installed.
+     */
+    bool push(const AudioFrameView& frame, std::vector<OrderedFrame>& ready);
+
+    /**
+     * Install the decoder for compressed (Opus) payloads
+     */
+    void setCompressedDecoder(PayloadDecoder decoder, size_t maxConcealedFrames = 3);
+
+    Statistics getStatistics() const { return stats_; }
+    void reset();
+
+    /**
+     * Decode a PCM payload into normalized float samples
+     */
+    static bool decodePCM(AudioFrameCodec codec, std::string_view payload, std::vector<float>& samples);
+
+private:
+    std::unique_ptr<audio::AudioChunkReorderBuffer> reorderBuffer_;
+    int gapWaitMs_;
+    bool started_;
+    Statistics stats_;
+
+    PayloadDecoder compressedDecoder_;
+    size_t maxConcealedFrames_;
+    AudioFrameCodec streamCodec_;
+    std::unordered_map<uint32_t, std::string> parkedPayloads_; // Compressed frames awaiting order
+
+    bool decodePayload(AudioFrameCodec codec, std::string_view payload, std::vector<float>& samples);
+    void conceal(uint32_t firstSequence, size_t count, std::vector<OrderedFrame>& ready);
+    void drain(std::vector<OrderedFrame>& ready);
+};
+
+} // namespace core
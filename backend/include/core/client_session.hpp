@@ -3,18 +3,32 @@
 #include <string>
 #include <string_view>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <vector>
 #include <functional>
 #include "audio/audio_processor.hpp"
+#include "audio/frame_features.hpp"
+#include "audio/opus_codec.hpp"
 #include "audio/voice_activity_detector.hpp"
+#include "core/admission_controller.hpp"
+#include "core/audio_frame_envelope.hpp"
 #include "stt/streaming_transcriber.hpp"
 #include "stt/transcription_manager.hpp"
+#include "utils/trace_recorder.hpp"
+
+namespace speechrnt {
+namespace tts {
+class TTSInterface;
+class StreamingSynthesis;
+}
+}
 
 namespace core {
 
 // Forward declarations
 class WebSocketServer;
+class AudioStartMessage;
 class ConfigMessage;
 class EndSessionMessage;
 class PingMessage;
@@ -38,6 +52,26 @@ public:
     void sendMessage(const std::string& message);
     void sendBinaryMessage(const std::vector<uint8_t>& data);
     
+    // Send synthesized speech (WAV) to the client, Opus-encoded in enveloped
+    // frames when negotiated, otherwise as the raw WAV payload. Returns false
+    // without sending anything if the data is not a RIFF/WAV file
+    bool sendSynthesizedAudio(uint32_t utteranceId, const std::vector<uint8_t>& wavData);
+    
+    // Streamed speech synthesis: each sentence unit is sent with its own
+    // audio_start as soon as it is synthesized. Starting a new stream or the
+    // user speaking again cancels the one in progress. Returns false only if
+    // the session has no ready engine; speech skipped because of the
+    // admission profile or load shedding counts as handled.
+    // cancelSpeechSynthesis() waits for the engine thread, so it is not for
+    // use on the event loop.
+    void setTTSEngine(std::shared_ptr<speechrnt::tts::TTSInterface> engine);
+    bool streamSynthesizedSpeech(uint32_t utteranceId, const std::string& text);
+    void cancelSpeechSynthesis();
+    
+    // Features granted at admission; apply before transcription starts
+    void setAdmissionProfile(const SessionProfile& profile);
+    const SessionProfile& getAdmissionProfile() const { return admissionProfile_; }
+    
     // Session configuration
     void setLanguageConfig(const std::string& sourceLang, const std::string& targetLang);
     void setVoiceConfig(const std::string& voiceId);
@@ -51,8 +85,17 @@ public:
     void setAudioFormat(const audio::AudioFormat& format);
     const audio::AudioFormat& getAudioFormat() const;
     
+    // Codec negotiation
+    bool configureOutputCodec(const std::string& codec, int bitrate, int frameMs);
+    bool isOpusOutputEnabled() const { return opusEncoder_ != nullptr; }
+    
     // Audio statistics
     audio::AudioIngestionManager::Statistics getAudioStatistics() const;
+    AudioFrameSequencer::Statistics getAudioFrameStatistics() const;
+    
+    // Capture timestamp (client clock, microseconds since epoch) of the most
+    // recent enveloped frame, 0 if the client sends legacy raw frames
+    uint64_t getLastFrameCaptureTimestampUs() const { return lastFrameCaptureTimestampUs_; }
     
     // VAD management
     bool initializeVAD();
@@ -65,6 +108,10 @@ public:
     void setVADConfig(const audio::VadConfig& config);
     const audio::VadConfig& getVADConfig() const;
     
+    // Per-frame features of the ingested audio, framed at the VAD window.
+    // Other per-frame consumers subscribe here instead of re-analysing audio.
+    std::shared_ptr<audio::FrameFeatureBus> getFeatureBus() const { return featureBus_; }
+    
     // Pipeline triggering
     using PipelineCallback = std::function<void(uint32_t utteranceId, const std::vector<float>& audioData, 
                                                const std::string& sourceLang, const std::string& targetLang, 
@@ -80,15 +127,35 @@ private:
     std::string sourceLang_;
     std::string targetLang_;
     std::string voiceId_;
+    SessionProfile admissionProfile_;
     
     // Audio processing
     std::unique_ptr<audio::AudioIngestionManager> audioIngestion_;
+    AudioFrameSequencer frameSequencer_;
+    std::vector<AudioFrameSequencer::OrderedFrame> orderedFrames_;
+    uint64_t lastFrameCaptureTimestampUs_;
+    
+    // Opus codec state (created on negotiation / first Opus frame)
+    std::unique_ptr<audio::OpusStreamDecoder> opusDecoder_;
+    std::unique_ptr<audio::OpusStreamEncoder> opusEncoder_;
+    uint32_t outputSequenceNumber_;
+    std::mutex egressMutex_; // Synthesized audio is sent from TTS worker threads
+    
+    // Speech synthesis
+    std::shared_ptr<speechrnt::tts::TTSInterface> ttsEngine_;
+    std::shared_ptr<speechrnt::tts::StreamingSynthesis> activeSynthesis_;
+    std::mutex synthesisMutex_;
     
     // Voice Activity Detection
+    std::shared_ptr<audio::FrameFeatureBus> featureBus_;
     std::unique_ptr<audio::VoiceActivityDetector> vad_;
     audio::VadConfig vadConfig_;
     bool vadInitialized_;
     
+    // Trace of the utterance being spoken, sampled at speech onset
+    speechrnt::utils::TraceContext speechTrace_;
+    int64_t speechOnsetTraceNs_ = 0;
+    
     // Pipeline integration
     PipelineCallback pipelineCallback_;
     
@@ -97,19 +164,29 @@ private:
     std::unique_ptr<::stt::StreamingTranscriber> streamingTranscriber_;
     
     // VAD event handlers
+    void createFeatureBus();
     void handleVADEvent(const audio::VadEvent& event);
-    void handleUtteranceComplete(uint32_t utteranceId, const std::vector<float>& audioData);
+    void handleUtteranceComplete(uint32_t utteranceId, const audio::AudioSegment& audio);
     
     // Transcription management
     bool initializeTranscription();
     void shutdownTranscription();
-    void startStreamingTranscription(uint32_t utteranceId, const std::vector<float>& audioData);
+    void startStreamingTranscription(uint32_t utteranceId, const audio::AudioSegment& audio);
     
     // Message processing
     void processConfigMessage(const core::ConfigMessage* message);
     void processControlMessage(const core::EndSessionMessage* message);
     void processPingMessage(const core::PingMessage* message);
     void processAudioData(std::string_view data);
+    void processAudioFrame(const AudioFrameView& frame);
+    void processIngestedSamples(const std::vector<float>& samples);
+    bool ensureOpusDecoder(uint32_t sampleRate);
+    bool sendAudioSegment(AudioStartMessage& startMsg, const std::vector<uint8_t>& wavData);
+    // Cancels without waiting; safe on the event loop thread
+    void interruptSpeechSynthesis();
+    // Cancels the stream and waits for any unit still being delivered
+    void retireSynthesis(std::shared_ptr<speechrnt::tts::StreamingSynthesis> synthesis);
+    void recordCaptureLatency(const std::string& metric, uint64_t captureTimestampUs);
     
     // Language change handling
     void handleLanguageChange(const std::string& oldLang, const std::string& newLang, float confidence);
@@ -20,7 +20,8 @@ enum class MessageType {
     STATUS_UPDATE,
     ERROR,
     PONG,
-    LANGUAGE_CHANGE
+    LANGUAGE_CHANGE,
+    ADMISSION_STATUS
 };
 
 // Base message class
@@ -39,10 +40,12 @@ protected:
 // Client to Server Messages
 class ConfigMessage : public Message {
 public:
-    ConfigMessage() : Message(MessageType::CONFIG), languageDetectionEnabled_(false), autoLanguageSwitching_(false), languageDetectionThreshold_(0.7f) {}
+    ConfigMessage() : Message(MessageType::CONFIG), languageDetectionEnabled_(false), autoLanguageSwitching_(false), languageDetectionThreshold_(0.7f),
+                      inputCodec_(), outputCodec_(), opusBitrate_(24000), opusFrameMs_(20) {}
     ConfigMessage(const std::string& sourceLang, const std::string& targetLang, const std::string& voice)
         : Message(MessageType::CONFIG), sourceLang_(sourceLang), targetLang_(targetLang), voice_(voice), 
-          languageDetectionEnabled_(false), autoLanguageSwitching_(false), languageDetectionThreshold_(0.7f) {}
+          languageDetectionEnabled_(false), autoLanguageSwitching_(false), languageDetectionThreshold_(0.7f),
+          inputCodec_(), outputCodec_(), opusBitrate_(24000), opusFrameMs_(20) {}
     
     const std::string& getSourceLang() const { return sourceLang_; }
     const std::string& getTargetLang() const { return targetLang_; }
@@ -51,12 +54,22 @@ public:
     bool isAutoLanguageSwitching() const { return autoLanguageSwitching_; }
     float getLanguageDetectionThreshold() const { return languageDetectionThreshold_; }
     
+    // Audio codec negotiation ("pcm" or "opus"; empty leaves the session unchanged)
+    const std::string& getInputCodec() const { return inputCodec_; }
+    const std::string& getOutputCodec() const { return outputCodec_; }
+    int getOpusBitrate() const { return opusBitrate_; }
+    int getOpusFrameMs() const { return opusFrameMs_; }
+    
     void setSourceLang(const std::string& lang) { sourceLang_ = lang; }
     void setTargetLang(const std::string& lang) { targetLang_ = lang; }
     void setVoice(const std::string& voice) { voice_ = voice; }
     void setLanguageDetectionEnabled(bool enabled) { languageDetectionEnabled_ = enabled; }
     void setAutoLanguageSwitching(bool enabled) { autoLanguageSwitching_ = enabled; }
     void setLanguageDetectionThreshold(float threshold) { languageDetectionThreshold_ = threshold; }
+    void setInputCodec(const std::string& codec) { inputCodec_ = codec; }
+    void setOutputCodec(const std::string& codec) { outputCodec_ = codec; }
+    void setOpusBitrate(int bitrate) { opusBitrate_ = bitrate; }
+    void setOpusFrameMs(int frameMs) { opusFrameMs_ = frameMs; }
     
     std::string serialize() const override;
     
@@ -67,6 +80,10 @@ private:
     bool languageDetectionEnabled_;
     bool autoLanguageSwitching_;
     float languageDetectionThreshold_;
+    std::string inputCodec_;
+    std::string outputCodec_;
+    int opusBitrate_;
+    int opusFrameMs_;
 };
 
 class EndSessionMessage : public Message {
@@ -124,17 +141,20 @@ private:
 
 class TranslationResultMessage : public Message {
 public:
-    TranslationResultMessage() : Message(MessageType::TRANSLATION_RESULT), utteranceId_(0) {}
-    TranslationResultMessage(const std::string& originalText, const std::string& translatedText, uint32_t utteranceId)
-        : Message(MessageType::TRANSLATION_RESULT), originalText_(originalText), translatedText_(translatedText), utteranceId_(utteranceId) {}
+    TranslationResultMessage() : Message(MessageType::TRANSLATION_RESULT), utteranceId_(0), isPartial_(false) {}
+    TranslationResultMessage(const std::string& originalText, const std::string& translatedText, uint32_t utteranceId, bool isPartial = false)
+        : Message(MessageType::TRANSLATION_RESULT), originalText_(originalText), translatedText_(translatedText), utteranceId_(utteranceId), isPartial_(isPartial) {}
     
     const std::string& getOriginalText() const { return originalText_; }
     const std::string& getTranslatedText() const { return translatedText_; }
     uint32_t getUtteranceId() const { return utteranceId_; }
+    // Streamed while the utterance is still spoken; later updates extend the text
+    bool isPartial() const { return isPartial_; }
     
     void setOriginalText(const std::string& text) { originalText_ = text; }
     void setTranslatedText(const std::string& text) { translatedText_ = text; }
     void setUtteranceId(uint32_t id) { utteranceId_ = id; }
+    void setPartial(bool isPartial) { isPartial_ = isPartial; }
     
     std::string serialize() const override;
     
@@ -142,25 +162,42 @@ private:
     std::string originalText_;
     std::string translatedText_;
     uint32_t utteranceId_;
+    bool isPartial_;
 };
 
 class AudioStartMessage : public Message {
 public:
-    AudioStartMessage() : Message(MessageType::AUDIO_START), utteranceId_(0), duration_(0.0) {}
+    AudioStartMessage() : Message(MessageType::AUDIO_START), utteranceId_(0), duration_(0.0),
+        segmented_(false), segmentIndex_(0), finalSegment_(true) {}
     AudioStartMessage(uint32_t utteranceId, double duration)
-        : Message(MessageType::AUDIO_START), utteranceId_(utteranceId), duration_(duration) {}
+        : Message(MessageType::AUDIO_START), utteranceId_(utteranceId), duration_(duration),
+          segmented_(false), segmentIndex_(0), finalSegment_(true) {}
     
     uint32_t getUtteranceId() const { return utteranceId_; }
     double getDuration() const { return duration_; }
     
+    // Streamed synthesis sends one audio_start per sentence segment; duration
+    // then covers the segment only
+    bool isSegmented() const { return segmented_; }
+    uint32_t getSegmentIndex() const { return segmentIndex_; }
+    bool isFinalSegment() const { return finalSegment_; }
+    
     void setUtteranceId(uint32_t id) { utteranceId_ = id; }
     void setDuration(double duration) { duration_ = duration; }
+    void setSegment(uint32_t index, bool isFinal) {
+        segmented_ = true;
+        segmentIndex_ = index;
+        finalSegment_ = isFinal;
+    }
     
     std::string serialize() const override;
     
 private:
     uint32_t utteranceId_;
     double duration_;
+    bool segmented_;
+    uint32_t segmentIndex_;
+    bool finalSegment_;
 };
 
 class StatusUpdateMessage : public Message {
@@ -242,6 +279,39 @@ private:
     uint32_t utteranceId_;
 };
 
+// Sent on connect: whether the session was admitted, and which features
+// were turned off if it was admitted at reduced quality
+class AdmissionStatusMessage : public Message {
+public:
+    AdmissionStatusMessage() : Message(MessageType::ADMISSION_STATUS), partialResults_(true), reducedModel_(false), speechSynthesis_(true), retryAfterMs_(0) {}
+    AdmissionStatusMessage(const std::string& decision, const std::string& reason)
+        : Message(MessageType::ADMISSION_STATUS), decision_(decision), reason_(reason), partialResults_(true), reducedModel_(false), speechSynthesis_(true), retryAfterMs_(0) {}
+    
+    const std::string& getDecision() const { return decision_; }
+    const std::string& getReason() const { return reason_; }
+    bool getPartialResults() const { return partialResults_; }
+    bool getReducedModel() const { return reducedModel_; }
+    bool getSpeechSynthesis() const { return speechSynthesis_; }
+    uint32_t getRetryAfterMs() const { return retryAfterMs_; }
+    
+    void setDecision(const std::string& decision) { decision_ = decision; }
+    void setReason(const std::string& reason) { reason_ = reason; }
+    void setPartialResults(bool enabled) { partialResults_ = enabled; }
+    void setReducedModel(bool enabled) { reducedModel_ = enabled; }
+    void setSpeechSynthesis(bool enabled) { speechSynthesis_ = enabled; }
+    void setRetryAfterMs(uint32_t ms) { retryAfterMs_ = ms; }
+    
+    std::string serialize() const override;
+    
+private:
+    std::string decision_;   // "admit", "degrade" or "reject"
+    std::string reason_;
+    bool partialResults_;
+    bool reducedModel_;
+    bool speechSynthesis_;
+    uint32_t retryAfterMs_;
+};
+
 // Message factory and parser
 class MessageProtocol {
 public:
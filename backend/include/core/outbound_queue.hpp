@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace core {
+
+/**
+ * Outbound queue limits
+ */
+struct OutboundQueueConfig {
+    size_t maxBytes = 4 * 1024 * 1024;      // Queued payload bytes per session
+    size_t maxMessages = 1024;              // Queued messages per session
+    size_t socketHighWaterBytes = 256 * 1024; // Stop writing while the socket buffers more than this
+};
+
+enum class OutboundPriority {
+    HIGH,       // Finals, audio, control; never reordered among themselves
+    PARTIAL     // Partial transcripts and translations; superseded by newer ones for the same utterance
+};
+
+/**
+ * Point-in-time view of one session's outbound state
+ */
+struct OutboundStats {
+    size_t queuedBytes = 0;
+    size_t queuedMessages = 0;
+    size_t socketBufferedBytes = 0;
+    uint64_t sent = 0;
+    uint64_t coalesced = 0;        // Partials replaced or made obsolete before sending
+    uint64_t droppedPartials = 0;  // Partials evicted to stay under the caps
+    uint64_t dropped = 0;          // Other messages refused because the queue was full
+};
+
+/**
+ * Counters behind OutboundStats; written by the owning loop, read from anywhere
+ */
+class OutboundCounters {
+public:
+    OutboundStats snapshot() const;
+
+private:
+    friend class OutboundQueue;
+
+    std::atomic<size_t> queuedBytes_{0};
+    std::atomic<size_t> queuedMessages_{0};
+    std::atomic<size_t> socketBufferedBytes_{0};
+    std::atomic<uint64_t> sent_{0};
+    std::atomic<uint64_t> coalesced_{0};
+    std::atomic<uint64_t> droppedPartials_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+/**
+ * Per-session outbound message queue honouring socket backpressure
+ *
+ * Messages wait here while the socket already buffers more than
+ * socketHighWaterBytes and are written as the uWS drain callback reports
+ * progress. Only the newest partial transcript and partial translation per
+ * utterance are kept, a final discards the pending partial of its kind for
+ * its utterance, and high priority messages always go out before partials. When the caps are hit the
+ * oldest partials are evicted first; if high priority traffic alone exceeds
+ * them the new message is refused and the caller should drop the client.
+ *
+ * Not thread-safe: a queue belongs to the event loop that owns its socket.
+ */
+class OutboundQueue {
+public:
+    struct Message {
+        std::string payload;
+        bool binary = false;
+        OutboundPriority priority = OutboundPriority::HIGH;
+        int64_t utteranceId = -1;   // Transcription updates and translation results only
+        bool translation = false;   // Coalesces with translations, not transcripts
+    };
+
+    enum class PushResult {
+        QUEUED,
+        COALESCED,   // Replaced a pending partial for the same utterance
+        OVERFLOW     // Refused; the queue is full of high priority messages
+    };
+
+    explicit OutboundQueue(const OutboundQueueConfig& config = OutboundQueueConfig{});
+
+    /**
+     * Work out priority and utterance of a serialized message without parsing it
+     */
+    static Message classify(std::string payload, bool binary);
+
+    PushResult push(Message message);
+
+    /**
+     * Next message to write; nullptr when empty
+     */
+    const Message* front() const;
+    void pop();
+
+    bool empty() const { return high_.empty() && partials_.empty(); }
+    size_t size() const { return high_.size() + partials_.size(); }
+    size_t bytes() const { return bytes_; }
+
+    /**
+     * Whether a socket buffering this much may be written to
+     */
+    bool canWrite(size_t socketBufferedBytes) const {
+        return socketBufferedBytes < config_.socketHighWaterBytes;
+    }
+
+    void recordSent(size_t socketBufferedBytes);
+    void recordSocketBuffered(size_t socketBufferedBytes);
+
+    const OutboundQueueConfig& getConfig() const { return config_; }
+    std::shared_ptr<const OutboundCounters> counters() const { return counters_; }
+
+private:
+    bool overCapacity() const;
+    void eraseFront(std::deque<Message>& queue);
+    void publishSize();
+
+    OutboundQueueConfig config_;
+    std::deque<Message> high_;
+    std::deque<Message> partials_;   // At most one of each kind per utterance
+    size_t bytes_ = 0;
+    std::shared_ptr<OutboundCounters> counters_;
+};
+
+} // namespace core
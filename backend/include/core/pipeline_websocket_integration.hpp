@@ -50,6 +50,8 @@ private:
 
   void handleTranslationComplete(const PipelineResult &result);
 
+  void handlePartialTranslation(const PipelineResult &result);
+
   void handlePipelineError(const PipelineResult &result,
                            const std::string &error);
 
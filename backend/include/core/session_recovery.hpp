@@ -1,7 +1,9 @@
 #pragma once
 
 #include "core/client_session.hpp"
+#include "core/session_recovery_log.hpp"
 #include "utils/error_handler.hpp"
+#include "utils/timer_service.hpp"
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -48,7 +50,10 @@ struct SessionRecoveryConfig {
   int max_recovery_attempts = 3;
   size_t max_stored_sessions = 1000;
   bool enable_persistent_storage = false;
-  std::string storage_path = "./session_recovery.db";
+  std::string storage_path = "./session_recovery.db"; // Log and snapshot prefix
+  std::chrono::milliseconds wal_sync_interval =
+      std::chrono::milliseconds(100); // Group commit window; 0 syncs each change
+  size_t wal_compaction_bytes = 16 * 1024 * 1024; // Log size that triggers a snapshot
 };
 
 /**
@@ -144,26 +149,41 @@ public:
    */
   std::vector<SessionRecoveryData> exportSessionData() const;
 
+  /**
+   * Commit logged changes to disk now instead of at the next sync interval
+   */
+  bool flushStorage();
+
+  /**
+   * Snapshot the stored sessions and drop the log segments it covers
+   */
+  bool compactStorage();
+
+  /**
+   * Persistent storage statistics; all zero when storage is disabled
+   */
+  SessionRecoveryLog::Statistics getStorageStats() const;
+
 private:
   /**
-   * Cleanup worker thread function
+   * Periodic cleanup run on the shared timer service
    */
-  void cleanupWorker();
+  void runScheduledCleanup();
 
   /**
-   * Check if session has expired
+   * Periodic group commit and compaction check
    */
-  bool isSessionExpired(const SessionRecoveryData &data) const;
+  void runStorageMaintenance();
 
   /**
-   * Load session data from persistent storage
+   * Check if session has expired
    */
-  bool loadFromStorage();
+  bool isSessionExpired(const SessionRecoveryData &data) const;
 
   /**
-   * Save session data to persistent storage
+   * Recover session data from the snapshot and log replay
    */
-  bool saveToStorage();
+  bool loadFromStorage();
 
   /**
    * Generate unique session ID
@@ -175,9 +195,16 @@ private:
       stored_sessions_;
 
   mutable std::mutex sessions_mutex_;
-  std::thread cleanup_thread_;
+  speechrnt::utils::TimerService::TimerId cleanup_timer_ =
+      speechrnt::utils::TimerService::INVALID_TIMER;
   std::atomic<bool> running_{false};
 
+  // Persistent storage, present only when enabled
+  std::unique_ptr<SessionRecoveryLog> storage_log_;
+  speechrnt::utils::TimerService::TimerId storage_timer_ =
+      speechrnt::utils::TimerService::INVALID_TIMER;
+  std::mutex compaction_mutex_;
+
   SessionRecoveryCallback recovery_callback_;
   SessionCleanupCallback cleanup_callback_;
 
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace core {
+
+struct SessionRecoveryData;
+
+using SessionRecoveryMap =
+    std::unordered_map<std::string, std::shared_ptr<SessionRecoveryData>>;
+
+/**
+ * Durable storage for session recovery data
+ *
+ * Every change is appended to a binary write-ahead log segment
+ * (<base>.wal.<generation>) as a checksummed delta record: a full session
+ * on store, a timestamp on activity, an id on removal. Appends only fill an
+ * in-memory buffer; sync() writes the buffer and fdatasyncs it, so one disk
+ * flush commits every change made since the last call. Compaction encodes
+ * the live sessions into <base>.snapshot, which names the first segment
+ * still to be replayed, and deletes the segments it covers. Recovery loads
+ * the snapshot and replays the remaining segments, truncating a torn tail.
+ *
+ * Timestamps are stored as wall-clock time and mapped back onto
+ * steady_clock when read, so ages survive a restart.
+ */
+class SessionRecoveryLog {
+public:
+  struct Statistics {
+    uint64_t generation = 0;       // Segment receiving appends
+    size_t wal_bytes = 0;          // Live segments, including unsynced bytes
+    size_t pending_bytes = 0;      // Appended but not yet written
+    size_t snapshot_bytes = 0;
+    size_t records_appended = 0;
+    size_t syncs = 0;
+    size_t compactions = 0;
+    size_t records_replayed = 0;   // By the last open()
+    std::chrono::microseconds recovery_time{0};
+  };
+
+  /**
+   * @param base_path Path prefix of the snapshot and segment files
+   * @param sync_every_append fdatasync inside each append instead of
+   *        waiting for sync()
+   */
+  explicit SessionRecoveryLog(std::string base_path,
+                              bool sync_every_append = false);
+  ~SessionRecoveryLog();
+
+  SessionRecoveryLog(const SessionRecoveryLog &) = delete;
+  SessionRecoveryLog &operator=(const SessionRecoveryLog &) = delete;
+
+  /**
+   * Recover the stored sessions and open the newest segment for appends
+   * @param sessions Filled with the recovered sessions
+   * @return false if the files could not be opened; damaged records are
+   *         dropped rather than failing the open
+   */
+  bool open(SessionRecoveryMap &sessions);
+
+  /**
+   * Sync pending records and close the segment
+   */
+  void close();
+
+  bool isOpen() const;
+
+  /**
+   * Record deltas. Callers serialise these with the changes they
+   * describe so the log order matches the in-memory order.
+   */
+  void recordStore(const SessionRecoveryData &data);
+  void recordActivity(const std::string &session_id,
+                      std::chrono::steady_clock::time_point last_activity);
+  void recordRemove(const std::string &session_id);
+
+  /**
+   * Group commit: write everything appended so far and fdatasync it
+   */
+  bool sync();
+
+  /**
+   * Start a new segment for subsequent appends. The caller must hold the
+   * lock that orders appends, so the sessions it encodes next are exactly
+   * the state at the end of the previous segment.
+   * @return Generation of the new segment, 0 on failure
+   */
+  uint64_t rotate();
+
+  /**
+   * Encode sessions in snapshot form; cheap enough to run under the lock
+   * that orders appends
+   */
+  static void encodeSnapshot(const SessionRecoveryMap &sessions,
+                             uint64_t generation, std::string &out);
+
+  /**
+   * Install an encoded snapshot and delete the segments it covers
+   * @param encoded Output of encodeSnapshot()
+   * @param generation Value rotate() returned before encoding
+   */
+  bool installSnapshot(const std::string &encoded, uint64_t generation);
+
+  /**
+   * Whether the segments have outgrown both the threshold and the
+   * snapshot, so compacting would shrink the replay
+   */
+  bool needsCompaction(size_t threshold_bytes) const;
+
+  Statistics getStatistics() const;
+
+private:
+  std::string segmentPath(uint64_t generation) const;
+  std::string snapshotPath() const;
+  bool openSegment(uint64_t generation);
+  bool loadSnapshot(SessionRecoveryMap &sessions, uint64_t &generation);
+  bool replaySegment(uint64_t generation, SessionRecoveryMap &sessions,
+                     bool truncate_torn_tail);
+  void appendRecord(uint8_t type, const std::string &payload);
+  bool writePending(bool datasync);
+
+  std::string base_path_;
+  bool sync_every_append_;
+
+  // Appends only take buffer_mutex_; writes and fsyncs hold io_mutex_ so
+  // they never block an append for longer than a buffer swap
+  mutable std::mutex io_mutex_;
+  mutable std::mutex buffer_mutex_;
+  std::string pending_;
+  std::string writing_;
+  int fd_ = -1;
+  uint64_t generation_ = 0;
+  uint64_t first_live_generation_ = 0;
+
+  Statistics stats_;
+};
+
+} // namespace core
@@ -9,6 +9,7 @@
 #include <atomic>
 #include <memory>
 #include <future>
+#include "utils/trace_recorder.hpp"
 
 namespace speechrnt {
 namespace core {
@@ -25,21 +26,30 @@ enum class TaskPriority {
 
 /**
  * Base task interface
+ *
+ * A task captures the trace context of the thread that created it, so the
+ * utterance being traced follows the work onto the worker thread.
  */
 class Task {
 public:
     Task(TaskPriority priority = TaskPriority::NORMAL) 
-        : priority_(priority), created_at_(std::chrono::steady_clock::now()) {}
+        : priority_(priority), created_at_(std::chrono::steady_clock::now()) {
+        if (utils::TraceRecorder::isEnabled()) {
+            trace_context_ = utils::TraceRecorder::current();
+        }
+    }
     
     virtual ~Task() = default;
     virtual void execute() = 0;
     
     TaskPriority getPriority() const { return priority_; }
     std::chrono::steady_clock::time_point getCreatedAt() const { return created_at_; }
+    const utils::TraceContext& getTraceContext() const { return trace_context_; }
 
 private:
     TaskPriority priority_;
     std::chrono::steady_clock::time_point created_at_;
+    utils::TraceContext trace_context_;
 };
 
 /**
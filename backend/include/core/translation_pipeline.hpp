@@ -6,6 +6,7 @@
 #include "tts/tts_interface.hpp"
 #include "core/task_queue.hpp"
 #include "utils/performance_monitor.hpp"
+#include "utils/trace_recorder.hpp"
 #include <memory>
 #include <functional>
 #include <vector>
@@ -13,6 +14,8 @@
 #include <mutex>
 #include <unordered_map>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 
 namespace speechrnt {
 namespace core {
@@ -31,6 +34,15 @@ struct TranslationPipelineConfig {
     bool enable_multiple_candidates = true;
     bool enable_preliminary_translation = false;
     
+    // Speculative translation of partial results (enable_preliminary_translation)
+    size_t speculative_stability_window = 2;      // Consecutive partials that must agree on a prefix
+    size_t speculative_min_new_words = 2;         // Newly stable words needed before translating again
+    bool speculative_extend_at_boundaries = true; // Reuse a clause-final prefix and translate only the rest
+    
+    // Stream the stable prefix through the MT engine's incremental (wait-k)
+    // session and report each extension via the partial translation callback
+    bool enable_incremental_translation = false;
+    
     // Performance settings
     size_t max_concurrent_translations = 5;
     std::chrono::milliseconds translation_timeout = std::chrono::milliseconds(5000);
@@ -99,6 +111,7 @@ using TranscriptionCompleteCallback = std::function<void(const PipelineResult&)>
 using LanguageDetectionCompleteCallback = std::function<void(const PipelineResult&)>;
 using LanguageChangeCallback = std::function<void(const std::string& sessionId, const std::string& oldLang, const std::string& newLang, float confidence)>;
 using TranslationCompleteCallback = std::function<void(const PipelineResult&)>;
+using PartialTranslationCallback = std::function<void(const PipelineResult&)>;
 using PipelineErrorCallback = std::function<void(const PipelineResult&, const std::string&)>;
 using ConfidenceGateCallback = std::function<bool(const stt::TranscriptionResult&)>; // Return true to proceed
 
@@ -145,6 +158,21 @@ public:
         const std::vector<stt::TranscriptionResult>& candidates = {}
     );
     
+    /**
+     * Feed a partial transcription for speculative translation
+     * With preliminary translation enabled, the prefix that consecutive
+     * partials agree on is translated in the background; the final result
+     * then reuses or extends that translation instead of starting over.
+     * With incremental translation enabled, that prefix is also streamed to
+     * the MT engine word by word and every extension of the committed
+     * translation is reported through the partial translation callback.
+     */
+    void processPartialTranscription(
+        uint32_t utterance_id,
+        const std::string& session_id,
+        const stt::TranscriptionResult& partial
+    );
+    
     /**
      * Manually trigger translation for a specific transcription
      * Bypasses confidence gating if force_translation is true
@@ -186,6 +214,7 @@ public:
     void setLanguageDetectionCompleteCallback(LanguageDetectionCompleteCallback callback);
     void setLanguageChangeCallback(LanguageChangeCallback callback);
     void setTranslationCompleteCallback(TranslationCompleteCallback callback);
+    void setPartialTranslationCallback(PartialTranslationCallback callback);
     void setPipelineErrorCallback(PipelineErrorCallback callback);
     void setConfidenceGateCallback(ConfidenceGateCallback callback);
     
@@ -205,6 +234,17 @@ public:
         std::chrono::milliseconds average_translation_latency;
         std::chrono::milliseconds average_language_detection_latency;
         size_t active_pipeline_operations;
+        
+        // Speculative translation of partials
+        size_t speculative_translations;     // MT calls made on stable prefixes
+        size_t speculative_reused;           // Finals answered by a speculation as is
+        size_t speculative_extended;         // Finals that only translated the remainder
+        size_t speculative_discarded;        // Speculations the final or a revision invalidated
+        std::chrono::milliseconds speculative_mt_time; // MT time spent on speculation
+        
+        // Incremental translation of partials
+        size_t incremental_updates;          // Partial translations reported
+        size_t incremental_restarts;         // Streams restarted after a revision
     };
     Statistics getStatistics() const;
     
@@ -215,6 +255,7 @@ public:
     
     /**
      * Cancel pipeline operation for specific utterance
+     * Also drops any speculative translation of its partials.
      */
     bool cancelPipelineOperation(uint32_t utterance_id);
     
@@ -283,6 +324,7 @@ private:
         PipelineResult result;
         std::chrono::steady_clock::time_point start_time;
         bool is_active;
+        utils::TraceContext trace;
         
         PipelineOperation(uint32_t id, const std::string& session)
             : utterance_id(id)
@@ -291,6 +333,14 @@ private:
             , is_active(true) {
             result.utterance_id = id;
             result.session_id = session;
+            if (utils::TraceRecorder::isEnabled()) {
+                // Continue the caller's utterance trace, or sample one when
+                // the pipeline is driven directly
+                trace = utils::TraceRecorder::current();
+                if (!trace.sampled()) {
+                    trace = utils::TraceRecorder::getInstance().beginUtterance(session, id);
+                }
+            }
         }
     };
     
@@ -348,6 +398,7 @@ private:
     void notifyLanguageDetectionComplete(const PipelineResult& result);
     void notifyLanguageChange(const std::string& session_id, const std::string& old_lang, const std::string& new_lang, float confidence);
     void notifyTranslationComplete(const PipelineResult& result);
+    void notifyPartialTranslation(const PipelineResult& result);
     void notifyPipelineError(const PipelineResult& result, const std::string& error);
     
     // Operation management
@@ -364,6 +415,41 @@ private:
     void recordTranslationLatency(std::chrono::milliseconds latency);
     void recordLanguageDetectionLatency(std::chrono::milliseconds latency);
     
+    // Speculative translation
+    struct SpeculationState {
+        std::deque<std::vector<std::string>> recent_partials; // Words of the last partials
+        uint64_t generation = 0;       // Bumped per speculation; stale jobs skip their MT call
+        bool in_flight = false;        // Queued or running
+        bool running = false;          // Picked up by a worker
+        std::vector<std::string> pending_source;
+        std::vector<std::string> source;   // Source of the completed speculation
+        mt::TranslationResult translation;
+        std::chrono::steady_clock::time_point last_update;
+        
+        // Incremental translation stream; one worker feeds it at a time
+        std::string stream_key;                   // MT streaming session id
+        std::vector<std::string> stream_target;   // Stable words to feed
+        size_t stream_fed = 0;                    // Words of stream_target fed so far
+        bool stream_open = false;
+        bool stream_busy = false;
+        bool stream_reset = false;                // Fed words were revised; start over
+        bool stream_failed = false;
+        std::string stream_emitted;               // Last translation reported
+    };
+    
+    void runSpeculativeTranslation(uint32_t utterance_id, uint64_t generation, std::vector<std::string> source);
+    void updateIncrementalTranslation(uint32_t utterance_id, const std::string& session_id, SpeculationState& state,
+                                      const std::vector<std::string>& stable_prefix);
+    void runIncrementalTranslation(uint32_t utterance_id, std::string session_id, std::string stream_key);
+    void releaseIncrementalStream(const SpeculationState& state);
+    bool translateWithSpeculation(uint32_t utterance_id, const std::string& text, mt::TranslationResult& result);
+    bool cancelSpeculation(uint32_t utterance_id);
+    bool usableFor(const std::vector<std::string>& source, const std::vector<std::string>& words) const;
+    static bool isPrefix(const std::vector<std::string>& prefix, const std::vector<std::string>& words);
+    static bool isClauseEnd(const std::string& word);
+    static std::vector<std::string> splitWords(const std::string& text);
+    static std::string joinWords(const std::vector<std::string>& words);
+    
     // Language detection caching
     struct LanguageDetectionCacheEntry {
         mt::LanguageDetectionResult result;
@@ -406,6 +492,7 @@ private:
     LanguageDetectionCompleteCallback language_detection_complete_callback_;
     LanguageChangeCallback language_change_callback_;
     TranslationCompleteCallback translation_complete_callback_;
+    PartialTranslationCallback partial_translation_callback_;
     PipelineErrorCallback pipeline_error_callback_;
     ConfidenceGateCallback confidence_gate_callback_;
     
@@ -424,6 +511,13 @@ private:
     mutable std::mutex session_language_mutex_;
     std::unordered_map<std::string, std::string> session_languages_;
     
+    // Speculative translations by utterance
+    std::mutex speculation_mutex_;
+    std::condition_variable speculation_cv_;
+    std::unordered_map<uint32_t, SpeculationState> speculations_;
+    uint64_t next_stream_id_ = 0;
+    static constexpr std::chrono::seconds SPECULATION_IDLE_TIMEOUT{30};
+    
     // Performance monitoring
     std::shared_ptr<utils::PerformanceMonitor> performance_monitor_;
 };
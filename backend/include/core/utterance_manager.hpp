@@ -9,9 +9,11 @@
 #include <atomic>
 #include <functional>
 #include "core/task_queue.hpp"
+#include "core/utterance_store.hpp"
 #include "stt/stt_interface.hpp"
 #include "mt/translation_interface.hpp"
 #include "tts/tts_interface.hpp"
+#include "utils/timer_service.hpp"
 
 // Forward declaration
 namespace speechrnt {
@@ -23,54 +25,6 @@ class TranslationPipeline;
 namespace speechrnt {
 namespace core {
 
-/**
- * States an utterance can be in during processing
- */
-enum class UtteranceState {
-    LISTENING,      // Audio is being captured
-    TRANSCRIBING,   // Speech-to-text processing
-    TRANSLATING,    // Machine translation processing
-    SYNTHESIZING,   // Text-to-speech processing
-    COMPLETE,       // All processing complete
-    ERROR           // Error occurred during processing
-};
-
-/**
- * Data structure representing an utterance
- */
-struct UtteranceData {
-    uint32_t id;
-    std::string session_id;
-    UtteranceState state;
-    std::chrono::steady_clock::time_point created_at;
-    std::chrono::steady_clock::time_point last_updated;
-    
-    // Audio data
-    std::vector<float> audio_buffer;
-    
-    // Processing results
-    std::string transcript;
-    float transcription_confidence;
-    std::string translation;
-    std::vector<uint8_t> synthesized_audio;
-    
-    // Error information
-    std::string error_message;
-    
-    // Processing metadata
-    std::string source_language;
-    std::string target_language;
-    std::string voice_id;
-    
-    UtteranceData(uint32_t utterance_id, const std::string& sess_id)
-        : id(utterance_id)
-        , session_id(sess_id)
-        , state(UtteranceState::LISTENING)
-        , created_at(std::chrono::steady_clock::now())
-        , last_updated(std::chrono::steady_clock::now())
-        , transcription_confidence(0.0f) {}
-};
-
 /**
  * Callback function types for utterance state changes
  */
@@ -78,6 +32,12 @@ using UtteranceStateCallback = std::function<void(const UtteranceData&)>;
 using UtteranceCompleteCallback = std::function<void(const UtteranceData&)>;
 using UtteranceErrorCallback = std::function<void(const UtteranceData&, const std::string&)>;
 
+/**
+ * Hands a translated utterance to its owner for streamed synthesis;
+ * returns true if the owner took over synthesis and delivery
+ */
+using UtteranceSynthesisCallback = std::function<bool(const UtteranceData&)>;
+
 /**
  * Configuration for utterance management
  */
@@ -206,6 +166,16 @@ public:
      */
     std::vector<std::shared_ptr<UtteranceData>> getActiveUtterances() const;
     
+    /**
+     * Get ids of a session's utterances without copying their payloads
+     */
+    std::vector<uint32_t> getSessionUtteranceIds(const std::string& session_id) const;
+    
+    /**
+     * Get ids of all active utterances without copying their payloads
+     */
+    std::vector<uint32_t> getActiveUtteranceIds() const;
+    
     /**
      * Remove completed or errored utterances older than the specified age
      */
@@ -235,6 +205,13 @@ public:
     void setStateChangeCallback(UtteranceStateCallback callback);
     void setCompleteCallback(UtteranceCompleteCallback callback);
     void setErrorCallback(UtteranceErrorCallback callback);
+    UtteranceCompleteCallback getCompleteCallback() const;
+    
+    /**
+     * Let the owning session stream speech for finished translations.
+     * Utterances it declines are synthesized here in one blocking call.
+     */
+    void setSynthesisCallback(UtteranceSynthesisCallback callback);
     
     /**
      * Process an utterance through the complete pipeline
@@ -253,6 +230,7 @@ public:
     
     /**
      * Check if the manager can accept new utterances
+     * False at the utterance limit or while the admission controller is shedding load
      */
     bool canAcceptNewUtterance() const;
     
@@ -281,22 +259,20 @@ private:
     std::shared_ptr<mt::TranslationInterface> mt_engine_;
     std::shared_ptr<tts::TTSInterface> tts_engine_;
     
-    mutable std::mutex utterances_mutex_;
-    std::unordered_map<uint32_t, std::shared_ptr<UtteranceData>> utterances_;
-    std::atomic<uint32_t> next_utterance_id_;
+    UtteranceStore utterances_;
     
     // Callbacks
-    std::mutex callbacks_mutex_;
+    mutable std::mutex callbacks_mutex_;
     UtteranceStateCallback state_change_callback_;
     UtteranceCompleteCallback complete_callback_;
     UtteranceErrorCallback error_callback_;
+    UtteranceSynthesisCallback synthesis_callback_;
     
     // Cleanup timer
     std::atomic<bool> running_;
-    std::thread cleanup_thread_;
+    speechrnt::utils::TimerService::TimerId cleanup_timer_;
     
     // Statistics
-    mutable std::mutex stats_mutex_;
     std::atomic<size_t> total_created_;
     std::atomic<size_t> total_completed_;
     std::atomic<size_t> total_errors_;
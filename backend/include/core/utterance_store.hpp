@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "utils/trace_recorder.hpp"
+
+namespace speechrnt {
+namespace core {
+
+/**
+ * States an utterance can be in during processing
+ */
+enum class UtteranceState {
+    LISTENING,      // Audio is being captured
+    TRANSCRIBING,   // Speech-to-text processing
+    TRANSLATING,    // Machine translation processing
+    SYNTHESIZING,   // Text-to-speech processing
+    COMPLETE,       // All processing complete
+    ERROR           // Error occurred during processing
+};
+
+/**
+ * Data structure representing an utterance
+ */
+struct UtteranceData {
+    uint32_t id;
+    std::string session_id;
+    UtteranceState state;
+    std::chrono::steady_clock::time_point created_at;
+    std::chrono::steady_clock::time_point last_updated;
+
+    // Audio data
+    std::vector<float> audio_buffer;
+
+    // Processing results
+    std::string transcript;
+    float transcription_confidence;
+    std::string translation;
+    std::vector<uint8_t> synthesized_audio;
+
+    // Error information
+    std::string error_message;
+
+    // Processing metadata
+    std::string source_language;
+    std::string target_language;
+    std::string voice_id;
+
+    // Set when the utterance was sampled for tracing
+    utils::TraceContext trace;
+
+    UtteranceData(uint32_t utterance_id, const std::string& sess_id)
+        : id(utterance_id)
+        , session_id(sess_id)
+        , state(UtteranceState::LISTENING)
+        , created_at(std::chrono::steady_clock::now())
+        , last_updated(std::chrono::steady_clock::now())
+        , transcription_confidence(0.0f) {}
+};
+
+/**
+ * Cold per-utterance payload, kept apart from the hot metadata arrays
+ */
+struct UtterancePayload {
+    std::string session_id;
+    std::vector<float> audio_buffer;
+    std::string transcript;
+    float transcription_confidence = 0.0f;
+    std::string translation;
+    std::vector<uint8_t> synthesized_audio;
+    std::string error_message;
+    std::string source_language;
+    std::string target_language;
+    std::string voice_id;
+    utils::TraceContext trace;
+};
+
+/**
+ * Slab-allocated utterance store with generational ids.
+ *
+ * Utterances live in lock-striped slabs chosen by session, so all of a
+ * session's utterances share one stripe. Each stripe keeps hot metadata
+ * (ids, state, timestamps, list links) in struct-of-arrays form and the
+ * payload in a parallel cold array. Every slot is linked into exactly one
+ * of the free, active or finished lists, plus its session's list, so state
+ * queries are O(active) and cleanup is O(expired). The finished list is
+ * ordered by last update, so expiry stops at the first young entry.
+ *
+ * Ids pack an 8-bit generation, the stripe and the slot index; a stale id
+ * is rejected once its slot has been reused.
+ */
+class UtteranceStore {
+public:
+    static constexpr size_t STRIPE_COUNT = 16;
+    static constexpr uint32_t SLOT_BITS = 20;
+    static constexpr uint32_t STRIPE_BITS = 4;
+    static constexpr uint32_t MAX_SLOTS_PER_STRIPE = 1u << SLOT_BITS;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Counts {
+        size_t stored = 0;
+        size_t active = 0;
+        size_t processing = 0;
+        size_t finished = 0;
+    };
+
+    explicit UtteranceStore(size_t initial_slots_per_stripe = 64);
+
+    UtteranceStore(const UtteranceStore&) = delete;
+    UtteranceStore& operator=(const UtteranceStore&) = delete;
+
+    /**
+     * Create a new utterance in LISTENING state
+     * Returns the utterance id, or 0 if the stripe is exhausted
+     */
+    uint32_t create(const std::string& session_id);
+
+    bool contains(uint32_t id) const;
+
+    /**
+     * Read the state without touching the cold payload
+     */
+    bool getState(uint32_t id, UtteranceState& state) const;
+
+    /**
+     * Apply a mutation under the stripe lock. The functor receives the
+     * state and payload; state changes are relinked and last_updated is
+     * refreshed. If snapshot is non-null it receives a copy taken under
+     * the same lock.
+     */
+    template <typename Fn>
+    bool update(uint32_t id, Fn&& fn, UtteranceData* snapshot = nullptr) {
+        Stripe& stripe = stripes_[stripeOf(id)];
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+
+        int32_t slot = resolve(stripe, id);
+        if (slot < 0) {
+            return false;
+        }
+
+        UtteranceState old_state = stripe.states[slot];
+        UtteranceState new_state = old_state;
+        fn(new_state, stripe.payloads[slot]);
+        stripe.states[slot] = new_state;
+        touch(stripe, slot, old_state, new_state);
+
+        if (snapshot) {
+            fillSnapshot(stripe, slot, *snapshot);
+        }
+        return true;
+    }
+
+    /**
+     * Copy an utterance into a snapshot
+     */
+    bool snapshot(uint32_t id, UtteranceData& out) const;
+
+    /**
+     * Snapshots of a session's utterances, in creation order
+     */
+    std::vector<UtteranceData> sessionSnapshots(const std::string& session_id) const;
+
+    /**
+     * Snapshots of all non-terminal utterances
+     */
+    std::vector<UtteranceData> activeSnapshots() const;
+
+    /**
+     * Ids only, for callers that do not need the payload
+     */
+    std::vector<uint32_t> sessionIds(const std::string& session_id) const;
+    std::vector<uint32_t> activeIds() const;
+
+    /**
+     * Remove COMPLETE/ERROR utterances not updated within max_age
+     */
+    size_t removeFinishedOlderThan(Clock::duration max_age);
+
+    size_t removeSession(const std::string& session_id);
+
+    void clear();
+
+    size_t activeCount() const { return active_count_.load(std::memory_order_relaxed); }
+    Counts getCounts() const;
+
+    /**
+     * Average created->last_updated time of stored COMPLETE utterances
+     */
+    std::chrono::milliseconds averageCompletedProcessingTime() const;
+
+private:
+    static constexpr int32_t NIL = -1;
+
+    struct ListHead {
+        int32_t head = NIL;
+        int32_t tail = NIL;
+    };
+
+    struct alignas(64) Stripe {
+        mutable std::mutex mutex;
+
+        // Hot metadata (struct-of-arrays)
+        std::vector<uint32_t> ids;             // 0 when the slot is free
+        std::vector<uint8_t> generations;
+        std::vector<UtteranceState> states;
+        std::vector<Clock::time_point> created_at;
+        std::vector<Clock::time_point> last_updated;
+        std::vector<int32_t> list_next;
+        std::vector<int32_t> list_prev;
+        std::vector<int32_t> session_next;
+        std::vector<int32_t> session_prev;
+
+        // Cold payloads
+        std::vector<UtterancePayload> payloads;
+
+        ListHead free_list;
+        ListHead active_list;
+        ListHead finished_list;
+        size_t finished_count = 0;
+        std::unordered_map<std::string, ListHead> sessions;
+    };
+
+    static bool isTerminal(UtteranceState state) {
+        return state == UtteranceState::COMPLETE || state == UtteranceState::ERROR;
+    }
+    static bool isProcessing(UtteranceState state) {
+        return state == UtteranceState::TRANSCRIBING || state == UtteranceState::TRANSLATING ||
+               state == UtteranceState::SYNTHESIZING;
+    }
+
+    static size_t stripeOf(uint32_t id) {
+        return (id >> SLOT_BITS) & ((1u << STRIPE_BITS) - 1);
+    }
+    static size_t stripeForSession(const std::string& session_id);
+
+    static int32_t resolve(const Stripe& stripe, uint32_t id);
+    ListHead& listFor(Stripe& stripe, UtteranceState state);
+
+    void grow(Stripe& stripe);
+    void pushBack(Stripe& stripe, ListHead& list, int32_t slot);
+    void unlink(Stripe& stripe, ListHead& list, int32_t slot);
+    void pushSession(Stripe& stripe, ListHead& list, int32_t slot);
+    void unlinkSession(Stripe& stripe, ListHead& list, int32_t slot);
+    void touch(Stripe& stripe, int32_t slot, UtteranceState old_state, UtteranceState new_state);
+    void release(Stripe& stripe, int32_t slot, bool unlink_session);
+    void fillSnapshot(const Stripe& stripe, int32_t slot, UtteranceData& out) const;
+
+    std::array<Stripe, STRIPE_COUNT> stripes_;
+    std::atomic<size_t> active_count_;
+    std::atomic<size_t> processing_count_;
+    size_t initial_slots_;
+};
+
+} // namespace core
+} // namespace speechrnt
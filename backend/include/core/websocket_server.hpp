@@ -1,9 +1,19 @@
 #pragma once
 
+#include "core/outbound_queue.hpp"
+#include "utils/mpsc_queue.hpp"
+#include "utils/timer_service.hpp"
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 // Forward declarations for uWS types
 namespace uWS {
@@ -11,52 +21,183 @@ template <bool SSL> struct TemplatedApp;
 template <bool SSL> struct WebSocket;
 template <bool SSL> struct HttpResponse;
 struct HttpRequest;
+struct Loop;
 using App = TemplatedApp<false>;
 } // namespace uWS
 
-namespace core {
-
-class ClientSession;
-
 // Forward declaration for STT health checker
 namespace stt {
 class STTHealthChecker;
 }
 
+namespace speechrnt {
+namespace core {
+class UtteranceManager;
+struct UtteranceData;
+} // namespace core
+namespace tts {
+class TTSInterface;
+}
+} // namespace speechrnt
+
+namespace core {
+
+class ClientSession;
+
 // Per-socket data structure
 struct PerSocketData {
   std::string sessionId;
   uWS::WebSocket<false> *ws;
 };
 
+/**
+ * WebSocket server running one uWS event loop per core
+ *
+ * Every loop owns its own App listening on the same port; the kernel spreads
+ * incoming connections across them (SO_REUSEPORT). A session lives on the
+ * loop that accepted it, and only that loop's thread touches its socket.
+ * Sends from any other thread go through the loop's lock-free mailbox and
+ * are flushed on the loop via Loop::defer.
+ *
+ * Each session writes through an OutboundQueue: once the socket buffers more
+ * than the high-water mark, messages wait (partials coalesced, finals first)
+ * and are written as uWS reports the socket draining.
+ */
 class WebSocketServer {
 public:
-  explicit WebSocketServer(int port);
-  ~WebSocketServer();
+  /**
+   * @param port Port every loop listens on
+   * @param loopCount Event loops to run; 0 = one per hardware thread
+   */
+  explicit WebSocketServer(int port, size_t loopCount = 0);
+  virtual ~WebSocketServer();
 
   void start();
+  // Runs loop 0 on the calling thread and the rest on their own threads;
+  // returns once every loop has stopped
   void run();
   void stop();
 
   // Health monitoring integration
-  void setHealthChecker(std::shared_ptr<stt::STTHealthChecker> healthChecker);
+  void setHealthChecker(std::shared_ptr<::stt::STTHealthChecker> healthChecker);
+
+  // Applies to sessions connected afterwards
+  void setOutboundQueueConfig(const OutboundQueueConfig &config);
+
+  // Engine sessions stream synthesized replies with; set before start()
+  void setTTSEngine(std::shared_ptr<speechrnt::tts::TTSInterface> engine);
+
+  // Hand the manager's finished translations to their sessions, which
+  // stream the speech back to the client; audio the manager synthesized
+  // whole is sent on completion. Takes over the manager's synthesis
+  // callback; a complete callback installed beforehand keeps being called
+  // and is restored when the server goes away
+  void attachUtteranceManager(
+      const std::shared_ptr<speechrnt::core::UtteranceManager> &manager);
+
+  size_t getLoopCount() const { return loopCount_; }
+  size_t getSessionCount() const;
+
+  // Buffered bytes and drop counts per connected session
+  std::unordered_map<std::string, OutboundStats> getOutboundStats() const;
+
+protected:
+  // Virtual so tests can stand in for connected sockets
+  virtual std::shared_ptr<ClientSession>
+  findSession(const std::string &sessionId) const;
 
 private:
+  struct OutboundMessage {
+    std::string sessionId;
+    std::string payload;
+    bool binary = false;
+  };
+
+  struct Connection {
+    uWS::WebSocket<false> *ws = nullptr;
+    OutboundQueue outbound;
+  };
+
+  struct Route {
+    size_t loop = 0;
+    std::shared_ptr<const OutboundCounters> outbound;
+    std::weak_ptr<ClientSession> session;
+  };
+
+  // State owned by one event loop thread; only mailbox, drainScheduled,
+  // loop and threadId are touched from other threads
+  struct EventLoop {
+    size_t index = 0;
+    std::atomic<uWS::Loop *> loop{nullptr};
+    std::atomic<std::thread::id> threadId{};
+    std::unique_ptr<uWS::App> app;
+    bool listening = false;
+
+    std::unordered_map<std::string, std::shared_ptr<ClientSession>> sessions;
+    std::unordered_map<std::string, Connection> connections;
+
+    speechrnt::utils::MpscQueue<OutboundMessage> mailbox;
+    std::atomic<bool> drainScheduled{false};
+  };
+
+  // Messages flushed per deferred drain before yielding back to the loop
+  static constexpr size_t MAILBOX_BATCH = 256;
+
   int port_;
-  bool running_;
-  std::unique_ptr<uWS::App> app_;
-  std::unordered_map<std::string, std::shared_ptr<ClientSession>> sessions_;
-  std::unordered_map<std::string, uWS::WebSocket<false> *> websockets_;
+  size_t loopCount_;
+  std::atomic<bool> running_;
+  std::vector<std::unique_ptr<EventLoop>> loops_;
+
+  // Session id -> owning loop; written on connect and disconnect only
+  mutable std::shared_mutex routesMutex_;
+  std::unordered_map<std::string, Route> sessionLoops_;
+
+  mutable std::mutex outboundConfigMutex_;
+  OutboundQueueConfig outboundConfig_;
 
   // Health monitoring
-  std::shared_ptr<stt::STTHealthChecker> health_checker_;
+  std::shared_ptr<::stt::STTHealthChecker> health_checker_;
+
+  // Speech synthesis
+  std::shared_ptr<speechrnt::tts::TTSInterface> ttsEngine_;
+  std::weak_ptr<speechrnt::core::UtteranceManager> utteranceManager_;
+  std::function<void(const speechrnt::core::UtteranceData &)> previousCompleteCallback_;
+
+  // Pre-serialised /health summary, rebuilt off the event loops and
+  // swapped in with std::atomic_store so handlers only copy a pointer
+  struct CachedResponse {
+    std::string status;
+    std::string body;
+    std::string etag;
+  };
+  std::shared_ptr<const CachedResponse> healthResponse_;
+  speechrnt::utils::TimerService::TimerId healthResponseTimer_ =
+      speechrnt::utils::TimerService::INVALID_TIMER;
+
+  static constexpr std::chrono::milliseconds HEALTH_RESPONSE_INTERVAL{1000};
 
   std::string generateSessionId();
-  void handleNewConnection(const std::string &sessionId,
+  void runLoop(EventLoop &loop);
+  void configureApp(EventLoop &loop);
+  void closeLoop(EventLoop &loop);
+  void enqueue(EventLoop &loop, OutboundMessage message);
+  void drainMailbox(EventLoop &loop);
+  void deliver(EventLoop &loop, const std::string &sessionId,
+               std::string_view payload, bool binary);
+  void flushOutbound(Connection &connection);
+  EventLoop *findLoop(const std::string &sessionId) const;
+  bool streamSynthesizedSpeech(const speechrnt::core::UtteranceData &utterance);
+  void deliverSynthesizedAudio(const speechrnt::core::UtteranceData &utterance);
+
+  void handleNewConnection(EventLoop &loop, const std::string &sessionId,
                            uWS::WebSocket<false> *ws);
-  void handleMessage(const std::string &sessionId, const std::string &message);
-  void handleBinaryMessage(const std::string &sessionId, std::string_view data);
-  void handleDisconnection(const std::string &sessionId);
+  void handleMessage(EventLoop &loop, const std::string &sessionId,
+                     const std::string &message);
+  void handleBinaryMessage(EventLoop &loop, const std::string &sessionId,
+                           std::string_view data);
+  void handleDisconnection(EventLoop &loop, const std::string &sessionId);
+
+  void refreshHealthResponse();
 
   // Health endpoint handlers
   void handleHealthCheck(uWS::HttpResponse<false> *res, uWS::HttpRequest *req);
@@ -67,12 +208,23 @@ private:
   void handleHealthHistory(uWS::HttpResponse<false> *res,
                            uWS::HttpRequest *req);
   void handleHealthAlerts(uWS::HttpResponse<false> *res, uWS::HttpRequest *req);
+  void handleAdmissionStatus(uWS::HttpResponse<false> *res,
+                             uWS::HttpRequest *req);
+  void handleOutboundStatus(uWS::HttpResponse<false> *res,
+                            uWS::HttpRequest *req);
+
+  // OpenMetrics exposition of the process-wide metrics registry
+  void handleMetrics(uWS::HttpResponse<false> *res, uWS::HttpRequest *req);
+
+  // Chrome trace export and sampling control of the trace recorder
+  void handleTrace(uWS::HttpResponse<false> *res, uWS::HttpRequest *req);
 
 public:
-  // Message sending methods
-  void sendMessage(const std::string &sessionId, const std::string &message);
-  void sendBinaryMessage(const std::string &sessionId,
-                         const std::vector<uint8_t> &data);
+  // Message sending methods; safe from any thread
+  virtual void sendMessage(const std::string &sessionId,
+                           const std::string &message);
+  virtual void sendBinaryMessage(const std::string &sessionId,
+                                 const std::vector<uint8_t> &data);
 };
 
-} // namespace core
\ No newline at end of file
+} // namespace core
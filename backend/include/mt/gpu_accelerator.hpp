@@ -2,6 +2,7 @@
 
 #include "utils/gpu_manager.hpp"
 #include "utils/gpu_memory_pool.hpp"
+#include "utils/timer_service.hpp"
 #include <string>
 #include <vector>
 #include <memory>
@@ -498,7 +499,7 @@ private:
     
     // Performance monitoring
     std::atomic<bool> performanceMonitoringActive_;
-    std::thread performanceMonitoringThread_;
+    utils::TimerService::TimerId performanceMonitoringTimer_ = utils::TimerService::INVALID_TIMER;
     std::vector<GPUStats> performanceHistory_;
     mutable std::mutex performanceHistoryMutex_;
     GPUStats currentStats_;
@@ -545,7 +546,7 @@ private:
     bool loadModelToDevice(const std::string& modelPath, int deviceId, void** gpuModelPtr);
     void unloadModelFromDevice(void* gpuModelPtr, int deviceId);
     bool performGPUTranslation(void* gpuModel, const std::string& input, std::string& output, void* stream = nullptr);
-    void performanceMonitoringLoop();
+    void samplePerformance();
     void collectGPUMetrics();
     void checkPerformanceThresholds();
     void cleanupExpiredSessions();
@@ -21,6 +21,7 @@ namespace mt {
 class QualityManager;
 class MarianErrorHandler;
 class MTConfig;
+class TranslationMemory;
 }
 }
 
@@ -173,6 +174,15 @@ public:
     std::future<std::vector<TranslationResult>> translateBatchAsync(const std::vector<std::string>& texts) override;
     
     // Streaming translation methods
+    //
+    // With incremental decoding (StreamingConfig::incrementalDecoding) text
+    // is consumed word by word. The open window is re-decoded only after
+    // redecodeStrideWords new words or at a clause end, with the target words
+    // already emitted forced as a prefix, and target words are committed up
+    // to waitK words behind the source. Partial results carry only committed
+    // text, which later results extend but never revise. A window closes at
+    // sentence ends or after maxWindowWords words, bounding decode cost per
+    // new source word.
     bool startStreamingTranslation(const std::string& sessionId, const std::string& sourceLang, const std::string& targetLang) override;
     TranslationResult addStreamingText(const std::string& sessionId, const std::string& text, bool isComplete = false) override;
     TranslationResult finalizeStreamingTranslation(const std::string& sessionId) override;
@@ -203,6 +213,44 @@ public:
      */
     float getCacheHitRate() const;
     
+    /**
+     * Enable the persistent on-disk translation memory, consulted before inference
+     * @param directory Directory holding the translation memory files
+     * @return true if the translation memory was opened
+     */
+    bool enablePersistentTranslationMemory(const std::string& directory);
+    
+    /**
+     * Close the persistent translation memory
+     */
+    void disablePersistentTranslationMemory();
+    
+    /**
+     * Check if the persistent translation memory is active
+     * @return true if enabled and open
+     */
+    bool isPersistentTranslationMemoryEnabled() const;
+    
+    /**
+     * Compact the persistent translation memory log
+     * @return true if compaction succeeded
+     */
+    bool compactTranslationMemory();
+    
+    /**
+     * Export the persistent translation memory as a warm cache file
+     * @param path Destination file
+     * @return Number of exported entries, or -1 on failure
+     */
+    long exportTranslationMemory(const std::string& path);
+    
+    /**
+     * Import a warm cache file produced by exportTranslationMemory()
+     * @param path Source file
+     * @return Number of imported entries, or -1 on failure
+     */
+    long importTranslationMemory(const std::string& path);
+    
     // Multi-language pair support methods
     
     /**
@@ -369,9 +417,19 @@ private:
         std::chrono::steady_clock::time_point lastActivity;
         bool isActive;
         
-        StreamingSession() : isActive(false) {}
+        // Incremental (wait-k) decoding: only the open window is re-decoded,
+        // with the target words already emitted for it forced as a prefix
+        std::string pendingSource;                 // Trailing word not yet terminated
+        std::vector<std::string> windowSource;     // Source words of the open window
+        std::vector<std::string> committedTarget;  // Target words emitted for the open window
+        std::string closedTarget;                  // Translation of closed windows
+        size_t decodedSourceWords;                 // windowSource size at the last decode
+        size_t decodes;
+        float confidence;                          // Lowest decode confidence so far
+        
+        StreamingSession() : isActive(false), decodedSourceWords(0), decodes(0), confidence(1.0f) {}
         StreamingSession(const std::string& id, const std::string& src, const std::string& tgt)
-            : sessionId(id), sourceLang(src), targetLang(tgt), isActive(true) {
+            : sessionId(id), sourceLang(src), targetLang(tgt), isActive(true), decodedSourceWords(0), decodes(0), confidence(1.0f) {
             lastActivity = std::chrono::steady_clock::now();
         }
     };
@@ -406,7 +464,7 @@ private:
     std::string getModelPath(const std::string& sourceLang, const std::string& targetLang) const;
     bool validateModelFiles(const std::string& sourceLang, const std::string& targetLang) const;
     TranslationResult performTranslation(const std::string& text, const std::string& sourceLang, const std::string& targetLang);
-    TranslationResult performMarianTranslation(const std::string& text, const std::string& sourceLang, const std::string& targetLang);
+    TranslationResult performMarianTranslation(const std::string& text, const std::string& sourceLang, const std::string& targetLang, const std::string& targetPrefix = "");
     TranslationResult performMarianTranslationWithTimeout(const std::string& text, const std::string& sourceLang, const std::string& targetLang, std::chrono::milliseconds timeout);
     TranslationResult performFallbackTranslation(const std::string& text, const std::string& sourceLang, const std::string& targetLang);
     std::string performSimpleTranslation(const std::string& text, const std::string& sourceLang, const std::string& targetLang);
@@ -471,6 +529,10 @@ private:
     std::unordered_map<std::string, StreamingSession> streamingSessions_;
     mutable std::mutex streamingMutex_;
     std::chrono::minutes sessionTimeout_;
+    bool incrementalStreaming_;
+    size_t waitK_;
+    size_t redecodeStrideWords_;
+    size_t maxWindowWords_;
     
     // Translation caching
     bool cachingEnabled_;
@@ -479,6 +541,12 @@ private:
     mutable std::mutex cacheMutex_;
     CacheStats cacheStats_;
     
+    // Persistent translation memory (shared across restarts and replicas)
+    std::unique_ptr<TranslationMemory> translationMemory_;
+    mutable std::mutex translationMemoryMutex_;
+    // Language pair -> version of its loaded weights, set when the model loads
+    std::unordered_map<std::string, std::string> modelVersions_;
+    
     // Multi-language pair support
     std::vector<std::pair<std::string, std::string>> loadedLanguagePairs_;
     std::unordered_map<std::string, std::chrono::steady_clock::time_point> modelLastUsed_;
@@ -502,9 +570,19 @@ private:
     bool getCachedTranslation(const std::string& cacheKey, TranslationResult& result);
     void cacheTranslation(const std::string& cacheKey, const TranslationResult& result);
     void evictOldestCacheEntries();
+    std::string getModelVersion(const std::string& sourceLang, const std::string& targetLang) const;
+    std::string computeModelVersion(const std::string& sourceLang, const std::string& targetLang) const;
+    bool getPersistentTranslation(const std::string& text, const std::string& sourceLang, const std::string& targetLang, TranslationResult& result);
+    void persistTranslation(const std::string& text, const TranslationResult& result);
     std::string preserveContext(const std::string& previousText, const std::string& newText);
     TranslationResult translateWithContext(const std::string& text, const std::string& context, const std::string& sourceLang, const std::string& targetLang);
     
+    // Incremental streaming helpers
+    TranslationResult advanceIncrementalTranslation(StreamingSession& session, bool flush);
+    TranslationResult decodeStreamingWindow(StreamingSession& session, bool closeWindow);
+    TranslationResult translateWithTargetPrefix(const std::string& text, const std::string& targetPrefix, const std::string& sourceLang, const std::string& targetLang);
+    static std::string streamedTranslation(const StreamingSession& session);
+    
     // Multi-language pair support helpers
     bool loadLanguagePairModel(const std::string& sourceLang, const std::string& targetLang);
     void unloadLeastRecentlyUsedModel();
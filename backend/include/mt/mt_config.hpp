@@ -119,10 +119,17 @@ struct StreamingConfig {
   size_t maxContextLength;
   bool enableContextPreservation;
 
+  // Incremental (wait-k) decoding of streamed source text
+  bool incrementalDecoding;
+  size_t waitK;              // Source words the committed target trails by
+  size_t redecodeStrideWords; // New source words needed before decoding again
+  size_t maxWindowWords;     // Source words decoded together before the window is closed
+
   StreamingConfig()
       : enabled(true), sessionTimeout(std::chrono::minutes(30)),
         maxConcurrentSessions(100), maxContextLength(1000),
-        enableContextPreservation(true) {}
+        enableContextPreservation(true), incrementalDecoding(true), waitK(3),
+        redecodeStrideWords(2), maxWindowWords(32) {}
 };
 
 /**
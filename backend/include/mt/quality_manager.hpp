@@ -1,8 +1,10 @@
 #pragma once
 
+#include "mt/text_tokenizer.hpp"
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <chrono>
 
@@ -186,32 +188,44 @@ public:
      * @return true if initialized and ready
      */
     bool isReady() const;
+    
+    /**
+     * Average wall time of one assessTranslationQuality call
+     * @return Mean over all assessments so far
+     */
+    std::chrono::microseconds getAverageAssessmentTime() const;
 
 private:
+    // Assessment of texts already tokenized; every scorer reads the same spans
+    QualityMetrics assessTokenized(const TokenizedText& source,
+                                   const TokenizedText& translation,
+                                   const std::string& sourceLang,
+                                   const std::string& targetLang,
+                                   const std::vector<float>& modelScores);
+    
     // Quality assessment methods
-    float calculateFluencyScore(const std::string& text, const std::string& language);
-    float calculateAdequacyScore(const std::string& source, const std::string& translation, 
+    float calculateFluencyScore(const TokenizedText& text, const std::string& language);
+    float calculateAdequacyScore(const TokenizedText& source, const TokenizedText& translation,
                                 const std::string& sourceLang, const std::string& targetLang);
-    float calculateConsistencyScore(const std::string& text, const std::string& language);
-    std::vector<float> calculateWordLevelConfidences(const std::string& text, 
+    float calculateConsistencyScore(const TokenizedText& text, const std::string& language);
+    std::vector<float> calculateWordLevelConfidences(const TokenizedText& text,
                                                     const std::vector<float>& modelScores);
     
     // Quality issue detection
     std::vector<std::string> detectQualityIssues(
-        const std::string& source,
-        const std::string& translation,
+        const TokenizedText& source,
+        const TokenizedText& translation,
         const std::string& sourceLang,
         const std::string& targetLang,
         const QualityMetrics& metrics
     );
     
     // Text analysis helpers
-    std::vector<std::string> tokenizeText(const std::string& text) const;
-    float calculateTextComplexity(const std::string& text, const std::string& language) const;
-    float calculateSemanticSimilarity(const std::string& text1, const std::string& text2) const;
-    bool detectRepeatedPhrases(const std::string& text) const;
-    bool detectIncompleteTranslation(const std::string& source, const std::string& translation) const;
-    bool detectLanguageMixing(const std::string& text, const std::string& expectedLang) const;
+    float calculateTextComplexity(const TokenizedText& text, const std::string& language) const;
+    float calculateSemanticSimilarity(const TokenizedText& text1, const TokenizedText& text2) const;
+    bool detectRepeatedPhrases(const TokenizedText& text) const;
+    bool detectIncompleteTranslation(const TokenizedText& source, const TokenizedText& translation) const;
+    bool detectLanguageMixing(const TokenizedText& text, const std::string& expectedLang) const;
     
     // Alternative generation methods
     std::string generateParaphraseAlternative(const std::string& text, const std::string& language);
@@ -241,7 +255,7 @@ private:
         size_t mediumQualityCount;
         size_t lowQualityCount;
         float averageConfidence;
-        std::chrono::milliseconds totalAssessmentTime;
+        std::chrono::microseconds totalAssessmentTime;
         
         QualityStats() : totalAssessments(0), highQualityCount(0), 
                         mediumQualityCount(0), lowQualityCount(0), 
@@ -252,6 +266,7 @@ private:
     
     // Thread safety
     mutable std::mutex assessmentMutex_;
+    mutable std::mutex statisticsMutex_;
     
     // Helper methods for configuration
     bool loadConfiguration(const std::string& configPath);
@@ -261,7 +276,7 @@ private:
     // Utility methods
     std::string determineQualityLevel(float confidence) const;
     void updateStatistics(const QualityMetrics& metrics, 
-                         std::chrono::milliseconds assessmentTime);
+                         std::chrono::microseconds assessmentTime);
 };
 
 } // namespace mt
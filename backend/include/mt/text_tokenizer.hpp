@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace speechrnt {
+namespace mt {
+
+/**
+ * Word and sentence spans of one UTF-8 text, found in a single scan
+ *
+ * Words are split on ASCII whitespace with trailing ASCII punctuation
+ * trimmed; multi-byte characters are never split and count as letters.
+ * Sentences end at runs of '.', '!', '?' or their full-width forms.
+ * Spans are byte ranges into the tokenized text, which must outlive any
+ * use of them. Tokenizing again into the same object reuses its buffers.
+ */
+class TokenizedText {
+public:
+    enum TokenFlags : uint8_t {
+        TOKEN_CAPITALIZED = 1 << 0,     // First character is an ASCII capital
+        TOKEN_ENDS_LOWERCASE = 1 << 1,  // Last character is an ASCII lowercase letter
+        TOKEN_HAS_DIGIT = 1 << 2,
+        TOKEN_HAS_SYMBOL = 1 << 3,      // ASCII character that is not a letter or digit
+        TOKEN_NON_ASCII = 1 << 4
+    };
+
+    struct Token {
+        uint32_t offset;
+        uint32_t length;        // Bytes
+        uint32_t characters;    // Code points
+        uint8_t flags;
+        uint64_t foldedHash;    // Of the ASCII-lowercased bytes
+    };
+
+    struct Sentence {
+        uint32_t offset;
+        uint32_t length;        // Bytes, including the terminator run
+        bool terminated;        // Ends with a terminator rather than end of text
+    };
+
+    TokenizedText() = default;
+    explicit TokenizedText(std::string_view text) { tokenize(text); }
+
+    void tokenize(std::string_view text);
+
+    std::string_view text() const { return text_; }
+    const std::vector<Token>& tokens() const { return tokens_; }
+    const std::vector<Sentence>& sentences() const { return sentences_; }
+    std::string_view token(size_t index) const {
+        return text_.substr(tokens_[index].offset, tokens_[index].length);
+    }
+
+    size_t terminatedSentenceCount() const { return terminatedSentences_; }
+    size_t distinctLetterCount() const;           // Case-insensitive ASCII letters
+    size_t characterCount() const { return characters_; }
+    bool hasNonAscii() const { return nonAscii_; }
+
+private:
+    std::string_view text_;
+    std::vector<Token> tokens_;
+    std::vector<Sentence> sentences_;
+    size_t terminatedSentences_ = 0;
+    size_t characters_ = 0;
+    uint32_t letterMask_ = 0;
+    bool nonAscii_ = false;
+};
+
+} // namespace mt
+} // namespace speechrnt
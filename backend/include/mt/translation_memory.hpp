@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace speechrnt {
+namespace mt {
+
+/**
+ * Persistent translation memory shared across restarts and replicas.
+ *
+ * Translations are stored in an append-only log (translation_memory.log)
+ * and located through an open-addressing hash index that is memory-mapped
+ * from translation_memory.idx. Entries are keyed by normalised source text,
+ * language pair and model version, so a model upgrade never serves stale
+ * output. The log is the source of truth: a missing or damaged index is
+ * rebuilt from it on open.
+ */
+class TranslationMemory {
+public:
+    struct Entry {
+        std::string translatedText;
+        float confidence;
+
+        Entry() : confidence(0.0f) {}
+    };
+
+    struct Statistics {
+        size_t entryCount;       // Live (indexed) entries
+        size_t logBytes;         // Current size of the append-only log
+        size_t staleBytes;       // Log bytes superseded by newer records
+        size_t lookups;
+        size_t hits;
+
+        Statistics() : entryCount(0), logBytes(0), staleBytes(0), lookups(0), hits(0) {}
+
+        float getHitRate() const {
+            return lookups > 0 ? (static_cast<float>(hits) / lookups) * 100.0f : 0.0f;
+        }
+    };
+
+    TranslationMemory();
+    ~TranslationMemory();
+
+    TranslationMemory(const TranslationMemory&) = delete;
+    TranslationMemory& operator=(const TranslationMemory&) = delete;
+
+    /**
+     * Open (or create) the translation memory in a directory
+     * @param directory Directory holding the log and index files
+     * @param syncWrites fsync the log after every append
+     * @return true if the store is usable
+     */
+    bool open(const std::string& directory, bool syncWrites = false);
+
+    /**
+     * Flush the index and close all files
+     */
+    void close();
+
+    bool isOpen() const;
+
+    /**
+     * Look up a translation
+     * @param sourceText Source text (normalised internally)
+     * @param sourceLang Source language code
+     * @param targetLang Target language code
+     * @param modelVersion Version tag of the model that produced the entry
+     * @param entry Output entry on hit
+     * @return true on hit
+     */
+    bool lookup(const std::string& sourceText, const std::string& sourceLang,
+                const std::string& targetLang, const std::string& modelVersion,
+                Entry& entry);
+
+    /**
+     * Store a translation, superseding any previous entry for the same key
+     * @return true if the record was appended
+     */
+    bool store(const std::string& sourceText, const std::string& sourceLang,
+               const std::string& targetLang, const std::string& modelVersion,
+               const Entry& entry);
+
+    /**
+     * Rewrite the log keeping only live records and rebuild the index
+     * @return true if compaction succeeded
+     */
+    bool compact();
+
+    /**
+     * Write a compacted copy of the log to a file suitable for shipping
+     * to other replicas
+     * @param path Destination file
+     * @return Number of exported entries, or -1 on failure
+     */
+    long exportTo(const std::string& path);
+
+    /**
+     * Merge records from an exported file; existing keys are kept unless
+     * overwrite is set
+     * @param path Source file produced by exportTo()
+     * @param overwrite Replace entries already present locally
+     * @return Number of imported entries, or -1 on failure
+     */
+    long importFrom(const std::string& path, bool overwrite = false);
+
+    Statistics getStatistics() const;
+
+    /**
+     * Normalise source text for keying: trims, collapses internal
+     * whitespace and lower-cases ASCII letters
+     */
+    static std::string normalizeText(const std::string& text);
+
+private:
+    struct RecordHeader;
+    struct IndexHeader;
+    struct IndexSlot;
+    class MappedIndex;
+
+    std::string makeKey(const std::string& sourceText, const std::string& sourceLang,
+                        const std::string& targetLang, const std::string& modelVersion) const;
+    static uint64_t hashKey(const std::string& key);
+
+    bool openLog(const std::string& path);
+    bool appendRecord(const std::string& key, const Entry& entry, uint64_t& offset);
+    bool readRecord(int fd, uint64_t offset, std::string& key, Entry& entry,
+                    uint64_t* nextOffset = nullptr) const;
+    bool rebuildIndex();
+    bool findSlot(const std::string& key, uint64_t hash, size_t& slot, bool& found) const;
+    bool insertIndex(const std::string& key, uint64_t hash, uint64_t offset);
+    bool growIndex();
+    bool writeCompactedLog(const std::string& path, size_t& written) const;
+
+    std::string directory_;
+    std::string logPath_;
+    std::string indexPath_;
+    int logFd_;
+    uint64_t logSize_;
+    uint64_t staleBytes_;
+    bool syncWrites_;
+    std::unique_ptr<MappedIndex> index_;
+
+    mutable std::mutex mutex_;
+    std::atomic<size_t> lookups_;
+    std::atomic<size_t> hits_;
+};
+
+} // namespace mt
+} // namespace speechrnt
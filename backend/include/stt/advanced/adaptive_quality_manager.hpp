@@ -2,6 +2,7 @@
 
 #include "stt/advanced/adaptive_quality_manager_interface.hpp"
 #include "stt/advanced/advanced_stt_config.hpp"
+#include "utils/timer_service.hpp"
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -31,7 +32,7 @@ public:
     bool isInitialized() const override;
 
 private:
-    void monitoringLoop();
+    void sampleResources();
     SystemResources collectSystemResources();
     float getCpuUsage();
     float getMemoryUsage();
@@ -43,8 +44,7 @@ private:
     mutable std::mutex resourceMutex_;
     std::atomic<bool> initialized_;
     std::atomic<bool> monitoring_;
-    std::thread monitoringThread_;
-    std::condition_variable monitoringCondition_;
+    speechrnt::utils::TimerService::TimerId monitoringTimer_;
     
     // Resource thresholds
     std::atomic<float> cpuThreshold_;
@@ -218,7 +218,7 @@ public:
 private:
     void startAdaptationLoop();
     void stopAdaptationLoop();
-    void adaptationLoop();
+    void runAdaptationCycle();
     void updateCurrentSettings(const QualitySettings& newSettings);
     bool shouldAdapt(const SystemResources& resources);
     void logAdaptation(const QualitySettings& oldSettings, const QualitySettings& newSettings, const std::string& reason);
@@ -241,9 +241,8 @@ private:
     SystemResources lastResourceSnapshot_;
     std::chrono::steady_clock::time_point lastAdaptation_;
     
-    // Adaptation thread
-    std::thread adaptationThread_;
-    std::condition_variable adaptationCondition_;
+    // Adaptation timer
+    speechrnt::utils::TimerService::TimerId adaptationTimer_;
     std::atomic<float> adaptationIntervalMs_;
     
     // Performance history
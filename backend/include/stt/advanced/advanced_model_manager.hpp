@@ -1,6 +1,7 @@
 #pragma once
 
 #include "models/model_manager.hpp"
+#include "utils/timer_service.hpp"
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -398,7 +399,7 @@ private:
     
     // Background processing
     std::atomic<bool> backgroundProcessingEnabled_{true};
-    std::thread backgroundThread_;
+    speechrnt::utils::TimerService::TimerId backgroundTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
     
     // Private methods
     std::string getMetricsKey(const std::string& modelId, const std::string& languagePair) const;
@@ -409,7 +410,7 @@ private:
     std::string assignModelForSession(const std::string& languagePair, const std::string& sessionId);
     void processABTestResults();
     void checkPerformanceDegradation();
-    void backgroundProcessingLoop();
+    void runBackgroundProcessing();
     float calculateStatisticalSignificance(const std::vector<float>& group1,
                                           const std::vector<float>& group2) const;
     void cleanupOldMetrics();
@@ -8,15 +8,97 @@
 #include "stt/advanced/adaptive_quality_manager_interface.hpp"
 #include "stt/advanced/external_service_integrator_interface.hpp"
 #include "stt/stt_interface.hpp"
+#include "stt/emotion_detector.hpp"
 #include <memory>
 #include <vector>
 #include <string>
+#include <map>
+#include <mutex>
+#include <atomic>
 #include <functional>
 #include <chrono>
 
+namespace speechrnt {
+namespace core {
+class TaskQueue;
+class ThreadPool;
+}
+}
+
 namespace stt {
 namespace advanced {
 
+/**
+ * Enhanced transcription result with advanced features
+ */
+struct AdvancedTranscriptionResult : public TranscriptionResult {
+    // Speaker information
+    std::vector<SpeakerSegment> speakerSegments;
+    uint32_t primarySpeakerId = 0;
+    
+    // Audio quality metrics
+    AudioQualityMetrics audioQuality;
+    std::vector<PreprocessingType> appliedPreprocessing;
+    
+    // Contextual enhancements
+    std::vector<ContextualCorrection> contextualCorrections;
+    std::string detectedDomain;
+    float contextualConfidence = 0.0f;
+    
+    // Real-time metrics
+    RealTimeMetrics realtimeMetrics;
+    
+    // Emotion and prosody
+    bool hasEmotionAnalysis = false;
+    EmotionResult emotion{};
+    
+    // Quality and performance
+    QualityLevel usedQualityLevel = QualityLevel::MEDIUM;
+    float processingLatencyMs = 0.0f;
+    
+    // External service information
+    bool usedExternalService = false;
+    std::string externalServiceName;
+    std::vector<TranscriptionResult> serviceResults; // For result fusion
+    
+    AdvancedTranscriptionResult() = default;
+    
+    // Constructor from base TranscriptionResult
+    explicit AdvancedTranscriptionResult(const TranscriptionResult& base)
+        : TranscriptionResult(base) {}
+};
+
+/**
+ * Audio processing request with advanced feature options
+ */
+struct AudioProcessingRequest {
+    uint32_t utteranceId = 0;
+    std::vector<float> audioData;
+    bool isLive = false;
+    
+    // Feature enablement flags
+    bool enableSpeakerDiarization = false;
+    bool enableAudioPreprocessing = true;
+    bool enableContextualTranscription = false;
+    bool enableRealTimeAnalysis = true;
+    bool enableAdaptiveQuality = true;
+    bool enableExternalServices = false;
+    bool enableEmotionAnalysis = false;
+    bool enableAllFeatures = false;
+    
+    // Context information
+    std::string domainHint;
+    std::string languageHint;
+    std::vector<std::string> customVocabulary;
+    
+    // Quality preferences
+    QualityLevel preferredQuality = QualityLevel::MEDIUM;
+    float maxLatencyMs = 2000.0f;
+    
+    // Callback for results
+    std::function<void(const AdvancedTranscriptionResult&)> callback;
+};
+
 /**
  * Pipeline stage enumeration
  */
@@ -25,29 +107,53 @@ enum class PipelineStage {
     REALTIME_ANALYSIS,
     QUALITY_ADAPTATION,
     SPEAKER_DIARIZATION,
+    EMOTION_ANALYSIS,
     TRANSCRIPTION,
     CONTEXTUAL_ENHANCEMENT,
     EXTERNAL_SERVICE_FUSION,
     RESULT_FINALIZATION
 };
 
+/**
+ * Data a stage reads from or writes to the execution context.
+ * The pipeline orders stages by these declarations, so stages that do not
+ * consume each other's outputs run concurrently.
+ */
+enum class PipelineData {
+    ORIGINAL_AUDIO,
+    PROCESSED_AUDIO,     // processedAudio
+    AUDIO_QUALITY,       // audioQuality
+    REALTIME_METRICS,    // realtimeMetrics
+    QUALITY_SETTINGS,    // qualitySettings
+    SPEAKER_INFO,        // speakerInfo
+    EMOTION,             // emotion
+    BASE_TRANSCRIPTION,  // baseTranscription
+    CONTEXTUAL_ENHANCEMENT, // contextualEnhancement
+    EXTERNAL_RESULT,     // externalServiceResult
+    FINAL_RESULT
+};
+
 /**
  * Pipeline stage result
  */
 struct PipelineStageResult {
     PipelineStage stage;
     bool success;
+    bool skipped;
     float processingTimeMs;
+    float startOffsetMs; // From the start of the execution
     std::string errorMessage;
     std::map<std::string, std::string> stageMetadata;
     
     PipelineStageResult() 
         : stage(PipelineStage::AUDIO_PREPROCESSING)
         , success(false)
-        , processingTimeMs(0.0f) {}
+        , skipped(false)
+        , processingTimeMs(0.0f)
+        , startOffsetMs(0.0f) {}
     
     PipelineStageResult(PipelineStage s, bool succ, float time)
-        : stage(s), success(succ), processingTimeMs(time) {}
+        : stage(s), success(succ), skipped(false), processingTimeMs(time), startOffsetMs(0.0f) {}
 };
 
 /**
@@ -62,9 +168,11 @@ struct PipelineExecutionContext {
     
     // Stage-specific data
     AudioQualityMetrics audioQuality;
+    std::vector<PreprocessingType> appliedPreprocessing;
     RealTimeMetrics realtimeMetrics;
     QualitySettings qualitySettings;
     DiarizationResult speakerInfo;
+    EmotionResult emotion;
     TranscriptionResult baseTranscription;
     ContextualResult contextualEnhancement;
     FusedTranscriptionResult externalServiceResult;
@@ -73,6 +181,8 @@ struct PipelineExecutionContext {
     std::vector<PipelineStageResult> stageResults;
     std::chrono::steady_clock::time_point startTime;
     std::chrono::steady_clock::time_point endTime;
+    float criticalPathMs; // Longest dependency chain of measured stage times
+    float stageTimeoutMs; // Budget for stages waiting on asynchronous engines
     
     // Configuration
     AudioProcessingRequest originalRequest;
@@ -81,8 +191,11 @@ struct PipelineExecutionContext {
         : utteranceId(0)
         , sampleRate(16000)
         , isRealTime(false)
+        , emotion{}
         , startTime(std::chrono::steady_clock::now())
-        , endTime(std::chrono::steady_clock::now()) {}
+        , endTime(std::chrono::steady_clock::now())
+        , criticalPathMs(0.0f)
+        , stageTimeoutMs(5000.0f) {}
 };
 
 /**
@@ -106,12 +219,16 @@ struct PipelineConfig {
         , stageTimeoutMs(5000.0f)
         , enableProfiling(false) {
         
-        // Default enabled stages
+        // Default enabled stages; optional ones skip themselves unless the request asks for them
         enabledStages = {
             PipelineStage::AUDIO_PREPROCESSING,
             PipelineStage::REALTIME_ANALYSIS,
             PipelineStage::QUALITY_ADAPTATION,
+            PipelineStage::SPEAKER_DIARIZATION,
+            PipelineStage::EMOTION_ANALYSIS,
             PipelineStage::TRANSCRIPTION,
+            PipelineStage::CONTEXTUAL_ENHANCEMENT,
+            PipelineStage::EXTERNAL_SERVICE_FUSION,
             PipelineStage::RESULT_FINALIZATION
         };
     }
@@ -119,6 +236,10 @@ struct PipelineConfig {
 
 /**
  * Pipeline stage processor interface
+ *
+ * Stages whose inputs are ready run concurrently on the pipeline executor.
+ * A stage reads only its declared inputs and writes only the context fields
+ * behind its declared outputs; the pipeline records stage results itself.
  */
 class PipelineStageProcessor {
 public:
@@ -150,6 +271,18 @@ public:
      */
     virtual std::vector<PipelineStage> getStageDependencies() const = 0;
     
+    /**
+     * Get context data the stage reads
+     * @return Data that must be produced before the stage runs
+     */
+    virtual std::vector<PipelineData> getStageInputs() const { return {}; }
+    
+    /**
+     * Get context data the stage writes
+     * @return Data produced by the stage
+     */
+    virtual std::vector<PipelineData> getStageOutputs() const { return {}; }
+    
     /**
      * Validate stage prerequisites
      * @param context Pipeline execution context
@@ -179,6 +312,7 @@ public:
 
 /**
  * Pipeline execution monitor interface
+ * Stage completions are recorded from whichever thread ran the stage.
  */
 class PipelineExecutionMonitor {
 public:
@@ -229,6 +363,47 @@ public:
     virtual bool isInitialized() const = 0;
 };
 
+/**
+ * Default execution monitor
+ * Keeps per-stage timing and compares each execution's wall time with its
+ * critical path and with the sum of its stage times.
+ */
+class StageTimingMonitor : public PipelineExecutionMonitor {
+public:
+    StageTimingMonitor();
+    
+    bool initialize() override;
+    void startExecution(const PipelineExecutionContext& context) override;
+    void recordStageCompletion(PipelineStage stage, const PipelineStageResult& result) override;
+    void finishExecution(const PipelineExecutionContext& context) override;
+    std::string getExecutionStats() const override;
+    std::map<std::string, float> getStageMetrics(PipelineStage stage) const override;
+    bool isInitialized() const override { return initialized_; }
+    
+    /**
+     * Reset all statistics
+     */
+    void reset();
+
+private:
+    struct StageTiming {
+        uint64_t executions = 0;
+        uint64_t failures = 0;
+        uint64_t skips = 0;
+        double totalMs = 0.0;
+        float maxMs = 0.0f;
+        float lastMs = 0.0f;
+    };
+    
+    mutable std::mutex mutex_;
+    std::atomic<bool> initialized_;
+    std::map<PipelineStage, StageTiming> stageTimings_;
+    uint64_t executions_;
+    double totalWallMs_;
+    double totalCriticalPathMs_;
+    double totalStageSumMs_;
+};
+
 /**
  * Advanced processing pipeline
  */
@@ -264,6 +439,35 @@ public:
         std::shared_ptr<STTInterface> baseSTT
     );
     
+    /**
+     * Set emotion detector used by the emotion analysis stage
+     * @param emotionDetector Emotion and prosody detector
+     */
+    void setEmotionDetector(std::shared_ptr<EmotionDetector> emotionDetector);
+    
+    /**
+     * Run stages on a shared task queue instead of the pipeline's own workers.
+     * The calling thread also executes ready stages, so a saturated queue
+     * delays the pipeline but never deadlocks it.
+     * @param executor Task queue served by a running thread pool
+     */
+    void setExecutor(std::shared_ptr<speechrnt::core::TaskQueue> executor);
+    
+    /**
+     * Replace the processor for a stage. setComponents() reinstalls the
+     * default processors, so custom ones are registered after it.
+     * @param processor Stage processor; its stage type selects the slot
+     * @return true if the resulting stage graph is valid
+     */
+    bool registerStageProcessor(std::unique_ptr<PipelineStageProcessor> processor);
+    
+    /**
+     * Get stages an enabled stage waits for
+     * @param stage Pipeline stage
+     * @return Direct predecessors in the current execution plan
+     */
+    std::vector<PipelineStage> getStagePredecessors(PipelineStage stage) const;
+    
     /**
      * Process audio through the advanced pipeline
      * @param request Audio processing request
@@ -370,6 +574,15 @@ public:
     void shutdown();
 
 private:
+    // Stages in dependency order with their edges, rebuilt on configuration changes
+    struct ExecutionPlan {
+        std::vector<PipelineStage> stages;
+        std::vector<std::shared_ptr<PipelineStageProcessor>> processors;
+        std::vector<std::vector<size_t>> predecessors;
+        std::vector<std::vector<size_t>> dependents;
+    };
+    struct ExecutionRun;
+    
     // Component references
     std::shared_ptr<SpeakerDiarizationInterface> speakerEngine_;
     std::shared_ptr<AudioPreprocessorInterface> audioPreprocessor_;
@@ -378,14 +591,21 @@ private:
     std::shared_ptr<AdaptiveQualityManagerInterface> qualityManager_;
     std::shared_ptr<ExternalServiceIntegratorInterface> externalServices_;
     std::shared_ptr<STTInterface> baseSTT_;
+    std::shared_ptr<EmotionDetector> emotionDetector_;
     
     // Pipeline configuration and state
     PipelineConfig config_;
     std::atomic<bool> initialized_;
-    std::string lastError_;
+    mutable std::string lastError_;
+    mutable std::mutex mutex_;
     
     // Stage processors
-    std::map<PipelineStage, std::unique_ptr<PipelineStageProcessor>> stageProcessors_;
+    std::map<PipelineStage, std::shared_ptr<PipelineStageProcessor>> stageProcessors_;
+    std::shared_ptr<const ExecutionPlan> plan_;
+    
+    // Executor shared by every execution
+    std::shared_ptr<speechrnt::core::TaskQueue> executor_;
+    std::unique_ptr<speechrnt::core::ThreadPool> ownedPool_;
     
     // Monitoring
     std::unique_ptr<PipelineExecutionMonitor> executionMonitor_;
@@ -394,11 +614,20 @@ private:
     bool initializeStageProcessors();
     bool validateStageOrder(const std::vector<PipelineStage>& stages) const;
     std::vector<PipelineStage> resolveStageDependencies(const std::vector<PipelineStage>& requestedStages) const;
-    PipelineExecutionContext createExecutionContext(const AudioProcessingRequest& request);
+    std::shared_ptr<const ExecutionPlan> buildExecutionPlan(const std::vector<PipelineStage>& stages,
+                                                            std::string& error) const;
+    bool rebuildExecutionPlan();
+    void startOwnedExecutor();
+    PipelineExecutionContext createExecutionContext(const AudioProcessingRequest& request) const;
+    void runStages(const std::shared_ptr<ExecutionRun>& run, size_t index);
+    size_t completeStage(const std::shared_ptr<ExecutionRun>& run, size_t index, PipelineStageResult result);
+    PipelineStageResult executeStage(ExecutionRun& run, size_t index);
+    float computeCriticalPath(const ExecutionPlan& plan, const std::vector<float>& stageTimes) const;
     AdvancedTranscriptionResult finalizeResult(const PipelineExecutionContext& context);
-    void handleStageError(PipelineStage stage, const std::string& error, PipelineExecutionContext& context);
-    bool shouldSkipStage(PipelineStage stage, const PipelineExecutionContext& context) const;
-    bool retryStage(PipelineStage stage, PipelineExecutionContext& context);
+    void handleStageError(PipelineStage stage, const std::string& error);
+    bool shouldSkipStage(PipelineStageProcessor& processor, const PipelineExecutionContext& context) const;
+    PipelineStageResult retryStage(PipelineStageProcessor& processor, PipelineExecutionContext& context,
+                                   int attempts);
     std::string stageToString(PipelineStage stage) const;
     PipelineStage stringToStage(const std::string& stageStr) const;
 };
@@ -20,72 +20,6 @@
 namespace stt {
 namespace advanced {
 
-/**
- * Enhanced transcription result with advanced features
- */
-struct AdvancedTranscriptionResult : public TranscriptionResult {
-    // Speaker information
-    std::vector<SpeakerSegment> speakerSegments;
-    uint32_t primarySpeakerId = 0;
-    
-    // Audio quality metrics
-    AudioQualityMetrics audioQuality;
-    std::vector<PreprocessingType> appliedPreprocessing;
-    
-    // Contextual enhancements
-    std::vector<ContextualCorrection> contextualCorrections;
-    std::string detectedDomain;
-    float contextualConfidence = 0.0f;
-    
-    // Real-time metrics
-    RealTimeMetrics realtimeMetrics;
-    
-    // Quality and performance
-    QualityLevel usedQualityLevel = QualityLevel::MEDIUM;
-    float processingLatencyMs = 0.0f;
-    
-    // External service information
-    bool usedExternalService = false;
-    std::string externalServiceName;
-    std::vector<TranscriptionResult> serviceResults; // For result fusion
-    
-    AdvancedTranscriptionResult() = default;
-    
-    // Constructor from base TranscriptionResult
-    explicit AdvancedTranscriptionResult(const TranscriptionResult& base)
-        : TranscriptionResult(base) {}
-};
-
-/**
- * Audio processing request with advanced feature options
- */
-struct AudioProcessingRequest {
-    uint32_t utteranceId = 0;
-    std::vector<float> audioData;
-    bool isLive = false;
-    
-    // Feature enablement flags
-    bool enableSpeakerDiarization = false;
-    bool enableAudioPreprocessing = true;
-    bool enableContextualTranscription = false;
-    bool enableRealTimeAnalysis = true;
-    bool enableAdaptiveQuality = true;
-    bool enableExternalServices = false;
-    bool enableAllFeatures = false;
-    
-    // Context information
-    std::string domainHint;
-    std::string languageHint;
-    std::vector<std::string> customVocabulary;
-    
-    // Quality preferences
-    QualityLevel preferredQuality = QualityLevel::MEDIUM;
-    float maxLatencyMs = 2000.0f;
-    
-    // Callback for results
-    std::function<void(const AdvancedTranscriptionResult&)> callback;
-};
-
 /**
  * Advanced STT Orchestrator
  * Main coordinator for all advanced STT features
@@ -0,0 +1,466 @@
+#pragma once
+
+#include "stt/advanced/batch_processing_manager_interface.hpp"
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+namespace stt {
+
+class WhisperStatePool;
+
+namespace advanced {
+
+/**
+ * Read-only memory mapping of a PCM audio file. Supports RIFF/WAVE with 16-bit
+ * integer or 32-bit float samples, and headerless ".pcm" files (16-bit little
+ * endian, 16 kHz mono). Samples are converted on demand, so a long recording is
+ * never materialised in memory as a whole.
+ */
+class MappedAudioFile {
+public:
+    MappedAudioFile();
+    ~MappedAudioFile();
+
+    MappedAudioFile(const MappedAudioFile&) = delete;
+    MappedAudioFile& operator=(const MappedAudioFile&) = delete;
+
+    bool open(const std::string& filePath);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    int getSampleRate() const { return sampleRate_; }
+    int getChannels() const { return channels_; }
+    size_t getFrameCount() const { return frameCount_; }
+    size_t getFileSizeBytes() const { return mappingSize_; }
+    double getDurationSeconds() const;
+    const std::string& getLastError() const { return lastError_; }
+
+    /**
+     * Convert frames [startFrame, startFrame + frameCount) to mono float at the
+     * file's sample rate; the range is clamped to the end of the file
+     */
+    void readMono(size_t startFrame, size_t frameCount, std::vector<float>& out) const;
+
+    /**
+     * Same as readMono, resampled to targetRate
+     */
+    void readMonoResampled(size_t startFrame, size_t frameCount, int targetRate,
+                           std::vector<float>& out) const;
+
+private:
+    int fd_;
+    void* mapping_;
+    size_t mappingSize_;
+    const uint8_t* data_;
+    size_t frameCount_;
+    int sampleRate_;
+    int channels_;
+    int bitsPerSample_;
+    bool isFloat_;
+    std::string lastError_;
+
+    bool parseWavHeader();
+};
+
+/**
+ * Span of speech found by VadSegmenter, in frames of the source file
+ */
+struct AudioSegment {
+    size_t index = 0;
+    size_t startFrame = 0;
+    size_t endFrame = 0;
+};
+
+/**
+ * Offline energy VAD that cuts a recording into speech segments for parallel
+ * decoding. The threshold adapts to the recording's noise floor; long speech
+ * runs are split at their quietest frame so no segment exceeds maxSegmentSeconds.
+ */
+class VadSegmenter {
+public:
+    struct Config {
+        int frameMs = 30;
+        int minSilenceMs = 500;       // Shorter pauses stay inside a segment
+        int minSpeechMs = 250;        // Shorter bursts are dropped as noise
+        int paddingMs = 200;          // Context kept on both sides of speech
+        float maxSegmentSeconds = 30.0f;
+        float thresholdAboveFloorDb = 12.0f;
+        float absoluteFloorDb = -55.0f;
+    };
+
+    VadSegmenter() = default;
+    explicit VadSegmenter(const Config& config) : config_(config) {}
+
+    std::vector<AudioSegment> segment(const MappedAudioFile& file) const;
+
+    /**
+     * Segment from precomputed per-frame energies (dBFS); exposed for testing
+     */
+    std::vector<AudioSegment> segmentEnergies(const std::vector<float>& frameEnergyDb,
+                                              size_t frameSamples, size_t totalFrames) const;
+
+    const Config& getConfig() const { return config_; }
+
+private:
+    Config config_;
+};
+
+/**
+ * Decodes 16 kHz mono segments on a fixed number of independent slots
+ */
+class SegmentTranscriber {
+public:
+    virtual ~SegmentTranscriber() = default;
+
+    virtual size_t getSlotCount() const = 0;
+
+    /**
+     * CPU cores a single busy slot occupies, used for per-core throughput
+     */
+    virtual size_t getThreadsPerSlot() const { return 1; }
+
+    /**
+     * Transcribe on one slot; results are timed relative to the audio start
+     */
+    virtual bool transcribeSegment(size_t slot, const std::vector<float>& audio,
+                                   const std::string& language, bool wordTimings,
+                                   std::vector<TranscriptionResult>& results) = 0;
+};
+
+/**
+ * SegmentTranscriber backed by a WhisperStatePool
+ */
+class WhisperSegmentTranscriber : public SegmentTranscriber {
+public:
+    explicit WhisperSegmentTranscriber(std::shared_ptr<WhisperStatePool> pool);
+
+    size_t getSlotCount() const override;
+    size_t getThreadsPerSlot() const override;
+    bool transcribeSegment(size_t slot, const std::vector<float>& audio,
+                           const std::string& language, bool wordTimings,
+                           std::vector<TranscriptionResult>& results) override;
+
+private:
+    std::shared_ptr<WhisperStatePool> pool_;
+};
+
+/**
+ * AudioFileProcessor over memory-mapped WAV/PCM files. Audio is delivered as
+ * 16 kHz mono, the rate whisper expects.
+ */
+class WavFileProcessor : public AudioFileProcessor {
+public:
+    static constexpr int TARGET_SAMPLE_RATE = 16000;
+
+    WavFileProcessor();
+    ~WavFileProcessor() override = default;
+
+    bool initialize() override;
+    AudioFileInfo analyzeAudioFile(const std::string& filePath) override;
+    std::vector<float> loadAudioFile(const std::string& filePath) override;
+    bool processAudioFileInChunks(const std::string& filePath,
+                                  size_t chunkSizeSeconds,
+                                  std::function<void(const std::vector<float>&, size_t)> callback) override;
+    std::vector<std::string> getSupportedFormats() const override;
+    bool isFormatSupported(const std::string& filePath) const override;
+    bool isInitialized() const override { return initialized_; }
+
+private:
+    bool initialized_;
+};
+
+/**
+ * Formats transcripts as JSON, plain text, SRT or WebVTT
+ */
+class TranscriptOutputFormatter : public OutputFormatter {
+public:
+    TranscriptOutputFormatter();
+    ~TranscriptOutputFormatter() override = default;
+
+    bool initialize() override;
+    std::string formatResult(const TranscriptionResult& result,
+                             const std::string& format,
+                             bool includeTimestamps = true,
+                             bool includeWordTimings = false) override;
+    std::string formatBatchResult(const BatchJobResult& jobResult,
+                                  const std::string& format) override;
+    bool saveToFile(const std::string& content, const std::string& outputPath) override;
+    std::vector<std::string> getSupportedFormats() const override;
+    bool isInitialized() const override { return initialized_; }
+
+    /**
+     * Format a stitched transcript, one cue per result
+     */
+    std::string formatSegments(const std::vector<TranscriptionResult>& segments,
+                               const std::string& format,
+                               bool includeTimestamps = true,
+                               bool includeWordTimings = false) const;
+
+    /**
+     * "HH:MM:SS,mmm" for SRT, "HH:MM:SS.mmm" for VTT
+     */
+    static std::string formatTimestamp(int64_t ms, char fractionSeparator);
+
+private:
+    bool initialized_;
+};
+
+/**
+ * Append-only record of finished work for one batch job, so an interrupted job
+ * resumes without re-decoding segments it already has. Each line is one
+ * tab-separated record:
+ *   S  file  segmentIndex  startFrame  endFrame  [startMs  endMs  confidence  text]...
+ *   F  file  outputPath
+ * with one bracketed group per decoded result. Segment records are only reused
+ * while the segmentation is unchanged; word timings are not kept.
+ */
+class BatchCheckpoint {
+public:
+    struct SegmentRecord {
+        size_t startFrame = 0;
+        size_t endFrame = 0;
+        std::vector<TranscriptionResult> results;
+    };
+
+    BatchCheckpoint() = default;
+    ~BatchCheckpoint();
+
+    /**
+     * Load an existing checkpoint (if any) and open it for appending
+     */
+    bool open(const std::string& path);
+    void close();
+
+    bool isFileComplete(const std::string& file) const;
+    std::string getOutputFile(const std::string& file) const;
+    const SegmentRecord* findSegment(const std::string& file, size_t segmentIndex) const;
+
+    bool recordSegment(const std::string& file, size_t segmentIndex, const AudioSegment& segment,
+                       const std::vector<TranscriptionResult>& results);
+    bool recordFileComplete(const std::string& file, const std::string& outputPath);
+
+    /**
+     * Delete the checkpoint once the job has finished
+     */
+    void remove();
+
+    const std::string& getPath() const { return path_; }
+
+private:
+    std::string path_;
+    FILE* stream_ = nullptr;
+    std::unordered_map<std::string, std::unordered_map<size_t, SegmentRecord>> segments_;
+    std::unordered_map<std::string, std::string> completedFiles_;
+    mutable std::mutex mutex_;
+
+    void parseLine(const std::string& line);
+};
+
+/**
+ * Pause/cancel flags shared between a queued job and the code running it
+ */
+class BatchJobControl {
+public:
+    void cancel();
+    bool isCancelled() const { return cancelled_; }
+
+    void pause();
+    void resume();
+    bool isPaused() const;
+
+    /**
+     * Block while the job is paused
+     * @return false if the job was cancelled
+     */
+    bool waitWhilePaused();
+
+private:
+    std::atomic<bool> cancelled_{false};
+    bool paused_ = false;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+/**
+ * Priority queue of batch jobs run by a fixed set of job threads. Higher
+ * priority jobs start first; jobs of equal priority run in submission order.
+ */
+class PriorityBatchJobQueue : public BatchJobQueue {
+public:
+    using JobRunner = std::function<BatchJobResult(uint32_t jobId, const BatchJobRequest& request,
+                                                   BatchJobControl& control)>;
+
+    PriorityBatchJobQueue();
+    ~PriorityBatchJobQueue() override;
+
+    bool initialize(size_t maxConcurrentJobs = 4) override;
+    uint32_t addJob(const BatchJobRequest& request) override;
+    bool removeJob(uint32_t jobId) override;
+    bool startProcessing() override;
+    void stopProcessing() override;
+    void pauseProcessing() override;
+    void resumeProcessing() override;
+    BatchJobProgress getJobProgress(uint32_t jobId) const override;
+    std::map<uint32_t, BatchJobProgress> getAllJobProgress() const override;
+    bool cancelJob(uint32_t jobId) override;
+    bool setJobPriority(uint32_t jobId, BatchJobPriority priority) override;
+    std::string getQueueStats() const override;
+    bool isProcessing() const override { return processing_; }
+    bool isInitialized() const override { return initialized_; }
+
+    void setJobRunner(JobRunner runner);
+    std::shared_ptr<BatchJobControl> getJobControl(uint32_t jobId) const;
+    void updateJobProgress(uint32_t jobId, const std::function<void(BatchJobProgress&)>& update);
+
+private:
+    struct JobEntry {
+        BatchJobRequest request;
+        BatchJobProgress progress;
+        std::shared_ptr<BatchJobControl> control;
+        uint64_t submitOrder = 0;
+    };
+
+    bool initialized_;
+    std::atomic<bool> processing_;
+    bool paused_;
+    size_t maxConcurrentJobs_;
+    uint32_t nextJobId_;
+    uint64_t nextSubmitOrder_;
+
+    std::map<uint32_t, JobEntry> jobs_;
+    std::set<uint32_t> pending_;
+    std::set<uint32_t> running_;
+    JobRunner runner_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::thread> workers_;
+
+    void workerLoop();
+    bool popNextJob(uint32_t& jobId);
+};
+
+/**
+ * Offline batch transcription engine.
+ *
+ * Each file is memory-mapped, cut into speech segments by VadSegmenter and the
+ * segments are decoded in parallel on a pool of transcriber slots (one worker
+ * thread per whisper state). Every decoded segment is checkpointed as soon as
+ * it finishes; once the whole file is done the results are stitched back in
+ * segment order and written through TranscriptOutputFormatter as JSON, text,
+ * SRT or VTT.
+ */
+class BatchProcessingManager : public BatchProcessingManagerInterface {
+public:
+    /**
+     * @param transcriber Segment transcriber; when null one is built from the
+     *        "modelPath" parameter of the configuration at initialize()
+     */
+    explicit BatchProcessingManager(std::shared_ptr<SegmentTranscriber> transcriber = nullptr);
+    ~BatchProcessingManager() override;
+
+    bool initialize(const BatchProcessingConfig& config) override;
+    uint32_t submitBatchJob(const BatchJobRequest& request) override;
+    bool cancelBatchJob(uint32_t jobId) override;
+    bool pauseBatchJob(uint32_t jobId) override;
+    bool resumeBatchJob(uint32_t jobId) override;
+    BatchJobProgress getJobProgress(uint32_t jobId) const override;
+    BatchJobResult getJobResult(uint32_t jobId) const override;
+    std::map<uint32_t, BatchJobProgress> getActiveJobs() const override;
+    std::vector<BatchJobResult> getJobHistory(size_t maxJobs = 100) const override;
+    void setMaxConcurrentJobs(size_t maxJobs) override;
+    void setDefaultChunkSize(size_t chunkSizeSeconds) override;
+    void setParallelProcessingEnabled(bool enabled) override;
+    void setOutputDirectory(const std::string& directory) override;
+    std::string getProcessingStats() const override;
+    std::vector<std::string> getSupportedAudioFormats() const override;
+    std::vector<std::string> getSupportedOutputFormats() const override;
+    std::map<std::string, bool> validateAudioFiles(const std::vector<std::string>& filePaths) const override;
+    float estimateProcessingTime(const std::vector<std::string>& filePaths,
+                                 const BatchJobConfig& config) const override;
+    bool updateConfiguration(const BatchProcessingConfig& config) override;
+    BatchProcessingConfig getCurrentConfiguration() const override;
+    bool isInitialized() const override { return initialized_; }
+    std::string getLastError() const override;
+    void shutdown() override;
+
+    /**
+     * Block until the job has finished
+     * @return false on timeout or unknown job
+     */
+    bool waitForJob(uint32_t jobId, std::chrono::milliseconds timeout);
+
+    /**
+     * Checkpoint location used for a request; stable across restarts
+     */
+    static std::string getCheckpointPath(const BatchJobRequest& request, const std::string& outputDirectory);
+
+    /**
+     * Transcribe one file synchronously with the segment pool
+     */
+    FileProcessingResult transcribeFile(const std::string& filePath, const BatchJobConfig& config,
+                                        BatchJobControl& control, BatchCheckpoint* checkpoint,
+                                        std::vector<TranscriptionResult>& segments,
+                                        const std::function<void(float)>& progress = nullptr);
+
+private:
+    struct Statistics {
+        uint64_t jobsCompleted = 0;
+        uint64_t jobsFailed = 0;
+        uint64_t filesProcessed = 0;
+        uint64_t segmentsTranscribed = 0;
+        uint64_t segmentsResumed = 0;
+        double audioSecondsProcessed = 0.0;
+        double wallSecondsProcessing = 0.0;   // Summed per file
+        double segmentBusySeconds = 0.0;      // Summed per segment decode
+    };
+
+    struct SegmentTask {
+        BatchJobControl* control = nullptr;
+        std::function<void(size_t slot)> run;
+    };
+
+    bool initialized_;
+    BatchProcessingConfig config_;
+    std::string outputDirectory_;
+    std::shared_ptr<SegmentTranscriber> transcriber_;
+    std::unique_ptr<WavFileProcessor> fileProcessor_;
+    std::unique_ptr<TranscriptOutputFormatter> formatter_;
+    std::unique_ptr<PriorityBatchJobQueue> queue_;
+    VadSegmenter segmenter_;
+
+    // Segment worker pool, one thread per transcriber slot
+    std::vector<std::thread> segmentWorkers_;
+    size_t coresInUse_;
+    std::deque<SegmentTask> segmentTasks_;
+    std::mutex segmentMutex_;
+    std::condition_variable segmentCv_;
+    bool stopWorkers_;
+
+    // Finished jobs
+    std::map<uint32_t, BatchJobResult> results_;
+    std::deque<uint32_t> history_;
+    std::condition_variable resultsCv_;
+
+    Statistics stats_;
+    mutable std::mutex mutex_;
+    std::string lastError_;
+
+    BatchJobResult runJob(uint32_t jobId, const BatchJobRequest& request, BatchJobControl& control);
+    void segmentWorkerLoop(size_t slot);
+    void enqueueSegmentTask(SegmentTask task);
+    void startSegmentWorkers();
+    void stopSegmentWorkers();
+    std::string buildOutputPath(const std::string& inputFile, const BatchJobConfig& config) const;
+    void setError(const std::string& error);
+};
+
+} // namespace advanced
+} // namespace stt
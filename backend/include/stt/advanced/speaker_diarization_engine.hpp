@@ -1,6 +1,7 @@
 #pragma once
 
 #include "stt/advanced/speaker_diarization_interface.hpp"
+#include "audio/frame_features.hpp"
 #include <memory>
 #include <unordered_map>
 #include <mutex>
@@ -66,10 +67,12 @@ private:
     size_t windowSize_;
     size_t hopSize_;
     
+    // Analysis tables for the last sample rate seen
+    std::mutex frameTablesMutex_;
+    std::shared_ptr<const ::audio::FrameAnalysisTables> frameTables_;
+    
     // Helper methods
-    std::vector<float> extractMFCCFeatures(const std::vector<float>& audioData, int sampleRate);
-    std::vector<float> computeMelFilterBank(const std::vector<float>& spectrum, int sampleRate);
-    std::vector<float> computeDCT(const std::vector<float>& melFeatures);
+    std::shared_ptr<const ::audio::FrameAnalysisTables> getFrameTables(int sampleRate);
     float cosineSimilarity(const std::vector<float>& vec1, const std::vector<float>& vec2);
     float euclideanDistance(const std::vector<float>& vec1, const std::vector<float>& vec2);
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "audio/pitch_tracker.hpp"
 #include <vector>
 #include <string>
 #include <map>
@@ -135,6 +136,15 @@ public:
 
     bool initialize(int sample_rate);
     ProsodicFeatures extractFeatures(const std::vector<float>& audio_data);
+
+    // Streaming pitch: feeds this stream's tracker and returns the contour of
+    // the frames the chunk completed, for consumers to merge
+    ::audio::PitchContour addAudio(const float* samples, size_t count);
+    ::audio::PitchContour addAudio(const std::vector<float>& audio_chunk) {
+        return addAudio(audio_chunk.data(), audio_chunk.size());
+    }
+    const ::audio::PitchContour& getPitchContour() const;
+    void resetStream();
     
 private:
     class Impl;
@@ -162,6 +172,12 @@ public:
     
     SentimentResult analyzeSentimentFromText(const std::string& text);
 
+    // Incremental prosody over the session's live audio; returns the pitch
+    // contour of the frames this chunk completed
+    ::audio::PitchContour addAudioChunk(const std::vector<float>& audio_chunk, int sample_rate);
+    ::audio::PitchContour getPitchContour() const;
+    void resetAudioStream();
+
     // Emotion tracking and context
     void updateEmotionHistory(const EmotionResult& result);
     bool detectEmotionTransition(const EmotionResult& current_emotion);
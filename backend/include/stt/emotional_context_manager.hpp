@@ -23,6 +23,7 @@ struct EmotionalSegment {
     std::string transcribed_text;
     std::vector<EmotionResult> emotion_samples;
     std::vector<SentimentResult> sentiment_samples;
+    ::audio::PitchContour pitch_contour;  // Pitch of the audio streamed during the segment
 };
 
 /**
@@ -55,6 +56,7 @@ struct ConversationEmotionalState {
     int64_t last_update_timestamp_ms;
     std::map<EmotionType, float> emotion_distribution;
     std::map<SentimentPolarity, float> sentiment_distribution;
+    ::audio::PitchContour pitch_contour;  // Whole conversation
 };
 
 /**
@@ -100,6 +102,10 @@ public:
                                const std::string& transcribed_text);
 
     ConversationEmotionalState getConversationState(uint32_t conversation_id) const;
+
+    // Folds a pitch contour delta, e.g. from EmotionDetector::addAudioChunk,
+    // into the conversation and its current segment
+    void updatePitchContour(uint32_t conversation_id, const ::audio::PitchContour& delta);
     
     // Emotional segmentation
     void processEmotionalSegmentation(uint32_t conversation_id,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "utils/memory_pool.hpp"
+#include "utils/timer_service.hpp"
 #include <unordered_map>
 #include <memory>
 #include <mutex>
@@ -204,12 +205,11 @@ private:
     std::condition_variable taskCondition_;
     
     // Cleanup management
-    std::thread cleanupThread_;
+    speechrnt::utils::TimerService::TimerId cleanupTimer_;
     std::chrono::steady_clock::time_point lastCleanupTime_;
     
     // Helper methods
     void workerThreadFunction();
-    void cleanupThreadFunction();
     void updateStatistics();
     std::vector<uint32_t> findIdleUtterances() const;
     void removeUtteranceInternal(uint32_t utteranceId);
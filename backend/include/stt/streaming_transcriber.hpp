@@ -1,5 +1,6 @@
 #pragma once
 
+#include "audio/audio_segment.hpp"
 #include "core/message_protocol.hpp"
 #include "stt/stt_config.hpp"
 #include "stt/stt_performance_tracker.hpp"
@@ -47,9 +48,14 @@ public:
   void startTranscription(uint32_t utteranceId,
                           const std::vector<float> &audioData,
                           bool isLive = true);
+  // Shares the segment's blocks with the engine instead of copying them
+  void startTranscription(uint32_t utteranceId,
+                          const ::audio::AudioSegment &segment,
+                          bool isLive = true);
 
   // Add more audio data to an ongoing transcription
   void addAudioData(uint32_t utteranceId, const std::vector<float> &audioData);
+  void addAudioData(uint32_t utteranceId, const ::audio::AudioSegment &segment);
 
   // Finalize transcription for an utterance
   void finalizeTranscription(uint32_t utteranceId);
@@ -4,10 +4,12 @@
 #include "stt/whisper_stt.hpp"
 #include "stt/stt_performance_tracker.hpp"
 #include "utils/performance_monitor.hpp"
+#include "utils/timer_service.hpp"
 #include <memory>
 #include <string>
 #include <vector>
 #include <map>
+#include <deque>
 #include <chrono>
 #include <atomic>
 #include <mutex>
@@ -140,6 +142,54 @@ struct HealthAlert {
         , acknowledged(false) {}
 };
 
+/**
+ * Pre-serialised health endpoint responses
+ *
+ * Built by the checker after every health check or alert change and
+ * published with an atomic pointer swap. A snapshot is never modified
+ * once published, so HTTP handlers serve its bytes without calling into
+ * the checker or taking any of its locks.
+ */
+struct HealthSnapshot {
+    struct Body {
+        std::string json;
+        std::string etag;   // Quoted, for ETag / If-None-Match
+    };
+    
+    uint64_t version = 0;
+    std::chrono::steady_clock::time_point published_at;
+    
+    // Summary of the last check
+    HealthStatus overall_status = HealthStatus::UNKNOWN;
+    std::string overall_message;
+    std::chrono::steady_clock::time_point timestamp;
+    double total_check_time_ms = 0.0;
+    bool can_accept_requests = false;
+    double system_load_factor = 0.0;
+    
+    Body detailed;   // /health/detailed
+    Body metrics;    // /health/metrics
+    Body alerts;     // /health/alerts
+    Body history;    // /health/history for DEFAULT_HISTORY_HOURS
+    
+    // Retained history entries, serialised once each and joined by ",\n",
+    // with the time and start offset of every entry
+    std::string history_entries;
+    std::vector<std::pair<std::chrono::steady_clock::time_point, size_t>> history_offsets;
+    uint64_t history_appended = 0;  // Entries ever added; with the count, identifies the content
+    
+    static constexpr int DEFAULT_HISTORY_HOURS = 24;
+    
+    /**
+     * /health/history body for entries within hours of publication
+     * @return The prebuilt body for DEFAULT_HISTORY_HOURS, otherwise one
+     *         assembled from the serialised entries
+     */
+    Body historyFor(int hours) const;
+    
+    static std::string makeETag(const std::string& body);
+};
+
 /**
  * STT Health Checker - Comprehensive health monitoring for STT system
  * 
@@ -307,8 +357,15 @@ public:
      */
     std::string exportHealthStatusJSON(bool includeHistory = false);
     
+    /**
+     * Latest published snapshot of the health endpoint responses
+     * Lock-free for readers; never null after initialize()
+     */
+    std::shared_ptr<const HealthSnapshot> getSnapshot() const { return std::atomic_load(&snapshot_); }
+    
     /**
      * Check if system is healthy enough for new requests
+     * Combines instance health with the admission controller's capacity check
      * @return true if system can handle new requests
      */
     bool canAcceptNewRequests();
@@ -353,17 +410,24 @@ private:
     std::map<std::string, std::shared_ptr<STTInterface>> registered_instances_;
     std::map<std::string, ComponentHealth> instance_health_;
     
-    // Health monitoring threads
-    std::unique_ptr<std::thread> health_monitor_thread_;
-    std::unique_ptr<std::thread> resource_monitor_thread_;
-    std::atomic<bool> should_stop_monitoring_{false};
+    // Health monitoring timers
+    speechrnt::utils::TimerService::TimerId health_check_timer_ = speechrnt::utils::TimerService::INVALID_TIMER;
+    speechrnt::utils::TimerService::TimerId detailed_check_timer_ = speechrnt::utils::TimerService::INVALID_TIMER;
+    speechrnt::utils::TimerService::TimerId resource_check_timer_ = speechrnt::utils::TimerService::INVALID_TIMER;
     
     // Health status tracking
     std::mutex health_mutex_;
     SystemHealthStatus current_health_;
     std::vector<SystemHealthStatus> health_history_;
+    std::deque<std::pair<std::chrono::steady_clock::time_point, std::string>> history_fragments_;
+    uint64_t history_appended_ = 0;
     std::chrono::steady_clock::time_point last_health_check_;
     
+    // Published responses; publish_mutex_ only orders publishers
+    std::shared_ptr<const HealthSnapshot> snapshot_;
+    std::mutex publish_mutex_;
+    uint64_t snapshot_version_ = 0;
+    
     // Alert management
     std::mutex alerts_mutex_;
     std::vector<HealthAlert> active_alerts_;
@@ -383,8 +447,8 @@ private:
     std::atomic<uint64_t> total_health_changes_{0};
     
     // Private methods
-    void healthMonitorLoop();
-    void resourceMonitorLoop();
+    void runScheduledHealthCheck(bool detailed);
+    void runScheduledResourceCheck();
     void performHealthCheck(bool detailed);
     void updateHealthHistory(const SystemHealthStatus& status);
     void checkForHealthChanges(const SystemHealthStatus& newStatus);
@@ -405,6 +469,7 @@ private:
     
     // Load balancing helpers
     double calculateInstanceLoad(const std::string& instanceId);
+    double calculateLoad(const ComponentHealth& health) const;
     std::string selectLeastLoadedInstance();
     bool isInstanceHealthy(const ComponentHealth& health);
     
@@ -414,6 +479,10 @@ private:
     std::string generateAlertId();
     double calculateElapsedMs(const std::chrono::steady_clock::time_point& start);
     std::string formatHealthStatusJSON(const SystemHealthStatus& status);
+    std::string formatHistoryEntryJSON(const SystemHealthStatus& status);
+    std::string formatMetricsJSON();
+    std::string formatAlertsJSON(const std::vector<HealthAlert>& alerts);
+    void publishSnapshot();
 };
 
 /**
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "stt/stt_interface.hpp"
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace stt {
+
+/**
+ * Reuse of whisper work across passes over the same utterance audio
+ *
+ * The final pass, candidate generation and repeated candidate requests all
+ * see the same samples. Entries are keyed by an audio fingerprint and keep
+ * the final result and the generated candidates; the greedy candidate is the
+ * final result itself. The context's whisper state holds the encoder output
+ * of the last encode, and the cache records which audio that was so
+ * alternative candidates rerun only the decoder.
+ *
+ * Not thread-safe: guarded by the owning WhisperSTT's inference mutex, which
+ * also serializes every use of the whisper state.
+ */
+class WhisperEncoderCache {
+public:
+    struct Fingerprint {
+        size_t samples = 0;
+        uint64_t hash = 0;
+
+        bool operator==(const Fingerprint& other) const {
+            return samples == other.samples && hash == other.hash;
+        }
+        bool operator!=(const Fingerprint& other) const { return !(*this == other); }
+    };
+
+    struct Stats {
+        uint64_t encodes = 0;          // Mel + encoder passes run for candidates
+        uint64_t encoderReuses = 0;    // Candidate decodes that skipped the encoder
+        uint64_t finalReuses = 0;      // Greedy candidates taken from the final pass
+        uint64_t candidateHits = 0;    // Candidate requests answered entirely from cache
+    };
+
+    static Fingerprint fingerprint(const std::vector<float>& audio);
+
+    explicit WhisperEncoderCache(size_t capacity = 4);
+
+    void storeFinal(const Fingerprint& audio, const TranscriptionResult& result);
+    bool findFinal(const Fingerprint& audio, TranscriptionResult& result);
+
+    void storeCandidates(const Fingerprint& audio, int maxCandidates,
+                         const std::vector<TranscriptionResult>& candidates);
+    bool findCandidates(const Fingerprint& audio, int maxCandidates,
+                        std::vector<TranscriptionResult>& candidates);
+
+    /**
+     * The whisper state now holds the encoder output for this audio, decoded
+     * as the given language
+     */
+    void markEncoded(const Fingerprint& audio, const std::string& language);
+    bool isEncoded(const Fingerprint& audio) const;
+    const std::string& getEncodedLanguage() const { return encodedLanguage_; }
+
+    /**
+     * Another pass overwrote the whisper state
+     */
+    void invalidateEncoder() { encodedValid_ = false; }
+
+    void recordEncoderReuse() { stats_.encoderReuses++; }
+    void recordFinalReuse() { stats_.finalReuses++; }
+
+    void clear();
+    size_t size() const { return entries_.size(); }
+    const Stats& getStats() const { return stats_; }
+
+private:
+    struct Entry {
+        Fingerprint audio;
+        bool hasFinal = false;
+        TranscriptionResult final;
+        int maxCandidates = 0;     // 0 = no candidates cached
+        std::vector<TranscriptionResult> candidates;
+    };
+
+    // Most recently used first
+    Entry& touch(const Fingerprint& audio);
+    Entry* find(const Fingerprint& audio);
+
+    size_t capacity_;
+    std::list<Entry> entries_;
+    Fingerprint encoded_;
+    std::string encodedLanguage_;
+    bool encodedValid_ = false;
+    Stats stats_;
+};
+
+} // namespace stt
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "stt/stt_interface.hpp"
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef WHISPER_AVAILABLE
+struct whisper_context;
+struct whisper_state;
+#else
+#include "whisper.h"
+#endif
+
+namespace stt {
+
+/**
+ * One whisper model shared by several decoding states. Weights are loaded once
+ * and each state carries its own KV cache and mel buffers, so independent
+ * audio segments can be decoded in parallel. A slot must be used by one thread
+ * at a time; callers normally dedicate one worker thread per slot.
+ */
+class WhisperStatePool {
+public:
+    WhisperStatePool();
+    ~WhisperStatePool();
+
+    WhisperStatePool(const WhisperStatePool&) = delete;
+    WhisperStatePool& operator=(const WhisperStatePool&) = delete;
+
+    /**
+     * Load the model and create the decoding states
+     * @param modelPath Path to the ggml model file
+     * @param stateCount Number of parallel decoding slots
+     * @param threadsPerState CPU threads used by each decode
+     * @param useGPU Offload the shared model to the GPU when supported
+     */
+    bool initialize(const std::string& modelPath, size_t stateCount, int threadsPerState = 1,
+                    bool useGPU = false);
+
+    /**
+     * Transcribe 16 kHz mono audio on one slot, producing one result per
+     * decoded whisper segment. Timings are relative to the start of the audio.
+     */
+    bool transcribe(size_t slot, const std::vector<float>& audio, const std::string& language,
+                    bool wordTimings, std::vector<TranscriptionResult>& segments);
+
+    void shutdown();
+
+    size_t size() const { return states_.size(); }
+    int getThreadsPerState() const { return threadsPerState_; }
+    bool isInitialized() const { return ctx_ != nullptr && !states_.empty(); }
+    std::string getLastError() const;
+
+private:
+    whisper_context* ctx_;
+    std::vector<whisper_state*> states_;
+    int threadsPerState_;
+
+    mutable std::mutex errorMutex_;
+    std::string lastError_;
+
+    void setError(const std::string& error);
+};
+
+} // namespace stt
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "audio/audio_segment.hpp"
 #include "stt/stt_interface.hpp"
 #include "stt/quantization_config.hpp"
 #include "stt/stt_performance_tracker.hpp"
+#include "stt/whisper_encoder_cache.hpp"
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -53,6 +55,7 @@ public:
     // Streaming transcription capabilities
     void startStreamingTranscription(uint32_t utteranceId);
     void addAudioChunk(uint32_t utteranceId, const std::vector<float>& audio);
+    void addAudioChunk(uint32_t utteranceId, const ::audio::AudioSegment& audio);
     void finalizeStreamingTranscription(uint32_t utteranceId);
     
     // Streaming configuration
@@ -83,6 +86,7 @@ public:
     // Translation pipeline integration
     void setTranscriptionCompleteCallback(TranscriptionCompleteCallback callback);
     void generateTranscriptionCandidates(const std::vector<float>& audioData, std::vector<TranscriptionResult>& candidates, int maxCandidates = 3);
+    WhisperEncoderCache::Stats getEncoderCacheStats() const;
     
     // Quantization support
     void setQuantizationLevel(QuantizationLevel level);
@@ -97,7 +101,7 @@ private:
     struct StreamingState {
         uint32_t utteranceId;
         TranscriptionCallback callback;
-        std::vector<float> accumulatedAudio;
+        ::audio::AudioSegmentBuilder accumulatedAudio;
         std::string lastTranscriptionText;
         bool isActive;
         std::chrono::steady_clock::time_point startTime;
@@ -170,6 +174,9 @@ private:
     // Performance tracking
     std::unique_ptr<STTPerformanceTracker> performanceTracker_;
     
+    // Final results, candidates and encoder state per utterance audio; guarded by mutex_
+    WhisperEncoderCache encoderCache_;
+    
     // Helper methods
     bool setupWhisperParams();
     bool validateModel();
@@ -215,6 +222,13 @@ private:
     // Translation pipeline integration helper methods
     void triggerTranslationPipeline(uint32_t utteranceId, const TranscriptionResult& result, const std::vector<TranscriptionResult>& candidates);
     void generateMultipleCandidates(const std::vector<float>& audioData, std::vector<TranscriptionResult>& candidates, int maxCandidates);
+    
+    // Candidate generation on a single encoder pass
+#ifdef WHISPER_AVAILABLE
+    bool encodeForCandidates(const std::vector<float>& audioData, const WhisperEncoderCache::Fingerprint& audio, std::string& language);
+    bool decodeCandidate(const std::string& language, float temperature, uint32_t seed, TranscriptionResult& candidate);
+    bool runCandidateFullPass(const std::vector<float>& audioData, float temperature, TranscriptionResult& candidate);
+#endif
 };
 
 } // namespace stt
\ No newline at end of file
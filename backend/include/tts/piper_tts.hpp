@@ -23,6 +23,8 @@ public:
     SynthesisResult synthesize(const std::string& text, const std::string& voiceId = "") override;
     std::future<SynthesisResult> synthesizeAsync(const std::string& text, const std::string& voiceId = "") override;
     void synthesizeWithCallback(const std::string& text, SynthesisCallback callback, const std::string& voiceId = "") override;
+    std::shared_ptr<StreamingSynthesis> synthesizeStreaming(const std::string& text, SynthesisUnitCallback callback,
+                                                            const std::string& voiceId = "") override;
     
     std::vector<VoiceInfo> getAvailableVoices() const override;
     std::vector<VoiceInfo> getVoicesForLanguage(const std::string& language) const override;
@@ -34,7 +36,29 @@ public:
     std::string getLastError() const override { return last_error_; }
     void cleanup() override;
     
+    /**
+     * Number of units synthesized ahead of the one being delivered while
+     * streaming (0 synthesizes strictly one unit at a time)
+     */
+    void setStreamingLookahead(size_t units);
+    
+    /**
+     * Split text into sentence units for streaming synthesis. Long sentences
+     * are broken at clause punctuation, or at a word boundary once they exceed
+     * maxUnitChars bytes.
+     */
+    static std::vector<std::string> splitIntoUnits(const std::string& text, size_t maxUnitChars = 160);
+    
 private:
+    // Everything one piper invocation needs, copied out under the lock so
+    // synthesis itself runs unlocked
+    struct SynthesisCommand {
+        std::string binaryPath;
+        std::string modelFile;
+        float speed;
+    };
+    
+
     bool initialized_;
     std::string model_dir_;
     std::string piper_binary_path_;
@@ -48,6 +72,7 @@ private:
     // Synthesis parameters
     float speed_;
     float volume_;
+    size_t streaming_lookahead_;
     
     // Thread safety
     mutable std::mutex mutex_;
@@ -58,7 +83,10 @@ private:
     VoiceInfo createVoiceInfo(const std::string& voiceId, const std::string& name, 
                              const std::string& language, const std::string& gender,
                              const std::string& modelFile);
-    SynthesisResult performSynthesis(const std::string& text, const std::string& voiceId);
+    bool prepareSynthesis(const std::string& voiceId, std::string& voice, SynthesisCommand& command,
+                          std::string& error) const;
+    static SynthesisResult performSynthesis(const SynthesisCommand& command, const std::string& text,
+                                            const std::string& voiceId);
     void setError(const std::string& error);
 };
 
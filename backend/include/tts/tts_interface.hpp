@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -39,6 +43,79 @@ struct VoiceInfo {
   VoiceInfo() : isAvailable(false) {}
 };
 
+/**
+ * Handle to an in-flight streaming synthesis. Shared between the engine, which
+ * delivers units and marks completion, and the caller, which may cancel.
+ */
+class StreamingSynthesis {
+public:
+  StreamingSynthesis()
+      : cancelled_(false), done_(false), unitsDelivered_(0),
+        startTime_(std::chrono::steady_clock::now()),
+        timeToFirstAudioMs_(-1.0) {}
+
+  /**
+   * Stop delivering units; a unit already being delivered completes
+   */
+  void cancel() { cancelled_ = true; }
+  bool isCancelled() const { return cancelled_; }
+
+  bool isDone() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return done_;
+  }
+
+  /**
+   * Block until the engine has finished or abandoned the synthesis
+   * @return false on timeout
+   */
+  bool wait(std::chrono::milliseconds timeout = std::chrono::milliseconds::max()) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (timeout == std::chrono::milliseconds::max()) {
+      cv_.wait(lock, [this] { return done_; });
+      return true;
+    }
+    return cv_.wait_for(lock, timeout, [this] { return done_; });
+  }
+
+  /**
+   * Milliseconds from the request to the first delivered unit, -1 if none yet
+   */
+  double getTimeToFirstAudioMs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return timeToFirstAudioMs_;
+  }
+
+  size_t getUnitsDelivered() const { return unitsDelivered_; }
+
+  // Engine side
+  void markUnitDelivered() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (unitsDelivered_++ == 0) {
+      timeToFirstAudioMs_ = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - startTime_)
+                                .count();
+    }
+  }
+
+  void markDone() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      done_ = true;
+    }
+    cv_.notify_all();
+  }
+
+private:
+  std::atomic<bool> cancelled_;
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  bool done_;
+  std::atomic<size_t> unitsDelivered_;
+  std::chrono::steady_clock::time_point startTime_;
+  double timeToFirstAudioMs_;
+};
+
 /**
  * Abstract interface for Text-to-Speech engines
  */
@@ -46,6 +123,13 @@ class TTSInterface {
 public:
   using SynthesisCallback = std::function<void(const SynthesisResult &result)>;
 
+  /**
+   * Receives one synthesized sentence/clause unit. Units arrive in text order;
+   * a failed unit carries success == false and ends the stream.
+   */
+  using SynthesisUnitCallback = std::function<void(
+      const SynthesisResult &unit, size_t unitIndex, bool isLastUnit)>;
+
   virtual ~TTSInterface() = default;
 
   /**
@@ -85,6 +169,29 @@ public:
                                       SynthesisCallback callback,
                                       const std::string &voiceId = "") = 0;
 
+  /**
+   * Synthesize speech incrementally, delivering audio unit by unit so playback
+   * can start before the whole text is synthesized. Engines without
+   * incremental synthesis deliver the whole text as a single unit before
+   * returning.
+   * @param text Text to synthesize
+   * @param callback Callback invoked for each unit, in order
+   * @param voiceId Voice ID to use (empty for default)
+   * @return Handle used to cancel the synthesis or wait for it
+   */
+  virtual std::shared_ptr<StreamingSynthesis>
+  synthesizeStreaming(const std::string &text, SynthesisUnitCallback callback,
+                      const std::string &voiceId = "") {
+    auto handle = std::make_shared<StreamingSynthesis>();
+    SynthesisResult result = synthesize(text, voiceId);
+    if (!handle->isCancelled()) {
+      handle->markUnitDelivered();
+      callback(result, 0, true);
+    }
+    handle->markDone();
+    return handle;
+  }
+
   /**
    * Get list of available voices
    * @return Vector of voice information
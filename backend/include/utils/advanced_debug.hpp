@@ -11,6 +11,10 @@
 #include <fstream>
 #include <sstream>
 
+namespace audio {
+class FrameFeatures;
+}
+
 namespace speechrnt {
 namespace utils {
 
@@ -333,11 +337,8 @@ private:
     std::string generateSessionId();
     void writeToFile(const std::string& message);
     void notifyCallbacks(const std::string& component, DebugLevel level, const std::string& message);
-    double calculateRMS(const std::vector<float>& audioData);
-    double calculatePeak(const std::vector<float>& audioData);
-    double calculateZeroCrossingRate(const std::vector<float>& audioData);
-    std::vector<double> calculateMFCC(const std::vector<float>& audioData, int sampleRate);
-    std::vector<double> calculateFFT(const std::vector<float>& audioData);
+    std::vector<double> calculateMFCC(audio::FrameFeatures& frame);
+    std::vector<double> calculateFFT(audio::FrameFeatures& frame);
     
     // Member variables
     std::atomic<bool> initialized_{false};
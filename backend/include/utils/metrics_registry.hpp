@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace speechrnt {
+namespace utils {
+
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * Monotonic counter
+ */
+class Counter {
+public:
+    void inc(uint64_t amount = 1) { value_.fetch_add(amount, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+/**
+ * Value that can go up and down
+ */
+class Gauge {
+public:
+    void set(double value) { value_.store(value, std::memory_order_relaxed); }
+    void add(double amount);
+    void sub(double amount) { add(-amount); }
+    double value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<double> value_{0.0};
+};
+
+/**
+ * Fixed-bucket histogram
+ *
+ * observe() is a bucket search over the bounds and two relaxed atomic
+ * updates, so recording threads never wait on each other or on a scrape.
+ * The bounds are fixed at registration, which keeps exposition cost
+ * independent of how many values were observed.
+ */
+class Histogram {
+public:
+    explicit Histogram(std::vector<double> bounds);
+
+    void observe(double value);
+
+    const std::vector<double>& bounds() const { return bounds_; }
+    // Non-cumulative count of bucket i; index bounds().size() is +Inf
+    uint64_t bucketCount(size_t index) const {
+        return buckets_[index].load(std::memory_order_relaxed);
+    }
+    uint64_t count() const;
+    double sum() const { return sum_.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<double> bounds_;
+    std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+    std::atomic<double> sum_{0.0};
+};
+
+/**
+ * Process-wide registry of pre-aggregated metrics, exposed in OpenMetrics
+ * text format for Prometheus scrapes
+ *
+ * Metrics are registered by name and label set and live as long as the
+ * process. Callers keep the returned reference, typically in a function
+ * local static, so recording never touches the registry. Registration
+ * appends to lock-free lists that exposition walks without a lock: a
+ * scrape never blocks a recording thread, and vice versa. Looking up an
+ * existing series (e.g. a per-model label) is also lock-free.
+ */
+class MetricsRegistry {
+public:
+    static constexpr const char* CONTENT_TYPE =
+        "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+    static MetricsRegistry& getInstance();
+
+    /**
+     * Get or register a series
+     * @param name Family name; counters take no "_total" suffix
+     * @param help Description, used when the family is first registered
+     * @param labels Label names and values identifying the series
+     * @throws std::logic_error if the name is registered with another type
+     */
+    Counter& counter(const std::string& name, const std::string& help,
+                     const MetricLabels& labels = {});
+    Gauge& gauge(const std::string& name, const std::string& help,
+                 const MetricLabels& labels = {});
+    Histogram& histogram(const std::string& name, const std::string& help,
+                         const std::vector<double>& bounds,
+                         const MetricLabels& labels = {});
+
+    /**
+     * Render every registered series
+     * @param out Replaced with the exposition, ending in "# EOF"
+     */
+    void exposeOpenMetrics(std::string& out) const;
+    std::string exposeOpenMetrics() const;
+
+    /**
+     * Latency bounds in seconds, 0.5 ms to 30 s
+     */
+    static const std::vector<double>& latencyBuckets();
+
+    MetricsRegistry() = default;
+    ~MetricsRegistry();
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+private:
+    enum class Type { COUNTER, GAUGE, HISTOGRAM };
+    struct Series;
+    struct Family;
+
+    Series& series(Type type, const std::string& name, const std::string& help,
+                   const MetricLabels& labels, const std::vector<double>* bounds);
+    Family* findFamily(const std::string& name) const;
+    static Series* findSeries(const Family& family, const std::string& labels);
+    static std::string renderLabels(const MetricLabels& labels);
+
+    // Families and their series are only ever appended, under
+    // registrationMutex_; readers follow the atomic links without it
+    std::atomic<Family*> head_{nullptr};
+    Family* tail_ = nullptr;
+    std::mutex registrationMutex_;
+    mutable std::atomic<size_t> lastExpositionSize_{0};
+};
+
+} // namespace utils
+} // namespace speechrnt
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace speechrnt {
+namespace utils {
+
+/**
+ * Unbounded lock-free multi-producer single-consumer queue
+ *
+ * Producers link a node with a single atomic exchange and never wait on each
+ * other or on the consumer (Vyukov's intrusive MPSC design with a stub node).
+ * A push is visible to the consumer once it returns; a push still in progress
+ * can hide later ones for that instant, so consumers that sleep between
+ * drains must be woken after the push completes, not before.
+ */
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head_(new Node()), tail_(head_.load(std::memory_order_relaxed)) {}
+
+    ~MpscQueue() {
+        T discard;
+        while (pop(discard)) {
+        }
+        delete tail_;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * Append a value; safe from any thread
+     */
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * Remove the oldest value; consumer thread only
+     * @return false if the queue is empty
+     */
+    bool pop(T& value) {
+        Node* next = tail_->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        // The old tail is the stub or an already consumed node; next becomes the new stub
+        value = std::move(next->value);
+        delete tail_;
+        tail_ = next;
+        return true;
+    }
+
+    /**
+     * Whether the consumer would find nothing to pop; consumer thread only
+     */
+    bool empty() const {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        Node() : next(nullptr) {}
+        explicit Node(T v) : next(nullptr), value(std::move(v)) {}
+
+        std::atomic<Node*> next;
+        T value;
+    };
+
+    alignas(64) std::atomic<Node*> head_;   // Producers
+    alignas(64) Node* tail_;                // Consumer
+};
+
+} // namespace utils
+} // namespace speechrnt
@@ -8,10 +8,13 @@
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include "utils/timer_service.hpp"
 
 namespace speechrnt {
 namespace utils {
 
+class Histogram;
+
 /**
  * Performance metric data point
  */
@@ -295,6 +298,7 @@ private:
     MetricStats calculateStats(const std::vector<MetricDataPoint>& points) const;
     std::vector<MetricDataPoint> filterByTimeWindow(const std::vector<MetricDataPoint>& points, 
                                                    int windowMinutes) const;
+    static Histogram* pipelineStageHistogram(const std::string& metricName);
     
     // Member variables
     std::atomic<bool> initialized_{false};
@@ -307,7 +311,7 @@ private:
     std::map<std::string, std::vector<MetricDataPoint>> metrics_;
     
     // System metrics collection
-    std::unique_ptr<std::thread> systemMetricsThread_;
+    TimerService::TimerId systemMetricsTimer_ = TimerService::INVALID_TIMER;
     std::atomic<bool> systemMetricsRunning_{false};
     int collectionIntervalMs_;
     
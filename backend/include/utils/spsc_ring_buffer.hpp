@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace speechrnt {
+namespace utils {
+
+/**
+ * Bounded lock-free single-producer single-consumer ring of plain values
+ *
+ * Blocks go in and out with at most two memcpy calls, one per side of the
+ * wrap, and one release store publishes a whole block. Each side caches the
+ * other's index and rereads it only when the cached value says the ring is
+ * full or empty. Capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SpscRingBuffer {
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRingBuffer copies values with memcpy");
+
+public:
+    explicit SpscRingBuffer(size_t capacity)
+        : capacity_(roundUpToPowerOfTwo(std::max<size_t>(capacity, 2))),
+          mask_(capacity_ - 1),
+          buffer_(new T[capacity_]()) {}
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    /**
+     * Append up to count values; producer thread only
+     * @return number of values written, less than count if the ring filled
+     */
+    size_t push(const T* items, size_t count) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (capacity_ - (head - cachedTail_) < count) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+        }
+        count = std::min(count, capacity_ - (head - cachedTail_));
+        if (count == 0) {
+            return 0;
+        }
+
+        size_t offset = head & mask_;
+        size_t first = std::min(count, capacity_ - offset);
+        std::memcpy(buffer_.get() + offset, items, first * sizeof(T));
+        std::memcpy(buffer_.get(), items + first, (count - first) * sizeof(T));
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    bool push(const T& item) { return push(&item, 1) == 1; }
+
+    /**
+     * Remove up to count of the oldest values; consumer thread only
+     * @return number of values read
+     */
+    size_t pop(T* out, size_t count) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (cachedHead_ - tail < count) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+        }
+        count = std::min(count, cachedHead_ - tail);
+        if (count == 0) {
+            return 0;
+        }
+
+        size_t offset = tail & mask_;
+        size_t first = std::min(count, capacity_ - offset);
+        std::memcpy(out, buffer_.get() + offset, first * sizeof(T));
+        std::memcpy(out + first, buffer_.get(), (count - first) * sizeof(T));
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    bool pop(T& item) { return pop(&item, 1) == 1; }
+
+    /**
+     * Drop every value currently readable; consumer thread only
+     */
+    void clear() {
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        tail_.store(cachedHead_, std::memory_order_release);
+    }
+
+    // Exact from either side for the calling thread, a snapshot otherwise
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return capacity_; }
+
+private:
+    static size_t roundUpToPowerOfTwo(size_t n) {
+        size_t size = 1;
+        while (size < n) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<T[]> buffer_;
+
+    // Indices increase without wrapping; the slot is index & mask_
+    alignas(64) std::atomic<size_t> head_{0};   // Written by the producer
+    size_t cachedTail_ = 0;                     // Producer's view of tail_
+    alignas(64) std::atomic<size_t> tail_{0};   // Written by the consumer
+    size_t cachedHead_ = 0;                     // Consumer's view of head_
+};
+
+} // namespace utils
+} // namespace speechrnt
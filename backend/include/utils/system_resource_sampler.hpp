@@ -0,0 +1,124 @@
+#pragma once
+
+#include "utils/timer_service.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+namespace speechrnt {
+namespace utils {
+
+/**
+ * Point-in-time system and process resource usage
+ */
+struct SystemResourceSnapshot {
+    uint64_t sampleCount = 0;          // 0 until the first sample is taken
+    int64_t timestampMs = 0;           // steady_clock time of the sample
+
+    // CPU, as fractions 0.0 - 1.0; rates need two samples and read 0 before that
+    float cpuUsage = 0.0f;             // System wide
+    float processCpuUsage = 0.0f;      // This process, relative to all cores
+    float loadAverage1m = 0.0f;
+    uint32_t cpuCount = 0;
+
+    // Memory
+    uint64_t totalMemoryMB = 0;
+    uint64_t availableMemoryMB = 0;
+    uint64_t freeMemoryMB = 0;         // Excludes reclaimable page cache
+    float memoryUsage = 0.0f;          // (total - available) / total
+    uint64_t processRssMB = 0;
+    uint32_t processThreads = 0;
+
+    // Root filesystem
+    float diskUsage = 0.0f;
+
+    // Network, summed over non-loopback interfaces
+    uint64_t networkRxBytes = 0;
+    uint64_t networkTxBytes = 0;
+    double networkRxBytesPerSec = 0.0;
+    double networkTxBytesPerSec = 0.0;
+};
+
+/**
+ * Shared sampler of system resources
+ *
+ * Reads /proc once per tick on the shared TimerService and publishes the
+ * result through a seqlock, so any number of monitors can read the latest
+ * snapshot without locks or syscalls of their own.
+ */
+class SystemResourceSampler {
+public:
+    static SystemResourceSampler& getInstance();
+
+    SystemResourceSampler();
+    ~SystemResourceSampler();
+
+    SystemResourceSampler(const SystemResourceSampler&) = delete;
+    SystemResourceSampler& operator=(const SystemResourceSampler&) = delete;
+
+    /**
+     * Start periodic sampling if not already running
+     * A shorter interval than the current one takes over; longer ones are
+     * ignored so the most demanding consumer sets the rate.
+     * @param interval Sampling interval
+     */
+    void ensureStarted(std::chrono::milliseconds interval = std::chrono::milliseconds(1000));
+
+    /**
+     * Stop periodic sampling
+     */
+    void stop();
+
+    bool isRunning() const;
+
+    /**
+     * Latest published snapshot, read without taking a lock
+     * Takes a synchronous sample first if none has been taken yet.
+     */
+    SystemResourceSnapshot getSnapshot();
+
+    /**
+     * Take a sample now and publish it
+     */
+    SystemResourceSnapshot sampleNow();
+
+private:
+    static_assert(std::is_trivially_copyable<SystemResourceSnapshot>::value,
+                  "snapshot is published word by word");
+    static constexpr size_t SNAPSHOT_WORDS = (sizeof(SystemResourceSnapshot) + 7) / 8;
+
+    /**
+     * Counters kept between samples to turn totals into rates
+     */
+    struct CounterState {
+        uint64_t cpuTotal = 0;
+        uint64_t cpuIdle = 0;
+        uint64_t processTicks = 0;
+        uint64_t rxBytes = 0;
+        uint64_t txBytes = 0;
+        int64_t timestampMs = 0;
+        bool valid = false;
+    };
+
+    SystemResourceSnapshot collect();
+    void publish(const SystemResourceSnapshot& snapshot);
+    bool tryRead(SystemResourceSnapshot& snapshot) const;
+
+    // Seqlock: odd sequence while a write is in progress
+    std::atomic<uint64_t> sequence_;
+    std::array<std::atomic<uint64_t>, SNAPSHOT_WORDS> words_;
+
+    std::mutex sampleMutex_;           // Serializes writers only
+    CounterState counters_;
+    uint64_t sampleCount_;
+
+    mutable std::mutex controlMutex_;
+    TimerService::TimerId timerId_;
+    std::chrono::milliseconds interval_;
+};
+
+} // namespace utils
+} // namespace speechrnt
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace speechrnt {
+namespace utils {
+
+/**
+ * Shared scheduler for periodic background work
+ *
+ * Timers are kept in a hierarchical timer wheel (four levels of 64 slots,
+ * 10 ms ticks, covering about 46 hours before wrapping into the top level).
+ * One thread advances the wheel and sleeps until the earliest expiry, so an
+ * idle process with a dozen monitors wakes only when some monitor is due.
+ * A second thread runs the callbacks one at a time; callbacks should be
+ * short and hand heavy work to their own executor.
+ */
+class TimerService {
+public:
+    using TimerId = uint64_t;
+    using Callback = std::function<void()>;
+
+    static constexpr TimerId INVALID_TIMER = 0;
+
+    /**
+     * Timer service statistics
+     */
+    struct Stats {
+        size_t activeTimers = 0;
+        uint64_t wakeups = 0;          // Wheel thread wakeups
+        uint64_t ticksAdvanced = 0;    // Wheel ticks processed
+        uint64_t cascades = 0;         // Timers moved down a level
+        uint64_t callbacksRun = 0;
+        uint64_t missedRuns = 0;       // Periodic runs skipped because the previous run overran
+        double maxCallbackMs = 0.0;
+    };
+
+    static TimerService& getInstance();
+
+    explicit TimerService(std::chrono::milliseconds tick = std::chrono::milliseconds(10));
+    ~TimerService();
+
+    TimerService(const TimerService&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+
+    /**
+     * Run a callback every interval
+     * Runs never overlap; runs missed while a callback overran are skipped
+     * rather than queued up.
+     * @param name Timer name used in logs
+     * @param interval Period between runs (rounded up to whole ticks)
+     * @param callback Work to run on the timer thread
+     * @param runImmediately Run once right away instead of after the first interval
+     * @return Timer id for cancel(), or INVALID_TIMER after shutdown
+     */
+    TimerId schedulePeriodic(const std::string& name, std::chrono::milliseconds interval,
+                             Callback callback, bool runImmediately = false);
+
+    /**
+     * Run a callback once after a delay
+     */
+    TimerId scheduleOnce(const std::string& name, std::chrono::milliseconds delay, Callback callback);
+
+    /**
+     * Change the period of a periodic timer, effective from its next run
+     * @return true if the timer exists
+     */
+    bool reschedule(TimerId id, std::chrono::milliseconds interval);
+
+    /**
+     * Cancel a timer
+     * Blocks until a run in progress completes, unless called from the
+     * timer thread itself, so callers may free what the callback uses.
+     * @return true if the timer existed
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * Stop both threads and drop all timers
+     */
+    void shutdown();
+
+    size_t getTimerCount() const;
+    Stats getStats() const;
+    std::chrono::milliseconds getTickInterval() const { return tick_; }
+
+private:
+    struct Timer {
+        TimerId id = INVALID_TIMER;
+        std::string name;
+        Callback callback;
+        uint64_t expiryTick = 0;
+        uint64_t intervalTicks = 0;   // 0 for one-shot timers
+        bool active = true;           // Cleared on cancel; stale wheel entries are dropped lazily
+        bool armed = false;           // Sitting in a wheel slot
+        bool running = false;
+    };
+
+    using TimerPtr = std::shared_ptr<Timer>;
+
+    static constexpr int WHEEL_LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr size_t WHEEL_SLOTS = size_t(1) << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = WHEEL_SLOTS - 1;
+    static constexpr uint64_t NO_EXPIRY = UINT64_MAX;
+
+    TimerId addTimer(const std::string& name, std::chrono::milliseconds delay,
+                     std::chrono::milliseconds interval, Callback callback);
+    void ensureStarted();
+    void insertTimer(const TimerPtr& timer);
+    void cascade(int level, size_t slot);
+    void advanceTo(uint64_t tick);
+    uint64_t earliestExpiry() const;
+    uint64_t currentTick() const;
+    uint64_t toTicks(std::chrono::milliseconds duration) const;
+    void wheelLoop();
+    void workerLoop();
+
+    const std::chrono::milliseconds tick_;
+    const std::chrono::steady_clock::time_point epoch_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wheelCondition_;
+    std::condition_variable workerCondition_;
+    std::condition_variable idleCondition_;
+
+    std::vector<TimerPtr> wheel_[WHEEL_LEVELS][WHEEL_SLOTS];
+    uint64_t nextTick_;
+    uint64_t wakeTick_;
+    std::unordered_map<TimerId, TimerPtr> timers_;
+    std::deque<TimerPtr> due_;
+    TimerId nextId_;
+
+    std::thread wheelThread_;
+    std::thread workerThread_;
+    std::thread::id workerThreadId_;
+    bool started_;
+    bool stopping_;
+    Stats stats_;
+};
+
+} // namespace utils
+} // namespace speechrnt
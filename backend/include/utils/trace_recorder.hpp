@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace speechrnt {
+namespace utils {
+
+/**
+ * Identifies the traced utterance a span belongs to; trace_id 0 means the
+ * utterance was not sampled and its spans are dropped
+ */
+struct TraceContext {
+    uint64_t trace_id = 0;
+
+    bool sampled() const { return trace_id != 0; }
+};
+
+/**
+ * Per-utterance span tracing, exported as Chrome trace JSON
+ * (chrome://tracing, ui.perfetto.dev)
+ *
+ * Each thread records finished spans into its own fixed ring buffer, so
+ * recording takes no lock and old spans are overwritten rather than
+ * growing memory. Utterances are sampled when they start (one in N, or
+ * the next N after a trigger) and carry a TraceContext through the
+ * utterance store, pipeline operations and task queue; spans of
+ * unsampled utterances cost one thread-local read. While tracing is off
+ * a span is a single relaxed load and branch.
+ */
+class TraceRecorder {
+public:
+    static constexpr size_t RING_CAPACITY = 4096;
+    // Sampled utterances whose session/utterance labels are kept
+    static constexpr size_t MAX_LABELS = 16384;
+
+    static TraceRecorder& getInstance();
+
+    static bool isEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * Start recording
+     * @param sample_every Trace one utterance in sample_every; 0 traces
+     *        only utterances armed with traceNext()
+     */
+    void enable(uint32_t sample_every = 1);
+    void disable();
+
+    /**
+     * Trace the next count utterances regardless of sampling; enables
+     * recording if it was off
+     */
+    void traceNext(uint32_t count);
+
+    /**
+     * Sampling decision for a new utterance
+     * @return A sampled context, or an empty one
+     */
+    TraceContext beginUtterance(const std::string& session_id, uint32_t utterance_id);
+
+    // Context of the utterance the calling thread is working on
+    static TraceContext current();
+    static void setCurrent(const TraceContext& context);
+
+    /**
+     * Record a finished span; times are from now()
+     */
+    void record(const char* name, const TraceContext& context, int64_t start_ns, int64_t end_ns);
+
+    /**
+     * Record a span of the current context that ends now, for stages
+     * that only report their latency afterwards
+     */
+    static void recordElapsed(const char* name, double elapsed_ms) {
+        if (isEnabled()) {
+            getInstance().recordElapsedSlow(name, elapsed_ms);
+        }
+    }
+
+    // Monotonic nanoseconds since the recorder was created
+    static int64_t now();
+    static int64_t toTraceTime(std::chrono::steady_clock::time_point time_point);
+
+    /**
+     * Render the buffered spans as Chrome trace JSON; each sampled
+     * utterance also gets an async track spanning its first to last span
+     * @param out Replaced with the trace
+     */
+    void exportChromeTrace(std::string& out) const;
+    std::string exportChromeTrace() const;
+    bool dumpChromeTrace(const std::string& path) const;
+
+    /**
+     * Drop everything recorded so far
+     */
+    void clear();
+
+    uint64_t getSpansRecorded() const { return spans_recorded_.load(std::memory_order_relaxed); }
+    uint32_t getSampleEvery() const { return sample_every_.load(std::memory_order_relaxed); }
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+private:
+    struct ThreadBuffer;
+
+    struct UtteranceLabel {
+        std::string session_id;
+        uint32_t utterance_id;
+    };
+
+    TraceRecorder() = default;
+    ~TraceRecorder();
+
+    ThreadBuffer& threadBuffer();
+    void recordElapsedSlow(const char* name, double elapsed_ms);
+
+    inline static std::atomic<bool> enabled_{false};
+
+    std::atomic<uint32_t> sample_every_{0};
+    std::atomic<uint32_t> triggered_{0};
+    std::atomic<uint64_t> utterances_seen_{0};
+    std::atomic<uint64_t> next_trace_id_{1};
+    std::atomic<uint64_t> spans_recorded_{0};
+    // Spans ending before this are treated as cleared
+    std::atomic<int64_t> cleared_at_ns_{0};
+
+    // Registered once per thread and never removed, so export walks the
+    // list without a lock
+    std::atomic<ThreadBuffer*> buffers_{nullptr};
+    std::atomic<uint32_t> next_thread_index_{1};
+
+    mutable std::mutex labels_mutex_;
+    std::map<uint64_t, UtteranceLabel> labels_;
+};
+
+/**
+ * Times its scope as a span of the current (or given) utterance
+ */
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name) {
+        if (TraceRecorder::isEnabled()) {
+            begin(name, TraceRecorder::current());
+        }
+    }
+
+    TraceSpan(const char* name, const TraceContext& context) {
+        if (TraceRecorder::isEnabled()) {
+            begin(name, context);
+        }
+    }
+
+    ~TraceSpan() {
+        if (name_) {
+            TraceRecorder::getInstance().record(name_, context_, start_ns_, TraceRecorder::now());
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    void begin(const char* name, const TraceContext& context) {
+        if (context.sampled()) {
+            name_ = name;
+            context_ = context;
+            start_ns_ = TraceRecorder::now();
+        }
+    }
+
+    const char* name_ = nullptr;
+    TraceContext context_;
+    int64_t start_ns_ = 0;
+};
+
+/**
+ * Makes a context current on this thread for its scope
+ */
+class ScopedTraceContext {
+public:
+    explicit ScopedTraceContext(const TraceContext& context) {
+        if (TraceRecorder::isEnabled()) {
+            active_ = true;
+            previous_ = TraceRecorder::current();
+            TraceRecorder::setCurrent(context);
+        }
+    }
+
+    ~ScopedTraceContext() {
+        if (active_) {
+            TraceRecorder::setCurrent(previous_);
+        }
+    }
+
+    ScopedTraceContext(const ScopedTraceContext&) = delete;
+    ScopedTraceContext& operator=(const ScopedTraceContext&) = delete;
+
+private:
+    bool active_ = false;
+    TraceContext previous_;
+};
+
+} // namespace utils
+} // namespace speechrnt
@@ -10,19 +10,13 @@ namespace audio {
 AudioBufferManager::UtteranceBuffer::UtteranceBuffer()
     : startTime(std::chrono::steady_clock::now()),
       lastAccessTime(std::chrono::steady_clock::now()), maxSizeSamples(0),
-      writePosition(0), isActive(true), isCircular(true) {}
+      isActive(true), isCircular(true) {}
 
 AudioBufferManager::UtteranceBuffer::UtteranceBuffer(size_t maxSamples,
                                                      bool circular)
     : startTime(std::chrono::steady_clock::now()),
       lastAccessTime(std::chrono::steady_clock::now()),
-      maxSizeSamples(maxSamples), writePosition(0), isActive(true),
-      isCircular(circular) {
-
-  if (maxSamples > 0) {
-    audioData.reserve(maxSamples);
-  }
-}
+      maxSizeSamples(maxSamples), isActive(true), isCircular(circular) {}
 
 bool AudioBufferManager::UtteranceBuffer::addAudioData(
     const std::vector<float> &audio) {
@@ -32,93 +26,71 @@ bool AudioBufferManager::UtteranceBuffer::addAudioData(
 
   lastAccessTime = std::chrono::steady_clock::now();
 
-  if (!isCircular) {
+  size_t samplesToAdd = audio.size();
+  if (!isCircular && maxSizeSamples > 0) {
     // Linear buffer - append until max size
-    size_t availableSpace = maxSizeSamples - audioData.size();
-    size_t samplesToAdd = std::min(audio.size(), availableSpace);
+    samplesToAdd = std::min(samplesToAdd, maxSizeSamples - audioData.size());
+  }
 
-    audioData.insert(audioData.end(), audio.begin(),
-                     audio.begin() + samplesToAdd);
-    return samplesToAdd == audio.size();
+  // Packed into the buffer's blocks: many small chunks share a block
+  audioData.append(audio.data(), samplesToAdd);
+  if (isCircular && maxSizeSamples > 0) {
+    audioData.keepLast(maxSizeSamples);
   }
 
-  // Circular buffer implementation
-  if (maxSizeSamples == 0) {
-    // No size limit - just append
-    audioData.insert(audioData.end(), audio.begin(), audio.end());
+  return samplesToAdd == audio.size();
+}
+
+bool AudioBufferManager::UtteranceBuffer::addAudioData(
+    const AudioSegment &audio) {
+  if (audio.empty()) {
     return true;
   }
 
-  // Ensure buffer is sized to max capacity
-  if (audioData.size() < maxSizeSamples) {
-    audioData.resize(maxSizeSamples, 0.0f);
+  lastAccessTime = std::chrono::steady_clock::now();
+
+  if (!isCircular && maxSizeSamples > 0) {
+    // Linear buffer - append until max size
+    size_t samplesToAdd =
+        std::min(audio.size(), maxSizeSamples - audioData.size());
+    audioData.append(audio.slice(0, samplesToAdd));
+    return samplesToAdd == audio.size();
   }
 
-  // Write audio data in circular fashion
-  for (float sample : audio) {
-    audioData[writePosition] = sample;
-    writePosition = (writePosition + 1) % maxSizeSamples;
+  audioData.append(audio);
+  if (maxSizeSamples > 0) {
+    // Circular buffer - the oldest samples fall off the front
+    audioData.keepLast(maxSizeSamples);
   }
 
   return true;
 }
 
-std::vector<float> AudioBufferManager::UtteranceBuffer::getAudioData() const {
+AudioSegment AudioBufferManager::UtteranceBuffer::getSegment() const {
   lastAccessTime = std::chrono::steady_clock::now();
-
-  if (!isCircular || audioData.size() < maxSizeSamples) {
-    return audioData;
-  }
-
-  // For circular buffer, return data in correct order
-  std::vector<float> result;
-  result.reserve(audioData.size());
-
-  // Start from write position (oldest data) and wrap around
-  for (size_t i = 0; i < audioData.size(); ++i) {
-    size_t index = (writePosition + i) % audioData.size();
-    result.push_back(audioData[index]);
-  }
-
-  return result;
+  return audioData.snapshot();
 }
 
-std::vector<float> AudioBufferManager::UtteranceBuffer::getRecentAudioData(
+AudioSegment AudioBufferManager::UtteranceBuffer::getRecentSegment(
     size_t sampleCount) const {
   lastAccessTime = std::chrono::steady_clock::now();
-
   if (sampleCount == 0) {
     return {};
   }
+  return audioData.snapshot().tail(sampleCount);
+}
 
-  if (!isCircular || audioData.size() < maxSizeSamples) {
-    // Linear buffer - return last N samples
-    if (sampleCount >= audioData.size()) {
-      return audioData;
-    }
-    return std::vector<float>(audioData.end() - sampleCount, audioData.end());
-  }
-
-  // Circular buffer - return most recent samples
-  std::vector<float> result;
-  size_t samplesToGet = std::min(sampleCount, audioData.size());
-  result.reserve(samplesToGet);
-
-  // Start from the most recent position and go backwards
-  for (size_t i = 0; i < samplesToGet; ++i) {
-    size_t index =
-        (writePosition - 1 - i + audioData.size()) % audioData.size();
-    result.push_back(audioData[index]);
-  }
+std::vector<float> AudioBufferManager::UtteranceBuffer::getAudioData() const {
+  return getSegment().toVector();
+}
 
-  // Reverse to get chronological order
-  std::reverse(result.begin(), result.end());
-  return result;
+std::vector<float> AudioBufferManager::UtteranceBuffer::getRecentAudioData(
+    size_t sampleCount) const {
+  return getRecentSegment(sampleCount).toVector();
 }
 
 void AudioBufferManager::UtteranceBuffer::clear() {
   audioData.clear();
-  writePosition = 0;
   lastAccessTime = std::chrono::steady_clock::now();
 }
 
@@ -157,18 +129,19 @@ AudioBufferManager::AudioBufferManager(const BufferConfig &config)
 }
 
 AudioBufferManager::~AudioBufferManager() {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
   utteranceBuffers_.clear();
   speechrnt::utils::Logger::info("AudioBufferManager destroyed");
 }
 
-bool AudioBufferManager::addAudioData(uint32_t utteranceId,
-                                      const std::vector<float> &audio) {
+template <typename Audio>
+bool AudioBufferManager::addAudioDataInternal(uint32_t utteranceId,
+                                              const Audio &audio) {
   if (audio.empty()) {
     return true;
   }
 
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   auto it = utteranceBuffers_.find(utteranceId);
   if (it == utteranceBuffers_.end()) {
@@ -209,8 +182,27 @@ bool AudioBufferManager::addAudioData(uint32_t utteranceId,
   return success;
 }
 
+bool AudioBufferManager::addAudioData(uint32_t utteranceId,
+                                      const std::vector<float> &audio) {
+  return addAudioDataInternal(utteranceId, audio);
+}
+
+bool AudioBufferManager::addAudioData(uint32_t utteranceId,
+                                      const AudioSegment &audio) {
+  return addAudioDataInternal(utteranceId, audio);
+}
+
 std::vector<float> AudioBufferManager::getBufferedAudio(uint32_t utteranceId) {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  return getBufferedSegment(utteranceId).toVector();
+}
+
+std::vector<float> AudioBufferManager::getRecentAudio(uint32_t utteranceId,
+                                                      size_t sampleCount) {
+  return getRecentSegment(utteranceId, sampleCount).toVector();
+}
+
+AudioSegment AudioBufferManager::getBufferedSegment(uint32_t utteranceId) {
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   auto it = utteranceBuffers_.find(utteranceId);
   if (it == utteranceBuffers_.end()) {
@@ -219,12 +211,12 @@ std::vector<float> AudioBufferManager::getBufferedAudio(uint32_t utteranceId) {
     return {};
   }
 
-  return it->second->getAudioData();
+  return it->second->getSegment();
 }
 
-std::vector<float> AudioBufferManager::getRecentAudio(uint32_t utteranceId,
-                                                      size_t sampleCount) {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+AudioSegment AudioBufferManager::getRecentSegment(uint32_t utteranceId,
+                                                  size_t sampleCount) {
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   auto it = utteranceBuffers_.find(utteranceId);
   if (it == utteranceBuffers_.end()) {
@@ -233,17 +225,17 @@ std::vector<float> AudioBufferManager::getRecentAudio(uint32_t utteranceId,
     return {};
   }
 
-  return it->second->getRecentAudioData(sampleCount);
+  return it->second->getRecentSegment(sampleCount);
 }
 
 bool AudioBufferManager::hasUtterance(uint32_t utteranceId) const {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
   return utteranceBuffers_.find(utteranceId) != utteranceBuffers_.end();
 }
 
 bool AudioBufferManager::createUtterance(uint32_t utteranceId,
                                          size_t maxSizeMB) {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   // Check if utterance already exists
   if (utteranceBuffers_.find(utteranceId) != utteranceBuffers_.end()) {
@@ -284,7 +276,7 @@ bool AudioBufferManager::createUtterance(uint32_t utteranceId,
 }
 
 void AudioBufferManager::finalizeBuffer(uint32_t utteranceId) {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   auto it = utteranceBuffers_.find(utteranceId);
   if (it != utteranceBuffers_.end()) {
@@ -296,12 +288,12 @@ void AudioBufferManager::finalizeBuffer(uint32_t utteranceId) {
 }
 
 void AudioBufferManager::removeUtterance(uint32_t utteranceId) {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
   removeUtteranceInternal(utteranceId);
 }
 
 void AudioBufferManager::setUtteranceActive(uint32_t utteranceId, bool active) {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   auto it = utteranceBuffers_.find(utteranceId);
   if (it != utteranceBuffers_.end()) {
@@ -314,14 +306,14 @@ void AudioBufferManager::setUtteranceActive(uint32_t utteranceId, bool active) {
 }
 
 bool AudioBufferManager::isUtteranceActive(uint32_t utteranceId) const {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   auto it = utteranceBuffers_.find(utteranceId);
   return it != utteranceBuffers_.end() && it->second->isActive;
 }
 
 void AudioBufferManager::cleanupOldBuffers() {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   auto now = std::chrono::steady_clock::now();
   std::vector<uint32_t> toRemove;
@@ -352,7 +344,7 @@ void AudioBufferManager::cleanupOldBuffers() {
 }
 
 void AudioBufferManager::cleanupInactiveBuffers() {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   std::vector<uint32_t> toRemove;
 
@@ -375,7 +367,7 @@ void AudioBufferManager::cleanupInactiveBuffers() {
 }
 
 void AudioBufferManager::forceCleanup() {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   size_t initialCount = utteranceBuffers_.size();
   utteranceBuffers_.clear();
@@ -387,7 +379,7 @@ void AudioBufferManager::forceCleanup() {
 }
 
 size_t AudioBufferManager::getCurrentMemoryUsage() const {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   size_t totalBytes = 0;
   for (const auto &pair : utteranceBuffers_) {
@@ -398,18 +390,20 @@ size_t AudioBufferManager::getCurrentMemoryUsage() const {
 }
 
 size_t AudioBufferManager::getCurrentMemoryUsageMB() const {
-  return getCurrentMemoryUsage() / (1024 * 1024);
+  // Rounded up: buffers only hold the samples written, so a live utterance
+  // is usually well under a megabyte
+  return (getCurrentMemoryUsage() + 1024 * 1024 - 1) / (1024 * 1024);
 }
 
 void AudioBufferManager::updateConfig(const BufferConfig &config) {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   config_ = config;
   speechrnt::utils::Logger::info("AudioBufferManager configuration updated");
 }
 
 AudioBufferManager::BufferStatistics AudioBufferManager::getStatistics() const {
-  std::lock_guard<std::mutex> lock1(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock1(bufferMutex_);
   std::lock_guard<std::mutex> lock2(statsMutex_);
 
   BufferStatistics stats = stats_;
@@ -452,7 +446,7 @@ void AudioBufferManager::resetStatistics() {
 }
 
 std::vector<uint32_t> AudioBufferManager::getActiveUtterances() const {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
 
   std::vector<uint32_t> activeIds;
   for (const auto &pair : utteranceBuffers_) {
@@ -465,7 +459,7 @@ std::vector<uint32_t> AudioBufferManager::getActiveUtterances() const {
 }
 
 size_t AudioBufferManager::getUtteranceCount() const {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::recursive_mutex> lock(bufferMutex_);
   return utteranceBuffers_.size();
 }
 
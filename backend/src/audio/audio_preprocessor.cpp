@@ -458,11 +458,17 @@ std::vector<float> EchoCanceller::computeAutocorrelation(const std::vector<float
 // AudioPreprocessor implementation
 
 AudioPreprocessor::AudioPreprocessor(const AudioPreprocessingConfig& config, int sampleRate)
-    : config_(config), sampleRate_(sampleRate), bufferPosition_(0), realTimeInitialized_(false) {
+    : config_(config), sampleRate_(sampleRate), bufferPosition_(0), realTimeInitialized_(false),
+      graphBlockSize_(1024), noiseNode_(nullptr), dynamicsNode_(nullptr), echoNode_(nullptr) {
     
     initializeComponents();
     initializePresets();
     
+    {
+        std::lock_guard<std::mutex> lock(graphMutex_);
+        updateGraph(true);
+    }
+    
     // Initialize statistics
     stats_.totalSamplesProcessed = 0;
     stats_.totalChunksProcessed = 0;
@@ -537,12 +543,32 @@ void AudioPreprocessor::initializeRealTimeProcessing(size_t bufferSize) {
     bufferPosition_ = 0;
     realTimeInitialized_ = true;
     
+    {
+        std::lock_guard<std::mutex> lock(graphMutex_);
+        graphBlockSize_ = std::max<size_t>(1, bufferSize);
+        updateGraph(false);
+    }
+    
     if (adaptiveProcessor_) {
         adaptiveProcessor_->initializeRealTimeProcessing(bufferSize);
     }
 }
 
 std::vector<float> AudioPreprocessor::preprocessRealTimeChunk(const std::vector<float>& audioChunk) {
+    std::vector<float> processed = audioChunk;
+    preprocessRealTimeChunkInPlace(processed);
+    
+    if (config_.enableAdaptiveProcessing && adaptiveProcessor_ && !processed.empty()) {
+        processed = adaptiveProcessor_->processAudio(processed);
+    }
+    
+    return processed;
+}
+
+void AudioPreprocessor::preprocessRealTimeChunkInPlace(SampleSpan audioChunk) {
+    if (audioChunk.empty()) {
+        return;
+    }
     if (!realTimeInitialized_) {
         initializeRealTimeProcessing(audioChunk.size() * 4);
     }
@@ -553,8 +579,23 @@ std::vector<float> AudioPreprocessor::preprocessRealTimeChunk(const std::vector<
         bufferPosition_ = (bufferPosition_ + 1) % processingBuffer_.size();
     }
     
-    // Process the chunk
-    return preprocessAudioSimple(audioChunk);
+    // Every configured stage runs; quality gating belongs to the analyzed paths
+    {
+        std::lock_guard<std::mutex> lock(graphMutex_);
+        if (noiseNode_) noiseNode_->setBypassed(false);
+        if (dynamicsNode_) dynamicsNode_->setBypassed(false);
+        if (echoNode_) echoNode_->setBypassed(false);
+        graph_.process(audioChunk);
+    }
+    
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_.totalSamplesProcessed += audioChunk.size();
+    stats_.totalChunksProcessed++;
+}
+
+size_t AudioPreprocessor::getProcessingLatencySamples() const {
+    std::lock_guard<std::mutex> lock(graphMutex_);
+    return graph_.getLatencySamples();
 }
 
 void AudioPreprocessor::resetRealTimeState() {
@@ -576,6 +617,10 @@ void AudioPreprocessor::resetRealTimeState() {
     if (adaptiveProcessor_) {
         adaptiveProcessor_->resetRealTimeState();
     }
+    
+    std::lock_guard<std::mutex> lock(graphMutex_);
+    graph_.reset();
+    configureGraphNodes();
 }
 
 std::vector<float> AudioPreprocessor::applyNoiseReduction(const std::vector<float>& audioData) {
@@ -669,6 +714,9 @@ void AudioPreprocessor::setConfig(const AudioPreprocessingConfig& config) {
     if (adaptiveProcessor_) {
         adaptiveProcessor_->setProcessingParams(config.adaptiveParams);
     }
+    
+    std::lock_guard<std::mutex> graphLock(graphMutex_);
+    updateGraph(false);
 }
 
 AudioPreprocessingConfig AudioPreprocessor::getConfig() const {
@@ -686,6 +734,9 @@ void AudioPreprocessor::setSampleRate(int sampleRate) {
     if (adaptiveProcessor_) {
         adaptiveProcessor_->setSampleRate(sampleRate);
     }
+    
+    std::lock_guard<std::mutex> lock(graphMutex_);
+    updateGraph(false);
 }
 
 void AudioPreprocessor::enableAdaptiveMode(bool enabled) {
@@ -814,24 +865,31 @@ std::vector<float> AudioPreprocessor::applyProcessingPipeline(
         quality = qualityAnalyzer_->analyzeQuality(audioData, sampleRate_);
     }
     
-    // Apply noise reduction
-    if (shouldApplyNoiseReduction(quality)) {
-        processed = applyNoiseReduction(processed);
+    bool noiseReduction = shouldApplyNoiseReduction(quality);
+    bool volumeNormalization = shouldApplyVolumeNormalization(quality);
+    bool echoCancellation = shouldApplyEchoCancellation(quality);
+    
+    // Noise reduction, volume normalization and echo cancellation run in place in the graph
+    {
+        std::lock_guard<std::mutex> lock(graphMutex_);
+        if (noiseNode_) noiseNode_->setBypassed(!noiseReduction);
+        if (dynamicsNode_) dynamicsNode_->setBypassed(!volumeNormalization);
+        if (echoNode_) echoNode_->setBypassed(!echoCancellation);
+        graph_.process(processed);
+    }
+    
+    if (noiseReduction) {
         appliedFilters.push_back("noise_reduction");
         parameters["noise_reduction_strength"] = config_.noiseReduction.spectralSubtractionAlpha;
     }
     
-    // Apply volume normalization
-    if (shouldApplyVolumeNormalization(quality)) {
-        processed = applyVolumeNormalization(processed);
+    if (volumeNormalization) {
         appliedFilters.push_back("volume_normalization");
         parameters["target_rms"] = config_.volumeNormalization.targetRMS;
         parameters["compression_ratio"] = config_.volumeNormalization.compressionRatio;
     }
     
-    // Apply echo cancellation
-    if (shouldApplyEchoCancellation(quality)) {
-        processed = applyEchoCancellation(processed);
+    if (echoCancellation) {
         appliedFilters.push_back("echo_cancellation");
         parameters["echo_suppression_strength"] = config_.echoCancellation.echoSuppressionStrength;
     }
@@ -845,6 +903,101 @@ std::vector<float> AudioPreprocessor::applyProcessingPipeline(
     return processed;
 }
 
+bool AudioPreprocessor::GraphLayout::operator==(const GraphLayout& other) const {
+    return noiseReduction == other.noiseReduction && noiseMode == other.noiseMode &&
+           volumeNormalization == other.volumeNormalization &&
+           echoCancellation == other.echoCancellation && echoMode == other.echoMode &&
+           echoFilterLength == other.echoFilterLength && sampleRate == other.sampleRate &&
+           blockSize == other.blockSize;
+}
+
+AudioPreprocessor::GraphLayout AudioPreprocessor::describeGraphLayout() const {
+    GraphLayout layout;
+    layout.noiseReduction = config_.enableNoiseReduction;
+    layout.noiseMode = config_.noiseReduction.enableSpectralSubtraction ? 0
+                     : config_.noiseReduction.enableWienerFiltering ? 1 : 2;
+    layout.volumeNormalization = config_.enableVolumeNormalization;
+    layout.echoCancellation = config_.enableEchoCancellation;
+    layout.echoMode = config_.echoCancellation.enableLMS ? 0
+                    : config_.echoCancellation.enableNLMS ? 1 : 2;
+    layout.echoFilterLength = config_.echoCancellation.adaptiveFilterLength;
+    layout.sampleRate = sampleRate_;
+    layout.blockSize = graphBlockSize_;
+    return layout;
+}
+
+void AudioPreprocessor::updateGraph(bool forceRebuild) {
+    GraphLayout layout = describeGraphLayout();
+    if (!forceRebuild && graph_.isPrepared() && layout == graphLayout_) {
+        configureGraphNodes();
+        return;
+    }
+    
+    graph_.clear();
+    noiseNode_ = nullptr;
+    dynamicsNode_ = nullptr;
+    echoNode_ = nullptr;
+    
+    // Same stage order as the original vector pipeline
+    if (layout.noiseReduction) {
+        if (layout.noiseMode == 0) {
+            // 512-sample frames keep the added latency at 32 ms for 16 kHz input
+            noiseNode_ = graph_.addNode(std::make_unique<SpectralSubtractionNode>(512));
+        } else if (layout.noiseMode == 1) {
+            noiseNode_ = graph_.addNode(std::make_unique<WienerFilterNode>());
+        } else {
+            noiseNode_ = graph_.addNode(std::make_unique<NoiseGateNode>());
+        }
+    }
+    
+    if (layout.volumeNormalization) {
+        auto dynamics = std::make_unique<FusedDynamicsNode>();
+        dynamicsNode_ = dynamics.get();
+        graph_.addNode(std::move(dynamics));
+    }
+    
+    if (layout.echoCancellation) {
+        auto mode = layout.echoMode == 0 ? EchoCancellerNode::Mode::LMS
+                  : layout.echoMode == 1 ? EchoCancellerNode::Mode::NLMS
+                  : EchoCancellerNode::Mode::SUPPRESSION;
+        echoNode_ = graph_.addNode(std::make_unique<EchoCancellerNode>(mode, layout.echoFilterLength));
+    }
+    
+    graph_.prepare(sampleRate_, graphBlockSize_);
+    graphLayout_ = layout;
+    configureGraphNodes();
+}
+
+void AudioPreprocessor::configureGraphNodes() {
+    if (auto* spectral = dynamic_cast<SpectralSubtractionNode*>(noiseNode_)) {
+        spectral->setAlpha(config_.noiseReduction.spectralSubtractionAlpha);
+        if (noiseFilter_) {
+            spectral->setNoiseProfile(noiseFilter_->getNoiseProfile());
+        }
+    } else if (auto* wiener = dynamic_cast<WienerFilterNode*>(noiseNode_)) {
+        wiener->setSmoothingFactor(config_.noiseReduction.wienerFilterBeta);
+    } else if (auto* gate = dynamic_cast<NoiseGateNode*>(noiseNode_)) {
+        gate->setThresholdDb(config_.noiseReduction.noiseGateThreshold);
+    }
+    
+    if (dynamicsNode_) {
+        FusedDynamicsNode::Config dynamics = dynamicsNode_->getConfig();
+        dynamics.enableAGC = config_.volumeNormalization.enableAGC;
+        dynamics.enableCompression = config_.volumeNormalization.enableCompression;
+        dynamics.targetRMS = config_.volumeNormalization.targetRMS;
+        dynamics.compressionRatio = config_.volumeNormalization.compressionRatio;
+        dynamics.compressionThreshold = 0.7f;
+        dynamics.attackSeconds = config_.volumeNormalization.attackTime;
+        dynamics.releaseSeconds = config_.volumeNormalization.releaseTime;
+        dynamicsNode_->setConfig(dynamics);
+    }
+    
+    if (auto* echo = dynamic_cast<EchoCancellerNode*>(echoNode_)) {
+        echo->setConvergenceRate(config_.echoCancellation.convergenceRate);
+        echo->setSuppressionStrength(config_.echoCancellation.echoSuppressionStrength);
+    }
+}
+
 bool AudioPreprocessor::shouldApplyNoiseReduction(const AudioQualityMetrics& quality) {
     if (!config_.enableNoiseReduction) return false;
     
@@ -1,4 +1,5 @@
 #include "audio/audio_quality_analyzer.hpp"
+#include "audio/signal_statistics.hpp"
 #include <algorithm>
 #include <numeric>
 #include <cmath>
@@ -141,53 +142,23 @@ float AudioQualityAnalyzer::calculateSNR(const std::vector<float>& audioData) {
 }
 
 float AudioQualityAnalyzer::calculateZeroCrossingRate(const std::vector<float>& audioData) {
-    if (audioData.size() < 2) return 0.0f;
-    
-    size_t crossings = 0;
-    for (size_t i = 1; i < audioData.size(); ++i) {
-        if ((audioData[i-1] >= 0.0f && audioData[i] < 0.0f) ||
-            (audioData[i-1] < 0.0f && audioData[i] >= 0.0f)) {
-            crossings++;
-        }
-    }
-    
-    return static_cast<float>(crossings) / (audioData.size() - 1);
+    return SignalStatistics::compute(audioData).zeroCrossingRate();
 }
 
 std::vector<float> AudioQualityAnalyzer::calculateMFCC(const std::vector<float>& audioData, int sampleRate) {
-    std::vector<float> mfcc(config_.numMfccCoeffs, 0.0f);
-    
     if (audioData.size() < config_.fftSize) {
-        return mfcc;
+        return std::vector<float>(config_.numMfccCoeffs, 0.0f);
     }
     
     // Initialize mel filter bank if needed
-    if (melFilterBank_.empty()) {
+    if (!melTables_ || melTables_->getConfig().sampleRate != sampleRate ||
+        melTables_->getConfig().frameSize != config_.fftSize) {
         initializeMelFilterBank(sampleRate);
     }
     
-    // Compute power spectrum
-    SpectralAnalysis spectral = performSpectralAnalysis(audioData, sampleRate);
-    
-    // Apply mel filter bank
-    std::vector<float> melEnergies(config_.melFilterBankSize, 0.0f);
-    // Simplified mel filter bank application
-    for (size_t i = 0; i < melEnergies.size() && i < spectral.powerSpectrum.size(); ++i) {
-        melEnergies[i] = spectral.powerSpectrum[i];
-    }
-    
-    // Apply log and DCT to get MFCC coefficients
-    for (size_t i = 0; i < mfcc.size(); ++i) {
-        float sum = 0.0f;
-        for (size_t j = 0; j < melEnergies.size(); ++j) {
-            if (melEnergies[j] > 0.0f) {
-                sum += std::log(melEnergies[j]) * std::cos(M_PI * i * (j + 0.5f) / melEnergies.size());
-            }
-        }
-        mfcc[i] = sum;
-    }
-    
-    return mfcc;
+    // Mel filter bank, log and DCT over the first analysis frame
+    FrameFeatures frame(melTables_, audioData.data(), config_.fftSize);
+    return frame.mfcc();
 }
 
 AudioArtifacts::ClippingInfo AudioQualityAnalyzer::detectClipping(const std::vector<float>& audioData) {
@@ -464,11 +435,13 @@ void AudioQualityAnalyzer::initializeWindowFunction() {
 }
 
 void AudioQualityAnalyzer::initializeMelFilterBank(int sampleRate) {
-    melFilterBank_.resize(config_.melFilterBankSize);
-    // Simplified mel filter bank initialization
-    for (size_t i = 0; i < config_.melFilterBankSize; ++i) {
-        melFilterBank_[i] = 1.0f; // Placeholder - would implement proper mel scale
-    }
+    FrameAnalysisConfig frameConfig;
+    frameConfig.sampleRate = sampleRate;
+    frameConfig.frameSize = config_.fftSize;
+    frameConfig.hopSize = config_.hopSize;
+    frameConfig.melBands = static_cast<size_t>(config_.melFilterBankSize);
+    frameConfig.mfccCoefficients = config_.numMfccCoeffs;
+    melTables_ = FrameAnalysisTables::create(frameConfig);
 }
 
 std::vector<std::complex<float>> AudioQualityAnalyzer::computeFFT(const std::vector<float>& signal) {
@@ -0,0 +1,222 @@
+#include "audio/audio_segment.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace audio {
+
+namespace {
+
+std::atomic<uint64_t> g_ingestedSamples{0};
+std::atomic<uint64_t> g_materializedSamples{0};
+
+} // namespace
+
+// AudioBlockPool
+
+AudioBlockPool& AudioBlockPool::instance() {
+    // Never destroyed: segments held by other statics may outlive it
+    static AudioBlockPool* pool = new AudioBlockPool();
+    return *pool;
+}
+
+std::shared_ptr<float> AudioBlockPool::acquire() {
+    float* block = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+            block = free_.back();
+            free_.pop_back();
+        } else {
+            allocated_++;
+        }
+    }
+    if (!block) {
+        block = new float[BLOCK_SAMPLES];
+    }
+    return std::shared_ptr<float>(block, [this](float* released) { release(released); });
+}
+
+void AudioBlockPool::release(float* block) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.size() < maxPooled_) {
+            free_.push_back(block);
+            return;
+        }
+        allocated_--;
+    }
+    delete[] block;
+}
+
+size_t AudioBlockPool::getPooledBlocks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_.size();
+}
+
+size_t AudioBlockPool::getAllocatedBlocks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return allocated_;
+}
+
+// AudioSegment
+
+AudioSegment AudioSegment::copyOf(const float* samples, size_t count) {
+    AudioSegmentBuilder builder;
+    builder.append(samples, count);
+    return builder.release();
+}
+
+AudioSegment AudioSegment::slice(size_t begin, size_t count) const {
+    AudioSegment result;
+    if (begin >= size_) {
+        return result;
+    }
+    count = std::min(count, size_ - begin);
+
+    size_t position = 0;
+    for (const auto& chunk : chunks_) {
+        if (count == 0) {
+            break;
+        }
+        size_t chunkEnd = position + chunk.count;
+        if (chunkEnd > begin) {
+            size_t skip = begin > position ? begin - position : 0;
+            size_t take = std::min(chunk.count - skip, count);
+            result.appendChunk({chunk.block, chunk.offset + skip, take});
+            begin += take;
+            count -= take;
+        }
+        position = chunkEnd;
+    }
+    return result;
+}
+
+AudioSegment AudioSegment::tail(size_t count) const {
+    return count >= size_ ? *this : slice(size_ - count, count);
+}
+
+void AudioSegment::append(const AudioSegment& other) {
+    chunks_.reserve(chunks_.size() + other.chunks_.size());
+    for (const auto& chunk : other.chunks_) {
+        appendChunk(chunk);
+    }
+}
+
+void AudioSegment::appendChunk(const Chunk& chunk) {
+    if (chunk.count == 0) {
+        return;
+    }
+    // Adjacent views of one block merge, so a segment re-joined from its
+    // slices keeps as few chunks as it started with
+    if (!chunks_.empty()) {
+        Chunk& last = chunks_.back();
+        if (last.block == chunk.block && last.offset + last.count == chunk.offset) {
+            last.count += chunk.count;
+            size_ += chunk.count;
+            return;
+        }
+    }
+    chunks_.push_back(chunk);
+    size_ += chunk.count;
+}
+
+const float* AudioSegment::contiguousData() const {
+    return chunks_.size() == 1 ? chunks_.front().data() : nullptr;
+}
+
+void AudioSegment::copyTo(float* out) const {
+    for (const auto& chunk : chunks_) {
+        std::memcpy(out, chunk.data(), chunk.count * sizeof(float));
+        out += chunk.count;
+    }
+    g_materializedSamples.fetch_add(size_, std::memory_order_relaxed);
+}
+
+std::vector<float> AudioSegment::toVector() const {
+    std::vector<float> result(size_);
+    if (size_ > 0) {
+        copyTo(result.data());
+    }
+    return result;
+}
+
+AudioCopyStats AudioSegment::getCopyStats() {
+    AudioCopyStats stats;
+    stats.ingestedSamples = g_ingestedSamples.load(std::memory_order_relaxed);
+    stats.materializedSamples = g_materializedSamples.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void AudioSegment::resetCopyStats() {
+    g_ingestedSamples = 0;
+    g_materializedSamples = 0;
+}
+
+// AudioSegmentBuilder
+
+void AudioSegmentBuilder::append(const float* samples, size_t count) {
+    if (!samples || count == 0) {
+        return;
+    }
+    g_ingestedSamples.fetch_add(count, std::memory_order_relaxed);
+
+    while (count > 0) {
+        if (!tail_ || tailUsed_ == AudioBlockPool::BLOCK_SAMPLES) {
+            sealTail();
+            tail_ = AudioBlockPool::instance().acquire();
+            tailStart_ = 0;
+            tailUsed_ = 0;
+        }
+        size_t take = std::min(count, AudioBlockPool::BLOCK_SAMPLES - tailUsed_);
+        std::memcpy(tail_.get() + tailUsed_, samples, take * sizeof(float));
+        tailUsed_ += take;
+        samples += take;
+        count -= take;
+    }
+}
+
+void AudioSegmentBuilder::append(const AudioSegment& segment) {
+    // Later samples keep filling the same tail block after the shared chunks
+    sealTail();
+    sealed_.append(segment);
+}
+
+void AudioSegmentBuilder::keepLast(size_t count) {
+    if (count >= size()) {
+        return;
+    }
+    // Writing continues after the sealed view, in the same tail block
+    sealTail();
+    sealed_ = sealed_.tail(count);
+}
+
+AudioSegment AudioSegmentBuilder::snapshot() const {
+    AudioSegment result = sealed_;
+    if (tail_ && tailUsed_ > tailStart_) {
+        result.appendChunk({tail_, tailStart_, tailUsed_ - tailStart_});
+    }
+    return result;
+}
+
+AudioSegment AudioSegmentBuilder::release() {
+    AudioSegment result = snapshot();
+    clear();
+    return result;
+}
+
+void AudioSegmentBuilder::clear() {
+    sealed_ = AudioSegment();
+    tail_.reset();
+    tailStart_ = 0;
+    tailUsed_ = 0;
+}
+
+void AudioSegmentBuilder::sealTail() {
+    if (tail_ && tailUsed_ > tailStart_) {
+        sealed_.appendChunk({tail_, tailStart_, tailUsed_ - tailStart_});
+        tailStart_ = tailUsed_;
+    }
+}
+
+} // namespace audio
@@ -1,4 +1,5 @@
 #include "audio/audio_utils.hpp"
+#include "audio/signal_statistics.hpp"
 #include "utils/logging.hpp"
 #include <algorithm>
 #include <atomic>
@@ -516,16 +517,19 @@ AudioQualityAssessor::assessQuality(const std::vector<float> &samples,
     return metrics;
   }
 
+  // Level, crossing, clipping and silence measures share one sweep
+  SignalStats stats = SignalStatistics::compute(samples);
+
   metrics.signalToNoiseRatio = calculateSNR(samples);
   metrics.totalHarmonicDistortion = calculateTHD(samples, sampleRate);
-  metrics.dynamicRange = calculateDynamicRange(samples);
-  metrics.peakAmplitude = findPeakAmplitude(samples);
-  metrics.rmsLevel = calculateRMSLevel(samples);
-  metrics.zeroCrossingRate = calculateZeroCrossingRate(samples, sampleRate);
-  metrics.spectralCentroid = calculateSpectralCentroid(samples, sampleRate);
-  metrics.hasClipping = hasClipping(samples);
-  metrics.hasSilence = hasSilence(samples);
   metrics.noiseFloor = estimateNoiseFloor(samples);
+  metrics.dynamicRange = dynamicRange(stats.peak, metrics.noiseFloor);
+  metrics.peakAmplitude = stats.peak;
+  metrics.rmsLevel = stats.rms();
+  metrics.zeroCrossingRate = zeroCrossingsPerSecond(stats, sampleRate);
+  metrics.spectralCentroid = calculateSpectralCentroid(samples, sampleRate);
+  metrics.hasClipping = stats.clippedSamples > 0;
+  metrics.hasSilence = stats.silentFraction() > 0.9f;
 
   return metrics;
 }
@@ -593,26 +597,20 @@ float AudioQualityAssessor::calculateDynamicRange(
   if (samples.empty())
     return 0.0f;
 
-  float maxAmplitude = findPeakAmplitude(samples);
-  float noiseFloor = estimateNoiseFloor(samples);
+  return dynamicRange(findPeakAmplitude(samples), estimateNoiseFloor(samples));
+}
 
+float AudioQualityAssessor::dynamicRange(float peakAmplitude,
+                                         float noiseFloor) {
   if (noiseFloor < 1e-10f)
     noiseFloor = 1e-10f;
 
-  return 20.0f * std::log10(maxAmplitude / noiseFloor);
+  return 20.0f * std::log10(peakAmplitude / noiseFloor);
 }
 
 float AudioQualityAssessor::calculateRMSLevel(
     const std::vector<float> &samples) {
-  if (samples.empty())
-    return 0.0f;
-
-  float sum = 0.0f;
-  for (float sample : samples) {
-    sum += sample * sample;
-  }
-
-  return std::sqrt(sum / static_cast<float>(samples.size()));
+  return SignalStatistics::compute(samples).rms();
 }
 
 float AudioQualityAssessor::calculateZeroCrossingRate(
@@ -620,17 +618,18 @@ float AudioQualityAssessor::calculateZeroCrossingRate(
   if (samples.size() < 2)
     return 0.0f;
 
-  size_t crossings = 0;
-  for (size_t i = 1; i < samples.size(); ++i) {
-    if ((samples[i - 1] >= 0.0f && samples[i] < 0.0f) ||
-        (samples[i - 1] < 0.0f && samples[i] >= 0.0f)) {
-      crossings++;
-    }
-  }
+  return zeroCrossingsPerSecond(SignalStatistics::compute(samples),
+                                sampleRate);
+}
+
+float AudioQualityAssessor::zeroCrossingsPerSecond(const SignalStats &stats,
+                                                   uint32_t sampleRate) {
+  if (stats.count < 2)
+    return 0.0f;
 
   float duration =
-      static_cast<float>(samples.size()) / static_cast<float>(sampleRate);
-  return static_cast<float>(crossings) / duration;
+      static_cast<float>(stats.count) / static_cast<float>(sampleRate);
+  return static_cast<float>(stats.zeroCrossings) / duration;
 }
 
 float AudioQualityAssessor::calculateSpectralCentroid(
@@ -655,27 +654,18 @@ float AudioQualityAssessor::calculateSpectralCentroid(
 
 bool AudioQualityAssessor::hasClipping(const std::vector<float> &samples,
                                        float threshold) {
-  for (float sample : samples) {
-    if (std::abs(sample) >= threshold) {
-      return true;
-    }
-  }
-  return false;
+  SignalStatsThresholds thresholds;
+  thresholds.clipping = threshold;
+  return SignalStatistics::compute(samples, thresholds).clippedSamples > 0;
 }
 
 bool AudioQualityAssessor::hasSilence(const std::vector<float> &samples,
                                       float threshold) {
-  size_t silentSamples = 0;
-  for (float sample : samples) {
-    if (std::abs(sample) < threshold) {
-      silentSamples++;
-    }
-  }
+  SignalStatsThresholds thresholds;
+  thresholds.silence = threshold;
 
   // Consider it silence if more than 90% of samples are below threshold
-  return static_cast<float>(silentSamples) /
-             static_cast<float>(samples.size()) >
-         0.9f;
+  return SignalStatistics::compute(samples, thresholds).silentFraction() > 0.9f;
 }
 
 float AudioQualityAssessor::estimateNoiseFloor(
@@ -766,15 +756,7 @@ AudioQualityAssessor::computeFFT(const std::vector<float> &samples) {
 
 float AudioQualityAssessor::findPeakAmplitude(
     const std::vector<float> &samples) {
-  if (samples.empty())
-    return 0.0f;
-
-  float peak = 0.0f;
-  for (float sample : samples) {
-    peak = std::max(peak, std::abs(sample));
-  }
-
-  return peak;
+  return SignalStatistics::compute(samples).peak;
 }
 
 std::vector<float>
@@ -0,0 +1,514 @@
+#include "audio/dsp_graph.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace audio {
+
+// DspGraph implementation
+
+DspGraph::DspGraph()
+    : sampleRate_(16000), blockSize_(0), prepared_(false), blocksProcessed_(0) {}
+
+DspNode* DspGraph::addNode(std::unique_ptr<DspNode> node) {
+    if (!node) return nullptr;
+
+    DspNode* raw = node.get();
+    nodes_.push_back(std::move(node));
+    if (prepared_) {
+        // Keep the negotiated size when it satisfies the new node, otherwise renegotiate
+        if (blockSize_ % raw->getBlockQuantum() == 0) {
+            raw->prepare(sampleRate_, blockSize_);
+        } else {
+            prepare(sampleRate_, blockSize_);
+        }
+    }
+    return raw;
+}
+
+DspNode* DspGraph::findNode(const std::string& name) const {
+    for (const auto& node : nodes_) {
+        if (name == node->getName()) {
+            return node.get();
+        }
+    }
+    return nullptr;
+}
+
+void DspGraph::clear() {
+    nodes_.clear();
+    prepared_ = false;
+    blockSize_ = 0;
+}
+
+size_t DspGraph::prepare(int sampleRate, size_t requestedBlockSize) {
+    size_t quantum = 1;
+    for (const auto& node : nodes_) {
+        size_t nodeQuantum = std::max<size_t>(1, node->getBlockQuantum());
+        quantum = quantum / std::gcd(quantum, nodeQuantum) * nodeQuantum;
+    }
+
+    size_t requested = std::max<size_t>(1, requestedBlockSize);
+    sampleRate_ = sampleRate;
+    blockSize_ = (requested + quantum - 1) / quantum * quantum;
+
+    for (auto& node : nodes_) {
+        node->prepare(sampleRate_, blockSize_);
+    }
+    prepared_ = true;
+    return blockSize_;
+}
+
+void DspGraph::process(SampleSpan samples) {
+    if (!prepared_ || samples.empty()) return;
+
+    for (size_t offset = 0; offset < samples.size(); offset += blockSize_) {
+        SampleSpan block = samples.subspan(offset, blockSize_);
+        for (auto& node : nodes_) {
+            if (!node->isBypassed()) {
+                node->process(block);
+            }
+        }
+        blocksProcessed_++;
+    }
+}
+
+void DspGraph::reset() {
+    for (auto& node : nodes_) {
+        node->reset();
+    }
+}
+
+size_t DspGraph::getLatencySamples() const {
+    size_t latency = 0;
+    for (const auto& node : nodes_) {
+        if (!node->isBypassed()) {
+            latency += node->getLatencySamples();
+        }
+    }
+    return latency;
+}
+
+// Kernel implementations
+
+void AgcKernel::beginBlock(const float* samples, size_t count) {
+    blockGain = 1.0f;
+    if (count == 0) return;
+
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        sum += samples[i] * samples[i];
+    }
+    float rms = std::sqrt(sum / count);
+    currentRMS = 0.9f * currentRMS + 0.1f * rms;
+
+    if (currentRMS > 1e-6f) {
+        float targetGain = targetRMS / currentRMS;
+        currentGain = 0.95f * currentGain + 0.05f * targetGain;
+        currentGain = std::max(0.1f, std::min(currentGain, 10.0f));
+        blockGain = currentGain;
+    }
+}
+
+void AgcKernel::reset() {
+    currentGain = 1.0f;
+    currentRMS = 0.0f;
+    blockGain = 1.0f;
+}
+
+void CompressorKernel::setTimes(int sampleRate, float attackSeconds, float releaseSeconds) {
+    attackCoeff = 1.0f - std::exp(-1.0f / (attackSeconds * sampleRate));
+    releaseCoeff = 1.0f - std::exp(-1.0f / (releaseSeconds * sampleRate));
+}
+
+void DeEsserKernel::setSampleRate(int sampleRate, float cutoffHz) {
+    // RBJ biquad high-pass, Q = 1/sqrt(2); cutoff kept below Nyquist for low rates
+    float cutoff = std::min(cutoffHz, 0.45f * sampleRate);
+    float omega = 2.0f * static_cast<float>(M_PI) * cutoff / sampleRate;
+    float alpha = std::sin(omega) / (2.0f * 0.70710678f);
+    float cosOmega = std::cos(omega);
+    float a0 = 1.0f + alpha;
+
+    b0 = (1.0f + cosOmega) / 2.0f / a0;
+    b1 = -(1.0f + cosOmega) / a0;
+    b2 = b0;
+    a1 = -2.0f * cosOmega / a0;
+    a2 = (1.0f - alpha) / a0;
+}
+
+// Dynamics node implementations
+
+AutomaticGainNode::AutomaticGainNode(float targetRMS) {
+    kernel_.targetRMS = targetRMS;
+}
+
+void AutomaticGainNode::prepare(int, size_t) {
+    kernel_.reset();
+}
+
+void AutomaticGainNode::process(SampleSpan block) {
+    kernel_.beginBlock(block.data(), block.size());
+    for (float& sample : block) {
+        sample = kernel_.tick(sample);
+    }
+}
+
+CompressorNode::CompressorNode(float ratio, float threshold, float attackSeconds, float releaseSeconds)
+    : sampleRate_(16000), attackSeconds_(attackSeconds), releaseSeconds_(releaseSeconds) {
+    kernel_.ratio = ratio;
+    kernel_.threshold = threshold;
+}
+
+void CompressorNode::prepare(int sampleRate, size_t) {
+    sampleRate_ = sampleRate;
+    kernel_.setTimes(sampleRate_, attackSeconds_, releaseSeconds_);
+    kernel_.reset();
+}
+
+void CompressorNode::process(SampleSpan block) {
+    for (float& sample : block) {
+        sample = kernel_.tick(sample);
+    }
+}
+
+void CompressorNode::setParameters(float ratio, float threshold, float attackSeconds, float releaseSeconds) {
+    kernel_.ratio = ratio;
+    kernel_.threshold = threshold;
+    attackSeconds_ = attackSeconds;
+    releaseSeconds_ = releaseSeconds;
+    kernel_.setTimes(sampleRate_, attackSeconds_, releaseSeconds_);
+}
+
+void DeEsserNode::prepare(int sampleRate, size_t) {
+    kernel_.setSampleRate(sampleRate);
+    kernel_.reset();
+}
+
+void DeEsserNode::process(SampleSpan block) {
+    for (float& sample : block) {
+        sample = kernel_.tick(sample);
+    }
+}
+
+void LimiterNode::process(SampleSpan block) {
+    for (float& sample : block) {
+        sample = kernel_.tick(sample);
+    }
+}
+
+FusedDynamicsNode::FusedDynamicsNode() : FusedDynamicsNode(Config()) {}
+
+FusedDynamicsNode::FusedDynamicsNode(const Config& config) : sampleRate_(16000) {
+    setConfig(config);
+}
+
+void FusedDynamicsNode::prepare(int sampleRate, size_t) {
+    sampleRate_ = sampleRate;
+    setConfig(config_);
+    reset();
+}
+
+void FusedDynamicsNode::process(SampleSpan block) {
+    const bool agc = config_.enableAGC;
+    const bool compress = config_.enableCompression;
+    const bool deEss = config_.enableDeEsser;
+    const bool limit = config_.enableLimiter;
+
+    if (agc) {
+        agc_.beginBlock(block.data(), block.size());
+    }
+
+    for (float& sample : block) {
+        float value = sample;
+        if (agc) value = agc_.tick(value);
+        if (compress) value = compressor_.tick(value);
+        if (deEss) value = deEsser_.tick(value);
+        if (limit) value = limiter_.tick(value);
+        sample = value;
+    }
+}
+
+void FusedDynamicsNode::reset() {
+    agc_.reset();
+    compressor_.reset();
+    deEsser_.reset();
+}
+
+void FusedDynamicsNode::setConfig(const Config& config) {
+    config_ = config;
+    agc_.targetRMS = config_.targetRMS;
+    compressor_.ratio = config_.compressionRatio;
+    compressor_.threshold = config_.compressionThreshold;
+    compressor_.setTimes(sampleRate_, config_.attackSeconds, config_.releaseSeconds);
+    deEsser_.setSampleRate(sampleRate_);
+    limiter_.threshold = config_.limiterThreshold;
+}
+
+// Noise reduction node implementations
+
+NoiseGateNode::NoiseGateNode(float thresholdDb) {
+    setThresholdDb(thresholdDb);
+}
+
+void NoiseGateNode::setThresholdDb(float thresholdDb) {
+    thresholdLinear_ = std::pow(10.0f, thresholdDb / 20.0f);
+}
+
+void NoiseGateNode::process(SampleSpan block) {
+    for (float& sample : block) {
+        if (std::abs(sample) < thresholdLinear_) {
+            sample *= 0.1f; // Reduce by 20dB instead of complete gating
+        }
+    }
+}
+
+void WienerFilterNode::process(SampleSpan block) {
+    for (float& sample : block) {
+        float localPower = sample * sample;
+        float gain = localPower / (localPower + noisePower_);
+        sample *= smoothingFactor_ * gain + (1.0f - smoothingFactor_);
+    }
+}
+
+SpectralSubtractionNode::SpectralSubtractionNode(size_t frameSize, float alpha, float beta)
+    : alpha_(alpha), beta_(beta), fifoPosition_(0) {
+    // Radix-2 FFT needs a power of two
+    frameSize_ = 64;
+    while (frameSize_ < frameSize) {
+        frameSize_ <<= 1;
+    }
+    hopSize_ = frameSize_ / 2;
+    noiseProfile_.assign(frameSize_ / 2, 0.0f);
+}
+
+void SpectralSubtractionNode::prepare(int, size_t) {
+    // Periodic Hann sums to one at 50% overlap, so a zero noise profile is transparent
+    window_.resize(frameSize_);
+    for (size_t i = 0; i < frameSize_; ++i) {
+        window_[i] = 0.5f * (1.0f - std::cos(2.0f * static_cast<float>(M_PI) * i / frameSize_));
+    }
+
+    twiddles_.resize(frameSize_ / 2);
+    for (size_t i = 0; i < twiddles_.size(); ++i) {
+        float angle = -2.0f * static_cast<float>(M_PI) * i / frameSize_;
+        twiddles_[i] = std::complex<float>(std::cos(angle), std::sin(angle));
+    }
+
+    bitReverse_.resize(frameSize_);
+    size_t bits = 0;
+    while ((size_t(1) << bits) < frameSize_) ++bits;
+    for (size_t i = 0; i < frameSize_; ++i) {
+        size_t reversed = 0;
+        for (size_t b = 0; b < bits; ++b) {
+            if (i & (size_t(1) << b)) reversed |= size_t(1) << (bits - 1 - b);
+        }
+        bitReverse_[i] = reversed;
+    }
+
+    spectrum_.resize(frameSize_);
+    reset();
+}
+
+void SpectralSubtractionNode::reset() {
+    inputFifo_.assign(frameSize_, 0.0f);
+    outputFifo_.assign(frameSize_, 0.0f);
+    overlap_.assign(frameSize_, 0.0f);
+    fifoPosition_ = frameSize_ - hopSize_;
+}
+
+void SpectralSubtractionNode::process(SampleSpan block) {
+    const size_t latency = frameSize_ - hopSize_;
+    for (float& sample : block) {
+        inputFifo_[fifoPosition_] = sample;
+        sample = outputFifo_[fifoPosition_ - latency];
+        if (++fifoPosition_ == frameSize_) {
+            processFrame();
+            fifoPosition_ = latency;
+        }
+    }
+}
+
+void SpectralSubtractionNode::processFrame() {
+    for (size_t i = 0; i < frameSize_; ++i) {
+        spectrum_[i] = std::complex<float>(inputFifo_[i] * window_[i], 0.0f);
+    }
+    fft(false);
+
+    const size_t half = frameSize_ / 2;
+    for (size_t bin = 0; bin <= half; ++bin) {
+        float magnitude = std::abs(spectrum_[bin]);
+        if (magnitude <= 0.0f) continue;
+
+        float noise = noiseProfile_[std::min(bin, half - 1)];
+        float subtracted = std::max(magnitude - alpha_ * noise, beta_ * magnitude);
+        float scale = subtracted / magnitude;
+        spectrum_[bin] *= scale;
+        if (bin != 0 && bin != half) {
+            spectrum_[frameSize_ - bin] *= scale;
+        }
+    }
+
+    fft(true);
+
+    for (size_t i = 0; i < frameSize_; ++i) {
+        overlap_[i] += spectrum_[i].real();
+    }
+    std::copy(overlap_.begin(), overlap_.begin() + hopSize_, outputFifo_.begin());
+    std::copy(overlap_.begin() + hopSize_, overlap_.end(), overlap_.begin());
+    std::fill(overlap_.end() - hopSize_, overlap_.end(), 0.0f);
+    std::copy(inputFifo_.begin() + hopSize_, inputFifo_.end(), inputFifo_.begin());
+}
+
+void SpectralSubtractionNode::fft(bool inverse) {
+    for (size_t i = 0; i < frameSize_; ++i) {
+        if (i < bitReverse_[i]) {
+            std::swap(spectrum_[i], spectrum_[bitReverse_[i]]);
+        }
+    }
+
+    for (size_t length = 2; length <= frameSize_; length <<= 1) {
+        size_t halfLength = length / 2;
+        size_t stride = frameSize_ / length;
+        for (size_t start = 0; start < frameSize_; start += length) {
+            for (size_t k = 0; k < halfLength; ++k) {
+                std::complex<float> w = twiddles_[k * stride];
+                if (inverse) w = std::conj(w);
+                std::complex<float> odd = spectrum_[start + k + halfLength] * w;
+                spectrum_[start + k + halfLength] = spectrum_[start + k] - odd;
+                spectrum_[start + k] += odd;
+            }
+        }
+    }
+
+    if (inverse) {
+        float scale = 1.0f / frameSize_;
+        for (auto& value : spectrum_) {
+            value *= scale;
+        }
+    }
+}
+
+void SpectralSubtractionNode::setNoiseProfile(const std::vector<float>& magnitudes) {
+    if (magnitudes.empty()) return;
+
+    // Resample bins if the profile came from a different frame size; noise
+    // magnitudes grow with the square root of the frame length
+    const size_t bins = noiseProfile_.size();
+    float magnitudeScale = std::sqrt(static_cast<float>(bins) / magnitudes.size());
+    for (size_t i = 0; i < bins; ++i) {
+        size_t source = std::min(magnitudes.size() - 1, i * magnitudes.size() / bins);
+        noiseProfile_[i] = magnitudes[source] * magnitudeScale;
+    }
+}
+
+void SpectralSubtractionNode::updateNoiseProfile(SampleSpan noise) {
+    if (noise.size() < frameSize_ || spectrum_.size() != frameSize_) return;
+
+    for (size_t i = 0; i < frameSize_; ++i) {
+        spectrum_[i] = std::complex<float>(noise[i] * window_[i], 0.0f);
+    }
+    fft(false);
+
+    const float alpha = 0.1f; // Learning rate
+    for (size_t i = 0; i < noiseProfile_.size(); ++i) {
+        noiseProfile_[i] = alpha * std::abs(spectrum_[i]) + (1.0f - alpha) * noiseProfile_[i];
+    }
+}
+
+// EchoCancellerNode implementation
+
+EchoCancellerNode::EchoCancellerNode(Mode mode, size_t filterLength, float convergenceRate,
+                                     float suppressionStrength)
+    : mode_(mode), filterLength_(std::max<size_t>(1, filterLength)), convergenceRate_(convergenceRate),
+      suppressionStrength_(suppressionStrength), sampleRate_(16000), historyPosition_(0),
+      historyPower_(0.0f) {}
+
+void EchoCancellerNode::prepare(int sampleRate, size_t blockSize) {
+    sampleRate_ = sampleRate;
+    filter_.assign(filterLength_, 0.0f);
+    history_.assign(filterLength_ * 2, 0.0f);
+    autocorrelation_.assign(mode_ == Mode::SUPPRESSION ? blockSize : 0, 0.0f);
+    reset();
+}
+
+void EchoCancellerNode::reset() {
+    std::fill(filter_.begin(), filter_.end(), 0.0f);
+    std::fill(history_.begin(), history_.end(), 0.0f);
+    historyPosition_ = 0;
+    historyPower_ = 0.0f;
+}
+
+void EchoCancellerNode::process(SampleSpan block) {
+    if (mode_ == Mode::SUPPRESSION) {
+        processSuppression(block);
+    } else {
+        processAdaptive(block);
+    }
+}
+
+void EchoCancellerNode::processAdaptive(SampleSpan block) {
+    const size_t length = filterLength_;
+    float* coefficients = filter_.data();
+
+    for (float& sample : block) {
+        // Newest sample first; the mirrored half keeps the window contiguous
+        historyPosition_ = historyPosition_ == 0 ? length - 1 : historyPosition_ - 1;
+        float dropped = history_[historyPosition_];
+        history_[historyPosition_] = sample;
+        history_[historyPosition_ + length] = sample;
+        historyPower_ = std::max(0.0f, historyPower_ + sample * sample - dropped * dropped);
+
+        const float* window = history_.data() + historyPosition_;
+        float estimate = 0.0f;
+        for (size_t j = 0; j < length; ++j) {
+            estimate += coefficients[j] * window[j];
+        }
+
+        float error = sample - estimate;
+        sample = error;
+
+        float step = mode_ == Mode::NLMS ? convergenceRate_ / (historyPower_ + 1e-6f) : convergenceRate_;
+        float update = step * error;
+        for (size_t j = 0; j < length; ++j) {
+            coefficients[j] += update * window[j];
+        }
+    }
+}
+
+void EchoCancellerNode::processSuppression(SampleSpan block) {
+    const size_t n = block.size();
+    if (n < 1000 || autocorrelation_.size() < n) return;
+
+    size_t minDelay = sampleRate_ / 100; // 10ms minimum
+    size_t maxDelay = std::min(n / 2, static_cast<size_t>(sampleRate_));
+
+    float zeroLag = 0.0f;
+    for (size_t i = 0; i < n; ++i) {
+        zeroLag += block[i] * block[i];
+    }
+    zeroLag /= n;
+    if (zeroLag <= 0.0f) return;
+
+    float bestCorrelation = 0.0f;
+    size_t bestDelay = 0;
+    for (size_t lag = minDelay; lag < maxDelay; ++lag) {
+        float sum = 0.0f;
+        for (size_t i = 0; i + lag < n; ++i) {
+            sum += block[i] * block[i + lag];
+        }
+        float correlation = sum / (n - lag) / zeroLag;
+        autocorrelation_[lag] = correlation;
+        if (correlation > bestCorrelation) {
+            bestCorrelation = correlation;
+            bestDelay = lag;
+        }
+    }
+
+    if (bestDelay > 0) {
+        for (size_t i = bestDelay; i < n; ++i) {
+            block[i] -= suppressionStrength_ * block[i - bestDelay];
+        }
+    }
+}
+
+} // namespace audio
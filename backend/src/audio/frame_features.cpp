@@ -0,0 +1,414 @@
+#include "audio/frame_features.hpp"
+#include "audio/signal_statistics.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace audio {
+
+namespace {
+
+constexpr float PI = 3.14159265358979323846f;
+constexpr float LOG_FLOOR = 1e-10f;
+
+size_t featureIndex(FrameFeature feature) {
+    size_t index = 0;
+    for (uint32_t bits = static_cast<uint32_t>(feature); bits > 1; bits >>= 1) {
+        ++index;
+    }
+    return index;
+}
+
+size_t nextPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+float hzToMel(float hz) { return 2595.0f * std::log10(1.0f + hz / 700.0f); }
+float melToHz(float mel) { return 700.0f * (std::pow(10.0f, mel / 2595.0f) - 1.0f); }
+
+} // namespace
+
+// FrameAnalysisTables
+
+std::shared_ptr<const FrameAnalysisTables> FrameAnalysisTables::create(const FrameAnalysisConfig& config) {
+    return std::shared_ptr<const FrameAnalysisTables>(new FrameAnalysisTables(config));
+}
+
+FrameAnalysisTables::FrameAnalysisTables(const FrameAnalysisConfig& config)
+    : config_(config) {
+    config_.sampleRate = std::max(1, config_.sampleRate);
+    config_.frameSize = std::max<size_t>(config_.frameSize, 2);
+    config_.hopSize = std::max<size_t>(config_.hopSize, 1);
+    fftSize_ = nextPowerOfTwo(config_.frameSize);
+
+    window_.resize(config_.frameSize);
+    for (size_t i = 0; i < window_.size(); ++i) {
+        window_[i] = 0.5f - 0.5f * std::cos(2.0f * PI * i / (window_.size() - 1));
+    }
+
+    size_t bits = 0;
+    while ((size_t(1) << bits) < fftSize_) ++bits;
+    bitReverse_.resize(fftSize_);
+    for (size_t i = 0; i < fftSize_; ++i) {
+        size_t reversed = 0;
+        for (size_t b = 0; b < bits; ++b) {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        bitReverse_[i] = reversed;
+    }
+    twiddles_.resize(fftSize_ / 2);
+    for (size_t k = 0; k < twiddles_.size(); ++k) {
+        float angle = -2.0f * PI * k / fftSize_;
+        twiddles_[k] = std::complex<float>(std::cos(angle), std::sin(angle));
+    }
+
+    // Triangular filters evenly spaced on the mel scale up to Nyquist
+    size_t bands = config_.melBands;
+    size_t bins = getBinCount();
+    float maxMel = hzToMel(config_.sampleRate / 2.0f);
+    std::vector<float> edges(bands + 2);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        edges[i] = melToHz(maxMel * i / (bands + 1)) * fftSize_ / config_.sampleRate;
+    }
+    melFilters_.resize(bands);
+    for (size_t m = 0; m < bands; ++m) {
+        float left = edges[m], center = edges[m + 1], right = edges[m + 2];
+        size_t first = static_cast<size_t>(std::ceil(left));
+        size_t last = std::min(bins - 1, static_cast<size_t>(std::floor(right)));
+        MelFilter& filter = melFilters_[m];
+        filter.firstBin = first;
+        for (size_t bin = first; bin <= last && bin < bins; ++bin) {
+            float x = static_cast<float>(bin);
+            float weight = x <= center ? (x - left) / std::max(center - left, 1e-6f)
+                                       : (right - x) / std::max(right - center, 1e-6f);
+            filter.weights.push_back(std::max(0.0f, weight));
+        }
+    }
+
+    dctMatrix_.resize(config_.mfccCoefficients * bands);
+    for (size_t k = 0; k < config_.mfccCoefficients; ++k) {
+        for (size_t n = 0; n < bands; ++n) {
+            dctMatrix_[k * bands + n] = std::cos(PI * k * (n + 0.5f) / bands);
+        }
+    }
+}
+
+float FrameAnalysisTables::binFrequency(size_t bin) const {
+    return static_cast<float>(bin) * config_.sampleRate / fftSize_;
+}
+
+void FrameAnalysisTables::forwardFFT(const float* samples, size_t count,
+                                     std::vector<std::complex<float>>& out) const {
+    out.assign(fftSize_, std::complex<float>(0.0f, 0.0f));
+    size_t n = std::min(count, fftSize_);
+    bool standardWindow = n == window_.size();
+    for (size_t i = 0; i < n; ++i) {
+        float weight = standardWindow ? window_[i]
+                                      : (n > 1 ? 0.5f - 0.5f * std::cos(2.0f * PI * i / (n - 1)) : 1.0f);
+        out[bitReverse_[i]] = std::complex<float>(samples[i] * weight, 0.0f);
+    }
+
+    for (size_t length = 2; length <= fftSize_; length <<= 1) {
+        size_t half = length / 2;
+        size_t stride = fftSize_ / length;
+        for (size_t start = 0; start < fftSize_; start += length) {
+            for (size_t k = 0; k < half; ++k) {
+                std::complex<float> odd = twiddles_[k * stride] * out[start + k + half];
+                out[start + k + half] = out[start + k] - odd;
+                out[start + k] += odd;
+            }
+        }
+    }
+}
+
+void FrameAnalysisTables::melEnergies(const std::vector<float>& powerSpectrum, std::vector<float>& out) const {
+    out.assign(melFilters_.size(), 0.0f);
+    for (size_t m = 0; m < melFilters_.size(); ++m) {
+        const MelFilter& filter = melFilters_[m];
+        float energy = 0.0f;
+        for (size_t i = 0; i < filter.weights.size() && filter.firstBin + i < powerSpectrum.size(); ++i) {
+            energy += filter.weights[i] * powerSpectrum[filter.firstBin + i];
+        }
+        out[m] = energy;
+    }
+}
+
+void FrameAnalysisTables::dct(const std::vector<float>& logMel, std::vector<float>& out) const {
+    size_t bands = melFilters_.size();
+    out.assign(config_.mfccCoefficients, 0.0f);
+    for (size_t k = 0; k < out.size(); ++k) {
+        const float* row = &dctMatrix_[k * bands];
+        float sum = 0.0f;
+        for (size_t n = 0; n < bands && n < logMel.size(); ++n) {
+            sum += row[n] * logMel[n];
+        }
+        out[k] = sum;
+    }
+}
+
+// FrameFeatures
+
+FrameFeatures::FrameFeatures(std::shared_ptr<const FrameAnalysisTables> tables)
+    : tables_(std::move(tables)) {
+}
+
+FrameFeatures::FrameFeatures(std::shared_ptr<const FrameAnalysisTables> tables, const float* samples, size_t count)
+    : tables_(std::move(tables)) {
+    assign(samples, count);
+}
+
+void FrameFeatures::assign(const float* samples, size_t count, uint64_t index) {
+    samples_.assign(samples, samples + count);
+    index_ = index;
+    computed_ = 0;
+    timeDomainReady_ = false;
+}
+
+bool FrameFeatures::begin(FrameFeature feature) {
+    if (hasFeature(computed_, feature)) {
+        return false;
+    }
+    computed_ |= static_cast<FrameFeatureSet>(feature);
+    computations_[featureIndex(feature)]++;
+    return true;
+}
+
+const SignalStats& FrameFeatures::timeDomainStats() {
+    // RMS, peak and crossings come out of one sweep, whichever is read first
+    if (!timeDomainReady_) {
+        timeDomain_ = SignalStatistics::compute(samples_);
+        timeDomainReady_ = true;
+    }
+    return timeDomain_;
+}
+
+float FrameFeatures::rms() {
+    if (begin(FrameFeature::RMS)) {
+        rms_ = timeDomainStats().rms();
+    }
+    return rms_;
+}
+
+float FrameFeatures::peak() {
+    if (begin(FrameFeature::PEAK)) {
+        peak_ = timeDomainStats().peak;
+    }
+    return peak_;
+}
+
+float FrameFeatures::zeroCrossingRate() {
+    if (begin(FrameFeature::ZERO_CROSSING_RATE)) {
+        zeroCrossingRate_ = timeDomainStats().zeroCrossingRate();
+    }
+    return zeroCrossingRate_;
+}
+
+const std::vector<float>& FrameFeatures::magnitudeSpectrum() {
+    if (begin(FrameFeature::MAGNITUDE_SPECTRUM)) {
+        tables_->forwardFFT(samples_.data(), samples_.size(), fft_);
+        magnitude_.resize(tables_->getBinCount());
+        for (size_t bin = 0; bin < magnitude_.size(); ++bin) {
+            magnitude_[bin] = std::abs(fft_[bin]);
+        }
+    }
+    return magnitude_;
+}
+
+const std::vector<float>& FrameFeatures::powerSpectrum() {
+    if (!hasFeature(computed_, FrameFeature::POWER_SPECTRUM)) {
+        const auto& magnitude = magnitudeSpectrum();
+        begin(FrameFeature::POWER_SPECTRUM);
+        power_.resize(magnitude.size());
+        for (size_t bin = 0; bin < magnitude.size(); ++bin) {
+            power_[bin] = magnitude[bin] * magnitude[bin];
+        }
+    }
+    return power_;
+}
+
+float FrameFeatures::spectralCentroid() {
+    if (!hasFeature(computed_, FrameFeature::SPECTRAL_CENTROID)) {
+        const auto& magnitude = magnitudeSpectrum();
+        begin(FrameFeature::SPECTRAL_CENTROID);
+        float weighted = 0.0f, total = 0.0f;
+        for (size_t bin = 0; bin < magnitude.size(); ++bin) {
+            weighted += tables_->binFrequency(bin) * magnitude[bin];
+            total += magnitude[bin];
+        }
+        centroid_ = total > 0.0f ? weighted / total : 0.0f;
+    }
+    return centroid_;
+}
+
+float FrameFeatures::spectralBandwidth() {
+    if (!hasFeature(computed_, FrameFeature::SPECTRAL_BANDWIDTH)) {
+        float centroid = spectralCentroid();
+        const auto& magnitude = magnitudeSpectrum();
+        begin(FrameFeature::SPECTRAL_BANDWIDTH);
+        float weighted = 0.0f, total = 0.0f;
+        for (size_t bin = 0; bin < magnitude.size(); ++bin) {
+            float deviation = tables_->binFrequency(bin) - centroid;
+            weighted += deviation * deviation * magnitude[bin];
+            total += magnitude[bin];
+        }
+        bandwidth_ = total > 0.0f ? std::sqrt(weighted / total) : 0.0f;
+    }
+    return bandwidth_;
+}
+
+float FrameFeatures::spectralRolloff() {
+    if (!hasFeature(computed_, FrameFeature::SPECTRAL_ROLLOFF)) {
+        const auto& magnitude = magnitudeSpectrum();
+        begin(FrameFeature::SPECTRAL_ROLLOFF);
+        float total = 0.0f;
+        for (float value : magnitude) total += value;
+        float target = total * tables_->getConfig().rolloffPercent;
+        float cumulative = 0.0f;
+        rolloff_ = tables_->binFrequency(magnitude.empty() ? 0 : magnitude.size() - 1);
+        for (size_t bin = 0; bin < magnitude.size(); ++bin) {
+            cumulative += magnitude[bin];
+            if (cumulative >= target) {
+                rolloff_ = tables_->binFrequency(bin);
+                break;
+            }
+        }
+    }
+    return rolloff_;
+}
+
+float FrameFeatures::spectralFlatness() {
+    if (!hasFeature(computed_, FrameFeature::SPECTRAL_FLATNESS)) {
+        const auto& magnitude = magnitudeSpectrum();
+        begin(FrameFeature::SPECTRAL_FLATNESS);
+        double logSum = 0.0, sum = 0.0;
+        for (float value : magnitude) {
+            logSum += std::log(value + LOG_FLOOR);
+            sum += value;
+        }
+        double arithmetic = magnitude.empty() ? 0.0 : sum / magnitude.size();
+        double geometric = magnitude.empty() ? 0.0 : std::exp(logSum / magnitude.size());
+        flatness_ = arithmetic > 0.0 ? static_cast<float>(geometric / arithmetic) : 0.0f;
+    }
+    return flatness_;
+}
+
+const std::vector<float>& FrameFeatures::melEnergies() {
+    if (!hasFeature(computed_, FrameFeature::MEL_ENERGIES)) {
+        const auto& power = powerSpectrum();
+        begin(FrameFeature::MEL_ENERGIES);
+        tables_->melEnergies(power, mel_);
+    }
+    return mel_;
+}
+
+const std::vector<float>& FrameFeatures::mfcc() {
+    if (!hasFeature(computed_, FrameFeature::MFCC)) {
+        std::vector<float> logMel = melEnergies();
+        begin(FrameFeature::MFCC);
+        for (float& value : logMel) {
+            value = std::log(value + LOG_FLOOR);
+        }
+        tables_->dct(logMel, mfcc_);
+    }
+    return mfcc_;
+}
+
+void FrameFeatures::compute(FrameFeatureSet features) {
+    if (hasFeature(features, FrameFeature::RMS)) rms();
+    if (hasFeature(features, FrameFeature::PEAK)) peak();
+    if (hasFeature(features, FrameFeature::ZERO_CROSSING_RATE)) zeroCrossingRate();
+    if (hasFeature(features, FrameFeature::MAGNITUDE_SPECTRUM)) magnitudeSpectrum();
+    if (hasFeature(features, FrameFeature::POWER_SPECTRUM)) powerSpectrum();
+    if (hasFeature(features, FrameFeature::SPECTRAL_CENTROID)) spectralCentroid();
+    if (hasFeature(features, FrameFeature::SPECTRAL_BANDWIDTH)) spectralBandwidth();
+    if (hasFeature(features, FrameFeature::SPECTRAL_ROLLOFF)) spectralRolloff();
+    if (hasFeature(features, FrameFeature::SPECTRAL_FLATNESS)) spectralFlatness();
+    if (hasFeature(features, FrameFeature::MEL_ENERGIES)) melEnergies();
+    if (hasFeature(features, FrameFeature::MFCC)) mfcc();
+}
+
+// FrameFeatureBus
+
+FrameFeatureBus::FrameFeatureBus(const FrameAnalysisConfig& config)
+    : tables_(FrameAnalysisTables::create(config))
+    , frame_(tables_) {
+}
+
+FrameFeatureBus::SubscriptionId FrameFeatureBus::subscribe(FrameFeatureSet declared, Subscriber subscriber) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SubscriptionId id = nextId_++;
+    subscriptions_.push_back({id, declared, std::move(subscriber)});
+    declared_ |= declared;
+    return id;
+}
+
+void FrameFeatureBus::unsubscribe(SubscriptionId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    subscriptions_.erase(std::remove_if(subscriptions_.begin(), subscriptions_.end(),
+                                        [id](const Subscription& s) { return s.id == id; }),
+                         subscriptions_.end());
+    declared_ = 0;
+    for (const auto& subscription : subscriptions_) {
+        declared_ |= subscription.declared;
+    }
+}
+
+size_t FrameFeatureBus::getSubscriberCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return subscriptions_.size();
+}
+
+FrameFeatureSet FrameFeatureBus::getDeclaredFeatures() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return declared_;
+}
+
+size_t FrameFeatureBus::push(const float* samples, size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t frameSize = tables_->getConfig().frameSize;
+    const size_t hopSize = tables_->getConfig().hopSize;
+
+    pending_.insert(pending_.end(), samples, samples + count);
+
+    size_t published = 0;
+    while (pending_.size() >= pendingOffset_ + frameSize) {
+        frame_.assign(pending_.data() + pendingOffset_, frameSize, frames_++);
+        frame_.compute(declared_);
+        for (auto& subscription : subscriptions_) {
+            subscription.subscriber(frame_);
+        }
+        pendingOffset_ += hopSize;
+        published++;
+    }
+
+    // Compact once the consumed prefix outgrows a frame
+    if (pendingOffset_ >= frameSize || pendingOffset_ >= pending_.size()) {
+        size_t consumed = std::min(pendingOffset_, pending_.size());
+        pending_.erase(pending_.begin(), pending_.begin() + consumed);
+        pendingOffset_ -= consumed;
+    }
+    return published;
+}
+
+void FrameFeatureBus::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+    pendingOffset_ = 0;
+}
+
+FrameFeatures FrameFeatureBus::analyze(const float* samples, size_t count) const {
+    return FrameFeatures(tables_, samples, count);
+}
+
+FrameFeatureBus::Stats FrameFeatureBus::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats;
+    stats.frames = frames_;
+    stats.computations = frame_.getComputationCounts();
+    return stats;
+}
+
+} // namespace audio
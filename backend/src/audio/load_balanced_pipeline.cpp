@@ -1,6 +1,8 @@
 #include "audio/load_balanced_pipeline.hpp"
+#include "core/admission_controller.hpp"
 #include "utils/logging.hpp"
 #include "utils/performance_monitor.hpp"
+#include "utils/system_resource_sampler.hpp"
 #include <algorithm>
 #include <numeric>
 #include <thread>
@@ -11,7 +13,6 @@
 #pragma comment(lib, "psapi.lib")
 #else
 #include <sys/resource.h>
-#include <sys/sysinfo.h>
 #include <unistd.h>
 #endif
 
@@ -253,7 +254,8 @@ bool PriorityJobQueue::isJobTimedOut(const ProcessingJob &job) const {
 }
 
 ResourceMonitor::ResourceMonitor()
-    : updateIntervalMs_(1000), monitoring_(false) {}
+    : updateIntervalMs_(1000), monitoring_(false),
+      monitoringTimer_(speechrnt::utils::TimerService::INVALID_TIMER) {}
 
 ResourceMonitor::~ResourceMonitor() { stopMonitoring(); }
 
@@ -274,8 +276,11 @@ bool ResourceMonitor::startMonitoring() {
   }
 
   monitoring_ = true;
-  monitoringThread_ =
-      std::make_unique<std::thread>(&ResourceMonitor::monitoringLoop, this);
+  speechrnt::utils::SystemResourceSampler::getInstance().ensureStarted(
+      std::chrono::milliseconds(updateIntervalMs_));
+  monitoringTimer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+      "pipeline.resource_monitor", std::chrono::milliseconds(updateIntervalMs_),
+      [this]() { sampleResources(); }, true);
 
   speechrnt::utils::Logger::info("Resource monitoring started");
   return true;
@@ -288,9 +293,8 @@ void ResourceMonitor::stopMonitoring() {
 
   monitoring_ = false;
 
-  if (monitoringThread_ && monitoringThread_->joinable()) {
-    monitoringThread_->join();
-  }
+  speechrnt::utils::TimerService::getInstance().cancel(monitoringTimer_);
+  monitoringTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
 
   speechrnt::utils::Logger::info("Resource monitoring stopped");
 }
@@ -339,48 +343,40 @@ void ResourceMonitor::updateAverageLatency(float latencyMs) {
   currentResources_.averageLatency = latencyMs;
 }
 
-void ResourceMonitor::monitoringLoop() {
-  speechrnt::utils::Logger::info("Resource monitoring loop started");
-
-  while (monitoring_.load()) {
-    try {
-      SystemResources resources = measureSystemResources();
+void ResourceMonitor::sampleResources() {
+  try {
+    SystemResources resources = measureSystemResources();
 
-      {
-        std::lock_guard<std::mutex> lock(resourcesMutex_);
+    {
+      std::lock_guard<std::mutex> lock(resourcesMutex_);
 
-        // Update resources but preserve manually set values
-        resources.activeThreads = currentResources_.activeThreads;
-        resources.queuedJobs = currentResources_.queuedJobs;
-        resources.averageLatency = currentResources_.averageLatency;
+      // Update resources but preserve manually set values
+      resources.activeThreads = currentResources_.activeThreads;
+      resources.queuedJobs = currentResources_.queuedJobs;
+      resources.averageLatency = currentResources_.averageLatency;
 
-        bool significantChange =
-            std::abs(resources.cpuUsage - currentResources_.cpuUsage) > 0.1f ||
-            std::abs(resources.memoryUsage - currentResources_.memoryUsage) >
-                0.1f;
+      bool significantChange =
+          std::abs(resources.cpuUsage - currentResources_.cpuUsage) > 0.1f ||
+          std::abs(resources.memoryUsage - currentResources_.memoryUsage) >
+              0.1f;
 
-        currentResources_ = resources;
+      currentResources_ = resources;
 
-        if (significantChange) {
-          notifyResourceChange(resources);
-        }
+      if (significantChange) {
+        notifyResourceChange(resources);
       }
-
-      // Record performance metrics
-      speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
-          "pipeline.resource.cpu", resources.cpuUsage, "%");
-      speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
-          "pipeline.resource.memory", resources.memoryUsage, "%");
-
-    } catch (const std::exception &e) {
-      speechrnt::utils::Logger::error("Resource monitoring error: " +
-                                      std::string(e.what()));
     }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(updateIntervalMs_));
-  }
+    // Record performance metrics
+    speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
+        "pipeline.resource.cpu", resources.cpuUsage, "%");
+    speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
+        "pipeline.resource.memory", resources.memoryUsage, "%");
 
-  speechrnt::utils::Logger::info("Resource monitoring loop stopped");
+  } catch (const std::exception &e) {
+    speechrnt::utils::Logger::error("Resource monitoring error: " +
+                                    std::string(e.what()));
+  }
 }
 
 SystemResources ResourceMonitor::measureSystemResources() {
@@ -445,40 +441,9 @@ float ResourceMonitor::getCpuUsage() const {
 
   return std::min(1.0f, std::max(0.0f, percent));
 #else
-  // Linux implementation (simplified)
-  static long lastTotalUser = 0, lastTotalUserLow = 0, lastTotalSys = 0,
-              lastTotalIdle = 0;
-
-  FILE *file = fopen("/proc/stat", "r");
-  if (!file) {
-    return 0.0f;
-  }
-
-  long totalUser, totalUserLow, totalSys, totalIdle;
-  fscanf(file, "cpu %ld %ld %ld %ld", &totalUser, &totalUserLow, &totalSys,
-         &totalIdle);
-  fclose(file);
-
-  if (lastTotalUser == 0) {
-    lastTotalUser = totalUser;
-    lastTotalUserLow = totalUserLow;
-    lastTotalSys = totalSys;
-    lastTotalIdle = totalIdle;
-    return 0.0f;
-  }
-
-  long total = (totalUser - lastTotalUser) + (totalUserLow - lastTotalUserLow) +
-               (totalSys - lastTotalSys);
-  long totalTime = total + (totalIdle - lastTotalIdle);
-
-  float percent = totalTime > 0 ? static_cast<float>(total) / totalTime : 0.0f;
-
-  lastTotalUser = totalUser;
-  lastTotalUserLow = totalUserLow;
-  lastTotalSys = totalSys;
-  lastTotalIdle = totalIdle;
-
-  return std::min(1.0f, std::max(0.0f, percent));
+  return speechrnt::utils::SystemResourceSampler::getInstance()
+      .getSnapshot()
+      .cpuUsage;
 #endif
 }
 
@@ -494,17 +459,9 @@ float ResourceMonitor::getMemoryUsage() const {
 
   return static_cast<float>(physMemUsed) / static_cast<float>(totalPhysMem);
 #else
-  // Linux implementation
-  struct sysinfo memInfo;
-  sysinfo(&memInfo);
-
-  long long totalPhysMem = memInfo.totalram;
-  totalPhysMem *= memInfo.mem_unit;
-
-  long long physMemUsed = memInfo.totalram - memInfo.freeram;
-  physMemUsed *= memInfo.mem_unit;
-
-  return static_cast<float>(physMemUsed) / static_cast<float>(totalPhysMem);
+  return speechrnt::utils::SystemResourceSampler::getInstance()
+      .getSnapshot()
+      .memoryUsage;
 #endif
 }
 
@@ -902,11 +859,18 @@ bool LoadBalancedProcessingPipeline::shouldProcessJob(
     return true;
   }
 
-  // Skip low priority jobs if resources are constrained
-  if (resources.resourceConstrained &&
-      (job.priority == ProcessingPriority::LOW ||
-       job.priority == ProcessingPriority::BACKGROUND)) {
-    return false;
+  // Skip low priority jobs if resources are constrained or the admission
+  // controller is shedding load to protect live sessions
+  if (job.priority == ProcessingPriority::LOW ||
+      job.priority == ProcessingPriority::BACKGROUND) {
+    if (resources.resourceConstrained) {
+      return false;
+    }
+    auto &admission = core::AdmissionController::getInstance();
+    if (!admission.canAcceptWork()) {
+      admission.recordShed();
+      return false;
+    }
   }
 
   // Check if job has timed out
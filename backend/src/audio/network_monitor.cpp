@@ -23,6 +23,7 @@ namespace audio {
 
 NetworkMonitor::NetworkMonitor()
     : monitoringIntervalMs_(1000), historySize_(60), monitoring_(false),
+      monitoringTimer_(speechrnt::utils::TimerService::INVALID_TIMER),
       currentQuality_(NetworkQuality::GOOD), totalMeasurements_(0),
       qualityChanges_(0) {}
 
@@ -50,8 +51,10 @@ bool NetworkMonitor::startMonitoring() {
   }
 
   monitoring_ = true;
-  monitoringThread_ =
-      std::make_unique<std::thread>(&NetworkMonitor::monitoringLoop, this);
+  monitoringTimer_ =
+      speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+          "network_monitor", std::chrono::milliseconds(monitoringIntervalMs_),
+          [this]() { runMeasurement(); }, true);
 
   speechrnt::utils::Logger::info("Network monitoring started");
   return true;
@@ -64,9 +67,8 @@ void NetworkMonitor::stopMonitoring() {
 
   monitoring_ = false;
 
-  if (monitoringThread_ && monitoringThread_->joinable()) {
-    monitoringThread_->join();
-  }
+  speechrnt::utils::TimerService::getInstance().cancel(monitoringTimer_);
+  monitoringTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
 
   speechrnt::utils::Logger::info("Network monitoring stopped");
 }
@@ -206,32 +208,23 @@ std::map<std::string, double> NetworkMonitor::getMonitoringStats() const {
   return stats;
 }
 
-void NetworkMonitor::monitoringLoop() {
-  speechrnt::utils::Logger::info("Network monitoring loop started");
-
-  while (monitoring_.load()) {
-    try {
-      NetworkMetrics metrics = measureNetworkConditions();
-      updateMetrics(metrics);
-
-      // Record performance metrics
-      speechrnt::utils::PerformanceMonitor::getInstance().recordLatency(
-          "network.latency_ms", metrics.latencyMs);
-      speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
-          "network.latency", metrics.latencyMs, "ms");
-      speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
-          "network.packet_loss", metrics.packetLossRate, "%");
+void NetworkMonitor::runMeasurement() {
+  try {
+    NetworkMetrics metrics = measureNetworkConditions();
+    updateMetrics(metrics);
 
-    } catch (const std::exception &e) {
-      speechrnt::utils::Logger::error("Network monitoring error: " +
-                                      std::string(e.what()));
-    }
+    // Record performance metrics
+    speechrnt::utils::PerformanceMonitor::getInstance().recordLatency(
+        "network.latency_ms", metrics.latencyMs);
+    speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
+        "network.latency", metrics.latencyMs, "ms");
+    speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
+        "network.packet_loss", metrics.packetLossRate, "%");
 
-    std::this_thread::sleep_for(
-        std::chrono::milliseconds(monitoringIntervalMs_));
+  } catch (const std::exception &e) {
+    speechrnt::utils::Logger::error("Network monitoring error: " +
+                                    std::string(e.what()));
   }
-
-  speechrnt::utils::Logger::info("Network monitoring loop stopped");
 }
 
 NetworkMetrics NetworkMonitor::measureNetworkConditions() {
@@ -0,0 +1,335 @@
+#include "audio/opus_codec.hpp"
+#include "utils/logging.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#ifdef OPUS_AVAILABLE
+#include <opus/opus.h>
+#endif
+
+namespace audio {
+
+namespace {
+
+constexpr std::array<int, 5> OPUS_SAMPLE_RATES = {8000, 12000, 16000, 24000,
+                                                  48000};
+
+// Largest packet the Opus spec allows, and the longest frame (120 ms @ 48 kHz)
+constexpr int MAX_PACKET_BYTES = 1275;
+constexpr int MAX_FRAME_SAMPLES = 5760;
+
+} // namespace
+
+bool OpusCodecConfig::isValid() const {
+  bool rateOk = std::find(OPUS_SAMPLE_RATES.begin(), OPUS_SAMPLE_RATES.end(),
+                          sampleRate) != OPUS_SAMPLE_RATES.end();
+  bool frameOk = frameDurationMs == 10 || frameDurationMs == 20 ||
+                 frameDurationMs == 40 || frameDurationMs == 60;
+  return rateOk && frameOk && (channels == 1 || channels == 2) &&
+         bitrate >= 6000 && bitrate <= 510000 && complexity >= 0 &&
+         complexity <= 10;
+}
+
+// OpusStreamDecoder implementation
+OpusStreamDecoder::OpusStreamDecoder()
+    : decoder_(nullptr), sampleRate_(0), channels_(1), lastFrameSamples_(0) {}
+
+OpusStreamDecoder::~OpusStreamDecoder() {
+#ifdef OPUS_AVAILABLE
+  if (decoder_) {
+    opus_decoder_destroy(static_cast<OpusDecoder *>(decoder_));
+  }
+#endif
+}
+
+bool OpusStreamDecoder::isAvailable() {
+#ifdef OPUS_AVAILABLE
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool OpusStreamDecoder::initialize(int sampleRate, int channels) {
+#ifdef OPUS_AVAILABLE
+  if (decoder_) {
+    opus_decoder_destroy(static_cast<OpusDecoder *>(decoder_));
+    decoder_ = nullptr;
+  }
+
+  int error = OPUS_OK;
+  decoder_ = opus_decoder_create(sampleRate, channels, &error);
+  if (error != OPUS_OK || !decoder_) {
+    decoder_ = nullptr;
+    lastError_ = std::string("opus_decoder_create failed: ") +
+                 opus_strerror(error);
+    return false;
+  }
+
+  sampleRate_ = sampleRate;
+  channels_ = channels;
+  lastFrameSamples_ = sampleRate / 50; // Assume 20 ms until the first packet
+  lastError_.clear();
+  return true;
+#else
+  (void)sampleRate;
+  (void)channels;
+  lastError_ = "Opus support not compiled in";
+  return false;
+#endif
+}
+
+bool OpusStreamDecoder::decode(std::string_view packet,
+                               std::vector<float> &samples) {
+#ifdef OPUS_AVAILABLE
+  if (!decoder_) {
+    lastError_ = "Decoder not initialized";
+    return false;
+  }
+
+  samples.resize(static_cast<size_t>(MAX_FRAME_SAMPLES) * channels_);
+  int decoded = opus_decode_float(
+      static_cast<OpusDecoder *>(decoder_),
+      reinterpret_cast<const unsigned char *>(packet.data()),
+      static_cast<opus_int32>(packet.size()), samples.data(),
+      MAX_FRAME_SAMPLES, 0);
+  if (decoded < 0) {
+    samples.clear();
+    lastError_ = std::string("opus_decode_float failed: ") +
+                 opus_strerror(decoded);
+    return false;
+  }
+
+  samples.resize(static_cast<size_t>(decoded) * channels_);
+  lastFrameSamples_ = decoded;
+  return true;
+#else
+  (void)packet;
+  samples.clear();
+  lastError_ = "Opus support not compiled in";
+  return false;
+#endif
+}
+
+bool OpusStreamDecoder::concealLoss(std::vector<float> &samples) {
+#ifdef OPUS_AVAILABLE
+  if (!decoder_) {
+    lastError_ = "Decoder not initialized";
+    return false;
+  }
+
+  samples.resize(static_cast<size_t>(lastFrameSamples_) * channels_);
+  int decoded = opus_decode_float(static_cast<OpusDecoder *>(decoder_),
+                                  nullptr, 0, samples.data(),
+                                  lastFrameSamples_, 0);
+  if (decoded < 0) {
+    samples.clear();
+    lastError_ = std::string("opus packet loss concealment failed: ") +
+                 opus_strerror(decoded);
+    return false;
+  }
+
+  samples.resize(static_cast<size_t>(decoded) * channels_);
+  return true;
+#else
+  samples.clear();
+  lastError_ = "Opus support not compiled in";
+  return false;
+#endif
+}
+
+void OpusStreamDecoder::reset() {
+#ifdef OPUS_AVAILABLE
+  if (decoder_) {
+    opus_decoder_ctl(static_cast<OpusDecoder *>(decoder_), OPUS_RESET_STATE);
+  }
+#endif
+}
+
+// OpusStreamEncoder implementation
+OpusStreamEncoder::OpusStreamEncoder()
+    : encoder_(nullptr), resamplePosition_(0.0), resampleLast_(0.0f) {}
+
+OpusStreamEncoder::~OpusStreamEncoder() {
+#ifdef OPUS_AVAILABLE
+  if (encoder_) {
+    opus_encoder_destroy(static_cast<OpusEncoder *>(encoder_));
+  }
+#endif
+}
+
+bool OpusStreamEncoder::initialize(const OpusCodecConfig &config) {
+  if (!config.isValid()) {
+    lastError_ = "Invalid Opus configuration";
+    return false;
+  }
+
+#ifdef OPUS_AVAILABLE
+  if (encoder_) {
+    opus_encoder_destroy(static_cast<OpusEncoder *>(encoder_));
+    encoder_ = nullptr;
+  }
+
+  int error = OPUS_OK;
+  auto *encoder = opus_encoder_create(config.sampleRate, config.channels,
+                                      OPUS_APPLICATION_VOIP, &error);
+  if (error != OPUS_OK || !encoder) {
+    lastError_ = std::string("opus_encoder_create failed: ") +
+                 opus_strerror(error);
+    return false;
+  }
+
+  opus_encoder_ctl(encoder, OPUS_SET_BITRATE(config.bitrate));
+  opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(config.complexity));
+  opus_encoder_ctl(encoder, OPUS_SET_INBAND_FEC(config.enableFec ? 1 : 0));
+  opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
+
+  encoder_ = encoder;
+  config_ = config;
+  pending_.clear();
+  pending_.reserve(static_cast<size_t>(config.getFrameSamples()) *
+                   config.channels * 2);
+  resamplePosition_ = 0.0;
+  resampleLast_ = 0.0f;
+  lastError_.clear();
+  return true;
+#else
+  lastError_ = "Opus support not compiled in";
+  return false;
+#endif
+}
+
+size_t OpusStreamEncoder::encode(const std::vector<float> &samples,
+                                 int inputSampleRate,
+                                 std::vector<std::vector<uint8_t>> &packets) {
+  if (!encoder_ || samples.empty() || inputSampleRate <= 0) {
+    return 0;
+  }
+
+  resample(samples, inputSampleRate);
+
+  const size_t frameValues =
+      static_cast<size_t>(config_.getFrameSamples()) * config_.channels;
+  size_t produced = 0;
+  size_t offset = 0;
+
+  while (pending_.size() - offset >= frameValues) {
+    if (encodeFrame(pending_.data() + offset, packets)) {
+      ++produced;
+    }
+    offset += frameValues;
+  }
+
+  pending_.erase(pending_.begin(), pending_.begin() + offset);
+  return produced;
+}
+
+size_t OpusStreamEncoder::flush(std::vector<std::vector<uint8_t>> &packets) {
+  if (!encoder_ || pending_.empty()) {
+    return 0;
+  }
+
+  const size_t frameValues =
+      static_cast<size_t>(config_.getFrameSamples()) * config_.channels;
+  pending_.resize(frameValues, 0.0f);
+
+  size_t produced = encodeFrame(pending_.data(), packets) ? 1 : 0;
+  pending_.clear();
+  resamplePosition_ = 0.0;
+  resampleLast_ = 0.0f;
+  return produced;
+}
+
+void OpusStreamEncoder::reset() {
+  pending_.clear();
+  resamplePosition_ = 0.0;
+  resampleLast_ = 0.0f;
+#ifdef OPUS_AVAILABLE
+  if (encoder_) {
+    opus_encoder_ctl(static_cast<OpusEncoder *>(encoder_), OPUS_RESET_STATE);
+  }
+#endif
+}
+
+bool OpusStreamEncoder::setBitrate(int bitrate) {
+#ifdef OPUS_AVAILABLE
+  if (!encoder_ || bitrate < 6000 || bitrate > 510000) {
+    return false;
+  }
+  if (opus_encoder_ctl(static_cast<OpusEncoder *>(encoder_),
+                       OPUS_SET_BITRATE(bitrate)) != OPUS_OK) {
+    return false;
+  }
+  config_.bitrate = bitrate;
+  return true;
+#else
+  (void)bitrate;
+  return false;
+#endif
+}
+
+int OpusStreamEncoder::nearestSupportedSampleRate(int sampleRate) {
+  // Prefer the next rate up so no bandwidth is lost, e.g. 22050 -> 24000
+  for (int rate : OPUS_SAMPLE_RATES) {
+    if (rate >= sampleRate) {
+      return rate;
+    }
+  }
+  return OPUS_SAMPLE_RATES.back();
+}
+
+void OpusStreamEncoder::resample(const std::vector<float> &input,
+                                 int inputSampleRate) {
+  // Mono-only resampling; multi-channel input must already be at codec rate
+  if (inputSampleRate == config_.sampleRate || config_.channels != 1) {
+    pending_.insert(pending_.end(), input.begin(), input.end());
+    return;
+  }
+
+  // Walk the stream [resampleLast_, input...] at the codec rate, carrying the
+  // fractional position across calls so block boundaries stay continuous
+  const double step =
+      static_cast<double>(inputSampleRate) / config_.sampleRate;
+  const double limit = static_cast<double>(input.size()) - 1.0;
+  double position = resamplePosition_;
+
+  while (position < limit) {
+    double base = std::floor(position);
+    auto index = static_cast<long>(base);
+    float frac = static_cast<float>(position - base);
+    float a = index < 0 ? resampleLast_ : input[static_cast<size_t>(index)];
+    float b = input[static_cast<size_t>(index + 1)];
+    pending_.push_back(a + (b - a) * frac);
+    position += step;
+  }
+
+  resamplePosition_ = position - static_cast<double>(input.size());
+  resampleLast_ = input.back();
+}
+
+bool OpusStreamEncoder::encodeFrame(
+    const float *frame, std::vector<std::vector<uint8_t>> &packets) {
+#ifdef OPUS_AVAILABLE
+  std::vector<uint8_t> packet(MAX_PACKET_BYTES);
+  opus_int32 bytes = opus_encode_float(
+      static_cast<OpusEncoder *>(encoder_), frame, config_.getFrameSamples(),
+      packet.data(), static_cast<opus_int32>(packet.size()));
+  if (bytes < 0) {
+    lastError_ = std::string("opus_encode_float failed: ") +
+                 opus_strerror(bytes);
+    speechrnt::utils::Logger::warn("OpusStreamEncoder: " + lastError_);
+    return false;
+  }
+
+  packet.resize(static_cast<size_t>(bytes));
+  packets.push_back(std::move(packet));
+  return true;
+#else
+  (void)frame;
+  (void)packets;
+  return false;
+#endif
+}
+
+} // namespace audio
@@ -340,6 +340,60 @@ size_t AudioChunkReorderBuffer::detectSequenceGaps(
   return missingSequences.size();
 }
 
+bool AudioChunkReorderBuffer::tryAdvanceInOrder(uint32_t sequenceNumber) {
+  std::lock_guard<std::mutex> lock(bufferMutex_);
+
+  if (sequenceNumber != expectedSequenceNumber_ || !reorderBuffer_.empty()) {
+    return false;
+  }
+
+  totalChunksReceived_++;
+  expectedSequenceNumber_++;
+  return true;
+}
+
+size_t AudioChunkReorderBuffer::skipStalledGap(int maxWaitMs) {
+  std::lock_guard<std::mutex> lock(bufferMutex_);
+
+  if (reorderBuffer_.empty() ||
+      reorderBuffer_.count(expectedSequenceNumber_) > 0) {
+    return 0;
+  }
+
+  uint32_t lowestSeq = reorderBuffer_.begin()->first;
+  if (lowestSeq <= expectedSequenceNumber_) {
+    return 0;
+  }
+
+  auto oldest = reorderBuffer_.begin()->second.timestamp;
+  for (const auto &pair : reorderBuffer_) {
+    oldest = std::min(oldest, pair.second.timestamp);
+  }
+
+  auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - oldest)
+                    .count();
+  if (waited < maxWaitMs) {
+    return 0;
+  }
+
+  size_t skipped = lowestSeq - expectedSequenceNumber_;
+  totalSequenceGaps_ += skipped;
+  expectedSequenceNumber_ = lowestSeq;
+  return skipped;
+}
+
+void AudioChunkReorderBuffer::setExpectedSequenceNumber(
+    uint32_t sequenceNumber) {
+  std::lock_guard<std::mutex> lock(bufferMutex_);
+  expectedSequenceNumber_ = sequenceNumber;
+}
+
+uint32_t AudioChunkReorderBuffer::getExpectedSequenceNumber() const {
+  std::lock_guard<std::mutex> lock(bufferMutex_);
+  return expectedSequenceNumber_;
+}
+
 std::map<std::string, double> AudioChunkReorderBuffer::getReorderStats() const {
   std::lock_guard<std::mutex> lock(bufferMutex_);
 
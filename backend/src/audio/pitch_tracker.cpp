@@ -0,0 +1,276 @@
+#include "audio/pitch_tracker.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace audio {
+
+namespace {
+
+constexpr float PI = 3.14159265358979323846f;
+
+size_t nextPowerOfTwo(size_t n) {
+    size_t size = 1;
+    while (size < n) {
+        size <<= 1;
+    }
+    return size;
+}
+
+// Relative change between the periods of two frequencies
+double periodChange(float from, float to) {
+    return std::abs(static_cast<double>(from) / to - 1.0);
+}
+
+} // namespace
+
+// PitchContour
+
+void PitchContour::add(const PitchEstimate& estimate) {
+    if (frames == 0) {
+        firstVoiced = estimate.voiced;
+    }
+    frames++;
+
+    if (estimate.voiced) {
+        float frequency = estimate.frequency;
+        voicedFrames++;
+        double delta = frequency - mean;
+        mean += delta / voicedFrames;
+        m2 += delta * (frequency - mean);
+
+        if (voicedFrames == 1) {
+            firstFrequency = frequency;
+            minFrequency = frequency;
+            maxFrequency = frequency;
+        } else {
+            minFrequency = std::min(minFrequency, frequency);
+            maxFrequency = std::max(maxFrequency, frequency);
+        }
+        if (lastVoiced) {
+            periodChangeSum += periodChange(lastFrequency, frequency);
+            periodChanges++;
+        }
+        lastFrequency = frequency;
+    }
+    lastVoiced = estimate.voiced;
+}
+
+void PitchContour::merge(const PitchContour& next) {
+    if (next.frames == 0) {
+        return;
+    }
+    if (frames == 0) {
+        *this = next;
+        return;
+    }
+
+    // The frames either side of the join are neighbours too
+    if (lastVoiced && next.firstVoiced) {
+        periodChangeSum += periodChange(lastFrequency, next.firstFrequency);
+        periodChanges++;
+    }
+    periodChangeSum += next.periodChangeSum;
+    periodChanges += next.periodChanges;
+
+    if (next.voicedFrames > 0) {
+        if (voicedFrames == 0) {
+            firstFrequency = next.firstFrequency;
+            minFrequency = next.minFrequency;
+            maxFrequency = next.maxFrequency;
+        } else {
+            minFrequency = std::min(minFrequency, next.minFrequency);
+            maxFrequency = std::max(maxFrequency, next.maxFrequency);
+        }
+        double total = static_cast<double>(voicedFrames + next.voicedFrames);
+        double delta = next.mean - mean;
+        m2 += next.m2 + delta * delta * voicedFrames * next.voicedFrames / total;
+        mean += delta * next.voicedFrames / total;
+        voicedFrames += next.voicedFrames;
+        lastFrequency = next.lastFrequency;
+    }
+
+    frames += next.frames;
+    lastVoiced = next.lastVoiced;
+}
+
+float PitchContour::stdDev() const {
+    return voicedFrames > 1 ? static_cast<float>(std::sqrt(m2 / (voicedFrames - 1))) : 0.0f;
+}
+
+// PitchTracker
+
+PitchTracker::PitchTracker(const PitchTrackerConfig& config)
+    : config_(config) {
+    config_.frameSize = std::max<size_t>(config_.frameSize, 64);
+    config_.hopSize = std::max<size_t>(1, std::min(config_.hopSize, config_.frameSize));
+
+    // Zero padding to twice the frame makes the circular autocorrelation linear
+    fftSize_ = nextPowerOfTwo(config_.frameSize * 2);
+    minLag_ = std::max<size_t>(2, static_cast<size_t>(config_.sampleRate / config_.maxFrequency));
+    maxLag_ = std::min(static_cast<size_t>(std::ceil(config_.sampleRate / config_.minFrequency)),
+                       config_.frameSize - 2);
+
+    bitReverse_.resize(fftSize_);
+    size_t bits = 0;
+    while ((size_t(1) << bits) < fftSize_) {
+        ++bits;
+    }
+    for (size_t i = 0; i < fftSize_; ++i) {
+        size_t reversed = 0;
+        for (size_t b = 0; b < bits; ++b) {
+            if (i & (size_t(1) << b)) {
+                reversed |= size_t(1) << (bits - 1 - b);
+            }
+        }
+        bitReverse_[i] = reversed;
+    }
+    twiddles_.resize(fftSize_ / 2);
+    for (size_t k = 0; k < twiddles_.size(); ++k) {
+        float angle = -2.0f * PI * static_cast<float>(k) / static_cast<float>(fftSize_);
+        twiddles_[k] = std::complex<float>(std::cos(angle), std::sin(angle));
+    }
+
+    pending_.resize(config_.frameSize);
+    spectrum_.resize(fftSize_);
+    nsdf_.resize(maxLag_ + 2);
+    keyMaxima_.reserve(maxLag_);
+}
+
+void PitchTracker::fft(std::vector<std::complex<float>>& data) const {
+    for (size_t i = 0; i < fftSize_; ++i) {
+        if (i < bitReverse_[i]) {
+            std::swap(data[i], data[bitReverse_[i]]);
+        }
+    }
+    for (size_t length = 2; length <= fftSize_; length <<= 1) {
+        size_t half = length / 2;
+        size_t stride = fftSize_ / length;
+        for (size_t start = 0; start < fftSize_; start += length) {
+            for (size_t k = 0; k < half; ++k) {
+                std::complex<float> odd = twiddles_[k * stride] * data[start + k + half];
+                data[start + k + half] = data[start + k] - odd;
+                data[start + k] += odd;
+            }
+        }
+    }
+}
+
+PitchEstimate PitchTracker::analyze(const float* samples, size_t count) {
+    PitchEstimate estimate;
+    count = std::min(count, config_.frameSize);
+    // Interpolation reads one lag past the longest period
+    if (count < maxLag_ + 2) {
+        return estimate;
+    }
+
+    double energy = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        energy += static_cast<double>(samples[i]) * samples[i];
+        spectrum_[i] = std::complex<float>(samples[i], 0.0f);
+    }
+    std::fill(spectrum_.begin() + count, spectrum_.end(), std::complex<float>(0.0f, 0.0f));
+    if (std::sqrt(energy / count) < config_.silenceRms) {
+        return estimate;
+    }
+
+    // r(tau) is the inverse transform of the power spectrum; the power
+    // spectrum is real and even, so a forward transform gives fftSize * r
+    fft(spectrum_);
+    for (auto& bin : spectrum_) {
+        bin = std::complex<float>(std::norm(bin), 0.0f);
+    }
+    fft(spectrum_);
+    float scale = 1.0f / static_cast<float>(fftSize_);
+
+    // NSDF n(tau) = 2 r(tau) / m(tau), m(tau) = sum x[j]^2 + x[j + tau]^2
+    double m = 2.0 * energy;
+    nsdf_[0] = 1.0f;
+    for (size_t lag = 1; lag <= maxLag_ + 1; ++lag) {
+        m -= static_cast<double>(samples[lag - 1]) * samples[lag - 1] +
+             static_cast<double>(samples[count - lag]) * samples[count - lag];
+        float r = spectrum_[lag].real() * scale;
+        nsdf_[lag] = m > 1e-12 ? static_cast<float>(2.0 * r / m) : 0.0f;
+    }
+
+    // Key maxima: the highest point of each positive lobe after the first
+    // negative-going zero crossing
+    keyMaxima_.clear();
+    size_t lag = 1;
+    while (lag <= maxLag_ && nsdf_[lag] > 0.0f) {
+        ++lag;
+    }
+    size_t best = 0;
+    float highest = 0.0f;
+    for (; lag <= maxLag_; ++lag) {
+        bool positive = nsdf_[lag] > 0.0f;
+        if (positive && (best == 0 || nsdf_[lag] > nsdf_[best])) {
+            best = lag;
+        }
+        if ((!positive || lag == maxLag_) && best != 0) {
+            if (best >= minLag_) {
+                keyMaxima_.push_back(best);
+                highest = std::max(highest, nsdf_[best]);
+            }
+            best = 0;
+        }
+    }
+    if (keyMaxima_.empty()) {
+        return estimate;
+    }
+
+    float threshold = config_.peakThreshold * highest;
+    size_t chosen = *std::find_if(keyMaxima_.begin(), keyMaxima_.end(),
+                                  [&](size_t key) { return nsdf_[key] >= threshold; });
+
+    // Parabolic interpolation around the chosen lag
+    float left = nsdf_[chosen - 1];
+    float centre = nsdf_[chosen];
+    float right = nsdf_[chosen + 1];
+    float denominator = left - 2.0f * centre + right;
+    float offset = std::abs(denominator) > 1e-12f ? 0.5f * (left - right) / denominator : 0.0f;
+    float period = static_cast<float>(chosen) + offset;
+    float clarity = centre - 0.25f * (left - right) * offset;
+
+    estimate.clarity = std::min(clarity, 1.0f);
+    float frequency = static_cast<float>(config_.sampleRate) / period;
+    if (estimate.clarity >= config_.clarityThreshold &&
+        frequency >= config_.minFrequency && frequency <= config_.maxFrequency) {
+        estimate.frequency = frequency;
+        estimate.voiced = true;
+    }
+    return estimate;
+}
+
+size_t PitchTracker::push(const float* samples, size_t count, const FrameCallback& onFrame) {
+    size_t frames = 0;
+    while (count > 0) {
+        size_t take = std::min(count, config_.frameSize - pendingCount_);
+        std::copy(samples, samples + take, pending_.begin() + pendingCount_);
+        pendingCount_ += take;
+        samples += take;
+        count -= take;
+
+        if (pendingCount_ == config_.frameSize) {
+            PitchEstimate estimate = analyze(pending_.data(), pendingCount_);
+            estimate.frameIndex = frameIndex_++;
+            contour_.add(estimate);
+            if (onFrame) {
+                onFrame(estimate);
+            }
+            frames++;
+
+            // Keep the overlap for the next frame
+            std::copy(pending_.begin() + config_.hopSize, pending_.end(), pending_.begin());
+            pendingCount_ -= config_.hopSize;
+        }
+    }
+    return frames;
+}
+
+void PitchTracker::reset() {
+    pendingCount_ = 0;
+    frameIndex_ = 0;
+    contour_.clear();
+}
+
+} // namespace audio
@@ -539,7 +539,9 @@ AudioQualityParams QualityDegradationManager::getParamsForQualityLevel(
 }
 
 AdaptiveQualityController::AdaptiveQualityController()
-    : controlActive_(false), updateIntervalMs_(2000),
+    : controlActive_(false),
+      controlTimer_(speechrnt::utils::TimerService::INVALID_TIMER),
+      updateIntervalMs_(2000),
       networkBasedControl_(true), resourceBasedControl_(true),
       cpuThreshold_(0.8f), memoryThreshold_(0.8f), latencyThreshold_(200.0f),
       currentCpuUsage_(0.0f), currentMemoryUsage_(0.0f),
@@ -573,8 +575,9 @@ bool AdaptiveQualityController::startAutoControl(int updateIntervalMs) {
 
   updateIntervalMs_ = updateIntervalMs;
   controlActive_ = true;
-  controlThread_ = std::make_unique<std::thread>(
-      &AdaptiveQualityController::controlLoop, this);
+  controlTimer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+      "audio.quality_control", std::chrono::milliseconds(updateIntervalMs_),
+      [this]() { runControlCycle(); }, true);
 
   speechrnt::utils::Logger::info("Adaptive quality control started with " +
                                  std::to_string(updateIntervalMs) +
@@ -589,9 +592,8 @@ void AdaptiveQualityController::stopAutoControl() {
 
   controlActive_ = false;
 
-  if (controlThread_ && controlThread_->joinable()) {
-    controlThread_->join();
-  }
+  speechrnt::utils::TimerService::getInstance().cancel(controlTimer_);
+  controlTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
 
   speechrnt::utils::Logger::info("Adaptive quality control stopped");
 }
@@ -660,23 +662,15 @@ AdaptiveQualityController::getControlStats() const {
   return stats;
 }
 
-void AdaptiveQualityController::controlLoop() {
-  speechrnt::utils::Logger::info("Adaptive quality control loop started");
-
-  while (controlActive_.load()) {
-    try {
-      performQualityControl();
-      totalControlCycles_++;
-
-    } catch (const std::exception &e) {
-      speechrnt::utils::Logger::error("Quality control error: " +
-                                      std::string(e.what()));
-    }
+void AdaptiveQualityController::runControlCycle() {
+  try {
+    performQualityControl();
+    totalControlCycles_++;
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(updateIntervalMs_));
+  } catch (const std::exception &e) {
+    speechrnt::utils::Logger::error("Quality control error: " +
+                                    std::string(e.what()));
   }
-
-  speechrnt::utils::Logger::info("Adaptive quality control loop stopped");
 }
 
 void AdaptiveQualityController::performQualityControl() {
@@ -31,11 +31,13 @@ bool CircularBuffer<T>::push(const std::vector<T> &items) {
     return false; // Not enough space
   }
 
-  for (const auto &item : items) {
-    buffer_[head_] = item;
-    head_ = (head_ + 1) % capacity_;
-    size_++;
-  }
+  // Copy in at most two runs, either side of the wrap
+  size_t head = head_;
+  size_t first = std::min(items.size(), capacity_ - head);
+  std::copy(items.begin(), items.begin() + first, buffer_.begin() + head);
+  std::copy(items.begin() + first, items.end(), buffer_.begin());
+  head_ = (head + items.size()) % capacity_;
+  size_ += items.size();
   return true;
 }
 
@@ -434,19 +436,22 @@ RealTimeAudioAnalyzer::RealTimeAudioAnalyzer(uint32_t sampleRate,
     : sampleRate_(sampleRate), bufferSize_(bufferSize),
       updateInterval_(std::chrono::milliseconds(50)), // 50ms update interval
       initialized_(false), running_(false), effectsEnabled_(false),
+      threading_(AnalysisThreading::WORKER), frameTablesVersion_(0),
+      featureSubscription_(0), featureBusAttached_(false),
       noiseFloorThreshold_(-60.0f), silenceThreshold_(0.01f),
       clippingThreshold_(0.95f), speechDetectionSensitivity_(0.5f),
+      frameFill_(0), frameVersion_(0), frameIndex_(0), samplesSinceNotify_(0),
       runningAverage_(0.0f), peakHold_(0.0f), spectralFluxAccumulator_(0.0f),
-      expectingAudio_(false) {
+      previousDropoutLevel_(0.0f), expectingAudio_(false) {
 
-  // Initialize buffers
-  audioBuffer_ = std::make_unique<CircularBuffer<float>>(bufferSize *
-                                                         10); // 10x buffer size
+  // Initialize buffers; the ring holds about ten frames between worker drains
+  audioRing_ =
+      std::make_unique<speechrnt::utils::SpscRingBuffer<float>>(bufferSize * 10);
   metricsBuffer_ = std::make_unique<CircularBuffer<RealTimeMetrics>>(
       1000); // Store 1000 metrics
 
   // Initialize processing components
-  fftProcessor_ = std::make_unique<RealTimeFFT>(bufferSize);
+  rebuildFrameTables();
 
   AudioEffectsConfig defaultEffectsConfig;
   effectsProcessor_ =
@@ -460,7 +465,10 @@ RealTimeAudioAnalyzer::RealTimeAudioAnalyzer(uint32_t sampleRate,
   lastPerformanceUpdate_ = std::chrono::steady_clock::now();
 }
 
-RealTimeAudioAnalyzer::~RealTimeAudioAnalyzer() { shutdown(); }
+RealTimeAudioAnalyzer::~RealTimeAudioAnalyzer() {
+  detachFeatureBus();
+  shutdown();
+}
 
 bool RealTimeAudioAnalyzer::initialize() {
   if (initialized_) {
@@ -468,10 +476,12 @@ bool RealTimeAudioAnalyzer::initialize() {
   }
 
   try {
-    // Start processing thread
+    // Start processing thread; in CALLER_THREAD mode producers analyse
     running_ = true;
-    processingThread_ = std::make_unique<std::thread>(
-        &RealTimeAudioAnalyzer::processingLoop, this);
+    if (threading_ == AnalysisThreading::WORKER) {
+      processingThread_ = std::make_unique<std::thread>(
+          &RealTimeAudioAnalyzer::processingLoop, this);
+    }
 
     initialized_ = true;
     return true;
@@ -491,38 +501,148 @@ void RealTimeAudioAnalyzer::shutdown() {
   if (processingThread_ && processingThread_->joinable()) {
     processingThread_->join();
   }
+  processingThread_.reset();
 
   initialized_ = false;
 }
 
+void RealTimeAudioAnalyzer::setAnalysisThreading(AnalysisThreading threading) {
+  if (initialized_) {
+    return;
+  }
+  threading_ = threading;
+}
+
 void RealTimeAudioAnalyzer::processAudioSample(float sample) {
-  if (!initialized_) {
+  // With a feature bus attached, frames arrive through the bus instead
+  if (!initialized_ || featureBusAttached_) {
     return;
   }
 
-  audioBuffer_->push(sample);
-  lastAudioTime_ = std::chrono::steady_clock::now();
-  expectingAudio_ = true;
+  enqueueAudio(&sample, 1);
 }
 
 void RealTimeAudioAnalyzer::processAudioChunk(const std::vector<float> &chunk) {
-  if (!initialized_ || chunk.empty()) {
+  processAudioChunk(chunk.data(), chunk.size());
+}
+
+void RealTimeAudioAnalyzer::processAudioChunk(const float *samples,
+                                              size_t count) {
+  if (!initialized_ || !samples || count == 0 || featureBusAttached_) {
     return;
   }
 
-  audioBuffer_->push(chunk);
   lastAudioTime_ = std::chrono::steady_clock::now();
   expectingAudio_ = true;
+  enqueueAudio(samples, count);
 }
 
-void RealTimeAudioAnalyzer::processAudioChunk(const float *samples,
-                                              size_t count) {
-  if (!initialized_ || !samples || count == 0) {
+void RealTimeAudioAnalyzer::enqueueAudio(const float *samples, size_t count) {
+  if (threading_ == AnalysisThreading::CALLER_THREAD) {
+    std::lock_guard<std::mutex> lock(frameMutex_);
+    assembleFrames(samples, count);
+    return;
+  }
+
+  size_t written = audioRing_->push(samples, count);
+  if (written < count) {
+    std::lock_guard<std::mutex> lock(performanceMutex_);
+    performanceMetrics_.droppedSamples += count - written;
+  }
+}
+
+void RealTimeAudioAnalyzer::assembleFrames(const float *samples,
+                                           size_t count) {
+  refreshFrame();
+  while (count > 0) {
+    size_t take = std::min(count, frameBuffer_.size() - frameFill_);
+    std::memcpy(frameBuffer_.data() + frameFill_, samples,
+                take * sizeof(float));
+    frameFill_ += take;
+    samples += take;
+    count -= take;
+
+    if (frameFill_ == frameBuffer_.size()) {
+      analyzeBufferedFrame();
+    }
+  }
+}
+
+size_t RealTimeAudioAnalyzer::drainAudioRing() {
+  refreshFrame();
+  size_t frames = 0;
+  while (true) {
+    frameFill_ += audioRing_->pop(frameBuffer_.data() + frameFill_,
+                                  frameBuffer_.size() - frameFill_);
+    if (frameFill_ < frameBuffer_.size()) {
+      return frames;
+    }
+    analyzeBufferedFrame();
+    frames++;
+  }
+}
+
+void RealTimeAudioAnalyzer::refreshFrame() {
+  uint64_t version = frameTablesVersion_.load(std::memory_order_acquire);
+  if (frame_ && frameVersion_ == version) {
+    return;
+  }
+
+  auto tables = std::atomic_load(&frameTables_);
+  frame_ = std::make_unique<FrameFeatures>(tables);
+  frameVersion_ = version;
+
+  size_t frameSize = std::max<size_t>(tables->getConfig().frameSize, 1);
+  frameBuffer_.resize(frameSize);
+  frameFill_ = std::min(frameFill_, frameSize);
+}
+
+void RealTimeAudioAnalyzer::analyzeBufferedFrame() {
+  auto startTime = std::chrono::steady_clock::now();
+
+  frame_->assign(frameBuffer_.data(), frameFill_, frameIndex_++);
+  analyzeFrame(*frame_);
+  size_t analyzed = frameFill_;
+  frameFill_ = 0;
+
+  auto processingTime = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - startTime);
+  updatePerformanceMetrics(processingTime, analyzed);
+}
+
+void RealTimeAudioAnalyzer::attachFeatureBus(
+    std::shared_ptr<FrameFeatureBus> bus) {
+  detachFeatureBus();
+  if (!bus) {
     return;
   }
 
-  std::vector<float> chunk(samples, samples + count);
-  processAudioChunk(chunk);
+  std::lock_guard<std::mutex> lock(featureBusMutex_);
+  featureBus_ = std::move(bus);
+  featureSubscription_ = featureBus_->subscribe(
+      getRequiredFeatures(), [this](FrameFeatures &frame) {
+        lastAudioTime_ = std::chrono::steady_clock::now();
+        expectingAudio_ = true;
+        analyzeFrame(frame);
+      });
+  featureBusAttached_ = true;
+}
+
+void RealTimeAudioAnalyzer::detachFeatureBus() {
+  std::lock_guard<std::mutex> lock(featureBusMutex_);
+  if (featureBus_) {
+    featureBus_->unsubscribe(featureSubscription_);
+    featureBus_.reset();
+  }
+  featureBusAttached_ = false;
+}
+
+FrameFeatureSet RealTimeAudioAnalyzer::getRequiredFeatures() {
+  return FrameFeature::RMS | FrameFeature::PEAK |
+         FrameFeature::MAGNITUDE_SPECTRUM | FrameFeature::POWER_SPECTRUM |
+         FrameFeature::SPECTRAL_CENTROID | FrameFeature::SPECTRAL_BANDWIDTH |
+         FrameFeature::SPECTRAL_ROLLOFF | FrameFeature::SPECTRAL_FLATNESS |
+         FrameFeature::MFCC;
 }
 
 RealTimeMetrics RealTimeAudioAnalyzer::getCurrentMetrics() const {
@@ -590,13 +710,22 @@ void RealTimeAudioAnalyzer::updateEffectsConfig(
 
 void RealTimeAudioAnalyzer::setSampleRate(uint32_t sampleRate) {
   sampleRate_ = sampleRate;
+  rebuildFrameTables();
 }
 
 void RealTimeAudioAnalyzer::setBufferSize(size_t bufferSize) {
   bufferSize_ = bufferSize;
-  if (fftProcessor_) {
-    fftProcessor_->setFFTSize(bufferSize);
-  }
+  rebuildFrameTables();
+}
+
+void RealTimeAudioAnalyzer::rebuildFrameTables() {
+  FrameAnalysisConfig config;
+  config.sampleRate = static_cast<int>(sampleRate_);
+  config.frameSize = bufferSize_;
+  config.hopSize = bufferSize_;
+  // Swapped atomically; the processing thread may be reading the old tables
+  std::atomic_store(&frameTables_, FrameAnalysisTables::create(config));
+  frameTablesVersion_.fetch_add(1, std::memory_order_release);
 }
 
 void RealTimeAudioAnalyzer::setUpdateInterval(
@@ -606,71 +735,77 @@ void RealTimeAudioAnalyzer::setUpdateInterval(
 
 void RealTimeAudioAnalyzer::processingLoop() {
   while (running_) {
-    auto startTime = std::chrono::steady_clock::now();
-
-    // Get audio samples for analysis
-    auto samples = audioBuffer_->getLatest(bufferSize_);
-
-    if (!samples.empty()) {
-      // Update level metrics
-      updateLevelMetrics(samples);
+    // Analyse every whole frame queued since the last pass; with a feature
+    // bus attached, frames are analysed as they are published
+    if (!featureBusAttached_) {
+      drainAudioRing();
+    }
 
-      // Update spectral analysis
-      updateSpectralAnalysis(samples);
+    // Sleep until next update
+    std::this_thread::sleep_for(updateInterval_);
+  }
+}
 
-      // Update noise estimation
-      updateNoiseEstimation(samples);
+void RealTimeAudioAnalyzer::analyzeFrame(FrameFeatures &frame) {
+  if (frame.size() == 0) {
+    return;
+  }
 
-      // Update speech detection
-      updateSpeechDetection(currentLevels_, currentSpectral_);
+  // Update level metrics
+  updateLevelMetrics(frame);
 
-      // Detect dropouts
-      detectDropouts(samples);
+  // Update spectral analysis
+  updateSpectralAnalysis(frame);
 
-      // Update current metrics
-      {
-        std::lock_guard<std::mutex> lock(metricsMutex_);
-        currentMetrics_.levels = currentLevels_;
-        currentMetrics_.spectral = currentSpectral_;
-        currentMetrics_.timestampMs =
-            std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::steady_clock::now().time_since_epoch())
-                .count();
-        currentMetrics_.sequenceNumber++;
-      }
+  // Update noise estimation
+  updateNoiseEstimation(frame);
 
-      // Store metrics in history
-      metricsBuffer_->push(currentMetrics_);
+  // Update speech detection
+  updateSpeechDetection(currentLevels_, currentSpectral_);
 
-      // Notify callbacks
-      notifyMetricsCallbacks(currentMetrics_);
-      notifyLevelsCallbacks(currentLevels_);
-      notifySpectralCallbacks(currentSpectral_);
-    }
+  // Detect dropouts
+  detectDropouts(frame);
 
-    // Update performance metrics
-    auto endTime = std::chrono::steady_clock::now();
-    auto processingTime = std::chrono::duration_cast<std::chrono::microseconds>(
-        endTime - startTime);
-    updatePerformanceMetrics(processingTime);
+  // Update current metrics
+  {
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+    currentMetrics_.levels = currentLevels_;
+    currentMetrics_.spectral = currentSpectral_;
+    currentMetrics_.timestampMs =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    currentMetrics_.sequenceNumber++;
+  }
 
-    // Sleep until next update
-    std::this_thread::sleep_for(updateInterval_);
+  // Store metrics in history, dropping the oldest once full
+  RealTimeMetrics oldest;
+  if (metricsBuffer_->full()) {
+    metricsBuffer_->pop(oldest);
   }
-}
+  metricsBuffer_->push(currentMetrics_);
 
-void RealTimeAudioAnalyzer::updateLevelMetrics(
-    const std::vector<float> &samples) {
-  if (samples.empty()) {
+  // Notify callbacks at most once per update interval of audio
+  samplesSinceNotify_ += frame.size();
+  size_t notifyInterval =
+      static_cast<size_t>(updateInterval_.count()) * sampleRate_ / 1000;
+  if (samplesSinceNotify_ < notifyInterval) {
     return;
   }
+  samplesSinceNotify_ = 0;
 
+  notifyMetricsCallbacks(currentMetrics_);
+  notifyLevelsCallbacks(currentLevels_);
+  notifySpectralCallbacks(currentSpectral_);
+}
+
+void RealTimeAudioAnalyzer::updateLevelMetrics(FrameFeatures &frame) {
   // Calculate RMS level
-  float rms = calculateRMS(samples);
+  float rms = frame.rms();
   currentLevels_.currentLevel = rms;
 
   // Calculate peak level
-  float peak = calculatePeak(samples);
+  float peak = frame.peak();
   currentLevels_.peakLevel = peak;
 
   // Update running average
@@ -693,37 +828,24 @@ void RealTimeAudioAnalyzer::updateLevelMetrics(
   currentLevels_.peakHoldLevel = peakHold_;
 
   // Detect clipping and silence
-  currentLevels_.clipping = detectClipping(samples, clippingThreshold_);
-  currentLevels_.silence = detectSilence(samples, silenceThreshold_);
+  currentLevels_.clipping = peak >= clippingThreshold_;
+  currentLevels_.silence = rms < silenceThreshold_;
 
   // Update level history
   levelHistory_.erase(levelHistory_.begin());
   levelHistory_.push_back(rms);
 }
 
-void RealTimeAudioAnalyzer::updateSpectralAnalysis(
-    const std::vector<float> &samples) {
-  if (samples.empty() || !fftProcessor_) {
-    return;
-  }
-
-  // Compute power spectrum
-  auto powerSpectrum = fftProcessor_->computePowerSpectrum(samples);
-  currentSpectral_.powerSpectrum = powerSpectrum;
-
-  // Compute magnitude spectrum
-  auto magnitudeSpectrum = fftProcessor_->computeMagnitudeSpectrum(samples);
+void RealTimeAudioAnalyzer::updateSpectralAnalysis(FrameFeatures &frame) {
+  // Spectra and spectral features come from the frame's single FFT
+  currentSpectral_.powerSpectrum = frame.powerSpectrum();
+  const auto &magnitudeSpectrum = frame.magnitudeSpectrum();
   currentSpectral_.frequencySpectrum = magnitudeSpectrum;
 
-  // Calculate spectral features
-  currentSpectral_.spectralCentroid =
-      calculateSpectralCentroid(magnitudeSpectrum, sampleRate_);
-  currentSpectral_.spectralBandwidth = calculateSpectralBandwidth(
-      magnitudeSpectrum, currentSpectral_.spectralCentroid, sampleRate_);
-  currentSpectral_.spectralRolloff =
-      calculateSpectralRolloff(magnitudeSpectrum, sampleRate_);
-  currentSpectral_.spectralFlatness =
-      calculateSpectralFlatness(magnitudeSpectrum);
+  currentSpectral_.spectralCentroid = frame.spectralCentroid();
+  currentSpectral_.spectralBandwidth = frame.spectralBandwidth();
+  currentSpectral_.spectralRolloff = frame.spectralRolloff();
+  currentSpectral_.spectralFlatness = frame.spectralFlatness();
 
   // Calculate spectral flux
   if (!previousSpectrum_.empty()) {
@@ -737,23 +859,14 @@ void RealTimeAudioAnalyzer::updateSpectralAnalysis(
       std::max_element(magnitudeSpectrum.begin(), magnitudeSpectrum.end());
   if (maxIt != magnitudeSpectrum.end()) {
     size_t maxBin = std::distance(magnitudeSpectrum.begin(), maxIt);
-    currentSpectral_.dominantFrequency =
-        fftProcessor_->getFrequencyBin(maxBin, sampleRate_);
+    currentSpectral_.dominantFrequency = frame.binFrequency(maxBin);
   }
 
-  // Calculate MFCC coefficients (simplified)
-  currentSpectral_.mfccCoefficients =
-      calculateMFCC(magnitudeSpectrum, sampleRate_);
+  currentSpectral_.mfccCoefficients = frame.mfcc();
 }
 
-void RealTimeAudioAnalyzer::updateNoiseEstimation(
-    const std::vector<float> &samples) {
-  if (samples.empty()) {
-    return;
-  }
-
-  float noiseLevel = estimateNoiseLevel(samples);
-  currentMetrics_.noiseLevel = noiseLevel;
+void RealTimeAudioAnalyzer::updateNoiseEstimation(FrameFeatures &frame) {
+  currentMetrics_.noiseLevel = estimateNoiseLevel(frame.rms());
 }
 
 void RealTimeAudioAnalyzer::updateSpeechDetection(
@@ -764,14 +877,10 @@ void RealTimeAudioAnalyzer::updateSpeechDetection(
   currentMetrics_.voiceActivityScore = speechProb;
 }
 
-void RealTimeAudioAnalyzer::detectDropouts(const std::vector<float> &samples) {
+void RealTimeAudioAnalyzer::detectDropouts(FrameFeatures &frame) {
   // Simple dropout detection based on sudden level drops
-  if (samples.empty()) {
-    return;
-  }
-
-  float currentLevel = calculateRMS(samples);
-  static float previousLevel = currentLevel;
+  float currentLevel = frame.rms();
+  float previousLevel = previousDropoutLevel_;
 
   // Detect sudden level drop
   if (previousLevel > 0.1f && currentLevel < 0.01f) {
@@ -781,7 +890,7 @@ void RealTimeAudioAnalyzer::detectDropouts(const std::vector<float> &samples) {
             std::chrono::steady_clock::now().time_since_epoch())
             .count();
     dropout.durationMs =
-        static_cast<float>(samples.size()) / sampleRate_ * 1000.0f;
+        static_cast<float>(frame.size()) / sampleRate_ * 1000.0f;
     dropout.severityScore = (previousLevel - currentLevel) / previousLevel;
     dropout.description = "Audio level dropout detected";
 
@@ -798,11 +907,11 @@ void RealTimeAudioAnalyzer::detectDropouts(const std::vector<float> &samples) {
                             detectedDropouts_.end());
   }
 
-  previousLevel = currentLevel;
+  previousDropoutLevel_ = currentLevel;
 }
 
 void RealTimeAudioAnalyzer::updatePerformanceMetrics(
-    std::chrono::microseconds processingTime) {
+    std::chrono::microseconds processingTime, size_t samplesProcessed) {
   std::lock_guard<std::mutex> lock(performanceMutex_);
 
   float processingTimeMs = processingTime.count() / 1000.0f;
@@ -817,111 +926,18 @@ void RealTimeAudioAnalyzer::updatePerformanceMetrics(
     performanceMetrics_.maxProcessingTimeMs = processingTimeMs;
   }
 
-  performanceMetrics_.totalSamplesProcessed += bufferSize_;
-}
-
-// Helper function implementations
-float RealTimeAudioAnalyzer::calculateRMS(const std::vector<float> &samples) {
-  if (samples.empty())
-    return 0.0f;
-
-  float sum = 0.0f;
-  for (float sample : samples) {
-    sum += sample * sample;
-  }
-  return std::sqrt(sum / samples.size());
-}
-
-float RealTimeAudioAnalyzer::calculatePeak(const std::vector<float> &samples) {
-  if (samples.empty())
-    return 0.0f;
-
-  float peak = 0.0f;
-  for (float sample : samples) {
-    peak = std::max(peak, std::abs(sample));
-  }
-  return peak;
-}
-
-float RealTimeAudioAnalyzer::calculateSpectralCentroid(
-    const std::vector<float> &spectrum, uint32_t sampleRate) {
-  if (spectrum.empty())
-    return 0.0f;
-
-  float weightedSum = 0.0f;
-  float magnitudeSum = 0.0f;
-
-  for (size_t i = 0; i < spectrum.size(); ++i) {
-    float frequency = fftProcessor_->getFrequencyBin(i, sampleRate);
-    weightedSum += frequency * spectrum[i];
-    magnitudeSum += spectrum[i];
-  }
-
-  return magnitudeSum > 0.0f ? weightedSum / magnitudeSum : 0.0f;
-}
-
-float RealTimeAudioAnalyzer::calculateSpectralBandwidth(
-    const std::vector<float> &spectrum, float centroid, uint32_t sampleRate) {
-  if (spectrum.empty())
-    return 0.0f;
-
-  float weightedSum = 0.0f;
-  float magnitudeSum = 0.0f;
-
-  for (size_t i = 0; i < spectrum.size(); ++i) {
-    float frequency = fftProcessor_->getFrequencyBin(i, sampleRate);
-    float deviation = frequency - centroid;
-    weightedSum += deviation * deviation * spectrum[i];
-    magnitudeSum += spectrum[i];
-  }
-
-  return magnitudeSum > 0.0f ? std::sqrt(weightedSum / magnitudeSum) : 0.0f;
-}
-
-float RealTimeAudioAnalyzer::calculateSpectralRolloff(
-    const std::vector<float> &spectrum, uint32_t sampleRate,
-    float rolloffPercent) {
-  if (spectrum.empty())
-    return 0.0f;
-
-  float totalEnergy = std::accumulate(spectrum.begin(), spectrum.end(), 0.0f);
-  float targetEnergy = totalEnergy * rolloffPercent;
-
-  float cumulativeEnergy = 0.0f;
-  for (size_t i = 0; i < spectrum.size(); ++i) {
-    cumulativeEnergy += spectrum[i];
-    if (cumulativeEnergy >= targetEnergy) {
-      return fftProcessor_->getFrequencyBin(i, sampleRate);
-    }
+  // Analysis time as a share of the audio's duration
+  if (samplesProcessed > 0 && sampleRate_ > 0) {
+    float audioMs = samplesProcessed * 1000.0f / sampleRate_;
+    performanceMetrics_.cpuUsagePercent =
+        0.9f * performanceMetrics_.cpuUsagePercent +
+        0.1f * (processingTimeMs / audioMs * 100.0f);
   }
 
-  return fftProcessor_->getFrequencyBin(spectrum.size() - 1, sampleRate);
-}
-
-float RealTimeAudioAnalyzer::calculateSpectralFlatness(
-    const std::vector<float> &spectrum) {
-  if (spectrum.empty())
-    return 0.0f;
-
-  float geometricMean = 1.0f;
-  float arithmeticMean = 0.0f;
-  size_t validBins = 0;
-
-  for (float magnitude : spectrum) {
-    if (magnitude > 0.0f) {
-      geometricMean *= std::pow(magnitude, 1.0f / spectrum.size());
-      arithmeticMean += magnitude;
-      validBins++;
-    }
-  }
-
-  if (validBins == 0)
-    return 0.0f;
-
-  arithmeticMean /= validBins;
-  return arithmeticMean > 0.0f ? geometricMean / arithmeticMean : 0.0f;
+  performanceMetrics_.totalSamplesProcessed += samplesProcessed;
 }
 
+// Helper function implementations
 float RealTimeAudioAnalyzer::calculateSpectralFlux(
     const std::vector<float> &currentSpectrum,
     const std::vector<float> &previousSpectrum) {
@@ -937,34 +953,9 @@ float RealTimeAudioAnalyzer::calculateSpectralFlux(
   return std::sqrt(flux);
 }
 
-std::vector<float>
-RealTimeAudioAnalyzer::calculateMFCC(const std::vector<float> &spectrum,
-                                     uint32_t sampleRate) {
-  // Simplified MFCC calculation - in a real implementation, this would use
-  // mel-scale filtering
-  std::vector<float> mfcc(13, 0.0f);
-
-  if (spectrum.empty())
-    return mfcc;
-
-  // Simple approximation: use log of spectrum bins as MFCC coefficients
-  size_t step = spectrum.size() / 13;
-  for (size_t i = 0; i < 13 && i * step < spectrum.size(); ++i) {
-    float value = spectrum[i * step];
-    mfcc[i] = value > 0.0f ? std::log(value + 1e-10f) : -10.0f;
-  }
-
-  return mfcc;
-}
-
-float RealTimeAudioAnalyzer::estimateNoiseLevel(
-    const std::vector<float> &samples) {
-  if (samples.empty())
-    return noiseFloorThreshold_;
-
-  // Simple noise estimation: use minimum RMS over a sliding window
-  float rms = calculateRMS(samples);
-  float noiseEstimate = std::min(rms, 0.1f); // Cap at reasonable level
+float RealTimeAudioAnalyzer::estimateNoiseLevel(float rms) {
+  // Simple noise estimation: frame RMS capped at a reasonable level
+  float noiseEstimate = std::min(rms, 0.1f);
 
   // Convert to dB
   return 20.0f * std::log10(noiseEstimate + 1e-10f);
@@ -983,22 +974,6 @@ float RealTimeAudioAnalyzer::calculateSpeechProbability(
   return (levelScore + spectralScore + bandwidthScore) / 3.0f;
 }
 
-bool RealTimeAudioAnalyzer::detectClipping(const std::vector<float> &samples,
-                                           float threshold) {
-  for (float sample : samples) {
-    if (std::abs(sample) >= threshold) {
-      return true;
-    }
-  }
-  return false;
-}
-
-bool RealTimeAudioAnalyzer::detectSilence(const std::vector<float> &samples,
-                                          float threshold) {
-  float rms = calculateRMS(samples);
-  return rms < threshold;
-}
-
 void RealTimeAudioAnalyzer::notifyMetricsCallbacks(
     const RealTimeMetrics &metrics) {
   std::lock_guard<std::mutex> lock(callbackMutex_);
@@ -0,0 +1,345 @@
+#include "audio/signal_statistics.hpp"
+#include <algorithm>
+#include <atomic>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SPEECHRNT_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define SPEECHRNT_X86_KERNELS 0
+#endif
+
+namespace audio {
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SCALAR: return "scalar";
+        case SimdLevel::SSE2: return "sse2";
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+namespace {
+
+// Running state carried across kernel blocks and into the scalar tail
+struct Accumulator {
+    SignalStats stats;
+    size_t currentRun = 0;
+    bool previousNegative = false;
+
+    void closeRun() {
+        if (currentRun > 0) {
+            stats.silenceRuns++;
+            stats.longestSilenceRun = std::max(stats.longestSilenceRun, currentRun);
+            currentRun = 0;
+        }
+    }
+
+    void scalar(const float* samples, size_t count, const SignalStatsThresholds& thresholds) {
+        double sumSquares = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            float sample = samples[i];
+            float magnitude = std::fabs(sample);
+            sumSquares += static_cast<double>(sample) * sample;
+            stats.peak = std::max(stats.peak, magnitude);
+
+            bool negative = sample < 0.0f;
+            if (negative != previousNegative) {
+                stats.zeroCrossings++;
+            }
+            previousNegative = negative;
+
+            if (magnitude >= thresholds.clipping) {
+                stats.clippedSamples++;
+            }
+            if (magnitude < thresholds.silence) {
+                stats.silentSamples++;
+                currentRun++;
+            } else {
+                closeRun();
+            }
+        }
+        stats.sumSquares += sumSquares;
+    }
+
+#if SPEECHRNT_X86_KERNELS
+    // Silent lanes of one vector; bit i is lane i, the earlier sample.
+    // Walks whole runs rather than lanes
+    void silence(uint32_t silent, unsigned width) {
+        uint32_t lanes = (1u << width) - 1u;
+        if (silent == lanes) {
+            currentRun += width;
+            return;
+        }
+        unsigned lane = 0;
+        while (lane < width) {
+            uint32_t rest = silent >> lane;
+            if (rest == 0) {
+                closeRun();
+                return;
+            }
+            unsigned gap = static_cast<unsigned>(__builtin_ctz(rest));
+            if (gap > 0) {
+                closeRun();
+                lane += gap;
+                rest >>= gap;
+            }
+            unsigned run = static_cast<unsigned>(__builtin_ctz(~rest));
+            currentRun += run;
+            lane += run;
+        }
+    }
+#endif
+
+    SignalStats finish() {
+        closeRun();
+        return stats;
+    }
+};
+
+// Samples summed in float lanes before folding into the double total
+constexpr size_t FLUSH_SAMPLES = 1024;
+
+// Kernels process whole vectors and return how many samples they consumed.
+// samples[-1] must be readable: crossings compare against the previous sample
+using Kernel = size_t (*)(Accumulator&, const float*, size_t, const SignalStatsThresholds&);
+
+size_t scalarKernel(Accumulator&, const float*, size_t, const SignalStatsThresholds&) {
+    return 0;
+}
+
+#if SPEECHRNT_X86_KERNELS
+
+__attribute__((target("sse2")))
+size_t sse2Kernel(Accumulator& acc, const float* samples, size_t count, const SignalStatsThresholds& thresholds) {
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 clip = _mm_set1_ps(thresholds.clipping);
+    const __m128 quiet = _mm_set1_ps(thresholds.silence);
+    __m128 peak = zero;
+
+    size_t vectorEnd = count - count % 4;
+    size_t i = 0;
+    while (i < vectorEnd) {
+        size_t blockEnd = std::min(vectorEnd, i + FLUSH_SAMPLES);
+        __m128 sum = zero;
+        // Compare masks are -1 per matching lane, so subtracting counts them
+        __m128i crossings = _mm_setzero_si128();
+        __m128i clipped = _mm_setzero_si128();
+        __m128i silent = _mm_setzero_si128();
+        for (; i < blockEnd; i += 4) {
+            __m128 x = _mm_loadu_ps(samples + i);
+            __m128 previous = _mm_loadu_ps(samples + i - 1);
+            __m128 magnitude = _mm_andnot_ps(signBit, x);
+            sum = _mm_add_ps(sum, _mm_mul_ps(x, x));
+            peak = _mm_max_ps(peak, magnitude);
+
+            __m128 crossed = _mm_xor_ps(_mm_cmplt_ps(x, zero), _mm_cmplt_ps(previous, zero));
+            crossings = _mm_sub_epi32(crossings, _mm_castps_si128(crossed));
+            clipped = _mm_sub_epi32(clipped, _mm_castps_si128(_mm_cmpge_ps(magnitude, clip)));
+            __m128 quietLanes = _mm_cmplt_ps(magnitude, quiet);
+            silent = _mm_sub_epi32(silent, _mm_castps_si128(quietLanes));
+            acc.silence(static_cast<uint32_t>(_mm_movemask_ps(quietLanes)), 4);
+        }
+
+        alignas(16) float sums[4];
+        alignas(16) int32_t counts[3][4];
+        _mm_store_ps(sums, sum);
+        _mm_store_si128(reinterpret_cast<__m128i*>(counts[0]), crossings);
+        _mm_store_si128(reinterpret_cast<__m128i*>(counts[1]), clipped);
+        _mm_store_si128(reinterpret_cast<__m128i*>(counts[2]), silent);
+        for (int lane = 0; lane < 4; ++lane) {
+            acc.stats.sumSquares += sums[lane];
+            acc.stats.zeroCrossings += counts[0][lane];
+            acc.stats.clippedSamples += counts[1][lane];
+            acc.stats.silentSamples += counts[2][lane];
+        }
+    }
+
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, peak);
+    for (float lane : lanes) {
+        acc.stats.peak = std::max(acc.stats.peak, lane);
+    }
+    return vectorEnd;
+}
+
+__attribute__((target("avx2")))
+size_t avx2Kernel(Accumulator& acc, const float* samples, size_t count, const SignalStatsThresholds& thresholds) {
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 clip = _mm256_set1_ps(thresholds.clipping);
+    const __m256 quiet = _mm256_set1_ps(thresholds.silence);
+    __m256 peak = zero;
+
+    size_t vectorEnd = count - count % 8;
+    size_t i = 0;
+    while (i < vectorEnd) {
+        size_t blockEnd = std::min(vectorEnd, i + FLUSH_SAMPLES);
+        __m256 sum = zero;
+        __m256i crossings = _mm256_setzero_si256();
+        __m256i clipped = _mm256_setzero_si256();
+        __m256i silent = _mm256_setzero_si256();
+        for (; i < blockEnd; i += 8) {
+            __m256 x = _mm256_loadu_ps(samples + i);
+            __m256 previous = _mm256_loadu_ps(samples + i - 1);
+            __m256 magnitude = _mm256_andnot_ps(signBit, x);
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(x, x));
+            peak = _mm256_max_ps(peak, magnitude);
+
+            __m256 crossed = _mm256_xor_ps(_mm256_cmp_ps(x, zero, _CMP_LT_OQ),
+                                           _mm256_cmp_ps(previous, zero, _CMP_LT_OQ));
+            crossings = _mm256_sub_epi32(crossings, _mm256_castps_si256(crossed));
+            clipped = _mm256_sub_epi32(clipped, _mm256_castps_si256(_mm256_cmp_ps(magnitude, clip, _CMP_GE_OQ)));
+            __m256 quietLanes = _mm256_cmp_ps(magnitude, quiet, _CMP_LT_OQ);
+            silent = _mm256_sub_epi32(silent, _mm256_castps_si256(quietLanes));
+            acc.silence(static_cast<uint32_t>(_mm256_movemask_ps(quietLanes)), 8);
+        }
+
+        alignas(32) float sums[8];
+        alignas(32) int32_t counts[3][8];
+        _mm256_store_ps(sums, sum);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts[0]), crossings);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts[1]), clipped);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts[2]), silent);
+        double blockSum = 0.0;
+        for (int lane = 0; lane < 8; ++lane) {
+            blockSum += sums[lane];
+            acc.stats.zeroCrossings += counts[0][lane];
+            acc.stats.clippedSamples += counts[1][lane];
+            acc.stats.silentSamples += counts[2][lane];
+        }
+        acc.stats.sumSquares += blockSum;
+    }
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, peak);
+    for (float lane : lanes) {
+        acc.stats.peak = std::max(acc.stats.peak, lane);
+    }
+    return vectorEnd;
+}
+
+__attribute__((target("avx512f")))
+size_t avx512Kernel(Accumulator& acc, const float* samples, size_t count, const SignalStatsThresholds& thresholds) {
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 clip = _mm512_set1_ps(thresholds.clipping);
+    const __m512 quiet = _mm512_set1_ps(thresholds.silence);
+    __m512 peak = zero;
+
+    size_t vectorEnd = count - count % 16;
+    size_t i = 0;
+    while (i < vectorEnd) {
+        size_t blockEnd = std::min(vectorEnd, i + FLUSH_SAMPLES);
+        __m512 sum = zero;
+        size_t crossings = 0, clipped = 0, silent = 0;
+        for (; i < blockEnd; i += 16) {
+            __m512 x = _mm512_loadu_ps(samples + i);
+            __m512 previous = _mm512_loadu_ps(samples + i - 1);
+            __m512 magnitude = _mm512_abs_ps(x);
+            sum = _mm512_fmadd_ps(x, x, sum);
+            peak = _mm512_mask_mov_ps(peak, _mm512_cmp_ps_mask(magnitude, peak, _CMP_GT_OQ), magnitude);
+
+            __mmask16 crossed = _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ) ^ _mm512_cmp_ps_mask(previous, zero, _CMP_LT_OQ);
+            crossings += __builtin_popcount(crossed);
+            clipped += __builtin_popcount(_mm512_cmp_ps_mask(magnitude, clip, _CMP_GE_OQ));
+            __mmask16 quietLanes = _mm512_cmp_ps_mask(magnitude, quiet, _CMP_LT_OQ);
+            silent += __builtin_popcount(quietLanes);
+            acc.silence(quietLanes, 16);
+        }
+        acc.stats.zeroCrossings += crossings;
+        acc.stats.clippedSamples += clipped;
+        acc.stats.silentSamples += silent;
+
+        alignas(64) float lanes[16];
+        _mm512_store_ps(lanes, sum);
+        double blockSum = 0.0;
+        for (float lane : lanes) {
+            blockSum += lane;
+        }
+        acc.stats.sumSquares += blockSum;
+    }
+
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, peak);
+    for (float lane : lanes) {
+        acc.stats.peak = std::max(acc.stats.peak, lane);
+    }
+    return vectorEnd;
+}
+
+SimdLevel detectSupportedLevel() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+    return SimdLevel::SCALAR;
+}
+
+#else
+
+SimdLevel detectSupportedLevel() {
+    return SimdLevel::SCALAR;
+}
+
+#endif
+
+Kernel kernelFor(SimdLevel level) {
+#if SPEECHRNT_X86_KERNELS
+    switch (level) {
+        case SimdLevel::AVX512: return avx512Kernel;
+        case SimdLevel::AVX2: return avx2Kernel;
+        case SimdLevel::SSE2: return sse2Kernel;
+        case SimdLevel::SCALAR: break;
+    }
+#else
+    (void)level;
+#endif
+    return scalarKernel;
+}
+
+std::atomic<int> g_activeLevel{-1};
+
+} // namespace
+
+SimdLevel SignalStatistics::getSupportedLevel() {
+    static const SimdLevel supported = detectSupportedLevel();
+    return supported;
+}
+
+SimdLevel SignalStatistics::getActiveLevel() {
+    int level = g_activeLevel.load(std::memory_order_relaxed);
+    if (level < 0) {
+        level = static_cast<int>(getSupportedLevel());
+        g_activeLevel.store(level, std::memory_order_relaxed);
+    }
+    return static_cast<SimdLevel>(level);
+}
+
+SimdLevel SignalStatistics::setActiveLevel(SimdLevel level) {
+    SimdLevel applied = std::min(level, getSupportedLevel());
+    g_activeLevel.store(static_cast<int>(applied), std::memory_order_relaxed);
+    return applied;
+}
+
+SignalStats SignalStatistics::compute(const float* samples, size_t count, const SignalStatsThresholds& thresholds) {
+    Accumulator acc;
+    acc.stats.count = count;
+    if (!samples || count == 0) {
+        acc.stats.count = 0;
+        return acc.stats;
+    }
+    // The first sample has no predecessor to cross from; the kernels start
+    // after it so they can always read the previous sample
+    acc.previousNegative = samples[0] < 0.0f;
+    acc.scalar(samples, 1, thresholds);
+
+    size_t done = 1 + kernelFor(getActiveLevel())(acc, samples + 1, count - 1, thresholds);
+    acc.previousNegative = samples[done - 1] < 0.0f;
+    acc.scalar(samples + done, count - done, thresholds);
+    return acc.finish();
+}
+
+} // namespace audio
@@ -171,6 +171,10 @@ bool SileroVadImpl::initialize(uint32_t sampleRate,
   sampleRate_ = sampleRate;
   modelPath_ = modelPath.empty() ? SILERO_MODEL_PATH : modelPath;
 
+  FrameAnalysisConfig frameConfig;
+  frameConfig.sampleRate = static_cast<int>(sampleRate);
+  frameTables_ = FrameAnalysisTables::create(frameConfig);
+
   // Try to load silero-vad model
   sileroModelLoaded_ = loadSileroModel(modelPath_);
 
@@ -221,6 +225,16 @@ float SileroVadImpl::processSamples(const std::vector<float> &samples) {
     return 0.0f;
   }
 
+  FrameFeatures frame(frameTables_, samples.data(), samples.size());
+  return processFrame(frame);
+}
+
+float SileroVadImpl::processFrame(FrameFeatures &frame) {
+  if (!initialized_ || frame.size() == 0) {
+    return 0.0f;
+  }
+
+  const std::vector<float> &samples = frame.samples();
   auto startTime = std::chrono::high_resolution_clock::now();
   float result = 0.0f;
   bool usedSilero = false;
@@ -232,12 +246,12 @@ float SileroVadImpl::processSamples(const std::vector<float> &samples) {
         result = processSileroVad(samples);
         usedSilero = true;
       } else {
-        result = processEnergyBasedVad(samples);
+        result = processEnergyBasedVad(frame);
       }
       break;
 
     case VadMode::ENERGY_BASED:
-      result = processEnergyBasedVad(samples);
+      result = processEnergyBasedVad(frame);
       break;
 
     case VadMode::HYBRID:
@@ -247,11 +261,11 @@ float SileroVadImpl::processSamples(const std::vector<float> &samples) {
 
         // If silero-vad fails, fallback to energy-based
         if (result < 0.0f) {
-          result = processEnergyBasedVad(samples);
+          result = processEnergyBasedVad(frame);
           usedSilero = false;
         }
       } else {
-        result = processEnergyBasedVad(samples);
+        result = processEnergyBasedVad(frame);
       }
       break;
     }
@@ -262,7 +276,7 @@ float SileroVadImpl::processSamples(const std::vector<float> &samples) {
   } catch (const std::exception &e) {
     speechrnt::utils::Logger::error("VAD processing error: " +
                                     std::string(e.what()));
-    result = processEnergyBasedVad(samples); // Emergency fallback
+    result = processEnergyBasedVad(frame); // Emergency fallback
     usedSilero = false;
   }
 
@@ -346,13 +360,13 @@ float SileroVadImpl::processSileroVad(const std::vector<float> &samples) {
   }
 }
 
-float SileroVadImpl::processEnergyBasedVad(const std::vector<float> &samples) {
-  if (samples.empty()) {
+float SileroVadImpl::processEnergyBasedVad(FrameFeatures &frame) {
+  if (frame.size() == 0) {
     return 0.0f;
   }
 
-  // Calculate RMS energy
-  float energy = calculateRmsEnergy(samples);
+  // RMS energy
+  float energy = frame.rms();
 
   // Update energy history for adaptive thresholding
   energyHistory_.push_back(energy);
@@ -373,8 +387,8 @@ float SileroVadImpl::processEnergyBasedVad(const std::vector<float> &samples) {
     adaptiveThreshold = std::max(energyThreshold_, avgEnergy * 1.5f);
   }
 
-  // Calculate spectral centroid for additional features
-  float spectralCentroid = calculateSpectralCentroid(samples);
+  // Spectral centroid for additional features
+  float spectralCentroid = frame.spectralCentroid();
 
   // Combine energy and spectral features
   float energyScore = (energy > adaptiveThreshold)
@@ -390,43 +404,6 @@ float SileroVadImpl::processEnergyBasedVad(const std::vector<float> &samples) {
   return std::max(0.0f, std::min(1.0f, probability));
 }
 
-float SileroVadImpl::calculateRmsEnergy(const std::vector<float> &samples) {
-  if (samples.empty()) {
-    return 0.0f;
-  }
-
-  double energy = 0.0;
-  for (float sample : samples) {
-    energy += sample * sample;
-  }
-
-  return static_cast<float>(std::sqrt(energy / samples.size()));
-}
-
-float SileroVadImpl::calculateSpectralCentroid(
-    const std::vector<float> &samples) {
-  if (samples.size() < 2) {
-    return 0.0f;
-  }
-
-  // Simple spectral centroid calculation using magnitude spectrum
-  size_t n = samples.size();
-  double weightedSum = 0.0;
-  double magnitudeSum = 0.0;
-
-  for (size_t i = 1; i < n / 2; ++i) {
-    // Simple magnitude approximation
-    double magnitude = std::abs(samples[i]);
-    double frequency = (static_cast<double>(i) * sampleRate_) / n;
-
-    weightedSum += frequency * magnitude;
-    magnitudeSum += magnitude;
-  }
-
-  return (magnitudeSum > 0.0) ? static_cast<float>(weightedSum / magnitudeSum)
-                              : 0.0f;
-}
-
 std::vector<float>
 SileroVadImpl::preprocessAudio(const std::vector<float> &samples) {
   // For silero-vad, we typically need 512 samples at 16kHz
@@ -512,6 +489,10 @@ void SileroVadImpl::updateStatistics(bool usedSilero, float confidence,
 // EnergyBasedVAD implementation
 EnergyBasedVAD::EnergyBasedVAD(const Config &config)
     : config_(config), adaptiveThreshold_(config.energyThreshold) {
+  FrameAnalysisConfig frameConfig;
+  frameConfig.frameSize = config_.windowSize;
+  frameConfig.hopSize = config_.hopSize;
+  frameTables_ = FrameAnalysisTables::create(frameConfig);
   energyHistory_.reserve(100);
   spectralHistory_.reserve(100);
 }
@@ -521,6 +502,11 @@ EnergyBasedVAD::EnergyBasedVAD() : EnergyBasedVAD(Config{}) {}
 void EnergyBasedVAD::configure(const Config &config) {
   config_ = config;
   adaptiveThreshold_ = config.energyThreshold;
+
+  FrameAnalysisConfig frameConfig;
+  frameConfig.frameSize = config_.windowSize;
+  frameConfig.hopSize = config_.hopSize;
+  frameTables_ = FrameAnalysisTables::create(frameConfig);
 }
 
 float EnergyBasedVAD::detectVoiceActivity(const std::vector<float> &samples) {
@@ -528,9 +514,19 @@ float EnergyBasedVAD::detectVoiceActivity(const std::vector<float> &samples) {
     return 0.0f;
   }
 
-  float energy = calculateEnergy(samples);
+  FrameFeatures frame(frameTables_, samples.data(), samples.size());
+  return detectVoiceActivity(frame);
+}
+
+float EnergyBasedVAD::detectVoiceActivity(FrameFeatures &frame) {
+  if (frame.size() == 0) {
+    return 0.0f;
+  }
+
+  float energy = frame.rms();
+  // Zero-crossing rate scaled to a reasonable range
   float spectralFeature =
-      config_.useSpectralFeatures ? calculateSpectralFeatures(samples) : 0.0f;
+      config_.useSpectralFeatures ? frame.zeroCrossingRate() * 1000.0f : 0.0f;
 
   if (config_.useAdaptiveThreshold) {
     updateAdaptiveThreshold(energy);
@@ -560,40 +556,6 @@ void EnergyBasedVAD::reset() {
   adaptiveThreshold_ = config_.energyThreshold;
 }
 
-float EnergyBasedVAD::calculateEnergy(const std::vector<float> &samples) {
-  if (samples.empty()) {
-    return 0.0f;
-  }
-
-  double energy = 0.0;
-  for (float sample : samples) {
-    energy += sample * sample;
-  }
-
-  return static_cast<float>(std::sqrt(energy / samples.size()));
-}
-
-float EnergyBasedVAD::calculateSpectralFeatures(
-    const std::vector<float> &samples) {
-  // Simple spectral feature calculation
-  // In a full implementation, this would use FFT
-
-  if (samples.size() < 2) {
-    return 0.0f;
-  }
-
-  // Calculate zero-crossing rate as a simple spectral feature
-  int zeroCrossings = 0;
-  for (size_t i = 1; i < samples.size(); ++i) {
-    if ((samples[i] >= 0.0f) != (samples[i - 1] >= 0.0f)) {
-      zeroCrossings++;
-    }
-  }
-
-  float zcr = static_cast<float>(zeroCrossings) / (samples.size() - 1);
-  return zcr * 1000.0f; // Scale to reasonable range
-}
-
 void EnergyBasedVAD::updateAdaptiveThreshold(float currentEnergy) {
   energyHistory_.push_back(currentEnergy);
 
@@ -10,7 +10,8 @@ namespace audio {
 // VoiceActivityDetector implementation
 VoiceActivityDetector::VoiceActivityDetector(const VadConfig& config)
     : config_(config), initialized_(false), currentState_(VadState::IDLE),
-      currentUtteranceId_(0), nextUtteranceId_(1), lastError_(ErrorCode::NONE) {
+      currentUtteranceId_(0), nextUtteranceId_(1), lastError_(ErrorCode::NONE),
+      featureSubscription_(0) {
     
     if (!config_.isValid()) {
         setError(ErrorCode::INVALID_CONFIG);
@@ -36,6 +37,7 @@ VoiceActivityDetector::VoiceActivityDetector(const VadConfig& config)
 }
 
 VoiceActivityDetector::~VoiceActivityDetector() {
+    detachFeatureBus();
     shutdown();
 }
 
@@ -139,6 +141,10 @@ void VoiceActivityDetector::setUtteranceCallback(UtteranceCallback callback) {
     utteranceCallback_ = callback;
 }
 
+void VoiceActivityDetector::setUtteranceSegmentCallback(UtteranceSegmentCallback callback) {
+    utteranceSegmentCallback_ = callback;
+}
+
 void VoiceActivityDetector::processAudio(const std::vector<float>& audioData) {
     processAudioChunk(audioData, std::chrono::steady_clock::now());
 }
@@ -159,82 +165,130 @@ void VoiceActivityDetector::processAudioChunk(const std::vector<float>& audioDat
         
         // Analyze speech probability using silero-vad
         float speechProbability = analyzeSpeechProbability(audioData);
+        updateVadState(audioData, speechProbability);
         
-        // Update statistics
-        updateStatistics(speechProbability > config_.speechThreshold, speechProbability);
-        
-        // Store audio data for current utterance if we're in speech state
-        if (currentState_ == VadState::SPEAKING || currentState_ == VadState::SPEECH_DETECTED) {
-            std::lock_guard<std::mutex> lock(audioMutex_);
-            currentUtteranceAudio_.insert(currentUtteranceAudio_.end(), 
-                                        audioData.begin(), audioData.end());
-        }
-        
-        // Process state transitions based on speech probability
-        VadState newState = currentState_;
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("VoiceActivityDetector processing error: " + std::string(e.what()));
+        setError(ErrorCode::PROCESSING_ERROR);
+    }
+}
+
+void VoiceActivityDetector::attachFeatureBus(std::shared_ptr<FrameFeatureBus> bus) {
+    detachFeatureBus();
+    if (!bus) {
+        return;
+    }
+    featureBus_ = std::move(bus);
+    featureSubscription_ = featureBus_->subscribe(getRequiredFeatures(),
+        [this](FrameFeatures& frame) { processFrame(frame); });
+}
+
+void VoiceActivityDetector::detachFeatureBus() {
+    if (featureBus_) {
+        featureBus_->unsubscribe(featureSubscription_);
+        featureBus_.reset();
+    }
+}
+
+FrameFeatureSet VoiceActivityDetector::getRequiredFeatures() {
+    return FrameFeature::RMS | FrameFeature::SPECTRAL_CENTROID;
+}
+
+void VoiceActivityDetector::processFrame(FrameFeatures& frame) {
+    if (!initialized_) {
+        setError(ErrorCode::NOT_INITIALIZED);
+        return;
+    }
+    
+    if (frame.size() == 0 || !sileroVad_ || !sileroVad_->isInitialized()) {
+        return;
+    }
+    
+    try {
+        lastAudioTime_ = std::chrono::steady_clock::now();
+        updateVadState(frame.samples(), sileroVad_->processFrame(frame));
         
-        switch (currentState_) {
-            case VadState::IDLE:
-                if (speechProbability > config_.speechThreshold) {
-                    newState = VadState::SPEECH_DETECTED;
-                }
-                break;
-                
-            case VadState::SPEECH_DETECTED:
-                if (speechProbability > config_.speechThreshold) {
-                    if (shouldTransitionToSpeaking()) {
-                        newState = VadState::SPEAKING;
-                    }
-                } else if (speechProbability < config_.silenceThreshold) {
-                    newState = VadState::IDLE;
-                }
-                break;
-                
-            case VadState::SPEAKING:
-                if (getTimeSinceUtteranceStart().count() > config_.maxUtteranceDurationMs) {
-                    // Force utterance end if too long - go directly to IDLE to finalize
-                    newState = VadState::IDLE;
-                } else if (speechProbability < config_.silenceThreshold) {
-                    newState = VadState::PAUSE_DETECTED;
-                }
-                break;
-                
-            case VadState::PAUSE_DETECTED:
-                if (getTimeSinceUtteranceStart().count() > config_.maxUtteranceDurationMs) {
-                    // Force utterance end if too long
-                    newState = VadState::IDLE;
-                } else if (speechProbability > config_.speechThreshold) {
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("VoiceActivityDetector processing error: " + std::string(e.what()));
+        setError(ErrorCode::PROCESSING_ERROR);
+    }
+}
+
+void VoiceActivityDetector::updateVadState(const std::vector<float>& audioData, float speechProbability) {
+    // Update statistics
+    updateStatistics(speechProbability > config_.speechThreshold, speechProbability);
+    
+    // Store audio data for current utterance if we're in speech state
+    if (currentState_ == VadState::SPEAKING || currentState_ == VadState::SPEECH_DETECTED) {
+        std::lock_guard<std::mutex> lock(audioMutex_);
+        currentUtteranceAudio_.append(audioData);
+    }
+    
+    // Process state transitions based on speech probability
+    VadState newState = currentState_;
+    
+    switch (currentState_) {
+        case VadState::IDLE:
+            if (speechProbability > config_.speechThreshold) {
+                newState = VadState::SPEECH_DETECTED;
+            }
+            break;
+            
+        case VadState::SPEECH_DETECTED:
+            if (speechProbability > config_.speechThreshold) {
+                if (shouldTransitionToSpeaking()) {
                     newState = VadState::SPEAKING;
-                } else if (shouldTransitionToIdle()) {
-                    newState = VadState::IDLE;
                 }
-                break;
-        }
-        
-        // For continuous audio processing, check if we should transition to SPEAKING
-        // only after we've accumulated enough speech duration
-        if (currentState_ == VadState::SPEECH_DETECTED && newState == VadState::SPEECH_DETECTED) {
-            if (shouldTransitionToSpeaking()) {
+            } else if (speechProbability < config_.silenceThreshold) {
+                newState = VadState::IDLE;
+            }
+            break;
+            
+        case VadState::SPEAKING:
+            if (getTimeSinceUtteranceStart().count() > config_.maxUtteranceDurationMs) {
+                // Force utterance end if too long - go directly to IDLE to finalize
+                newState = VadState::IDLE;
+            } else if (speechProbability < config_.silenceThreshold) {
+                newState = VadState::PAUSE_DETECTED;
+            }
+            break;
+            
+        case VadState::PAUSE_DETECTED:
+            if (getTimeSinceUtteranceStart().count() > config_.maxUtteranceDurationMs) {
+                // Force utterance end if too long
+                newState = VadState::IDLE;
+            } else if (speechProbability > config_.speechThreshold) {
                 newState = VadState::SPEAKING;
+            } else if (shouldTransitionToIdle()) {
+                newState = VadState::IDLE;
             }
+            break;
+    }
+    
+    // For continuous audio processing, check if we should transition to SPEAKING
+    // only after we've accumulated enough speech duration
+    if (currentState_ == VadState::SPEECH_DETECTED && newState == VadState::SPEECH_DETECTED) {
+        if (shouldTransitionToSpeaking()) {
+            newState = VadState::SPEAKING;
         }
-        
-        // Apply state transition if needed
-        if (newState != currentState_) {
-            processStateTransition(newState, speechProbability);
-        }
-        
-        setError(ErrorCode::NONE);
-        
-    } catch (const std::exception& e) {
-        speechrnt::utils::Logger::error("VoiceActivityDetector processing error: " + std::string(e.what()));
-        setError(ErrorCode::PROCESSING_ERROR);
     }
+    
+    // Apply state transition if needed
+    if (newState != currentState_) {
+        processStateTransition(newState, speechProbability);
+    }
+    
+    setError(ErrorCode::NONE);
 }
 
 std::vector<float> VoiceActivityDetector::getCurrentUtteranceAudio() const {
     std::lock_guard<std::mutex> lock(audioMutex_);
-    return currentUtteranceAudio_;
+    return currentUtteranceAudio_.snapshot().toVector();
+}
+
+AudioSegment VoiceActivityDetector::getCurrentUtteranceSegment() const {
+    std::lock_guard<std::mutex> lock(audioMutex_);
+    return currentUtteranceAudio_.snapshot();
 }
 
 void VoiceActivityDetector::forceUtteranceEnd() {
@@ -403,11 +457,10 @@ void VoiceActivityDetector::finalizeUtterance() {
         return; // No active utterance
     }
     
-    std::vector<float> utteranceAudio;
+    AudioSegment utteranceAudio;
     {
         std::lock_guard<std::mutex> lock(audioMutex_);
-        utteranceAudio = std::move(currentUtteranceAudio_);
-        currentUtteranceAudio_.clear();
+        utteranceAudio = currentUtteranceAudio_.release();
     }
     
     // Update statistics
@@ -419,9 +472,14 @@ void VoiceActivityDetector::finalizeUtterance() {
         stats_.totalSpeechTime += utteranceDuration.count();
     }
     
-    // Notify utterance callback if registered
-    if (utteranceCallback_ && !utteranceAudio.empty()) {
-        utteranceCallback_(currentUtteranceId_, utteranceAudio);
+    // Notify utterance callbacks if registered
+    if (!utteranceAudio.empty()) {
+        if (utteranceSegmentCallback_) {
+            utteranceSegmentCallback_(currentUtteranceId_, utteranceAudio);
+        }
+        if (utteranceCallback_) {
+            utteranceCallback_(currentUtteranceId_, utteranceAudio.toVector());
+        }
     }
     
     speechrnt::utils::Logger::info("Finalized utterance " + std::to_string(currentUtteranceId_) + 
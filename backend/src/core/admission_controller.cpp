@@ -0,0 +1,415 @@
+#include "core/admission_controller.hpp"
+#include "utils/logging.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+namespace core {
+
+namespace {
+
+constexpr double UNBOUNDED_LATENCY = std::numeric_limits<double>::infinity();
+
+size_t stageIndex(AdmissionStage stage) {
+    return static_cast<size_t>(stage);
+}
+
+std::string formatMs(double value) {
+    if (value == UNBOUNDED_LATENCY) {
+        return "unbounded";
+    }
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(0) << value << "ms";
+    return oss.str();
+}
+
+} // namespace
+
+AdmissionController& AdmissionController::getInstance() {
+    static AdmissionController instance;
+    return instance;
+}
+
+AdmissionController::AdmissionController(const AdmissionConfig& config)
+    : config_(config), started_(std::chrono::steady_clock::now()) {
+}
+
+void AdmissionController::setConfig(const AdmissionConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_ = config;
+}
+
+AdmissionConfig AdmissionController::getConfig() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+}
+
+void AdmissionController::recordServiceTime(AdmissionStage stage, double serviceTimeMs) {
+    if (serviceTimeMs < 0.0) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& state = stages_[stageIndex(stage)];
+
+    if (state.samples == 0) {
+        state.serviceTimeMs = serviceTimeMs;
+    } else {
+        state.serviceTimeMs = config_.serviceTimeAlpha * serviceTimeMs +
+                              (1.0 - config_.serviceTimeAlpha) * state.serviceTimeMs;
+    }
+    state.samples++;
+
+    state.window.emplace_back(now, serviceTimeMs);
+    state.windowBusyMs += serviceTimeMs;
+    pruneWindowLocked(now);
+}
+
+void AdmissionController::adjustQueueDepth(AdmissionStage stage, int delta) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& depth = stages_[stageIndex(stage)].queueDepth;
+    if (delta < 0) {
+        depth -= std::min(depth, static_cast<size_t>(-delta));
+    } else {
+        depth += static_cast<size_t>(delta);
+    }
+}
+
+AdmissionResult AdmissionController::evaluateNewSession() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pruneWindowLocked(std::chrono::steady_clock::now());
+    return evaluateLocked();
+}
+
+AdmissionResult AdmissionController::admitSession(const std::string& sessionId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pruneWindowLocked(std::chrono::steady_clock::now());
+
+    AdmissionResult result = evaluateLocked();
+    switch (result.decision) {
+        case AdmissionDecision::ADMIT:
+            admitted_++;
+            sessions_[sessionId] = result.profile;
+            break;
+        case AdmissionDecision::DEGRADE:
+            degraded_++;
+            sessions_[sessionId] = result.profile;
+            break;
+        case AdmissionDecision::REJECT:
+            rejected_++;
+            break;
+    }
+    lastDecision_ = result;
+
+    if (result.decision != AdmissionDecision::ADMIT) {
+        speechrnt::utils::Logger::info("Admission " + decisionToString(result.decision) +
+                                       " for session " + sessionId + ": " + result.reason);
+    }
+    return result;
+}
+
+void AdmissionController::releaseSession(const std::string& sessionId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sessions_.erase(sessionId);
+}
+
+bool AdmissionController::canAcceptWork() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pruneWindowLocked(std::chrono::steady_clock::now());
+    return canAcceptWorkLocked();
+}
+
+void AdmissionController::recordShed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shed_++;
+}
+
+AdmissionController::Stats AdmissionController::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pruneWindowLocked(std::chrono::steady_clock::now());
+
+    Stats stats;
+    stats.activeSessions = sessions_.size();
+    for (const auto& entry : sessions_) {
+        if (!entry.second.isFullQuality()) {
+            stats.degradedSessions++;
+        }
+    }
+    stats.workerCount = workersLocked();
+    stats.utilization = utilizationLocked(Demand{});
+    stats.predictedLatencyMs = predictLatencyLocked(SessionProfile{}, stats.utilization);
+    stats.acceptingWork = canAcceptWorkLocked();
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        stats.serviceTimeMs[i] = serviceTimeLocked(i);
+        stats.busyMsPerSecond[i] = busyRateLocked(i);
+        stats.queueDepth[i] = stages_[i].queueDepth;
+    }
+    stats.admitted = admitted_;
+    stats.degraded = degraded_;
+    stats.rejected = rejected_;
+    stats.shed = shed_;
+    stats.lastDecision = lastDecision_;
+    return stats;
+}
+
+std::string AdmissionController::exportStatusJSON() const {
+    Stats stats = getStats();
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\n";
+    json << "  \"accepting_sessions\": "
+         << (evaluateNewSession().decision != AdmissionDecision::REJECT ? "true" : "false") << ",\n";
+    json << "  \"accepting_work\": " << (stats.acceptingWork ? "true" : "false") << ",\n";
+    json << "  \"active_sessions\": " << stats.activeSessions << ",\n";
+    json << "  \"degraded_sessions\": " << stats.degradedSessions << ",\n";
+    json << "  \"worker_count\": " << stats.workerCount << ",\n";
+    json << "  \"utilization\": " << stats.utilization << ",\n";
+    if (stats.predictedLatencyMs == UNBOUNDED_LATENCY) {
+        json << "  \"predicted_latency_ms\": null,\n";
+    } else {
+        json << "  \"predicted_latency_ms\": " << stats.predictedLatencyMs << ",\n";
+    }
+    json << "  \"stages\": {\n";
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        json << "    \"" << stageToString(static_cast<AdmissionStage>(i)) << "\": {"
+             << "\"service_time_ms\": " << stats.serviceTimeMs[i]
+             << ", \"busy_ms_per_second\": " << stats.busyMsPerSecond[i]
+             << ", \"queue_depth\": " << stats.queueDepth[i] << "}";
+        json << (i + 1 < STAGE_COUNT ? ",\n" : "\n");
+    }
+    json << "  },\n";
+    json << "  \"totals\": {\"admitted\": " << stats.admitted
+         << ", \"degraded\": " << stats.degraded
+         << ", \"rejected\": " << stats.rejected
+         << ", \"shed\": " << stats.shed << "},\n";
+    json << "  \"last_decision\": {\"decision\": \"" << decisionToString(stats.lastDecision.decision)
+         << "\", \"reason\": \"" << stats.lastDecision.reason
+         << "\", \"partial_results\": " << (stats.lastDecision.profile.partialResults ? "true" : "false")
+         << ", \"reduced_model\": " << (stats.lastDecision.profile.reducedModel ? "true" : "false")
+         << ", \"speech_synthesis\": " << (stats.lastDecision.profile.speechSynthesis ? "true" : "false")
+         << ", \"retry_after_ms\": " << stats.lastDecision.retryAfterMs << "}\n";
+    json << "}";
+    return json.str();
+}
+
+std::string AdmissionController::decisionToString(AdmissionDecision decision) {
+    switch (decision) {
+        case AdmissionDecision::ADMIT: return "admit";
+        case AdmissionDecision::DEGRADE: return "degrade";
+        case AdmissionDecision::REJECT: return "reject";
+    }
+    return "unknown";
+}
+
+std::string AdmissionController::stageToString(AdmissionStage stage) {
+    switch (stage) {
+        case AdmissionStage::TRANSCRIPTION: return "transcription";
+        case AdmissionStage::TRANSLATION: return "translation";
+        case AdmissionStage::SYNTHESIS: return "synthesis";
+    }
+    return "unknown";
+}
+
+void AdmissionController::pruneWindowLocked(std::chrono::steady_clock::time_point now) const {
+    auto cutoff = now - config_.window;
+    for (auto& state : stages_) {
+        while (!state.window.empty() && state.window.front().first < cutoff) {
+            state.windowBusyMs -= state.window.front().second;
+            state.window.pop_front();
+        }
+        if (state.window.empty()) {
+            state.windowBusyMs = 0.0;
+        }
+    }
+}
+
+size_t AdmissionController::workersLocked() const {
+    if (config_.workerCount > 0) {
+        return config_.workerCount;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+double AdmissionController::serviceTimeLocked(size_t stage) const {
+    const auto& state = stages_[stage];
+    return state.samples > 0 ? state.serviceTimeMs : config_.defaultServiceTimeMs[stage];
+}
+
+double AdmissionController::busyRateLocked(size_t stage) const {
+    // Until a full window has elapsed, average over the time that has
+    double windowMs = static_cast<double>(config_.window.count());
+    double elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - started_).count();
+    double spanSec = std::max(std::min(windowMs, elapsedMs), 1000.0) / 1000.0;
+    return stages_[stage].windowBusyMs / spanSec;
+}
+
+AdmissionController::Demand AdmissionController::stageCost(const SessionProfile& profile) const {
+    Demand cost{};
+    cost[stageIndex(AdmissionStage::TRANSCRIPTION)] =
+        (profile.partialResults ? 1.0 : 1.0 - config_.partialResultsShare) *
+        (profile.reducedModel ? config_.reducedModelFactor : 1.0);
+    cost[stageIndex(AdmissionStage::TRANSLATION)] = 1.0;
+    cost[stageIndex(AdmissionStage::SYNTHESIS)] = profile.speechSynthesis ? 1.0 : 0.0;
+    return cost;
+}
+
+AdmissionController::Demand AdmissionController::equivalentSessionsLocked() const {
+    // Active sessions weighted by how much of each stage their profile uses
+    Demand equivalent{};
+    for (const auto& entry : sessions_) {
+        Demand cost = stageCost(entry.second);
+        for (size_t i = 0; i < STAGE_COUNT; ++i) {
+            equivalent[i] += cost[i];
+        }
+    }
+    return equivalent;
+}
+
+bool AdmissionController::hasMeasurementsLocked(size_t stage) const {
+    return stages_[stage].window.size() >= config_.minSamples;
+}
+
+AdmissionController::Demand AdmissionController::stageLoadLocked() const {
+    // Measured busy time where there is enough of it; otherwise what the
+    // registered sessions are expected to generate, so a burst of connects
+    // is not admitted against an idle-looking pipeline
+    Demand equivalent = equivalentSessionsLocked();
+    Demand load{};
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        load[i] = hasMeasurementsLocked(i) ? busyRateLocked(i)
+                                           : equivalent[i] * config_.defaultSessionDemandMs[i];
+    }
+    return load;
+}
+
+AdmissionController::Demand AdmissionController::sessionDemandLocked() const {
+    Demand equivalent = equivalentSessionsLocked();
+    Demand demand{};
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        if (hasMeasurementsLocked(i) && equivalent[i] > 0.0) {
+            demand[i] = busyRateLocked(i) / equivalent[i];
+        } else {
+            demand[i] = config_.defaultSessionDemandMs[i];
+        }
+    }
+    return demand;
+}
+
+double AdmissionController::utilizationLocked(const Demand& extra) const {
+    Demand load = stageLoadLocked();
+    double busyPerSecond = 0.0;
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        busyPerSecond += load[i] + extra[i];
+    }
+    return busyPerSecond / (1000.0 * workersLocked());
+}
+
+double AdmissionController::predictLatencyLocked(const SessionProfile& profile, double utilization) const {
+    if (utilization >= 1.0) {
+        return UNBOUNDED_LATENCY;
+    }
+
+    double workers = static_cast<double>(workersLocked());
+    double latency = 0.0;
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        double serviceTime = serviceTimeLocked(i);
+        double ownServiceTime = serviceTime;
+        if (i == stageIndex(AdmissionStage::TRANSCRIPTION) && profile.reducedModel) {
+            ownServiceTime *= config_.reducedModelFactor;
+        } else if (i == stageIndex(AdmissionStage::SYNTHESIS) && !profile.speechSynthesis) {
+            continue;
+        }
+
+        double drain = stages_[i].queueDepth * serviceTime / workers;
+        double wait = serviceTime * utilization / (workers * (1.0 - utilization));
+        latency += ownServiceTime + drain + wait;
+    }
+    return latency;
+}
+
+AdmissionResult AdmissionController::evaluateLocked() const {
+    AdmissionResult result;
+
+    if (sessions_.size() >= config_.maxSessions) {
+        result.decision = AdmissionDecision::REJECT;
+        result.reason = "Session limit of " + std::to_string(config_.maxSessions) + " reached";
+        result.predictedUtilization = utilizationLocked(Demand{});
+        result.retryAfterMs = config_.minRetryAfterMs;
+        return result;
+    }
+
+    // Cheapest features go last: partials, then model size, then TTS
+    SessionProfile noPartials;
+    noPartials.partialResults = false;
+    SessionProfile reduced = noPartials;
+    reduced.reducedModel = true;
+    SessionProfile textOnly = reduced;
+    textOnly.speechSynthesis = false;
+    const SessionProfile candidates[] = {SessionProfile{}, noPartials, reduced, textOnly};
+
+    Demand demand = sessionDemandLocked();
+    double lastUtilization = 0.0;
+    double lastLatency = 0.0;
+    for (size_t c = 0; c < sizeof(candidates) / sizeof(candidates[0]); ++c) {
+        const SessionProfile& profile = candidates[c];
+        Demand cost = stageCost(profile);
+        for (size_t i = 0; i < STAGE_COUNT; ++i) {
+            cost[i] *= demand[i];
+        }
+
+        double utilization = utilizationLocked(cost);
+        double latency = predictLatencyLocked(profile, utilization);
+        double utilizationLimit = c == 0 ? config_.targetUtilization : config_.maxUtilization;
+        lastUtilization = utilization;
+        lastLatency = latency;
+
+        if (utilization <= utilizationLimit && latency <= config_.latencySloMs) {
+            result.decision = c == 0 ? AdmissionDecision::ADMIT : AdmissionDecision::DEGRADE;
+            result.profile = profile;
+            result.predictedUtilization = utilization;
+            result.predictedLatencyMs = latency;
+            result.reason = c == 0 ? "Capacity available"
+                                   : "Reduced quality to stay within the " +
+                                         formatMs(config_.latencySloMs) + " latency target";
+            return result;
+        }
+    }
+
+    result.decision = AdmissionDecision::REJECT;
+    result.profile = textOnly;
+    result.predictedUtilization = lastUtilization;
+    result.predictedLatencyMs = lastLatency;
+    if (lastUtilization > config_.maxUtilization) {
+        std::ostringstream oss;
+        oss << "Pipeline utilization would reach " << std::fixed << std::setprecision(0)
+            << lastUtilization * 100.0 << "%";
+        result.reason = oss.str();
+    } else {
+        result.reason = "Predicted latency " + formatMs(lastLatency) + " exceeds the " +
+                        formatMs(config_.latencySloMs) + " target";
+    }
+
+    // Suggest retrying once the queued work has drained
+    double drainMs = 0.0;
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        drainMs += stages_[i].queueDepth * serviceTimeLocked(i) / workersLocked();
+    }
+    result.retryAfterMs = config_.minRetryAfterMs + static_cast<uint32_t>(std::min(drainMs, 60000.0));
+    return result;
+}
+
+bool AdmissionController::canAcceptWorkLocked() const {
+    double utilization = utilizationLocked(Demand{});
+    if (utilization > config_.maxUtilization) {
+        return false;
+    }
+    return predictLatencyLocked(SessionProfile{}, utilization) <=
+           config_.latencySloMs * config_.shedLatencyFactor;
+}
+
+} // namespace core
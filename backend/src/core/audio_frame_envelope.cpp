@@ -0,0 +1,314 @@
+#include "core/audio_frame_envelope.hpp"
+#include "audio/packet_recovery.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace core {
+
+namespace {
+
+constexpr std::array<char, 4> FRAME_MAGIC = {'S', 'R', 'A', 'F'};
+
+constexpr std::array<uint32_t, 8> SAMPLE_RATES = {0,     8000,  16000, 22050,
+                                                  24000, 32000, 44100, 48000};
+
+uint16_t readU16(const char *p) {
+  const auto *b = reinterpret_cast<const uint8_t *>(p);
+  return static_cast<uint16_t>(b[0] | (b[1] << 8));
+}
+
+uint32_t readU32(const char *p) {
+  const auto *b = reinterpret_cast<const uint8_t *>(p);
+  return static_cast<uint32_t>(b[0]) | (static_cast<uint32_t>(b[1]) << 8) |
+         (static_cast<uint32_t>(b[2]) << 16) |
+         (static_cast<uint32_t>(b[3]) << 24);
+}
+
+uint64_t readU64(const char *p) {
+  return static_cast<uint64_t>(readU32(p)) |
+         (static_cast<uint64_t>(readU32(p + 4)) << 32);
+}
+
+void writeLE(std::vector<uint8_t> &out, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+} // namespace
+
+AudioFrameParseResult AudioFrameEnvelope::parse(std::string_view data,
+                                                AudioFrameView &out) {
+  out = AudioFrameView{};
+
+  if (data.size() < FRAME_MAGIC.size() ||
+      std::memcmp(data.data(), FRAME_MAGIC.data(), FRAME_MAGIC.size()) != 0) {
+    out.payload = data;
+    return AudioFrameParseResult::LEGACY_RAW;
+  }
+
+  if (data.size() < HEADER_SIZE) {
+    return AudioFrameParseResult::MALFORMED;
+  }
+
+  const char *p = data.data();
+  uint8_t version = static_cast<uint8_t>(p[4]);
+  size_t headerSize = static_cast<uint8_t>(p[5]);
+  uint8_t codec = static_cast<uint8_t>(p[6]);
+  uint32_t sampleRate = sampleRateFromId(static_cast<uint8_t>(p[7]));
+
+  if (version != VERSION || headerSize < HEADER_SIZE ||
+      headerSize > data.size() ||
+      codec > static_cast<uint8_t>(AudioFrameCodec::OPUS) || sampleRate == 0) {
+    return AudioFrameParseResult::MALFORMED;
+  }
+
+  out.hasEnvelope = true;
+  out.header.version = version;
+  out.header.codec = static_cast<AudioFrameCodec>(codec);
+  out.header.sampleRate = sampleRate;
+  out.header.flags = readU16(p + 8);
+  out.header.sequenceNumber = readU32(p + 12);
+  out.header.captureTimestampUs = readU64(p + 16);
+  out.payload = data.substr(headerSize);
+  return AudioFrameParseResult::ENVELOPE;
+}
+
+std::vector<uint8_t>
+AudioFrameEnvelope::serialize(const AudioFrameHeader &header,
+                              std::string_view payload) {
+  std::vector<uint8_t> out;
+  out.reserve(HEADER_SIZE + payload.size());
+
+  out.insert(out.end(), FRAME_MAGIC.begin(), FRAME_MAGIC.end());
+  out.push_back(VERSION);
+  out.push_back(static_cast<uint8_t>(HEADER_SIZE));
+  out.push_back(static_cast<uint8_t>(header.codec));
+  out.push_back(sampleRateToId(header.sampleRate));
+  writeLE(out, header.flags, 2);
+  writeLE(out, 0, 2);
+  writeLE(out, header.sequenceNumber, 4);
+  writeLE(out, header.captureTimestampUs, 8);
+  out.insert(out.end(), payload.begin(), payload.end());
+
+  return out;
+}
+
+uint8_t AudioFrameEnvelope::sampleRateToId(uint32_t sampleRate) {
+  for (size_t i = 1; i < SAMPLE_RATES.size(); ++i) {
+    if (SAMPLE_RATES[i] == sampleRate) {
+      return static_cast<uint8_t>(i);
+    }
+  }
+  return 0;
+}
+
+uint32_t AudioFrameEnvelope::sampleRateFromId(uint8_t id) {
+  return id < SAMPLE_RATES.size() ? SAMPLE_RATES[id] : 0;
+}
+
+size_t AudioFrameEnvelope::bytesPerSample(AudioFrameCodec codec) {
+  switch (codec) {
+  case AudioFrameCodec::PCM_S16LE:
+    return 2;
+  case AudioFrameCodec::PCM_F32LE:
+    return 4;
+  default:
+    return 0;
+  }
+}
+
+AudioFrameSequencer::AudioFrameSequencer(size_t maxBufferedFrames,
+                                         int reorderTimeoutMs, int gapWaitMs)
+    : reorderBuffer_(std::make_unique<audio::AudioChunkReorderBuffer>()),
+      gapWaitMs_(gapWaitMs), started_(false), maxConcealedFrames_(0),
+      streamCodec_(AudioFrameCodec::PCM_S16LE) {
+  reorderBuffer_->initialize(maxBufferedFrames, reorderTimeoutMs);
+}
+
+AudioFrameSequencer::~AudioFrameSequencer() = default;
+
+void AudioFrameSequencer::setCompressedDecoder(PayloadDecoder decoder,
+                                               size_t maxConcealedFrames) {
+  compressedDecoder_ = std::move(decoder);
+  maxConcealedFrames_ = maxConcealedFrames;
+}
+
+bool AudioFrameSequencer::push(const AudioFrameView &frame,
+                               std::vector<OrderedFrame> &ready) {
+  const AudioFrameHeader &header = frame.header;
+  bool compressed = header.codec == AudioFrameCodec::OPUS;
+
+  if (compressed) {
+    if (!compressedDecoder_) {
+      return false;
+    }
+  } else {
+    size_t sampleBytes = AudioFrameEnvelope::bytesPerSample(header.codec);
+    if (sampleBytes == 0 || frame.payload.size() % sampleBytes != 0) {
+      return false;
+    }
+  }
+
+  stats_.framesReceived++;
+  streamCodec_ = header.codec;
+
+  if (!started_ || header.hasFlag(AudioFrameFlags::DISCONTINUITY)) {
+    reorderBuffer_->clear();
+    reorderBuffer_->setExpectedSequenceNumber(header.sequenceNumber);
+    parkedPayloads_.clear();
+    started_ = true;
+  }
+
+  bool endOfUtterance = header.hasFlag(AudioFrameFlags::END_OF_UTTERANCE);
+
+  // Fast path: next frame in sequence with nothing parked
+  if (reorderBuffer_->tryAdvanceInOrder(header.sequenceNumber)) {
+    OrderedFrame ordered;
+    ordered.sequenceNumber = header.sequenceNumber;
+    ordered.endOfUtterance = endOfUtterance;
+    if (decodePayload(header.codec, frame.payload, ordered.samples)) {
+      ready.push_back(std::move(ordered));
+    }
+    stats_.framesInOrder++;
+    return true;
+  }
+
+  int32_t distance = static_cast<int32_t>(
+      header.sequenceNumber - reorderBuffer_->getExpectedSequenceNumber());
+  if (distance < 0) {
+    stats_.framesLate++;
+    drain(ready);
+    return true;
+  }
+
+  // Compressed frames must be decoded in order, so park the packet and let
+  // the reorder buffer carry an empty placeholder
+  audio::AudioChunk chunk;
+  chunk.timestamp = std::chrono::steady_clock::now();
+  chunk.sequenceNumber = header.sequenceNumber;
+  chunk.isLast = endOfUtterance;
+  if (compressed) {
+    parkedPayloads_[header.sequenceNumber] = std::string(frame.payload);
+  } else {
+    decodePCM(header.codec, frame.payload, chunk.data);
+  }
+  reorderBuffer_->addChunk(chunk);
+  stats_.framesReordered++;
+
+  drain(ready);
+  return true;
+}
+
+bool AudioFrameSequencer::decodePayload(AudioFrameCodec codec,
+                                        std::string_view payload,
+                                        std::vector<float> &samples) {
+  bool ok = codec == AudioFrameCodec::OPUS
+                ? (compressedDecoder_ && compressedDecoder_(payload, samples))
+                : decodePCM(codec, payload, samples);
+  if (!ok) {
+    stats_.decodeErrors++;
+  }
+  return ok;
+}
+
+void AudioFrameSequencer::conceal(uint32_t firstSequence, size_t count,
+                                  std::vector<OrderedFrame> &ready) {
+  if (streamCodec_ != AudioFrameCodec::OPUS || !compressedDecoder_) {
+    return;
+  }
+
+  // Conceal only the frames just before the resume point; longer gaps are
+  // better left silent than filled with synthetic audio
+  size_t concealCount = std::min(count, maxConcealedFrames_);
+  for (size_t i = count - concealCount; i < count; ++i) {
+    OrderedFrame concealed;
+    concealed.sequenceNumber = firstSequence + static_cast<uint32_t>(i);
+    if (compressedDecoder_(std::string_view(), concealed.samples)) {
+      ready.push_back(std::move(concealed));
+      stats_.framesConcealed++;
+    }
+  }
+}
+
+void AudioFrameSequencer::drain(std::vector<OrderedFrame> &ready) {
+  std::vector<audio::AudioChunk> chunks;
+
+  while (true) {
+    while (reorderBuffer_->getOrderedChunks(chunks) > 0) {
+      for (auto &chunk : chunks) {
+        OrderedFrame ordered;
+        ordered.sequenceNumber = chunk.sequenceNumber;
+        ordered.endOfUtterance = chunk.isLast;
+
+        auto parked = parkedPayloads_.find(chunk.sequenceNumber);
+        if (parked != parkedPayloads_.end()) {
+          bool ok = decodePayload(AudioFrameCodec::OPUS, parked->second,
+                                  ordered.samples);
+          parkedPayloads_.erase(parked);
+          if (!ok) {
+            continue;
+          }
+        } else {
+          ordered.samples = std::move(chunk.data);
+        }
+        ready.push_back(std::move(ordered));
+      }
+    }
+
+    uint32_t gapStart = reorderBuffer_->getExpectedSequenceNumber();
+    size_t skipped = reorderBuffer_->skipStalledGap(gapWaitMs_);
+    if (skipped == 0) {
+      break;
+    }
+    stats_.framesLost += skipped;
+    conceal(gapStart, skipped, ready);
+  }
+
+  // Drop packets whose placeholders timed out of the reorder buffer
+  if (!parkedPayloads_.empty()) {
+    uint32_t expected = reorderBuffer_->getExpectedSequenceNumber();
+    for (auto it = parkedPayloads_.begin(); it != parkedPayloads_.end();) {
+      if (static_cast<int32_t>(it->first - expected) < 0) {
+        it = parkedPayloads_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+void AudioFrameSequencer::reset() {
+  reorderBuffer_->clear();
+  parkedPayloads_.clear();
+  started_ = false;
+  stats_ = Statistics{};
+}
+
+bool AudioFrameSequencer::decodePCM(AudioFrameCodec codec,
+                                    std::string_view payload,
+                                    std::vector<float> &samples) {
+  size_t sampleBytes = AudioFrameEnvelope::bytesPerSample(codec);
+  if (sampleBytes == 0 || payload.size() % sampleBytes != 0) {
+    return false;
+  }
+
+  size_t count = payload.size() / sampleBytes;
+  samples.resize(count);
+  const char *src = payload.data();
+
+  if (codec == AudioFrameCodec::PCM_S16LE) {
+    for (size_t i = 0; i < count; ++i) {
+      int16_t value;
+      std::memcpy(&value, src + i * 2, sizeof(value));
+      samples[i] = static_cast<float>(value) / 32768.0f;
+    }
+  } else {
+    std::memcpy(samples.data(), src, count * sizeof(float));
+  }
+
+  return true;
+}
+
+} // namespace core
@@ -4,20 +4,95 @@
 #include "stt/streaming_transcriber.hpp"
 #include "stt/transcription_manager.hpp"
 #include "stt/whisper_stt.hpp"
+#include "tts/tts_interface.hpp"
 #include "utils/logging.hpp"
+#include "utils/performance_monitor.hpp"
+#include "utils/trace_recorder.hpp"
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 
 namespace core {
 
+namespace {
+
+uint32_t readLE32(const uint8_t *p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint16_t readLE16(const uint8_t *p) {
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+// Extract mono float samples from a 16-bit PCM WAV file
+bool decodeWavPCM16(const std::vector<uint8_t> &wav, std::vector<float> &samples,
+                    int &sampleRate) {
+  if (wav.size() < 12 || std::memcmp(wav.data(), "RIFF", 4) != 0 ||
+      std::memcmp(wav.data() + 8, "WAVE", 4) != 0) {
+    return false;
+  }
+
+  uint16_t channels = 0;
+  uint16_t bitsPerSample = 0;
+  size_t offset = 12;
+
+  while (offset + 8 <= wav.size()) {
+    const uint8_t *chunk = wav.data() + offset;
+    size_t chunkSize = readLE32(chunk + 4);
+    size_t bodyOffset = offset + 8;
+    size_t available = std::min(chunkSize, wav.size() - bodyOffset);
+
+    if (std::memcmp(chunk, "fmt ", 4) == 0 && available >= 16) {
+      channels = readLE16(chunk + 10);
+      sampleRate = static_cast<int>(readLE32(chunk + 12));
+      bitsPerSample = readLE16(chunk + 22);
+    } else if (std::memcmp(chunk, "data", 4) == 0) {
+      if (channels == 0 || bitsPerSample != 16) {
+        return false;
+      }
+      size_t frames = available / (2u * channels);
+      samples.resize(frames);
+      for (size_t i = 0; i < frames; ++i) {
+        float sum = 0.0f;
+        for (uint16_t c = 0; c < channels; ++c) {
+          const uint8_t *p = wav.data() + bodyOffset + (i * channels + c) * 2;
+          sum += static_cast<float>(static_cast<int16_t>(readLE16(p))) /
+                 32768.0f;
+        }
+        samples[i] = sum / channels;
+      }
+      return true;
+    }
+
+    offset = bodyOffset + chunkSize + (chunkSize & 1);
+  }
+
+  return false;
+}
+
+} // namespace
+
 ClientSession::ClientSession(const std::string &sessionId)
     : sessionId_(sessionId), connected_(true), server_(nullptr),
-      sourceLang_("en"), targetLang_("es"), vadInitialized_(false) {
+      sourceLang_("en"), targetLang_("es"), lastFrameCaptureTimestampUs_(0),
+      outputSequenceNumber_(0), vadInitialized_(false) {
 
   // Initialize audio ingestion manager
   audioIngestion_ = std::make_unique<audio::AudioIngestionManager>(sessionId);
   audioIngestion_->setActive(true);
 
+  // Opus frames are decoded in sequence order with per-session state
+  frameSequencer_.setCompressedDecoder(
+      [this](std::string_view payload, std::vector<float> &samples) {
+        if (!opusDecoder_) {
+          return false;
+        }
+        return payload.empty() ? opusDecoder_->concealLoss(samples)
+                               : opusDecoder_->decode(payload, samples);
+      });
+
   // Initialize VAD with default configuration
   vadConfig_ = audio::VadConfig{};
   vadConfig_.speechThreshold = 0.5f;
@@ -26,21 +101,23 @@ ClientSession::ClientSession(const std::string &sessionId)
   vadConfig_.minSilenceDurationMs = 500;
   vadConfig_.sampleRate = 16000;
 
+  createFeatureBus();
   vad_ = std::make_unique<audio::VoiceActivityDetector>(vadConfig_);
 
   // Set up VAD callbacks
   vad_->setVadCallback(
       [this](const audio::VadEvent &event) { handleVADEvent(event); });
 
-  vad_->setUtteranceCallback(
-      [this](uint32_t utteranceId, const std::vector<float> &audioData) {
-        handleUtteranceComplete(utteranceId, audioData);
+  vad_->setUtteranceSegmentCallback(
+      [this](uint32_t utteranceId, const audio::AudioSegment &audio) {
+        handleUtteranceComplete(utteranceId, audio);
       });
 
   speechrnt::utils::Logger::info("Created session: " + sessionId);
 }
 
 ClientSession::~ClientSession() {
+  cancelSpeechSynthesis();
   shutdownTranscription();
   shutdownVAD();
   speechrnt::utils::Logger::info("Destroyed session: " + sessionId_);
@@ -101,7 +178,23 @@ void ClientSession::handleBinaryMessage(std::string_view data) {
     return;
   }
 
-  processAudioData(data);
+  AudioFrameView frame;
+  switch (AudioFrameEnvelope::parse(data, frame)) {
+  case AudioFrameParseResult::LEGACY_RAW:
+    processAudioData(data);
+    break;
+  case AudioFrameParseResult::ENVELOPE:
+    processAudioFrame(frame);
+    break;
+  case AudioFrameParseResult::MALFORMED: {
+    speechrnt::utils::Logger::warn("Session " + sessionId_ +
+                                   " sent a malformed audio frame header");
+    ErrorMessage errorMsg("Malformed audio frame header",
+                          "INVALID_AUDIO_FRAME");
+    sendMessage(errorMsg.serialize());
+    break;
+  }
+  }
 }
 
 void ClientSession::sendMessage(const std::string &message) {
@@ -129,6 +222,13 @@ void ClientSession::sendBinaryMessage(const std::vector<uint8_t> &data) {
   }
 }
 
+void ClientSession::setAdmissionProfile(const SessionProfile &profile) {
+  admissionProfile_ = profile;
+  if (streamingTranscriber_) {
+    streamingTranscriber_->setIncrementalUpdatesEnabled(profile.partialResults);
+  }
+}
+
 void ClientSession::setLanguageConfig(const std::string &sourceLang,
                                       const std::string &targetLang) {
   sourceLang_ = sourceLang;
@@ -199,6 +299,10 @@ ClientSession::getAudioStatistics() const {
   return audioIngestion_->getStatistics();
 }
 
+AudioFrameSequencer::Statistics ClientSession::getAudioFrameStatistics() const {
+  return frameSequencer_.getStatistics();
+}
+
 void ClientSession::processConfigMessage(const ConfigMessage *message) {
   speechrnt::utils::Logger::info("Processing config message for session " +
                                  sessionId_);
@@ -206,6 +310,17 @@ void ClientSession::processConfigMessage(const ConfigMessage *message) {
   setLanguageConfig(message->getSourceLang(), message->getTargetLang());
   setVoiceConfig(message->getVoice());
 
+  // Codec negotiation: Opus input is self-describing per frame, so only its
+  // availability needs checking; output switches the TTS egress encoder
+  if (message->getInputCodec() == "opus" &&
+      !audio::OpusStreamDecoder::isAvailable()) {
+    ErrorMessage errorMsg("Opus input is not supported by this server",
+                          "CODEC_UNAVAILABLE");
+    sendMessage(errorMsg.serialize());
+  }
+  configureOutputCodec(message->getOutputCodec(), message->getOpusBitrate(),
+                       message->getOpusFrameMs());
+
   // Configure language detection if transcription is already initialized
   if (transcriptionManager_) {
     if (auto whisperSTT = dynamic_cast<::stt::WhisperSTT *>(
@@ -264,6 +379,7 @@ bool ClientSession::initializeVAD() {
     return false;
   }
 
+  vad_->attachFeatureBus(featureBus_);
   vadInitialized_ = true;
   speechrnt::utils::Logger::info("VAD initialized for session " + sessionId_);
   return true;
@@ -271,6 +387,7 @@ bool ClientSession::initializeVAD() {
 
 void ClientSession::shutdownVAD() {
   if (vad_ && vadInitialized_) {
+    vad_->detachFeatureBus();
     vad_->shutdown();
     vadInitialized_ = false;
     speechrnt::utils::Logger::info("VAD shutdown for session " + sessionId_);
@@ -295,8 +412,26 @@ uint32_t ClientSession::getCurrentUtteranceId() const {
   return vad_->getCurrentUtteranceId();
 }
 
+void ClientSession::createFeatureBus() {
+  audio::FrameAnalysisConfig frameConfig;
+  frameConfig.sampleRate = static_cast<int>(vadConfig_.sampleRate);
+  frameConfig.frameSize = static_cast<size_t>(vadConfig_.windowSizeMs) *
+                          vadConfig_.sampleRate / 1000;
+  frameConfig.hopSize = frameConfig.frameSize;
+  featureBus_ = std::make_shared<audio::FrameFeatureBus>(frameConfig);
+}
+
 void ClientSession::setVADConfig(const audio::VadConfig &config) {
+  bool framingChanged = config.windowSizeMs != vadConfig_.windowSizeMs ||
+                        config.sampleRate != vadConfig_.sampleRate;
   vadConfig_ = config;
+  if (framingChanged) {
+    // Other consumers re-fetch the bus through getFeatureBus()
+    createFeatureBus();
+    if (vad_ && vadInitialized_) {
+      vad_->attachFeatureBus(featureBus_);
+    }
+  }
   if (vad_) {
     vad_->setConfig(config);
     speechrnt::utils::Logger::info("VAD configuration updated for session " +
@@ -321,6 +456,15 @@ void ClientSession::handleVADEvent(const audio::VadEvent &event) {
 
   // Start streaming transcription at speech onset
   if (event.currentState == audio::VadState::SPEECH_DETECTED) {
+    // The user is talking over playback; stop sending the previous reply
+    interruptSpeechSynthesis();
+
+    if (speechrnt::utils::TraceRecorder::isEnabled()) {
+      speechTrace_ = speechrnt::utils::TraceRecorder::getInstance().beginUtterance(
+          sessionId_, event.utteranceId);
+      speechOnsetTraceNs_ = speechrnt::utils::TraceRecorder::now();
+    }
+
     if (!streamingTranscriber_) {
       if (!initializeTranscription()) {
         speechrnt::utils::Logger::error(
@@ -331,7 +475,8 @@ void ClientSession::handleVADEvent(const audio::VadEvent &event) {
     if (streamingTranscriber_) {
       // Start streaming with no initial audio; audio chunks are fed in
       // processAudioData
-      streamingTranscriber_->startTranscription(event.utteranceId, {}, true);
+      streamingTranscriber_->startTranscription(event.utteranceId,
+                                                audio::AudioSegment(), true);
     }
   }
 
@@ -358,26 +503,43 @@ void ClientSession::handleVADEvent(const audio::VadEvent &event) {
 }
 
 void ClientSession::handleUtteranceComplete(
-    uint32_t utteranceId, const std::vector<float> &audioData) {
+    uint32_t utteranceId, const audio::AudioSegment &audio) {
   speechrnt::utils::Logger::info(
       "Session " + sessionId_ + " utterance " + std::to_string(utteranceId) +
-      " completed with " + std::to_string(audioData.size()) + " samples");
+      " completed with " + std::to_string(audio.size()) + " samples");
+
+  // Work scheduled from here on carries the utterance's trace
+  speechrnt::utils::TraceContext trace = speechTrace_;
+  speechTrace_ = speechrnt::utils::TraceContext();
+  speechrnt::utils::ScopedTraceContext traceScope(trace);
+  if (trace.sampled()) {
+    speechrnt::utils::TraceRecorder::getInstance().record(
+        "speech", trace, speechOnsetTraceNs_,
+        speechrnt::utils::TraceRecorder::now());
+  }
+
+  // Time from capture of the last enveloped frame to end-of-speech detection
+  if (lastFrameCaptureTimestampUs_ != 0) {
+    recordCaptureLatency("audio.capture_to_utterance_latency_ms",
+                         lastFrameCaptureTimestampUs_);
+  }
 
   // Feed final audio chunk and finalize streaming transcription
   if (streamingTranscriber_) {
-    if (!audioData.empty()) {
-      streamingTranscriber_->addAudioData(utteranceId, audioData);
+    if (!audio.empty()) {
+      streamingTranscriber_->addAudioData(utteranceId, audio);
     }
     streamingTranscriber_->finalizeTranscription(utteranceId);
   } else {
     // If streaming was not initialized, start and immediately finalize as
     // fallback
-    startStreamingTranscription(utteranceId, audioData);
+    startStreamingTranscription(utteranceId, audio);
   }
 
-  // Trigger the translation pipeline if callback is set
+  // Trigger the translation pipeline if callback is set. The pipeline runs
+  // inference on contiguous samples, so the utterance is materialised here
   if (pipelineCallback_) {
-    pipelineCallback_(utteranceId, audioData, sourceLang_, targetLang_,
+    pipelineCallback_(utteranceId, audio.toVector(), sourceLang_, targetLang_,
                       voiceId_);
   } else {
     speechrnt::utils::Logger::warn("No pipeline callback set for session " +
@@ -415,21 +577,7 @@ void ClientSession::processAudioData(std::string_view data) {
       // Get recent audio samples for VAD processing
       auto recentSamples =
           audioIngestion_->getLatestAudio(data.size() / 2); // 16-bit samples
-
-      if (!recentSamples.empty() && vad_) {
-        vad_->processAudio(recentSamples);
-
-        // While speaking, feed audio chunks to the streaming transcriber
-        if (isVADActive() &&
-            vad_->getCurrentState() == audio::VadState::SPEAKING &&
-            streamingTranscriber_) {
-          uint32_t currentUtteranceId = vad_->getCurrentUtteranceId();
-          if (currentUtteranceId != 0) {
-            streamingTranscriber_->addAudioData(currentUtteranceId,
-                                                recentSamples);
-          }
-        }
-      }
+      processIngestedSamples(recentSamples);
     }
   }
 
@@ -441,6 +589,382 @@ void ClientSession::processAudioData(std::string_view data) {
       " bytes, " + std::to_string(stats.totalChunksIngested) + " chunks");
 }
 
+void ClientSession::processAudioFrame(const AudioFrameView &frame) {
+  const AudioFrameHeader &header = frame.header;
+
+  if (header.codec == AudioFrameCodec::OPUS &&
+      !ensureOpusDecoder(header.sampleRate)) {
+    ErrorMessage errorMsg("Opus audio cannot be decoded: " +
+                              (opusDecoder_ ? opusDecoder_->getLastError()
+                                            : std::string("unavailable")),
+                          "UNSUPPORTED_AUDIO_CODEC");
+    sendMessage(errorMsg.serialize());
+    return;
+  }
+
+  // The envelope is authoritative for the stream's sample rate
+  const auto &format = getAudioFormat();
+  if (format.sampleRate != header.sampleRate) {
+    audio::AudioFormat updated = format;
+    updated.sampleRate = header.sampleRate;
+    setAudioFormat(updated);
+  }
+
+  if (header.captureTimestampUs != 0) {
+    lastFrameCaptureTimestampUs_ = header.captureTimestampUs;
+    recordCaptureLatency("websocket.latency_ms", header.captureTimestampUs);
+  }
+
+  orderedFrames_.clear();
+  if (!frameSequencer_.push(frame, orderedFrames_)) {
+    ErrorMessage errorMsg("Audio frame payload could not be decoded",
+                          "INVALID_AUDIO_FRAME");
+    sendMessage(errorMsg.serialize());
+    return;
+  }
+
+  if (!orderedFrames_.empty() && !vadInitialized_ && !initializeVAD()) {
+    speechrnt::utils::Logger::error("Failed to initialize VAD for session " +
+                                    sessionId_);
+    ErrorMessage errorMsg("VAD initialization failed", "VAD_INIT_ERROR");
+    sendMessage(errorMsg.serialize());
+    return;
+  }
+
+  for (const auto &ordered : orderedFrames_) {
+    if (!audioIngestion_->ingestAudioChunk(
+            audio::AudioChunk(ordered.samples, ordered.sequenceNumber))) {
+      speechrnt::utils::Logger::warn(
+          "Session " + sessionId_ + " failed to ingest audio frame " +
+          std::to_string(ordered.sequenceNumber) + ": " +
+          audioIngestion_->getErrorMessage());
+      continue;
+    }
+
+    processIngestedSamples(ordered.samples);
+
+    if (ordered.endOfUtterance && vad_) {
+      vad_->forceUtteranceEnd();
+    }
+  }
+}
+
+bool ClientSession::ensureOpusDecoder(uint32_t sampleRate) {
+  if (opusDecoder_ && opusDecoder_->isInitialized() &&
+      opusDecoder_->getSampleRate() == static_cast<int>(sampleRate)) {
+    return true;
+  }
+
+  if (!opusDecoder_) {
+    opusDecoder_ = std::make_unique<audio::OpusStreamDecoder>();
+  }
+  if (!opusDecoder_->initialize(static_cast<int>(sampleRate), 1)) {
+    speechrnt::utils::Logger::warn("Session " + sessionId_ +
+                                   " cannot decode Opus input: " +
+                                   opusDecoder_->getLastError());
+    return false;
+  }
+
+  speechrnt::utils::Logger::info("Session " + sessionId_ +
+                                 " decoding Opus input at " +
+                                 std::to_string(sampleRate) + "Hz");
+  return true;
+}
+
+bool ClientSession::configureOutputCodec(const std::string &codec, int bitrate,
+                                         int frameMs) {
+  if (codec.empty()) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(egressMutex_);
+  if (codec == "pcm") {
+    opusEncoder_.reset();
+    return true;
+  }
+
+  if (codec != "opus") {
+    ErrorMessage errorMsg("Unknown output codec: " + codec,
+                          "CODEC_UNAVAILABLE");
+    sendMessage(errorMsg.serialize());
+    return false;
+  }
+
+  audio::OpusCodecConfig config;
+  config.sampleRate = opusEncoder_ ? opusEncoder_->getConfig().sampleRate
+                                   : 24000; // Piper voices run at 22050 Hz
+  config.bitrate = bitrate;
+  config.frameDurationMs = frameMs;
+
+  auto encoder = std::make_unique<audio::OpusStreamEncoder>();
+  if (!encoder->initialize(config)) {
+    speechrnt::utils::Logger::warn("Session " + sessionId_ +
+                                   " cannot enable Opus output: " +
+                                   encoder->getLastError());
+    ErrorMessage errorMsg("Opus output unavailable: " + encoder->getLastError(),
+                          "CODEC_UNAVAILABLE");
+    sendMessage(errorMsg.serialize());
+    return false;
+  }
+
+  opusEncoder_ = std::move(encoder);
+  speechrnt::utils::Logger::info(
+      "Session " + sessionId_ + " Opus output enabled: " +
+      std::to_string(bitrate) + "bps, " + std::to_string(frameMs) + "ms frames");
+  return true;
+}
+
+bool ClientSession::sendSynthesizedAudio(uint32_t utteranceId,
+                                         const std::vector<uint8_t> &wavData) {
+  // Only real WAV output goes to the client, never placeholder bytes
+  if (wavData.size() < 44 || std::memcmp(wavData.data(), "RIFF", 4) != 0) {
+    return false;
+  }
+  AudioStartMessage startMsg(utteranceId, 0.0);
+  return sendAudioSegment(startMsg, wavData);
+}
+
+void ClientSession::setTTSEngine(
+    std::shared_ptr<speechrnt::tts::TTSInterface> engine) {
+  std::lock_guard<std::mutex> lock(synthesisMutex_);
+  ttsEngine_ = std::move(engine);
+}
+
+bool ClientSession::streamSynthesizedSpeech(uint32_t utteranceId,
+                                            const std::string &text) {
+  std::shared_ptr<speechrnt::tts::TTSInterface> engine;
+  {
+    std::lock_guard<std::mutex> lock(synthesisMutex_);
+    engine = ttsEngine_;
+  }
+  if (!engine || !engine->isReady()) {
+    return false;
+  }
+  if (!admissionProfile_.speechSynthesis) {
+    return true;
+  }
+
+  // Synthesis is the first thing to go when the pipeline is saturated; the
+  // client still has the translation text
+  auto &admission = AdmissionController::getInstance();
+  if (!admission.canAcceptWork()) {
+    admission.recordShed();
+    speechrnt::utils::Logger::warn("Session " + sessionId_ +
+                                   " skipped speech synthesis under load");
+    return true;
+  }
+
+  cancelSpeechSynthesis();
+
+  auto requested = std::chrono::steady_clock::now();
+  auto trace = speechrnt::utils::TraceRecorder::isEnabled()
+                   ? speechrnt::utils::TraceRecorder::current()
+                   : speechrnt::utils::TraceContext();
+  auto handle = engine->synthesizeStreaming(
+      text,
+      [this, utteranceId, requested,
+       trace](const speechrnt::tts::SynthesisResult &unit, size_t unitIndex,
+              bool isLastUnit) {
+        speechrnt::utils::ScopedTraceContext traceScope(trace);
+        if (!unit.success) {
+          ErrorMessage errorMsg("Speech synthesis failed: " + unit.errorMessage,
+                                "TTS_ERROR");
+          sendMessage(errorMsg.serialize());
+          return;
+        }
+
+        // Measured here as well as in the engine so queueing inside the
+        // session is included
+        if (unitIndex == 0) {
+          speechrnt::utils::PerformanceMonitor::getInstance().recordLatency(
+              "session.time_to_first_audio_ms",
+              std::chrono::duration<double, std::milli>(
+                  std::chrono::steady_clock::now() - requested)
+                  .count());
+        }
+
+        if (isLastUnit) {
+          AdmissionController::getInstance().recordServiceTime(
+              AdmissionStage::SYNTHESIS,
+              std::chrono::duration<double, std::milli>(
+                  std::chrono::steady_clock::now() - requested)
+                  .count());
+        }
+
+        AudioStartMessage startMsg(utteranceId, 0.0);
+        startMsg.setSegment(static_cast<uint32_t>(unitIndex), isLastUnit);
+        sendAudioSegment(startMsg, unit.audioData);
+      },
+      voiceId_);
+
+  // Another worker may have started a stream for this session meanwhile;
+  // its callbacks capture this session, so it must finish before it is
+  // dropped
+  {
+    std::lock_guard<std::mutex> lock(synthesisMutex_);
+    std::swap(activeSynthesis_, handle);
+  }
+  retireSynthesis(std::move(handle));
+  return true;
+}
+
+void ClientSession::cancelSpeechSynthesis() {
+  std::shared_ptr<speechrnt::tts::StreamingSynthesis> synthesis;
+  {
+    std::lock_guard<std::mutex> lock(synthesisMutex_);
+    synthesis = std::move(activeSynthesis_);
+  }
+  retireSynthesis(std::move(synthesis));
+}
+
+void ClientSession::interruptSpeechSynthesis() {
+  // Runs on the event loop, so it must not wait for the engine thread; the
+  // handle stays in place for the next stream or the destructor to wait on
+  std::shared_ptr<speechrnt::tts::StreamingSynthesis> synthesis;
+  {
+    std::lock_guard<std::mutex> lock(synthesisMutex_);
+    synthesis = activeSynthesis_;
+  }
+  if (synthesis && !synthesis->isDone() && !synthesis->isCancelled()) {
+    synthesis->cancel();
+    speechrnt::utils::Logger::info(
+        "Session " + sessionId_ + " interrupted speech synthesis after " +
+        std::to_string(synthesis->getUnitsDelivered()) + " units");
+  }
+}
+
+void ClientSession::retireSynthesis(
+    std::shared_ptr<speechrnt::tts::StreamingSynthesis> synthesis) {
+  if (!synthesis) {
+    return;
+  }
+
+  if (!synthesis->isDone()) {
+    synthesis->cancel();
+    speechrnt::utils::Logger::info(
+        "Session " + sessionId_ + " cancelled speech synthesis after " +
+        std::to_string(synthesis->getUnitsDelivered()) + " units");
+  }
+  // A unit may be mid-delivery on the engine thread
+  synthesis->wait();
+}
+
+bool ClientSession::sendAudioSegment(AudioStartMessage &startMsg,
+                                     const std::vector<uint8_t> &wavData) {
+  speechrnt::utils::TraceSpan span("send");
+  std::vector<float> samples;
+  int sampleRate = 0;
+  bool decoded = decodeWavPCM16(wavData, samples, sampleRate);
+  double duration =
+      decoded && sampleRate > 0
+          ? static_cast<double>(samples.size()) / sampleRate
+          : 0.0;
+  startMsg.setDuration(duration);
+
+  // First and last segments of the utterance delimit the frame stream
+  bool firstSegment = !startMsg.isSegmented() || startMsg.getSegmentIndex() == 0;
+  bool lastSegment = startMsg.isFinalSegment();
+
+  std::lock_guard<std::mutex> lock(egressMutex_);
+
+  if (!opusEncoder_ || !decoded) {
+    sendMessage(startMsg.serialize());
+    sendBinaryMessage(wavData);
+    return true;
+  }
+
+  int codecRate = audio::OpusStreamEncoder::nearestSupportedSampleRate(sampleRate);
+  if (codecRate != opusEncoder_->getConfig().sampleRate) {
+    audio::OpusCodecConfig config = opusEncoder_->getConfig();
+    config.sampleRate = codecRate;
+    if (!opusEncoder_->initialize(config)) {
+      speechrnt::utils::Logger::warn("Session " + sessionId_ +
+                                     " Opus encoder reinit failed: " +
+                                     opusEncoder_->getLastError());
+      sendMessage(startMsg.serialize());
+      sendBinaryMessage(wavData);
+      return false;
+    }
+  }
+
+  std::vector<std::vector<uint8_t>> packets;
+  if (firstSegment) {
+    opusEncoder_->reset();
+  }
+  opusEncoder_->encode(samples, sampleRate, packets);
+  opusEncoder_->flush(packets);
+
+  sendMessage(startMsg.serialize());
+
+  AudioFrameHeader header;
+  header.codec = AudioFrameCodec::OPUS;
+  header.sampleRate = static_cast<uint32_t>(codecRate);
+  header.captureTimestampUs = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count());
+
+  size_t egressBytes = 0;
+  for (size_t i = 0; i < packets.size(); ++i) {
+    header.sequenceNumber = outputSequenceNumber_++;
+    header.flags = 0;
+    if (i == 0 && firstSegment) {
+      header.flags |= AudioFrameFlags::START_OF_UTTERANCE;
+    }
+    if (i + 1 == packets.size() && lastSegment) {
+      header.flags |= AudioFrameFlags::END_OF_UTTERANCE;
+    }
+
+    auto frame = AudioFrameEnvelope::serialize(
+        header, std::string_view(reinterpret_cast<const char *>(packets[i].data()),
+                                 packets[i].size()));
+    egressBytes += frame.size();
+    sendBinaryMessage(frame);
+  }
+
+  if (egressBytes > 0) {
+    speechrnt::utils::PerformanceMonitor::getInstance().recordMetric(
+        "audio.tts_egress_compression_ratio",
+        static_cast<double>(wavData.size()) / egressBytes, "ratio");
+  }
+  return true;
+}
+
+void ClientSession::processIngestedSamples(const std::vector<float> &samples) {
+  if (samples.empty() || !vad_) {
+    return;
+  }
+
+  // Framed once; the VAD and any other subscribers share the features
+  featureBus_->push(samples);
+
+  // While speaking, feed audio chunks to the streaming transcriber
+  if (isVADActive() && vad_->getCurrentState() == audio::VadState::SPEAKING &&
+      streamingTranscriber_) {
+    uint32_t currentUtteranceId = vad_->getCurrentUtteranceId();
+    if (currentUtteranceId != 0) {
+      streamingTranscriber_->addAudioData(currentUtteranceId, samples);
+    }
+  }
+}
+
+void ClientSession::recordCaptureLatency(const std::string &metric,
+                                         uint64_t captureTimestampUs) {
+  using namespace std::chrono;
+  auto nowUs = static_cast<uint64_t>(
+      duration_cast<microseconds>(system_clock::now().time_since_epoch())
+          .count());
+
+  // Client and server clocks are not synchronised; ignore obviously skewed
+  // samples rather than polluting the histogram
+  if (nowUs < captureTimestampUs ||
+      nowUs - captureTimestampUs > 60ull * 1000 * 1000) {
+    return;
+  }
+
+  speechrnt::utils::PerformanceMonitor::getInstance().recordLatency(
+      metric, static_cast<double>(nowUs - captureTimestampUs) / 1000.0);
+}
+
 bool ClientSession::initializeTranscription() {
   if (transcriptionManager_ && streamingTranscriber_) {
     return true; // Already initialized
@@ -449,8 +973,11 @@ bool ClientSession::initializeTranscription() {
   // Create transcription manager
   transcriptionManager_ = std::make_shared<::stt::TranscriptionManager>();
 
-  // Initialize with default model (this should be configurable)
-  std::string modelPath = "data/whisper/ggml-base.bin"; // Default model
+  // Initialize with default model (this should be configurable); sessions
+  // admitted at reduced quality get the tiny model
+  std::string modelPath = admissionProfile_.reducedModel
+                              ? "data/whisper/ggml-tiny.bin"
+                              : "data/whisper/ggml-base.bin";
   if (!transcriptionManager_->initialize(modelPath, "whisper")) {
     speechrnt::utils::Logger::error(
         "Failed to initialize transcription manager for session " + sessionId_ +
@@ -476,6 +1003,8 @@ bool ClientSession::initializeTranscription() {
         "Failed to initialize streaming transcriber for session " + sessionId_);
     return false;
   }
+  streamingTranscriber_->setIncrementalUpdatesEnabled(
+      admissionProfile_.partialResults);
 
   // Apply normalization config from STTConfigManager if available
   if (auto engine = transcriptionManager_->getSTTEngine()) {
@@ -523,7 +1052,7 @@ void ClientSession::shutdownTranscription() {
 }
 
 void ClientSession::startStreamingTranscription(
-    uint32_t utteranceId, const std::vector<float> &audioData) {
+    uint32_t utteranceId, const audio::AudioSegment &audio) {
   if (!streamingTranscriber_) {
     if (!initializeTranscription()) {
       speechrnt::utils::Logger::error(
@@ -537,8 +1066,10 @@ void ClientSession::startStreamingTranscription(
     }
   }
 
-  // Start streaming transcription
-  streamingTranscriber_->startTranscription(utteranceId, audioData, true);
+  // Start streaming transcription; without partial results the utterance is
+  // transcribed once instead of in live passes
+  streamingTranscriber_->startTranscription(utteranceId, audio,
+                                            admissionProfile_.partialResults);
 
   speechrnt::utils::Logger::debug(
       "Started streaming transcription for utterance " +
@@ -23,6 +23,16 @@ std::string ConfigMessage::serialize() const {
   data.setObjectProperty(
       "languageDetectionThreshold",
       utils::JsonValue(static_cast<double>(languageDetectionThreshold_)));
+  if (!inputCodec_.empty()) {
+    data.setObjectProperty("inputCodec", utils::JsonValue(inputCodec_));
+  }
+  if (!outputCodec_.empty()) {
+    data.setObjectProperty("outputCodec", utils::JsonValue(outputCodec_));
+  }
+  data.setObjectProperty("opusBitrate",
+                         utils::JsonValue(static_cast<double>(opusBitrate_)));
+  data.setObjectProperty("opusFrameMs",
+                         utils::JsonValue(static_cast<double>(opusFrameMs_)));
 
   root.setObjectProperty("data", data);
 
@@ -90,6 +100,7 @@ std::string TranslationResultMessage::serialize() const {
   data.setObjectProperty("translatedText", utils::JsonValue(translatedText_));
   data.setObjectProperty(
       "utteranceId", utils::JsonValue(static_cast<double>(getUtteranceId())));
+  data.setObjectProperty("isPartial", utils::JsonValue(isPartial_));
 
   root.setObjectProperty("data", data);
 
@@ -107,6 +118,11 @@ std::string AudioStartMessage::serialize() const {
   data.setObjectProperty(
       "utteranceId", utils::JsonValue(static_cast<double>(getUtteranceId())));
   data.setObjectProperty("duration", utils::JsonValue(duration_));
+  if (segmented_) {
+    data.setObjectProperty(
+        "segmentIndex", utils::JsonValue(static_cast<double>(segmentIndex_)));
+    data.setObjectProperty("finalSegment", utils::JsonValue(finalSegment_));
+  }
 
   root.setObjectProperty("data", data);
 
@@ -188,6 +204,35 @@ std::string LanguageChangeMessage::serialize() const {
   return utils::JsonParser::stringify(root);
 }
 
+// AdmissionStatusMessage implementation
+std::string AdmissionStatusMessage::serialize() const {
+  utils::JsonValue root;
+  root.setObject();
+  root.setObjectProperty("type",
+                         utils::JsonValue(std::string("admission_status")));
+
+  utils::JsonValue features;
+  features.setObject();
+  features.setObjectProperty("partialResults", utils::JsonValue(partialResults_));
+  features.setObjectProperty("reducedModel", utils::JsonValue(reducedModel_));
+  features.setObjectProperty("speechSynthesis",
+                             utils::JsonValue(speechSynthesis_));
+
+  utils::JsonValue data;
+  data.setObject();
+  data.setObjectProperty("decision", utils::JsonValue(decision_));
+  data.setObjectProperty("reason", utils::JsonValue(reason_));
+  data.setObjectProperty("features", features);
+  if (retryAfterMs_ > 0) {
+    data.setObjectProperty(
+        "retryAfterMs", utils::JsonValue(static_cast<double>(retryAfterMs_)));
+  }
+
+  root.setObjectProperty("data", data);
+
+  return utils::JsonParser::stringify(root);
+}
+
 // MessageProtocol implementation
 std::unique_ptr<Message>
 MessageProtocol::parseMessage(const std::string &json) {
@@ -230,6 +275,20 @@ MessageProtocol::parseMessage(const std::string &json) {
           message->setLanguageDetectionThreshold(static_cast<float>(
               data.getProperty("languageDetectionThreshold").asNumber()));
         }
+        if (data.hasProperty("inputCodec")) {
+          message->setInputCodec(data.getProperty("inputCodec").asString());
+        }
+        if (data.hasProperty("outputCodec")) {
+          message->setOutputCodec(data.getProperty("outputCodec").asString());
+        }
+        if (data.hasProperty("opusBitrate")) {
+          message->setOpusBitrate(
+              static_cast<int>(data.getProperty("opusBitrate").asNumber()));
+        }
+        if (data.hasProperty("opusFrameMs")) {
+          message->setOpusFrameMs(
+              static_cast<int>(data.getProperty("opusFrameMs").asNumber()));
+        }
       }
       return std::move(message);
     }
@@ -296,6 +355,9 @@ MessageProtocol::parseMessage(const std::string &json) {
           message->setUtteranceId(static_cast<uint32_t>(
               data.getProperty("utteranceId").asNumber()));
         }
+        if (data.hasProperty("isPartial")) {
+          message->setPartial(data.getProperty("isPartial").asBool());
+        }
       }
       return std::move(message);
     }
@@ -311,6 +373,13 @@ MessageProtocol::parseMessage(const std::string &json) {
         if (data.hasProperty("duration")) {
           message->setDuration(data.getProperty("duration").asNumber());
         }
+        if (data.hasProperty("segmentIndex")) {
+          message->setSegment(
+              static_cast<uint32_t>(
+                  data.getProperty("segmentIndex").asNumber()),
+              !data.hasProperty("finalSegment") ||
+                  data.getProperty("finalSegment").asBool());
+        }
       }
       return std::move(message);
     }
@@ -382,6 +451,39 @@ MessageProtocol::parseMessage(const std::string &json) {
       return std::move(message);
     }
 
+    case MessageType::ADMISSION_STATUS: {
+      auto message = std::make_unique<AdmissionStatusMessage>();
+      if (root.hasProperty("data")) {
+        const auto &data = root.getProperty("data");
+        if (data.hasProperty("decision")) {
+          message->setDecision(data.getProperty("decision").asString());
+        }
+        if (data.hasProperty("reason")) {
+          message->setReason(data.getProperty("reason").asString());
+        }
+        if (data.hasProperty("features")) {
+          const auto &features = data.getProperty("features");
+          if (features.hasProperty("partialResults")) {
+            message->setPartialResults(
+                features.getProperty("partialResults").asBool());
+          }
+          if (features.hasProperty("reducedModel")) {
+            message->setReducedModel(
+                features.getProperty("reducedModel").asBool());
+          }
+          if (features.hasProperty("speechSynthesis")) {
+            message->setSpeechSynthesis(
+                features.getProperty("speechSynthesis").asBool());
+          }
+        }
+        if (data.hasProperty("retryAfterMs")) {
+          message->setRetryAfterMs(static_cast<uint32_t>(
+              data.getProperty("retryAfterMs").asNumber()));
+        }
+      }
+      return std::move(message);
+    }
+
     default:
       speechrnt::utils::Logger::warn("Unknown message type: " + typeStr);
       return nullptr;
@@ -449,6 +551,13 @@ bool MessageProtocol::validateMessage(const std::string &json) {
       }
       return false;
 
+    case MessageType::ADMISSION_STATUS:
+      if (root.hasProperty("data")) {
+        const auto &data = root.getProperty("data");
+        return data.hasProperty("decision");
+      }
+      return false;
+
     case MessageType::TRANSLATION_RESULT:
       if (root.hasProperty("data")) {
         const auto &data = root.getProperty("data");
@@ -518,6 +627,8 @@ MessageType MessageProtocol::stringToMessageType(const std::string &typeStr) {
     return MessageType::PONG;
   if (typeStr == "language_change")
     return MessageType::LANGUAGE_CHANGE;
+  if (typeStr == "admission_status")
+    return MessageType::ADMISSION_STATUS;
   return MessageType::UNKNOWN;
 }
 
@@ -543,6 +654,8 @@ std::string MessageProtocol::messageTypeToString(MessageType type) {
     return "pong";
   case MessageType::LANGUAGE_CHANGE:
     return "language_change";
+  case MessageType::ADMISSION_STATUS:
+    return "admission_status";
   default:
     return "unknown";
   }
@@ -0,0 +1,167 @@
+#include "core/outbound_queue.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+namespace core {
+
+namespace {
+
+/**
+ * Raw text of the value following "key": in a serialized JSON object
+ * Messages are classified on every send, so this scans instead of parsing.
+ */
+std::string_view findJsonValue(std::string_view json, std::string_view key) {
+    size_t pos = 0;
+    while ((pos = json.find(key, pos)) != std::string_view::npos) {
+        size_t end = pos + key.size();
+        bool quoted = pos > 0 && json[pos - 1] == '"' && end < json.size() && json[end] == '"';
+        pos = end;
+        if (!quoted) {
+            continue;
+        }
+        size_t i = end + 1;
+        while (i < json.size() && std::isspace(static_cast<unsigned char>(json[i]))) ++i;
+        if (i >= json.size() || json[i] != ':') {
+            continue;
+        }
+        ++i;
+        while (i < json.size() && std::isspace(static_cast<unsigned char>(json[i]))) ++i;
+        return json.substr(i);
+    }
+    return {};
+}
+
+bool startsWith(std::string_view value, std::string_view prefix) {
+    return value.substr(0, prefix.size()) == prefix;
+}
+
+} // namespace
+
+OutboundStats OutboundCounters::snapshot() const {
+    OutboundStats stats;
+    stats.queuedBytes = queuedBytes_.load(std::memory_order_relaxed);
+    stats.queuedMessages = queuedMessages_.load(std::memory_order_relaxed);
+    stats.socketBufferedBytes = socketBufferedBytes_.load(std::memory_order_relaxed);
+    stats.sent = sent_.load(std::memory_order_relaxed);
+    stats.coalesced = coalesced_.load(std::memory_order_relaxed);
+    stats.droppedPartials = droppedPartials_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+OutboundQueue::OutboundQueue(const OutboundQueueConfig& config)
+    : config_(config)
+    , counters_(std::make_shared<OutboundCounters>()) {
+}
+
+OutboundQueue::Message OutboundQueue::classify(std::string payload, bool binary) {
+    Message message;
+    message.binary = binary;
+    std::string_view type = binary ? std::string_view() : findJsonValue(payload, "type");
+    message.translation = startsWith(type, "\"translation_result\"");
+    if (message.translation || startsWith(type, "\"transcription_update\"")) {
+        std::string_view id = findJsonValue(payload, "utteranceId");
+        if (!id.empty()) {
+            message.utteranceId = std::strtoll(std::string(id.substr(0, 24)).c_str(), nullptr, 10);
+        }
+        if (startsWith(findJsonValue(payload, "isPartial"), "true")) {
+            message.priority = OutboundPriority::PARTIAL;
+        }
+    }
+    message.payload = std::move(payload);
+    return message;
+}
+
+OutboundQueue::PushResult OutboundQueue::push(Message message) {
+    auto& counters = *counters_;
+    PushResult result = PushResult::QUEUED;
+    bool high = message.priority == OutboundPriority::HIGH;
+
+    if (message.utteranceId >= 0) {
+        auto pending = std::find_if(partials_.begin(), partials_.end(), [&](const Message& queued) {
+            return queued.utteranceId == message.utteranceId &&
+                   queued.translation == message.translation;
+        });
+        if (pending != partials_.end()) {
+            counters.coalesced_.fetch_add(1, std::memory_order_relaxed);
+            if (message.priority == OutboundPriority::PARTIAL) {
+                // Keep the utterance's place in line, with the newer text
+                bytes_ = bytes_ - pending->payload.size() + message.payload.size();
+                *pending = std::move(message);
+                result = PushResult::COALESCED;
+            } else {
+                // The final makes the pending partial obsolete
+                bytes_ -= pending->payload.size();
+                partials_.erase(pending);
+            }
+        }
+    }
+
+    if (result != PushResult::COALESCED) {
+        bytes_ += message.payload.size();
+        if (message.priority == OutboundPriority::PARTIAL) {
+            partials_.push_back(std::move(message));
+        } else {
+            high_.push_back(std::move(message));
+        }
+    }
+
+    // Partials are the cheapest to lose: a newer one or the final follows
+    while (overCapacity() && !partials_.empty()) {
+        eraseFront(partials_);
+        counters.droppedPartials_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (high && overCapacity()) {
+        // Only high priority messages are left, the newest being the one just pushed
+        bytes_ -= high_.back().payload.size();
+        high_.pop_back();
+        counters.dropped_.fetch_add(1, std::memory_order_relaxed);
+        result = PushResult::OVERFLOW;
+    }
+
+    publishSize();
+    return result;
+}
+
+const OutboundQueue::Message* OutboundQueue::front() const {
+    if (!high_.empty()) {
+        return &high_.front();
+    }
+    return partials_.empty() ? nullptr : &partials_.front();
+}
+
+void OutboundQueue::pop() {
+    if (!high_.empty()) {
+        eraseFront(high_);
+    } else if (!partials_.empty()) {
+        eraseFront(partials_);
+    }
+    publishSize();
+}
+
+void OutboundQueue::recordSent(size_t socketBufferedBytes) {
+    counters_->sent_.fetch_add(1, std::memory_order_relaxed);
+    recordSocketBuffered(socketBufferedBytes);
+}
+
+void OutboundQueue::recordSocketBuffered(size_t socketBufferedBytes) {
+    counters_->socketBufferedBytes_.store(socketBufferedBytes, std::memory_order_relaxed);
+}
+
+bool OutboundQueue::overCapacity() const {
+    return bytes_ > config_.maxBytes || size() > config_.maxMessages;
+}
+
+void OutboundQueue::eraseFront(std::deque<Message>& queue) {
+    bytes_ -= queue.front().payload.size();
+    queue.pop_front();
+}
+
+void OutboundQueue::publishSize() {
+    counters_->queuedBytes_.store(bytes_, std::memory_order_relaxed);
+    counters_->queuedMessages_.store(size(), std::memory_order_relaxed);
+}
+
+} // namespace core
@@ -1,4 +1,5 @@
 #include "core/pipeline_websocket_integration.hpp"
+#include "core/message_protocol.hpp"
 #include "utils/logging.hpp"
 #include <iomanip>
 #include <sstream>
@@ -45,6 +46,11 @@ bool PipelineWebSocketIntegration::initialize() {
         handleTranslationComplete(result);
       });
 
+  pipeline_->setPartialTranslationCallback(
+      [this](const PipelineResult &result) {
+        handlePartialTranslation(result);
+      });
+
   pipeline_->setPipelineErrorCallback(
       [this](const PipelineResult &result, const std::string &error) {
         handlePipelineError(result, error);
@@ -66,6 +72,7 @@ void PipelineWebSocketIntegration::shutdown() {
     pipeline_->setLanguageChangeCallback(nullptr);
     pipeline_->setLanguageDetectionCompleteCallback(nullptr);
     pipeline_->setTranslationCompleteCallback(nullptr);
+    pipeline_->setPartialTranslationCallback(nullptr);
     pipeline_->setPipelineErrorCallback(nullptr);
   }
 
@@ -154,6 +161,23 @@ void PipelineWebSocketIntegration::handleTranslationComplete(
   }
 }
 
+void PipelineWebSocketIntegration::handlePartialTranslation(
+    const PipelineResult &result) {
+  if (!active_ || !websocket_server_) {
+    return;
+  }
+
+  try {
+    ::core::TranslationResultMessage message(
+        result.transcription.text, result.translation.translatedText,
+        result.utterance_id, true);
+    websocket_server_->sendMessage(result.session_id, message.serialize());
+  } catch (const std::exception &e) {
+    speechrnt::utils::Logger::error("Failed to send partial translation: " +
+                                    std::string(e.what()));
+  }
+}
+
 void PipelineWebSocketIntegration::handlePipelineError(
     const PipelineResult &result, const std::string &error) {
   if (!active_ || !websocket_server_) {
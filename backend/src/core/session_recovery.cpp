@@ -1,7 +1,7 @@
 #include "core/session_recovery.hpp"
 #include "utils/logging.hpp"
 #include <algorithm>
-#include <fstream>
+#include <cmath>
 #include <random>
 #include <sstream>
 
@@ -16,13 +16,23 @@ SessionRecoveryManager::~SessionRecoveryManager() { shutdown(); }
 void SessionRecoveryManager::initialize() {
   running_ = true;
 
-  // Load existing session data if persistent storage is enabled
-  if (config_.enable_persistent_storage) {
-    loadFromStorage();
+  // Recover existing session data if persistent storage is enabled
+  if (config_.enable_persistent_storage && loadFromStorage()) {
+    // With a zero window every change syncs itself; the timer then only
+    // checks whether to compact
+    auto interval = config_.wal_sync_interval.count() > 0
+                        ? config_.wal_sync_interval
+                        : config_.cleanup_interval;
+    storage_timer_ =
+        speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+            "session_recovery.wal_sync", interval,
+            [this]() { runStorageMaintenance(); }, true);
   }
 
-  // Start cleanup worker thread
-  cleanup_thread_ = std::thread(&SessionRecoveryManager::cleanupWorker, this);
+  // Schedule periodic cleanup
+  cleanup_timer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+      "session_recovery.cleanup", config_.cleanup_interval,
+      [this]() { runScheduledCleanup(); }, true);
 
   speechrnt::utils::Logger::info("SessionRecoveryManager initialized");
 }
@@ -31,13 +41,15 @@ void SessionRecoveryManager::shutdown() {
   if (running_) {
     running_ = false;
 
-    if (cleanup_thread_.joinable()) {
-      cleanup_thread_.join();
-    }
+    speechrnt::utils::TimerService::getInstance().cancel(cleanup_timer_);
+    cleanup_timer_ = speechrnt::utils::TimerService::INVALID_TIMER;
+    speechrnt::utils::TimerService::getInstance().cancel(storage_timer_);
+    storage_timer_ = speechrnt::utils::TimerService::INVALID_TIMER;
 
-    // Save session data if persistent storage is enabled
-    if (config_.enable_persistent_storage) {
-      saveToStorage();
+    // Leave a fresh snapshot so the next start replays nothing
+    if (storage_log_) {
+      compactStorage();
+      storage_log_->close();
     }
 
     std::lock_guard<std::mutex> lock(sessions_mutex_);
@@ -63,6 +75,9 @@ bool SessionRecoveryManager::storeSessionData(const std::string &session_id,
     if (oldest_it != stored_sessions_.end()) {
       speechrnt::utils::Logger::info("Removing oldest session to make room: " +
                                      oldest_it->first);
+      if (storage_log_) {
+        storage_log_->recordRemove(oldest_it->first);
+      }
       stored_sessions_.erase(oldest_it);
     }
   }
@@ -78,6 +93,9 @@ bool SessionRecoveryManager::storeSessionData(const std::string &session_id,
   auto session_data = std::make_shared<SessionRecoveryData>(data);
   session_data->created_at = std::chrono::steady_clock::now();
   stored_sessions_[session_id] = session_data;
+  if (storage_log_) {
+    storage_log_->recordStore(*session_data);
+  }
 
   // Update statistics
   std::lock_guard<std::mutex> stats_lock(stats_mutex_);
@@ -108,6 +126,9 @@ bool SessionRecoveryManager::recoverSession(
   if (isSessionExpired(recovery_data)) {
     speechrnt::utils::Logger::warn(
         "Session recovery data expired for session: " + session_id);
+    if (storage_log_) {
+      storage_log_->recordRemove(session_id);
+    }
     stored_sessions_.erase(it);
     std::lock_guard<std::mutex> stats_lock(stats_mutex_);
     stats_.failed_recoveries++;
@@ -121,6 +142,9 @@ bool SessionRecoveryManager::recoverSession(
     speechrnt::utils::Logger::error(
         "Max recovery attempts exceeded for session: " + session_id);
     recovery_data.is_recoverable = false;
+    if (storage_log_) {
+      storage_log_->recordStore(recovery_data);
+    }
     std::lock_guard<std::mutex> stats_lock(stats_mutex_);
     stats_.failed_recoveries++;
     return false;
@@ -152,6 +176,9 @@ bool SessionRecoveryManager::recoverSession(
                                    session_id);
 
     // Update session activity and remove from storage (session is now active)
+    if (storage_log_) {
+      storage_log_->recordRemove(session_id);
+    }
     stored_sessions_.erase(it);
 
     // Update statistics
@@ -163,6 +190,11 @@ bool SessionRecoveryManager::recoverSession(
   } else {
     speechrnt::utils::Logger::error("Failed to recover session: " + session_id);
 
+    // Persist the attempt so a restart does not reset the limit
+    if (storage_log_) {
+      storage_log_->recordStore(recovery_data);
+    }
+
     // Update statistics
     std::lock_guard<std::mutex> stats_lock(stats_mutex_);
     stats_.failed_recoveries++;
@@ -176,6 +208,9 @@ void SessionRecoveryManager::removeSessionData(const std::string &session_id) {
 
   auto it = stored_sessions_.find(session_id);
   if (it != stored_sessions_.end()) {
+    if (storage_log_) {
+      storage_log_->recordRemove(session_id);
+    }
     stored_sessions_.erase(it);
 
     // Update statistics
@@ -194,6 +229,9 @@ void SessionRecoveryManager::updateSessionActivity(
   auto it = stored_sessions_.find(session_id);
   if (it != stored_sessions_.end()) {
     it->second->last_activity = std::chrono::steady_clock::now();
+    if (storage_log_) {
+      storage_log_->recordActivity(session_id, it->second->last_activity);
+    }
   }
 }
 
@@ -259,6 +297,9 @@ void SessionRecoveryManager::cleanupExpiredSessions() {
 
       speechrnt::utils::Logger::info("Cleaning up expired session: " +
                                      it->first);
+      if (storage_log_) {
+        storage_log_->recordRemove(it->first);
+      }
       it = stored_sessions_.erase(it);
       cleaned_count++;
     } else {
@@ -291,23 +332,13 @@ SessionRecoveryManager::exportSessionData() const {
   return result;
 }
 
-void SessionRecoveryManager::cleanupWorker() {
-  speechrnt::utils::Logger::info("Session recovery cleanup worker started");
-
-  while (running_) {
-    try {
-      cleanupExpiredSessions();
-
-      // Sleep for cleanup interval
-      std::this_thread::sleep_for(config_.cleanup_interval);
-    } catch (const std::exception &e) {
-      speechrnt::utils::Logger::error(
-          "Exception in session recovery cleanup worker: " +
-          std::string(e.what()));
-    }
+void SessionRecoveryManager::runScheduledCleanup() {
+  try {
+    cleanupExpiredSessions();
+  } catch (const std::exception &e) {
+    speechrnt::utils::Logger::error(
+        "Exception in session recovery cleanup: " + std::string(e.what()));
   }
-
-  speechrnt::utils::Logger::info("Session recovery cleanup worker stopped");
 }
 
 bool SessionRecoveryManager::isSessionExpired(
@@ -318,61 +349,75 @@ bool SessionRecoveryManager::isSessionExpired(
 }
 
 bool SessionRecoveryManager::loadFromStorage() {
-  // Simple file-based storage implementation
-  // In production, this could be replaced with a database
+  storage_log_ = std::make_unique<SessionRecoveryLog>(
+      config_.storage_path, config_.wal_sync_interval.count() == 0);
 
-  std::ifstream file(config_.storage_path);
-  if (!file.is_open()) {
-    speechrnt::utils::Logger::info(
-        "No existing session recovery storage found");
-    return true; // Not an error, just no existing data
+  SessionRecoveryMap recovered;
+  if (!storage_log_->open(recovered)) {
+    speechrnt::utils::Logger::error(
+        "Session recovery storage unavailable, continuing without it: " +
+        config_.storage_path);
+    storage_log_.reset();
+    return false;
   }
 
-  try {
-    // Simple JSON-like format for demonstration
-    // In production, use a proper serialization library
-    std::string line;
-    while (std::getline(file, line)) {
-      // Parse session data from line
-      // This is a simplified implementation
-      speechrnt::utils::Logger::info(
-          "Loaded session recovery data from storage");
-    }
-
-    file.close();
-    return true;
-  } catch (const std::exception &e) {
-    speechrnt::utils::Logger::error("Failed to load session recovery data: " +
-                                    std::string(e.what()));
-    return false;
+  size_t count = recovered.size();
+  {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    stored_sessions_ = std::move(recovered);
+    std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+    stats_.current_stored_sessions = stored_sessions_.size();
   }
+
+  auto storage_stats = storage_log_->getStatistics();
+  speechrnt::utils::Logger::info(
+      "Recovered " + std::to_string(count) + " sessions from storage (" +
+      std::to_string(storage_stats.records_replayed) + " records in " +
+      std::to_string(storage_stats.recovery_time.count()) + " us)");
+  return true;
 }
 
-bool SessionRecoveryManager::saveToStorage() {
-  std::ofstream file(config_.storage_path);
-  if (!file.is_open()) {
-    speechrnt::utils::Logger::error(
-        "Failed to open session recovery storage for writing");
+bool SessionRecoveryManager::flushStorage() {
+  return storage_log_ && storage_log_->sync();
+}
+
+bool SessionRecoveryManager::compactStorage() {
+  if (!storage_log_) {
     return false;
   }
+  std::lock_guard<std::mutex> compaction_lock(compaction_mutex_);
 
-  try {
+  // Rotating and encoding under the sessions lock makes the snapshot the
+  // exact state at the end of the segments it replaces; the disk write
+  // happens after the lock is released
+  std::string snapshot;
+  uint64_t generation = 0;
+  {
     std::lock_guard<std::mutex> lock(sessions_mutex_);
-
-    // Simple JSON-like format for demonstration
-    for (const auto &pair : stored_sessions_) {
-      // Serialize session data to line
-      // This is a simplified implementation
-      file << pair.first << std::endl;
+    generation = storage_log_->rotate();
+    if (generation == 0) {
+      return false;
     }
+    SessionRecoveryLog::encodeSnapshot(stored_sessions_, generation, snapshot);
+  }
+  return storage_log_->installSnapshot(snapshot, generation);
+}
 
-    file.close();
-    speechrnt::utils::Logger::info("Saved session recovery data to storage");
-    return true;
+SessionRecoveryLog::Statistics SessionRecoveryManager::getStorageStats() const {
+  return storage_log_ ? storage_log_->getStatistics()
+                      : SessionRecoveryLog::Statistics{};
+}
+
+void SessionRecoveryManager::runStorageMaintenance() {
+  try {
+    flushStorage();
+    if (storage_log_->needsCompaction(config_.wal_compaction_bytes)) {
+      compactStorage();
+    }
   } catch (const std::exception &e) {
-    speechrnt::utils::Logger::error("Failed to save session recovery data: " +
-                                    std::string(e.what()));
-    return false;
+    speechrnt::utils::Logger::error(
+        "Exception in session recovery storage maintenance: " +
+        std::string(e.what()));
   }
 }
 
@@ -0,0 +1,695 @@
+#include "core/session_recovery_log.hpp"
+#include "core/session_recovery.hpp"
+#include "utils/logging.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace core {
+
+namespace {
+
+constexpr uint32_t RECORD_MAGIC = 0x53525231;   // "SRR1"
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53525331; // "SRS1"
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr uint32_t MAX_RECORD_LENGTH = 1u << 24;
+
+enum RecordType : uint8_t {
+  RECORD_STORE = 1,    // Full session, replacing any previous one
+  RECORD_ACTIVITY = 2, // Session id and last activity
+  RECORD_REMOVE = 3    // Session id
+};
+
+struct RecordHeader {
+  uint32_t magic;
+  uint8_t type;
+  uint8_t reserved[3];
+  uint32_t length; // Payload bytes
+  uint32_t checksum;
+};
+
+struct SnapshotHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t generation; // First segment not covered by the snapshot
+  uint64_t count;
+};
+
+uint32_t checksum(const char *data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ static_cast<unsigned char>(data[i])) * 16777619u;
+  }
+  return hash;
+}
+
+// steady_clock has no meaning across restarts, so timestamps go to disk as
+// wall-clock microseconds; one mapping serves a whole encode or replay
+class ClockMapping {
+public:
+  ClockMapping()
+      : steady_now_(std::chrono::steady_clock::now()),
+        wall_now_us_(std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count()) {}
+
+  int64_t toWall(std::chrono::steady_clock::time_point time) const {
+    return wall_now_us_ +
+           std::chrono::duration_cast<std::chrono::microseconds>(time -
+                                                                 steady_now_)
+               .count();
+  }
+
+  std::chrono::steady_clock::time_point fromWall(int64_t wall_us) const {
+    return steady_now_ + std::chrono::microseconds(wall_us - wall_now_us_);
+  }
+
+private:
+  std::chrono::steady_clock::time_point steady_now_;
+  int64_t wall_now_us_;
+};
+
+class Encoder {
+public:
+  explicit Encoder(std::string &out) : out_(out) {}
+
+  void putU8(uint8_t value) { out_.push_back(static_cast<char>(value)); }
+  void putU32(uint32_t value) { putRaw(&value, sizeof(value)); }
+  void putI64(int64_t value) { putRaw(&value, sizeof(value)); }
+  void putString(const std::string &value) {
+    putU32(static_cast<uint32_t>(value.size()));
+    out_.append(value);
+  }
+  void putRaw(const void *data, size_t size) {
+    out_.append(static_cast<const char *>(data), size);
+  }
+
+  // Frame the payload written between beginRecord() and endRecord()
+  size_t beginRecord(uint8_t type) {
+    RecordHeader header{};
+    header.magic = RECORD_MAGIC;
+    header.type = type;
+    size_t start = out_.size();
+    putRaw(&header, sizeof(header));
+    return start;
+  }
+  void endRecord(size_t start) {
+    RecordHeader header;
+    std::memcpy(&header, out_.data() + start, sizeof(header));
+    size_t payload = start + sizeof(header);
+    header.length = static_cast<uint32_t>(out_.size() - payload);
+    header.checksum = checksum(out_.data() + payload, header.length);
+    std::memcpy(&out_[start], &header, sizeof(header));
+  }
+
+private:
+  std::string &out_;
+};
+
+class Decoder {
+public:
+  Decoder(const char *data, size_t size) : ptr_(data), end_(data + size) {}
+
+  bool ok() const { return ok_; }
+  uint8_t getU8() {
+    uint8_t value = 0;
+    getRaw(&value, sizeof(value));
+    return value;
+  }
+  uint32_t getU32() {
+    uint32_t value = 0;
+    getRaw(&value, sizeof(value));
+    return value;
+  }
+  int64_t getI64() {
+    int64_t value = 0;
+    getRaw(&value, sizeof(value));
+    return value;
+  }
+  std::string getString() {
+    uint32_t size = getU32();
+    if (!ok_ || size > static_cast<size_t>(end_ - ptr_)) {
+      ok_ = false;
+      return {};
+    }
+    std::string value(ptr_, size);
+    ptr_ += size;
+    return value;
+  }
+
+private:
+  void getRaw(void *data, size_t size) {
+    if (!ok_ || size > static_cast<size_t>(end_ - ptr_)) {
+      ok_ = false;
+      return;
+    }
+    std::memcpy(data, ptr_, size);
+    ptr_ += size;
+  }
+
+  const char *ptr_;
+  const char *end_;
+  bool ok_ = true;
+};
+
+void encodeSession(Encoder &encoder, const SessionRecoveryData &data,
+                   const ClockMapping &clock) {
+  encoder.putString(data.session_id);
+  encoder.putString(data.client_id);
+  encoder.putI64(clock.toWall(data.last_activity));
+  encoder.putI64(clock.toWall(data.created_at));
+  encoder.putString(data.source_lang);
+  encoder.putString(data.target_lang);
+  encoder.putString(data.voice_id);
+  encoder.putU8(data.is_active ? 1 : 0);
+  encoder.putU32(static_cast<uint32_t>(data.pending_utterances.size()));
+  if (!data.pending_utterances.empty()) {
+    encoder.putRaw(data.pending_utterances.data(),
+                   data.pending_utterances.size() * sizeof(uint32_t));
+  }
+  encoder.putString(data.last_known_state);
+  encoder.putU32(static_cast<uint32_t>(data.custom_data.size()));
+  for (const auto &pair : data.custom_data) {
+    encoder.putString(pair.first);
+    encoder.putString(pair.second);
+  }
+  encoder.putU32(static_cast<uint32_t>(data.recovery_attempts));
+  encoder.putI64(clock.toWall(data.last_recovery_attempt));
+  encoder.putU8(data.is_recoverable ? 1 : 0);
+}
+
+bool decodeSession(Decoder &decoder, SessionRecoveryData &data,
+                   const ClockMapping &clock) {
+  data.session_id = decoder.getString();
+  data.client_id = decoder.getString();
+  data.last_activity = clock.fromWall(decoder.getI64());
+  data.created_at = clock.fromWall(decoder.getI64());
+  data.source_lang = decoder.getString();
+  data.target_lang = decoder.getString();
+  data.voice_id = decoder.getString();
+  data.is_active = decoder.getU8() != 0;
+  uint32_t utterances = decoder.getU32();
+  for (uint32_t i = 0; i < utterances && decoder.ok(); ++i) {
+    data.pending_utterances.push_back(decoder.getU32());
+  }
+  data.last_known_state = decoder.getString();
+  uint32_t custom = decoder.getU32();
+  for (uint32_t i = 0; i < custom && decoder.ok(); ++i) {
+    std::string key = decoder.getString();
+    data.custom_data[std::move(key)] = decoder.getString();
+  }
+  data.recovery_attempts = static_cast<int>(decoder.getU32());
+  data.last_recovery_attempt = clock.fromWall(decoder.getI64());
+  data.is_recoverable = decoder.getU8() != 0;
+  return decoder.ok();
+}
+
+bool readFile(const std::string &path, std::string &contents) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    return false;
+  }
+  contents.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0);
+  return static_cast<bool>(file.read(&contents[0], contents.size()));
+}
+
+// Walk the framed records in data[offset, size), stopping at the first
+// torn or damaged one. Returns the offset just past the last good record.
+template <typename Visitor>
+size_t forEachRecord(const std::string &data, size_t offset, size_t &records,
+                     Visitor &&visit) {
+  while (offset + sizeof(RecordHeader) <= data.size()) {
+    RecordHeader header;
+    std::memcpy(&header, data.data() + offset, sizeof(header));
+    const char *payload = data.data() + offset + sizeof(header);
+    if (header.magic != RECORD_MAGIC || header.length > MAX_RECORD_LENGTH ||
+        header.length > data.size() - offset - sizeof(header) ||
+        checksum(payload, header.length) != header.checksum) {
+      break;
+    }
+    Decoder decoder(payload, header.length);
+    if (!visit(header.type, decoder)) {
+      break;
+    }
+    offset += sizeof(header) + header.length;
+    records++;
+  }
+  return offset;
+}
+
+#ifndef _WIN32
+bool writeFully(int fd, const char *data, size_t size) {
+  while (size > 0) {
+    ssize_t n = ::write(fd, data, size);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+void syncDirectory(const std::filesystem::path &path) {
+  std::filesystem::path directory = path.parent_path();
+  int fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    ::fsync(fd);
+    ::close(fd);
+  }
+}
+#endif
+
+} // namespace
+
+SessionRecoveryLog::SessionRecoveryLog(std::string base_path,
+                                       bool sync_every_append)
+    : base_path_(std::move(base_path)),
+      sync_every_append_(sync_every_append) {}
+
+SessionRecoveryLog::~SessionRecoveryLog() { close(); }
+
+bool SessionRecoveryLog::open(SessionRecoveryMap &sessions) {
+  auto start = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> io_lock(io_mutex_);
+
+  std::filesystem::path base(base_path_);
+  std::filesystem::path directory =
+      base.has_parent_path() ? base.parent_path() : std::filesystem::path(".");
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+
+  // Segments present on disk, oldest first
+  std::vector<uint64_t> segments;
+  const std::string prefix = base.filename().string() + ".wal.";
+  for (const auto &entry : std::filesystem::directory_iterator(directory, ec)) {
+    std::string name = entry.path().filename().string();
+    if (name.compare(0, prefix.size(), prefix) != 0 ||
+        name.size() == prefix.size() ||
+        name.find_first_not_of("0123456789", prefix.size()) !=
+            std::string::npos) {
+      continue;
+    }
+    segments.push_back(std::stoull(name.substr(prefix.size())));
+  }
+  std::sort(segments.begin(), segments.end());
+
+  sessions.clear();
+  uint64_t snapshot_generation = 0;
+  loadSnapshot(sessions, snapshot_generation);
+
+  size_t wal_bytes = 0;
+  uint64_t first_live = snapshot_generation;
+  for (size_t i = 0; i < segments.size(); ++i) {
+    // Left behind by a compaction that stopped after installing its snapshot
+    if (segments[i] < snapshot_generation) {
+      std::filesystem::remove(segmentPath(segments[i]), ec);
+      continue;
+    }
+    if (first_live == 0) {
+      first_live = segments[i];
+    }
+    replaySegment(segments[i], sessions, i + 1 == segments.size());
+    wal_bytes += std::filesystem::file_size(segmentPath(segments[i]), ec);
+  }
+
+  uint64_t active = std::max<uint64_t>(
+      {snapshot_generation, segments.empty() ? 0 : segments.back(), 1});
+  if (!openSegment(active)) {
+    speechrnt::utils::Logger::error("Failed to open session recovery log: " +
+                                    segmentPath(active));
+    return false;
+  }
+
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  first_live_generation_ = first_live == 0 ? active : first_live;
+  stats_.generation = active;
+  stats_.wal_bytes = wal_bytes;
+  stats_.snapshot_bytes = std::filesystem::file_size(snapshotPath(), ec);
+  if (ec) {
+    stats_.snapshot_bytes = 0;
+  }
+  stats_.recovery_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+  return true;
+}
+
+void SessionRecoveryLog::close() {
+  std::lock_guard<std::mutex> io_lock(io_mutex_);
+#ifndef _WIN32
+  if (fd_ >= 0) {
+    writePending(true);
+    ::close(fd_);
+    fd_ = -1;
+  }
+#endif
+}
+
+bool SessionRecoveryLog::isOpen() const {
+  std::lock_guard<std::mutex> io_lock(io_mutex_);
+  return fd_ >= 0;
+}
+
+void SessionRecoveryLog::recordStore(const SessionRecoveryData &data) {
+  thread_local std::string payload;
+  payload.clear();
+  Encoder encoder(payload);
+  encodeSession(encoder, data, ClockMapping());
+  appendRecord(RECORD_STORE, payload);
+}
+
+void SessionRecoveryLog::recordActivity(
+    const std::string &session_id,
+    std::chrono::steady_clock::time_point last_activity) {
+  thread_local std::string payload;
+  payload.clear();
+  Encoder encoder(payload);
+  encoder.putString(session_id);
+  encoder.putI64(ClockMapping().toWall(last_activity));
+  appendRecord(RECORD_ACTIVITY, payload);
+}
+
+void SessionRecoveryLog::recordRemove(const std::string &session_id) {
+  thread_local std::string payload;
+  payload.clear();
+  Encoder encoder(payload);
+  encoder.putString(session_id);
+  appendRecord(RECORD_REMOVE, payload);
+}
+
+bool SessionRecoveryLog::sync() {
+  std::lock_guard<std::mutex> io_lock(io_mutex_);
+  return writePending(true);
+}
+
+uint64_t SessionRecoveryLog::rotate() {
+  std::lock_guard<std::mutex> io_lock(io_mutex_);
+#ifndef _WIN32
+  if (fd_ < 0 || !writePending(true)) {
+    return 0;
+  }
+  ::close(fd_);
+  fd_ = -1;
+  if (!openSegment(generation_ + 1)) {
+    speechrnt::utils::Logger::error("Failed to start session recovery log: " +
+                                    segmentPath(generation_ + 1));
+    return 0;
+  }
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  stats_.generation = generation_;
+  return generation_;
+#else
+  return 0;
+#endif
+}
+
+void SessionRecoveryLog::encodeSnapshot(const SessionRecoveryMap &sessions,
+                                        uint64_t generation,
+                                        std::string &out) {
+  out.clear();
+  out.reserve(sizeof(SnapshotHeader) + sessions.size() * 192);
+
+  SnapshotHeader header{};
+  header.magic = SNAPSHOT_MAGIC;
+  header.version = SNAPSHOT_VERSION;
+  header.generation = generation;
+  header.count = sessions.size();
+
+  Encoder encoder(out);
+  encoder.putRaw(&header, sizeof(header));
+  ClockMapping clock;
+  for (const auto &pair : sessions) {
+    size_t record = encoder.beginRecord(RECORD_STORE);
+    encodeSession(encoder, *pair.second, clock);
+    encoder.endRecord(record);
+  }
+}
+
+bool SessionRecoveryLog::installSnapshot(const std::string &encoded,
+                                         uint64_t generation) {
+#ifndef _WIN32
+  std::string path = snapshotPath();
+  std::string tmp_path = path + ".tmp";
+  int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    speechrnt::utils::Logger::error(
+        "Failed to create session recovery snapshot: " + tmp_path);
+    return false;
+  }
+  bool ok = writeFully(fd, encoded.data(), encoded.size()) && ::fsync(fd) == 0;
+  ::close(fd);
+
+  std::error_code ec;
+  if (ok) {
+    std::filesystem::rename(tmp_path, path, ec);
+    ok = !ec;
+  }
+  if (!ok) {
+    speechrnt::utils::Logger::error(
+        "Failed to write session recovery snapshot: " + path);
+    std::filesystem::remove(tmp_path, ec);
+    return false;
+  }
+  syncDirectory(path);
+
+  // The snapshot is durable; the segments it covers can go
+  uint64_t first_live;
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+    first_live = first_live_generation_;
+  }
+  size_t removed = 0;
+  for (uint64_t g = first_live; g < generation; ++g) {
+    std::string segment = segmentPath(g);
+    size_t size = std::filesystem::file_size(segment, ec);
+    if (!ec && std::filesystem::remove(segment, ec)) {
+      removed += size;
+    }
+  }
+
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  first_live_generation_ = std::max(first_live_generation_, generation);
+  stats_.wal_bytes -= std::min(stats_.wal_bytes, removed);
+  stats_.snapshot_bytes = encoded.size();
+  stats_.compactions++;
+  return true;
+#else
+  (void)encoded;
+  (void)generation;
+  return false;
+#endif
+}
+
+bool SessionRecoveryLog::needsCompaction(size_t threshold_bytes) const {
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  return stats_.wal_bytes >= threshold_bytes &&
+         stats_.wal_bytes >= stats_.snapshot_bytes;
+}
+
+SessionRecoveryLog::Statistics SessionRecoveryLog::getStatistics() const {
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  Statistics stats = stats_;
+  stats.pending_bytes = pending_.size();
+  return stats;
+}
+
+std::string SessionRecoveryLog::segmentPath(uint64_t generation) const {
+  return base_path_ + ".wal." + std::to_string(generation);
+}
+
+std::string SessionRecoveryLog::snapshotPath() const {
+  return base_path_ + ".snapshot";
+}
+
+bool SessionRecoveryLog::openSegment(uint64_t generation) {
+#ifndef _WIN32
+  std::string path = segmentPath(generation);
+  fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  if (fd_ < 0) {
+    return false;
+  }
+  generation_ = generation;
+  return true;
+#else
+  (void)generation;
+  return false;
+#endif
+}
+
+bool SessionRecoveryLog::loadSnapshot(SessionRecoveryMap &sessions,
+                                      uint64_t &generation) {
+  std::string data;
+  if (!readFile(snapshotPath(), data)) {
+    return false;
+  }
+
+  SnapshotHeader header;
+  if (data.size() < sizeof(header)) {
+    speechrnt::utils::Logger::warn("Ignoring truncated session recovery snapshot");
+    return false;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION) {
+    speechrnt::utils::Logger::warn("Ignoring unrecognised session recovery snapshot");
+    return false;
+  }
+
+  sessions.reserve(header.count);
+  ClockMapping clock;
+  size_t records = 0;
+  forEachRecord(data, sizeof(header), records,
+                [&](uint8_t type, Decoder &decoder) {
+                  auto session = std::make_shared<SessionRecoveryData>();
+                  if (type != RECORD_STORE ||
+                      !decodeSession(decoder, *session, clock)) {
+                    return false;
+                  }
+                  std::string id = session->session_id;
+                  sessions[std::move(id)] = std::move(session);
+                  return true;
+                });
+  if (records != header.count) {
+    speechrnt::utils::Logger::warn(
+        "Session recovery snapshot is damaged; recovered " +
+        std::to_string(records) + " of " + std::to_string(header.count) +
+        " sessions");
+  }
+
+  generation = header.generation;
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  stats_.records_replayed = records;
+  return true;
+}
+
+bool SessionRecoveryLog::replaySegment(uint64_t generation,
+                                       SessionRecoveryMap &sessions,
+                                       bool truncate_torn_tail) {
+  std::string path = segmentPath(generation);
+  std::string data;
+  if (!readFile(path, data)) {
+    return false;
+  }
+
+  ClockMapping clock;
+  size_t records = 0;
+  size_t end = forEachRecord(
+      data, 0, records, [&](uint8_t type, Decoder &decoder) {
+        switch (type) {
+        case RECORD_STORE: {
+          auto session = std::make_shared<SessionRecoveryData>();
+          if (!decodeSession(decoder, *session, clock)) {
+            return false;
+          }
+          std::string id = session->session_id;
+          sessions[std::move(id)] = std::move(session);
+          return true;
+        }
+        case RECORD_ACTIVITY: {
+          std::string id = decoder.getString();
+          int64_t last_activity = decoder.getI64();
+          if (!decoder.ok()) {
+            return false;
+          }
+          auto it = sessions.find(id);
+          if (it != sessions.end()) {
+            it->second->last_activity = clock.fromWall(last_activity);
+          }
+          return true;
+        }
+        case RECORD_REMOVE: {
+          std::string id = decoder.getString();
+          if (!decoder.ok()) {
+            return false;
+          }
+          sessions.erase(id);
+          return true;
+        }
+        default:
+          return false;
+        }
+      });
+
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+    stats_.records_replayed += records;
+  }
+
+  if (end < data.size()) {
+    speechrnt::utils::Logger::warn(
+        "Session recovery log " + path + " is damaged at offset " +
+        std::to_string(end) + "; later records in it are dropped");
+    if (truncate_torn_tail) {
+      std::error_code ec;
+      std::filesystem::resize_file(path, end, ec);
+    }
+    return false;
+  }
+  return true;
+}
+
+void SessionRecoveryLog::appendRecord(uint8_t type,
+                                      const std::string &payload) {
+  RecordHeader header{};
+  header.magic = RECORD_MAGIC;
+  header.type = type;
+  header.length = static_cast<uint32_t>(payload.size());
+  header.checksum = checksum(payload.data(), payload.size());
+
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+    pending_.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    pending_.append(payload);
+    stats_.wal_bytes += sizeof(header) + payload.size();
+    stats_.records_appended++;
+  }
+
+  if (sync_every_append_) {
+    sync();
+  }
+}
+
+bool SessionRecoveryLog::writePending(bool datasync) {
+#ifndef _WIN32
+  if (fd_ < 0) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+    if (pending_.empty()) {
+      return true;
+    }
+    writing_.swap(pending_);
+  }
+
+  bool ok = writeFully(fd_, writing_.data(), writing_.size());
+  if (ok && datasync) {
+    ok = ::fdatasync(fd_) == 0;
+  }
+  if (!ok) {
+    speechrnt::utils::Logger::error(
+        "Failed to write session recovery log: " + segmentPath(generation_) +
+        ": " + std::strerror(errno));
+  }
+  writing_.clear();
+
+  std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+  stats_.syncs++;
+  return ok;
+#else
+  (void)datasync;
+  return false;
+#endif
+}
+
+} // namespace core
@@ -1,9 +1,21 @@
 #include "core/task_queue.hpp"
+#include "utils/metrics_registry.hpp"
 #include <chrono>
 
 namespace speechrnt {
 namespace core {
 
+namespace {
+
+// Shared by every TaskQueue instance
+utils::Gauge& queueDepth() {
+    static utils::Gauge& gauge = utils::MetricsRegistry::getInstance().gauge(
+        "speechrnt_queue_depth", "Items waiting in a work queue", {{"queue", "task_queue"}});
+    return gauge;
+}
+
+} // namespace
+
 TaskQueue::TaskQueue() : shutdown_(false) {
 }
 
@@ -23,6 +35,7 @@ void TaskQueue::enqueue(std::shared_ptr<Task> task) {
         }
         queue_.push(task);
     }
+    queueDepth().add(1);
     condition_.notify_one();
 }
 
@@ -43,6 +56,7 @@ std::shared_ptr<Task> TaskQueue::dequeue() {
     
     auto task = queue_.top();
     queue_.pop();
+    queueDepth().sub(1);
     return task;
 }
 
@@ -55,6 +69,7 @@ std::shared_ptr<Task> TaskQueue::tryDequeue() {
     
     auto task = queue_.top();
     queue_.pop();
+    queueDepth().sub(1);
     return task;
 }
 
@@ -72,6 +87,7 @@ void TaskQueue::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
     // Clear the priority queue by creating a new empty one
     std::priority_queue<std::shared_ptr<Task>, std::vector<std::shared_ptr<Task>>, TaskComparator> empty_queue;
+    queueDepth().sub(static_cast<double>(queue_.size()));
     queue_.swap(empty_queue);
 }
 
@@ -155,6 +171,13 @@ void ThreadPool::workerLoop() {
             // Increment active thread count
             active_threads_++;
             
+            utils::ScopedTraceContext trace_scope(task->getTraceContext());
+            if (utils::TraceRecorder::isEnabled()) {
+                utils::TraceRecorder::getInstance().record(
+                    "task_queue.wait", task->getTraceContext(),
+                    utils::TraceRecorder::toTraceTime(task->getCreatedAt()), utils::TraceRecorder::now());
+            }
+            
             // Execute the task
             task->execute();
             
@@ -1,7 +1,9 @@
 #include "core/translation_pipeline.hpp"
+#include "core/admission_controller.hpp"
 #include "utils/logging.hpp"
 #include <algorithm>
 #include <numeric>
+#include <sstream>
 
 namespace speechrnt {
 namespace core {
@@ -81,6 +83,15 @@ void TranslationPipeline::shutdown() {
     active_operations_.clear();
     initialized_ = false;
     
+    {
+        std::lock_guard<std::mutex> speculation_lock(speculation_mutex_);
+        for (const auto& [utterance_id, state] : speculations_) {
+            releaseIncrementalStream(state);
+        }
+        speculations_.clear();
+        speculation_cv_.notify_all();
+    }
+    
     speechrnt::utils::Logger::info("TranslationPipeline shutdown completed");
 }
 
@@ -108,6 +119,432 @@ void TranslationPipeline::processTranscriptionResult(
     }, TaskPriority::HIGH);
 }
 
+void TranslationPipeline::processPartialTranscription(
+    uint32_t utterance_id,
+    const std::string& session_id,
+    const stt::TranscriptionResult& partial
+) {
+    if (!initialized_ || shutdown_requested_ ||
+        (!config_.enable_preliminary_translation && !config_.enable_incremental_translation)) {
+        return;
+    }
+    
+    std::vector<std::string> words = splitWords(partial.text);
+    if (words.empty()) {
+        return;
+    }
+    
+    std::unique_lock<std::mutex> lock(speculation_mutex_);
+    auto now = std::chrono::steady_clock::now();
+    
+    // Utterances that never got a final (or a cancel) would otherwise linger
+    for (auto it = speculations_.begin(); it != speculations_.end();) {
+        if (it->first != utterance_id && !it->second.in_flight && !it->second.stream_busy &&
+            now - it->second.last_update > SPECULATION_IDLE_TIMEOUT) {
+            releaseIncrementalStream(it->second);
+            it = speculations_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    
+    auto& state = speculations_[utterance_id];
+    state.last_update = now;
+    state.recent_partials.push_back(std::move(words));
+    size_t window = std::max<size_t>(config_.speculative_stability_window, 1);
+    while (state.recent_partials.size() > window) {
+        state.recent_partials.pop_front();
+    }
+    if (state.recent_partials.size() < window) {
+        return;
+    }
+    
+    // Stable prefix: the words every recent partial agrees on
+    const auto& newest = state.recent_partials.back();
+    size_t stable = newest.size();
+    for (const auto& earlier : state.recent_partials) {
+        size_t common = 0;
+        while (common < stable && common < earlier.size() && earlier[common] == newest[common]) {
+            ++common;
+        }
+        stable = common;
+    }
+    std::vector<std::string> stable_prefix(newest.begin(), newest.begin() + stable);
+    
+    if (config_.enable_incremental_translation) {
+        updateIncrementalTranslation(utterance_id, session_id, state, stable_prefix);
+    }
+    if (!config_.enable_preliminary_translation) {
+        return;
+    }
+    
+    // The recognizer revised words an earlier speculation relied on
+    if (!isPrefix(state.source, stable_prefix)) {
+        state.source.clear();
+        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+        statistics_.speculative_discarded++;
+    }
+    if (state.in_flight && !isPrefix(state.pending_source, stable_prefix)) {
+        state.generation++;
+        state.in_flight = false;
+        state.running = false;
+        state.pending_source.clear();
+    }
+    
+    // Only translate what the final can use: the whole partial once it has
+    // settled (the speaker paused), or a prefix ending a clause that a final
+    // can extend
+    const auto& current = state.in_flight ? state.pending_source : state.source;
+    bool covers_partial = stable == newest.size();
+    bool at_boundary = config_.speculative_extend_at_boundaries && stable > 0 && isClauseEnd(newest[stable - 1]);
+    if (stable == 0 || stable_prefix == current || (!covers_partial && !at_boundary) ||
+        (!covers_partial && stable < current.size() + std::max<size_t>(config_.speculative_min_new_words, 1))) {
+        return;
+    }
+    
+    // A newer speculation supersedes one still queued or running
+    uint64_t generation = ++state.generation;
+    state.in_flight = true;
+    state.running = false;
+    state.pending_source = stable_prefix;
+    lock.unlock();
+    
+    // Below final translations: speculation only uses otherwise idle workers
+    task_queue_->enqueue([this, utterance_id, generation, source = std::move(stable_prefix)]() mutable {
+        runSpeculativeTranslation(utterance_id, generation, std::move(source));
+    }, TaskPriority::LOW);
+}
+
+void TranslationPipeline::runSpeculativeTranslation(
+    uint32_t utterance_id,
+    uint64_t generation,
+    std::vector<std::string> source
+) {
+    {
+        std::lock_guard<std::mutex> lock(speculation_mutex_);
+        auto it = speculations_.find(utterance_id);
+        if (it == speculations_.end() || it->second.generation != generation) {
+            // Superseded before it started: no MT time spent
+            return;
+        }
+        it->second.running = true;
+    }
+    
+    mt::TranslationResult translation;
+    auto start = std::chrono::steady_clock::now();
+    try {
+        translation = mt_engine_->translate(joinWords(source));
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::warn("Speculative translation failed for utterance " +
+                                       std::to_string(utterance_id) + ": " + e.what());
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    
+    ::core::AdmissionController::getInstance().recordServiceTime(
+        ::core::AdmissionStage::TRANSLATION,
+        std::chrono::duration<double, std::milli>(elapsed).count()
+    );
+    {
+        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+        statistics_.speculative_translations++;
+        statistics_.speculative_mt_time += std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+    }
+    
+    std::lock_guard<std::mutex> lock(speculation_mutex_);
+    auto it = speculations_.find(utterance_id);
+    if (it == speculations_.end() || it->second.generation != generation) {
+        // Superseded or cancelled while translating
+        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+        statistics_.speculative_discarded++;
+        return;
+    }
+    
+    auto& state = it->second;
+    state.in_flight = false;
+    state.running = false;
+    state.pending_source.clear();
+    if (translation.success) {
+        state.source = std::move(source);
+        state.translation = std::move(translation);
+    }
+    speculation_cv_.notify_all();
+}
+
+bool TranslationPipeline::translateWithSpeculation(
+    uint32_t utterance_id,
+    const std::string& text,
+    mt::TranslationResult& result
+) {
+    std::unique_lock<std::mutex> lock(speculation_mutex_);
+    auto it = speculations_.find(utterance_id);
+    if (it == speculations_.end()) {
+        return false;
+    }
+    
+    std::vector<std::string> words = splitWords(text);
+    
+    // Finishing a running speculation the final can use beats starting over.
+    // One still queued is dropped: it may sit behind this very task.
+    if (it->second.in_flight && it->second.running && usableFor(it->second.pending_source, words)) {
+        uint64_t generation = it->second.generation;
+        speculation_cv_.wait_for(lock, config_.translation_timeout, [&]() {
+            auto current = speculations_.find(utterance_id);
+            return current == speculations_.end() || current->second.generation != generation ||
+                   !current->second.in_flight;
+        });
+        it = speculations_.find(utterance_id);
+        if (it == speculations_.end()) {
+            return false;
+        }
+    }
+    
+    // Whatever is still in flight now discards itself when it finishes
+    SpeculationState speculation = std::move(it->second);
+    speculations_.erase(it);
+    releaseIncrementalStream(speculation);
+    lock.unlock();
+    
+    if (speculation.source.empty()) {
+        return false;
+    }
+    
+    if (speculation.source == words) {
+        result = std::move(speculation.translation);
+        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+        statistics_.speculative_reused++;
+        return true;
+    }
+    
+    if (usableFor(speculation.source, words)) {
+        mt::TranslationResult remainder;
+        try {
+            remainder = mt_engine_->translate(joinWords(
+                std::vector<std::string>(words.begin() + speculation.source.size(), words.end())));
+        } catch (const std::exception& e) {
+            speechrnt::utils::Logger::warn("Translating remainder failed for utterance " +
+                                           std::to_string(utterance_id) + ": " + e.what());
+        }
+        if (remainder.success) {
+            result = std::move(speculation.translation);
+            result.translatedText += " " + remainder.translatedText;
+            result.confidence = std::min(result.confidence, remainder.confidence);
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            statistics_.speculative_extended++;
+            return true;
+        }
+    }
+    
+    std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+    statistics_.speculative_discarded++;
+    return false;
+}
+
+bool TranslationPipeline::cancelSpeculation(uint32_t utterance_id) {
+    std::lock_guard<std::mutex> lock(speculation_mutex_);
+    auto it = speculations_.find(utterance_id);
+    if (it == speculations_.end()) {
+        return false;
+    }
+    
+    // Queued jobs find no state and skip MT; a running one discards its result
+    bool had_result = !it->second.source.empty();
+    releaseIncrementalStream(it->second);
+    speculations_.erase(it);
+    speculation_cv_.notify_all();
+    
+    if (had_result) {
+        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+        statistics_.speculative_discarded++;
+    }
+    return true;
+}
+
+void TranslationPipeline::updateIncrementalTranslation(
+    uint32_t utterance_id,
+    const std::string& session_id,
+    SpeculationState& state,
+    const std::vector<std::string>& stable_prefix
+) {
+    if (state.stream_failed || stable_prefix.empty() || isPrefix(stable_prefix, state.stream_target)) {
+        // Nothing newly stable
+        return;
+    }
+    
+    if (!isPrefix(state.stream_target, stable_prefix)) {
+        // Words already fed were revised; the stream starts over from the new prefix
+        state.stream_reset = state.stream_fed > 0;
+    }
+    state.stream_target = stable_prefix;
+    
+    if (state.stream_busy) {
+        // The running worker picks up the new words
+        return;
+    }
+    if (state.stream_key.empty()) {
+        state.stream_key = session_id + "/" + std::to_string(utterance_id) + "/" + std::to_string(++next_stream_id_);
+    }
+    state.stream_busy = true;
+    
+    task_queue_->enqueue([this, utterance_id, session_id, key = state.stream_key]() {
+        runIncrementalTranslation(utterance_id, session_id, key);
+    }, TaskPriority::LOW);
+}
+
+void TranslationPipeline::runIncrementalTranslation(
+    uint32_t utterance_id,
+    std::string session_id,
+    std::string stream_key
+) {
+    // Feeds words until the stream has caught up with the stable prefix;
+    // returns early, closing the MT session, once the state is gone
+    bool open = false;
+    while (true) {
+        std::string text;
+        bool reset = false;
+        {
+            std::lock_guard<std::mutex> lock(speculation_mutex_);
+            auto it = speculations_.find(utterance_id);
+            if (shutdown_requested_ || it == speculations_.end() || it->second.stream_key != stream_key) {
+                break;
+            }
+            auto& state = it->second;
+            open = state.stream_open;
+            reset = state.stream_reset;
+            if (reset) {
+                state.stream_reset = false;
+                state.stream_fed = 0;
+                state.stream_emitted.clear();
+            }
+            if (state.stream_fed >= state.stream_target.size()) {
+                state.stream_busy = false;
+                return;
+            }
+            text = joinWords(std::vector<std::string>(state.stream_target.begin() + state.stream_fed,
+                                                      state.stream_target.end())) + " ";
+            state.stream_fed = state.stream_target.size();
+            state.stream_open = true;
+        }
+        
+        if (open && reset) {
+            mt_engine_->cancelStreamingTranslation(stream_key);
+            open = false;
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            statistics_.incremental_restarts++;
+        }
+        
+        mt::TranslationResult translation;
+        try {
+            if (!open) {
+                auto languages = getLanguageConfiguration();
+                if (!mt_engine_->startStreamingTranslation(stream_key, languages.first, languages.second)) {
+                    throw std::runtime_error("streaming session unavailable");
+                }
+                open = true;
+            }
+            translation = mt_engine_->addStreamingText(stream_key, text, false);
+        } catch (const std::exception& e) {
+            speechrnt::utils::Logger::warn("Incremental translation stopped for utterance " +
+                                           std::to_string(utterance_id) + ": " + e.what());
+            std::lock_guard<std::mutex> lock(speculation_mutex_);
+            auto it = speculations_.find(utterance_id);
+            if (it != speculations_.end() && it->second.stream_key == stream_key) {
+                it->second.stream_failed = true;
+                it->second.stream_open = false;
+                it->second.stream_busy = false;
+            }
+            break;
+        }
+        
+        if (!translation.success || translation.translatedText.empty()) {
+            continue;
+        }
+        
+        PipelineResult update;
+        {
+            std::lock_guard<std::mutex> lock(speculation_mutex_);
+            auto it = speculations_.find(utterance_id);
+            if (it == speculations_.end() || it->second.stream_key != stream_key) {
+                break;
+            }
+            if (it->second.stream_reset || translation.translatedText == it->second.stream_emitted) {
+                continue;
+            }
+            it->second.stream_emitted = translation.translatedText;
+            update.transcription.text = joinWords(std::vector<std::string>(
+                it->second.stream_target.begin(), it->second.stream_target.begin() + it->second.stream_fed));
+        }
+        {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            statistics_.incremental_updates++;
+        }
+        
+        update.utterance_id = utterance_id;
+        update.session_id = session_id;
+        update.transcription.is_partial = true;
+        update.translation = std::move(translation);
+        update.translation_triggered = true;
+        update.pipeline_stage = "translation";
+        notifyPartialTranslation(update);
+    }
+    
+    if (open) {
+        mt_engine_->cancelStreamingTranslation(stream_key);
+    }
+}
+
+void TranslationPipeline::releaseIncrementalStream(const SpeculationState& state) {
+    // A busy worker notices the state is gone and closes the session itself
+    if (state.stream_open && !state.stream_busy) {
+        mt_engine_->cancelStreamingTranslation(state.stream_key);
+    }
+}
+
+bool TranslationPipeline::usableFor(
+    const std::vector<std::string>& source,
+    const std::vector<std::string>& words
+) const {
+    if (source.empty()) {
+        return false;
+    }
+    if (source == words) {
+        return true;
+    }
+    // Translations of arbitrary prefixes don't concatenate; only extend
+    // across a clause boundary, where the remainder translates on its own
+    return config_.speculative_extend_at_boundaries && source.size() < words.size() &&
+           isPrefix(source, words) && isClauseEnd(source.back());
+}
+
+bool TranslationPipeline::isPrefix(const std::vector<std::string>& prefix, const std::vector<std::string>& words) {
+    return prefix.size() <= words.size() && std::equal(prefix.begin(), prefix.end(), words.begin());
+}
+
+bool TranslationPipeline::isClauseEnd(const std::string& word) {
+    char last = word.empty() ? '\0' : word.back();
+    return last == '.' || last == ',' || last == ';' || last == ':' || last == '?' || last == '!';
+}
+
+std::vector<std::string> TranslationPipeline::splitWords(const std::string& text) {
+    std::vector<std::string> words;
+    std::istringstream stream(text);
+    std::string word;
+    while (stream >> word) {
+        words.push_back(std::move(word));
+    }
+    return words;
+}
+
+std::string TranslationPipeline::joinWords(const std::vector<std::string>& words) {
+    std::string text;
+    for (size_t i = 0; i < words.size(); ++i) {
+        if (i > 0) {
+            text += ' ';
+        }
+        text += words[i];
+    }
+    return text;
+}
+
 void TranslationPipeline::processTranscriptionInternal(
     std::shared_ptr<PipelineOperation> operation,
     const stt::TranscriptionResult& transcription,
@@ -117,6 +554,8 @@ void TranslationPipeline::processTranscriptionInternal(
         return;
     }
     
+    speechrnt::utils::ScopedTraceContext trace_scope(operation->trace);
+    
     // Update operation with transcription result
     operation->result.transcription = transcription;
     operation->result.transcription_candidates = candidates;
@@ -198,6 +637,8 @@ void TranslationPipeline::executeTranslation(std::shared_ptr<PipelineOperation>
     }
     
     operation->result.pipeline_stage = "translation";
+    speechrnt::utils::ScopedTraceContext trace_scope(operation->trace);
+    speechrnt::utils::TraceSpan span("translation");
     
     // Use the best transcription candidate or the main result
     stt::TranscriptionResult transcription_to_translate = operation->result.transcription;
@@ -212,7 +653,10 @@ void TranslationPipeline::executeTranslation(std::shared_ptr<PipelineOperation>
     try {
         auto translation_start = std::chrono::steady_clock::now();
         
-        mt::TranslationResult translation_result = mt_engine_->translate(transcription_to_translate.text);
+        mt::TranslationResult translation_result;
+        if (!translateWithSpeculation(operation->utterance_id, transcription_to_translate.text, translation_result)) {
+            translation_result = mt_engine_->translate(transcription_to_translate.text);
+        }
         
         auto translation_end = std::chrono::steady_clock::now();
         auto translation_latency = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -220,6 +664,10 @@ void TranslationPipeline::executeTranslation(std::shared_ptr<PipelineOperation>
         );
         
         recordTranslationLatency(translation_latency);
+        ::core::AdmissionController::getInstance().recordServiceTime(
+            ::core::AdmissionStage::TRANSLATION,
+            std::chrono::duration<double, std::milli>(translation_end - translation_start).count()
+        );
         
         processTranslationResult(operation, translation_result);
         
@@ -579,6 +1027,17 @@ void TranslationPipeline::notifyTranslationComplete(const PipelineResult& result
     }
 }
 
+void TranslationPipeline::notifyPartialTranslation(const PipelineResult& result) {
+    std::lock_guard<std::mutex> callback_lock(callbacks_mutex_);
+    if (partial_translation_callback_) {
+        try {
+            partial_translation_callback_(result);
+        } catch (const std::exception& e) {
+            speechrnt::utils::Logger::error("Partial translation callback failed: " + std::string(e.what()));
+        }
+    }
+}
+
 void TranslationPipeline::notifyPipelineError(const PipelineResult& result, const std::string& error) {
     std::lock_guard<std::mutex> callback_lock(callbacks_mutex_);
     if (pipeline_error_callback_) {
@@ -611,6 +1070,11 @@ void TranslationPipeline::setTranslationCompleteCallback(TranslationCompleteCall
     translation_complete_callback_ = callback;
 }
 
+void TranslationPipeline::setPartialTranslationCallback(PartialTranslationCallback callback) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    partial_translation_callback_ = callback;
+}
+
 void TranslationPipeline::setPipelineErrorCallback(PipelineErrorCallback callback) {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
     pipeline_error_callback_ = callback;
@@ -641,6 +1105,8 @@ std::vector<uint32_t> TranslationPipeline::getActivePipelineOperations() const {
 }
 
 bool TranslationPipeline::cancelPipelineOperation(uint32_t utterance_id) {
+    bool speculation_cancelled = cancelSpeculation(utterance_id);
+    
     std::lock_guard<std::mutex> lock(operations_mutex_);
     
     auto it = active_operations_.find(utterance_id);
@@ -652,7 +1118,7 @@ bool TranslationPipeline::cancelPipelineOperation(uint32_t utterance_id) {
         return true;
     }
     
-    return false;
+    return speculation_cancelled;
 }
 
 bool TranslationPipeline::isReady() const {
@@ -1,6 +1,8 @@
 #include "core/utterance_manager.hpp"
+#include "core/admission_controller.hpp"
 #include "core/translation_pipeline.hpp"
 #include "utils/logging.hpp"
+#include "utils/trace_recorder.hpp"
 #include <algorithm>
 #include <thread>
 
@@ -9,8 +11,8 @@ namespace core {
 
 UtteranceManager::UtteranceManager(const UtteranceManagerConfig& config)
     : config_(config)
-    , next_utterance_id_(1)
     , running_(false)
+    , cleanup_timer_(speechrnt::utils::TimerService::INVALID_TIMER)
     , total_created_(0)
     , total_completed_(0)
     , total_errors_(0) {
@@ -105,317 +107,204 @@ void UtteranceManager::shutdown() {
     stopCleanupTimer();
     
     // Clear all utterances
-    {
-        std::lock_guard<std::mutex> lock(utterances_mutex_);
-        utterances_.clear();
-    }
+    utterances_.clear();
     
     task_queue_.reset();
 }
 
 uint32_t UtteranceManager::createUtterance(const std::string& session_id) {
-    if (!canAcceptNewUtterance()) {
+    if (utterances_.activeCount() >= config_.max_concurrent_utterances) {
         return 0; // Cannot create new utterance
     }
     
-    uint32_t utterance_id = next_utterance_id_.fetch_add(1);
-    auto utterance = std::make_shared<UtteranceData>(utterance_id, session_id);
+    auto& admission = ::core::AdmissionController::getInstance();
+    if (!admission.canAcceptWork()) {
+        admission.recordShed();
+        speechrnt::utils::Logger::warn("Shedding new utterance for session " + session_id +
+                                       ": pipeline over its latency budget");
+        return 0;
+    }
     
-    {
-        std::lock_guard<std::mutex> lock(utterances_mutex_);
-        utterances_[utterance_id] = utterance;
+    uint32_t utterance_id = utterances_.create(session_id);
+    if (utterance_id == 0) {
+        return 0;
     }
     
     total_created_++;
-    notifyStateChange(*utterance);
+    
+    if (speechrnt::utils::TraceRecorder::isEnabled()) {
+        // Continue a trace the session started at segmentation, or sample
+        speechrnt::utils::TraceContext trace = speechrnt::utils::TraceRecorder::current();
+        if (!trace.sampled()) {
+            trace = speechrnt::utils::TraceRecorder::getInstance().beginUtterance(session_id, utterance_id);
+        }
+        if (trace.sampled()) {
+            utterances_.update(utterance_id, [&](UtteranceState&, UtterancePayload& payload) {
+                payload.trace = trace;
+            });
+        }
+    }
+    
+    UtteranceData snapshot(utterance_id, session_id);
+    if (utterances_.snapshot(utterance_id, snapshot)) {
+        notifyStateChange(snapshot);
+    }
     
     return utterance_id;
 }
 
 bool UtteranceManager::updateUtteranceState(uint32_t utterance_id, UtteranceState new_state) {
-    std::shared_ptr<UtteranceData> utterance_copy;
+    UtteranceState old_state = UtteranceState::LISTENING;
+    UtteranceData utterance_copy(utterance_id, "");
     
-    // Scope for the lock
-    {
-        std::lock_guard<std::mutex> lock(utterances_mutex_);
-        
-        auto it = utterances_.find(utterance_id);
-        if (it == utterances_.end()) {
-            return false;
-        }
-        
-        auto& utterance = it->second;
-        UtteranceState old_state = utterance->state;
-        utterance->state = new_state;
-        utterance->last_updated = std::chrono::steady_clock::now();
-        
-        // Update statistics
-        if (new_state == UtteranceState::COMPLETE && old_state != UtteranceState::COMPLETE) {
-            total_completed_++;
-        } else if (new_state == UtteranceState::ERROR && old_state != UtteranceState::ERROR) {
-            total_errors_++;
-        }
-        
-        // Make a copy for callback (to avoid holding lock during callback)
-        utterance_copy = std::make_shared<UtteranceData>(*utterance);
-    } // Lock is automatically released here
+    // Snapshot is taken under the stripe lock so callbacks run without it
+    bool found = utterances_.update(utterance_id, [&](UtteranceState& state, UtterancePayload&) {
+        old_state = state;
+        state = new_state;
+    }, &utterance_copy);
     
-    // Call callbacks without holding the lock
-    notifyStateChange(*utterance_copy);
+    if (!found) {
+        return false;
+    }
+    
+    // Update statistics
+    if (new_state == UtteranceState::COMPLETE && old_state != UtteranceState::COMPLETE) {
+        total_completed_++;
+    } else if (new_state == UtteranceState::ERROR && old_state != UtteranceState::ERROR) {
+        total_errors_++;
+    }
+    
+    notifyStateChange(utterance_copy);
     
     if (new_state == UtteranceState::COMPLETE) {
-        notifyComplete(*utterance_copy);
+        notifyComplete(utterance_copy);
     }
     
     return true;
 }
 
 UtteranceState UtteranceManager::getUtteranceState(uint32_t utterance_id) const {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    auto it = utterances_.find(utterance_id);
-    if (it == utterances_.end()) {
+    UtteranceState state = UtteranceState::ERROR;
+    if (!utterances_.getState(utterance_id, state)) {
         return UtteranceState::ERROR;
     }
-    
-    return it->second->state;
+    return state;
 }
 
 std::shared_ptr<UtteranceData> UtteranceManager::getUtterance(uint32_t utterance_id) const {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
+    auto utterance = std::make_shared<UtteranceData>(utterance_id, "");
     
-    auto it = utterances_.find(utterance_id);
-    if (it == utterances_.end()) {
+    // Return a copy to ensure thread safety
+    if (!utterances_.snapshot(utterance_id, *utterance)) {
         return nullptr;
     }
-    
-    // Return a copy to ensure thread safety
-    return std::make_shared<UtteranceData>(*it->second);
+    return utterance;
 }
 
 bool UtteranceManager::addAudioData(uint32_t utterance_id, const std::vector<float>& audio_data) {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    auto it = utterances_.find(utterance_id);
-    if (it == utterances_.end()) {
-        return false;
-    }
-    
-    auto& utterance = it->second;
-    utterance->audio_buffer.insert(utterance->audio_buffer.end(), 
-                                  audio_data.begin(), audio_data.end());
-    utterance->last_updated = std::chrono::steady_clock::now();
-    
-    return true;
+    return utterances_.update(utterance_id, [&](UtteranceState&, UtterancePayload& payload) {
+        payload.audio_buffer.insert(payload.audio_buffer.end(), audio_data.begin(), audio_data.end());
+    });
 }
 
 bool UtteranceManager::setTranscription(uint32_t utterance_id, const std::string& transcript, float confidence) {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    auto it = utterances_.find(utterance_id);
-    if (it == utterances_.end()) {
-        return false;
-    }
-    
-    auto& utterance = it->second;
-    utterance->transcript = transcript;
-    utterance->transcription_confidence = confidence;
-    utterance->last_updated = std::chrono::steady_clock::now();
-    
-    return true;
+    return utterances_.update(utterance_id, [&](UtteranceState&, UtterancePayload& payload) {
+        payload.transcript = transcript;
+        payload.transcription_confidence = confidence;
+    });
 }
 
 bool UtteranceManager::setTranslation(uint32_t utterance_id, const std::string& translation) {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    auto it = utterances_.find(utterance_id);
-    if (it == utterances_.end()) {
-        return false;
-    }
-    
-    auto& utterance = it->second;
-    utterance->translation = translation;
-    utterance->last_updated = std::chrono::steady_clock::now();
-    
-    return true;
+    return utterances_.update(utterance_id, [&](UtteranceState&, UtterancePayload& payload) {
+        payload.translation = translation;
+    });
 }
 
 bool UtteranceManager::setSynthesizedAudio(uint32_t utterance_id, const std::vector<uint8_t>& audio_data) {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    auto it = utterances_.find(utterance_id);
-    if (it == utterances_.end()) {
-        return false;
-    }
-    
-    auto& utterance = it->second;
-    utterance->synthesized_audio = audio_data;
-    utterance->last_updated = std::chrono::steady_clock::now();
-    
-    return true;
+    return utterances_.update(utterance_id, [&](UtteranceState&, UtterancePayload& payload) {
+        payload.synthesized_audio = audio_data;
+    });
 }
 
 bool UtteranceManager::setUtteranceError(uint32_t utterance_id, const std::string& error_message) {
-    std::shared_ptr<UtteranceData> utterance_copy;
+    UtteranceData utterance_copy(utterance_id, "");
     
-    // Scope for the lock
-    {
-        std::lock_guard<std::mutex> lock(utterances_mutex_);
-        
-        auto it = utterances_.find(utterance_id);
-        if (it == utterances_.end()) {
-            return false;
-        }
-        
-        auto& utterance = it->second;
-        utterance->error_message = error_message;
-        utterance->state = UtteranceState::ERROR;
-        utterance->last_updated = std::chrono::steady_clock::now();
-        
-        total_errors_++;
-        
-        // Make a copy for callback
-        utterance_copy = std::make_shared<UtteranceData>(*utterance);
-    } // Lock is automatically released here
+    bool found = utterances_.update(utterance_id, [&](UtteranceState& state, UtterancePayload& payload) {
+        payload.error_message = error_message;
+        state = UtteranceState::ERROR;
+    }, &utterance_copy);
+    
+    if (!found) {
+        return false;
+    }
+    
+    total_errors_++;
     
     // Call callbacks without holding the lock
-    notifyStateChange(*utterance_copy);
-    notifyError(*utterance_copy, error_message);
+    notifyStateChange(utterance_copy);
+    notifyError(utterance_copy, error_message);
     
     return true;
 }
 
 bool UtteranceManager::setLanguageConfig(uint32_t utterance_id, const std::string& source_lang, 
                                         const std::string& target_lang, const std::string& voice_id) {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    auto it = utterances_.find(utterance_id);
-    if (it == utterances_.end()) {
-        return false;
-    }
-    
-    auto& utterance = it->second;
-    utterance->source_language = source_lang;
-    utterance->target_language = target_lang;
-    utterance->voice_id = voice_id;
-    utterance->last_updated = std::chrono::steady_clock::now();
-    
-    return true;
+    return utterances_.update(utterance_id, [&](UtteranceState&, UtterancePayload& payload) {
+        payload.source_language = source_lang;
+        payload.target_language = target_lang;
+        payload.voice_id = voice_id;
+    });
 }
 
 std::vector<std::shared_ptr<UtteranceData>> UtteranceManager::getSessionUtterances(const std::string& session_id) const {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
     std::vector<std::shared_ptr<UtteranceData>> result;
     
-    for (const auto& pair : utterances_) {
-        if (pair.second->session_id == session_id) {
-            result.push_back(std::make_shared<UtteranceData>(*pair.second));
-        }
+    // Walks only this session's intrusive list
+    for (auto& utterance : utterances_.sessionSnapshots(session_id)) {
+        result.push_back(std::make_shared<UtteranceData>(std::move(utterance)));
     }
     
     return result;
 }
 
 std::vector<std::shared_ptr<UtteranceData>> UtteranceManager::getActiveUtterances() const {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
     std::vector<std::shared_ptr<UtteranceData>> result;
     
-    for (const auto& pair : utterances_) {
-        if (pair.second->state != UtteranceState::COMPLETE && 
-            pair.second->state != UtteranceState::ERROR) {
-            result.push_back(std::make_shared<UtteranceData>(*pair.second));
-        }
+    // Walks only the active lists, never finished utterances
+    for (auto& utterance : utterances_.activeSnapshots()) {
+        result.push_back(std::make_shared<UtteranceData>(std::move(utterance)));
     }
     
     return result;
 }
 
+std::vector<uint32_t> UtteranceManager::getSessionUtteranceIds(const std::string& session_id) const {
+    return utterances_.sessionIds(session_id);
+}
+
+std::vector<uint32_t> UtteranceManager::getActiveUtteranceIds() const {
+    return utterances_.activeIds();
+}
+
 size_t UtteranceManager::cleanupOldUtterances(std::chrono::seconds max_age) {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    auto now = std::chrono::steady_clock::now();
-    size_t removed_count = 0;
-    
-    auto it = utterances_.begin();
-    while (it != utterances_.end()) {
-        const auto& utterance = it->second;
-        
-        // Only cleanup completed or errored utterances
-        if ((utterance->state == UtteranceState::COMPLETE || 
-             utterance->state == UtteranceState::ERROR) &&
-            (now - utterance->last_updated) > max_age) {
-            
-            it = utterances_.erase(it);
-            removed_count++;
-        } else {
-            ++it;
-        }
-    }
-    
-    return removed_count;
+    // Only completed or errored utterances are eligible
+    return utterances_.removeFinishedOlderThan(max_age);
 }
 
 size_t UtteranceManager::removeSessionUtterances(const std::string& session_id) {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    size_t removed_count = 0;
-    
-    auto it = utterances_.begin();
-    while (it != utterances_.end()) {
-        if (it->second->session_id == session_id) {
-            it = utterances_.erase(it);
-            removed_count++;
-        } else {
-            ++it;
-        }
-    }
-    
-    return removed_count;
+    return utterances_.removeSession(session_id);
 }
 
 UtteranceManager::Statistics UtteranceManager::getStatistics() const {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
     Statistics stats;
     stats.total_utterances = total_created_.load();
     stats.completed_utterances = total_completed_.load();
     stats.error_utterances = total_errors_.load();
     
-    size_t active_count = 0;
-    size_t concurrent_count = 0;
-    std::chrono::milliseconds total_processing_time{0};
-    size_t completed_with_time = 0;
-    
-    auto now = std::chrono::steady_clock::now();
-    
-    for (const auto& pair : utterances_) {
-        const auto& utterance = pair.second;
-        
-        if (utterance->state != UtteranceState::COMPLETE && 
-            utterance->state != UtteranceState::ERROR) {
-            active_count++;
-            
-            if (utterance->state == UtteranceState::TRANSCRIBING ||
-                utterance->state == UtteranceState::TRANSLATING ||
-                utterance->state == UtteranceState::SYNTHESIZING) {
-                concurrent_count++;
-            }
-        }
-        
-        if (utterance->state == UtteranceState::COMPLETE) {
-            auto processing_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-                utterance->last_updated - utterance->created_at);
-            total_processing_time += processing_time;
-            completed_with_time++;
-        }
-    }
-    
-    stats.active_utterances = active_count;
-    stats.concurrent_utterances = concurrent_count;
-    stats.average_processing_time = completed_with_time > 0 ? 
-        total_processing_time / completed_with_time : std::chrono::milliseconds{0};
+    auto counts = utterances_.getCounts();
+    stats.active_utterances = counts.active;
+    stats.concurrent_utterances = counts.processing;
+    stats.average_processing_time = utterances_.averageCompletedProcessingTime();
     
     return stats;
 }
@@ -430,11 +319,21 @@ void UtteranceManager::setCompleteCallback(UtteranceCompleteCallback callback) {
     complete_callback_ = std::move(callback);
 }
 
+UtteranceCompleteCallback UtteranceManager::getCompleteCallback() const {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    return complete_callback_;
+}
+
 void UtteranceManager::setErrorCallback(UtteranceErrorCallback callback) {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
     error_callback_ = std::move(callback);
 }
 
+void UtteranceManager::setSynthesisCallback(UtteranceSynthesisCallback callback) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    synthesis_callback_ = std::move(callback);
+}
+
 bool UtteranceManager::processUtterance(uint32_t utterance_id) {
     if (!task_queue_) {
         return false;
@@ -483,34 +382,24 @@ void UtteranceManager::processTranscriptionResult(
 }
 
 bool UtteranceManager::canAcceptNewUtterance() const {
-    std::lock_guard<std::mutex> lock(utterances_mutex_);
-    
-    size_t active_count = 0;
-    for (const auto& pair : utterances_) {
-        if (pair.second->state != UtteranceState::COMPLETE && 
-            pair.second->state != UtteranceState::ERROR) {
-            active_count++;
-        }
-    }
-    
-    return active_count < config_.max_concurrent_utterances;
+    return utterances_.activeCount() < config_.max_concurrent_utterances &&
+           ::core::AdmissionController::getInstance().canAcceptWork();
 }
 
 void UtteranceManager::startCleanupTimer() {
-    cleanup_thread_ = std::thread([this]() {
-        while (running_) {
-            std::this_thread::sleep_for(config_.cleanup_interval);
+    cleanup_timer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+        "utterance_manager.cleanup",
+        std::chrono::duration_cast<std::chrono::milliseconds>(config_.cleanup_interval),
+        [this]() {
             if (running_) {
                 performCleanup();
             }
-        }
-    });
+        });
 }
 
 void UtteranceManager::stopCleanupTimer() {
-    if (cleanup_thread_.joinable()) {
-        cleanup_thread_.join();
-    }
+    speechrnt::utils::TimerService::getInstance().cancel(cleanup_timer_);
+    cleanup_timer_ = speechrnt::utils::TimerService::INVALID_TIMER;
 }
 
 void UtteranceManager::performCleanup() {
@@ -565,6 +454,9 @@ void UtteranceManager::processSTT(uint32_t utterance_id) {
         return;
     }
     
+    speechrnt::utils::ScopedTraceContext trace_scope(utterance->trace);
+    speechrnt::utils::TraceSpan span("stt");
+    
     // If a real STT engine is available and the utterance has audio, use it
     if (stt_engine_ && !utterance->audio_buffer.empty() && stt_engine_->isInitialized()) {
         auto audio = utterance->audio_buffer; // copy for thread safety
@@ -574,7 +466,13 @@ void UtteranceManager::processSTT(uint32_t utterance_id) {
         
         try {
             // Use the real STT engine
-            stt_engine_->transcribe(audio, [this, utterance_id](const stt::TranscriptionResult& result) {
+            auto stt_start = std::chrono::steady_clock::now();
+            stt_engine_->transcribe(audio, [this, utterance_id, stt_start, trace = utterance->trace](const stt::TranscriptionResult& result) {
+                speechrnt::utils::ScopedTraceContext trace_scope(trace);
+                ::core::AdmissionController::getInstance().recordServiceTime(
+                    ::core::AdmissionStage::TRANSCRIPTION,
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stt_start).count());
+                
                 speechrnt::utils::Logger::info("STT completed for utterance " + std::to_string(utterance_id) + 
                                    ": \"" + result.text + "\" (confidence: " + std::to_string(result.confidence) + ")");
                 
@@ -660,6 +558,9 @@ void UtteranceManager::processMT(uint32_t utterance_id) {
         return;
     }
     
+    speechrnt::utils::ScopedTraceContext trace_scope(utterance->trace);
+    speechrnt::utils::TraceSpan span("mt");
+    
     // If a real MT engine is available, use it
     if (mt_engine_ && !utterance->source_language.empty() && !utterance->target_language.empty()) {
         speechrnt::utils::Logger::info("Processing MT for utterance " + std::to_string(utterance_id) + 
@@ -680,7 +581,11 @@ void UtteranceManager::processMT(uint32_t utterance_id) {
             }
             
             // Perform translation
+            auto mt_start = std::chrono::steady_clock::now();
             auto translation_result = mt_engine_->translate(utterance->transcript);
+            ::core::AdmissionController::getInstance().recordServiceTime(
+                ::core::AdmissionStage::TRANSLATION,
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mt_start).count());
             
             if (translation_result.success) {
                 speechrnt::utils::Logger::info("MT completed for utterance " + std::to_string(utterance_id) + 
@@ -768,6 +673,30 @@ void UtteranceManager::processTTS(uint32_t utterance_id) {
         return;
     }
     
+    speechrnt::utils::ScopedTraceContext trace_scope(utterance->trace);
+    speechrnt::utils::TraceSpan span("tts");
+    
+    // The owning session streams the reply sentence by sentence, so the
+    // client hears the first one while the rest are still synthesizing
+    UtteranceSynthesisCallback synthesis_callback;
+    {
+        std::lock_guard<std::mutex> lock(callbacks_mutex_);
+        synthesis_callback = synthesis_callback_;
+    }
+    if (synthesis_callback) {
+        bool streamed = false;
+        try {
+            streamed = synthesis_callback(*utterance);
+        } catch (const std::exception& e) {
+            speechrnt::utils::Logger::warn("Streamed synthesis failed for utterance " +
+                                           std::to_string(utterance_id) + ": " + e.what());
+        }
+        if (streamed) {
+            updateUtteranceState(utterance_id, UtteranceState::COMPLETE);
+            return;
+        }
+    }
+    
     // If a real TTS engine is available, use it
     if (tts_engine_ && tts_engine_->isReady()) {
         speechrnt::utils::Logger::info("Processing TTS for utterance " + std::to_string(utterance_id) + 
@@ -795,7 +724,11 @@ void UtteranceManager::processTTS(uint32_t utterance_id) {
             }
             
             // Perform synthesis
+            auto tts_start = std::chrono::steady_clock::now();
             auto synthesis_result = tts_engine_->synthesize(utterance->translation, voice_to_use);
+            ::core::AdmissionController::getInstance().recordServiceTime(
+                ::core::AdmissionStage::SYNTHESIS,
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tts_start).count());
             
             if (synthesis_result.success) {
                 speechrnt::utils::Logger::info("TTS completed for utterance " + std::to_string(utterance_id) + 
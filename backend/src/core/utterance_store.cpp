@@ -0,0 +1,412 @@
+#include "core/utterance_store.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace speechrnt {
+namespace core {
+
+UtteranceStore::UtteranceStore(size_t initial_slots_per_stripe)
+    : active_count_(0)
+    , processing_count_(0)
+    , initial_slots_(std::max<size_t>(1, std::min<size_t>(initial_slots_per_stripe, MAX_SLOTS_PER_STRIPE))) {
+}
+
+uint32_t UtteranceStore::create(const std::string& session_id) {
+    size_t stripe_index = stripeForSession(session_id);
+    Stripe& stripe = stripes_[stripe_index];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    if (stripe.free_list.head == NIL) {
+        grow(stripe);
+        if (stripe.free_list.head == NIL) {
+            return 0; // Stripe exhausted
+        }
+    }
+
+    int32_t slot = stripe.free_list.head;
+    unlink(stripe, stripe.free_list, slot);
+
+    uint32_t id = (static_cast<uint32_t>(stripe.generations[slot]) << (SLOT_BITS + STRIPE_BITS)) |
+                  (static_cast<uint32_t>(stripe_index) << SLOT_BITS) |
+                  static_cast<uint32_t>(slot);
+
+    auto now = Clock::now();
+    stripe.ids[slot] = id;
+    stripe.states[slot] = UtteranceState::LISTENING;
+    stripe.created_at[slot] = now;
+    stripe.last_updated[slot] = now;
+    stripe.payloads[slot].session_id = session_id;
+
+    pushBack(stripe, stripe.active_list, slot);
+    pushSession(stripe, stripe.sessions[session_id], slot);
+    active_count_.fetch_add(1, std::memory_order_relaxed);
+
+    return id;
+}
+
+bool UtteranceStore::contains(uint32_t id) const {
+    const Stripe& stripe = stripes_[stripeOf(id)];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    return resolve(stripe, id) != NIL;
+}
+
+bool UtteranceStore::getState(uint32_t id, UtteranceState& state) const {
+    const Stripe& stripe = stripes_[stripeOf(id)];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    int32_t slot = resolve(stripe, id);
+    if (slot == NIL) {
+        return false;
+    }
+    state = stripe.states[slot];
+    return true;
+}
+
+bool UtteranceStore::snapshot(uint32_t id, UtteranceData& out) const {
+    const Stripe& stripe = stripes_[stripeOf(id)];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    int32_t slot = resolve(stripe, id);
+    if (slot == NIL) {
+        return false;
+    }
+    fillSnapshot(stripe, slot, out);
+    return true;
+}
+
+std::vector<UtteranceData> UtteranceStore::sessionSnapshots(const std::string& session_id) const {
+    std::vector<UtteranceData> result;
+    const Stripe& stripe = stripes_[stripeForSession(session_id)];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.sessions.find(session_id);
+    if (it == stripe.sessions.end()) {
+        return result;
+    }
+    for (int32_t slot = it->second.head; slot != NIL; slot = stripe.session_next[slot]) {
+        result.emplace_back(stripe.ids[slot], session_id);
+        fillSnapshot(stripe, slot, result.back());
+    }
+    return result;
+}
+
+std::vector<UtteranceData> UtteranceStore::activeSnapshots() const {
+    std::vector<UtteranceData> result;
+    result.reserve(activeCount());
+
+    for (const auto& stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for (int32_t slot = stripe.active_list.head; slot != NIL; slot = stripe.list_next[slot]) {
+            result.emplace_back(stripe.ids[slot], stripe.payloads[slot].session_id);
+            fillSnapshot(stripe, slot, result.back());
+        }
+    }
+    return result;
+}
+
+std::vector<uint32_t> UtteranceStore::sessionIds(const std::string& session_id) const {
+    std::vector<uint32_t> result;
+    const Stripe& stripe = stripes_[stripeForSession(session_id)];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.sessions.find(session_id);
+    if (it == stripe.sessions.end()) {
+        return result;
+    }
+    for (int32_t slot = it->second.head; slot != NIL; slot = stripe.session_next[slot]) {
+        result.push_back(stripe.ids[slot]);
+    }
+    return result;
+}
+
+std::vector<uint32_t> UtteranceStore::activeIds() const {
+    std::vector<uint32_t> result;
+    result.reserve(activeCount());
+
+    for (const auto& stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for (int32_t slot = stripe.active_list.head; slot != NIL; slot = stripe.list_next[slot]) {
+            result.push_back(stripe.ids[slot]);
+        }
+    }
+    return result;
+}
+
+size_t UtteranceStore::removeFinishedOlderThan(Clock::duration max_age) {
+    size_t removed = 0;
+
+    for (auto& stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        auto now = Clock::now();
+
+        // The finished list is ordered by last update, so stop at the first young entry
+        while (stripe.finished_list.head != NIL &&
+               (now - stripe.last_updated[stripe.finished_list.head]) > max_age) {
+            release(stripe, stripe.finished_list.head, true);
+            removed++;
+        }
+    }
+    return removed;
+}
+
+size_t UtteranceStore::removeSession(const std::string& session_id) {
+    Stripe& stripe = stripes_[stripeForSession(session_id)];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.sessions.find(session_id);
+    if (it == stripe.sessions.end()) {
+        return 0;
+    }
+
+    size_t removed = 0;
+    int32_t slot = it->second.head;
+    while (slot != NIL) {
+        int32_t next = stripe.session_next[slot];
+        release(stripe, slot, false);
+        slot = next;
+        removed++;
+    }
+    stripe.sessions.erase(it);
+    return removed;
+}
+
+void UtteranceStore::clear() {
+    for (auto& stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for (int32_t slot = stripe.active_list.head; slot != NIL; slot = stripe.list_next[slot]) {
+            active_count_.fetch_sub(1, std::memory_order_relaxed);
+            if (isProcessing(stripe.states[slot])) {
+                processing_count_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        stripe.ids.clear();
+        stripe.generations.clear();
+        stripe.states.clear();
+        stripe.created_at.clear();
+        stripe.last_updated.clear();
+        stripe.list_next.clear();
+        stripe.list_prev.clear();
+        stripe.session_next.clear();
+        stripe.session_prev.clear();
+        stripe.payloads.clear();
+        stripe.free_list = ListHead();
+        stripe.active_list = ListHead();
+        stripe.finished_list = ListHead();
+        stripe.finished_count = 0;
+        stripe.sessions.clear();
+    }
+}
+
+UtteranceStore::Counts UtteranceStore::getCounts() const {
+    Counts counts;
+    for (const auto& stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        counts.finished += stripe.finished_count;
+    }
+    counts.active = active_count_.load(std::memory_order_relaxed);
+    counts.processing = processing_count_.load(std::memory_order_relaxed);
+    counts.stored = counts.active + counts.finished;
+    return counts;
+}
+
+std::chrono::milliseconds UtteranceStore::averageCompletedProcessingTime() const {
+    std::chrono::milliseconds total{0};
+    size_t completed = 0;
+
+    for (const auto& stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for (int32_t slot = stripe.finished_list.head; slot != NIL; slot = stripe.list_next[slot]) {
+            if (stripe.states[slot] == UtteranceState::COMPLETE) {
+                total += std::chrono::duration_cast<std::chrono::milliseconds>(
+                    stripe.last_updated[slot] - stripe.created_at[slot]);
+                completed++;
+            }
+        }
+    }
+    return completed > 0 ? total / static_cast<std::chrono::milliseconds::rep>(completed) : std::chrono::milliseconds{0};
+}
+
+// Private helpers
+
+size_t UtteranceStore::stripeForSession(const std::string& session_id) {
+    return std::hash<std::string>{}(session_id) % STRIPE_COUNT;
+}
+
+int32_t UtteranceStore::resolve(const Stripe& stripe, uint32_t id) {
+    if (id == 0) {
+        return NIL;
+    }
+    uint32_t slot = id & (MAX_SLOTS_PER_STRIPE - 1);
+    if (slot >= stripe.ids.size() || stripe.ids[slot] != id) {
+        return NIL;
+    }
+    return static_cast<int32_t>(slot);
+}
+
+UtteranceStore::ListHead& UtteranceStore::listFor(Stripe& stripe, UtteranceState state) {
+    return isTerminal(state) ? stripe.finished_list : stripe.active_list;
+}
+
+void UtteranceStore::grow(Stripe& stripe) {
+    size_t old_size = stripe.ids.size();
+    size_t new_size = old_size == 0 ? initial_slots_ : std::min<size_t>(old_size * 2, MAX_SLOTS_PER_STRIPE);
+    if (new_size <= old_size) {
+        return;
+    }
+
+    stripe.ids.resize(new_size, 0);
+    stripe.generations.resize(new_size, 1);
+    stripe.states.resize(new_size, UtteranceState::LISTENING);
+    stripe.created_at.resize(new_size);
+    stripe.last_updated.resize(new_size);
+    stripe.list_next.resize(new_size, NIL);
+    stripe.list_prev.resize(new_size, NIL);
+    stripe.session_next.resize(new_size, NIL);
+    stripe.session_prev.resize(new_size, NIL);
+    stripe.payloads.resize(new_size);
+
+    for (size_t slot = old_size; slot < new_size; ++slot) {
+        pushBack(stripe, stripe.free_list, static_cast<int32_t>(slot));
+    }
+}
+
+void UtteranceStore::pushBack(Stripe& stripe, ListHead& list, int32_t slot) {
+    stripe.list_prev[slot] = list.tail;
+    stripe.list_next[slot] = NIL;
+    if (list.tail != NIL) {
+        stripe.list_next[list.tail] = slot;
+    } else {
+        list.head = slot;
+    }
+    list.tail = slot;
+}
+
+void UtteranceStore::unlink(Stripe& stripe, ListHead& list, int32_t slot) {
+    int32_t prev = stripe.list_prev[slot];
+    int32_t next = stripe.list_next[slot];
+    if (prev != NIL) {
+        stripe.list_next[prev] = next;
+    } else {
+        list.head = next;
+    }
+    if (next != NIL) {
+        stripe.list_prev[next] = prev;
+    } else {
+        list.tail = prev;
+    }
+    stripe.list_prev[slot] = NIL;
+    stripe.list_next[slot] = NIL;
+}
+
+void UtteranceStore::pushSession(Stripe& stripe, ListHead& list, int32_t slot) {
+    stripe.session_prev[slot] = list.tail;
+    stripe.session_next[slot] = NIL;
+    if (list.tail != NIL) {
+        stripe.session_next[list.tail] = slot;
+    } else {
+        list.head = slot;
+    }
+    list.tail = slot;
+}
+
+void UtteranceStore::unlinkSession(Stripe& stripe, ListHead& list, int32_t slot) {
+    int32_t prev = stripe.session_prev[slot];
+    int32_t next = stripe.session_next[slot];
+    if (prev != NIL) {
+        stripe.session_next[prev] = next;
+    } else {
+        list.head = next;
+    }
+    if (next != NIL) {
+        stripe.session_prev[next] = prev;
+    } else {
+        list.tail = prev;
+    }
+    stripe.session_prev[slot] = NIL;
+    stripe.session_next[slot] = NIL;
+}
+
+void UtteranceStore::touch(Stripe& stripe, int32_t slot, UtteranceState old_state, UtteranceState new_state) {
+    stripe.last_updated[slot] = Clock::now();
+
+    bool was_terminal = isTerminal(old_state);
+    bool now_terminal = isTerminal(new_state);
+    if (was_terminal || now_terminal) {
+        // Re-append so the finished list stays ordered by last update
+        unlink(stripe, listFor(stripe, old_state), slot);
+        pushBack(stripe, listFor(stripe, new_state), slot);
+    }
+
+    if (was_terminal != now_terminal) {
+        if (now_terminal) {
+            active_count_.fetch_sub(1, std::memory_order_relaxed);
+            stripe.finished_count++;
+        } else {
+            active_count_.fetch_add(1, std::memory_order_relaxed);
+            stripe.finished_count--;
+        }
+    }
+    if (isProcessing(old_state) != isProcessing(new_state)) {
+        if (isProcessing(new_state)) {
+            processing_count_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            processing_count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void UtteranceStore::release(Stripe& stripe, int32_t slot, bool unlink_session) {
+    UtteranceState state = stripe.states[slot];
+    unlink(stripe, listFor(stripe, state), slot);
+    if (isTerminal(state)) {
+        stripe.finished_count--;
+    } else {
+        active_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (isProcessing(state)) {
+        processing_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    if (unlink_session) {
+        auto it = stripe.sessions.find(stripe.payloads[slot].session_id);
+        if (it != stripe.sessions.end()) {
+            unlinkSession(stripe, it->second, slot);
+            if (it->second.head == NIL) {
+                stripe.sessions.erase(it);
+            }
+        }
+    } else {
+        stripe.session_prev[slot] = NIL;
+        stripe.session_next[slot] = NIL;
+    }
+
+    // Drop payload memory and invalidate outstanding ids
+    stripe.payloads[slot] = UtterancePayload();
+    stripe.ids[slot] = 0;
+    uint8_t next_generation = static_cast<uint8_t>(stripe.generations[slot] + 1);
+    stripe.generations[slot] = next_generation == 0 ? 1 : next_generation;
+    pushBack(stripe, stripe.free_list, slot);
+}
+
+void UtteranceStore::fillSnapshot(const Stripe& stripe, int32_t slot, UtteranceData& out) const {
+    const UtterancePayload& payload = stripe.payloads[slot];
+    out.id = stripe.ids[slot];
+    out.session_id = payload.session_id;
+    out.state = stripe.states[slot];
+    out.created_at = stripe.created_at[slot];
+    out.last_updated = stripe.last_updated[slot];
+    out.audio_buffer = payload.audio_buffer;
+    out.transcript = payload.transcript;
+    out.transcription_confidence = payload.transcription_confidence;
+    out.translation = payload.translation;
+    out.synthesized_audio = payload.synthesized_audio;
+    out.error_message = payload.error_message;
+    out.source_language = payload.source_language;
+    out.target_language = payload.target_language;
+    out.voice_id = payload.voice_id;
+    out.trace = payload.trace;
+}
+
+} // namespace core
+} // namespace speechrnt
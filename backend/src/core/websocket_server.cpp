@@ -1,28 +1,95 @@
 #include "core/websocket_server.hpp"
+#include "core/admission_controller.hpp"
 #include "core/client_session.hpp"
+#include "core/message_protocol.hpp"
+#include "core/utterance_manager.hpp"
 #include "stt/stt_health_checker.hpp"
 #include "utils/logging.hpp"
+#include "utils/metrics_registry.hpp"
+#include "utils/trace_recorder.hpp"
 #include <App.h>
+#include <algorithm>
 #include <iostream>
 #include <thread>
 #include <chrono>
+#include <mutex>
 #include <random>
 #include <sstream>
 #include <iomanip>
+#include <unordered_map>
 
 namespace core {
 
-WebSocketServer::WebSocketServer(int port) 
-    : port_(port), running_(false), app_(nullptr) {
+namespace {
+
+speechrnt::utils::Gauge& connectedSessions() {
+    static speechrnt::utils::Gauge& gauge = speechrnt::utils::MetricsRegistry::getInstance().gauge(
+        "speechrnt_websocket_sessions", "Connected WebSocket sessions across all event loops");
+    return gauge;
+}
+
+const char* const HEALTH_UNAVAILABLE =
+    "{\"status\":\"unavailable\",\"message\":\"Health checker not initialized\"}";
+
+// Serve a pre-serialised JSON body, answering a matching If-None-Match with
+// 304. Only successful responses are revalidated so a poller never mistakes
+// an unhealthy status for an unchanged one.
+void writeCachedJSON(uWS::HttpResponse<false>* res, uWS::HttpRequest* req, const std::string& status,
+                     const std::string& body, const std::string& etag) {
+    if (status == "200 OK") {
+        std::string_view match = req->getHeader("if-none-match");
+        if (!match.empty() && (match == "*" || match.find(etag) != std::string_view::npos)) {
+            res->writeStatus("304 Not Modified")
+               ->writeHeader("ETag", etag)
+               ->writeHeader("Cache-Control", "no-cache")
+               ->end();
+            return;
+        }
+    }
+    
+    res->writeStatus(status)
+       ->writeHeader("Content-Type", "application/json")
+       ->writeHeader("ETag", etag)
+       ->writeHeader("Cache-Control", "no-cache")
+       ->end(body);
+}
+
+// Split a raw query string into its &-separated parameters; a bare key maps
+// to an empty value
+std::unordered_map<std::string, std::string> parseQuery(std::string_view query) {
+    std::unordered_map<std::string, std::string> params;
+    while (!query.empty()) {
+        size_t end = query.find('&');
+        std::string_view param = query.substr(0, end);
+        size_t eq = param.find('=');
+        if (!param.empty()) {
+            params[std::string(param.substr(0, eq))] =
+                eq == std::string_view::npos ? std::string() : std::string(param.substr(eq + 1));
+        }
+        query = end == std::string_view::npos ? std::string_view() : query.substr(end + 1);
+    }
+    return params;
+}
+
+} // namespace
+
+WebSocketServer::WebSocketServer(int port, size_t loopCount) 
+    : port_(port)
+    , loopCount_(loopCount > 0 ? loopCount : std::max(1u, std::thread::hardware_concurrency()))
+    , running_(false) {
 }
 
 WebSocketServer::~WebSocketServer() {
+    if (auto manager = utteranceManager_.lock()) {
+        manager->setSynthesisCallback(nullptr);
+        manager->setCompleteCallback(previousCompleteCallback_);
+    }
     stop();
 }
 
 std::string WebSocketServer::generateSessionId() {
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    // Called from every loop thread
+    thread_local std::mt19937 gen(std::random_device{}());
     std::uniform_int_distribution<> dis(0, 15);
     
     std::stringstream ss;
@@ -36,11 +103,29 @@ std::string WebSocketServer::generateSessionId() {
 }
 
 void WebSocketServer::start() {
-    speechrnt::utils::Logger::info("Starting WebSocket server on port " + std::to_string(port_));
-    running_ = true;
+    if (running_) {
+        speechrnt::utils::Logger::warn("WebSocket server already started");
+        return;
+    }
     
-    app_ = std::make_unique<uWS::App>();
+    speechrnt::utils::Logger::info("Starting WebSocket server on port " + std::to_string(port_) +
+                                   " with " + std::to_string(loopCount_) + " event loops");
     
+    // Apps are created by run() on their own threads: a uWS loop belongs to
+    // the thread that first touches it
+    loops_.clear();
+    for (size_t i = 0; i < loopCount_; ++i) {
+        auto loop = std::make_unique<EventLoop>();
+        loop->index = i;
+        loops_.push_back(std::move(loop));
+    }
+    running_ = true;
+    
+    healthResponseTimer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+        "websocket.health_response", HEALTH_RESPONSE_INTERVAL, [this]() { refreshHealthResponse(); }, true);
+}
+
+void WebSocketServer::configureApp(EventLoop& loop) {
     // Configure WebSocket behavior
     uWS::App::WebSocketBehavior behavior;
     behavior.upgrade = [this](uWS::HttpResponse* res, uWS::HttpRequest* req, void* context) {
@@ -56,215 +141,644 @@ void WebSocketServer::start() {
         );
     };
     
-    behavior.open = [this](uWS::WebSocket<false>* ws) {
+    behavior.open = [this, &loop](uWS::WebSocket<false>* ws) {
         auto* data = static_cast<PerSocketData*>(ws->getUserData());
         if (data) {
             data->ws = ws;
-            handleNewConnection(data->sessionId, ws);
+            handleNewConnection(loop, data->sessionId, ws);
         }
     };
     
-    behavior.message = [this](uWS::WebSocket<false>* ws, std::string_view message, uWS::OpCode opCode) {
+    behavior.message = [this, &loop](uWS::WebSocket<false>* ws, std::string_view message, uWS::OpCode opCode) {
         auto* data = static_cast<PerSocketData*>(ws->getUserData());
         if (data) {
             if (opCode == uWS::OpCode::TEXT) {
-                handleMessage(data->sessionId, std::string(message));
+                handleMessage(loop, data->sessionId, std::string(message));
             } else if (opCode == uWS::OpCode::BINARY) {
-                handleBinaryMessage(data->sessionId, message);
+                handleBinaryMessage(loop, data->sessionId, message);
+            }
+        }
+    };
+    
+    behavior.drain = [this, &loop](uWS::WebSocket<false>* ws) {
+        auto* data = static_cast<PerSocketData*>(ws->getUserData());
+        if (data) {
+            auto it = loop.connections.find(data->sessionId);
+            if (it != loop.connections.end()) {
+                flushOutbound(it->second);
             }
         }
     };
     
-    behavior.close = [this](uWS::WebSocket<false>* ws, int code, std::string_view message) {
+    behavior.close = [this, &loop](uWS::WebSocket<false>* ws, int code, std::string_view message) {
         auto* data = static_cast<PerSocketData*>(ws->getUserData());
         if (data) {
-            handleDisconnection(data->sessionId);
+            handleDisconnection(loop, data->sessionId);
             delete data;
         }
     };
     
-    app_->ws("/*", std::move(behavior));
+    // uWS drops sends past maxBackpressure; the outbound queues stop writing
+    // well before that
+    {
+        std::lock_guard<std::mutex> lock(outboundConfigMutex_);
+        behavior.maxBackpressure = 2 * outboundConfig_.socketHighWaterBytes;
+    }
+    
+    loop.app->ws("/*", std::move(behavior));
     
     // Add HTTP endpoints for health monitoring
-    app_->get("/health", [this](auto* res, auto* req) {
+    loop.app->get("/health", [this](auto* res, auto* req) {
         handleHealthCheck(res, req);
     });
     
-    app_->get("/health/detailed", [this](auto* res, auto* req) {
+    loop.app->get("/health/detailed", [this](auto* res, auto* req) {
         handleDetailedHealthCheck(res, req);
     });
     
-    app_->get("/health/metrics", [this](auto* res, auto* req) {
+    loop.app->get("/health/metrics", [this](auto* res, auto* req) {
         handleHealthMetrics(res, req);
     });
     
-    app_->get("/health/history", [this](auto* res, auto* req) {
+    loop.app->get("/health/history", [this](auto* res, auto* req) {
         handleHealthHistory(res, req);
     });
     
-    app_->get("/health/alerts", [this](auto* res, auto* req) {
+    loop.app->get("/health/alerts", [this](auto* res, auto* req) {
         handleHealthAlerts(res, req);
     });
+    
+    loop.app->get("/health/admission", [this](auto* res, auto* req) {
+        handleAdmissionStatus(res, req);
+    });
+    
+    loop.app->get("/health/outbound", [this](auto* res, auto* req) {
+        handleOutboundStatus(res, req);
+    });
+    
+    // Prometheus scrapes
+    loop.app->get("/metrics", [this](auto* res, auto* req) {
+        handleMetrics(res, req);
+    });
+    
+    // Per-utterance span timeline in Chrome trace format
+    loop.app->get("/debug/trace", [this](auto* res, auto* req) {
+        handleTrace(res, req);
+    });
 }
 
 void WebSocketServer::run() {
-    if (!app_) {
+    if (!running_ || loops_.empty()) {
         speechrnt::utils::Logger::error("Server not started. Call start() first.");
         return;
     }
     
-    app_->listen(port_, [this](auto* listen_socket) {
+    std::vector<std::thread> threads;
+    threads.reserve(loops_.size() - 1);
+    for (size_t i = 1; i < loops_.size(); ++i) {
+        threads.emplace_back(&WebSocketServer::runLoop, this, std::ref(*loops_[i]));
+    }
+    
+    speechrnt::utils::Logger::info("Server started successfully. Press Ctrl+C to stop.");
+    runLoop(*loops_[0]);
+    
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void WebSocketServer::runLoop(EventLoop& loop) {
+    loop.threadId = std::this_thread::get_id();
+    loop.app = std::make_unique<uWS::App>();
+    configureApp(loop);
+    
+    // uSockets sets SO_REUSEPORT on Linux listen sockets, so every loop can
+    // bind the same port and the kernel balances accepts between them
+    loop.app->listen(port_, [this, &loop](auto* listen_socket) {
         if (listen_socket) {
-            speechrnt::utils::Logger::info("WebSocket server listening on port " + std::to_string(port_));
+            loop.listening = true;
+            speechrnt::utils::Logger::info("Event loop " + std::to_string(loop.index) +
+                                           " listening on port " + std::to_string(port_));
         } else {
-            speechrnt::utils::Logger::error("Failed to listen on port " + std::to_string(port_));
-            running_ = false;
+            speechrnt::utils::Logger::error("Event loop " + std::to_string(loop.index) +
+                                            " failed to listen on port " + std::to_string(port_));
         }
     });
     
-    if (running_) {
-        speechrnt::utils::Logger::info("Server started successfully. Press Ctrl+C to stop.");
-        app_->run();
+    // Publish the loop only once the app exists; sends queued before this
+    // point are flushed by the first drain
+    loop.loop = uWS::Loop::get();
+    if (loop.drainScheduled) {
+        loop.loop.load()->defer([this, &loop]() { drainMailbox(loop); });
+    }
+    
+    if (loop.listening && running_) {
+        loop.app->run();
+    }
+    
+    // The loop has exited: drop its sessions on the thread that owns them
+    loop.loop = nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(routesMutex_);
+        for (const auto& entry : loop.sessions) {
+            sessionLoops_.erase(entry.first);
+            AdmissionController::getInstance().releaseSession(entry.first);
+        }
+    }
+    loop.sessions.clear();
+    loop.connections.clear();
+    loop.app.reset();
+    loop.listening = false;
+}
+
+void WebSocketServer::closeLoop(EventLoop& loop) {
+    // Closing the listen socket and every connection lets run() return
+    if (loop.app) {
+        loop.app->close();
     }
 }
 
 void WebSocketServer::stop() {
-    if (running_) {
-        speechrnt::utils::Logger::info("Stopping WebSocket server");
-        running_ = false;
-        sessions_.clear();
-        websockets_.clear();
-        app_.reset();
+    if (!running_.exchange(false)) {
+        return;
+    }
+    
+    speechrnt::utils::Logger::info("Stopping WebSocket server");
+    speechrnt::utils::TimerService::getInstance().cancel(healthResponseTimer_);
+    healthResponseTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
+    
+    for (auto& loop : loops_) {
+        if (auto* uwsLoop = loop->loop.load()) {
+            EventLoop* target = loop.get();
+            uwsLoop->defer([this, target]() { closeLoop(*target); });
+        }
     }
 }
 
-void WebSocketServer::setHealthChecker(std::shared_ptr<stt::STTHealthChecker> healthChecker) {
+void WebSocketServer::setHealthChecker(std::shared_ptr<::stt::STTHealthChecker> healthChecker) {
     health_checker_ = healthChecker;
     speechrnt::utils::Logger::info("Health checker integrated with WebSocket server");
 }
 
+void WebSocketServer::setTTSEngine(std::shared_ptr<speechrnt::tts::TTSInterface> engine) {
+    ttsEngine_ = std::move(engine);
+}
+
+void WebSocketServer::attachUtteranceManager(const std::shared_ptr<speechrnt::core::UtteranceManager>& manager) {
+    utteranceManager_ = manager;
+    if (manager) {
+        manager->setSynthesisCallback([this](const speechrnt::core::UtteranceData& utterance) {
+            return streamSynthesizedSpeech(utterance);
+        });
+        // Utterances the sessions could not stream were synthesized whole
+        previousCompleteCallback_ = manager->getCompleteCallback();
+        manager->setCompleteCallback([this, previous = previousCompleteCallback_](
+                                         const speechrnt::core::UtteranceData& utterance) {
+            deliverSynthesizedAudio(utterance);
+            if (previous) {
+                previous(utterance);
+            }
+        });
+    }
+}
+
+void WebSocketServer::setOutboundQueueConfig(const OutboundQueueConfig& config) {
+    std::lock_guard<std::mutex> lock(outboundConfigMutex_);
+    outboundConfig_ = config;
+}
+
+size_t WebSocketServer::getSessionCount() const {
+    std::shared_lock<std::shared_mutex> lock(routesMutex_);
+    return sessionLoops_.size();
+}
+
+std::unordered_map<std::string, OutboundStats> WebSocketServer::getOutboundStats() const {
+    std::unordered_map<std::string, OutboundStats> stats;
+    std::shared_lock<std::shared_mutex> lock(routesMutex_);
+    for (const auto& entry : sessionLoops_) {
+        if (entry.second.outbound) {
+            stats[entry.first] = entry.second.outbound->snapshot();
+        }
+    }
+    return stats;
+}
+
+WebSocketServer::EventLoop* WebSocketServer::findLoop(const std::string& sessionId) const {
+    std::shared_lock<std::shared_mutex> lock(routesMutex_);
+    auto it = sessionLoops_.find(sessionId);
+    return it != sessionLoops_.end() ? loops_[it->second.loop].get() : nullptr;
+}
+
+std::shared_ptr<ClientSession> WebSocketServer::findSession(const std::string& sessionId) const {
+    std::shared_lock<std::shared_mutex> lock(routesMutex_);
+    auto it = sessionLoops_.find(sessionId);
+    return it != sessionLoops_.end() ? it->second.session.lock() : nullptr;
+}
+
+bool WebSocketServer::streamSynthesizedSpeech(const speechrnt::core::UtteranceData& utterance) {
+    // Called on a pipeline worker; the session sends through the mailbox
+    auto session = findSession(utterance.session_id);
+    if (!session) {
+        return false;
+    }
+    return session->streamSynthesizedSpeech(utterance.id, utterance.translation);
+}
+
+void WebSocketServer::deliverSynthesizedAudio(const speechrnt::core::UtteranceData& utterance) {
+    if (utterance.synthesized_audio.empty()) {
+        return;
+    }
+    auto session = findSession(utterance.session_id);
+    if (!session) {
+        return;
+    }
+    if (!session->sendSynthesizedAudio(utterance.id, utterance.synthesized_audio)) {
+        speechrnt::utils::Logger::warn("Synthesized audio for utterance " + std::to_string(utterance.id) +
+                                       " was not delivered to session " + utterance.session_id);
+    }
+}
+
 void WebSocketServer::sendMessage(const std::string& sessionId, const std::string& message) {
-    auto wsIt = websockets_.find(sessionId);
-    if (wsIt != websockets_.end()) {
-        wsIt->second->send(message, uWS::OpCode::TEXT);
-        speechrnt::utils::Logger::debug("Sent JSON message to " + sessionId + ": " + message);
-    } else {
+    EventLoop* loop = findLoop(sessionId);
+    if (!loop) {
         speechrnt::utils::Logger::warn("Attempted to send message to unknown session: " + sessionId);
+        return;
+    }
+    
+    if (loop->threadId.load() == std::this_thread::get_id()) {
+        deliver(*loop, sessionId, message, false);
+    } else {
+        enqueue(*loop, OutboundMessage{sessionId, message, false});
     }
 }
 
 void WebSocketServer::sendBinaryMessage(const std::string& sessionId, const std::vector<uint8_t>& data) {
-    auto wsIt = websockets_.find(sessionId);
-    if (wsIt != websockets_.end()) {
-        std::string_view binaryData(reinterpret_cast<const char*>(data.data()), data.size());
-        wsIt->second->send(binaryData, uWS::OpCode::BINARY);
-        speechrnt::utils::Logger::debug("Sent binary message to " + sessionId + ", size: " + std::to_string(data.size()));
-    } else {
+    EventLoop* loop = findLoop(sessionId);
+    if (!loop) {
         speechrnt::utils::Logger::warn("Attempted to send binary data to unknown session: " + sessionId);
+        return;
+    }
+    
+    std::string_view binaryData(reinterpret_cast<const char*>(data.data()), data.size());
+    if (loop->threadId.load() == std::this_thread::get_id()) {
+        deliver(*loop, sessionId, binaryData, true);
+    } else {
+        enqueue(*loop, OutboundMessage{sessionId, std::string(binaryData), true});
+    }
+}
+
+void WebSocketServer::enqueue(EventLoop& loop, OutboundMessage message) {
+    loop.mailbox.push(std::move(message));
+    
+    // One deferred drain per batch: only the push that finds no drain
+    // pending wakes the loop. The flag is set after the push completes so a
+    // drain that has just cleared it is guaranteed to see this message or be
+    // followed by another drain.
+    if (!loop.drainScheduled.exchange(true)) {
+        if (auto* uwsLoop = loop.loop.load()) {
+            uwsLoop->defer([this, &loop]() { drainMailbox(loop); });
+        }
+    }
+}
+
+void WebSocketServer::drainMailbox(EventLoop& loop) {
+    loop.drainScheduled.exchange(false);
+    
+    OutboundMessage message;
+    size_t delivered = 0;
+    while (delivered < MAILBOX_BATCH && loop.mailbox.pop(message)) {
+        deliver(loop, message.sessionId, message.payload, message.binary);
+        ++delivered;
+    }
+    
+    // Yield to socket I/O between batches instead of draining a flood in one go
+    if (delivered == MAILBOX_BATCH && !loop.mailbox.empty() && !loop.drainScheduled.exchange(true)) {
+        if (auto* uwsLoop = loop.loop.load()) {
+            uwsLoop->defer([this, &loop]() { drainMailbox(loop); });
+        }
+    }
+}
+
+void WebSocketServer::deliver(EventLoop& loop, const std::string& sessionId, std::string_view payload, bool binary) {
+    auto it = loop.connections.find(sessionId);
+    if (it == loop.connections.end()) {
+        // Closed while the message was in the mailbox
+        speechrnt::utils::Logger::debug("Dropped message for closed session: " + sessionId);
+        return;
+    }
+    
+    auto& connection = it->second;
+    auto& outbound = connection.outbound;
+    
+    // Fast path: nothing waiting and the client keeps up, so skip the copy
+    if (outbound.empty() && outbound.canWrite(connection.ws->getBufferedAmount())) {
+        connection.ws->send(payload, binary ? uWS::OpCode::BINARY : uWS::OpCode::TEXT);
+        outbound.recordSent(connection.ws->getBufferedAmount());
+        if (binary) {
+            speechrnt::utils::Logger::debug("Sent binary message to " + sessionId + ", size: " + std::to_string(payload.size()));
+        } else {
+            speechrnt::utils::Logger::debug("Sent JSON message to " + sessionId + ": " + std::string(payload));
+        }
+        return;
+    }
+    
+    auto result = outbound.push(OutboundQueue::classify(std::string(payload), binary));
+    if (result == OutboundQueue::PushResult::OVERFLOW) {
+        // Dropping finals or audio would leave the client inconsistent; make it reconnect
+        speechrnt::utils::Logger::warn("Outbound queue full for session " + sessionId +
+                                       " (" + std::to_string(outbound.bytes()) + " bytes queued), closing slow client");
+        connection.ws->end(1008, "Client too slow");
+        return;
+    }
+    
+    flushOutbound(connection);
+}
+
+void WebSocketServer::flushOutbound(Connection& connection) {
+    auto& outbound = connection.outbound;
+    while (const auto* message = outbound.front()) {
+        if (!outbound.canWrite(connection.ws->getBufferedAmount())) {
+            // The drain callback resumes once the socket catches up
+            break;
+        }
+        connection.ws->send(message->payload, message->binary ? uWS::OpCode::BINARY : uWS::OpCode::TEXT);
+        outbound.pop();
+        outbound.recordSent(connection.ws->getBufferedAmount());
     }
+    outbound.recordSocketBuffered(connection.ws->getBufferedAmount());
 }
 
-void WebSocketServer::handleNewConnection(const std::string& sessionId, uWS::WebSocket<false>* ws) {
-    speechrnt::utils::Logger::info("New client connection: " + sessionId);
+void WebSocketServer::handleNewConnection(EventLoop& loop, const std::string& sessionId, uWS::WebSocket<false>* ws) {
+    speechrnt::utils::Logger::info("New client connection: " + sessionId + " on loop " + std::to_string(loop.index));
+    
+    auto& admission = AdmissionController::getInstance();
+    AdmissionResult result;
+    if (health_checker_ && !health_checker_->canAcceptNewRequests()) {
+        result.decision = AdmissionDecision::REJECT;
+        result.reason = "Speech recognition service unavailable";
+        result.retryAfterMs = admission.getConfig().minRetryAfterMs;
+    } else {
+        result = admission.admitSession(sessionId);
+    }
+    
+    // Tell the client up front rather than letting its audio queue up
+    AdmissionStatusMessage statusMsg(AdmissionController::decisionToString(result.decision), result.reason);
+    statusMsg.setPartialResults(result.profile.partialResults);
+    statusMsg.setReducedModel(result.profile.reducedModel);
+    statusMsg.setSpeechSynthesis(result.profile.speechSynthesis);
+    statusMsg.setRetryAfterMs(result.retryAfterMs);
+    
+    if (result.decision == AdmissionDecision::REJECT) {
+        speechrnt::utils::Logger::warn("Rejected connection " + sessionId + ": " + result.reason);
+        ws->send(statusMsg.serialize(), uWS::OpCode::TEXT);
+        ws->end(1013, "Server at capacity");
+        return;
+    }
     
     auto session = std::make_shared<ClientSession>(sessionId);
     session->setWebSocketServer(this);
-    sessions_[sessionId] = session;
-    websockets_[sessionId] = ws;
+    session->setAdmissionProfile(result.profile);
+    if (ttsEngine_) {
+        session->setTTSEngine(ttsEngine_);
+    }
+    loop.sessions[sessionId] = session;
+    
+    OutboundQueueConfig outboundConfig;
+    {
+        std::lock_guard<std::mutex> lock(outboundConfigMutex_);
+        outboundConfig = outboundConfig_;
+    }
+    auto& connection = loop.connections.emplace(sessionId, Connection{ws, OutboundQueue(outboundConfig)}).first->second;
+    
+    size_t totalSessions;
+    {
+        std::unique_lock<std::shared_mutex> lock(routesMutex_);
+        sessionLoops_[sessionId] = Route{loop.index, connection.outbound.counters(), session};
+        totalSessions = sessionLoops_.size();
+    }
+    connectedSessions().set(static_cast<double>(totalSessions));
+    
+    deliver(loop, sessionId, statusMsg.serialize(), false);
     
     speechrnt::utils::Logger::info("Created new session. Total active sessions: " + 
-                       std::to_string(sessions_.size()));
+                       std::to_string(totalSessions));
 }
 
-void WebSocketServer::handleMessage(const std::string& sessionId, const std::string& message) {
+void WebSocketServer::handleMessage(EventLoop& loop, const std::string& sessionId, const std::string& message) {
     speechrnt::utils::Logger::debug("JSON message from " + sessionId + ": " + message);
     
-    auto it = sessions_.find(sessionId);
-    if (it != sessions_.end()) {
+    auto it = loop.sessions.find(sessionId);
+    if (it != loop.sessions.end()) {
         it->second->handleMessage(message);
     } else {
         speechrnt::utils::Logger::warn("Message from unknown session: " + sessionId);
     }
 }
 
-void WebSocketServer::handleBinaryMessage(const std::string& sessionId, std::string_view data) {
+void WebSocketServer::handleBinaryMessage(EventLoop& loop, const std::string& sessionId, std::string_view data) {
     speechrnt::utils::Logger::debug("Binary message from " + sessionId + ", size: " + std::to_string(data.size()));
     
-    auto it = sessions_.find(sessionId);
-    if (it != sessions_.end()) {
+    auto it = loop.sessions.find(sessionId);
+    if (it != loop.sessions.end()) {
         it->second->handleBinaryMessage(data);
     } else {
         speechrnt::utils::Logger::warn("Binary message from unknown session: " + sessionId);
     }
 }
 
-void WebSocketServer::handleDisconnection(const std::string& sessionId) {
+void WebSocketServer::handleDisconnection(EventLoop& loop, const std::string& sessionId) {
     speechrnt::utils::Logger::info("Client disconnected: " + sessionId);
     
-    auto sessionIt = sessions_.find(sessionId);
-    if (sessionIt != sessions_.end()) {
-        sessions_.erase(sessionIt);
+    // Unroute first so workers stop queueing for this session
+    size_t remaining;
+    {
+        std::unique_lock<std::shared_mutex> lock(routesMutex_);
+        sessionLoops_.erase(sessionId);
+        remaining = sessionLoops_.size();
+    }
+    connectedSessions().set(static_cast<double>(remaining));
+    
+    auto sessionIt = loop.sessions.find(sessionId);
+    if (sessionIt != loop.sessions.end()) {
+        loop.sessions.erase(sessionIt);
+        AdmissionController::getInstance().releaseSession(sessionId);
     }
     
-    auto wsIt = websockets_.find(sessionId);
-    if (wsIt != websockets_.end()) {
-        websockets_.erase(wsIt);
+    auto connectionIt = loop.connections.find(sessionId);
+    if (connectionIt != loop.connections.end()) {
+        auto outbound = connectionIt->second.outbound.counters()->snapshot();
+        if (outbound.queuedMessages > 0 || outbound.dropped > 0 || outbound.droppedPartials > 0) {
+            speechrnt::utils::Logger::info("Session " + sessionId + " closed with " +
+                                           std::to_string(outbound.queuedMessages) + " unsent messages, " +
+                                           std::to_string(outbound.droppedPartials) + " partials and " +
+                                           std::to_string(outbound.dropped) + " messages dropped");
+        }
+        loop.connections.erase(connectionIt);
     }
     
     speechrnt::utils::Logger::info("Session removed. Remaining active sessions: " + 
-                       std::to_string(sessions_.size()));
+                       std::to_string(remaining));
+}
+
+void WebSocketServer::handleMetrics(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
+    // Reads pre-aggregated atomics only: no health checks run and no
+    // pipeline lock is taken, so scrapes cannot stall the audio path
+    thread_local std::string body;
+    speechrnt::utils::MetricsRegistry::getInstance().exposeOpenMetrics(body);
+    
+    res->writeStatus("200 OK")
+       ->writeHeader("Content-Type", speechrnt::utils::MetricsRegistry::CONTENT_TYPE)
+       ->writeHeader("Cache-Control", "no-cache")
+       ->end(body);
+}
+
+void WebSocketServer::handleTrace(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
+    auto& recorder = speechrnt::utils::TraceRecorder::getInstance();
+    
+    // ?sample=N traces one utterance in N (0 only triggered ones), ?next=N
+    // traces the next N utterances, ?off stops and ?clear drops the buffers.
+    // Without parameters the buffered trace is returned.
+    std::unordered_map<std::string, std::string> params = parseQuery(req->getQuery());
+    auto numberFor = [&params](const std::string& key, uint32_t& value) {
+        auto it = params.find(key);
+        if (it == params.end()) {
+            return false;
+        }
+        try {
+            value = static_cast<uint32_t>(std::stoul(it->second));
+            return true;
+        } catch (...) {
+            return false;
+        }
+    };
+    
+    bool control = false;
+    uint32_t value = 0;
+    if (numberFor("sample", value)) {
+        recorder.enable(value);
+        control = true;
+    }
+    if (numberFor("next", value)) {
+        recorder.traceNext(value);
+        control = true;
+    }
+    if (params.count("clear")) {
+        recorder.clear();
+        control = true;
+    }
+    if (params.count("off")) {
+        recorder.disable();
+        control = true;
+    }
+    
+    if (control) {
+        std::ostringstream json;
+        json << "{\"enabled\":" << (speechrnt::utils::TraceRecorder::isEnabled() ? "true" : "false")
+             << ",\"sample_every\":" << recorder.getSampleEvery()
+             << ",\"spans_recorded\":" << recorder.getSpansRecorded() << "}";
+        res->writeStatus("200 OK")
+           ->writeHeader("Content-Type", "application/json")
+           ->writeHeader("Cache-Control", "no-cache")
+           ->end(json.str());
+        return;
+    }
+    
+    std::string body;
+    recorder.exportChromeTrace(body);
+    res->writeStatus("200 OK")
+       ->writeHeader("Content-Type", "application/json")
+       ->writeHeader("Content-Disposition", "attachment; filename=\"speechrnt-trace.json\"")
+       ->writeHeader("Cache-Control", "no-cache")
+       ->end(body);
+}
+
+void WebSocketServer::refreshHealthResponse() {
+    // Runs on the timer thread: the admission and outbound totals take
+    // locks the event loops should not wait on
+    auto snapshot = health_checker_ ? health_checker_->getSnapshot() : nullptr;
+    if (!snapshot) {
+        std::atomic_store(&healthResponse_, std::shared_ptr<const CachedResponse>());
+        return;
+    }
+    
+    auto response = std::make_shared<CachedResponse>();
+    std::string statusStr;
+    switch (snapshot->overall_status) {
+        case ::stt::HealthStatus::HEALTHY:
+            statusStr = "healthy";
+            response->status = "200 OK";
+            break;
+        case ::stt::HealthStatus::DEGRADED:
+            statusStr = "degraded";
+            response->status = "200 OK";
+            break;
+        case ::stt::HealthStatus::UNHEALTHY:
+            statusStr = "unhealthy";
+            response->status = "503 Service Unavailable";
+            break;
+        case ::stt::HealthStatus::CRITICAL:
+            statusStr = "critical";
+            response->status = "503 Service Unavailable";
+            break;
+        default:
+            statusStr = "unknown";
+            response->status = "503 Service Unavailable";
+            break;
+    }
+    
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"status\": \"" << statusStr << "\",\n";
+    json << "  \"service\": \"SpeechRNT STT\",\n";
+    json << "  \"message\": \"" << snapshot->overall_message << "\",\n";
+    json << "  \"timestamp\": " << std::chrono::duration_cast<std::chrono::milliseconds>(
+               snapshot->timestamp.time_since_epoch()).count() << ",\n";
+    json << "  \"check_time_ms\": " << snapshot->total_check_time_ms << ",\n";
+    json << "  \"can_accept_requests\": " << (snapshot->can_accept_requests ? "true" : "false") << ",\n";
+    json << "  \"system_load_factor\": " << snapshot->system_load_factor << ",\n";
+    
+    auto admission = AdmissionController::getInstance().getStats();
+    json << "  \"admission\": {\n";
+    json << "    \"accepting_work\": " << (admission.acceptingWork ? "true" : "false") << ",\n";
+    json << "    \"active_sessions\": " << admission.activeSessions << ",\n";
+    json << "    \"degraded_sessions\": " << admission.degradedSessions << ",\n";
+    json << "    \"utilization\": " << admission.utilization << ",\n";
+    json << "    \"last_decision\": \"" << AdmissionController::decisionToString(admission.lastDecision.decision) << "\",\n";
+    json << "    \"rejected\": " << admission.rejected << ",\n";
+    json << "    \"shed\": " << admission.shed << "\n";
+    json << "  },\n";
+    
+    size_t queuedBytes = 0;
+    size_t socketBufferedBytes = 0;
+    uint64_t dropped = 0;
+    for (const auto& entry : getOutboundStats()) {
+        queuedBytes += entry.second.queuedBytes;
+        socketBufferedBytes += entry.second.socketBufferedBytes;
+        dropped += entry.second.dropped + entry.second.droppedPartials;
+    }
+    json << "  \"outbound\": {\n";
+    json << "    \"queued_bytes\": " << queuedBytes << ",\n";
+    json << "    \"socket_buffered_bytes\": " << socketBufferedBytes << ",\n";
+    json << "    \"dropped\": " << dropped << "\n";
+    json << "  }\n";
+    json << "}";
+    
+    response->body = json.str();
+    response->etag = ::stt::HealthSnapshot::makeETag(response->body);
+    std::atomic_store(&healthResponse_, std::shared_ptr<const CachedResponse>(std::move(response)));
 }
 
 void WebSocketServer::handleHealthCheck(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
     try {
-        if (!health_checker_) {
+        auto response = std::atomic_load(&healthResponse_);
+        if (!response) {
             res->writeStatus("503 Service Unavailable")
                ->writeHeader("Content-Type", "application/json")
-               ->end("{\"status\":\"unavailable\",\"message\":\"Health checker not initialized\"}");
+               ->end(HEALTH_UNAVAILABLE);
             return;
         }
         
-        auto healthStatus = health_checker_->checkHealth(false);
-        std::string statusStr;
-        
-        switch (healthStatus.overall_status) {
-            case stt::HealthStatus::HEALTHY:
-                statusStr = "healthy";
-                res->writeStatus("200 OK");
-                break;
-            case stt::HealthStatus::DEGRADED:
-                statusStr = "degraded";
-                res->writeStatus("200 OK");
-                break;
-            case stt::HealthStatus::UNHEALTHY:
-                statusStr = "unhealthy";
-                res->writeStatus("503 Service Unavailable");
-                break;
-            case stt::HealthStatus::CRITICAL:
-                statusStr = "critical";
-                res->writeStatus("503 Service Unavailable");
-                break;
-            default:
-                statusStr = "unknown";
-                res->writeStatus("503 Service Unavailable");
-                break;
-        }
-        
-        std::ostringstream json;
-        json << "{\n";
-        json << "  \"status\": \"" << statusStr << "\",\n";
-        json << "  \"service\": \"SpeechRNT STT\",\n";
-        json << "  \"message\": \"" << healthStatus.overall_message << "\",\n";
-        json << "  \"timestamp\": " << std::chrono::duration_cast<std::chrono::milliseconds>(
-                   healthStatus.timestamp.time_since_epoch()).count() << ",\n";
-        json << "  \"check_time_ms\": " << healthStatus.total_check_time_ms << ",\n";
-        json << "  \"can_accept_requests\": " << (health_checker_->canAcceptNewRequests() ? "true" : "false") << ",\n";
-        json << "  \"system_load_factor\": " << health_checker_->getSystemLoadFactor() << "\n";
-        json << "}";
-        
-        res->writeHeader("Content-Type", "application/json")
-           ->writeHeader("Cache-Control", "no-cache")
-           ->end(json.str());
+        writeCachedJSON(res, req, response->status, response->body, response->etag);
            
     } catch (const std::exception& e) {
         speechrnt::utils::Logger::error("Exception in health check endpoint: " + std::string(e.what()));
@@ -276,26 +790,21 @@ void WebSocketServer::handleHealthCheck(uWS::HttpResponse<false>* res, uWS::Http
 
 void WebSocketServer::handleDetailedHealthCheck(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
     try {
-        if (!health_checker_) {
+        auto snapshot = health_checker_ ? health_checker_->getSnapshot() : nullptr;
+        if (!snapshot) {
             res->writeStatus("503 Service Unavailable")
                ->writeHeader("Content-Type", "application/json")
-               ->end("{\"status\":\"unavailable\",\"message\":\"Health checker not initialized\"}");
+               ->end(HEALTH_UNAVAILABLE);
             return;
         }
         
-        auto healthStatus = health_checker_->checkHealth(true);
-        std::string jsonResponse = health_checker_->exportHealthStatusJSON(false);
-        
         std::string httpStatus = "200 OK";
-        if (healthStatus.overall_status == stt::HealthStatus::UNHEALTHY || 
-            healthStatus.overall_status == stt::HealthStatus::CRITICAL) {
+        if (snapshot->overall_status == ::stt::HealthStatus::UNHEALTHY || 
+            snapshot->overall_status == ::stt::HealthStatus::CRITICAL) {
             httpStatus = "503 Service Unavailable";
         }
         
-        res->writeStatus(httpStatus)
-           ->writeHeader("Content-Type", "application/json")
-           ->writeHeader("Cache-Control", "no-cache")
-           ->end(jsonResponse);
+        writeCachedJSON(res, req, httpStatus, snapshot->detailed.json, snapshot->detailed.etag);
            
     } catch (const std::exception& e) {
         speechrnt::utils::Logger::error("Exception in detailed health check endpoint: " + std::string(e.what()));
@@ -307,55 +816,15 @@ void WebSocketServer::handleDetailedHealthCheck(uWS::HttpResponse<false>* res, u
 
 void WebSocketServer::handleHealthMetrics(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
     try {
-        if (!health_checker_) {
+        auto snapshot = health_checker_ ? health_checker_->getSnapshot() : nullptr;
+        if (!snapshot) {
             res->writeStatus("503 Service Unavailable")
                ->writeHeader("Content-Type", "application/json")
-               ->end("{\"status\":\"unavailable\",\"message\":\"Health checker not initialized\"}");
+               ->end(HEALTH_UNAVAILABLE);
             return;
         }
         
-        auto metrics = health_checker_->getHealthMetrics();
-        auto monitoringStats = health_checker_->getMonitoringStats();
-        
-        std::ostringstream json;
-        json << "{\n";
-        json << "  \"health_metrics\": {\n";
-        
-        size_t metricIndex = 0;
-        for (const auto& [key, value] : metrics) {
-            json << "    \"" << key << "\": " << value;
-            if (++metricIndex < metrics.size()) json << ",";
-            json << "\n";
-        }
-        
-        json << "  },\n";
-        json << "  \"monitoring_stats\": {\n";
-        
-        size_t statIndex = 0;
-        for (const auto& [key, value] : monitoringStats) {
-            json << "    \"" << key << "\": " << value;
-            if (++statIndex < monitoringStats.size()) json << ",";
-            json << "\n";
-        }
-        
-        json << "  },\n";
-        json << "  \"healthy_instances\": [\n";
-        
-        auto healthyInstances = health_checker_->getHealthyInstances();
-        for (size_t i = 0; i < healthyInstances.size(); ++i) {
-            json << "    \"" << healthyInstances[i] << "\"";
-            if (i < healthyInstances.size() - 1) json << ",";
-            json << "\n";
-        }
-        
-        json << "  ],\n";
-        json << "  \"recommended_instance\": \"" << health_checker_->getRecommendedInstance() << "\"\n";
-        json << "}";
-        
-        res->writeStatus("200 OK")
-           ->writeHeader("Content-Type", "application/json")
-           ->writeHeader("Cache-Control", "no-cache")
-           ->end(json.str());
+        writeCachedJSON(res, req, "200 OK", snapshot->metrics.json, snapshot->metrics.etag);
            
     } catch (const std::exception& e) {
         speechrnt::utils::Logger::error("Exception in health metrics endpoint: " + std::string(e.what()));
@@ -367,15 +836,16 @@ void WebSocketServer::handleHealthMetrics(uWS::HttpResponse<false>* res, uWS::Ht
 
 void WebSocketServer::handleHealthHistory(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
     try {
-        if (!health_checker_) {
+        auto snapshot = health_checker_ ? health_checker_->getSnapshot() : nullptr;
+        if (!snapshot) {
             res->writeStatus("503 Service Unavailable")
                ->writeHeader("Content-Type", "application/json")
-               ->end("{\"status\":\"unavailable\",\"message\":\"Health checker not initialized\"}");
+               ->end(HEALTH_UNAVAILABLE);
             return;
         }
         
         // Parse hours parameter from query string
-        int hours = 24; // default
+        int hours = ::stt::HealthSnapshot::DEFAULT_HISTORY_HOURS;
         std::string query = std::string(req->getQuery());
         size_t hoursPos = query.find("hours=");
         if (hoursPos != std::string::npos) {
@@ -383,43 +853,16 @@ void WebSocketServer::handleHealthHistory(uWS::HttpResponse<false>* res, uWS::Ht
                 hours = std::stoi(query.substr(hoursPos + 6));
                 hours = std::max(1, std::min(hours, 168)); // Limit to 1-168 hours (1 week)
             } catch (...) {
-                hours = 24; // fallback to default
+                hours = ::stt::HealthSnapshot::DEFAULT_HISTORY_HOURS; // fallback to default
             }
         }
         
-        auto history = health_checker_->getHealthHistory(hours);
-        
-        std::ostringstream json;
-        json << "{\n";
-        json << "  \"hours_requested\": " << hours << ",\n";
-        json << "  \"entries_count\": " << history.size() << ",\n";
-        json << "  \"history\": [\n";
-        
-        for (size_t i = 0; i < history.size(); ++i) {
-            const auto& entry = history[i];
-            json << "    {\n";
-            json << "      \"timestamp\": " << std::chrono::duration_cast<std::chrono::milliseconds>(
-                       entry.timestamp.time_since_epoch()).count() << ",\n";
-            json << "      \"overall_status\": \"" << 
-                    (entry.overall_status == stt::HealthStatus::HEALTHY ? "healthy" :
-                     entry.overall_status == stt::HealthStatus::DEGRADED ? "degraded" :
-                     entry.overall_status == stt::HealthStatus::UNHEALTHY ? "unhealthy" :
-                     entry.overall_status == stt::HealthStatus::CRITICAL ? "critical" : "unknown") << "\",\n";
-            json << "      \"message\": \"" << entry.overall_message << "\",\n";
-            json << "      \"check_time_ms\": " << entry.total_check_time_ms << ",\n";
-            json << "      \"component_count\": " << entry.component_health.size() << "\n";
-            json << "    }";
-            if (i < history.size() - 1) json << ",";
-            json << "\n";
+        if (hours == ::stt::HealthSnapshot::DEFAULT_HISTORY_HOURS) {
+            writeCachedJSON(res, req, "200 OK", snapshot->history.json, snapshot->history.etag);
+        } else {
+            auto body = snapshot->historyFor(hours);
+            writeCachedJSON(res, req, "200 OK", body.json, body.etag);
         }
-        
-        json << "  ]\n";
-        json << "}";
-        
-        res->writeStatus("200 OK")
-           ->writeHeader("Content-Type", "application/json")
-           ->writeHeader("Cache-Control", "no-cache")
-           ->end(json.str());
            
     } catch (const std::exception& e) {
         speechrnt::utils::Logger::error("Exception in health history endpoint: " + std::string(e.what()));
@@ -431,50 +874,60 @@ void WebSocketServer::handleHealthHistory(uWS::HttpResponse<false>* res, uWS::Ht
 
 void WebSocketServer::handleHealthAlerts(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
     try {
-        if (!health_checker_) {
+        auto snapshot = health_checker_ ? health_checker_->getSnapshot() : nullptr;
+        if (!snapshot) {
             res->writeStatus("503 Service Unavailable")
                ->writeHeader("Content-Type", "application/json")
-               ->end("{\"status\":\"unavailable\",\"message\":\"Health checker not initialized\"}");
+               ->end(HEALTH_UNAVAILABLE);
             return;
         }
         
-        auto alerts = health_checker_->getActiveAlerts();
-        
+        writeCachedJSON(res, req, "200 OK", snapshot->alerts.json, snapshot->alerts.etag);
+           
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("Exception in health alerts endpoint: " + std::string(e.what()));
+        res->writeStatus("500 Internal Server Error")
+           ->writeHeader("Content-Type", "application/json")
+           ->end("{\"status\":\"error\",\"message\":\"Internal server error\"}");
+    }
+}
+
+void WebSocketServer::handleAdmissionStatus(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
+    try {
+        // Served without the health checker: admission runs regardless
+        res->writeStatus("200 OK")
+           ->writeHeader("Content-Type", "application/json")
+           ->writeHeader("Cache-Control", "no-cache")
+           ->end(AdmissionController::getInstance().exportStatusJSON());
+           
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("Exception in admission status endpoint: " + std::string(e.what()));
+        res->writeStatus("500 Internal Server Error")
+           ->writeHeader("Content-Type", "application/json")
+           ->end("{\"status\":\"error\",\"message\":\"Internal server error\"}");
+    }
+}
+
+void WebSocketServer::handleOutboundStatus(uWS::HttpResponse<false>* res, uWS::HttpRequest* req) {
+    try {
         std::ostringstream json;
         json << "{\n";
-        json << "  \"active_alerts_count\": " << alerts.size() << ",\n";
-        json << "  \"alerts\": [\n";
-        
-        for (size_t i = 0; i < alerts.size(); ++i) {
-            const auto& alert = alerts[i];
-            json << "    {\n";
-            json << "      \"alert_id\": \"" << alert.alert_id << "\",\n";
-            json << "      \"component_name\": \"" << alert.component_name << "\",\n";
-            json << "      \"severity\": \"" << 
-                    (alert.severity == stt::HealthStatus::HEALTHY ? "healthy" :
-                     alert.severity == stt::HealthStatus::DEGRADED ? "degraded" :
-                     alert.severity == stt::HealthStatus::UNHEALTHY ? "unhealthy" :
-                     alert.severity == stt::HealthStatus::CRITICAL ? "critical" : "unknown") << "\",\n";
-            json << "      \"message\": \"" << alert.message << "\",\n";
-            json << "      \"timestamp\": " << std::chrono::duration_cast<std::chrono::milliseconds>(
-                       alert.timestamp.time_since_epoch()).count() << ",\n";
-            json << "      \"acknowledged\": " << (alert.acknowledged ? "true" : "false") << ",\n";
-            json << "      \"context\": {\n";
-            
-            size_t contextIndex = 0;
-            for (const auto& [key, value] : alert.context) {
-                json << "        \"" << key << "\": \"" << value << "\"";
-                if (++contextIndex < alert.context.size()) json << ",";
-                json << "\n";
-            }
-            
-            json << "      }\n";
-            json << "    }";
-            if (i < alerts.size() - 1) json << ",";
-            json << "\n";
+        json << "  \"sessions\": {";
+        bool first = true;
+        for (const auto& entry : getOutboundStats()) {
+            const auto& stats = entry.second;
+            json << (first ? "\n" : ",\n");
+            json << "    \"" << entry.first << "\": {";
+            json << "\"queued_bytes\": " << stats.queuedBytes;
+            json << ", \"queued_messages\": " << stats.queuedMessages;
+            json << ", \"socket_buffered_bytes\": " << stats.socketBufferedBytes;
+            json << ", \"sent\": " << stats.sent;
+            json << ", \"coalesced\": " << stats.coalesced;
+            json << ", \"dropped_partials\": " << stats.droppedPartials;
+            json << ", \"dropped\": " << stats.dropped << "}";
+            first = false;
         }
-        
-        json << "  ]\n";
+        json << (first ? "}\n" : "\n  }\n");
         json << "}";
         
         res->writeStatus("200 OK")
@@ -483,11 +936,11 @@ void WebSocketServer::handleHealthAlerts(uWS::HttpResponse<false>* res, uWS::Htt
            ->end(json.str());
            
     } catch (const std::exception& e) {
-        speechrnt::utils::Logger::error("Exception in health alerts endpoint: " + std::string(e.what()));
+        speechrnt::utils::Logger::error("Exception in outbound status endpoint: " + std::string(e.what()));
         res->writeStatus("500 Internal Server Error")
            ->writeHeader("Content-Type", "application/json")
            ->end("{\"status\":\"error\",\"message\":\"Internal server error\"}");
     }
 }
 
-} // namespace core
\ No newline at end of file
+} // namespace core
@@ -7,6 +7,7 @@
 #include "utils/gpu_manager.hpp"
 #include "utils/gpu_config.hpp"
 #include "utils/performance_monitor.hpp"
+#include "utils/trace_recorder.hpp"
 
 int main(int argc, char* argv[]) {
     try {
@@ -54,23 +55,36 @@ int main(int argc, char* argv[]) {
         
         // Parse command line arguments
         int port = config.getPort();
+        size_t loops = 0;
+        std::string traceFile;
         for (int i = 1; i < argc; i++) {
             std::string arg = argv[i];
             if (arg == "--port" && i + 1 < argc) {
                 port = std::stoi(argv[++i]);
+            } else if (arg == "--loops" && i + 1 < argc) {
+                loops = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--trace-sample" && i + 1 < argc) {
+                speechrnt::utils::TraceRecorder::getInstance().enable(
+                    static_cast<uint32_t>(std::stoul(argv[++i])));
+            } else if (arg == "--trace-file" && i + 1 < argc) {
+                traceFile = argv[++i];
             } else if (arg == "--help" || arg == "-h") {
                 std::cout << "Usage: " << argv[0] << " [options]\n"
                           << "Options:\n"
                           << "  --port <port>    Set server port (default: 8080)\n"
+                          << "  --loops <n>      Event loop threads (default: one per core)\n"
+                          << "  --trace-sample <n>  Trace one utterance in n (see /debug/trace)\n"
+                          << "  --trace-file <path> Write the Chrome trace here on shutdown\n"
                           << "  --help, -h       Show this help message\n";
                 return 0;
             }
         }
         
         // Create and start WebSocket server
-        auto server = std::make_unique<core::WebSocketServer>(port);
+        auto server = std::make_unique<core::WebSocketServer>(port, loops);
         
-        std::cout << "Starting SpeechRNT server on port " << port << std::endl;
+        std::cout << "Starting SpeechRNT server on port " << port
+                  << " with " << server->getLoopCount() << " event loops" << std::endl;
         server->start();
         
         // Keep server running
@@ -79,6 +93,10 @@ int main(int argc, char* argv[]) {
         
         // Cleanup
         std::cout << "Shutting down..." << std::endl;
+        if (!traceFile.empty() &&
+            !speechrnt::utils::TraceRecorder::getInstance().dumpChromeTrace(traceFile)) {
+            std::cerr << "Failed to write trace to " << traceFile << std::endl;
+        }
         perfMonitor.cleanup();
         gpuManager.cleanup();
         
@@ -752,9 +752,9 @@ bool GPUAccelerator::startPerformanceMonitoring(int intervalMs) {
     
     performanceMonitoringActive_.store(true);
     
-    performanceMonitoringThread_ = std::thread([this, intervalMs]() {
-        performanceMonitoringLoop();
-    });
+    performanceMonitoringTimer_ = utils::TimerService::getInstance().schedulePeriodic(
+        "gpu_accelerator.performance", std::chrono::milliseconds(intervalMs),
+        [this]() { samplePerformance(); }, true);
     
     LOG_INFO("Started GPU performance monitoring with " + std::to_string(intervalMs) + "ms interval");
     return true;
@@ -767,9 +767,8 @@ void GPUAccelerator::stopPerformanceMonitoring() {
     
     performanceMonitoringActive_.store(false);
     
-    if (performanceMonitoringThread_.joinable()) {
-        performanceMonitoringThread_.join();
-    }
+    utils::TimerService::getInstance().cancel(performanceMonitoringTimer_);
+    performanceMonitoringTimer_ = utils::TimerService::INVALID_TIMER;
     
     LOG_INFO("Stopped GPU performance monitoring");
 }
@@ -1146,24 +1145,17 @@ bool GPUAccelerator::performGPUTranslation(void* gpuModel, const std::string& in
     return true;
 }
 
-void GPUAccelerator::performanceMonitoringLoop() {
-    const auto interval = std::chrono::milliseconds(1000); // 1 second interval
+void GPUAccelerator::samplePerformance() {
+    updatePerformanceStatistics();
+    GPUStats stats = getGPUStatistics();
     
-    while (performanceMonitoringActive_.load()) {
-        updatePerformanceStatistics();
-        
-        // Store historical data
-        {
-            std::lock_guard<std::mutex> lock(performanceHistoryMutex_);
-            performanceHistory_.push_back(currentStats_);
-            
-            // Keep only last hour of data (3600 samples at 1 second interval)
-            if (performanceHistory_.size() > 3600) {
-                performanceHistory_.erase(performanceHistory_.begin());
-            }
-        }
-        
-        std::this_thread::sleep_for(interval);
+    // Store historical data
+    std::lock_guard<std::mutex> lock(performanceHistoryMutex_);
+    performanceHistory_.push_back(stats);
+    
+    // Keep only last hour of data (3600 samples at 1 second interval)
+    if (performanceHistory_.size() > 3600) {
+        performanceHistory_.erase(performanceHistory_.begin());
     }
 }
 
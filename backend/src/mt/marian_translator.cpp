@@ -2,6 +2,7 @@
 #include "mt/marian_error_handler.hpp"
 #include "mt/quality_manager.hpp"
 #include "mt/mt_config.hpp"
+#include "mt/translation_memory.hpp"
 #include "models/model_manager.hpp"
 #include "utils/logging.hpp"
 #include "utils/config.hpp"
@@ -9,8 +10,10 @@
 #include "utils/gpu_memory_pool.hpp"
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <iterator>
 #include <future>
 #include <chrono>
 #include <unordered_map>
@@ -45,6 +48,10 @@ MarianTranslator::MarianTranslator(std::shared_ptr<const MTConfig> config)
     , errorHandler_(std::make_unique<MarianErrorHandler>())
     , maxBatchSize_(config ? config->getBatchConfig().maxBatchSize : 32)
     , sessionTimeout_(config ? config->getStreamingConfig().sessionTimeout : std::chrono::minutes(30))
+    , incrementalStreaming_(config ? config->getStreamingConfig().incrementalDecoding : true)
+    , waitK_(config ? config->getStreamingConfig().waitK : 3)
+    , redecodeStrideWords_(config ? config->getStreamingConfig().redecodeStrideWords : 2)
+    , maxWindowWords_(config ? config->getStreamingConfig().maxWindowWords : 32)
     , cachingEnabled_(config ? config->getCachingConfig().enabled : true)
     , maxCacheSize_(config ? config->getCachingConfig().maxCacheSize : 1000)
     , maxConcurrentModels_(5) {
@@ -72,6 +79,11 @@ MarianTranslator::MarianTranslator(std::shared_ptr<const MTConfig> config)
     } else {
         speechrnt::utils::Logger::info("GPU resources not available, using CPU-only mode");
     }
+    
+    // Open the persistent translation memory if requested
+    if (config && config->getCachingConfig().enabled && config->getCachingConfig().persistToDisk) {
+        enablePersistentTranslationMemory(config->getCachingConfig().cacheDirectory);
+    }
 }
 
 MarianTranslator::~MarianTranslator() {
@@ -267,12 +279,20 @@ TranslationResult MarianTranslator::translate(const std::string& text) {
         return cachedResult;
     }
     
+    // Consult the persistent translation memory before running inference
+    TranslationResult persistedResult;
+    if (getPersistentTranslation(text, currentSourceLang_, currentTargetLang_, persistedResult)) {
+        cacheTranslation(cacheKey, persistedResult);
+        return persistedResult;
+    }
+    
     // Perform translation
     TranslationResult result = performTranslation(text, currentSourceLang_, currentTargetLang_);
     
     // Cache successful results
     if (result.success) {
         cacheTranslation(cacheKey, result);
+        persistTranslation(text, result);
     }
     
     return result;
@@ -400,6 +420,13 @@ bool MarianTranslator::updateConfiguration(std::shared_ptr<const MTConfig> confi
         // Update streaming configuration
         const auto& streamingConfig = config_->getStreamingConfig();
         sessionTimeout_ = streamingConfig.sessionTimeout;
+        {
+            std::lock_guard<std::mutex> streamingLock(streamingMutex_);
+            incrementalStreaming_ = streamingConfig.incrementalDecoding;
+            waitK_ = streamingConfig.waitK;
+            redecodeStrideWords_ = streamingConfig.redecodeStrideWords;
+            maxWindowWords_ = streamingConfig.maxWindowWords;
+        }
         
         // Update caching configuration
         const auto& cachingConfig = config_->getCachingConfig();
@@ -421,6 +448,14 @@ bool MarianTranslator::updateConfiguration(std::shared_ptr<const MTConfig> confi
             }
         }
         
+        // Open or close the persistent translation memory to match the new settings
+        bool persistRequested = cachingEnabled_ && cachingConfig.persistToDisk;
+        if (persistRequested && !isPersistentTranslationMemoryEnabled()) {
+            enablePersistentTranslationMemory(cachingConfig.cacheDirectory);
+        } else if (!persistRequested && isPersistentTranslationMemoryEnabled()) {
+            disablePersistentTranslationMemory();
+        }
+        
         // Update quality manager configuration
         if (qualityManager_) {
             const auto& qualityConfig = config_->getQualityConfig();
@@ -521,6 +556,19 @@ bool MarianTranslator::loadModel(const std::string& sourceLang, const std::strin
     bool success = modelManager_->loadModel(sourceLang, targetLang, modelPath);
     
     if (success) {
+        // Versioned once per load so translation memory lookups stay off the filesystem
+        std::string pairKey = getLanguagePairKey(sourceLang, targetLang);
+        bool versioned;
+        {
+            std::lock_guard<std::mutex> memoryLock(translationMemoryMutex_);
+            versioned = modelVersions_.count(pairKey) > 0;
+        }
+        if (!versioned) {
+            std::string modelVersion = computeModelVersion(sourceLang, targetLang);
+            std::lock_guard<std::mutex> memoryLock(translationMemoryMutex_);
+            modelVersions_[pairKey] = modelVersion;
+        }
+        
         std::string deviceInfo = gpuAccelerationEnabled_ && gpuInitialized_ ? 
                                 " (GPU device " + std::to_string(defaultGpuDeviceId_) + ")" : " (CPU)";
         speechrnt::utils::Logger::info("Loaded model for language pair: " + sourceLang + " -> " + targetLang + deviceInfo);
@@ -540,6 +588,12 @@ void MarianTranslator::unloadModel(const std::string& sourceLang, const std::str
     
     bool success = modelManager_->unloadModel(sourceLang, targetLang);
     
+    {
+        // Weights may be replaced before the next load
+        std::lock_guard<std::mutex> memoryLock(translationMemoryMutex_);
+        modelVersions_.erase(getLanguagePairKey(sourceLang, targetLang));
+    }
+    
     if (success) {
         speechrnt::utils::Logger::info("Unloaded model for language pair: " + sourceLang + " -> " + targetLang);
     }
@@ -693,7 +747,8 @@ TranslationResult MarianTranslator::performTranslation(const std::string& text,
 
 TranslationResult MarianTranslator::performMarianTranslation(const std::string& text, 
                                                            const std::string& sourceLang, 
-                                                           const std::string& targetLang) {
+                                                           const std::string& targetLang,
+                                                           const std::string& targetPrefix) {
     TranslationResult result;
     result.sourceLang = sourceLang;
     result.targetLang = targetLang;
@@ -713,6 +768,14 @@ TranslationResult MarianTranslator::performMarianTranslation(const std::string&
         options->set("normalize", 1.0f);
         options->set("word-penalty", 0.0f);
         
+        // Prefix-constrained decoding: the second TSV field is forced as the
+        // start of the output, so only the continuation is searched
+        if (!targetPrefix.empty()) {
+            options->set("tsv", true);
+            options->set("tsv-fields", 2);
+            options->set("force-decode", true);
+        }
+        
         // Set GPU options if enabled and initialized
         if (gpuAccelerationEnabled_ && gpuInitialized_) {
             std::string modelKey = getLanguagePairKey(sourceLang, targetLang);
@@ -735,7 +798,7 @@ TranslationResult MarianTranslator::performMarianTranslation(const std::string&
         auto translator = marian::New<marian::Translate<marian::Search>>(options);
         
         // Prepare input
-        std::vector<std::string> inputs = {text};
+        std::vector<std::string> inputs = {targetPrefix.empty() ? text : text + "\t" + targetPrefix};
         std::vector<std::string> outputs;
         std::vector<float> scores;
         
@@ -773,6 +836,7 @@ TranslationResult MarianTranslator::performMarianTranslation(const std::string&
     }
 #else
     // If Marian is not available, use fallback
+    (void)targetPrefix;
     result = performFallbackTranslation(text, sourceLang, targetLang);
     result.errorMessage = "Marian NMT not available, using fallback translation";
 #endif
@@ -1545,6 +1609,15 @@ TranslationResult MarianTranslator::addStreamingText(const std::string& sessionI
     session.textChunks.push_back(text);
     session.accumulatedText += text;
     
+    if (incrementalStreaming_) {
+        session.pendingSource += text;
+        TranslationResult result = advanceIncrementalTranslation(session, isComplete);
+        result.sessionId = sessionId;
+        result.isPartialResult = !isComplete;
+        result.isStreamingComplete = isComplete;
+        return result;
+    }
+    
     // Preserve context from previous translations
     std::string contextualText = preserveContext(session.contextBuffer, text);
     
@@ -1586,8 +1659,14 @@ TranslationResult MarianTranslator::finalizeStreamingTranslation(const std::stri
     
     StreamingSession& session = it->second;
     
-    // Perform final translation on accumulated text
-    TranslationResult finalResult = translate(session.accumulatedText);
+    TranslationResult finalResult;
+    if (incrementalStreaming_) {
+        // Only the open window is left to decode, after the words already emitted
+        finalResult = advanceIncrementalTranslation(session, true);
+    } else {
+        // Perform final translation on accumulated text
+        finalResult = translate(session.accumulatedText);
+    }
     finalResult.sessionId = sessionId;
     finalResult.isPartialResult = false;
     finalResult.isStreamingComplete = true;
@@ -1628,6 +1707,169 @@ void MarianTranslator::cleanupExpiredSessions() {
     }
 }
 
+TranslationResult MarianTranslator::advanceIncrementalTranslation(StreamingSession& session, bool flush) {
+    TranslationResult result;
+    result.sourceLang = session.sourceLang;
+    result.targetLang = session.targetLang;
+    result.success = true;
+    
+    // Words are complete once whitespace follows them, or when the caller flushes
+    std::vector<std::string> words;
+    size_t end = flush ? session.pendingSource.size() : session.pendingSource.find_last_of(" \t\n\r");
+    if (end != std::string::npos) {
+        std::istringstream stream(session.pendingSource.substr(0, end));
+        std::string word;
+        while (stream >> word) {
+            words.push_back(std::move(word));
+        }
+        session.pendingSource.erase(0, end);
+    }
+    
+    for (size_t i = 0; i < words.size(); ++i) {
+        char last = words[i].back();
+        bool sentenceEnd = last == '.' || last == '?' || last == '!';
+        session.windowSource.push_back(std::move(words[i]));
+        
+        if (sentenceEnd || session.windowSource.size() >= maxWindowWords_) {
+            TranslationResult window = decodeStreamingWindow(session, true);
+            if (!window.success) {
+                // Keep the rest of the input for the next attempt
+                std::move(words.begin() + i + 1, words.end(), std::back_inserter(session.windowSource));
+                return window;
+            }
+        }
+    }
+    
+    if (!session.windowSource.empty()) {
+        char last = session.windowSource.back().back();
+        bool clauseEnd = last == ',' || last == ';' || last == ':';
+        size_t newWords = session.windowSource.size() - session.decodedSourceWords;
+        
+        // Until the window is k words deep nothing could be committed
+        bool due = newWords >= std::max<size_t>(redecodeStrideWords_, 1) || (clauseEnd && newWords > 0);
+        if (flush || (due && session.windowSource.size() > waitK_)) {
+            TranslationResult window = decodeStreamingWindow(session, flush);
+            if (!window.success) {
+                return window;
+            }
+        }
+    }
+    
+    result.translatedText = streamedTranslation(session);
+    result.confidence = session.decodes > 0 ? session.confidence : 0.0f;
+    return result;
+}
+
+TranslationResult MarianTranslator::decodeStreamingWindow(StreamingSession& session, bool closeWindow) {
+    std::string source;
+    for (const auto& word : session.windowSource) {
+        if (!source.empty()) source += " ";
+        source += word;
+    }
+    std::string prefix;
+    for (const auto& word : session.committedTarget) {
+        if (!prefix.empty()) prefix += " ";
+        prefix += word;
+    }
+    
+    TranslationResult hypothesis = translateWithTargetPrefix(source, prefix, session.sourceLang, session.targetLang);
+    session.decodes++;
+    if (!hypothesis.success) {
+        return hypothesis;
+    }
+    session.confidence = std::min(session.confidence, hypothesis.confidence);
+    
+    std::vector<std::string> target;
+    std::istringstream stream(hypothesis.translatedText);
+    std::string word;
+    while (stream >> word) {
+        target.push_back(std::move(word));
+    }
+    
+    // Wait-k: emit target words up to k behind the source, one per source word
+    size_t commit = target.size();
+    if (!closeWindow) {
+        size_t sourceWords = session.windowSource.size();
+        commit = std::min(commit, sourceWords > waitK_ ? sourceWords - waitK_ : size_t(0));
+    }
+    for (size_t i = session.committedTarget.size(); i < commit; ++i) {
+        session.committedTarget.push_back(target[i]);
+    }
+    session.decodedSourceWords = session.windowSource.size();
+    
+    if (closeWindow) {
+        session.closedTarget = streamedTranslation(session);
+        session.windowSource.clear();
+        session.committedTarget.clear();
+        session.decodedSourceWords = 0;
+    }
+    return hypothesis;
+}
+
+TranslationResult MarianTranslator::translateWithTargetPrefix(const std::string& text,
+                                                              const std::string& targetPrefix,
+                                                              const std::string& sourceLang,
+                                                              const std::string& targetLang) {
+    std::lock_guard<std::mutex> lock(translationMutex_);
+    
+    TranslationResult result;
+    try {
+#ifdef MARIAN_AVAILABLE
+        if (errorHandler_ && errorHandler_->isInDegradedMode()) {
+            result = performFallbackTranslation(text, sourceLang, targetLang);
+        } else {
+            result = performMarianTranslation(text, sourceLang, targetLang, targetPrefix);
+        }
+#else
+        result = performFallbackTranslation(text, sourceLang, targetLang);
+#endif
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.errorMessage = "Incremental translation failed: " + std::string(e.what());
+        speechrnt::utils::Logger::error("Incremental translation error: " + std::string(e.what()));
+        return result;
+    }
+    
+    if (!result.success || targetPrefix.empty()) {
+        return result;
+    }
+    
+    // Forced decoding already starts with the prefix; the fallback doesn't, so
+    // keep the prefix and take the hypothesis words past it
+    std::istringstream prefixStream(targetPrefix);
+    std::istringstream hypothesisStream(result.translatedText);
+    std::string prefixWord;
+    std::string word;
+    size_t prefixWords = 0;
+    bool matches = true;
+    while (prefixStream >> prefixWord) {
+        ++prefixWords;
+        if (!(hypothesisStream >> word) || word != prefixWord) {
+            matches = false;
+        }
+    }
+    if (!matches) {
+        std::istringstream tailStream(result.translatedText);
+        std::string spliced = targetPrefix;
+        for (size_t i = 0; tailStream >> word; ++i) {
+            if (i >= prefixWords) {
+                spliced += " " + word;
+            }
+        }
+        result.translatedText = std::move(spliced);
+    }
+    return result;
+}
+
+std::string MarianTranslator::streamedTranslation(const StreamingSession& session) {
+    std::string text = session.closedTarget;
+    for (const auto& word : session.committedTarget) {
+        if (!text.empty()) text += " ";
+        text += word;
+    }
+    return text;
+}
+
 // Configuration methods
 
 void MarianTranslator::setMaxBatchSize(size_t maxBatchSize) {
@@ -1664,8 +1906,143 @@ float MarianTranslator::getCacheHitRate() const {
     return cacheStats_.getHitRate();
 }
 
+bool MarianTranslator::enablePersistentTranslationMemory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    
+    auto memory = std::make_unique<TranslationMemory>();
+    if (!memory->open(directory)) {
+        speechrnt::utils::Logger::warn("Persistent translation memory unavailable at " + directory);
+        return false;
+    }
+    
+    translationMemory_ = std::move(memory);
+    return true;
+}
+
+void MarianTranslator::disablePersistentTranslationMemory() {
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    if (translationMemory_) {
+        translationMemory_->close();
+        translationMemory_.reset();
+        speechrnt::utils::Logger::info("Persistent translation memory disabled");
+    }
+}
+
+bool MarianTranslator::isPersistentTranslationMemoryEnabled() const {
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    return translationMemory_ && translationMemory_->isOpen();
+}
+
+bool MarianTranslator::compactTranslationMemory() {
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    return translationMemory_ && translationMemory_->compact();
+}
+
+long MarianTranslator::exportTranslationMemory(const std::string& path) {
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    return translationMemory_ ? translationMemory_->exportTo(path) : -1;
+}
+
+long MarianTranslator::importTranslationMemory(const std::string& path) {
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    return translationMemory_ ? translationMemory_->importFrom(path) : -1;
+}
+
 // Private helper methods
 
+std::string MarianTranslator::getModelVersion(const std::string& sourceLang, const std::string& targetLang) const {
+    // Caller holds translationMemoryMutex_; pairs not loaded have no version
+    auto it = modelVersions_.find(getLanguagePairKey(sourceLang, targetLang));
+    return it != modelVersions_.end() ? it->second : "";
+}
+
+std::string MarianTranslator::computeModelVersion(const std::string& sourceLang, const std::string& targetLang) const {
+#ifndef MARIAN_AVAILABLE
+    // Dictionary fallback output must never be persisted or shared
+    (void)sourceLang;
+    (void)targetLang;
+    return "";
+#else
+    // Identify the model by the content of its weights, so every replica
+    // and redeploy of the same model shares entries and a retrained model
+    // never reuses stale ones
+    std::ifstream weights(getModelPath(sourceLang, targetLang) + "/model.npz", std::ios::binary);
+    if (!weights) {
+        return "";
+    }
+    
+    // FNV-1a, streamed so large models are not read into memory at once
+    uint64_t hash = 14695981039346656037ull;
+    std::vector<char> buffer(1 << 20);
+    while (weights) {
+        weights.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        std::streamsize count = weights.gcount();
+        for (std::streamsize i = 0; i < count; ++i) {
+            hash = (hash ^ static_cast<unsigned char>(buffer[i])) * 1099511628211ull;
+        }
+    }
+    if (weights.bad()) {
+        return "";
+    }
+    
+    std::ostringstream version;
+    version << sourceLang << "-" << targetLang << ":" << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return version.str();
+#endif
+}
+
+bool MarianTranslator::getPersistentTranslation(const std::string& text, const std::string& sourceLang,
+                                                const std::string& targetLang, TranslationResult& result) {
+    if (!cachingEnabled_) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    if (!translationMemory_) {
+        return false;
+    }
+    
+    std::string modelVersion = getModelVersion(sourceLang, targetLang);
+    if (modelVersion.empty()) {
+        return false;
+    }
+    
+    TranslationMemory::Entry entry;
+    if (!translationMemory_->lookup(text, sourceLang, targetLang, modelVersion, entry)) {
+        return false;
+    }
+    
+    result.translatedText = entry.translatedText;
+    result.confidence = entry.confidence;
+    result.sourceLang = sourceLang;
+    result.targetLang = targetLang;
+    result.modelVersion = modelVersion;
+    result.success = true;
+    return true;
+}
+
+void MarianTranslator::persistTranslation(const std::string& text, const TranslationResult& result) {
+    // Degraded or fallback output is never shared with other replicas
+    if (!cachingEnabled_ || !result.success || !result.errorMessage.empty()) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(translationMemoryMutex_);
+    if (!translationMemory_) {
+        return;
+    }
+    
+    std::string modelVersion = getModelVersion(result.sourceLang, result.targetLang);
+    if (modelVersion.empty()) {
+        return;
+    }
+    
+    TranslationMemory::Entry entry;
+    entry.translatedText = result.translatedText;
+    entry.confidence = result.confidence;
+    translationMemory_->store(text, result.sourceLang, result.targetLang, modelVersion, entry);
+}
+
 std::string MarianTranslator::generateCacheKey(const std::string& text, const std::string& sourceLang, const std::string& targetLang) const {
     return sourceLang + "|" + targetLang + "|" + text;
 }
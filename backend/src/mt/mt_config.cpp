@@ -257,6 +257,22 @@ bool MTConfig::loadFromJson(const std::string &jsonContent) {
         streamingConfig_.enableContextPreservation =
             streamingObj.at("enableContextPreservation").asBool();
       }
+      if (streamingObj.find("incrementalDecoding") != streamingObj.end()) {
+        streamingConfig_.incrementalDecoding =
+            streamingObj.at("incrementalDecoding").asBool();
+      }
+      if (streamingObj.find("waitK") != streamingObj.end()) {
+        streamingConfig_.waitK =
+            static_cast<size_t>(streamingObj.at("waitK").asNumber());
+      }
+      if (streamingObj.find("redecodeStrideWords") != streamingObj.end()) {
+        streamingConfig_.redecodeStrideWords = static_cast<size_t>(
+            streamingObj.at("redecodeStrideWords").asNumber());
+      }
+      if (streamingObj.find("maxWindowWords") != streamingObj.end()) {
+        streamingConfig_.maxWindowWords =
+            static_cast<size_t>(streamingObj.at("maxWindowWords").asNumber());
+      }
     }
 
     // Load error handling configuration
@@ -545,6 +561,13 @@ std::string MTConfig::toJson() const {
        << ",\n";
   json << "    \"enableContextPreservation\": "
        << (streamingConfig_.enableContextPreservation ? "true" : "false")
+       << ",\n";
+  json << "    \"incrementalDecoding\": "
+       << (streamingConfig_.incrementalDecoding ? "true" : "false") << ",\n";
+  json << "    \"waitK\": " << streamingConfig_.waitK << ",\n";
+  json << "    \"redecodeStrideWords\": "
+       << streamingConfig_.redecodeStrideWords << ",\n";
+  json << "    \"maxWindowWords\": " << streamingConfig_.maxWindowWords
        << "\n";
   json << "  },\n";
 
@@ -850,6 +873,9 @@ std::vector<std::string> MTConfig::getValidationErrors() const {
   if (streamingConfig_.maxConcurrentSessions == 0) {
     errors.push_back("Streaming maxConcurrentSessions must be greater than 0");
   }
+  if (streamingConfig_.maxWindowWords <= streamingConfig_.waitK) {
+    errors.push_back("Streaming maxWindowWords must be greater than waitK");
+  }
 
   // Validate error handling configuration
   if (errorHandlingConfig_.maxRetryAttempts < 0) {
@@ -2,6 +2,8 @@
 #include "mt/translation_interface.hpp"
 #include "utils/logging.hpp"
 #include "utils/json_utils.hpp"
+#include "utils/metrics_registry.hpp"
+#include "utils/system_resource_sampler.hpp"
 #include <algorithm>
 #include <numeric>
 #include <fstream>
@@ -26,6 +28,42 @@
 namespace speechrnt {
 namespace mt {
 
+namespace {
+
+utils::Gauge& translationQueueDepth() {
+    static utils::Gauge& gauge = utils::MetricsRegistry::getInstance().gauge(
+        "speechrnt_queue_depth", "Items waiting in a work queue", {{"queue", "mt_translation"}});
+    return gauge;
+}
+
+// Pre-aggregated series for /metrics; the language pair selects the Marian model
+void exportTranslationMetrics(const TranslationMetrics& metrics) {
+    auto& registry = utils::MetricsRegistry::getInstance();
+    static utils::Histogram& stageHistogram = registry.histogram(
+        "speechrnt_pipeline_stage_duration_seconds", "Latency of pipeline stages and end-to-end paths",
+        utils::MetricsRegistry::latencyBuckets(), {{"stage", "mt"}});
+    static utils::Counter& cacheHits = registry.counter(
+        "speechrnt_cache_requests", "Cache lookups by cache and result",
+        {{"cache", "translation"}, {"result", "hit"}});
+    static utils::Counter& cacheMisses = registry.counter(
+        "speechrnt_cache_requests", "Cache lookups by cache and result",
+        {{"cache", "translation"}, {"result", "miss"}});
+
+    double seconds = std::chrono::duration<double>(metrics.latency).count();
+    stageHistogram.observe(seconds);
+    (metrics.usedCache ? cacheHits : cacheMisses).inc();
+    if (!metrics.usedCache) {
+        registry
+            .histogram("speechrnt_model_duration_seconds", "Inference latency per component and model",
+                       utils::MetricsRegistry::latencyBuckets(),
+                       {{"component", "mt"}, {"model", metrics.sourceLang + "-" + metrics.targetLang},
+                        {"device", metrics.usedGPU ? "gpu" : "cpu"}})
+            .observe(seconds);
+    }
+}
+
+} // namespace
+
 PerformanceMonitor::PerformanceMonitor() 
     : initialized_(false)
     , realTimeMonitoringActive_(false)
@@ -119,6 +157,8 @@ void PerformanceMonitor::recordTranslationMetrics(const TranslationMetrics& metr
         return;
     }
     
+    exportTranslationMetrics(metrics);
+    
     {
         std::lock_guard<std::mutex> lock(metricsMutex_);
         translationMetrics_.push_back(metrics);
@@ -439,6 +479,7 @@ void PerformanceMonitor::enqueueTranslation(const QueuedTranslation& translation
         }
         
         translationQueue_.push(translation);
+        translationQueueDepth().set(static_cast<double>(translationQueue_.size()));
     }
     
     queueCondition_.notify_one();
@@ -460,6 +501,7 @@ bool PerformanceMonitor::dequeueTranslation(QueuedTranslation& translation) {
     
     translation = translationQueue_.top();
     translationQueue_.pop();
+    translationQueueDepth().set(static_cast<double>(translationQueue_.size()));
     
     speechrnt::utils::Logger::debug("Translation dequeued: " + translation.sessionId);
     return true;
@@ -484,6 +526,7 @@ void PerformanceMonitor::clearQueue() {
     while (!translationQueue_.empty()) {
         translationQueue_.pop();
     }
+    translationQueueDepth().set(0);
     
     speechrnt::utils::Logger::info("Translation queue cleared");
 }
@@ -883,22 +926,10 @@ ResourceMetrics PerformanceMonitor::collectCurrentResourceMetrics() const {
         metrics.cpuUsagePercent = 0.0f; // Placeholder
         
 #elif __linux__
-        // Linux implementation
-        struct sysinfo memInfo;
-        if (sysinfo(&memInfo) == 0) {
-            long long totalPhysMem = memInfo.totalram * memInfo.mem_unit;
-            long long physMemUsed = (memInfo.totalram - memInfo.freeram) * memInfo.mem_unit;
-            metrics.memoryUsageMB = static_cast<size_t>(physMemUsed / (1024 * 1024));
-        }
-        
-        // Read CPU usage from /proc/stat
-        std::ifstream statFile("/proc/stat");
-        if (statFile.is_open()) {
-            std::string line;
-            std::getline(statFile, line);
-            // Parse CPU usage - simplified implementation
-            metrics.cpuUsagePercent = 50.0f; // Placeholder
-        }
+        // Linux implementation, from the shared /proc sampler
+        auto snapshot = utils::SystemResourceSampler::getInstance().getSnapshot();
+        metrics.memoryUsageMB = static_cast<size_t>(snapshot.totalMemoryMB - snapshot.freeMemoryMB);
+        metrics.cpuUsagePercent = snapshot.cpuUsage * 100.0f;
         
 #elif __APPLE__
         // macOS implementation
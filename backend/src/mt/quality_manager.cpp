@@ -3,15 +3,94 @@
 #include "utils/logging.hpp"
 #include <fstream>
 #include <algorithm>
+#include <array>
+#include <cctype>
 #include <numeric>
-#include <regex>
-#include <sstream>
 #include <cmath>
 #include <random>
 
 namespace speechrnt {
 namespace mt {
 
+namespace {
+
+// Code points in UTF-8 text
+size_t countCharacters(std::string_view text) {
+    size_t characters = 0;
+    for (unsigned char c : text) {
+        characters += (c & 0xC0) != 0x80;
+    }
+    return characters;
+}
+
+float confidenceScore(size_t sourceCharacters,
+                      std::string_view translation,
+                      size_t translationCharacters,
+                      const std::vector<float>& modelScores) {
+    if (sourceCharacters == 0 || translationCharacters == 0) {
+        return 0.0f;
+    }
+    
+    float confidence = 0.0f;
+    
+    // Use model scores if available
+    if (!modelScores.empty()) {
+        float modelConfidence = std::accumulate(modelScores.begin(), modelScores.end(), 0.0f) / 
+                               modelScores.size();
+        confidence += modelConfidence * 0.4f; // 40% weight for model scores
+    }
+    
+    // Length ratio score (penalize very short or very long translations)
+    float lengthRatio = static_cast<float>(translationCharacters) / sourceCharacters;
+    float lengthScore = 1.0f - std::abs(1.0f - lengthRatio) * 0.5f;
+    lengthScore = std::max(0.0f, std::min(1.0f, lengthScore));
+    confidence += lengthScore * 0.2f; // 20% weight for length ratio
+    
+    // Character diversity score (avoid repetitive translations)
+    std::array<uint32_t, 128> charCounts{};
+    bool anyCounted = false;
+    for (unsigned char c : translation) {
+        if (c < 128 && std::isalnum(c)) {
+            charCounts[std::tolower(c)]++;
+            anyCounted = true;
+        }
+    }
+    
+    float diversity = 0.0f;
+    if (anyCounted) {
+        float entropy = 0.0f;
+        for (uint32_t count : charCounts) {
+            if (count > 0) {
+                float prob = static_cast<float>(count) / translationCharacters;
+                entropy -= prob * std::log2(prob);
+            }
+        }
+        diversity = std::min(1.0f, entropy / 4.0f); // Normalize to 0-1
+    }
+    confidence += diversity * 0.2f; // 20% weight for diversity
+    
+    // Basic completeness check
+    float completeness = 1.0f;
+    if (translationCharacters < sourceCharacters * 0.3f) {
+        completeness = 0.5f; // Penalize very short translations
+    }
+    confidence += completeness * 0.2f; // 20% weight for completeness
+    
+    return std::max(0.0f, std::min(1.0f, confidence));
+}
+
+// Sorted, de-duplicated case-folded word hashes
+void collectWordSet(const TokenizedText& text, std::vector<uint64_t>& words) {
+    words.clear();
+    for (const auto& token : text.tokens()) {
+        words.push_back(token.foldedHash);
+    }
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+}
+
+} // namespace
+
 QualityManager::QualityManager() 
     : initialized_(false) {
     initializeDefaultConfiguration();
@@ -85,32 +164,18 @@ QualityMetrics QualityManager::assessTranslationQuality(
     }
     
     try {
-        // Calculate individual quality scores
-        metrics.fluencyScore = calculateFluencyScore(translatedText, targetLang);
-        metrics.adequacyScore = calculateAdequacyScore(sourceText, translatedText, 
-                                                      sourceLang, targetLang);
-        metrics.consistencyScore = calculateConsistencyScore(translatedText, targetLang);
-        
-        // Calculate word-level confidences if enabled
-        if (config_.enableWordLevelScoring) {
-            metrics.wordLevelConfidences = calculateWordLevelConfidences(translatedText, modelScores);
-        }
+        // Each text is tokenized once for all scorers; the per-thread
+        // objects keep their buffers between assessments
+        thread_local TokenizedText source;
+        thread_local TokenizedText translation;
+        source.tokenize(sourceText);
+        translation.tokenize(translatedText);
         
-        // Calculate overall confidence
-        metrics.overallConfidence = calculateConfidenceScore(sourceText, translatedText, modelScores);
-        
-        // Determine quality level
-        metrics.qualityLevel = determineQualityLevel(metrics.overallConfidence);
-        
-        // Detect quality issues if enabled
-        if (config_.enableQualityIssueDetection) {
-            metrics.qualityIssues = detectQualityIssues(sourceText, translatedText, 
-                                                        sourceLang, targetLang, metrics);
-        }
+        metrics = assessTokenized(source, translation, sourceLang, targetLang, modelScores);
         
         // Update statistics
         auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
         updateStatistics(metrics, duration);
         
     } catch (const std::exception& e) {
@@ -122,69 +187,50 @@ QualityMetrics QualityManager::assessTranslationQuality(
     return metrics;
 }
 
-float QualityManager::calculateConfidenceScore(
-    const std::string& sourceText,
-    const std::string& translatedText,
+QualityMetrics QualityManager::assessTokenized(
+    const TokenizedText& source,
+    const TokenizedText& translation,
+    const std::string& sourceLang,
+    const std::string& targetLang,
     const std::vector<float>& modelScores) {
     
-    if (sourceText.empty() || translatedText.empty()) {
-        return 0.0f;
+    QualityMetrics metrics;
+    if (source.text().empty() || translation.text().empty()) {
+        return metrics;
     }
     
-    float confidence = 0.0f;
-    int scoreCount = 0;
+    // Calculate individual quality scores
+    metrics.fluencyScore = calculateFluencyScore(translation, targetLang);
+    metrics.adequacyScore = calculateAdequacyScore(source, translation, sourceLang, targetLang);
+    metrics.consistencyScore = calculateConsistencyScore(translation, targetLang);
     
-    // Use model scores if available
-    if (!modelScores.empty()) {
-        float modelConfidence = std::accumulate(modelScores.begin(), modelScores.end(), 0.0f) / 
-                               modelScores.size();
-        confidence += modelConfidence * 0.4f; // 40% weight for model scores
-        scoreCount++;
+    // Calculate word-level confidences if enabled
+    if (config_.enableWordLevelScoring) {
+        metrics.wordLevelConfidences = calculateWordLevelConfidences(translation, modelScores);
     }
     
-    // Length ratio score (penalize very short or very long translations)
-    float lengthRatio = static_cast<float>(translatedText.length()) / sourceText.length();
-    float lengthScore = 1.0f - std::abs(1.0f - lengthRatio) * 0.5f;
-    lengthScore = std::max(0.0f, std::min(1.0f, lengthScore));
-    confidence += lengthScore * 0.2f; // 20% weight for length ratio
-    scoreCount++;
+    // Calculate overall confidence
+    metrics.overallConfidence = confidenceScore(source.characterCount(), translation.text(),
+                                                translation.characterCount(), modelScores);
     
-    // Character diversity score (avoid repetitive translations)
-    std::unordered_map<char, int> charCounts;
-    for (char c : translatedText) {
-        if (std::isalnum(c)) {
-            charCounts[std::tolower(c)]++;
-        }
-    }
+    // Determine quality level
+    metrics.qualityLevel = determineQualityLevel(metrics.overallConfidence);
     
-    float diversity = 0.0f;
-    if (!charCounts.empty()) {
-        float entropy = 0.0f;
-        int totalChars = translatedText.length();
-        for (const auto& [ch, count] : charCounts) {
-            float prob = static_cast<float>(count) / totalChars;
-            if (prob > 0) {
-                entropy -= prob * std::log2(prob);
-            }
-        }
-        diversity = std::min(1.0f, entropy / 4.0f); // Normalize to 0-1
+    // Detect quality issues if enabled
+    if (config_.enableQualityIssueDetection) {
+        metrics.qualityIssues = detectQualityIssues(source, translation, sourceLang, targetLang, metrics);
     }
-    confidence += diversity * 0.2f; // 20% weight for diversity
-    scoreCount++;
     
-    // Basic completeness check
-    float completeness = 1.0f;
-    if (translatedText.length() < sourceText.length() * 0.3f) {
-        completeness = 0.5f; // Penalize very short translations
-    }
-    confidence += completeness * 0.2f; // 20% weight for completeness
-    scoreCount++;
-    
-    if (scoreCount > 0) {
-        confidence = confidence; // Already weighted
-    }
+    return metrics;
+}
+
+float QualityManager::calculateConfidenceScore(
+    const std::string& sourceText,
+    const std::string& translatedText,
+    const std::vector<float>& modelScores) {
     
-    return std::max(0.0f, std::min(1.0f, confidence));
+    return confidenceScore(countCharacters(sourceText), translatedText,
+                           countCharacters(translatedText), modelScores);
 }
 
 std::vector<TranslationCandidate> QualityManager::generateTranslationCandidates(
@@ -203,11 +249,14 @@ std::vector<TranslationCandidate> QualityManager::generateTranslationCandidates(
     maxCandidates = std::min(maxCandidates, config_.maxAlternatives);
     
     try {
+        // The source is tokenized once and shared by every candidate
+        TokenizedText source(sourceText);
+        TokenizedText candidateText(currentTranslation);
+        
         // Add the current translation as the first candidate
         TranslationCandidate primary;
         primary.translatedText = currentTranslation;
-        primary.qualityMetrics = assessTranslationQuality(sourceText, currentTranslation, 
-                                                          sourceLang, targetLang);
+        primary.qualityMetrics = assessTokenized(source, candidateText, sourceLang, targetLang, {});
         primary.modelScore = primary.qualityMetrics.overallConfidence;
         primary.rank = 1;
         candidates.push_back(primary);
@@ -243,8 +292,8 @@ std::vector<TranslationCandidate> QualityManager::generateTranslationCandidates(
         for (size_t i = 0; i < alternatives.size() && candidates.size() < maxCandidates; ++i) {
             TranslationCandidate candidate;
             candidate.translatedText = alternatives[i];
-            candidate.qualityMetrics = assessTranslationQuality(sourceText, alternatives[i], 
-                                                               sourceLang, targetLang);
+            candidateText.tokenize(alternatives[i]);
+            candidate.qualityMetrics = assessTokenized(source, candidateText, sourceLang, targetLang, {});
             candidate.modelScore = candidate.qualityMetrics.overallConfidence;
             candidate.rank = static_cast<int>(candidates.size() + 1);
             candidates.push_back(candidate);
@@ -388,24 +437,28 @@ bool QualityManager::isReady() const {
     return initialized_;
 }
 
+std::chrono::microseconds QualityManager::getAverageAssessmentTime() const {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    if (statistics_.totalAssessments == 0) {
+        return std::chrono::microseconds(0);
+    }
+    return statistics_.totalAssessmentTime / statistics_.totalAssessments;
+}
+
 // Private methods implementation
 
-float QualityManager::calculateFluencyScore(const std::string& text, const std::string& language) {
-    if (text.empty()) {
+float QualityManager::calculateFluencyScore(const TokenizedText& text, const std::string& language) {
+    if (text.text().empty()) {
         return 0.0f;
     }
     
     float score = 1.0f;
+    size_t length = text.characterCount();
     
     // Check for basic fluency indicators
     
     // 1. Sentence structure (basic check for complete sentences)
-    std::regex sentencePattern(R"([.!?]+)");
-    std::sregex_iterator iter(text.begin(), text.end(), sentencePattern);
-    std::sregex_iterator end;
-    int sentenceCount = std::distance(iter, end);
-    
-    if (sentenceCount == 0 && text.length() > 20) {
+    if (text.terminatedSentenceCount() == 0 && length > 20) {
         score -= 0.2f; // Penalize lack of sentence endings in longer text
     }
     
@@ -415,35 +468,29 @@ float QualityManager::calculateFluencyScore(const std::string& text, const std::
     }
     
     // 3. Length reasonableness
-    if (text.length() < 3) {
+    if (length < 3) {
         score -= 0.4f;
     }
     
-    // 4. Character diversity
-    std::unordered_map<char, int> charCounts;
-    for (char c : text) {
-        if (std::isalpha(c)) {
-            charCounts[std::tolower(c)]++;
-        }
-    }
-    
-    if (charCounts.size() < 3 && text.length() > 10) {
+    // 4. Character diversity; only Latin letters are counted, so text in
+    // other scripts is not judged by it
+    if (!text.hasNonAscii() && text.distinctLetterCount() < 3 && length > 10) {
         score -= 0.2f; // Low character diversity
     }
     
     return std::max(0.0f, std::min(1.0f, score));
 }
 
-float QualityManager::calculateAdequacyScore(const std::string& source, const std::string& translation,
+float QualityManager::calculateAdequacyScore(const TokenizedText& source, const TokenizedText& translation,
                                             const std::string& sourceLang, const std::string& targetLang) {
-    if (source.empty() || translation.empty()) {
+    if (source.text().empty() || translation.text().empty()) {
         return 0.0f;
     }
     
     float score = 1.0f;
     
     // 1. Length ratio check (very different lengths might indicate missing content)
-    float lengthRatio = static_cast<float>(translation.length()) / source.length();
+    float lengthRatio = static_cast<float>(translation.characterCount()) / source.characterCount();
     if (lengthRatio < 0.3f || lengthRatio > 3.0f) {
         score -= 0.3f;
     }
@@ -460,8 +507,8 @@ float QualityManager::calculateAdequacyScore(const std::string& source, const st
     return std::max(0.0f, std::min(1.0f, score));
 }
 
-float QualityManager::calculateConsistencyScore(const std::string& text, const std::string& language) {
-    if (text.empty()) {
+float QualityManager::calculateConsistencyScore(const TokenizedText& text, const std::string& language) {
+    if (text.text().empty()) {
         return 0.0f;
     }
     
@@ -478,12 +525,12 @@ float QualityManager::calculateConsistencyScore(const std::string& text, const s
     }
     
     // 3. Basic consistency in style (simplified check)
-    std::vector<std::string> tokens = tokenizeText(text);
+    const auto& tokens = text.tokens();
     if (tokens.size() > 5) {
         // Check for consistent capitalization patterns
         int capitalizedCount = 0;
         for (const auto& token : tokens) {
-            if (!token.empty() && std::isupper(token[0])) {
+            if (token.flags & TokenizedText::TOKEN_CAPITALIZED) {
                 capitalizedCount++;
             }
         }
@@ -498,9 +545,9 @@ float QualityManager::calculateConsistencyScore(const std::string& text, const s
     return std::max(0.0f, std::min(1.0f, score));
 }
 
-std::vector<float> QualityManager::calculateWordLevelConfidences(const std::string& text,
+std::vector<float> QualityManager::calculateWordLevelConfidences(const TokenizedText& text,
                                                                 const std::vector<float>& modelScores) {
-    std::vector<std::string> tokens = tokenizeText(text);
+    const auto& tokens = text.tokens();
     std::vector<float> confidences;
     
     if (tokens.empty()) {
@@ -513,23 +560,24 @@ std::vector<float> QualityManager::calculateWordLevelConfidences(const std::stri
     }
     
     // Otherwise, generate estimated confidences based on word characteristics
+    confidences.reserve(tokens.size());
     for (const auto& token : tokens) {
         float confidence = 0.8f; // Base confidence
         
         // Adjust based on word length (very short or very long words might be less reliable)
-        if (token.length() <= 2) {
+        if (token.characters <= 2) {
             confidence -= 0.1f;
-        } else if (token.length() > 15) {
+        } else if (token.characters > 15) {
             confidence -= 0.2f;
         }
         
         // Adjust based on character patterns
-        bool hasNumbers = std::any_of(token.begin(), token.end(), ::isdigit);
-        bool hasSpecialChars = std::any_of(token.begin(), token.end(), 
-                                          [](char c) { return !std::isalnum(c) && c != ' '; });
-        
-        if (hasNumbers) confidence += 0.1f; // Numbers are usually translated accurately
-        if (hasSpecialChars) confidence -= 0.1f; // Special characters might cause issues
+        if (token.flags & TokenizedText::TOKEN_HAS_DIGIT) {
+            confidence += 0.1f; // Numbers are usually translated accurately
+        }
+        if (token.flags & TokenizedText::TOKEN_HAS_SYMBOL) {
+            confidence -= 0.1f; // Special characters might cause issues
+        }
         
         confidences.push_back(std::max(0.0f, std::min(1.0f, confidence)));
     }
@@ -538,8 +586,8 @@ std::vector<float> QualityManager::calculateWordLevelConfidences(const std::stri
 }
 
 std::vector<std::string> QualityManager::detectQualityIssues(
-    const std::string& source,
-    const std::string& translation,
+    const TokenizedText& source,
+    const TokenizedText& translation,
     const std::string& sourceLang,
     const std::string& targetLang,
     const QualityMetrics& metrics) {
@@ -575,7 +623,7 @@ std::vector<std::string> QualityManager::detectQualityIssues(
     }
     
     // Check for extreme length differences
-    float lengthRatio = static_cast<float>(translation.length()) / source.length();
+    float lengthRatio = static_cast<float>(translation.characterCount()) / source.characterCount();
     if (lengthRatio < 0.2f) {
         issues.push_back("Translation significantly shorter than source");
     } else if (lengthRatio > 4.0f) {
@@ -585,31 +633,8 @@ std::vector<std::string> QualityManager::detectQualityIssues(
     return issues;
 }
 
-std::vector<std::string> QualityManager::tokenizeText(const std::string& text) const {
-    std::vector<std::string> tokens;
-    std::istringstream iss(text);
-    std::string token;
-    
-    while (iss >> token) {
-        // Remove punctuation from the end
-        while (!token.empty() && std::ispunct(token.back())) {
-            token.pop_back();
-        }
-        
-        if (!token.empty()) {
-            tokens.push_back(token);
-        }
-    }
-    
-    return tokens;
-}
-
-float QualityManager::calculateTextComplexity(const std::string& text, const std::string& language) const {
-    if (text.empty()) {
-        return 0.0f;
-    }
-    
-    std::vector<std::string> tokens = tokenizeText(text);
+float QualityManager::calculateTextComplexity(const TokenizedText& text, const std::string& language) const {
+    const auto& tokens = text.tokens();
     if (tokens.empty()) {
         return 0.0f;
     }
@@ -617,7 +642,7 @@ float QualityManager::calculateTextComplexity(const std::string& text, const std
     // Calculate average word length
     float avgWordLength = 0.0f;
     for (const auto& token : tokens) {
-        avgWordLength += token.length();
+        avgWordLength += token.characters;
     }
     avgWordLength /= tokens.size();
     
@@ -627,84 +652,97 @@ float QualityManager::calculateTextComplexity(const std::string& text, const std
     return complexity;
 }
 
-float QualityManager::calculateSemanticSimilarity(const std::string& text1, const std::string& text2) const {
+float QualityManager::calculateSemanticSimilarity(const TokenizedText& text1, const TokenizedText& text2) const {
     // Simplified semantic similarity based on common words
-    std::vector<std::string> tokens1 = tokenizeText(text1);
-    std::vector<std::string> tokens2 = tokenizeText(text2);
-    
-    if (tokens1.empty() || tokens2.empty()) {
+    if (text1.tokens().empty() || text2.tokens().empty()) {
         return 0.0f;
     }
     
-    // Convert to lowercase for comparison
-    std::unordered_map<std::string, int> wordCount1, wordCount2;
-    
-    for (auto token : tokens1) {
-        std::transform(token.begin(), token.end(), token.begin(), ::tolower);
-        wordCount1[token]++;
-    }
-    
-    for (auto token : tokens2) {
-        std::transform(token.begin(), token.end(), token.begin(), ::tolower);
-        wordCount2[token]++;
-    }
-    
-    // Calculate Jaccard similarity
-    std::unordered_set<std::string> allWords;
-    for (const auto& [word, count] : wordCount1) {
-        allWords.insert(word);
-    }
-    for (const auto& [word, count] : wordCount2) {
-        allWords.insert(word);
-    }
-    
-    int intersection = 0;
-    for (const auto& word : allWords) {
-        if (wordCount1.count(word) && wordCount2.count(word)) {
-            intersection++;
+    // Jaccard similarity of the case-folded word sets
+    thread_local std::vector<uint64_t> words1;
+    thread_local std::vector<uint64_t> words2;
+    collectWordSet(text1, words1);
+    collectWordSet(text2, words2);
+    
+    size_t intersection = 0;
+    auto it1 = words1.begin();
+    auto it2 = words2.begin();
+    while (it1 != words1.end() && it2 != words2.end()) {
+        if (*it1 < *it2) {
+            ++it1;
+        } else if (*it2 < *it1) {
+            ++it2;
+        } else {
+            ++intersection;
+            ++it1;
+            ++it2;
         }
     }
     
-    float similarity = static_cast<float>(intersection) / allWords.size();
-    return similarity;
+    size_t unionSize = words1.size() + words2.size() - intersection;
+    return static_cast<float>(intersection) / unionSize;
 }
 
-bool QualityManager::detectRepeatedPhrases(const std::string& text) const {
-    std::vector<std::string> tokens = tokenizeText(text);
+bool QualityManager::detectRepeatedPhrases(const TokenizedText& text) const {
+    const auto& tokens = text.tokens();
     
     if (tokens.size() < 4) {
         return false;
     }
     
-    // Check for repeated 2-word phrases
-    std::unordered_map<std::string, int> phrases;
-    for (size_t i = 0; i < tokens.size() - 1; ++i) {
-        std::string phrase = tokens[i] + " " + tokens[i + 1];
-        phrases[phrase]++;
-        
-        if (phrases[phrase] > 2) {
-            return true;
+    // Check for a 2-word phrase occurring three times. Phrases are grouped
+    // by hash, and only groups that could hold three are compared word by word
+    thread_local std::vector<std::pair<uint64_t, uint32_t>> phrases;
+    phrases.clear();
+    for (size_t i = 0; i + 1 < tokens.size(); ++i) {
+        uint64_t first = tokens[i].foldedHash;
+        uint64_t hash = first ^ (tokens[i + 1].foldedHash + 0x9e3779b97f4a7c15ull + (first << 6) + (first >> 2));
+        phrases.emplace_back(hash, static_cast<uint32_t>(i));
+    }
+    std::sort(phrases.begin(), phrases.end());
+    
+    for (size_t start = 0; start < phrases.size();) {
+        size_t end = start + 1;
+        while (end < phrases.size() && phrases[end].first == phrases[start].first) {
+            ++end;
         }
+        for (size_t a = start; end - a >= 3; ++a) {
+            size_t i = phrases[a].second;
+            int occurrences = 1;
+            for (size_t b = a + 1; b < end; ++b) {
+                size_t j = phrases[b].second;
+                if (text.token(i) == text.token(j) && text.token(i + 1) == text.token(j + 1) &&
+                    ++occurrences > 2) {
+                    return true;
+                }
+            }
+        }
+        start = end;
     }
     
     return false;
 }
 
-bool QualityManager::detectIncompleteTranslation(const std::string& source, const std::string& translation) const {
+bool QualityManager::detectIncompleteTranslation(const TokenizedText& source, const TokenizedText& translation) const {
+    size_t sourceLength = source.characterCount();
+    size_t translationLength = translation.characterCount();
+    
     // Very basic check for incomplete translation
-    if (translation.length() < source.length() * 0.2f && source.length() > 20) {
+    if (translationLength < sourceLength * 0.2f && sourceLength > 20) {
         return true;
     }
     
     // Check if translation ends abruptly (no proper sentence ending)
-    if (translation.length() > 10) {
-        char lastChar = translation.back();
-        if (lastChar != '.' && lastChar != '!' && lastChar != '?' && lastChar != ':') {
+    if (translationLength > 10) {
+        const auto& sentences = translation.sentences();
+        bool terminated = (!sentences.empty() && sentences.back().terminated) ||
+                          translation.text().back() == ':';
+        if (!terminated) {
             // Check if it looks like it was cut off mid-word
-            std::vector<std::string> tokens = tokenizeText(translation);
+            const auto& tokens = translation.tokens();
             if (!tokens.empty()) {
-                const std::string& lastToken = tokens.back();
-                if (lastToken.length() > 1 && std::islower(lastToken.back())) {
+                const auto& lastToken = tokens.back();
+                if (lastToken.characters > 1 && (lastToken.flags & TokenizedText::TOKEN_ENDS_LOWERCASE)) {
                     return true; // Likely cut off mid-word
                 }
             }
@@ -714,17 +752,13 @@ bool QualityManager::detectIncompleteTranslation(const std::string& source, cons
     return false;
 }
 
-bool QualityManager::detectLanguageMixing(const std::string& text, const std::string& expectedLang) const {
+bool QualityManager::detectLanguageMixing(const TokenizedText& text, const std::string& expectedLang) const {
     // Simplified language mixing detection
     // This is a placeholder - in a real implementation, you'd use proper language detection
     
     if (expectedLang == "en") {
         // Check for common non-English characters
-        for (char c : text) {
-            if (c < 0 || c > 127) { // Non-ASCII characters
-                return true;
-            }
-        }
+        return text.hasNonAscii();
     }
     
     return false;
@@ -757,15 +791,38 @@ std::string QualityManager::generateParaphraseAlternative(const std::string& tex
 
 std::string QualityManager::generateSimplifiedAlternative(const std::string& text, const std::string& language) {
     // Simplified version generation
-    std::string simplified = text;
-    
-    // Remove complex punctuation
-    std::regex complexPunct(R"([;:—–])");
-    simplified = std::regex_replace(simplified, complexPunct, ",");
-    
-    // Break long sentences (very basic approach)
-    std::regex longSentence(R"(,\s+)");
-    simplified = std::regex_replace(simplified, longSentence, ". ");
+    std::string simplified;
+    simplified.reserve(text.size());
+    
+    for (size_t i = 0; i < text.size();) {
+        unsigned char c = text[i];
+        size_t length = 0;
+        if (c == ';' || c == ':' || c == ',') {
+            length = 1;
+        } else if (c == 0xE2 && i + 2 < text.size() && static_cast<unsigned char>(text[i + 1]) == 0x80 &&
+                   (static_cast<unsigned char>(text[i + 2]) == 0x93 ||
+                    static_cast<unsigned char>(text[i + 2]) == 0x94)) {
+            length = 3; // En and em dashes
+        }
+        if (length == 0) {
+            simplified += text[i++];
+            continue;
+        }
+        i += length;
+        
+        // Remove complex punctuation, and break long sentences where a
+        // comma is followed by whitespace (very basic approach)
+        size_t next = i;
+        while (next < text.size() && std::isspace(static_cast<unsigned char>(text[next]))) {
+            ++next;
+        }
+        if (next > i) {
+            simplified += ". ";
+            i = next;
+        } else {
+            simplified += ',';
+        }
+    }
     
     return simplified;
 }
@@ -799,14 +856,17 @@ std::string QualityManager::generateWordByWordFallback(const std::string& source
     // Very basic word-by-word translation fallback
     // In a real implementation, this would use a dictionary or simple translation service
     
-    std::vector<std::string> tokens = tokenizeText(sourceText);
+    TokenizedText source(sourceText);
     std::string fallback;
+    fallback.reserve(sourceText.size() + 3 * source.tokens().size());
     
-    for (size_t i = 0; i < tokens.size(); ++i) {
+    for (size_t i = 0; i < source.tokens().size(); ++i) {
         if (i > 0) fallback += " ";
         
         // Placeholder: just add a prefix to indicate this is a fallback
-        fallback += "[" + tokens[i] + "]";
+        fallback += '[';
+        fallback += source.token(i);
+        fallback += ']';
     }
     
     return fallback;
@@ -883,7 +943,8 @@ std::string QualityManager::determineQualityLevel(float confidence) const {
 }
 
 void QualityManager::updateStatistics(const QualityMetrics& metrics,
-                                     std::chrono::milliseconds assessmentTime) {
+                                     std::chrono::microseconds assessmentTime) {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
     statistics_.totalAssessments++;
     
     if (metrics.qualityLevel == "high") {
@@ -0,0 +1,153 @@
+#include "mt/text_tokenizer.hpp"
+#include <bitset>
+
+namespace speechrnt {
+namespace mt {
+
+namespace {
+
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+// The classic-locale sets, without the locale lookup
+bool isSpace(unsigned char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+bool isPunctuation(unsigned char c) {
+    return (c >= '!' && c <= '/') || (c >= ':' && c <= '@') ||
+           (c >= '[' && c <= '`') || (c >= '{' && c <= '~');
+}
+
+bool isDigit(unsigned char c) {
+    return c >= '0' && c <= '9';
+}
+
+bool isUpper(unsigned char c) {
+    return c >= 'A' && c <= 'Z';
+}
+
+bool isLower(unsigned char c) {
+    return c >= 'a' && c <= 'z';
+}
+
+// Bytes of the sentence terminator starting at i, 0 if there is none
+size_t terminatorLength(std::string_view text, size_t i) {
+    unsigned char c = text[i];
+    if (c == '.' || c == '!' || c == '?') {
+        return 1;
+    }
+    if (i + 2 < text.size()) {
+        unsigned char second = text[i + 1];
+        unsigned char third = text[i + 2];
+        // U+3002 ideographic full stop, U+FF01 and U+FF1F full-width ! and ?
+        if ((c == 0xE3 && second == 0x80 && third == 0x82) ||
+            (c == 0xEF && second == 0xBC && (third == 0x81 || third == 0x9F))) {
+            return 3;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+void TokenizedText::tokenize(std::string_view text) {
+    text_ = text;
+    tokens_.clear();
+    sentences_.clear();
+    terminatedSentences_ = 0;
+    characters_ = 0;
+    letterMask_ = 0;
+    nonAscii_ = false;
+
+    const size_t size = text.size();
+
+    // Words
+    size_t i = 0;
+    while (i < size) {
+        while (i < size && isSpace(text[i])) {
+            ++i;
+        }
+        size_t start = i;
+        while (i < size && !isSpace(text[i])) {
+            ++i;
+        }
+        size_t end = i;
+        while (end > start && isPunctuation(text[end - 1])) {
+            --end;
+        }
+        if (end == start) {
+            continue;
+        }
+
+        Token token{static_cast<uint32_t>(start), static_cast<uint32_t>(end - start), 0, 0, FNV_OFFSET_BASIS};
+        for (size_t j = start; j < end; ++j) {
+            unsigned char c = text[j];
+            if ((c & 0xC0) != 0x80) {
+                token.characters++;
+            }
+            if (c >= 0x80) {
+                token.flags |= TOKEN_NON_ASCII;
+            } else if (isDigit(c)) {
+                token.flags |= TOKEN_HAS_DIGIT;
+            } else if (!isUpper(c) && !isLower(c)) {
+                token.flags |= TOKEN_HAS_SYMBOL;
+            }
+            unsigned char folded = isUpper(c) ? static_cast<unsigned char>(c + ('a' - 'A')) : c;
+            token.foldedHash = (token.foldedHash ^ folded) * FNV_PRIME;
+        }
+        if (isUpper(text[start])) {
+            token.flags |= TOKEN_CAPITALIZED;
+        }
+        if (isLower(text[end - 1])) {
+            token.flags |= TOKEN_ENDS_LOWERCASE;
+        }
+        tokens_.push_back(token);
+    }
+
+    // Sentences, and character statistics of the whole text
+    size_t sentenceStart = 0;
+    i = 0;
+    while (i < size) {
+        size_t length = terminatorLength(text, i);
+        if (length == 0) {
+            unsigned char c = text[i];
+            if ((c & 0xC0) != 0x80) {
+                characters_++;
+            }
+            if (c >= 0x80) {
+                nonAscii_ = true;
+            } else if (isUpper(c) || isLower(c)) {
+                letterMask_ |= 1u << ((c | 0x20) - 'a');
+            }
+            ++i;
+            continue;
+        }
+
+        while (i < size && (length = terminatorLength(text, i)) > 0) {
+            characters_++;
+            nonAscii_ = nonAscii_ || length > 1;
+            i += length;
+        }
+        while (isSpace(text[sentenceStart])) {
+            ++sentenceStart;
+        }
+        sentences_.push_back({static_cast<uint32_t>(sentenceStart), static_cast<uint32_t>(i - sentenceStart), true});
+        terminatedSentences_++;
+        sentenceStart = i;
+    }
+
+    while (sentenceStart < size && isSpace(text[sentenceStart])) {
+        ++sentenceStart;
+    }
+    if (sentenceStart < size) {
+        sentences_.push_back({static_cast<uint32_t>(sentenceStart), static_cast<uint32_t>(size - sentenceStart), false});
+    }
+}
+
+size_t TokenizedText::distinctLetterCount() const {
+    return std::bitset<26>(letterMask_).count();
+}
+
+} // namespace mt
+} // namespace speechrnt
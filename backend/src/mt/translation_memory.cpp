@@ -0,0 +1,858 @@
+#include "mt/translation_memory.hpp"
+#include "utils/logging.hpp"
+#include "utils/metrics_registry.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace speechrnt {
+namespace mt {
+
+namespace {
+
+constexpr uint32_t RECORD_MAGIC = 0x544D5231;   // "TMR1"
+constexpr uint32_t INDEX_MAGIC = 0x544D4931;    // "TMI1"
+constexpr uint32_t INDEX_VERSION = 1;
+constexpr uint64_t MIN_INDEX_CAPACITY = 1024;
+constexpr double MAX_INDEX_LOAD = 0.7;
+constexpr uint32_t MAX_FIELD_LENGTH = 1u << 20;
+constexpr char KEY_SEPARATOR = '\x1f';
+
+uint32_t checksum(const std::string& a, const std::string& b) {
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : a) {
+        hash = (hash ^ c) * 16777619u;
+    }
+    for (unsigned char c : b) {
+        hash = (hash ^ c) * 16777619u;
+    }
+    return hash;
+}
+
+uint64_t nextPowerOfTwo(uint64_t value) {
+    uint64_t result = MIN_INDEX_CAPACITY;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+#ifndef _WIN32
+bool writeFully(int fd, const void* data, size_t size) {
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = ::write(fd, ptr, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        ptr += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool readFully(int fd, uint64_t offset, void* data, size_t size) {
+    char* ptr = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = ::pread(fd, ptr, size, static_cast<off_t>(offset));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (n == 0) {
+            return false;
+        }
+        ptr += n;
+        offset += static_cast<uint64_t>(n);
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+#endif
+
+} // anonymous namespace
+
+struct TranslationMemory::RecordHeader {
+    uint32_t magic;
+    uint32_t keyLength;
+    uint32_t valueLength;
+    float confidence;
+    uint32_t checksum;
+};
+
+struct TranslationMemory::IndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;
+    uint64_t count;
+    uint64_t logSize;      // Log bytes reflected in the index
+    uint64_t staleBytes;
+};
+
+struct TranslationMemory::IndexSlot {
+    uint64_t hash;
+    uint64_t offsetPlusOne;  // 0 marks an empty slot
+};
+
+/**
+ * Fixed-capacity hash index backed by a shared file mapping
+ */
+class TranslationMemory::MappedIndex {
+public:
+    MappedIndex() : fd_(-1), data_(nullptr), size_(0) {}
+    ~MappedIndex() { close(); }
+
+    bool create(const std::string& path, uint64_t capacity) {
+#ifndef _WIN32
+        close();
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            return false;
+        }
+        size_ = sizeof(IndexHeader) + capacity * sizeof(IndexSlot);
+        if (::ftruncate(fd_, static_cast<off_t>(size_)) != 0 || !map()) {
+            close();
+            return false;
+        }
+        // ftruncate zero-fills, so every slot starts out empty
+        IndexHeader* h = header();
+        h->magic = INDEX_MAGIC;
+        h->version = INDEX_VERSION;
+        h->capacity = capacity;
+        h->count = 0;
+        h->logSize = 0;
+        h->staleBytes = 0;
+        return true;
+#else
+        (void)path;
+        (void)capacity;
+        return false;
+#endif
+    }
+
+    bool open(const std::string& path) {
+#ifndef _WIN32
+        close();
+        fd_ = ::open(path.c_str(), O_RDWR);
+        if (fd_ < 0) {
+            return false;
+        }
+        struct stat st;
+        if (::fstat(fd_, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(IndexHeader)) {
+            close();
+            return false;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (!map()) {
+            close();
+            return false;
+        }
+        const IndexHeader* h = header();
+        uint64_t capacity = h->capacity;
+        bool valid = h->magic == INDEX_MAGIC && h->version == INDEX_VERSION &&
+                     capacity >= MIN_INDEX_CAPACITY && (capacity & (capacity - 1)) == 0 &&
+                     size_ == sizeof(IndexHeader) + capacity * sizeof(IndexSlot) &&
+                     h->count <= capacity;
+        if (!valid) {
+            close();
+            return false;
+        }
+        return true;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+
+    void sync() {
+#ifndef _WIN32
+        if (data_) {
+            ::msync(data_, size_, MS_SYNC);
+        }
+#endif
+    }
+
+    void close() {
+#ifndef _WIN32
+        if (data_) {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        size_ = 0;
+    }
+
+    bool isValid() const { return data_ != nullptr; }
+    IndexHeader* header() const { return static_cast<IndexHeader*>(data_); }
+    IndexSlot* slots() const {
+        return reinterpret_cast<IndexSlot*>(static_cast<char*>(data_) + sizeof(IndexHeader));
+    }
+    uint64_t capacity() const { return header()->capacity; }
+
+private:
+    bool map() {
+#ifndef _WIN32
+        void* ptr = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (ptr == MAP_FAILED) {
+            data_ = nullptr;
+            return false;
+        }
+        data_ = ptr;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    int fd_;
+    void* data_;
+    size_t size_;
+};
+
+TranslationMemory::TranslationMemory()
+    : logFd_(-1)
+    , logSize_(0)
+    , staleBytes_(0)
+    , syncWrites_(false)
+    , lookups_(0)
+    , hits_(0) {
+}
+
+TranslationMemory::~TranslationMemory() {
+    close();
+}
+
+bool TranslationMemory::open(const std::string& directory, bool syncWrites) {
+#ifdef _WIN32
+    (void)directory;
+    (void)syncWrites;
+    speechrnt::utils::Logger::warn("Persistent translation memory is not supported on this platform");
+    return false;
+#else
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (logFd_ >= 0) {
+        speechrnt::utils::Logger::warn("TranslationMemory already open at " + directory_);
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        speechrnt::utils::Logger::error("Failed to create translation memory directory " +
+                                        directory + ": " + ec.message());
+        return false;
+    }
+
+    directory_ = directory;
+    logPath_ = (std::filesystem::path(directory) / "translation_memory.log").string();
+    indexPath_ = (std::filesystem::path(directory) / "translation_memory.idx").string();
+    syncWrites_ = syncWrites;
+
+    if (!openLog(logPath_)) {
+        speechrnt::utils::Logger::error("Failed to open translation memory log: " + logPath_);
+        return false;
+    }
+
+    index_ = std::make_unique<MappedIndex>();
+    bool indexUsable = index_->open(indexPath_) && index_->header()->logSize <= logSize_;
+
+    if (indexUsable) {
+        // Replay records appended after the index was last updated
+        uint64_t offset = index_->header()->logSize;
+        staleBytes_ = index_->header()->staleBytes;
+        while (offset < logSize_) {
+            std::string key;
+            Entry entry;
+            uint64_t next = 0;
+            if (!readRecord(logFd_, offset, key, entry, &next)) {
+                break;
+            }
+            if (!insertIndex(key, hashKey(key), offset)) {
+                indexUsable = false;
+                break;
+            }
+            offset = next;
+        }
+        if (indexUsable && offset < logSize_) {
+            speechrnt::utils::Logger::warn("Truncating torn translation memory record at offset " +
+                                           std::to_string(offset));
+            if (::ftruncate(logFd_, static_cast<off_t>(offset)) == 0) {
+                logSize_ = offset;
+            }
+        }
+        if (indexUsable) {
+            index_->header()->logSize = logSize_;
+        }
+    }
+
+    if (!indexUsable && !rebuildIndex()) {
+        speechrnt::utils::Logger::error("Failed to build translation memory index: " + indexPath_);
+        index_.reset();
+        ::close(logFd_);
+        logFd_ = -1;
+        return false;
+    }
+
+    speechrnt::utils::Logger::info("TranslationMemory opened at " + directory_ + " with " +
+                                   std::to_string(index_->header()->count) + " entries");
+    return true;
+#endif
+}
+
+void TranslationMemory::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+#ifndef _WIN32
+    if (index_) {
+        index_->sync();
+        index_.reset();
+    }
+    if (logFd_ >= 0) {
+        ::fsync(logFd_);
+        ::close(logFd_);
+        logFd_ = -1;
+    }
+#endif
+    logSize_ = 0;
+    staleBytes_ = 0;
+}
+
+bool TranslationMemory::isOpen() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return logFd_ >= 0 && index_ && index_->isValid();
+}
+
+bool TranslationMemory::lookup(const std::string& sourceText, const std::string& sourceLang,
+                               const std::string& targetLang, const std::string& modelVersion,
+                               Entry& entry) {
+    std::string key = makeKey(sourceText, sourceLang, targetLang, modelVersion);
+    uint64_t hash = hashKey(key);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (logFd_ < 0 || !index_) {
+        return false;
+    }
+
+    static utils::Counter& hitCounter = utils::MetricsRegistry::getInstance().counter(
+        "speechrnt_cache_requests", "Cache lookups by cache and result",
+        {{"cache", "translation_memory"}, {"result", "hit"}});
+    static utils::Counter& missCounter = utils::MetricsRegistry::getInstance().counter(
+        "speechrnt_cache_requests", "Cache lookups by cache and result",
+        {{"cache", "translation_memory"}, {"result", "miss"}});
+
+    lookups_++;
+    size_t slot = 0;
+    bool found = false;
+    if (!findSlot(key, hash, slot, found) || !found) {
+        missCounter.inc();
+        return false;
+    }
+
+    std::string storedKey;
+    if (!readRecord(logFd_, index_->slots()[slot].offsetPlusOne - 1, storedKey, entry)) {
+        missCounter.inc();
+        return false;
+    }
+
+    hits_++;
+    hitCounter.inc();
+    return true;
+}
+
+bool TranslationMemory::store(const std::string& sourceText, const std::string& sourceLang,
+                              const std::string& targetLang, const std::string& modelVersion,
+                              const Entry& entry) {
+    std::string key = makeKey(sourceText, sourceLang, targetLang, modelVersion);
+    if (key.size() > MAX_FIELD_LENGTH || entry.translatedText.size() > MAX_FIELD_LENGTH) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (logFd_ < 0 || !index_) {
+        return false;
+    }
+
+    // Skip the append entirely when the stored translation is unchanged
+    uint64_t hash = hashKey(key);
+    size_t slot = 0;
+    bool found = false;
+    if (findSlot(key, hash, slot, found) && found) {
+        std::string storedKey;
+        Entry existing;
+        if (readRecord(logFd_, index_->slots()[slot].offsetPlusOne - 1, storedKey, existing) &&
+            existing.translatedText == entry.translatedText) {
+            return true;
+        }
+    }
+
+    uint64_t offset = 0;
+    if (!appendRecord(key, entry, offset)) {
+        return false;
+    }
+    return insertIndex(key, hash, offset);
+}
+
+bool TranslationMemory::compact() {
+#ifdef _WIN32
+    return false;
+#else
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (logFd_ < 0 || !index_) {
+        return false;
+    }
+
+    uint64_t before = logSize_;
+    std::string tmpPath = logPath_ + ".compact";
+    size_t written = 0;
+    if (!writeCompactedLog(tmpPath, written)) {
+        std::filesystem::remove(tmpPath);
+        return false;
+    }
+
+    ::close(logFd_);
+    logFd_ = -1;
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, logPath_, ec);
+    if (ec) {
+        speechrnt::utils::Logger::error("Failed to replace translation memory log: " + ec.message());
+        std::error_code removeError;
+        std::filesystem::remove(tmpPath, removeError);
+    }
+
+    // On a failed rename this reopens the untouched original log
+    if (!openLog(logPath_) || !rebuildIndex()) {
+        speechrnt::utils::Logger::error("Failed to reopen translation memory after compaction");
+        return false;
+    }
+    if (ec) {
+        return false;
+    }
+
+    speechrnt::utils::Logger::info("TranslationMemory compacted: " + std::to_string(before) +
+                                   " -> " + std::to_string(logSize_) + " bytes, " +
+                                   std::to_string(written) + " entries");
+    return true;
+#endif
+}
+
+long TranslationMemory::exportTo(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (logFd_ < 0 || !index_) {
+        return -1;
+    }
+
+    size_t written = 0;
+    if (!writeCompactedLog(path, written)) {
+        return -1;
+    }
+    return static_cast<long>(written);
+}
+
+long TranslationMemory::importFrom(const std::string& path, bool overwrite) {
+#ifdef _WIN32
+    (void)path;
+    (void)overwrite;
+    return -1;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        speechrnt::utils::Logger::error("Failed to open translation memory export: " + path);
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (logFd_ < 0 || !index_) {
+        ::close(fd);
+        return -1;
+    }
+
+    long imported = 0;
+    uint64_t offset = 0;
+    std::string key;
+    Entry entry;
+    uint64_t next = 0;
+    while (readRecord(fd, offset, key, entry, &next)) {
+        offset = next;
+
+        uint64_t hash = hashKey(key);
+        size_t slot = 0;
+        bool found = false;
+        if (!findSlot(key, hash, slot, found) || (found && !overwrite)) {
+            continue;
+        }
+
+        uint64_t appended = 0;
+        if (!appendRecord(key, entry, appended) || !insertIndex(key, hash, appended)) {
+            ::close(fd);
+            return -1;
+        }
+        imported++;
+    }
+    ::close(fd);
+
+    if (!syncWrites_) {
+        ::fdatasync(logFd_);
+    }
+
+    speechrnt::utils::Logger::info("Imported " + std::to_string(imported) +
+                                   " translation memory entries from " + path);
+    return imported;
+#endif
+}
+
+TranslationMemory::Statistics TranslationMemory::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Statistics stats;
+    stats.entryCount = index_ && index_->isValid() ? index_->header()->count : 0;
+    stats.logBytes = logSize_;
+    stats.staleBytes = staleBytes_;
+    stats.lookups = lookups_.load();
+    stats.hits = hits_.load();
+    return stats;
+}
+
+std::string TranslationMemory::normalizeText(const std::string& text) {
+    std::string normalized;
+    normalized.reserve(text.size());
+
+    bool pendingSpace = false;
+    for (unsigned char c : text) {
+        if (std::isspace(c)) {
+            pendingSpace = !normalized.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            normalized.push_back(' ');
+            pendingSpace = false;
+        }
+        // Only ASCII is folded; multi-byte UTF-8 sequences pass through untouched
+        normalized.push_back(c < 0x80 ? static_cast<char>(std::tolower(c)) : static_cast<char>(c));
+    }
+    return normalized;
+}
+
+// Private helpers
+
+std::string TranslationMemory::makeKey(const std::string& sourceText, const std::string& sourceLang,
+                                       const std::string& targetLang, const std::string& modelVersion) const {
+    std::string key;
+    key.reserve(sourceLang.size() + targetLang.size() + modelVersion.size() + sourceText.size() + 3);
+    key += sourceLang;
+    key += KEY_SEPARATOR;
+    key += targetLang;
+    key += KEY_SEPARATOR;
+    key += modelVersion;
+    key += KEY_SEPARATOR;
+    key += normalizeText(sourceText);
+    return key;
+}
+
+uint64_t TranslationMemory::hashKey(const std::string& key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : key) {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+    return hash;
+}
+
+bool TranslationMemory::openLog(const std::string& path) {
+#ifndef _WIN32
+    logFd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (logFd_ < 0) {
+        return false;
+    }
+    struct stat st;
+    if (::fstat(logFd_, &st) != 0) {
+        ::close(logFd_);
+        logFd_ = -1;
+        return false;
+    }
+    logSize_ = static_cast<uint64_t>(st.st_size);
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+bool TranslationMemory::appendRecord(const std::string& key, const Entry& entry, uint64_t& offset) {
+#ifndef _WIN32
+    RecordHeader header;
+    header.magic = RECORD_MAGIC;
+    header.keyLength = static_cast<uint32_t>(key.size());
+    header.valueLength = static_cast<uint32_t>(entry.translatedText.size());
+    header.confidence = entry.confidence;
+    header.checksum = checksum(key, entry.translatedText);
+
+    // Assemble the record so it reaches the log in a single write
+    std::string record;
+    record.reserve(sizeof(header) + key.size() + entry.translatedText.size());
+    record.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    record.append(key);
+    record.append(entry.translatedText);
+
+    offset = logSize_;
+    if (!writeFully(logFd_, record.data(), record.size())) {
+        speechrnt::utils::Logger::error("Failed to append translation memory record");
+        return false;
+    }
+    if (syncWrites_) {
+        ::fdatasync(logFd_);
+    }
+    logSize_ += record.size();
+    return true;
+#else
+    (void)key;
+    (void)entry;
+    (void)offset;
+    return false;
+#endif
+}
+
+bool TranslationMemory::readRecord(int fd, uint64_t offset, std::string& key, Entry& entry,
+                                   uint64_t* nextOffset) const {
+#ifndef _WIN32
+    RecordHeader header;
+    if (!readFully(fd, offset, &header, sizeof(header))) {
+        return false;
+    }
+    if (header.magic != RECORD_MAGIC || header.keyLength > MAX_FIELD_LENGTH ||
+        header.valueLength > MAX_FIELD_LENGTH) {
+        return false;
+    }
+
+    key.resize(header.keyLength);
+    entry.translatedText.resize(header.valueLength);
+    uint64_t dataOffset = offset + sizeof(header);
+    if ((header.keyLength > 0 && !readFully(fd, dataOffset, &key[0], header.keyLength)) ||
+        (header.valueLength > 0 &&
+         !readFully(fd, dataOffset + header.keyLength, &entry.translatedText[0], header.valueLength))) {
+        return false;
+    }
+    if (checksum(key, entry.translatedText) != header.checksum) {
+        return false;
+    }
+
+    entry.confidence = header.confidence;
+    if (nextOffset) {
+        *nextOffset = dataOffset + header.keyLength + header.valueLength;
+    }
+    return true;
+#else
+    (void)fd;
+    (void)offset;
+    (void)key;
+    (void)entry;
+    (void)nextOffset;
+    return false;
+#endif
+}
+
+bool TranslationMemory::rebuildIndex() {
+#ifndef _WIN32
+    // Size the index from the log so a full rebuild never has to grow it
+    uint64_t estimatedRecords = logSize_ / (sizeof(RecordHeader) + 32);
+    uint64_t capacity = nextPowerOfTwo(static_cast<uint64_t>(estimatedRecords / MAX_INDEX_LOAD) + 1);
+
+    auto fresh = std::make_unique<MappedIndex>();
+    if (!fresh->create(indexPath_, capacity)) {
+        return false;
+    }
+    index_ = std::move(fresh);
+    staleBytes_ = 0;
+
+    uint64_t offset = 0;
+    std::string key;
+    Entry entry;
+    uint64_t next = 0;
+    while (offset < logSize_ && readRecord(logFd_, offset, key, entry, &next)) {
+        if (!insertIndex(key, hashKey(key), offset)) {
+            return false;
+        }
+        offset = next;
+    }
+
+    if (offset < logSize_) {
+        speechrnt::utils::Logger::warn("Discarding " + std::to_string(logSize_ - offset) +
+                                       " unreadable bytes at end of translation memory log");
+        if (::ftruncate(logFd_, static_cast<off_t>(offset)) == 0) {
+            logSize_ = offset;
+        }
+    }
+
+    index_->header()->logSize = logSize_;
+    index_->header()->staleBytes = staleBytes_;
+    index_->sync();
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool TranslationMemory::findSlot(const std::string& key, uint64_t hash, size_t& slot, bool& found) const {
+    const IndexSlot* slots = index_->slots();
+    uint64_t mask = index_->capacity() - 1;
+
+    for (uint64_t probe = 0; probe <= mask; ++probe) {
+        size_t i = static_cast<size_t>((hash + probe) & mask);
+        if (slots[i].offsetPlusOne == 0) {
+            slot = i;
+            found = false;
+            return true;
+        }
+        if (slots[i].hash != hash) {
+            continue;
+        }
+
+        std::string storedKey;
+        Entry storedEntry;
+        if (readRecord(logFd_, slots[i].offsetPlusOne - 1, storedKey, storedEntry) && storedKey == key) {
+            slot = i;
+            found = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TranslationMemory::insertIndex(const std::string& key, uint64_t hash, uint64_t offset) {
+    IndexHeader* header = index_->header();
+    if (static_cast<double>(header->count + 1) > static_cast<double>(header->capacity) * MAX_INDEX_LOAD) {
+        if (!growIndex()) {
+            return false;
+        }
+        header = index_->header();
+    }
+
+    size_t slot = 0;
+    bool found = false;
+    if (!findSlot(key, hash, slot, found)) {
+        return false;
+    }
+
+    IndexSlot& target = index_->slots()[slot];
+    if (found) {
+        std::string oldKey;
+        Entry oldEntry;
+        if (readRecord(logFd_, target.offsetPlusOne - 1, oldKey, oldEntry)) {
+            staleBytes_ += sizeof(RecordHeader) + oldKey.size() + oldEntry.translatedText.size();
+        }
+    } else {
+        header->count++;
+    }
+    target.hash = hash;
+    target.offsetPlusOne = offset + 1;
+
+    header->logSize = logSize_;
+    header->staleBytes = staleBytes_;
+    return true;
+}
+
+bool TranslationMemory::growIndex() {
+    uint64_t newCapacity = index_->capacity() * 2;
+    std::string tmpPath = indexPath_ + ".grow";
+
+    auto grown = std::make_unique<MappedIndex>();
+    if (!grown->create(tmpPath, newCapacity)) {
+        return false;
+    }
+
+    // Stored hashes make rehashing independent of the log
+    const IndexSlot* oldSlots = index_->slots();
+    IndexSlot* newSlots = grown->slots();
+    uint64_t mask = newCapacity - 1;
+    for (uint64_t i = 0; i < index_->capacity(); ++i) {
+        if (oldSlots[i].offsetPlusOne == 0) {
+            continue;
+        }
+        uint64_t pos = oldSlots[i].hash & mask;
+        while (newSlots[pos].offsetPlusOne != 0) {
+            pos = (pos + 1) & mask;
+        }
+        newSlots[pos] = oldSlots[i];
+    }
+    grown->header()->count = index_->header()->count;
+    grown->header()->logSize = index_->header()->logSize;
+    grown->header()->staleBytes = index_->header()->staleBytes;
+    grown->sync();
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, indexPath_, ec);
+    if (ec) {
+        std::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+    index_ = std::move(grown);
+    return true;
+}
+
+bool TranslationMemory::writeCompactedLog(const std::string& path, size_t& written) const {
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        speechrnt::utils::Logger::error("Failed to create translation memory file: " + path);
+        return false;
+    }
+
+    written = 0;
+    size_t dropped = 0;
+    const IndexSlot* slots = index_->slots();
+    for (uint64_t i = 0; i < index_->capacity(); ++i) {
+        if (slots[i].offsetPlusOne == 0) {
+            continue;
+        }
+
+        std::string key;
+        Entry entry;
+        if (!readRecord(logFd_, slots[i].offsetPlusOne - 1, key, entry)) {
+            dropped++;
+            continue;
+        }
+
+        RecordHeader header;
+        header.magic = RECORD_MAGIC;
+        header.keyLength = static_cast<uint32_t>(key.size());
+        header.valueLength = static_cast<uint32_t>(entry.translatedText.size());
+        header.confidence = entry.confidence;
+        header.checksum = checksum(key, entry.translatedText);
+
+        if (!writeFully(fd, &header, sizeof(header)) || !writeFully(fd, key.data(), key.size()) ||
+            !writeFully(fd, entry.translatedText.data(), entry.translatedText.size())) {
+            ::close(fd);
+            return false;
+        }
+        written++;
+    }
+
+    if (dropped > 0) {
+        speechrnt::utils::Logger::warn("Dropped " + std::to_string(dropped) +
+                                       " unreadable translation memory records writing " + path);
+    }
+
+    bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#else
+    (void)path;
+    (void)written;
+    return false;
+#endif
+}
+
+} // namespace mt
+} // namespace speechrnt
@@ -1,5 +1,6 @@
 #include "stt/advanced/adaptive_quality_manager.hpp"
 #include "utils/logging.hpp"
+#include "utils/system_resource_sampler.hpp"
 #include <algorithm>
 #include <numeric>
 #include <cmath>
@@ -11,9 +12,6 @@
 #include <psapi.h>
 #include <pdh.h>
 #elif __linux__
-#include <sys/sysinfo.h>
-#include <sys/statvfs.h>
-#include <fstream>
 #include <unistd.h>
 #elif __APPLE__
 #include <sys/types.h>
@@ -28,6 +26,7 @@ namespace advanced {
 ResourceMonitorImpl::ResourceMonitorImpl()
     : initialized_(false)
     , monitoring_(false)
+    , monitoringTimer_(speechrnt::utils::TimerService::INVALID_TIMER)
     , cpuThreshold_(0.8f)
     , memoryThreshold_(0.8f)
     , gpuThreshold_(0.8f)
@@ -88,7 +87,9 @@ bool ResourceMonitorImpl::startMonitoring(int intervalMs) {
     monitoringIntervalMs_ = intervalMs;
     monitoring_ = true;
     
-    monitoringThread_ = std::thread(&ResourceMonitorImpl::monitoringLoop, this);
+    speechrnt::utils::SystemResourceSampler::getInstance().ensureStarted(std::chrono::milliseconds(intervalMs));
+    monitoringTimer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+        "stt.resource_monitor", std::chrono::milliseconds(intervalMs), [this]() { sampleResources(); }, true);
     
     speechrnt::utils::Logger::info("ResourceMonitor started with interval: " + std::to_string(intervalMs) + "ms");
     return true;
@@ -100,11 +101,8 @@ void ResourceMonitorImpl::stopMonitoring() {
     }
     
     monitoring_ = false;
-    monitoringCondition_.notify_all();
-    
-    if (monitoringThread_.joinable()) {
-        monitoringThread_.join();
-    }
+    speechrnt::utils::TimerService::getInstance().cancel(monitoringTimer_);
+    monitoringTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
     
     speechrnt::utils::Logger::info("ResourceMonitor stopped");
 }
@@ -143,24 +141,18 @@ bool ResourceMonitorImpl::isInitialized() const {
     return initialized_;
 }
 
-void ResourceMonitorImpl::monitoringLoop() {
-    std::unique_lock<std::mutex> lock(resourceMutex_);
+void ResourceMonitorImpl::sampleResources() {
+    std::lock_guard<std::mutex> lock(resourceMutex_);
     
-    while (monitoring_) {
-        // Collect resources
-        SystemResources resources = collectSystemResources();
-        currentResources_ = resources;
-        lastUpdate_ = std::chrono::steady_clock::now();
-        
-        // Add to history
-        resourceHistory_.push_back(resources);
-        if (resourceHistory_.size() > MAX_HISTORY_SIZE) {
-            resourceHistory_.pop_front();
-        }
-        
-        // Wait for next interval
-        monitoringCondition_.wait_for(lock, std::chrono::milliseconds(monitoringIntervalMs_),
-                                     [this] { return !monitoring_; });
+    // Collect resources
+    SystemResources resources = collectSystemResources();
+    currentResources_ = resources;
+    lastUpdate_ = std::chrono::steady_clock::now();
+    
+    // Add to history
+    resourceHistory_.push_back(resources);
+    if (resourceHistory_.size() > MAX_HISTORY_SIZE) {
+        resourceHistory_.pop_front();
     }
 }
 
@@ -225,42 +217,7 @@ float ResourceMonitorImpl::getCpuUsage() {
     return static_cast<float>(std::clamp(percent, 0.0, 1.0));
     
 #elif __linux__
-    static unsigned long long lastTotalUser = 0, lastTotalUserLow = 0, lastTotalSys = 0, lastTotalIdle = 0;
-    
-    std::ifstream file("/proc/stat");
-    if (!file.is_open()) {
-        return 0.0f;
-    }
-    
-    std::string line;
-    std::getline(file, line);
-    file.close();
-    
-    std::istringstream iss(line);
-    std::string cpu;
-    unsigned long long totalUser, totalUserLow, totalSys, totalIdle;
-    
-    iss >> cpu >> totalUser >> totalUserLow >> totalSys >> totalIdle;
-    
-    if (lastTotalUser == 0) {
-        lastTotalUser = totalUser;
-        lastTotalUserLow = totalUserLow;
-        lastTotalSys = totalSys;
-        lastTotalIdle = totalIdle;
-        return 0.0f;
-    }
-    
-    unsigned long long total = (totalUser - lastTotalUser) + (totalUserLow - lastTotalUserLow) + (totalSys - lastTotalSys);
-    unsigned long long totalTime = total + (totalIdle - lastTotalIdle);
-    
-    float percent = totalTime > 0 ? static_cast<float>(total) / totalTime : 0.0f;
-    
-    lastTotalUser = totalUser;
-    lastTotalUserLow = totalUserLow;
-    lastTotalSys = totalSys;
-    lastTotalIdle = totalIdle;
-    
-    return std::clamp(percent, 0.0f, 1.0f);
+    return speechrnt::utils::SystemResourceSampler::getInstance().getSnapshot().cpuUsage;
     
 #else
     // Simplified implementation for other platforms
@@ -276,14 +233,7 @@ float ResourceMonitorImpl::getMemoryUsage() {
     return static_cast<float>(memInfo.dwMemoryLoad) / 100.0f;
     
 #elif __linux__
-    struct sysinfo memInfo;
-    sysinfo(&memInfo);
-    
-    unsigned long totalMem = memInfo.totalram * memInfo.mem_unit;
-    unsigned long freeMem = memInfo.freeram * memInfo.mem_unit;
-    unsigned long usedMem = totalMem - freeMem;
-    
-    return static_cast<float>(usedMem) / totalMem;
+    return speechrnt::utils::SystemResourceSampler::getInstance().getSnapshot().memoryUsage;
     
 #else
     // Simplified implementation for other platforms
@@ -306,14 +256,7 @@ float ResourceMonitorImpl::getDiskUsage() {
     return 0.0f;
     
 #elif __linux__
-    struct statvfs stat;
-    if (statvfs("/", &stat) == 0) {
-        unsigned long long total = stat.f_blocks * stat.f_frsize;
-        unsigned long long free = stat.f_bavail * stat.f_frsize;
-        unsigned long long used = total - free;
-        return static_cast<float>(used) / total;
-    }
-    return 0.0f;
+    return speechrnt::utils::SystemResourceSampler::getInstance().getSnapshot().diskUsage;
     
 #else
     return 0.5f;
@@ -335,11 +278,9 @@ void ResourceMonitorImpl::getMemoryInfo(size_t& available, size_t& total) {
     available = static_cast<size_t>(memInfo.ullAvailPhys / (1024 * 1024));
     
 #elif __linux__
-    struct sysinfo memInfo;
-    sysinfo(&memInfo);
-    
-    total = static_cast<size_t>((memInfo.totalram * memInfo.mem_unit) / (1024 * 1024));
-    available = static_cast<size_t>((memInfo.freeram * memInfo.mem_unit) / (1024 * 1024));
+    auto snapshot = speechrnt::utils::SystemResourceSampler::getInstance().getSnapshot();
+    total = static_cast<size_t>(snapshot.totalMemoryMB);
+    available = static_cast<size_t>(snapshot.availableMemoryMB);
     
 #else
     total = 8192; // 8GB default
@@ -779,6 +720,7 @@ AdaptiveQualityManager::AdaptiveQualityManager()
     : initialized_(false)
     , adaptiveMode_(true)
     , adaptationLoopRunning_(false)
+    , adaptationTimer_(speechrnt::utils::TimerService::INVALID_TIMER)
     , adaptationIntervalMs_(1000.0f)
     , lastAdaptation_(std::chrono::steady_clock::now()) {
 }
@@ -974,6 +916,10 @@ void AdaptiveQualityManager::setResourceThresholds(float cpuThreshold, float mem
 
 void AdaptiveQualityManager::setAdaptationInterval(float intervalMs) {
     adaptationIntervalMs_ = intervalMs;
+    if (adaptationLoopRunning_) {
+        speechrnt::utils::TimerService::getInstance().reschedule(
+            adaptationTimer_, std::chrono::milliseconds(static_cast<int>(intervalMs)));
+    }
     
     std::lock_guard<std::mutex> lock(managerMutex_);
     config_.adaptationIntervalMs = intervalMs;
@@ -1063,10 +1009,11 @@ std::string AdaptiveQualityManager::getLastError() const {
 }
 
 void AdaptiveQualityManager::reset() {
-    std::lock_guard<std::mutex> lock(managerMutex_);
-    
+    // Stop before locking: cancelling waits for an adaptation cycle, which takes the lock
     stopAdaptationLoop();
     
+    std::lock_guard<std::mutex> lock(managerMutex_);
+    
     // Reset statistics
     stats_ = AdaptationStats{};
     
@@ -1088,7 +1035,9 @@ void AdaptiveQualityManager::startAdaptationLoop() {
     }
     
     adaptationLoopRunning_ = true;
-    adaptationThread_ = std::thread(&AdaptiveQualityManager::adaptationLoop, this);
+    adaptationTimer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+        "stt.quality_adaptation", std::chrono::milliseconds(static_cast<int>(adaptationIntervalMs_)),
+        [this]() { runAdaptationCycle(); }, true);
     
     speechrnt::utils::Logger::info("Adaptation loop started");
 }
@@ -1099,53 +1048,44 @@ void AdaptiveQualityManager::stopAdaptationLoop() {
     }
     
     adaptationLoopRunning_ = false;
-    adaptationCondition_.notify_all();
-    
-    if (adaptationThread_.joinable()) {
-        adaptationThread_.join();
-    }
+    speechrnt::utils::TimerService::getInstance().cancel(adaptationTimer_);
+    adaptationTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
     
     speechrnt::utils::Logger::info("Adaptation loop stopped");
 }
 
-void AdaptiveQualityManager::adaptationLoop() {
-    std::unique_lock<std::mutex> lock(managerMutex_);
+void AdaptiveQualityManager::runAdaptationCycle() {
+    std::lock_guard<std::mutex> lock(managerMutex_);
     
-    while (adaptationLoopRunning_) {
-        try {
-            // Get current resources
-            SystemResources resources = resourceMonitor_->getCurrentResources();
+    try {
+        // Get current resources
+        SystemResources resources = resourceMonitor_->getCurrentResources();
+        
+        // Check if adaptation is needed
+        if (shouldAdapt(resources)) {
+            std::vector<TranscriptionRequest> emptyRequests; // Would get actual requests in real implementation
+            QualitySettings newSettings = adaptationEngine_->adaptQuality(currentSettings_, resources, emptyRequests);
             
-            // Check if adaptation is needed
-            if (shouldAdapt(resources)) {
-                std::vector<TranscriptionRequest> emptyRequests; // Would get actual requests in real implementation
-                QualitySettings newSettings = adaptationEngine_->adaptQuality(currentSettings_, resources, emptyRequests);
+            if (newSettings.level != currentSettings_.level) {
+                logAdaptation(currentSettings_, newSettings, "Automatic adaptation based on resource monitoring");
+                updateCurrentSettings(newSettings);
                 
-                if (newSettings.level != currentSettings_.level) {
-                    logAdaptation(currentSettings_, newSettings, "Automatic adaptation based on resource monitoring");
-                    updateCurrentSettings(newSettings);
-                    
-                    // Record performance prediction
-                    if (performancePredictor_) {
-                        PerformancePrediction prediction = performancePredictor_->predictPerformance(newSettings, resources, 16000);
-                        performanceHistory_.push_back({newSettings, prediction});
-                        if (performanceHistory_.size() > MAX_PERFORMANCE_HISTORY) {
-                            performanceHistory_.pop_front();
-                        }
+                // Record performance prediction
+                if (performancePredictor_) {
+                    PerformancePrediction prediction = performancePredictor_->predictPerformance(newSettings, resources, 16000);
+                    performanceHistory_.push_back({newSettings, prediction});
+                    if (performanceHistory_.size() > MAX_PERFORMANCE_HISTORY) {
+                        performanceHistory_.pop_front();
                     }
                 }
-                
-                lastAdaptation_ = std::chrono::steady_clock::now();
             }
             
-        } catch (const std::exception& e) {
-            lastError_ = "Adaptation loop error: " + std::string(e.what());
-            speechrnt::utils::Logger::error(lastError_);
+            lastAdaptation_ = std::chrono::steady_clock::now();
         }
         
-        // Wait for next adaptation interval
-        adaptationCondition_.wait_for(lock, std::chrono::milliseconds(static_cast<int>(adaptationIntervalMs_)),
-                                     [this] { return !adaptationLoopRunning_; });
+    } catch (const std::exception& e) {
+        lastError_ = "Adaptation loop error: " + std::string(e.what());
+        speechrnt::utils::Logger::error(lastError_);
     }
 }
 
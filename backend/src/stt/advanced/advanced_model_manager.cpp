@@ -15,17 +15,17 @@ namespace advanced {
 AdvancedModelManager::AdvancedModelManager(std::shared_ptr<models::ModelManager> baseModelManager)
     : baseModelManager_(baseModelManager) {
     
-    // Start background processing thread
-    backgroundThread_ = std::thread(&AdvancedModelManager::backgroundProcessingLoop, this);
+    // Run background processing every minute on the shared timer service
+    backgroundTimer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+        "advanced_model_manager.background", std::chrono::seconds(60),
+        [this]() { runBackgroundProcessing(); }, true);
     
     speechrnt::utils::Logger::info("AdvancedModelManager initialized");
 }
 
 AdvancedModelManager::~AdvancedModelManager() {
     backgroundProcessingEnabled_ = false;
-    if (backgroundThread_.joinable()) {
-        backgroundThread_.join();
-    }
+    speechrnt::utils::TimerService::getInstance().cancel(backgroundTimer_);
     
     speechrnt::utils::Logger::info("AdvancedModelManager destroyed");
 }
@@ -592,27 +592,25 @@ void AdvancedModelManager::processABTestResults() {
     }
 }
 
-void AdvancedModelManager::backgroundProcessingLoop() {
-    while (backgroundProcessingEnabled_) {
-        try {
-            // Process A/B test results
-            {
-                std::lock_guard<std::mutex> lock(abTestMutex_);
-                processABTestResults();
-            }
-            
-            // Check for performance degradation
-            checkPerformanceDegradation();
-            
-            // Clean up old metrics
-            cleanupOldMetrics();
-            
-            // Sleep for 60 seconds before next iteration
-            std::this_thread::sleep_for(std::chrono::seconds(60));
-        } catch (const std::exception& e) {
-            speechrnt::utils::Logger::error("Error in background processing: " + std::string(e.what()));
-            std::this_thread::sleep_for(std::chrono::seconds(10));
+void AdvancedModelManager::runBackgroundProcessing() {
+    if (!backgroundProcessingEnabled_) {
+        return;
+    }
+    
+    try {
+        // Process A/B test results
+        {
+            std::lock_guard<std::mutex> lock(abTestMutex_);
+            processABTestResults();
         }
+        
+        // Check for performance degradation
+        checkPerformanceDegradation();
+        
+        // Clean up old metrics
+        cleanupOldMetrics();
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("Error in background processing: " + std::string(e.what()));
     }
 }
 
@@ -0,0 +1,1280 @@
+#include "stt/advanced/advanced_processing_pipeline.hpp"
+#include "core/task_queue.hpp"
+#include "utils/logging.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+namespace stt {
+namespace advanced {
+
+namespace {
+
+constexpr size_t NO_STAGE = std::numeric_limits<size_t>::max();
+
+float elapsedMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+const char* stageName(PipelineStage stage) {
+    switch (stage) {
+        case PipelineStage::AUDIO_PREPROCESSING: return "audio_preprocessing";
+        case PipelineStage::REALTIME_ANALYSIS: return "realtime_analysis";
+        case PipelineStage::QUALITY_ADAPTATION: return "quality_adaptation";
+        case PipelineStage::SPEAKER_DIARIZATION: return "speaker_diarization";
+        case PipelineStage::EMOTION_ANALYSIS: return "emotion_analysis";
+        case PipelineStage::TRANSCRIPTION: return "transcription";
+        case PipelineStage::CONTEXTUAL_ENHANCEMENT: return "contextual_enhancement";
+        case PipelineStage::EXTERNAL_SERVICE_FUSION: return "external_service_fusion";
+        case PipelineStage::RESULT_FINALIZATION: return "result_finalization";
+    }
+    return "unknown";
+}
+
+const PipelineStage ALL_STAGES[] = {
+    PipelineStage::AUDIO_PREPROCESSING,
+    PipelineStage::REALTIME_ANALYSIS,
+    PipelineStage::QUALITY_ADAPTATION,
+    PipelineStage::SPEAKER_DIARIZATION,
+    PipelineStage::EMOTION_ANALYSIS,
+    PipelineStage::TRANSCRIPTION,
+    PipelineStage::CONTEXTUAL_ENHANCEMENT,
+    PipelineStage::EXTERNAL_SERVICE_FUSION,
+    PipelineStage::RESULT_FINALIZATION
+};
+
+bool featureRequested(const AudioProcessingRequest& request, bool flag) {
+    return flag || request.enableAllFeatures;
+}
+
+// Result handed back through an engine callback, waited on with a deadline
+template <typename T>
+struct CallbackResult {
+    std::mutex mutex;
+    std::condition_variable ready;
+    bool done = false;
+    T value;
+
+    void set(const T& result) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (done) {
+                return;
+            }
+            value = result;
+            done = true;
+        }
+        ready.notify_all();
+    }
+
+    bool waitFor(float timeoutMs) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return ready.wait_for(lock, std::chrono::duration<float, std::milli>(timeoutMs), [this] { return done; });
+    }
+};
+
+// Stage wrapping one component; the cost model is fixed cost plus cost per audio second
+class ComponentStage : public PipelineStageProcessor {
+public:
+    ComponentStage(PipelineStage stage, std::vector<PipelineData> inputs, std::vector<PipelineData> outputs,
+                   float fixedMs, float msPerAudioSecond)
+        : stage_(stage)
+        , inputs_(std::move(inputs))
+        , outputs_(std::move(outputs))
+        , fixedMs_(fixedMs)
+        , msPerAudioSecond_(msPerAudioSecond) {}
+
+    PipelineStage getStageType() const override { return stage_; }
+    std::vector<PipelineStage> getStageDependencies() const override { return {}; }
+    std::vector<PipelineData> getStageInputs() const override { return inputs_; }
+    std::vector<PipelineData> getStageOutputs() const override { return outputs_; }
+
+    bool validatePrerequisites(const PipelineExecutionContext& context) const override {
+        return !context.processedAudio.empty();
+    }
+
+    float getEstimatedProcessingTime(const PipelineExecutionContext& context) const override {
+        float seconds = static_cast<float>(context.originalAudio.size()) / std::max(1, context.sampleRate);
+        return fixedMs_ + msPerAudioSecond_ * seconds;
+    }
+
+    std::string getLastError() const override {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        return lastError_;
+    }
+
+protected:
+    PipelineStageResult succeed() const {
+        return PipelineStageResult(stage_, true, 0.0f);
+    }
+
+    PipelineStageResult fail(const std::string& error) {
+        {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            lastError_ = error;
+        }
+        PipelineStageResult result(stage_, false, 0.0f);
+        result.errorMessage = error;
+        return result;
+    }
+
+private:
+    PipelineStage stage_;
+    std::vector<PipelineData> inputs_;
+    std::vector<PipelineData> outputs_;
+    float fixedMs_;
+    float msPerAudioSecond_;
+    mutable std::mutex errorMutex_;
+    std::string lastError_;
+};
+
+class AudioPreprocessingStage : public ComponentStage {
+public:
+    explicit AudioPreprocessingStage(std::shared_ptr<AudioPreprocessorInterface> preprocessor)
+        : ComponentStage(PipelineStage::AUDIO_PREPROCESSING, {PipelineData::ORIGINAL_AUDIO},
+                         {PipelineData::PROCESSED_AUDIO, PipelineData::AUDIO_QUALITY}, 0.5f, 5.0f)
+        , preprocessor_(std::move(preprocessor)) {}
+
+    bool canSkipStage(const PipelineExecutionContext& context) const override {
+        return !preprocessor_ || !featureRequested(context.originalRequest, context.originalRequest.enableAudioPreprocessing);
+    }
+
+    bool validatePrerequisites(const PipelineExecutionContext& context) const override {
+        return !context.originalAudio.empty();
+    }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        PreprocessingResult processed = preprocessor_->preprocessAudio(context.originalAudio, context.sampleRate);
+        if (!processed.processingSuccessful) {
+            return fail(processed.processingInfo.empty() ? "Audio preprocessing failed" : processed.processingInfo);
+        }
+        if (!processed.processedAudio.empty()) {
+            context.processedAudio = std::move(processed.processedAudio);
+        }
+        context.audioQuality = processed.qualityMetrics;
+        context.appliedPreprocessing = processed.appliedFilters;
+
+        PipelineStageResult result = succeed();
+        result.stageMetadata["appliedFilters"] = std::to_string(processed.appliedFilters.size());
+        return result;
+    }
+
+    bool isInitialized() const override { return preprocessor_ && preprocessor_->isInitialized(); }
+
+private:
+    std::shared_ptr<AudioPreprocessorInterface> preprocessor_;
+};
+
+class RealTimeAnalysisStage : public ComponentStage {
+public:
+    explicit RealTimeAnalysisStage(std::shared_ptr<RealTimeAudioAnalyzerInterface> analyzer)
+        : ComponentStage(PipelineStage::REALTIME_ANALYSIS, {PipelineData::PROCESSED_AUDIO},
+                         {PipelineData::REALTIME_METRICS}, 0.2f, 2.0f)
+        , analyzer_(std::move(analyzer)) {}
+
+    bool canSkipStage(const PipelineExecutionContext& context) const override {
+        return !analyzer_ || !featureRequested(context.originalRequest, context.originalRequest.enableRealTimeAnalysis);
+    }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        analyzer_->processAudioChunk(context.processedAudio);
+        context.realtimeMetrics = analyzer_->getCurrentMetrics();
+        return succeed();
+    }
+
+    bool isInitialized() const override { return analyzer_ && analyzer_->isInitialized(); }
+
+private:
+    std::shared_ptr<RealTimeAudioAnalyzerInterface> analyzer_;
+};
+
+class QualityAdaptationStage : public ComponentStage {
+public:
+    explicit QualityAdaptationStage(std::shared_ptr<AdaptiveQualityManagerInterface> qualityManager)
+        : ComponentStage(PipelineStage::QUALITY_ADAPTATION, {PipelineData::ORIGINAL_AUDIO},
+                         {PipelineData::QUALITY_SETTINGS}, 0.5f, 0.0f)
+        , qualityManager_(std::move(qualityManager)) {}
+
+    bool canSkipStage(const PipelineExecutionContext& context) const override {
+        return !qualityManager_ || !featureRequested(context.originalRequest, context.originalRequest.enableAdaptiveQuality);
+    }
+
+    bool validatePrerequisites(const PipelineExecutionContext&) const override { return true; }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        const AudioProcessingRequest& request = context.originalRequest;
+        TranscriptionRequest pending;
+        pending.requestId = context.utteranceId;
+        pending.audioLength = context.originalAudio.size();
+        pending.isRealTime = context.isRealTime;
+        pending.requestedQuality = request.preferredQuality;
+        pending.maxLatencyMs = request.maxLatencyMs;
+        pending.language = request.languageHint;
+        pending.enableAdvancedFeatures = request.enableAllFeatures;
+
+        context.qualitySettings = qualityManager_->adaptQuality(qualityManager_->getCurrentResources(), {pending});
+        return succeed();
+    }
+
+    bool isInitialized() const override { return qualityManager_ && qualityManager_->isInitialized(); }
+
+private:
+    std::shared_ptr<AdaptiveQualityManagerInterface> qualityManager_;
+};
+
+class SpeakerDiarizationStage : public ComponentStage {
+public:
+    explicit SpeakerDiarizationStage(std::shared_ptr<SpeakerDiarizationInterface> speakerEngine)
+        : ComponentStage(PipelineStage::SPEAKER_DIARIZATION, {PipelineData::PROCESSED_AUDIO},
+                         {PipelineData::SPEAKER_INFO}, 2.0f, 50.0f)
+        , speakerEngine_(std::move(speakerEngine)) {}
+
+    bool canSkipStage(const PipelineExecutionContext& context) const override {
+        return !speakerEngine_ ||
+               !featureRequested(context.originalRequest, context.originalRequest.enableSpeakerDiarization);
+    }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        context.speakerInfo = speakerEngine_->processSpeakerDiarization(context.processedAudio, context.sampleRate);
+        PipelineStageResult result = succeed();
+        result.stageMetadata["speakers"] = std::to_string(context.speakerInfo.totalSpeakers);
+        return result;
+    }
+
+    bool isInitialized() const override { return speakerEngine_ && speakerEngine_->isInitialized(); }
+
+private:
+    std::shared_ptr<SpeakerDiarizationInterface> speakerEngine_;
+};
+
+class EmotionAnalysisStage : public ComponentStage {
+public:
+    explicit EmotionAnalysisStage(std::shared_ptr<EmotionDetector> emotionDetector)
+        : ComponentStage(PipelineStage::EMOTION_ANALYSIS, {PipelineData::PROCESSED_AUDIO},
+                         {PipelineData::EMOTION}, 1.0f, 20.0f)
+        , emotionDetector_(std::move(emotionDetector)) {}
+
+    bool canSkipStage(const PipelineExecutionContext& context) const override {
+        return !emotionDetector_ || !emotionDetector_->isInitialized() ||
+               !featureRequested(context.originalRequest, context.originalRequest.enableEmotionAnalysis);
+    }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        context.emotion = emotionDetector_->detectEmotionFromAudio(context.processedAudio, context.sampleRate);
+        return succeed();
+    }
+
+    bool isInitialized() const override { return emotionDetector_ && emotionDetector_->isInitialized(); }
+
+private:
+    std::shared_ptr<EmotionDetector> emotionDetector_;
+};
+
+class TranscriptionStage : public ComponentStage {
+public:
+    explicit TranscriptionStage(std::shared_ptr<STTInterface> stt)
+        : ComponentStage(PipelineStage::TRANSCRIPTION,
+                         {PipelineData::PROCESSED_AUDIO, PipelineData::QUALITY_SETTINGS},
+                         {PipelineData::BASE_TRANSCRIPTION}, 5.0f, 300.0f)
+        , stt_(std::move(stt)) {}
+
+    bool canSkipStage(const PipelineExecutionContext&) const override { return !stt_; }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        if (context.qualitySettings.maxTokens > 0) {
+            stt_->setTemperature(context.qualitySettings.temperatureSetting);
+            stt_->setMaxTokens(context.qualitySettings.maxTokens);
+        }
+
+        auto transcript = std::make_shared<CallbackResult<TranscriptionResult>>();
+        stt_->transcribe(context.processedAudio, [transcript](const TranscriptionResult& result) {
+            if (!result.is_partial) {
+                transcript->set(result);
+            }
+        });
+
+        if (!transcript->waitFor(context.stageTimeoutMs)) {
+            return fail("Transcription timed out");
+        }
+        std::lock_guard<std::mutex> lock(transcript->mutex);
+        context.baseTranscription = transcript->value;
+        return succeed();
+    }
+
+    bool isInitialized() const override { return stt_ && stt_->isInitialized(); }
+
+private:
+    std::shared_ptr<STTInterface> stt_;
+};
+
+class ContextualEnhancementStage : public ComponentStage {
+public:
+    explicit ContextualEnhancementStage(std::shared_ptr<ContextualTranscriberInterface> transcriber)
+        : ComponentStage(PipelineStage::CONTEXTUAL_ENHANCEMENT, {PipelineData::BASE_TRANSCRIPTION},
+                         {PipelineData::CONTEXTUAL_ENHANCEMENT}, 2.0f, 0.0f)
+        , transcriber_(std::move(transcriber)) {}
+
+    bool canSkipStage(const PipelineExecutionContext& context) const override {
+        return !transcriber_ ||
+               !featureRequested(context.originalRequest, context.originalRequest.enableContextualTranscription);
+    }
+
+    bool validatePrerequisites(const PipelineExecutionContext& context) const override {
+        return !context.baseTranscription.text.empty();
+    }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        ConversationContext conversation = transcriber_->getConversationContext(context.utteranceId);
+        conversation.utteranceId = context.utteranceId;
+        if (!context.originalRequest.domainHint.empty()) {
+            conversation.domain = context.originalRequest.domainHint;
+        }
+        context.contextualEnhancement = transcriber_->enhanceTranscription(context.baseTranscription, conversation);
+        return succeed();
+    }
+
+    bool isInitialized() const override { return transcriber_ && transcriber_->isInitialized(); }
+
+private:
+    std::shared_ptr<ContextualTranscriberInterface> transcriber_;
+};
+
+// Transcribes with the external services straight from the audio, alongside the local engine
+class ExternalServiceFusionStage : public ComponentStage {
+public:
+    explicit ExternalServiceFusionStage(std::shared_ptr<ExternalServiceIntegratorInterface> externalServices)
+        : ComponentStage(PipelineStage::EXTERNAL_SERVICE_FUSION, {PipelineData::PROCESSED_AUDIO},
+                         {PipelineData::EXTERNAL_RESULT}, 100.0f, 100.0f)
+        , externalServices_(std::move(externalServices)) {}
+
+    bool canSkipStage(const PipelineExecutionContext& context) const override {
+        return !externalServices_ ||
+               !featureRequested(context.originalRequest, context.originalRequest.enableExternalServices);
+    }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        std::vector<std::string> services = externalServices_->getHealthyServices();
+        if (services.empty()) {
+            return fail("No healthy external services");
+        }
+
+        auto fused = std::make_shared<CallbackResult<FusedTranscriptionResult>>();
+        bool submitted = externalServices_->transcribeWithFusion(
+            context.processedAudio, context.originalRequest.languageHint, services,
+            [fused](const FusedTranscriptionResult& result) { fused->set(result); });
+        if (!submitted) {
+            return fail("External transcription request was rejected");
+        }
+        if (!fused->waitFor(context.stageTimeoutMs)) {
+            return fail("External transcription timed out");
+        }
+
+        std::lock_guard<std::mutex> lock(fused->mutex);
+        context.externalServiceResult = fused->value;
+        PipelineStageResult result = succeed();
+        result.stageMetadata["servicesUsed"] = std::to_string(fused->value.servicesUsed);
+        return result;
+    }
+
+    bool isInitialized() const override { return externalServices_ && externalServices_->isInitialized(); }
+
+private:
+    std::shared_ptr<ExternalServiceIntegratorInterface> externalServices_;
+};
+
+// Join point for every optional branch; the pipeline assembles the result afterwards
+class ResultFinalizationStage : public ComponentStage {
+public:
+    ResultFinalizationStage()
+        : ComponentStage(PipelineStage::RESULT_FINALIZATION,
+                         {PipelineData::AUDIO_QUALITY, PipelineData::REALTIME_METRICS,
+                          PipelineData::QUALITY_SETTINGS, PipelineData::SPEAKER_INFO, PipelineData::EMOTION,
+                          PipelineData::BASE_TRANSCRIPTION, PipelineData::CONTEXTUAL_ENHANCEMENT,
+                          PipelineData::EXTERNAL_RESULT},
+                         {PipelineData::FINAL_RESULT}, 0.1f, 0.0f) {}
+
+    bool canSkipStage(const PipelineExecutionContext&) const override { return false; }
+    bool validatePrerequisites(const PipelineExecutionContext&) const override { return true; }
+    PipelineStageResult processStage(PipelineExecutionContext&) override { return succeed(); }
+    bool isInitialized() const override { return true; }
+};
+
+} // namespace
+
+// StageTimingMonitor Implementation
+
+StageTimingMonitor::StageTimingMonitor()
+    : initialized_(false)
+    , executions_(0)
+    , totalWallMs_(0.0)
+    , totalCriticalPathMs_(0.0)
+    , totalStageSumMs_(0.0) {}
+
+bool StageTimingMonitor::initialize() {
+    initialized_ = true;
+    return true;
+}
+
+void StageTimingMonitor::startExecution(const PipelineExecutionContext&) {
+    // Executions overlap, so everything is derived from the finished context
+}
+
+void StageTimingMonitor::recordStageCompletion(PipelineStage stage, const PipelineStageResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    StageTiming& timing = stageTimings_[stage];
+    if (result.skipped) {
+        timing.skips++;
+        return;
+    }
+    timing.executions++;
+    if (!result.success) {
+        timing.failures++;
+    }
+    timing.totalMs += result.processingTimeMs;
+    timing.maxMs = std::max(timing.maxMs, result.processingTimeMs);
+    timing.lastMs = result.processingTimeMs;
+}
+
+void StageTimingMonitor::finishExecution(const PipelineExecutionContext& context) {
+    double stageSumMs = 0.0;
+    for (const auto& result : context.stageResults) {
+        if (!result.skipped) {
+            stageSumMs += result.processingTimeMs;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    executions_++;
+    totalWallMs_ += elapsedMs(context.startTime, context.endTime);
+    totalCriticalPathMs_ += context.criticalPathMs;
+    totalStageSumMs_ += stageSumMs;
+}
+
+std::string StageTimingMonitor::getExecutionStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    double executions = std::max<uint64_t>(executions_, 1);
+
+    std::ostringstream oss;
+    oss << "{"
+        << "\"executions\":" << executions_ << ","
+        << "\"averageWallMs\":" << totalWallMs_ / executions << ","
+        << "\"averageCriticalPathMs\":" << totalCriticalPathMs_ / executions << ","
+        << "\"averageStageTimeSumMs\":" << totalStageSumMs_ / executions << ","
+        << "\"parallelSpeedup\":" << (totalWallMs_ > 0.0 ? totalStageSumMs_ / totalWallMs_ : 0.0) << ","
+        << "\"stages\":{";
+    bool first = true;
+    for (const auto& entry : stageTimings_) {
+        const StageTiming& timing = entry.second;
+        oss << (first ? "" : ",") << "\"" << stageName(entry.first) << "\":{"
+            << "\"executions\":" << timing.executions << ","
+            << "\"failures\":" << timing.failures << ","
+            << "\"skips\":" << timing.skips << ","
+            << "\"averageMs\":" << (timing.executions ? timing.totalMs / timing.executions : 0.0) << ","
+            << "\"maxMs\":" << timing.maxMs
+            << "}";
+        first = false;
+    }
+    oss << "}}";
+    return oss.str();
+}
+
+std::map<std::string, float> StageTimingMonitor::getStageMetrics(PipelineStage stage) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, float> metrics;
+    auto it = stageTimings_.find(stage);
+    if (it == stageTimings_.end()) {
+        return metrics;
+    }
+    const StageTiming& timing = it->second;
+    metrics["executions"] = static_cast<float>(timing.executions);
+    metrics["failures"] = static_cast<float>(timing.failures);
+    metrics["skips"] = static_cast<float>(timing.skips);
+    metrics["averageMs"] = timing.executions ? static_cast<float>(timing.totalMs / timing.executions) : 0.0f;
+    metrics["maxMs"] = timing.maxMs;
+    metrics["lastMs"] = timing.lastMs;
+    return metrics;
+}
+
+void StageTimingMonitor::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stageTimings_.clear();
+    executions_ = 0;
+    totalWallMs_ = 0.0;
+    totalCriticalPathMs_ = 0.0;
+    totalStageSumMs_ = 0.0;
+}
+
+// AdvancedProcessingPipeline Implementation
+
+// State of one processAudio() call. Any thread may run a ready stage once it
+// claims it; executor tasks that lose the claim do nothing, so tasks left in a
+// shared queue after the call returns never touch the context.
+struct AdvancedProcessingPipeline::ExecutionRun {
+    std::shared_ptr<const ExecutionPlan> plan;
+    std::shared_ptr<speechrnt::core::TaskQueue> executor; // Null runs every stage on the caller
+    PipelineExecutionContext* context = nullptr;
+    bool skipFailedStages = true;
+    int attempts = 1;
+
+    std::unique_ptr<std::atomic<bool>[]> claimed;
+    std::mutex mutex;
+    std::condition_variable stageCompleted;
+    std::vector<size_t> pendingPredecessors;
+    std::vector<size_t> ready;
+    std::vector<float> remainingPathMs; // Estimated time from a stage's start to the end of the run
+    std::vector<float> stageTimes;
+    size_t completed = 0;
+    bool aborted = false;
+
+    bool claim(size_t index) {
+        return !claimed[index].exchange(true);
+    }
+
+    // Most critical first, so the thread that continues inline takes the longest chain
+    void sortByCriticality(std::vector<size_t>& stages) const {
+        std::stable_sort(stages.begin(), stages.end(),
+                         [this](size_t a, size_t b) { return remainingPathMs[a] > remainingPathMs[b]; });
+    }
+};
+
+AdvancedProcessingPipeline::AdvancedProcessingPipeline()
+    : initialized_(false)
+    , executionMonitor_(std::make_unique<StageTimingMonitor>()) {}
+
+AdvancedProcessingPipeline::~AdvancedProcessingPipeline() {
+    shutdown();
+}
+
+bool AdvancedProcessingPipeline::initialize(const PipelineConfig& config) {
+    if (!validateConfiguration(config)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lastError_ = "Invalid pipeline configuration: " + lastError_;
+        speechrnt::utils::Logger::error("AdvancedProcessingPipeline: " + lastError_);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_ = config;
+    if (config_.enableParallelProcessing && !executor_) {
+        startOwnedExecutor();
+    }
+    executionMonitor_->initialize();
+
+    if (!initializeStageProcessors() || !rebuildExecutionPlan()) {
+        speechrnt::utils::Logger::error("AdvancedProcessingPipeline: " + lastError_);
+        return false;
+    }
+
+    initialized_ = true;
+    speechrnt::utils::Logger::info("AdvancedProcessingPipeline initialized with " +
+                                   std::to_string(plan_->stages.size()) + " stages" +
+                                   (config_.enableParallelProcessing ? " (parallel)" : ""));
+    return true;
+}
+
+void AdvancedProcessingPipeline::setComponents(
+    std::shared_ptr<SpeakerDiarizationInterface> speakerEngine,
+    std::shared_ptr<AudioPreprocessorInterface> audioPreprocessor,
+    std::shared_ptr<ContextualTranscriberInterface> contextualTranscriber,
+    std::shared_ptr<RealTimeAudioAnalyzerInterface> audioAnalyzer,
+    std::shared_ptr<AdaptiveQualityManagerInterface> qualityManager,
+    std::shared_ptr<ExternalServiceIntegratorInterface> externalServices,
+    std::shared_ptr<STTInterface> baseSTT) {
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    speakerEngine_ = std::move(speakerEngine);
+    audioPreprocessor_ = std::move(audioPreprocessor);
+    contextualTranscriber_ = std::move(contextualTranscriber);
+    audioAnalyzer_ = std::move(audioAnalyzer);
+    qualityManager_ = std::move(qualityManager);
+    externalServices_ = std::move(externalServices);
+    baseSTT_ = std::move(baseSTT);
+
+    initializeStageProcessors();
+    rebuildExecutionPlan();
+}
+
+void AdvancedProcessingPipeline::setEmotionDetector(std::shared_ptr<EmotionDetector> emotionDetector) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    emotionDetector_ = std::move(emotionDetector);
+    stageProcessors_[PipelineStage::EMOTION_ANALYSIS] = std::make_shared<EmotionAnalysisStage>(emotionDetector_);
+    rebuildExecutionPlan();
+}
+
+void AdvancedProcessingPipeline::setExecutor(std::shared_ptr<speechrnt::core::TaskQueue> executor) {
+    std::unique_ptr<speechrnt::core::ThreadPool> previousPool;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        previousPool = std::move(ownedPool_);
+        executor_ = std::move(executor);
+        if (!executor_ && initialized_ && config_.enableParallelProcessing) {
+            startOwnedExecutor();
+        }
+    }
+    // Joined outside the lock; workers may be finishing stages that report errors
+    if (previousPool) {
+        previousPool->stop();
+    }
+}
+
+bool AdvancedProcessingPipeline::registerStageProcessor(std::unique_ptr<PipelineStageProcessor> processor) {
+    if (!processor) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    PipelineStage stage = processor->getStageType();
+    std::shared_ptr<PipelineStageProcessor> previous = stageProcessors_[stage];
+    stageProcessors_[stage] = std::move(processor);
+    if (!rebuildExecutionPlan()) {
+        stageProcessors_[stage] = previous;
+        rebuildExecutionPlan();
+        return false;
+    }
+    return true;
+}
+
+std::vector<PipelineStage> AdvancedProcessingPipeline::getStagePredecessors(PipelineStage stage) const {
+    std::shared_ptr<const ExecutionPlan> plan;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        plan = plan_;
+    }
+
+    std::vector<PipelineStage> predecessors;
+    if (!plan) {
+        return predecessors;
+    }
+    for (size_t i = 0; i < plan->stages.size(); ++i) {
+        if (plan->stages[i] == stage) {
+            for (size_t predecessor : plan->predecessors[i]) {
+                predecessors.push_back(plan->stages[predecessor]);
+            }
+        }
+    }
+    return predecessors;
+}
+
+AdvancedTranscriptionResult AdvancedProcessingPipeline::processAudio(const AudioProcessingRequest& request) {
+    if (!initialized_) {
+        AdvancedTranscriptionResult result;
+        std::lock_guard<std::mutex> lock(mutex_);
+        lastError_ = "Processing pipeline not initialized";
+        return result;
+    }
+
+    auto run = std::make_shared<ExecutionRun>();
+    PipelineExecutionContext context;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        run->plan = plan_;
+        run->executor = config_.enableParallelProcessing ? executor_ : nullptr;
+        run->skipFailedStages = config_.enableStageSkipping;
+        run->attempts = config_.enableStageRetry ? 1 + std::max(0, config_.maxRetryAttempts) : 1;
+        context = createExecutionContext(request);
+    }
+
+    const ExecutionPlan& plan = *run->plan;
+    size_t stageCount = plan.stages.size();
+    run->context = &context;
+    run->claimed.reset(new std::atomic<bool>[stageCount]);
+    run->pendingPredecessors.resize(stageCount);
+    run->stageTimes.assign(stageCount, 0.0f);
+    run->remainingPathMs.assign(stageCount, 0.0f);
+    for (size_t i = stageCount; i-- > 0;) {
+        float downstream = 0.0f;
+        for (size_t dependent : plan.dependents[i]) {
+            downstream = std::max(downstream, run->remainingPathMs[dependent]);
+        }
+        const auto& processor = *plan.processors[i];
+        float estimate = processor.canSkipStage(context) ? 0.0f : processor.getEstimatedProcessingTime(context);
+        run->remainingPathMs[i] = estimate + downstream;
+    }
+    for (size_t i = 0; i < stageCount; ++i) {
+        run->claimed[i] = false;
+        run->pendingPredecessors[i] = plan.predecessors[i].size();
+        if (plan.predecessors[i].empty()) {
+            run->ready.push_back(i);
+        }
+    }
+
+    run->sortByCriticality(run->ready);
+    executionMonitor_->startExecution(context);
+
+    // Fan the roots out, keeping the most critical for this thread
+    size_t first = NO_STAGE;
+    for (size_t root : run->ready) {
+        if (first == NO_STAGE) {
+            first = root;
+            run->claim(root);
+        } else if (run->executor) {
+            run->executor->enqueue([this, run, root] {
+                if (run->claim(root)) {
+                    runStages(run, root);
+                }
+            }, speechrnt::core::TaskPriority::HIGH);
+        }
+    }
+    runStages(run, first);
+
+    // Help with stages the executor has not picked up until every stage is done
+    {
+        std::unique_lock<std::mutex> lock(run->mutex);
+        while (run->completed < stageCount) {
+            size_t next = NO_STAGE;
+            run->sortByCriticality(run->ready);
+            for (size_t index : run->ready) {
+                if (run->claim(index)) {
+                    next = index;
+                    break;
+                }
+            }
+            if (next == NO_STAGE) {
+                run->stageCompleted.wait(lock);
+                continue;
+            }
+            lock.unlock();
+            runStages(run, next);
+            lock.lock();
+        }
+    }
+
+    context.endTime = std::chrono::steady_clock::now();
+    context.criticalPathMs = computeCriticalPath(plan, run->stageTimes);
+    executionMonitor_->finishExecution(context);
+
+    return finalizeResult(context);
+}
+
+void AdvancedProcessingPipeline::processAudioAsync(const AudioProcessingRequest& request,
+                                                   std::function<void(const AdvancedTranscriptionResult&)> callback) {
+    std::shared_ptr<speechrnt::core::TaskQueue> executor;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        executor = executor_;
+    }
+
+    if (!initialized_ || !executor) {
+        AdvancedTranscriptionResult result = processAudio(request);
+        if (callback) {
+            callback(result);
+        }
+        return;
+    }
+
+    executor->enqueue([this, request, callback] {
+        AdvancedTranscriptionResult result = processAudio(request);
+        if (callback) {
+            callback(result);
+        }
+    });
+}
+
+void AdvancedProcessingPipeline::setStageEnabled(PipelineStage stage, bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& stages = config_.enabledStages;
+    auto it = std::find(stages.begin(), stages.end(), stage);
+    if (enabled && it == stages.end()) {
+        stages.push_back(stage);
+    } else if (!enabled && it != stages.end()) {
+        stages.erase(it);
+    }
+    rebuildExecutionPlan();
+}
+
+bool AdvancedProcessingPipeline::isStageEnabled(PipelineStage stage) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto& stages = config_.enabledStages;
+    return std::find(stages.begin(), stages.end(), stage) != stages.end();
+}
+
+void AdvancedProcessingPipeline::setStageConfig(PipelineStage stage, const std::map<std::string, std::string>& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_.stageConfigs[stage] = config;
+}
+
+std::map<std::string, std::string> AdvancedProcessingPipeline::getStageConfig(PipelineStage stage) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = config_.stageConfigs.find(stage);
+    return it != config_.stageConfigs.end() ? it->second : std::map<std::string, std::string>();
+}
+
+std::string AdvancedProcessingPipeline::getPipelineStats() const {
+    return executionMonitor_->getExecutionStats();
+}
+
+std::map<std::string, float> AdvancedProcessingPipeline::getStageMetrics(PipelineStage stage) const {
+    return executionMonitor_->getStageMetrics(stage);
+}
+
+void AdvancedProcessingPipeline::resetStats() {
+    if (auto* timing = dynamic_cast<StageTimingMonitor*>(executionMonitor_.get())) {
+        timing->reset();
+    }
+}
+
+bool AdvancedProcessingPipeline::updateConfiguration(const PipelineConfig& config) {
+    if (!validateConfiguration(config)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    PipelineConfig previous = config_;
+    config_ = config;
+    if (!rebuildExecutionPlan()) {
+        config_ = previous;
+        rebuildExecutionPlan();
+        return false;
+    }
+    if (config_.enableParallelProcessing && !executor_) {
+        startOwnedExecutor();
+    }
+    return true;
+}
+
+PipelineConfig AdvancedProcessingPipeline::getCurrentConfiguration() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+}
+
+bool AdvancedProcessingPipeline::validateConfiguration(const PipelineConfig& config) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (config.enabledStages.empty()) {
+        lastError_ = "No pipeline stages enabled";
+        return false;
+    }
+    if (config.maxRetryAttempts < 0 || config.stageTimeoutMs <= 0.0f) {
+        lastError_ = "Retry attempts and stage timeout must be positive";
+        return false;
+    }
+    return stageProcessors_.empty() || validateStageOrder(config.enabledStages);
+}
+
+float AdvancedProcessingPipeline::getEstimatedProcessingTime(const AudioProcessingRequest& request) const {
+    std::shared_ptr<const ExecutionPlan> plan;
+    PipelineExecutionContext context;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        plan = plan_;
+        context = createExecutionContext(request);
+    }
+    if (!plan) {
+        return 0.0f;
+    }
+
+    // Independent stages overlap, so the estimate is the critical path
+    std::vector<float> estimates(plan->stages.size(), 0.0f);
+    for (size_t i = 0; i < plan->stages.size(); ++i) {
+        const auto& processor = *plan->processors[i];
+        if (!processor.canSkipStage(context)) {
+            estimates[i] = processor.getEstimatedProcessingTime(context);
+        }
+    }
+    return computeCriticalPath(*plan, estimates);
+}
+
+std::string AdvancedProcessingPipeline::getLastError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastError_;
+}
+
+void AdvancedProcessingPipeline::shutdown() {
+    std::unique_ptr<speechrnt::core::ThreadPool> pool;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        initialized_ = false;
+        if (ownedPool_) {
+            pool = std::move(ownedPool_);
+            executor_.reset();
+        }
+    }
+    if (pool) {
+        pool->stop();
+    }
+}
+
+// Private helpers; callers hold mutex_ unless noted
+
+bool AdvancedProcessingPipeline::initializeStageProcessors() {
+    stageProcessors_.clear();
+    stageProcessors_[PipelineStage::AUDIO_PREPROCESSING] = std::make_shared<AudioPreprocessingStage>(audioPreprocessor_);
+    stageProcessors_[PipelineStage::REALTIME_ANALYSIS] = std::make_shared<RealTimeAnalysisStage>(audioAnalyzer_);
+    stageProcessors_[PipelineStage::QUALITY_ADAPTATION] = std::make_shared<QualityAdaptationStage>(qualityManager_);
+    stageProcessors_[PipelineStage::SPEAKER_DIARIZATION] = std::make_shared<SpeakerDiarizationStage>(speakerEngine_);
+    stageProcessors_[PipelineStage::EMOTION_ANALYSIS] = std::make_shared<EmotionAnalysisStage>(emotionDetector_);
+    stageProcessors_[PipelineStage::TRANSCRIPTION] = std::make_shared<TranscriptionStage>(baseSTT_);
+    stageProcessors_[PipelineStage::CONTEXTUAL_ENHANCEMENT] =
+        std::make_shared<ContextualEnhancementStage>(contextualTranscriber_);
+    stageProcessors_[PipelineStage::EXTERNAL_SERVICE_FUSION] =
+        std::make_shared<ExternalServiceFusionStage>(externalServices_);
+    stageProcessors_[PipelineStage::RESULT_FINALIZATION] = std::make_shared<ResultFinalizationStage>();
+    return true;
+}
+
+bool AdvancedProcessingPipeline::validateStageOrder(const std::vector<PipelineStage>& stages) const {
+    std::string error;
+    if (!buildExecutionPlan(stages, error)) {
+        lastError_ = error;
+        return false;
+    }
+    return true;
+}
+
+std::vector<PipelineStage> AdvancedProcessingPipeline::resolveStageDependencies(
+    const std::vector<PipelineStage>& requestedStages) const {
+
+    // Explicit stage dependencies are pulled in; data inputs without an enabled producer are optional
+    std::vector<PipelineStage> resolved;
+    std::vector<PipelineStage> pending(requestedStages.rbegin(), requestedStages.rend());
+    while (!pending.empty()) {
+        PipelineStage stage = pending.back();
+        pending.pop_back();
+        if (std::find(resolved.begin(), resolved.end(), stage) != resolved.end()) {
+            continue;
+        }
+        auto it = stageProcessors_.find(stage);
+        if (it == stageProcessors_.end() || !it->second) {
+            continue;
+        }
+        resolved.push_back(stage);
+        for (PipelineStage dependency : it->second->getStageDependencies()) {
+            pending.push_back(dependency);
+        }
+    }
+
+    std::sort(resolved.begin(), resolved.end());
+    return resolved;
+}
+
+std::shared_ptr<const AdvancedProcessingPipeline::ExecutionPlan> AdvancedProcessingPipeline::buildExecutionPlan(
+    const std::vector<PipelineStage>& stages, std::string& error) const {
+
+    std::vector<PipelineStage> resolved = resolveStageDependencies(stages);
+    size_t count = resolved.size();
+
+    std::map<PipelineData, std::vector<size_t>> producers;
+    for (size_t i = 0; i < count; ++i) {
+        for (PipelineData output : stageProcessors_.at(resolved[i])->getStageOutputs()) {
+            producers[output].push_back(i);
+        }
+    }
+
+    // Edges from data producers to consumers plus explicit stage dependencies
+    std::vector<std::vector<size_t>> predecessors(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto& processor = stageProcessors_.at(resolved[i]);
+        auto addEdge = [&](size_t from) {
+            if (from != i && std::find(predecessors[i].begin(), predecessors[i].end(), from) == predecessors[i].end()) {
+                predecessors[i].push_back(from);
+            }
+        };
+        for (PipelineData input : processor->getStageInputs()) {
+            auto it = producers.find(input);
+            if (it != producers.end()) {
+                for (size_t producer : it->second) {
+                    addEdge(producer);
+                }
+            }
+        }
+        for (PipelineStage dependency : processor->getStageDependencies()) {
+            auto it = std::find(resolved.begin(), resolved.end(), dependency);
+            if (it != resolved.end()) {
+                addEdge(static_cast<size_t>(it - resolved.begin()));
+            }
+        }
+    }
+
+    // Kahn's algorithm; ties keep enum order so sequential runs stay predictable
+    std::vector<size_t> remaining(count);
+    std::vector<std::vector<size_t>> dependents(count);
+    for (size_t i = 0; i < count; ++i) {
+        remaining[i] = predecessors[i].size();
+        for (size_t predecessor : predecessors[i]) {
+            dependents[predecessor].push_back(i);
+        }
+    }
+    std::vector<size_t> order;
+    std::vector<bool> placed(count, false);
+    while (order.size() < count) {
+        size_t next = NO_STAGE;
+        for (size_t i = 0; i < count; ++i) {
+            if (!placed[i] && remaining[i] == 0) {
+                next = i;
+                break;
+            }
+        }
+        if (next == NO_STAGE) {
+            for (size_t i = 0; i < count; ++i) {
+                if (!placed[i]) {
+                    error = std::string("Stage dependency cycle involving ") + stageName(resolved[i]);
+                    return nullptr;
+                }
+            }
+        }
+        placed[next] = true;
+        order.push_back(next);
+        for (size_t dependent : dependents[next]) {
+            remaining[dependent]--;
+        }
+    }
+
+    std::vector<size_t> position(count);
+    for (size_t i = 0; i < count; ++i) {
+        position[order[i]] = i;
+    }
+
+    auto plan = std::make_shared<ExecutionPlan>();
+    plan->predecessors.resize(count);
+    plan->dependents.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t original = order[i];
+        plan->stages.push_back(resolved[original]);
+        plan->processors.push_back(stageProcessors_.at(resolved[original]));
+        for (size_t predecessor : predecessors[original]) {
+            plan->predecessors[i].push_back(position[predecessor]);
+            plan->dependents[position[predecessor]].push_back(i);
+        }
+    }
+    return plan;
+}
+
+bool AdvancedProcessingPipeline::rebuildExecutionPlan() {
+    std::string error;
+    auto plan = buildExecutionPlan(config_.enabledStages, error);
+    if (!plan) {
+        lastError_ = error;
+        return false;
+    }
+    plan_ = std::move(plan);
+    return true;
+}
+
+void AdvancedProcessingPipeline::startOwnedExecutor() {
+    size_t threads = std::max<size_t>(2, std::min<size_t>(4, std::thread::hardware_concurrency()));
+    executor_ = std::make_shared<speechrnt::core::TaskQueue>();
+    ownedPool_ = std::make_unique<speechrnt::core::ThreadPool>(threads);
+    ownedPool_->start(executor_);
+}
+
+PipelineExecutionContext AdvancedProcessingPipeline::createExecutionContext(const AudioProcessingRequest& request) const {
+    PipelineExecutionContext context;
+    context.utteranceId = request.utteranceId;
+    context.originalAudio = request.audioData;
+    context.processedAudio = request.audioData;
+    context.isRealTime = request.isLive;
+    context.originalRequest = request;
+    context.stageTimeoutMs = config_.stageTimeoutMs;
+    context.startTime = std::chrono::steady_clock::now();
+    return context;
+}
+
+// Runs a claimed stage, then keeps going with one newly ready dependent (no lock needed)
+void AdvancedProcessingPipeline::runStages(const std::shared_ptr<ExecutionRun>& run, size_t index) {
+    while (index != NO_STAGE) {
+        PipelineStageResult result = executeStage(*run, index);
+        index = completeStage(run, index, std::move(result));
+    }
+}
+
+size_t AdvancedProcessingPipeline::completeStage(const std::shared_ptr<ExecutionRun>& run, size_t index,
+                                                 PipelineStageResult result) {
+    // Reported before the stage counts as complete: the caller may return and
+    // destroy the pipeline as soon as the last stage is counted
+    executionMonitor_->recordStageCompletion(result.stage, result);
+
+    const ExecutionPlan& plan = *run->plan;
+    std::vector<size_t> newlyReady;
+    {
+        std::lock_guard<std::mutex> lock(run->mutex);
+        run->stageTimes[index] = result.skipped ? 0.0f : result.processingTimeMs;
+        if (!result.success && !result.skipped && !run->skipFailedStages) {
+            run->aborted = true;
+        }
+        run->context->stageResults.push_back(std::move(result));
+        for (size_t dependent : plan.dependents[index]) {
+            if (--run->pendingPredecessors[dependent] == 0) {
+                newlyReady.push_back(dependent);
+                run->ready.push_back(dependent);
+            }
+        }
+        run->completed++;
+    }
+    run->stageCompleted.notify_all();
+
+    run->sortByCriticality(newlyReady);
+    size_t next = NO_STAGE;
+    for (size_t dependent : newlyReady) {
+        if (next == NO_STAGE) {
+            if (run->claim(dependent)) {
+                next = dependent;
+            }
+        } else if (run->executor) {
+            run->executor->enqueue([this, run, dependent] {
+                if (run->claim(dependent)) {
+                    runStages(run, dependent);
+                }
+            }, speechrnt::core::TaskPriority::HIGH);
+        }
+    }
+    return next;
+}
+
+PipelineStageResult AdvancedProcessingPipeline::executeStage(ExecutionRun& run, size_t index) {
+    PipelineStage stage = run.plan->stages[index];
+    PipelineStageProcessor& processor = *run.plan->processors[index];
+    PipelineExecutionContext& context = *run.context;
+    auto start = std::chrono::steady_clock::now();
+
+    bool aborted;
+    {
+        std::lock_guard<std::mutex> lock(run.mutex);
+        aborted = run.aborted;
+    }
+
+    PipelineStageResult result(stage, true, 0.0f);
+    if (aborted) {
+        result.success = false;
+        result.skipped = true;
+        result.errorMessage = "Skipped after an earlier stage failed";
+    } else if (shouldSkipStage(processor, context)) {
+        result.skipped = true;
+    } else if (!processor.validatePrerequisites(context)) {
+        result.success = false;
+        result.errorMessage = "Prerequisites not met";
+    } else {
+        result = retryStage(processor, context, run.attempts);
+    }
+
+    result.stage = stage;
+    result.startOffsetMs = elapsedMs(context.startTime, start);
+    result.processingTimeMs = elapsedMs(start, std::chrono::steady_clock::now());
+    if (!result.success && !result.skipped) {
+        handleStageError(stage, result.errorMessage);
+    }
+    return result;
+}
+
+float AdvancedProcessingPipeline::computeCriticalPath(const ExecutionPlan& plan,
+                                                      const std::vector<float>& stageTimes) const {
+    // Stages are in dependency order, so one forward pass finds the longest chain
+    std::vector<float> finish(plan.stages.size(), 0.0f);
+    float longest = 0.0f;
+    for (size_t i = 0; i < plan.stages.size(); ++i) {
+        float ready = 0.0f;
+        for (size_t predecessor : plan.predecessors[i]) {
+            ready = std::max(ready, finish[predecessor]);
+        }
+        finish[i] = ready + stageTimes[i];
+        longest = std::max(longest, finish[i]);
+    }
+    return longest;
+}
+
+AdvancedTranscriptionResult AdvancedProcessingPipeline::finalizeResult(const PipelineExecutionContext& context) {
+    const FusedTranscriptionResult& external = context.externalServiceResult;
+    bool useExternal = external.servicesUsed > 0 &&
+                       (context.baseTranscription.text.empty() ||
+                        external.fusionConfidence > context.baseTranscription.confidence);
+
+    AdvancedTranscriptionResult result(useExternal ? external.fusedResult : context.baseTranscription);
+    if (useExternal) {
+        result.usedExternalService = true;
+        result.serviceResults = external.individualResults;
+        float topContribution = -1.0f;
+        for (const auto& contribution : external.serviceContributions) {
+            if (contribution.second > topContribution) {
+                topContribution = contribution.second;
+                result.externalServiceName = contribution.first;
+            }
+        }
+    }
+
+    // Speaker segments; the primary speaker is the one talking longest
+    result.speakerSegments = context.speakerInfo.segments;
+    std::map<uint32_t, int64_t> speakingTimeMs;
+    for (const auto& segment : context.speakerInfo.segments) {
+        speakingTimeMs[segment.speakerId] += segment.endTimeMs - segment.startTimeMs;
+    }
+    int64_t longest = -1;
+    for (const auto& entry : speakingTimeMs) {
+        if (entry.second > longest) {
+            longest = entry.second;
+            result.primarySpeakerId = entry.first;
+        }
+    }
+
+    result.audioQuality = context.audioQuality;
+    result.appliedPreprocessing = context.appliedPreprocessing;
+
+    const ContextualResult& contextual = context.contextualEnhancement;
+    if (!contextual.enhancedText.empty()) {
+        result.text = contextual.enhancedText;
+        result.contextualCorrections = contextual.corrections;
+        result.detectedDomain = contextual.detectedDomain;
+        result.contextualConfidence = contextual.contextualConfidence;
+    }
+
+    result.realtimeMetrics = context.realtimeMetrics;
+    result.usedQualityLevel = context.qualitySettings.level;
+
+    for (const auto& stageResult : context.stageResults) {
+        if (stageResult.stage == PipelineStage::EMOTION_ANALYSIS && stageResult.success && !stageResult.skipped) {
+            result.hasEmotionAnalysis = true;
+            result.emotion = context.emotion;
+        }
+    }
+
+    result.processingLatencyMs = elapsedMs(context.startTime, context.endTime);
+    return result;
+}
+
+void AdvancedProcessingPipeline::handleStageError(PipelineStage stage, const std::string& error) {
+    // Called from stage threads without mutex_ held
+    std::string message = std::string("Pipeline stage ") + stageName(stage) + " failed: " + error;
+    speechrnt::utils::Logger::warn(message);
+    std::lock_guard<std::mutex> lock(mutex_);
+    lastError_ = message;
+}
+
+bool AdvancedProcessingPipeline::shouldSkipStage(PipelineStageProcessor& processor,
+                                                 const PipelineExecutionContext& context) const {
+    return processor.canSkipStage(context);
+}
+
+PipelineStageResult AdvancedProcessingPipeline::retryStage(PipelineStageProcessor& processor,
+                                                           PipelineExecutionContext& context, int attempts) {
+    PipelineStageResult result(processor.getStageType(), false, 0.0f);
+    for (int attempt = 1; attempt <= attempts; ++attempt) {
+        try {
+            result = processor.processStage(context);
+        } catch (const std::exception& e) {
+            result = PipelineStageResult(processor.getStageType(), false, 0.0f);
+            result.errorMessage = e.what();
+        }
+        if (result.success) {
+            if (attempt > 1) {
+                result.stageMetadata["attempts"] = std::to_string(attempt);
+            }
+            break;
+        }
+    }
+    return result;
+}
+
+std::string AdvancedProcessingPipeline::stageToString(PipelineStage stage) const {
+    return stageName(stage);
+}
+
+PipelineStage AdvancedProcessingPipeline::stringToStage(const std::string& stageStr) const {
+    for (PipelineStage stage : ALL_STAGES) {
+        if (stageStr == stageName(stage)) {
+            return stage;
+        }
+    }
+    return PipelineStage::AUDIO_PREPROCESSING;
+}
+
+} // namespace advanced
+} // namespace stt
@@ -703,6 +703,9 @@ bool AdvancedSTTOrchestrator::initializeFeature(AdvancedFeature feature, const F
                 size_t bufferSize = config.getIntParameter("analysisBufferSize", 1024);
                 
                 auto realtimeAnalyzerImpl = std::make_unique<audio::RealTimeAudioAnalyzer>(sampleRate, bufferSize);
+                // The pipeline reads metrics right after pushing a chunk, so
+                // analyse on its thread rather than a per-analyzer worker
+                realtimeAnalyzerImpl->setAnalysisThreading(::audio::AnalysisThreading::CALLER_THREAD);
                 if (realtimeAnalyzerImpl->initialize()) {
                     // Create adapter to interface
                     audioAnalyzer_ = std::make_unique<RealTimeAudioAnalyzerAdapter>(std::move(realtimeAnalyzerImpl));
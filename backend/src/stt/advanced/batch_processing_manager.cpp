@@ -0,0 +1,1800 @@
+#include "stt/advanced/batch_processing_manager.hpp"
+#include "stt/whisper_state_pool.hpp"
+#include "utils/logging.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace stt {
+namespace advanced {
+
+namespace {
+
+uint16_t readU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+std::string lowerExtension(const std::string& filePath) {
+    std::string ext = std::filesystem::path(filePath).extension().string();
+    if (!ext.empty() && ext[0] == '.') {
+        ext.erase(0, 1);
+    }
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext;
+}
+
+std::string trimText(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = text.find_last_not_of(" \t\r\n");
+    return text.substr(begin, end - begin + 1);
+}
+
+std::string escapeJson(const std::string& text) {
+    std::ostringstream oss;
+    for (unsigned char c : text) {
+        switch (c) {
+        case '"': oss << "\\\""; break;
+        case '\\': oss << "\\\\"; break;
+        case '\n': oss << "\\n"; break;
+        case '\r': oss << "\\r"; break;
+        case '\t': oss << "\\t"; break;
+        default:
+            if (c < 0x20) {
+                oss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                    << static_cast<int>(c) << std::dec;
+            } else {
+                oss << c;
+            }
+        }
+    }
+    return oss.str();
+}
+
+// Checkpoint fields are tab-separated, so tabs, newlines and backslashes are escaped
+std::string escapeField(const std::string& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+        case '\\': out += "\\\\"; break;
+        case '\t': out += "\\t"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        default: out += c;
+        }
+    }
+    return out;
+}
+
+std::string unescapeField(const std::string& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '\\' && i + 1 < text.size()) {
+            char next = text[++i];
+            out += next == 't' ? '\t' : next == 'n' ? '\n' : next == 'r' ? '\r' : next;
+        } else {
+            out += text[i];
+        }
+    }
+    return out;
+}
+
+std::vector<std::string> splitFields(const std::string& line) {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    while (true) {
+        size_t tab = line.find('\t', start);
+        fields.push_back(line.substr(start, tab == std::string::npos ? std::string::npos : tab - start));
+        if (tab == std::string::npos) {
+            break;
+        }
+        start = tab + 1;
+    }
+    return fields;
+}
+
+const char* statusToString(BatchJobStatus status) {
+    switch (status) {
+    case BatchJobStatus::PENDING: return "pending";
+    case BatchJobStatus::RUNNING: return "running";
+    case BatchJobStatus::PAUSED: return "paused";
+    case BatchJobStatus::COMPLETED: return "completed";
+    case BatchJobStatus::FAILED: return "failed";
+    case BatchJobStatus::CANCELLED: return "cancelled";
+    }
+    return "unknown";
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+// MappedAudioFile Implementation
+
+MappedAudioFile::MappedAudioFile()
+    : fd_(-1), mapping_(nullptr), mappingSize_(0), data_(nullptr), frameCount_(0),
+      sampleRate_(0), channels_(0), bitsPerSample_(0), isFloat_(false) {
+}
+
+MappedAudioFile::~MappedAudioFile() {
+    close();
+}
+
+bool MappedAudioFile::open(const std::string& filePath) {
+    close();
+
+    fd_ = ::open(filePath.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        lastError_ = "Cannot open " + filePath + ": " + std::strerror(errno);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd_, &st) != 0 || st.st_size <= 0) {
+        lastError_ = "Empty or unreadable file: " + filePath;
+        close();
+        return false;
+    }
+
+    mappingSize_ = static_cast<size_t>(st.st_size);
+    mapping_ = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        lastError_ = "mmap failed for " + filePath + ": " + std::strerror(errno);
+        close();
+        return false;
+    }
+    // Segments are read front to back by several workers at once
+    madvise(mapping_, mappingSize_, MADV_SEQUENTIAL);
+
+    if (lowerExtension(filePath) == "pcm") {
+        data_ = static_cast<const uint8_t*>(mapping_);
+        sampleRate_ = 16000;
+        channels_ = 1;
+        bitsPerSample_ = 16;
+        isFloat_ = false;
+        frameCount_ = mappingSize_ / 2;
+        return true;
+    }
+
+    if (!parseWavHeader()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedAudioFile::parseWavHeader() {
+    const auto* base = static_cast<const uint8_t*>(mapping_);
+    if (mappingSize_ < 12 || std::memcmp(base, "RIFF", 4) != 0 || std::memcmp(base + 8, "WAVE", 4) != 0) {
+        lastError_ = "Not a RIFF/WAVE file";
+        return false;
+    }
+
+    bool haveFormat = false;
+    size_t offset = 12;
+    while (offset + 8 <= mappingSize_) {
+        const uint8_t* chunk = base + offset;
+        uint32_t chunkSize = readU32(chunk + 4);
+        size_t available = mappingSize_ - offset - 8;
+
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16 && available >= 16) {
+            uint16_t audioFormat = readU16(chunk + 8);
+            if (audioFormat == 0xFFFE && chunkSize >= 40 && available >= 40) {
+                audioFormat = readU16(chunk + 32); // WAVE_FORMAT_EXTENSIBLE sub-format
+            }
+            channels_ = readU16(chunk + 10);
+            sampleRate_ = static_cast<int>(readU32(chunk + 12));
+            bitsPerSample_ = readU16(chunk + 22);
+            isFloat_ = audioFormat == 3;
+
+            bool supported = (audioFormat == 1 && bitsPerSample_ == 16) ||
+                             (audioFormat == 3 && bitsPerSample_ == 32);
+            if (!supported || channels_ == 0 || sampleRate_ <= 0) {
+                lastError_ = "Unsupported WAV encoding (format " + std::to_string(audioFormat) +
+                             ", " + std::to_string(bitsPerSample_) + " bits)";
+                return false;
+            }
+            haveFormat = true;
+        } else if (std::memcmp(chunk, "data", 4) == 0) {
+            if (!haveFormat) {
+                lastError_ = "WAV data chunk precedes fmt chunk";
+                return false;
+            }
+            // Streamed WAVs often leave the size unset; trust the file length then
+            size_t dataBytes = (chunkSize == 0 || chunkSize > available) ? available : chunkSize;
+            data_ = chunk + 8;
+            frameCount_ = dataBytes / (static_cast<size_t>(channels_) * bitsPerSample_ / 8);
+            return true;
+        }
+
+        offset += 8 + chunkSize + (chunkSize & 1);
+    }
+
+    lastError_ = "WAV file has no data chunk";
+    return false;
+}
+
+void MappedAudioFile::close() {
+    if (mapping_) {
+        munmap(mapping_, mappingSize_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    fd_ = -1;
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    data_ = nullptr;
+    frameCount_ = 0;
+}
+
+double MappedAudioFile::getDurationSeconds() const {
+    return sampleRate_ > 0 ? static_cast<double>(frameCount_) / sampleRate_ : 0.0;
+}
+
+void MappedAudioFile::readMono(size_t startFrame, size_t frameCount, std::vector<float>& out) const {
+    out.clear();
+    if (!data_ || startFrame >= frameCount_) {
+        return;
+    }
+    frameCount = std::min(frameCount, frameCount_ - startFrame);
+    out.resize(frameCount);
+
+    const size_t bytesPerSample = static_cast<size_t>(bitsPerSample_) / 8;
+    const size_t frameBytes = bytesPerSample * channels_;
+    const uint8_t* src = data_ + startFrame * frameBytes;
+    const float channelScale = 1.0f / channels_;
+
+    for (size_t i = 0; i < frameCount; ++i, src += frameBytes) {
+        float sum = 0.0f;
+        for (int c = 0; c < channels_; ++c) {
+            if (isFloat_) {
+                float value;
+                std::memcpy(&value, src + c * 4, sizeof(value));
+                sum += value;
+            } else {
+                int16_t value;
+                std::memcpy(&value, src + c * 2, sizeof(value));
+                sum += static_cast<float>(value) / 32768.0f;
+            }
+        }
+        out[i] = sum * channelScale;
+    }
+}
+
+void MappedAudioFile::readMonoResampled(size_t startFrame, size_t frameCount, int targetRate,
+                                        std::vector<float>& out) const {
+    if (targetRate == sampleRate_ || sampleRate_ <= 0) {
+        readMono(startFrame, frameCount, out);
+        return;
+    }
+
+    std::vector<float> source;
+    readMono(startFrame, frameCount, source);
+    out.clear();
+    if (source.empty()) {
+        return;
+    }
+
+    const double step = static_cast<double>(sampleRate_) / targetRate;
+    const size_t outCount = static_cast<size_t>(source.size() / step);
+    out.resize(outCount);
+    for (size_t i = 0; i < outCount; ++i) {
+        double position = i * step;
+        size_t index = static_cast<size_t>(position);
+        float frac = static_cast<float>(position - index);
+        float a = source[index];
+        float b = index + 1 < source.size() ? source[index + 1] : a;
+        out[i] = a + (b - a) * frac;
+    }
+}
+
+// VadSegmenter Implementation
+
+std::vector<AudioSegment> VadSegmenter::segment(const MappedAudioFile& file) const {
+    if (!file.isOpen() || file.getFrameCount() == 0) {
+        return {};
+    }
+
+    const size_t frameSamples =
+        std::max<size_t>(1, static_cast<size_t>(file.getSampleRate()) * config_.frameMs / 1000);
+    const size_t totalFrames = file.getFrameCount();
+    const size_t vadFrames = (totalFrames + frameSamples - 1) / frameSamples;
+
+    std::vector<float> energies;
+    energies.reserve(vadFrames);
+
+    // Read in blocks so the scan touches the mapping sequentially
+    const size_t framesPerBlock = 1024;
+    std::vector<float> block;
+    for (size_t frame = 0; frame < vadFrames; frame += framesPerBlock) {
+        file.readMono(frame * frameSamples, framesPerBlock * frameSamples, block);
+        for (size_t offset = 0; offset < block.size(); offset += frameSamples) {
+            size_t end = std::min(offset + frameSamples, block.size());
+            double sumSquares = 0.0;
+            for (size_t i = offset; i < end; ++i) {
+                sumSquares += static_cast<double>(block[i]) * block[i];
+            }
+            double meanSquare = sumSquares / static_cast<double>(end - offset);
+            energies.push_back(static_cast<float>(10.0 * std::log10(meanSquare + 1e-10)));
+        }
+    }
+
+    return segmentEnergies(energies, frameSamples, totalFrames);
+}
+
+std::vector<AudioSegment> VadSegmenter::segmentEnergies(const std::vector<float>& frameEnergyDb,
+                                                        size_t frameSamples, size_t totalFrames) const {
+    std::vector<AudioSegment> segments;
+    if (frameEnergyDb.empty() || frameSamples == 0) {
+        return segments;
+    }
+
+    const size_t n = frameEnergyDb.size();
+    const size_t frameMs = static_cast<size_t>(std::max(1, config_.frameMs));
+    const size_t minSilence = std::max<size_t>(1, config_.minSilenceMs / frameMs);
+    const size_t minSpeech = std::max<size_t>(1, config_.minSpeechMs / frameMs);
+    const size_t padding = config_.paddingMs / frameMs;
+    const size_t maxFrames = std::max<size_t>(
+        2, static_cast<size_t>(config_.maxSegmentSeconds * 1000.0f / frameMs));
+
+    // Noise floor and speech level from the energy distribution
+    std::vector<float> sorted(frameEnergyDb);
+    std::nth_element(sorted.begin(), sorted.begin() + n / 10, sorted.end());
+    float floorDb = sorted[n / 10];
+    std::nth_element(sorted.begin(), sorted.begin() + (n * 9) / 10, sorted.end());
+    float peakDb = sorted[(n * 9) / 10];
+
+    // Without a quiet background (speech throughout) only the absolute floor applies
+    float threshold = peakDb - floorDb < config_.thresholdAboveFloorDb
+                          ? config_.absoluteFloorDb
+                          : std::max(floorDb + config_.thresholdAboveFloorDb, config_.absoluteFloorDb);
+
+    // Speech runs, bridging pauses shorter than minSilence
+    std::vector<std::pair<size_t, size_t>> regions;
+    size_t i = 0;
+    while (i < n) {
+        if (frameEnergyDb[i] <= threshold) {
+            ++i;
+            continue;
+        }
+        size_t start = i;
+        size_t lastSpeech = i;
+        size_t j = i + 1;
+        while (j < n && j - lastSpeech <= minSilence) {
+            if (frameEnergyDb[j] > threshold) {
+                lastSpeech = j;
+            }
+            ++j;
+        }
+        if (lastSpeech + 1 - start >= minSpeech) {
+            regions.emplace_back(start, lastSpeech + 1);
+        }
+        i = lastSpeech + 1;
+    }
+
+    size_t previousEnd = 0;
+    for (auto& region : regions) {
+        size_t start = region.first > padding ? region.first - padding : 0;
+        start = std::max(start, previousEnd);
+        size_t end = std::min(n, region.second + padding);
+
+        // Split long runs at the quietest frame of the second half of the window
+        while (end - start > maxFrames) {
+            size_t searchBegin = start + maxFrames / 2;
+            size_t searchEnd = start + maxFrames;
+            size_t cut = searchBegin;
+            for (size_t k = searchBegin; k < searchEnd; ++k) {
+                if (frameEnergyDb[k] < frameEnergyDb[cut]) {
+                    cut = k;
+                }
+            }
+            AudioSegment segment;
+            segment.index = segments.size();
+            segment.startFrame = start * frameSamples;
+            segment.endFrame = std::min(cut * frameSamples, totalFrames);
+            segments.push_back(segment);
+            start = cut;
+        }
+
+        AudioSegment segment;
+        segment.index = segments.size();
+        segment.startFrame = start * frameSamples;
+        segment.endFrame = std::min(end * frameSamples, totalFrames);
+        if (segment.endFrame > segment.startFrame) {
+            segments.push_back(segment);
+        }
+        previousEnd = end;
+    }
+
+    return segments;
+}
+
+// WhisperSegmentTranscriber Implementation
+
+WhisperSegmentTranscriber::WhisperSegmentTranscriber(std::shared_ptr<WhisperStatePool> pool)
+    : pool_(std::move(pool)) {
+}
+
+size_t WhisperSegmentTranscriber::getSlotCount() const {
+    return pool_ ? pool_->size() : 0;
+}
+
+size_t WhisperSegmentTranscriber::getThreadsPerSlot() const {
+    return pool_ ? static_cast<size_t>(pool_->getThreadsPerState()) : 1;
+}
+
+bool WhisperSegmentTranscriber::transcribeSegment(size_t slot, const std::vector<float>& audio,
+                                                  const std::string& language, bool wordTimings,
+                                                  std::vector<TranscriptionResult>& results) {
+    return pool_ && pool_->transcribe(slot, audio, language, wordTimings, results);
+}
+
+// WavFileProcessor Implementation
+
+WavFileProcessor::WavFileProcessor() : initialized_(false) {
+}
+
+bool WavFileProcessor::initialize() {
+    initialized_ = true;
+    return true;
+}
+
+AudioFileInfo WavFileProcessor::analyzeAudioFile(const std::string& filePath) {
+    AudioFileInfo info;
+    info.filePath = filePath;
+    info.fileName = std::filesystem::path(filePath).filename().string();
+    info.format = lowerExtension(filePath);
+
+    MappedAudioFile file;
+    if (!file.open(filePath)) {
+        info.metadata["error"] = file.getLastError();
+        return info;
+    }
+
+    info.fileSizeBytes = file.getFileSizeBytes();
+    info.durationSeconds = static_cast<float>(file.getDurationSeconds());
+    info.sampleRate = file.getSampleRate();
+    info.channels = file.getChannels();
+    return info;
+}
+
+std::vector<float> WavFileProcessor::loadAudioFile(const std::string& filePath) {
+    std::vector<float> samples;
+    MappedAudioFile file;
+    if (file.open(filePath)) {
+        file.readMonoResampled(0, file.getFrameCount(), TARGET_SAMPLE_RATE, samples);
+    }
+    return samples;
+}
+
+bool WavFileProcessor::processAudioFileInChunks(const std::string& filePath,
+                                                size_t chunkSizeSeconds,
+                                                std::function<void(const std::vector<float>&, size_t)> callback) {
+    MappedAudioFile file;
+    if (!file.open(filePath) || chunkSizeSeconds == 0) {
+        return false;
+    }
+
+    const size_t chunkFrames = static_cast<size_t>(file.getSampleRate()) * chunkSizeSeconds;
+    std::vector<float> chunk;
+    size_t index = 0;
+    for (size_t start = 0; start < file.getFrameCount(); start += chunkFrames, ++index) {
+        file.readMonoResampled(start, chunkFrames, TARGET_SAMPLE_RATE, chunk);
+        callback(chunk, index);
+    }
+    return true;
+}
+
+std::vector<std::string> WavFileProcessor::getSupportedFormats() const {
+    return {"wav", "pcm"};
+}
+
+bool WavFileProcessor::isFormatSupported(const std::string& filePath) const {
+    std::string ext = lowerExtension(filePath);
+    return ext == "wav" || ext == "pcm";
+}
+
+// TranscriptOutputFormatter Implementation
+
+TranscriptOutputFormatter::TranscriptOutputFormatter() : initialized_(false) {
+}
+
+bool TranscriptOutputFormatter::initialize() {
+    initialized_ = true;
+    return true;
+}
+
+std::string TranscriptOutputFormatter::formatResult(const TranscriptionResult& result,
+                                                    const std::string& format,
+                                                    bool includeTimestamps,
+                                                    bool includeWordTimings) {
+    return formatSegments({result}, format, includeTimestamps, includeWordTimings);
+}
+
+std::string TranscriptOutputFormatter::formatSegments(const std::vector<TranscriptionResult>& segments,
+                                                      const std::string& format,
+                                                      bool includeTimestamps,
+                                                      bool includeWordTimings) const {
+    std::ostringstream oss;
+
+    if (format == "srt" || format == "vtt") {
+        const char separator = format == "srt" ? ',' : '.';
+        if (format == "vtt") {
+            oss << "WEBVTT\n\n";
+        }
+        size_t cue = 0;
+        for (const auto& segment : segments) {
+            std::string text = trimText(segment.text);
+            if (text.empty()) {
+                continue;
+            }
+            if (format == "srt") {
+                oss << ++cue << "\n";
+            }
+            oss << formatTimestamp(segment.start_time_ms, separator) << " --> "
+                << formatTimestamp(segment.end_time_ms, separator) << "\n"
+                << text << "\n\n";
+        }
+        return oss.str();
+    }
+
+    if (format == "txt") {
+        for (const auto& segment : segments) {
+            std::string text = trimText(segment.text);
+            if (text.empty()) {
+                continue;
+            }
+            if (includeTimestamps) {
+                oss << "[" << formatTimestamp(segment.start_time_ms, '.') << " --> "
+                    << formatTimestamp(segment.end_time_ms, '.') << "] ";
+            }
+            oss << text << "\n";
+        }
+        return oss.str();
+    }
+
+    // JSON
+    std::string fullText;
+    oss << "{\"segments\":[";
+    bool first = true;
+    for (const auto& segment : segments) {
+        std::string text = trimText(segment.text);
+        if (text.empty()) {
+            continue;
+        }
+        if (!fullText.empty()) {
+            fullText += ' ';
+        }
+        fullText += text;
+
+        oss << (first ? "" : ",") << "{";
+        first = false;
+        if (includeTimestamps) {
+            oss << "\"start\":" << segment.start_time_ms / 1000.0 << ","
+                << "\"end\":" << segment.end_time_ms / 1000.0 << ",";
+        }
+        oss << "\"text\":\"" << escapeJson(text) << "\","
+            << "\"confidence\":" << segment.confidence;
+        if (includeWordTimings && !segment.word_timings.empty()) {
+            oss << ",\"words\":[";
+            for (size_t w = 0; w < segment.word_timings.size(); ++w) {
+                const auto& word = segment.word_timings[w];
+                oss << (w == 0 ? "" : ",") << "{\"word\":\"" << escapeJson(trimText(word.word))
+                    << "\",\"start\":" << word.start_ms / 1000.0 << ",\"end\":" << word.end_ms / 1000.0
+                    << ",\"confidence\":" << word.confidence << "}";
+            }
+            oss << "]";
+        }
+        oss << "}";
+    }
+    oss << "],\"text\":\"" << escapeJson(fullText) << "\"}";
+    return oss.str();
+}
+
+std::string TranscriptOutputFormatter::formatBatchResult(const BatchJobResult& jobResult,
+                                                         const std::string& format) {
+    std::ostringstream oss;
+
+    if (format == "txt") {
+        oss << "Job " << jobResult.jobId << ": " << statusToString(jobResult.finalStatus) << "\n"
+            << "Files: " << jobResult.successfulFiles << "/" << jobResult.totalFiles << " succeeded, "
+            << jobResult.failedFiles << " failed\n"
+            << "Processing time: " << jobResult.totalProcessingTime << "s\n";
+        for (const auto& output : jobResult.outputFiles) {
+            oss << "  " << output << "\n";
+        }
+        for (const auto& error : jobResult.errorMessages) {
+            oss << "  error: " << error << "\n";
+        }
+        return oss.str();
+    }
+
+    oss << "{\"jobId\":" << jobResult.jobId << ","
+        << "\"status\":\"" << statusToString(jobResult.finalStatus) << "\","
+        << "\"totalFiles\":" << jobResult.totalFiles << ","
+        << "\"successfulFiles\":" << jobResult.successfulFiles << ","
+        << "\"failedFiles\":" << jobResult.failedFiles << ","
+        << "\"totalProcessingTime\":" << jobResult.totalProcessingTime << ","
+        << "\"outputFiles\":[";
+    for (size_t i = 0; i < jobResult.outputFiles.size(); ++i) {
+        oss << (i == 0 ? "" : ",") << "\"" << escapeJson(jobResult.outputFiles[i]) << "\"";
+    }
+    oss << "],\"errors\":[";
+    for (size_t i = 0; i < jobResult.errorMessages.size(); ++i) {
+        oss << (i == 0 ? "" : ",") << "\"" << escapeJson(jobResult.errorMessages[i]) << "\"";
+    }
+    oss << "],\"statistics\":{";
+    bool first = true;
+    for (const auto& entry : jobResult.statistics) {
+        oss << (first ? "" : ",") << "\"" << escapeJson(entry.first) << "\":\""
+            << escapeJson(entry.second) << "\"";
+        first = false;
+    }
+    oss << "}}";
+    return oss.str();
+}
+
+bool TranscriptOutputFormatter::saveToFile(const std::string& content, const std::string& outputPath) {
+    try {
+        std::filesystem::path path(outputPath);
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path());
+        }
+
+        // Write beside the target and rename, so readers never see a partial file
+        std::string tempPath = outputPath + ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                return false;
+            }
+            out << content;
+            if (!out) {
+                return false;
+            }
+        }
+        std::filesystem::rename(tempPath, outputPath);
+        return true;
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("Failed to save " + outputPath + ": " + e.what());
+        return false;
+    }
+}
+
+std::vector<std::string> TranscriptOutputFormatter::getSupportedFormats() const {
+    return {"json", "txt", "srt", "vtt"};
+}
+
+std::string TranscriptOutputFormatter::formatTimestamp(int64_t ms, char fractionSeparator) {
+    if (ms < 0) {
+        ms = 0;
+    }
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%02lld:%02lld:%02lld%c%03lld",
+                  static_cast<long long>(ms / 3600000), static_cast<long long>((ms / 60000) % 60),
+                  static_cast<long long>((ms / 1000) % 60), fractionSeparator,
+                  static_cast<long long>(ms % 1000));
+    return buffer;
+}
+
+// BatchCheckpoint Implementation
+
+BatchCheckpoint::~BatchCheckpoint() {
+    close();
+}
+
+bool BatchCheckpoint::open(const std::string& path) {
+    close();
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_ = path;
+    segments_.clear();
+    completedFiles_.clear();
+
+    bool needsNewline = false;
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string line;
+        while (std::getline(in, line)) {
+            parseLine(line);
+        }
+        // A crash can leave the last record without its newline
+        if (in.eof() && !line.empty()) {
+            needsNewline = true;
+        }
+    }
+
+    stream_ = std::fopen(path.c_str(), "a");
+    if (!stream_) {
+        return false;
+    }
+    if (needsNewline) {
+        std::fputc('\n', stream_);
+    }
+    return true;
+}
+
+void BatchCheckpoint::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stream_) {
+        std::fclose(stream_);
+        stream_ = nullptr;
+    }
+}
+
+void BatchCheckpoint::parseLine(const std::string& line) {
+    std::vector<std::string> fields = splitFields(line);
+    try {
+        if (fields.size() == 3 && fields[0] == "F") {
+            completedFiles_[unescapeField(fields[1])] = unescapeField(fields[2]);
+        } else if (fields.size() >= 5 && fields[0] == "S" && (fields.size() - 5) % 4 == 0) {
+            SegmentRecord record;
+            record.startFrame = std::stoull(fields[3]);
+            record.endFrame = std::stoull(fields[4]);
+            for (size_t f = 5; f < fields.size(); f += 4) {
+                TranscriptionResult result;
+                result.start_time_ms = std::stoll(fields[f]);
+                result.end_time_ms = std::stoll(fields[f + 1]);
+                result.confidence = std::stof(fields[f + 2]);
+                result.text = unescapeField(fields[f + 3]);
+                result.is_partial = false;
+                record.results.push_back(std::move(result));
+            }
+            segments_[unescapeField(fields[1])][std::stoull(fields[2])] = std::move(record);
+        }
+    } catch (const std::exception&) {
+        // Torn or corrupt record; the segment is simply decoded again
+    }
+}
+
+bool BatchCheckpoint::isFileComplete(const std::string& file) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return completedFiles_.count(file) > 0;
+}
+
+std::string BatchCheckpoint::getOutputFile(const std::string& file) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = completedFiles_.find(file);
+    return it != completedFiles_.end() ? it->second : "";
+}
+
+const BatchCheckpoint::SegmentRecord* BatchCheckpoint::findSegment(const std::string& file,
+                                                                    size_t segmentIndex) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto fileIt = segments_.find(file);
+    if (fileIt == segments_.end()) {
+        return nullptr;
+    }
+    auto it = fileIt->second.find(segmentIndex);
+    return it != fileIt->second.end() ? &it->second : nullptr;
+}
+
+bool BatchCheckpoint::recordSegment(const std::string& file, size_t segmentIndex,
+                                    const AudioSegment& segment,
+                                    const std::vector<TranscriptionResult>& results) {
+    std::ostringstream line;
+    line << "S\t" << escapeField(file) << "\t" << segmentIndex << "\t" << segment.startFrame << "\t"
+         << segment.endFrame;
+    for (const auto& result : results) {
+        line << "\t" << result.start_time_ms << "\t" << result.end_time_ms << "\t" << result.confidence
+             << "\t" << escapeField(result.text);
+    }
+    line << "\n";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!stream_) {
+        return false;
+    }
+    std::string text = line.str();
+    bool ok = std::fwrite(text.data(), 1, text.size(), stream_) == text.size() && std::fflush(stream_) == 0;
+    return ok;
+}
+
+bool BatchCheckpoint::recordFileComplete(const std::string& file, const std::string& outputPath) {
+    std::string line = "F\t" + escapeField(file) + "\t" + escapeField(outputPath) + "\n";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!stream_) {
+        return false;
+    }
+    bool ok = std::fwrite(line.data(), 1, line.size(), stream_) == line.size() && std::fflush(stream_) == 0;
+    // File boundaries are the expensive restart points, so make them durable
+    fsync(fileno(stream_));
+    completedFiles_[file] = outputPath;
+    return ok;
+}
+
+void BatchCheckpoint::remove() {
+    close();
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::error_code ec;
+    std::filesystem::remove(path_, ec);
+}
+
+// BatchJobControl Implementation
+
+void BatchJobControl::cancel() {
+    cancelled_ = true;
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = false;
+    cv_.notify_all();
+}
+
+void BatchJobControl::pause() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = true;
+}
+
+void BatchJobControl::resume() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = false;
+    cv_.notify_all();
+}
+
+bool BatchJobControl::isPaused() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return paused_;
+}
+
+bool BatchJobControl::waitWhilePaused() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !paused_ || cancelled_; });
+    return !cancelled_;
+}
+
+// PriorityBatchJobQueue Implementation
+
+PriorityBatchJobQueue::PriorityBatchJobQueue()
+    : initialized_(false), processing_(false), paused_(false), maxConcurrentJobs_(4),
+      nextJobId_(1), nextSubmitOrder_(0) {
+}
+
+PriorityBatchJobQueue::~PriorityBatchJobQueue() {
+    stopProcessing();
+}
+
+bool PriorityBatchJobQueue::initialize(size_t maxConcurrentJobs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxConcurrentJobs_ = std::max<size_t>(1, maxConcurrentJobs);
+    initialized_ = true;
+    return true;
+}
+
+void PriorityBatchJobQueue::setJobRunner(JobRunner runner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    runner_ = std::move(runner);
+}
+
+uint32_t PriorityBatchJobQueue::addJob(const BatchJobRequest& request) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint32_t jobId = nextJobId_++;
+
+    JobEntry& entry = jobs_[jobId];
+    entry.request = request;
+    entry.control = std::make_shared<BatchJobControl>();
+    entry.submitOrder = nextSubmitOrder_++;
+    entry.progress.jobId = jobId;
+    entry.progress.status = BatchJobStatus::PENDING;
+    entry.progress.totalFiles = request.inputFiles.size();
+
+    pending_.insert(jobId);
+    cv_.notify_one();
+    return jobId;
+}
+
+bool PriorityBatchJobQueue::removeJob(uint32_t jobId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_.count(jobId) > 0) {
+        return false;
+    }
+    pending_.erase(jobId);
+    return jobs_.erase(jobId) > 0;
+}
+
+bool PriorityBatchJobQueue::startProcessing() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!initialized_ || !runner_ || processing_) {
+        return false;
+    }
+    processing_ = true;
+    for (size_t i = 0; i < maxConcurrentJobs_; ++i) {
+        workers_.emplace_back(&PriorityBatchJobQueue::workerLoop, this);
+    }
+    return true;
+}
+
+void PriorityBatchJobQueue::stopProcessing() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        processing_ = false;
+        for (uint32_t jobId : running_) {
+            jobs_[jobId].control->cancel();
+        }
+        cv_.notify_all();
+    }
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+void PriorityBatchJobQueue::pauseProcessing() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = true;
+    for (uint32_t jobId : running_) {
+        jobs_[jobId].control->pause();
+        jobs_[jobId].progress.status = BatchJobStatus::PAUSED;
+    }
+}
+
+void PriorityBatchJobQueue::resumeProcessing() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = false;
+    for (uint32_t jobId : running_) {
+        jobs_[jobId].control->resume();
+        jobs_[jobId].progress.status = BatchJobStatus::RUNNING;
+    }
+    cv_.notify_all();
+}
+
+bool PriorityBatchJobQueue::popNextJob(uint32_t& jobId) {
+    auto best = pending_.end();
+    for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+        if (best == pending_.end()) {
+            best = it;
+            continue;
+        }
+        const JobEntry& candidate = jobs_[*it];
+        const JobEntry& current = jobs_[*best];
+        if (candidate.request.priority > current.request.priority ||
+            (candidate.request.priority == current.request.priority &&
+             candidate.submitOrder < current.submitOrder)) {
+            best = it;
+        }
+    }
+    if (best == pending_.end()) {
+        return false;
+    }
+    jobId = *best;
+    pending_.erase(best);
+    return true;
+}
+
+void PriorityBatchJobQueue::workerLoop() {
+    while (true) {
+        uint32_t jobId = 0;
+        BatchJobRequest request;
+        std::shared_ptr<BatchJobControl> control;
+        JobRunner runner;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return !processing_ || (!paused_ && !pending_.empty()); });
+            if (!processing_) {
+                return;
+            }
+            if (!popNextJob(jobId)) {
+                continue;
+            }
+            JobEntry& entry = jobs_[jobId];
+            entry.progress.status = BatchJobStatus::RUNNING;
+            entry.progress.startTime = std::chrono::steady_clock::now();
+            request = entry.request;
+            control = entry.control;
+            runner = runner_;
+            running_.insert(jobId);
+        }
+
+        BatchJobResult result = runner(jobId, request, *control);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_.erase(jobId);
+        auto it = jobs_.find(jobId);
+        if (it != jobs_.end()) {
+            BatchJobProgress& progress = it->second.progress;
+            progress.status = result.finalStatus;
+            progress.processedFiles = result.successfulFiles + result.failedFiles;
+            progress.failedFiles = result.failedFiles;
+            progress.overallProgress = result.finalStatus == BatchJobStatus::COMPLETED ? 1.0f
+                                                                                       : progress.overallProgress;
+            progress.errorMessages = result.errorMessages;
+        }
+    }
+}
+
+BatchJobProgress PriorityBatchJobQueue::getJobProgress(uint32_t jobId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = jobs_.find(jobId);
+    if (it == jobs_.end()) {
+        BatchJobProgress progress;
+        progress.jobId = jobId;
+        progress.status = BatchJobStatus::FAILED;
+        progress.errorMessages.push_back("Unknown job");
+        return progress;
+    }
+    return it->second.progress;
+}
+
+std::map<uint32_t, BatchJobProgress> PriorityBatchJobQueue::getAllJobProgress() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<uint32_t, BatchJobProgress> all;
+    for (const auto& entry : jobs_) {
+        all[entry.first] = entry.second.progress;
+    }
+    return all;
+}
+
+bool PriorityBatchJobQueue::cancelJob(uint32_t jobId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = jobs_.find(jobId);
+    if (it == jobs_.end()) {
+        return false;
+    }
+    if (pending_.erase(jobId) > 0) {
+        it->second.progress.status = BatchJobStatus::CANCELLED;
+        return true;
+    }
+    if (running_.count(jobId) > 0) {
+        it->second.control->cancel();
+        return true;
+    }
+    return false;
+}
+
+bool PriorityBatchJobQueue::setJobPriority(uint32_t jobId, BatchJobPriority priority) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.count(jobId) == 0) {
+        return false;
+    }
+    jobs_[jobId].request.priority = priority;
+    return true;
+}
+
+std::shared_ptr<BatchJobControl> PriorityBatchJobQueue::getJobControl(uint32_t jobId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = jobs_.find(jobId);
+    return it != jobs_.end() ? it->second.control : nullptr;
+}
+
+void PriorityBatchJobQueue::updateJobProgress(uint32_t jobId,
+                                              const std::function<void(BatchJobProgress&)>& update) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = jobs_.find(jobId);
+    if (it != jobs_.end()) {
+        update(it->second.progress);
+    }
+}
+
+std::string PriorityBatchJobQueue::getQueueStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<BatchJobStatus, size_t> counts;
+    for (const auto& entry : jobs_) {
+        counts[entry.second.progress.status]++;
+    }
+
+    std::ostringstream oss;
+    oss << "{"
+        << "\"totalJobs\":" << jobs_.size() << ","
+        << "\"pendingJobs\":" << pending_.size() << ","
+        << "\"runningJobs\":" << running_.size() << ","
+        << "\"completedJobs\":" << counts[BatchJobStatus::COMPLETED] << ","
+        << "\"failedJobs\":" << counts[BatchJobStatus::FAILED] << ","
+        << "\"cancelledJobs\":" << counts[BatchJobStatus::CANCELLED] << ","
+        << "\"maxConcurrentJobs\":" << maxConcurrentJobs_ << ","
+        << "\"paused\":" << (paused_ ? "true" : "false")
+        << "}";
+    return oss.str();
+}
+
+// BatchProcessingManager Implementation
+
+BatchProcessingManager::BatchProcessingManager(std::shared_ptr<SegmentTranscriber> transcriber)
+    : initialized_(false), transcriber_(std::move(transcriber)), coresInUse_(0), stopWorkers_(false) {
+}
+
+BatchProcessingManager::~BatchProcessingManager() {
+    shutdown();
+}
+
+bool BatchProcessingManager::initialize(const BatchProcessingConfig& config) {
+    if (initialized_) {
+        shutdown();
+    }
+
+    config_ = config;
+    outputDirectory_ = config.getStringParameter("outputDirectory", "batch_output");
+
+    if (!transcriber_) {
+        std::string modelPath = config.getStringParameter("modelPath");
+        if (modelPath.empty()) {
+            setError("No segment transcriber and no modelPath configured");
+            return false;
+        }
+
+        int threadsPerSlot = std::max(1, config.getIntParameter("threadsPerSlot", 1));
+        int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        int slots = std::max(1, config.getIntParameter("transcriberSlots", hardware / threadsPerSlot));
+
+        auto pool = std::make_shared<WhisperStatePool>();
+        if (!pool->initialize(modelPath, static_cast<size_t>(slots), threadsPerSlot,
+                              config.getBoolParameter("useGPU", false))) {
+            setError("Failed to create whisper state pool: " + pool->getLastError());
+            return false;
+        }
+        transcriber_ = std::make_shared<WhisperSegmentTranscriber>(pool);
+    }
+
+    if (transcriber_->getSlotCount() == 0) {
+        setError("Segment transcriber has no slots");
+        return false;
+    }
+
+    fileProcessor_ = std::make_unique<WavFileProcessor>();
+    fileProcessor_->initialize();
+    formatter_ = std::make_unique<TranscriptOutputFormatter>();
+    formatter_->initialize();
+
+    VadSegmenter::Config segmenterConfig;
+    segmenterConfig.maxSegmentSeconds =
+        static_cast<float>(std::min<size_t>(std::max<size_t>(config.chunkSizeSeconds, 1), 30));
+    segmenter_ = VadSegmenter(segmenterConfig);
+
+    startSegmentWorkers();
+
+    queue_ = std::make_unique<PriorityBatchJobQueue>();
+    queue_->initialize(config.maxConcurrentJobs);
+    queue_->setJobRunner([this](uint32_t jobId, const BatchJobRequest& request, BatchJobControl& control) {
+        return runJob(jobId, request, control);
+    });
+    queue_->startProcessing();
+
+    initialized_ = true;
+    speechrnt::utils::Logger::info("BatchProcessingManager initialized with " +
+                                   std::to_string(segmentWorkers_.size()) + " segment workers, " +
+                                   std::to_string(config.maxConcurrentJobs) + " concurrent jobs");
+    return true;
+}
+
+void BatchProcessingManager::startSegmentWorkers() {
+    size_t workers = config_.enableParallelProcessing ? transcriber_->getSlotCount() : 1;
+    {
+        std::lock_guard<std::mutex> lock(segmentMutex_);
+        stopWorkers_ = false;
+    }
+    for (size_t slot = 0; slot < workers; ++slot) {
+        segmentWorkers_.emplace_back(&BatchProcessingManager::segmentWorkerLoop, this, slot);
+    }
+    coresInUse_ = workers * transcriber_->getThreadsPerSlot();
+}
+
+void BatchProcessingManager::stopSegmentWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(segmentMutex_);
+        stopWorkers_ = true;
+    }
+    segmentCv_.notify_all();
+    for (auto& worker : segmentWorkers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    segmentWorkers_.clear();
+}
+
+void BatchProcessingManager::segmentWorkerLoop(size_t slot) {
+    while (true) {
+        SegmentTask task;
+        {
+            std::unique_lock<std::mutex> lock(segmentMutex_);
+            while (true) {
+                // Segments of paused jobs stay queued so other jobs keep the workers
+                auto next = std::find_if(segmentTasks_.begin(), segmentTasks_.end(),
+                                         [](const SegmentTask& t) { return !t.control->isPaused(); });
+                if (next != segmentTasks_.end()) {
+                    task = std::move(*next);
+                    segmentTasks_.erase(next);
+                    break;
+                }
+                if (stopWorkers_ && segmentTasks_.empty()) {
+                    return;
+                }
+                // Resuming a job does not signal this condition, so poll
+                segmentCv_.wait_for(lock, std::chrono::milliseconds(50));
+            }
+        }
+        task.run(slot);
+    }
+}
+
+void BatchProcessingManager::enqueueSegmentTask(SegmentTask task) {
+    {
+        std::lock_guard<std::mutex> lock(segmentMutex_);
+        segmentTasks_.push_back(std::move(task));
+    }
+    segmentCv_.notify_one();
+}
+
+FileProcessingResult BatchProcessingManager::transcribeFile(const std::string& filePath,
+                                                            const BatchJobConfig& config,
+                                                            BatchJobControl& control,
+                                                            BatchCheckpoint* checkpoint,
+                                                            std::vector<TranscriptionResult>& segments,
+                                                            const std::function<void(float)>& progress) {
+    FileProcessingResult result;
+    result.inputFile = filePath;
+    segments.clear();
+    auto start = std::chrono::steady_clock::now();
+
+    MappedAudioFile file;
+    if (!file.open(filePath)) {
+        result.errorMessage = file.getLastError();
+        return result;
+    }
+
+    const std::vector<AudioSegment> audioSegments = segmenter_.segment(file);
+    const double framesPerMs = file.getSampleRate() / 1000.0;
+
+    // Shared between this thread and the segment workers until every task has
+    // reported back
+    struct FileState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<std::vector<TranscriptionResult>> results;
+        size_t remaining = 0;
+        size_t completed = 0;
+        bool failed = false;
+        std::string error;
+        double busySeconds = 0.0;
+    } state;
+    state.results.resize(audioSegments.size());
+
+    size_t resumed = 0;
+    std::vector<const AudioSegment*> toDecode;
+    for (const auto& segment : audioSegments) {
+        const BatchCheckpoint::SegmentRecord* record =
+            checkpoint ? checkpoint->findSegment(filePath, segment.index) : nullptr;
+        if (record && record->startFrame == segment.startFrame && record->endFrame == segment.endFrame) {
+            state.results[segment.index] = record->results;
+            ++resumed;
+        } else {
+            toDecode.push_back(&segment);
+        }
+    }
+    state.remaining = toDecode.size();
+    state.completed = resumed;
+
+    const std::string language = config.language.empty() ? "auto" : config.language;
+    const bool wordTimings = config.generateWordTimings;
+    const size_t total = audioSegments.size();
+
+    for (const AudioSegment* segment : toDecode) {
+        enqueueSegmentTask({&control, [&, segment](size_t slot) {
+            std::vector<TranscriptionResult> decoded;
+            bool ok = true;
+            std::string error;
+            auto decodeStart = std::chrono::steady_clock::now();
+
+            if (!control.isCancelled()) {
+                std::vector<float> audio;
+                file.readMonoResampled(segment->startFrame, segment->endFrame - segment->startFrame,
+                                       WavFileProcessor::TARGET_SAMPLE_RATE, audio);
+                ok = transcriber_->transcribeSegment(slot, audio, language, wordTimings, decoded);
+                if (ok) {
+                    // Shift segment-relative timings onto the file timeline
+                    auto offsetMs = static_cast<int64_t>(segment->startFrame / framesPerMs);
+                    for (auto& item : decoded) {
+                        item.start_time_ms += offsetMs;
+                        item.end_time_ms += offsetMs;
+                        for (auto& word : item.word_timings) {
+                            word.start_ms += offsetMs;
+                            word.end_ms += offsetMs;
+                        }
+                    }
+                    if (checkpoint) {
+                        checkpoint->recordSegment(filePath, segment->index, *segment, decoded);
+                    }
+                } else {
+                    error = "Segment " + std::to_string(segment->index) + " failed to decode";
+                }
+            }
+            double busy = secondsSince(decodeStart);
+
+            float fraction = 0.0f;
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                fraction = static_cast<float>(++state.completed) / static_cast<float>(total);
+            }
+            if (progress) {
+                progress(fraction);
+            }
+
+            // Last touch of the file state: the waiter may return right after
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.results[segment->index] = std::move(decoded);
+            state.busySeconds += busy;
+            if (!ok && !state.failed) {
+                state.failed = true;
+                state.error = error;
+            }
+            --state.remaining;
+            state.cv.notify_all();
+        }});
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.cv.wait(lock, [&state] { return state.remaining == 0; });
+    }
+
+    if (control.isCancelled()) {
+        result.errorMessage = "Cancelled";
+        return result;
+    }
+    if (state.failed) {
+        result.errorMessage = state.error;
+        return result;
+    }
+
+    // Stitch in segment order
+    std::string text;
+    double weightedConfidence = 0.0;
+    double weightMs = 0.0;
+    for (auto& decoded : state.results) {
+        for (auto& item : decoded) {
+            std::string itemText = trimText(item.text);
+            if (!itemText.empty()) {
+                if (!text.empty()) {
+                    text += ' ';
+                }
+                text += itemText;
+                double duration = static_cast<double>(std::max<int64_t>(1, item.end_time_ms - item.start_time_ms));
+                weightedConfidence += item.confidence * duration;
+                weightMs += duration;
+            }
+            segments.push_back(std::move(item));
+        }
+    }
+
+    result.success = true;
+    result.transcriptionResult.text = text;
+    result.transcriptionResult.is_partial = false;
+    result.transcriptionResult.start_time_ms = 0;
+    result.transcriptionResult.end_time_ms = static_cast<int64_t>(file.getDurationSeconds() * 1000.0);
+    result.transcriptionResult.confidence = weightMs > 0.0 ? static_cast<float>(weightedConfidence / weightMs) : 0.0f;
+    result.transcriptionResult.detected_language = language;
+    result.processingTimeSeconds = static_cast<float>(secondsSince(start));
+    result.metadata["segments"] = std::to_string(total);
+    result.metadata["segmentsResumed"] = std::to_string(resumed);
+    result.metadata["audioSeconds"] = std::to_string(file.getDurationSeconds());
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.filesProcessed++;
+        stats_.segmentsTranscribed += toDecode.size();
+        stats_.segmentsResumed += resumed;
+        stats_.audioSecondsProcessed += file.getDurationSeconds();
+        stats_.wallSecondsProcessing += result.processingTimeSeconds;
+        stats_.segmentBusySeconds += state.busySeconds;
+    }
+
+    return result;
+}
+
+BatchJobResult BatchProcessingManager::runJob(uint32_t jobId, const BatchJobRequest& request,
+                                              BatchJobControl& control) {
+    BatchJobResult result;
+    result.jobId = jobId;
+    result.totalFiles = request.inputFiles.size();
+    result.startTime = std::chrono::steady_clock::now();
+
+    BatchJobConfig config = request.config;
+    if (config.outputDirectory.empty()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        config.outputDirectory = outputDirectory_;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(config.outputDirectory, ec);
+
+    BatchCheckpoint checkpoint;
+    bool checkpointing = checkpoint.open(getCheckpointPath(request, config.outputDirectory));
+    if (!checkpointing) {
+        speechrnt::utils::Logger::warn("Batch job " + std::to_string(jobId) +
+                                       " running without checkpoint: " + checkpoint.getPath());
+    }
+
+    double audioSeconds = 0.0;
+    auto reportProgress = [&](size_t fileIndex, float fileProgress) {
+        BatchJobProgress snapshot;
+        queue_->updateJobProgress(jobId, [&](BatchJobProgress& progress) {
+            progress.currentFile = fileIndex < request.inputFiles.size() ? request.inputFiles[fileIndex] : "";
+            progress.currentFileProgress = fileProgress;
+            progress.processedFiles = result.successfulFiles + result.failedFiles;
+            progress.failedFiles = result.failedFiles;
+            progress.overallProgress = result.totalFiles > 0
+                ? (static_cast<float>(fileIndex) + fileProgress) / static_cast<float>(result.totalFiles)
+                : 1.0f;
+
+            double elapsed = secondsSince(progress.startTime);
+            if (elapsed > 0.0 && progress.overallProgress > 0.0f) {
+                progress.averageProcessingSpeed = static_cast<float>(progress.processedFiles / (elapsed / 60.0));
+                double remaining = elapsed * (1.0 - progress.overallProgress) / progress.overallProgress;
+                progress.estimatedCompletionTime = std::chrono::steady_clock::now() +
+                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(remaining));
+            }
+            snapshot = progress;
+        });
+        if (request.progressCallback) {
+            request.progressCallback(snapshot);
+        }
+    };
+
+    for (size_t i = 0; i < request.inputFiles.size(); ++i) {
+        if (!control.waitWhilePaused()) {
+            break;
+        }
+
+        const std::string& inputFile = request.inputFiles[i];
+        reportProgress(i, 0.0f);
+
+        std::string previousOutput = checkpointing ? checkpoint.getOutputFile(inputFile) : "";
+        if (!previousOutput.empty() && std::filesystem::exists(previousOutput)) {
+            result.successfulFiles++;
+            result.outputFiles.push_back(previousOutput);
+            continue;
+        }
+
+        std::vector<TranscriptionResult> segments;
+        FileProcessingResult fileResult = transcribeFile(
+            inputFile, config, control, checkpointing ? &checkpoint : nullptr, segments,
+            [&](float fraction) { reportProgress(i, fraction); });
+
+        if (control.isCancelled()) {
+            break;
+        }
+
+        if (fileResult.success) {
+            fileResult.outputFile = buildOutputPath(inputFile, config);
+            std::string content = formatter_->formatSegments(segments, config.outputFormat,
+                                                             config.preserveTimestamps,
+                                                             config.generateWordTimings);
+            if (formatter_->saveToFile(content, fileResult.outputFile)) {
+                if (checkpointing) {
+                    checkpoint.recordFileComplete(inputFile, fileResult.outputFile);
+                }
+                result.successfulFiles++;
+                result.outputFiles.push_back(fileResult.outputFile);
+                audioSeconds += std::stod(fileResult.metadata["audioSeconds"]);
+            } else {
+                fileResult.success = false;
+                fileResult.errorMessage = "Failed to write " + fileResult.outputFile;
+            }
+        }
+
+        if (!fileResult.success) {
+            result.failedFiles++;
+            result.errorMessages.push_back(inputFile + ": " + fileResult.errorMessage);
+            speechrnt::utils::Logger::warn("Batch job " + std::to_string(jobId) + " failed on " +
+                                           inputFile + ": " + fileResult.errorMessage);
+        }
+
+        if (request.fileCompletionCallback) {
+            request.fileCompletionCallback(fileResult);
+        }
+        reportProgress(i + 1, 0.0f);
+    }
+
+    result.endTime = std::chrono::steady_clock::now();
+    result.totalProcessingTime = static_cast<float>(
+        std::chrono::duration<double>(result.endTime - result.startTime).count());
+
+    if (control.isCancelled()) {
+        result.finalStatus = BatchJobStatus::CANCELLED;
+    } else if (result.successfulFiles == 0 && result.failedFiles > 0) {
+        result.finalStatus = BatchJobStatus::FAILED;
+    } else {
+        result.finalStatus = BatchJobStatus::COMPLETED;
+    }
+
+    // A finished job needs no restart point; failures keep it for a retry
+    if (checkpointing && result.finalStatus == BatchJobStatus::COMPLETED && result.failedFiles == 0 &&
+        config.customParameters.count("keepCheckpoint") == 0) {
+        checkpoint.remove();
+    }
+
+    double realtimeFactor = result.totalProcessingTime > 0.0f ? audioSeconds / result.totalProcessingTime : 0.0;
+    result.statistics["audioSeconds"] = std::to_string(audioSeconds);
+    result.statistics["realtimeFactor"] = std::to_string(realtimeFactor);
+    result.statistics["audioHoursPerHourPerCore"] =
+        std::to_string(coresInUse_ > 0 ? realtimeFactor / coresInUse_ : 0.0);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (result.finalStatus == BatchJobStatus::FAILED) {
+            stats_.jobsFailed++;
+        } else if (result.finalStatus == BatchJobStatus::COMPLETED) {
+            stats_.jobsCompleted++;
+        }
+        results_[jobId] = result;
+        history_.push_back(jobId);
+        while (history_.size() > 1000) {
+            results_.erase(history_.front());
+            history_.pop_front();
+        }
+    }
+    resultsCv_.notify_all();
+
+    if (request.completionCallback) {
+        request.completionCallback(result);
+    }
+    return result;
+}
+
+uint32_t BatchProcessingManager::submitBatchJob(const BatchJobRequest& request) {
+    if (!initialized_) {
+        setError("BatchProcessingManager not initialized");
+        return 0;
+    }
+    if (request.inputFiles.empty()) {
+        setError("Batch job has no input files");
+        return 0;
+    }
+    return queue_->addJob(request);
+}
+
+bool BatchProcessingManager::cancelBatchJob(uint32_t jobId) {
+    return initialized_ && queue_->cancelJob(jobId);
+}
+
+bool BatchProcessingManager::pauseBatchJob(uint32_t jobId) {
+    auto control = initialized_ ? queue_->getJobControl(jobId) : nullptr;
+    if (!control) {
+        return false;
+    }
+    control->pause();
+    queue_->updateJobProgress(jobId, [](BatchJobProgress& progress) {
+        if (progress.status == BatchJobStatus::RUNNING) {
+            progress.status = BatchJobStatus::PAUSED;
+        }
+    });
+    return true;
+}
+
+bool BatchProcessingManager::resumeBatchJob(uint32_t jobId) {
+    auto control = initialized_ ? queue_->getJobControl(jobId) : nullptr;
+    if (!control) {
+        return false;
+    }
+    control->resume();
+    queue_->updateJobProgress(jobId, [](BatchJobProgress& progress) {
+        if (progress.status == BatchJobStatus::PAUSED) {
+            progress.status = BatchJobStatus::RUNNING;
+        }
+    });
+    return true;
+}
+
+BatchJobProgress BatchProcessingManager::getJobProgress(uint32_t jobId) const {
+    if (!initialized_) {
+        return BatchJobProgress();
+    }
+    return queue_->getJobProgress(jobId);
+}
+
+BatchJobResult BatchProcessingManager::getJobResult(uint32_t jobId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = results_.find(jobId);
+    if (it != results_.end()) {
+        return it->second;
+    }
+    BatchJobResult pending;
+    pending.jobId = jobId;
+    return pending;
+}
+
+bool BatchProcessingManager::waitForJob(uint32_t jobId, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return resultsCv_.wait_for(lock, timeout, [this, jobId] { return results_.count(jobId) > 0; });
+}
+
+std::map<uint32_t, BatchJobProgress> BatchProcessingManager::getActiveJobs() const {
+    std::map<uint32_t, BatchJobProgress> active;
+    if (!initialized_) {
+        return active;
+    }
+    for (const auto& entry : queue_->getAllJobProgress()) {
+        BatchJobStatus status = entry.second.status;
+        if (status == BatchJobStatus::PENDING || status == BatchJobStatus::RUNNING ||
+            status == BatchJobStatus::PAUSED) {
+            active.insert(entry);
+        }
+    }
+    return active;
+}
+
+std::vector<BatchJobResult> BatchProcessingManager::getJobHistory(size_t maxJobs) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<BatchJobResult> history;
+    for (auto it = history_.rbegin(); it != history_.rend() && history.size() < maxJobs; ++it) {
+        history.push_back(results_.at(*it));
+    }
+    return history;
+}
+
+void BatchProcessingManager::setMaxConcurrentJobs(size_t maxJobs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Job threads are created at initialize(); takes effect on the next one
+    config_.maxConcurrentJobs = std::max<size_t>(1, maxJobs);
+}
+
+void BatchProcessingManager::setDefaultChunkSize(size_t chunkSizeSeconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_.chunkSizeSeconds = std::max<size_t>(1, chunkSizeSeconds);
+}
+
+void BatchProcessingManager::setParallelProcessingEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_.enableParallelProcessing = enabled;
+}
+
+void BatchProcessingManager::setOutputDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    outputDirectory_ = directory;
+}
+
+std::string BatchProcessingManager::getProcessingStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    double realtimeFactor = stats_.wallSecondsProcessing > 0.0
+                                ? stats_.audioSecondsProcessed / stats_.wallSecondsProcessing
+                                : 0.0;
+    double perCore = coresInUse_ > 0 ? realtimeFactor / coresInUse_ : 0.0;
+
+    std::ostringstream oss;
+    oss << "{"
+        << "\"jobsCompleted\":" << stats_.jobsCompleted << ","
+        << "\"jobsFailed\":" << stats_.jobsFailed << ","
+        << "\"filesProcessed\":" << stats_.filesProcessed << ","
+        << "\"segmentsTranscribed\":" << stats_.segmentsTranscribed << ","
+        << "\"segmentsResumed\":" << stats_.segmentsResumed << ","
+        << "\"audioHoursProcessed\":" << stats_.audioSecondsProcessed / 3600.0 << ","
+        << "\"realtimeFactor\":" << realtimeFactor << ","
+        << "\"audioHoursPerHourPerCore\":" << perCore << ","
+        << "\"segmentWorkerBusySeconds\":" << stats_.segmentBusySeconds << ","
+        << "\"coresInUse\":" << coresInUse_
+        << "}";
+    return oss.str();
+}
+
+std::vector<std::string> BatchProcessingManager::getSupportedAudioFormats() const {
+    return WavFileProcessor().getSupportedFormats();
+}
+
+std::vector<std::string> BatchProcessingManager::getSupportedOutputFormats() const {
+    return TranscriptOutputFormatter().getSupportedFormats();
+}
+
+std::map<std::string, bool> BatchProcessingManager::validateAudioFiles(const std::vector<std::string>& filePaths) const {
+    std::map<std::string, bool> valid;
+    for (const auto& path : filePaths) {
+        MappedAudioFile file;
+        valid[path] = file.open(path) && file.getFrameCount() > 0;
+    }
+    return valid;
+}
+
+float BatchProcessingManager::estimateProcessingTime(const std::vector<std::string>& filePaths,
+                                                     const BatchJobConfig& config) const {
+    (void)config;
+    double audioSeconds = 0.0;
+    for (const auto& path : filePaths) {
+        MappedAudioFile file;
+        if (file.open(path)) {
+            audioSeconds += file.getDurationSeconds();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Observed aggregate speed once files have been processed, otherwise assume
+    // each worker keeps up with real time
+    double realtimeFactor = stats_.wallSecondsProcessing > 0.0
+                                ? stats_.audioSecondsProcessed / stats_.wallSecondsProcessing
+                                : static_cast<double>(std::max<size_t>(1, segmentWorkers_.size()));
+    return static_cast<float>(audioSeconds / std::max(realtimeFactor, 1e-3));
+}
+
+bool BatchProcessingManager::updateConfiguration(const BatchProcessingConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_ = config;
+    VadSegmenter::Config segmenterConfig = segmenter_.getConfig();
+    segmenterConfig.maxSegmentSeconds =
+        static_cast<float>(std::min<size_t>(std::max<size_t>(config.chunkSizeSeconds, 1), 30));
+    segmenter_ = VadSegmenter(segmenterConfig);
+    return true;
+}
+
+BatchProcessingConfig BatchProcessingManager::getCurrentConfiguration() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+}
+
+std::string BatchProcessingManager::getLastError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastError_;
+}
+
+void BatchProcessingManager::shutdown() {
+    if (!initialized_) {
+        return;
+    }
+    // Jobs wait on segment tasks, so stop the job threads while the segment
+    // workers can still drain the cancelled work
+    queue_->stopProcessing();
+    stopSegmentWorkers();
+    initialized_ = false;
+}
+
+std::string BatchProcessingManager::getCheckpointPath(const BatchJobRequest& request,
+                                                      const std::string& outputDirectory) {
+    // FNV-1a over the input list identifies the same job across restarts
+    uint64_t hash = 1469598103934665603ULL;
+    for (const auto& file : request.inputFiles) {
+        for (unsigned char c : file) {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+        hash = (hash ^ 0xff) * 1099511628211ULL;
+    }
+
+    std::string name = request.jobName.empty() ? "batch" : request.jobName;
+    for (char& c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_') {
+            c = '_';
+        }
+    }
+
+    std::ostringstream oss;
+    oss << "." << name << "-" << std::hex << hash << ".checkpoint";
+    return (std::filesystem::path(outputDirectory) / oss.str()).string();
+}
+
+std::string BatchProcessingManager::buildOutputPath(const std::string& inputFile,
+                                                    const BatchJobConfig& config) const {
+    std::string format = config.outputFormat.empty() ? "json" : config.outputFormat;
+    std::string stem = std::filesystem::path(inputFile).stem().string();
+    return (std::filesystem::path(config.outputDirectory) / (stem + "." + format)).string();
+}
+
+void BatchProcessingManager::setError(const std::string& error) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lastError_ = error;
+    }
+    speechrnt::utils::Logger::error("BatchProcessingManager: " + error);
+}
+
+} // namespace advanced
+} // namespace stt
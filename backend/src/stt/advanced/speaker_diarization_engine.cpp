@@ -227,11 +227,11 @@ std::vector<float> SimpleSpeakerEmbeddingModel::generateEmbedding(
     
     // Extract MFCC features from multiple windows
     std::vector<std::vector<float>> mfccFrames;
+    ::audio::FrameFeatures frame(getFrameTables(sampleRate));
     
     for (size_t i = 0; i + windowSize_ < audioData.size(); i += hopSize_) {
-        std::vector<float> window(audioData.begin() + i, audioData.begin() + i + windowSize_);
-        auto mfccFeatures = extractMFCCFeatures(window, sampleRate);
-        mfccFrames.push_back(mfccFeatures);
+        frame.assign(audioData.data() + i, windowSize_, i / hopSize_);
+        mfccFrames.push_back(frame.mfcc());
     }
     
     if (mfccFrames.empty()) {
@@ -315,106 +315,17 @@ float SimpleSpeakerEmbeddingModel::calculateSimilarity(
     return cosineSimilarity(embedding1, embedding2);
 }
 
-std::vector<float> SimpleSpeakerEmbeddingModel::extractMFCCFeatures(
-    const std::vector<float>& audioData, int sampleRate) {
-    
-    // Simplified MFCC extraction
-    // 1. Apply window function (Hamming)
-    std::vector<float> windowed = audioData;
-    for (size_t i = 0; i < windowed.size(); ++i) {
-        float hamming = 0.54f - 0.46f * std::cos(2.0f * M_PI * i / (windowed.size() - 1));
-        windowed[i] *= hamming;
-    }
-    
-    // 2. Compute FFT
-    auto spectrum = computeFFT(windowed);
-    
-    // 3. Compute power spectrum
-    std::vector<float> powerSpectrum;
-    for (size_t i = 0; i < spectrum.size() / 2; ++i) {
-        float magnitude = spectrum[i*2] * spectrum[i*2] + spectrum[i*2+1] * spectrum[i*2+1];
-        powerSpectrum.push_back(magnitude);
-    }
-    
-    // 4. Apply mel filter bank
-    auto melFeatures = computeMelFilterBank(powerSpectrum, sampleRate);
-    
-    // 5. Apply DCT
-    auto mfccFeatures = computeDCT(melFeatures);
-    
-    return mfccFeatures;
-}
-
-std::vector<float> SimpleSpeakerEmbeddingModel::computeMelFilterBank(
-    const std::vector<float>& spectrum, int sampleRate) {
-    
-    const size_t numFilters = 26;
-    const float minFreq = 0.0f;
-    const float maxFreq = sampleRate / 2.0f;
-    
-    // Convert to mel scale
-    auto hzToMel = [](float hz) { return 2595.0f * std::log10(1.0f + hz / 700.0f); };
-    auto melToHz = [](float mel) { return 700.0f * (std::pow(10.0f, mel / 2595.0f) - 1.0f); };
-    
-    float minMel = hzToMel(minFreq);
-    float maxMel = hzToMel(maxFreq);
-    
-    // Create mel filter bank
-    std::vector<float> melFilters(numFilters, 0.0f);
-    
-    for (size_t filter = 0; filter < numFilters; ++filter) {
-        float centerMel = minMel + (maxMel - minMel) * filter / (numFilters - 1);
-        float centerHz = melToHz(centerMel);
-        
-        // Simple triangular filter approximation
-        float filterResponse = 0.0f;
-        for (size_t bin = 0; bin < spectrum.size(); ++bin) {
-            float binHz = static_cast<float>(bin * sampleRate) / (2 * spectrum.size());
-            
-            if (std::abs(binHz - centerHz) < 100.0f) { // Simple bandwidth
-                float weight = 1.0f - std::abs(binHz - centerHz) / 100.0f;
-                filterResponse += spectrum[bin] * weight;
-            }
-        }
-        
-        melFilters[filter] = std::log(std::max(filterResponse, 1e-10f));
-    }
-    
-    return melFilters;
-}
-
-std::vector<float> SimpleSpeakerEmbeddingModel::computeDCT(const std::vector<float>& melFeatures) {
-    std::vector<float> dctFeatures(numMfccCoeffs_, 0.0f);
-    
-    for (size_t k = 0; k < numMfccCoeffs_; ++k) {
-        for (size_t n = 0; n < melFeatures.size(); ++n) {
-            dctFeatures[k] += melFeatures[n] * std::cos(M_PI * k * (n + 0.5f) / melFeatures.size());
-        }
-    }
-    
-    return dctFeatures;
-}
-
-std::vector<float> SimpleSpeakerEmbeddingModel::computeFFT(const std::vector<float>& window) {
-    // Reuse the FFT implementation from SimpleSpeakerDetectionModel
-    size_t N = window.size();
-    std::vector<float> result(N * 2, 0.0f);
-    
-    for (size_t k = 0; k < N; ++k) {
-        float realPart = 0.0f;
-        float imagPart = 0.0f;
-        
-        for (size_t n = 0; n < N; ++n) {
-            float angle = -2.0f * M_PI * k * n / N;
-            realPart += window[n] * std::cos(angle);
-            imagPart += window[n] * std::sin(angle);
-        }
-        
-        result[k * 2] = realPart;
-        result[k * 2 + 1] = imagPart;
-    }
-    
-    return result;
+std::shared_ptr<const ::audio::FrameAnalysisTables> SimpleSpeakerEmbeddingModel::getFrameTables(int sampleRate) {
+    std::lock_guard<std::mutex> lock(frameTablesMutex_);
+    if (!frameTables_ || frameTables_->getConfig().sampleRate != sampleRate) {
+        ::audio::FrameAnalysisConfig config;
+        config.sampleRate = sampleRate;
+        config.frameSize = windowSize_;
+        config.hopSize = hopSize_;
+        config.mfccCoefficients = numMfccCoeffs_;
+        frameTables_ = ::audio::FrameAnalysisTables::create(config);
+    }
+    return frameTables_;
 }
 
 float SimpleSpeakerEmbeddingModel::cosineSimilarity(
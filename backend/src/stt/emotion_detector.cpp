@@ -1,4 +1,5 @@
 #include "stt/emotion_detector.hpp"
+#include "audio/frame_features.hpp"
 #include "utils/logging.hpp"
 #include <algorithm>
 #include <numeric>
@@ -30,10 +31,13 @@ public:
         result.timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now().time_since_epoch()).count();
 
-        // Extract basic prosodic features
-        ProsodicFeatureExtractor extractor;
-        extractor.initialize(sample_rate);
-        result.prosodic_features = extractor.extractFeatures(audio_data);
+        // Extract basic prosodic features; the extractor's tables and pitch
+        // buffers are reused across calls
+        if (sample_rate != extractor_sample_rate_) {
+            extractor_.initialize(sample_rate);
+            extractor_sample_rate_ = sample_rate;
+        }
+        result.prosodic_features = extractor_.extractFeatures(audio_data);
 
         // Simple rule-based emotion detection based on prosodic features
         result.emotion_probabilities = analyzeProsodicFeatures(result.prosodic_features);
@@ -66,6 +70,8 @@ public:
 
 private:
     bool initialized_ = false;
+    ProsodicFeatureExtractor extractor_;
+    int extractor_sample_rate_ = 0;
 
     std::map<EmotionType, float> analyzeProsodicFeatures(const ProsodicFeatures& features) {
         std::map<EmotionType, float> probabilities;
@@ -236,9 +242,41 @@ public:
     
     bool initialize(int sample_rate) {
         sample_rate_ = sample_rate;
+        frame_.reset();
+
+        audio::PitchTrackerConfig pitch_config;
+        pitch_config.sampleRate = sample_rate;
+        pitch_config.frameSize = kPitchFrameSize;
+        pitch_config.hopSize = kPitchHopSize;
+        batch_pitch_ = std::make_unique<audio::PitchTracker>(pitch_config);
+        stream_pitch_ = std::make_unique<audio::PitchTracker>(pitch_config);
         return true;
     }
 
+    audio::PitchContour addAudio(const float* samples, size_t count) {
+        audio::PitchContour delta;
+        if (!stream_pitch_) {
+            initialize(sample_rate_);
+        }
+        stream_pitch_->push(samples, count, [&delta](const audio::PitchEstimate& estimate) {
+            delta.add(estimate);
+        });
+        return delta;
+    }
+
+    const audio::PitchContour& getPitchContour() {
+        if (!stream_pitch_) {
+            initialize(sample_rate_);
+        }
+        return stream_pitch_->getContour();
+    }
+
+    void resetStream() {
+        if (stream_pitch_) {
+            stream_pitch_->reset();
+        }
+    }
+
     ProsodicFeatures extractFeatures(const std::vector<float>& audio_data) {
         ProsodicFeatures features = {};
         
@@ -246,102 +284,103 @@ public:
             return features;
         }
 
-        // Calculate basic statistics
-        features.energy_mean = calculateRMSEnergy(audio_data);
-        features.energy_std = calculateEnergyVariation(audio_data);
+        // Energy, spectral and cepstral features from one framed pass
+        FramePass pass = analyzeFrames(audio_data);
+        features.energy_mean = pass.energy;
+        features.energy_std = calculateStdDev(pass.frame_energies);
         
-        // Estimate pitch using autocorrelation
-        auto pitch_values = estimatePitch(audio_data);
-        if (!pitch_values.empty()) {
-            features.pitch_mean = calculateMean(pitch_values);
-            features.pitch_std = calculateStdDev(pitch_values);
-            features.pitch_range = *std::max_element(pitch_values.begin(), pitch_values.end()) -
-                                  *std::min_element(pitch_values.begin(), pitch_values.end());
+        // Pitch contour over voiced frames
+        if (!batch_pitch_) {
+            initialize(sample_rate_);
+        }
+        batch_pitch_->reset();
+        batch_pitch_->push(audio_data);
+        const auto& contour = batch_pitch_->getContour();
+        if (contour.voicedFrames > 0) {
+            features.pitch_mean = static_cast<float>(contour.mean);
+            features.pitch_std = contour.stdDev();
+            features.pitch_range = contour.range();
+            features.jitter = contour.jitter();
         }
 
         // Estimate speaking rate (simplified)
-        features.speaking_rate = estimateSpeakingRate(audio_data);
-        
-        // Calculate spectral features
-        features.spectral_centroid = calculateSpectralCentroid(audio_data);
-        features.spectral_rolloff = calculateSpectralRolloff(audio_data);
+        features.speaking_rate = estimateSpeakingRate(pass.frame_energies, audio_data.size());
         
-        // Extract MFCC features (simplified)
-        features.mfcc = extractMFCC(audio_data);
+        features.spectral_centroid = pass.spectral_centroid;
+        features.spectral_rolloff = pass.spectral_rolloff;
+        features.mfcc = pass.mfcc;
 
         return features;
     }
 
 private:
-    float calculateRMSEnergy(const std::vector<float>& audio_data) {
-        float sum_squares = 0.0f;
-        for (float sample : audio_data) {
-            sum_squares += sample * sample;
-        }
-        return std::sqrt(sum_squares / audio_data.size());
-    }
+    static constexpr size_t kFrameSize = 512;
+    static constexpr size_t kPitchFrameSize = 1024;
+    static constexpr size_t kPitchHopSize = 512;
 
-    float calculateEnergyVariation(const std::vector<float>& audio_data) {
-        const size_t frame_size = 512;
+    struct FramePass {
+        float energy = 0.0f;
         std::vector<float> frame_energies;
+        float spectral_centroid = 0.0f;
+        float spectral_rolloff = 0.0f;
+        std::vector<float> mfcc;
+    };
+
+    std::unique_ptr<audio::FrameFeatures> frame_;
+    // One-shot extraction and the live stream keep separate pitch state
+    std::unique_ptr<audio::PitchTracker> batch_pitch_;
+    std::unique_ptr<audio::PitchTracker> stream_pitch_;
+
+    FramePass analyzeFrames(const std::vector<float>& audio_data) {
+        if (!frame_) {
+            audio::FrameAnalysisConfig config;
+            config.sampleRate = sample_rate_;
+            config.frameSize = kFrameSize;
+            config.hopSize = kFrameSize;
+            frame_ = std::make_unique<audio::FrameFeatures>(audio::FrameAnalysisTables::create(config));
+        }
+
+        FramePass pass;
+        pass.mfcc.assign(frame_->mfcc().size(), 0.0f);
+        float sum_squares = 0.0f;
+        size_t spectral_frames = 0;
         
-        for (size_t i = 0; i < audio_data.size(); i += frame_size) {
-            size_t end = std::min(i + frame_size, audio_data.size());
-            std::vector<float> frame(audio_data.begin() + i, audio_data.begin() + end);
-            frame_energies.push_back(calculateRMSEnergy(frame));
-        }
-        
-        return calculateStdDev(frame_energies);
-    }
-
-    std::vector<float> estimatePitch(const std::vector<float>& audio_data) {
-        std::vector<float> pitch_values;
-        const size_t frame_size = 1024;
-        const size_t hop_size = 512;
-        
-        for (size_t i = 0; i < audio_data.size() - frame_size; i += hop_size) {
-            std::vector<float> frame(audio_data.begin() + i, audio_data.begin() + i + frame_size);
-            float pitch = estimateFramePitch(frame);
-            if (pitch > 0) {
-                pitch_values.push_back(pitch);
+        for (size_t i = 0; i < audio_data.size(); i += kFrameSize) {
+            size_t count = std::min(kFrameSize, audio_data.size() - i);
+            frame_->assign(audio_data.data() + i, count, i / kFrameSize);
+            
+            float rms = frame_->rms();
+            pass.frame_energies.push_back(rms);
+            sum_squares += rms * rms * count;
+            
+            // A partial trailing frame only contributes energy
+            if (count < kFrameSize) {
+                continue;
+            }
+            pass.spectral_centroid += frame_->spectralCentroid();
+            pass.spectral_rolloff += frame_->spectralRolloff();
+            const auto& mfcc = frame_->mfcc();
+            for (size_t c = 0; c < pass.mfcc.size(); ++c) {
+                pass.mfcc[c] += mfcc[c];
             }
+            spectral_frames++;
         }
         
-        return pitch_values;
-    }
-
-    float estimateFramePitch(const std::vector<float>& frame) {
-        // Simple autocorrelation-based pitch estimation
-        const int min_period = sample_rate_ / 500;  // 500 Hz max
-        const int max_period = sample_rate_ / 80;   // 80 Hz min
-        
-        float max_correlation = 0.0f;
-        int best_period = 0;
-        
-        for (int period = min_period; period < max_period && period < (int)frame.size() / 2; ++period) {
-            float correlation = 0.0f;
-            for (size_t i = 0; i < frame.size() - period; ++i) {
-                correlation += frame[i] * frame[i + period];
-            }
-            
-            if (correlation > max_correlation) {
-                max_correlation = correlation;
-                best_period = period;
+        pass.energy = std::sqrt(sum_squares / audio_data.size());
+        if (spectral_frames > 0) {
+            pass.spectral_centroid /= spectral_frames;
+            pass.spectral_rolloff /= spectral_frames;
+            for (float& coefficient : pass.mfcc) {
+                coefficient /= spectral_frames;
             }
         }
-        
-        return best_period > 0 ? (float)sample_rate_ / best_period : 0.0f;
+        return pass;
     }
 
-    float estimateSpeakingRate(const std::vector<float>& audio_data) {
+    float estimateSpeakingRate(const std::vector<float>& frame_energies, size_t sample_count) {
         // Simplified speaking rate estimation based on energy peaks
-        const size_t frame_size = 512;
-        std::vector<float> frame_energies;
-        
-        for (size_t i = 0; i < audio_data.size(); i += frame_size) {
-            size_t end = std::min(i + frame_size, audio_data.size());
-            std::vector<float> frame(audio_data.begin() + i, audio_data.begin() + end);
-            frame_energies.push_back(calculateRMSEnergy(frame));
+        if (frame_energies.size() < 3) {
+            return 0.0f;
         }
         
         // Count energy peaks as syllable approximation
@@ -356,60 +395,13 @@ private:
             }
         }
         
-        float duration_seconds = (float)audio_data.size() / sample_rate_;
+        float duration_seconds = (float)sample_count / sample_rate_;
         float syllables_per_second = peak_count / duration_seconds;
         
         // Rough conversion: syllables per second to words per minute
         return syllables_per_second * 60.0f / 2.5f;  // Assume ~2.5 syllables per word
     }
 
-    float calculateSpectralCentroid(const std::vector<float>& audio_data) {
-        // Simplified spectral centroid calculation
-        const size_t fft_size = 512;
-        if (audio_data.size() < fft_size) return 0.0f;
-        
-        // Use first frame for simplicity
-        std::vector<float> frame(audio_data.begin(), audio_data.begin() + fft_size);
-        
-        // Simple magnitude spectrum approximation
-        float weighted_sum = 0.0f;
-        float magnitude_sum = 0.0f;
-        
-        for (size_t i = 0; i < fft_size / 2; ++i) {
-            float magnitude = std::abs(frame[i]);
-            float frequency = (float)i * sample_rate_ / fft_size;
-            weighted_sum += magnitude * frequency;
-            magnitude_sum += magnitude;
-        }
-        
-        return magnitude_sum > 0 ? weighted_sum / magnitude_sum : 0.0f;
-    }
-
-    float calculateSpectralRolloff(const std::vector<float>& audio_data) {
-        // Simplified spectral rolloff (85% of spectral energy)
-        return calculateSpectralCentroid(audio_data) * 1.5f;  // Rough approximation
-    }
-
-    std::vector<float> extractMFCC(const std::vector<float>& audio_data) {
-        // Simplified MFCC extraction - return basic spectral features
-        std::vector<float> mfcc(13, 0.0f);
-        
-        if (audio_data.size() < 512) {
-            return mfcc;
-        }
-        
-        // Use energy and spectral features as simplified MFCC
-        mfcc[0] = calculateRMSEnergy(audio_data);
-        mfcc[1] = calculateSpectralCentroid(audio_data) / 1000.0f;  // Normalize
-        
-        // Fill remaining with derived features
-        for (size_t i = 2; i < mfcc.size(); ++i) {
-            mfcc[i] = mfcc[1] * std::sin((float)i * 0.5f);
-        }
-        
-        return mfcc;
-    }
-
     float calculateMean(const std::vector<float>& values) {
         if (values.empty()) return 0.0f;
         return std::accumulate(values.begin(), values.end(), 0.0f) / values.size();
@@ -441,6 +433,18 @@ ProsodicFeatures ProsodicFeatureExtractor::extractFeatures(const std::vector<flo
     return impl_->extractFeatures(audio_data);
 }
 
+audio::PitchContour ProsodicFeatureExtractor::addAudio(const float* samples, size_t count) {
+    return impl_->addAudio(samples, count);
+}
+
+const audio::PitchContour& ProsodicFeatureExtractor::getPitchContour() const {
+    return impl_->getPitchContour();
+}
+
+void ProsodicFeatureExtractor::resetStream() {
+    impl_->resetStream();
+}
+
 // EmotionDetector implementation
 class EmotionDetector::Impl {
 public:
@@ -448,6 +452,8 @@ public:
     std::unique_ptr<EmotionDetectionModel> emotion_model_;
     std::unique_ptr<SentimentAnalysisModel> sentiment_model_;
     std::vector<EmotionResult> emotion_history_;
+    ProsodicFeatureExtractor stream_extractor_;
+    int stream_sample_rate_ = 0;
     bool initialized_ = false;
     std::string last_error_;
 
@@ -585,6 +591,23 @@ SentimentResult EmotionDetector::analyzeSentimentFromText(const std::string& tex
     return impl_->sentiment_model_->analyzeSentiment(text);
 }
 
+audio::PitchContour EmotionDetector::addAudioChunk(const std::vector<float>& audio_chunk, int sample_rate) {
+    if (sample_rate != impl_->stream_sample_rate_) {
+        // A new rate starts a new stream
+        impl_->stream_extractor_.initialize(sample_rate);
+        impl_->stream_sample_rate_ = sample_rate;
+    }
+    return impl_->stream_extractor_.addAudio(audio_chunk);
+}
+
+audio::PitchContour EmotionDetector::getPitchContour() const {
+    return impl_->stream_sample_rate_ > 0 ? impl_->stream_extractor_.getPitchContour() : audio::PitchContour();
+}
+
+void EmotionDetector::resetAudioStream() {
+    impl_->stream_extractor_.resetStream();
+}
+
 void EmotionDetector::updateEmotionHistory(const EmotionResult& result) {
     impl_->updateEmotionHistory(result);
 }
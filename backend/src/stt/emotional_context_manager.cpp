@@ -62,6 +62,19 @@ public:
         }
     }
 
+    void updatePitchContour(uint32_t conversation_id, const audio::PitchContour& delta) {
+        if (!initialized_) {
+            last_error_ = "EmotionalContextManager not initialized";
+            return;
+        }
+
+        auto& state = getOrCreateConversationState(conversation_id);
+        state.pitch_contour.merge(delta);
+        if (!state.segments.empty()) {
+            state.segments.back().pitch_contour.merge(delta);
+        }
+    }
+
     void processEmotionalSegmentation(uint32_t conversation_id,
                                      const EmotionalAnalysisResult& analysis_result,
                                      const std::string& transcribed_text) {
@@ -462,6 +475,11 @@ ConversationEmotionalState EmotionalContextManager::getConversationState(uint32_
     return ConversationEmotionalState{};
 }
 
+void EmotionalContextManager::updatePitchContour(uint32_t conversation_id,
+                                                 const audio::PitchContour& delta) {
+    impl_->updatePitchContour(conversation_id, delta);
+}
+
 void EmotionalContextManager::processEmotionalSegmentation(uint32_t conversation_id,
                                                           const EmotionalAnalysisResult& analysis_result,
                                                           const std::string& transcribed_text) {
@@ -10,6 +10,7 @@ OptimizedStreamingState::OptimizedStreamingState(const OptimizationConfig& confi
     , initialized_(false)
     , shutdownRequested_(false)
     , peakMemoryUsage_(0)
+    , cleanupTimer_(speechrnt::utils::TimerService::INVALID_TIMER)
     , lastCleanupTime_(std::chrono::steady_clock::now()) {
 }
 
@@ -46,8 +47,14 @@ bool OptimizedStreamingState::initialize() {
                            " worker threads for streaming state processing");
     }
     
-    // Start cleanup thread
-    cleanupThread_ = std::thread(&OptimizedStreamingState::cleanupThreadFunction, this);
+    // Schedule periodic cleanup
+    cleanupTimer_ = speechrnt::utils::TimerService::getInstance().schedulePeriodic(
+        "streaming_state.cleanup", std::chrono::milliseconds(config_.stateCleanupIntervalMs),
+        [this]() {
+            if (!shutdownRequested_) {
+                performCleanup();
+            }
+        });
     
     initialized_ = true;
     speechrnt::utils::Logger::info("OptimizedStreamingState initialized successfully");
@@ -76,10 +83,9 @@ void OptimizedStreamingState::shutdown() {
     }
     workerThreads_.clear();
     
-    // Wait for cleanup thread to finish
-    if (cleanupThread_.joinable()) {
-        cleanupThread_.join();
-    }
+    // Cancel cleanup, waiting for a run in progress
+    speechrnt::utils::TimerService::getInstance().cancel(cleanupTimer_);
+    cleanupTimer_ = speechrnt::utils::TimerService::INVALID_TIMER;
     
     // Force cleanup all utterances
     forceCleanup();
@@ -518,20 +524,6 @@ void OptimizedStreamingState::workerThreadFunction() {
     speechrnt::utils::Logger::debug("Worker thread stopped");
 }
 
-void OptimizedStreamingState::cleanupThreadFunction() {
-    speechrnt::utils::Logger::debug("Cleanup thread started for streaming state");
-    
-    while (!shutdownRequested_) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(config_.stateCleanupIntervalMs));
-        
-        if (!shutdownRequested_) {
-            performCleanup();
-        }
-    }
-    
-    speechrnt::utils::Logger::debug("Cleanup thread stopped");
-}
-
 void OptimizedStreamingState::updateStatistics() {
     size_t currentMemory = 0;
     
@@ -1,4 +1,5 @@
 #include "stt/streaming_transcriber.hpp"
+#include "core/admission_controller.hpp"
 #include "core/translation_pipeline.hpp"
 #include "stt/whisper_stt.hpp"
 #include <cctype>
@@ -63,6 +64,10 @@ bool StreamingTranscriber::initializeWithTranslationPipeline(
 }
 
 void StreamingTranscriber::startTranscription(uint32_t utteranceId, const std::vector<float>& audioData, bool isLive) {
+    startTranscription(utteranceId, ::audio::AudioSegment::copyOf(audioData), isLive);
+}
+
+void StreamingTranscriber::startTranscription(uint32_t utteranceId, const ::audio::AudioSegment& segment, bool isLive) {
     if (!transcriptionManager_) {
         speechrnt::utils::Logger::error("StreamingTranscriber not initialized");
         return;
@@ -106,7 +111,7 @@ void StreamingTranscriber::startTranscription(uint32_t utteranceId, const std::v
                 }
             });
             whisper->startStreamingTranscription(utteranceId);
-            whisper->addAudioChunk(utteranceId, audioData);
+            whisper->addAudioChunk(utteranceId, segment);
             if (!isLive) {
                 whisper->finalizeStreamingTranscription(utteranceId);
             }
@@ -114,7 +119,8 @@ void StreamingTranscriber::startTranscription(uint32_t utteranceId, const std::v
             // Fallback to non-streaming request path
             TranscriptionRequest request;
             request.utterance_id = utteranceId;
-            request.audio_data = audioData;
+            // The request path needs contiguous samples
+            request.audio_data = segment.toVector();
             request.is_live = isLive;
             request.callback = [this](uint32_t id, const TranscriptionResult& result) {
                 handleTranscriptionResult(id, result);
@@ -144,6 +150,18 @@ void StreamingTranscriber::addAudioData(uint32_t utteranceId, const std::vector<
                          " (" + std::to_string(audioData.size()) + " samples)");
 }
 
+void StreamingTranscriber::addAudioData(uint32_t utteranceId, const ::audio::AudioSegment& segment) {
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    auto it = transcriptionStates_.find(utteranceId);
+    if (it == transcriptionStates_.end() || !it->second.isActive) {
+        speechrnt::utils::Logger::warn("Attempted to add audio data to inactive transcription: " + std::to_string(utteranceId));
+        return;
+    }
+    
+    speechrnt::utils::Logger::debug("Added audio segment to utterance " + std::to_string(utteranceId) + 
+                         " (" + std::to_string(segment.size()) + " samples)");
+}
+
 void StreamingTranscriber::finalizeTranscription(uint32_t utteranceId) {
     std::lock_guard<std::mutex> lock(stateMutex_);
     
@@ -200,6 +218,11 @@ void StreamingTranscriber::cancelTranscription(uint32_t utteranceId) {
         transcriptionStates_.erase(it);
     }
     
+    // Drop speculative translations of the abandoned utterance
+    if (translationPipeline_) {
+        translationPipeline_->cancelPipelineOperation(utteranceId);
+    }
+    
     speechrnt::utils::Logger::debug("Cancelled transcription for utterance " + std::to_string(utteranceId));
 }
 
@@ -279,6 +302,13 @@ void StreamingTranscriber::handleTranscriptionResult(uint32_t utteranceId, const
     // Determine if this is a partial or final result
     bool isPartial = result.is_partial && !state.isFinalized;
     
+    // Start to final result is the utterance's STT service time
+    if (!isPartial && state.startTimeMs > 0) {
+        ::core::AdmissionController::getInstance().recordServiceTime(
+            ::core::AdmissionStage::TRANSCRIPTION,
+            static_cast<double>(getCurrentTimeMs() - state.startTimeMs));
+    }
+    
     // Check if this is a significant change worth sending
     bool isSignificantChange = isSignificantTextChange(previousText, state.currentText);
     
@@ -290,6 +320,13 @@ void StreamingTranscriber::handleTranscriptionResult(uint32_t utteranceId, const
         state.updateCount++;
     }
     
+    // Let the pipeline translate the settled part while the user keeps talking
+    if (isPartial && translationPipeline_ && translationPipeline_->isReady()) {
+        TranscriptionResult partial = result;
+        partial.text = state.currentText;
+        translationPipeline_->processPartialTranscription(utteranceId, sessionId_, partial);
+    }
+    
     speechrnt::utils::Logger::debug("Handled transcription result for utterance " + std::to_string(utteranceId) + 
                          ": '" + result.text + "' (confidence: " + std::to_string(result.confidence) + 
                          ", partial: " + (isPartial ? "true" : "false") + ")");
@@ -1,9 +1,11 @@
 #include "stt/stt_health_checker.hpp"
+#include "core/admission_controller.hpp"
 #include "utils/logging.hpp"
 #include <algorithm>
 #include <sstream>
 #include <random>
 #include <iomanip>
+#include <cstdio>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -15,6 +17,69 @@
 
 namespace stt {
 
+namespace {
+
+const char* statusName(HealthStatus status) {
+    switch (status) {
+        case HealthStatus::HEALTHY: return "healthy";
+        case HealthStatus::DEGRADED: return "degraded";
+        case HealthStatus::UNHEALTHY: return "unhealthy";
+        case HealthStatus::CRITICAL: return "critical";
+        default: return "unknown";
+    }
+}
+
+std::string historyBody(int hours, size_t count, const char* entries, size_t length) {
+    std::string body;
+    body.reserve(length + 96);
+    body += "{\n  \"hours_requested\": ";
+    body += std::to_string(hours);
+    body += ",\n  \"entries_count\": ";
+    body += std::to_string(count);
+    body += ",\n  \"history\": [\n";
+    if (length > 0) {
+        body.append(entries, length);
+        body += '\n';
+    }
+    body += "  ]\n}";
+    return body;
+}
+
+} // namespace
+
+HealthSnapshot::Body HealthSnapshot::historyFor(int hours) const {
+    if (hours == DEFAULT_HISTORY_HOURS) {
+        return history;
+    }
+    
+    // Entries are in time order, so the window is a suffix
+    auto cutoff = published_at - std::chrono::hours(hours);
+    auto first = std::lower_bound(
+        history_offsets.begin(), history_offsets.end(), cutoff,
+        [](const std::pair<std::chrono::steady_clock::time_point, size_t>& entry,
+           std::chrono::steady_clock::time_point time) { return entry.first < time; });
+    size_t count = static_cast<size_t>(history_offsets.end() - first);
+    size_t offset = first == history_offsets.end() ? history_entries.size() : first->second;
+    
+    Body body;
+    body.json = historyBody(hours, count, history_entries.data() + offset, history_entries.size() - offset);
+    body.etag = "\"history-" + std::to_string(history_appended) + "-" + std::to_string(count) +
+                "-" + std::to_string(hours) + "\"";
+    return body;
+}
+
+std::string HealthSnapshot::makeETag(const std::string& body) {
+    // FNV-1a of the body: equal bodies get equal tags across snapshots
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : body) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    char tag[20];
+    std::snprintf(tag, sizeof(tag), "\"%016llx\"", static_cast<unsigned long long>(hash));
+    return tag;
+}
+
 STTHealthChecker::STTHealthChecker()
     : performance_monitor_(speechrnt::utils::PerformanceMonitor::getInstance())
     , performance_tracker_(std::make_unique<STTPerformanceTracker>()) {
@@ -28,15 +93,21 @@ STTHealthChecker::~STTHealthChecker() {
 }
 
 bool STTHealthChecker::initialize(const HealthCheckConfig& config) {
-    std::lock_guard<std::mutex> lock(health_mutex_);
-    
-    config_ = config;
-    current_health_.timestamp = std::chrono::steady_clock::now();
-    last_health_check_ = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(health_mutex_);
+        
+        config_ = config;
+        current_health_.timestamp = std::chrono::steady_clock::now();
+        last_health_check_ = std::chrono::steady_clock::now();
+        
+        // Initialize health history with current status
+        health_history_.clear();
+        history_fragments_.clear();
+        updateHealthHistory(current_health_);
+    }
     
-    // Initialize health history with current status
-    health_history_.clear();
-    health_history_.push_back(current_health_);
+    // Endpoints have something to serve before the first scheduled check
+    publishSnapshot();
     
     speechrnt::utils::Logger::info("STTHealthChecker initialized with check interval: " + std::to_string(config_.health_check_interval_ms) + "ms");
     return true;
@@ -48,19 +119,20 @@ bool STTHealthChecker::startMonitoring(bool enableBackgroundMonitoring) {
         return true;
     }
     
-    should_stop_monitoring_.store(false);
     monitoring_active_.store(true);
     
     if (enableBackgroundMonitoring) {
-        // Start health monitoring thread
-        health_monitor_thread_ = std::make_unique<std::thread>([this]() {
-            healthMonitorLoop();
-        });
+        auto& timers = speechrnt::utils::TimerService::getInstance();
         
-        // Start resource monitoring thread
-        resource_monitor_thread_ = std::make_unique<std::thread>([this]() {
-            resourceMonitorLoop();
-        });
+        health_check_timer_ = timers.schedulePeriodic(
+            "stt.health_check", std::chrono::milliseconds(config_.health_check_interval_ms),
+            [this]() { runScheduledHealthCheck(false); }, true);
+        detailed_check_timer_ = timers.schedulePeriodic(
+            "stt.detailed_health_check", std::chrono::milliseconds(config_.detailed_check_interval_ms),
+            [this]() { runScheduledHealthCheck(true); });
+        resource_check_timer_ = timers.schedulePeriodic(
+            "stt.resource_check", std::chrono::milliseconds(config_.resource_check_interval_ms),
+            [this]() { runScheduledResourceCheck(); }, true);
         
         speechrnt::utils::Logger::info("Background health monitoring started");
     }
@@ -73,21 +145,15 @@ void STTHealthChecker::stopMonitoring() {
         return;
     }
     
-    should_stop_monitoring_.store(true);
     monitoring_active_.store(false);
     
-    // Wait for threads to finish
-    if (health_monitor_thread_ && health_monitor_thread_->joinable()) {
-        health_monitor_thread_->join();
+    // Cancelling waits for any check that is running
+    auto& timers = speechrnt::utils::TimerService::getInstance();
+    for (auto* timer : {&health_check_timer_, &detailed_check_timer_, &resource_check_timer_}) {
+        timers.cancel(*timer);
+        *timer = speechrnt::utils::TimerService::INVALID_TIMER;
     }
     
-    if (resource_monitor_thread_ && resource_monitor_thread_->joinable()) {
-        resource_monitor_thread_->join();
-    }
-    
-    health_monitor_thread_.reset();
-    resource_monitor_thread_.reset();
-    
     speechrnt::utils::Logger::info("Health monitoring stopped");
 }
 
@@ -183,6 +249,8 @@ SystemHealthStatus STTHealthChecker::checkHealth(bool detailed) {
     
     total_health_checks_.fetch_add(1);
     
+    publishSnapshot();
+    
     return status;
 }
 
@@ -483,27 +551,38 @@ std::vector<HealthAlert> STTHealthChecker::getActiveAlerts() {
 }
 
 bool STTHealthChecker::acknowledgeAlert(const std::string& alertId) {
-    std::lock_guard<std::mutex> lock(alerts_mutex_);
-    
-    for (auto& alert : active_alerts_) {
-        if (alert.alert_id == alertId) {
-            alert.acknowledged = true;
-            speechrnt::utils::Logger::info("Alert '" + alertId + "' acknowledged");
-            return true;
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(alerts_mutex_);
+        
+        for (auto& alert : active_alerts_) {
+            if (alert.alert_id == alertId) {
+                alert.acknowledged = true;
+                speechrnt::utils::Logger::info("Alert '" + alertId + "' acknowledged");
+                found = true;
+                break;
+            }
         }
     }
     
-    return false;
+    if (found) {
+        publishSnapshot();
+    }
+    return found;
 }
 
 void STTHealthChecker::clearAcknowledgedAlerts() {
-    std::lock_guard<std::mutex> lock(alerts_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(alerts_mutex_);
+        
+        active_alerts_.erase(
+            std::remove_if(active_alerts_.begin(), active_alerts_.end(),
+                          [](const HealthAlert& alert) { return alert.acknowledged; }),
+            active_alerts_.end()
+        );
+    }
     
-    active_alerts_.erase(
-        std::remove_if(active_alerts_.begin(), active_alerts_.end(),
-                      [](const HealthAlert& alert) { return alert.acknowledged; }),
-        active_alerts_.end()
-    );
+    publishSnapshot();
 }
 
 std::map<std::string, double> STTHealthChecker::getHealthMetrics() {
@@ -575,7 +654,9 @@ bool STTHealthChecker::canAcceptNewRequests() {
         return false;
     }
     
-    return true;
+    // Capacity decisions belong to the admission controller, which sees
+    // measured service times and queue depths across all stages
+    return ::core::AdmissionController::getInstance().canAcceptWork();
 }
 
 double STTHealthChecker::getSystemLoadFactor() {
@@ -627,49 +708,21 @@ std::map<std::string, uint64_t> STTHealthChecker::getMonitoringStats() {
 
 // Private methods implementation
 
-void STTHealthChecker::healthMonitorLoop() {
-    speechrnt::utils::Logger::info("Health monitor loop started");
-    
-    while (!should_stop_monitoring_.load()) {
-        try {
-            performHealthCheck(false);
-            
-            // Sleep for the configured interval
-            std::this_thread::sleep_for(std::chrono::milliseconds(config_.health_check_interval_ms));
-            
-            // Perform detailed check periodically
-            static int detailedCheckCounter = 0;
-            detailedCheckCounter++;
-            
-            if (detailedCheckCounter * config_.health_check_interval_ms >= config_.detailed_check_interval_ms) {
-                performHealthCheck(true);
-                detailedCheckCounter = 0;
-            }
-            
-        } catch (const std::exception& e) {
-            speechrnt::utils::Logger::error("Exception in health monitor loop: " + std::string(e.what()));
-        }
+void STTHealthChecker::runScheduledHealthCheck(bool detailed) {
+    try {
+        performHealthCheck(detailed);
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("Exception in scheduled health check: " + std::string(e.what()));
     }
-    
-    speechrnt::utils::Logger::info("Health monitor loop stopped");
 }
 
-void STTHealthChecker::resourceMonitorLoop() {
-    speechrnt::utils::Logger::info("Resource monitor loop started");
-    
-    while (!should_stop_monitoring_.load()) {
-        try {
-            // Update resource metrics
-            checkResourceHealth();
-            
-            std::this_thread::sleep_for(std::chrono::milliseconds(config_.resource_check_interval_ms));
-            
-        } catch (const std::exception& e) {
-            speechrnt::utils::Logger::error("Exception in resource monitor loop: " + std::string(e.what()));
-        }
+void STTHealthChecker::runScheduledResourceCheck() {
+    try {
+        // Update resource metrics
+        checkResourceHealth();
+    } catch (const std::exception& e) {
+        speechrnt::utils::Logger::error("Exception in scheduled resource check: " + std::string(e.what()));
     }
-    
-    speechrnt::utils::Logger::info("Resource monitor loop stopped");
 }
 
 void STTHealthChecker::performHealthCheck(bool detailed) {
@@ -678,6 +731,9 @@ void STTHealthChecker::performHealthCheck(bool detailed) {
 
 void STTHealthChecker::updateHealthHistory(const SystemHealthStatus& status) {
     health_history_.push_back(status);
+    // Serialised once here; snapshots only concatenate
+    history_fragments_.emplace_back(status.timestamp, formatHistoryEntryJSON(status));
+    ++history_appended_;
     
     // Keep only last 24 hours of history
     auto cutoffTime = std::chrono::steady_clock::now() - std::chrono::hours(24);
@@ -686,6 +742,11 @@ void STTHealthChecker::updateHealthHistory(const SystemHealthStatus& status) {
                       [cutoffTime](const SystemHealthStatus& s) { return s.timestamp < cutoffTime; }),
         health_history_.end()
     );
+    history_fragments_.erase(
+        std::remove_if(history_fragments_.begin(), history_fragments_.end(),
+                      [cutoffTime](const auto& fragment) { return fragment.first < cutoffTime; }),
+        history_fragments_.end()
+    );
 }
 
 void STTHealthChecker::checkForHealthChanges(const SystemHealthStatus& newStatus) {
@@ -955,8 +1016,10 @@ double STTHealthChecker::calculateInstanceLoad(const std::string& instanceId) {
         return 1.0; // Unknown instances get maximum load
     }
     
-    const auto& health = healthIt->second;
-    
+    return calculateLoad(healthIt->second);
+}
+
+double STTHealthChecker::calculateLoad(const ComponentHealth& health) const {
     // Calculate load based on health status and response time
     double healthLoad = 0.0;
     switch (health.status) {
@@ -981,7 +1044,8 @@ std::string STTHealthChecker::selectLeastLoadedInstance() {
     
     for (const auto& [instanceId, health] : instance_health_) {
         if (isInstanceHealthy(health)) {
-            double load = calculateInstanceLoad(instanceId);
+            // instances_mutex_ is already held
+            double load = calculateLoad(health);
             if (load < lowestLoad) {
                 lowestLoad = load;
                 bestInstance = instanceId;
@@ -1104,6 +1168,148 @@ std::string STTHealthChecker::formatHealthStatusJSON(const SystemHealthStatus& s
     return json.str();
 }
 
+std::string STTHealthChecker::formatHistoryEntryJSON(const SystemHealthStatus& status) {
+    std::ostringstream json;
+    json << "    {\n";
+    json << "      \"timestamp\": " << std::chrono::duration_cast<std::chrono::milliseconds>(
+               status.timestamp.time_since_epoch()).count() << ",\n";
+    json << "      \"overall_status\": \"" << statusName(status.overall_status) << "\",\n";
+    json << "      \"message\": \"" << status.overall_message << "\",\n";
+    json << "      \"check_time_ms\": " << status.total_check_time_ms << ",\n";
+    json << "      \"component_count\": " << status.component_health.size() << "\n";
+    json << "    }";
+    return json.str();
+}
+
+std::string STTHealthChecker::formatMetricsJSON() {
+    auto metrics = getHealthMetrics();
+    auto monitoringStats = getMonitoringStats();
+    
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"health_metrics\": {\n";
+    
+    size_t metricIndex = 0;
+    for (const auto& [key, value] : metrics) {
+        json << "    \"" << key << "\": " << value;
+        if (++metricIndex < metrics.size()) json << ",";
+        json << "\n";
+    }
+    
+    json << "  },\n";
+    json << "  \"monitoring_stats\": {\n";
+    
+    size_t statIndex = 0;
+    for (const auto& [key, value] : monitoringStats) {
+        json << "    \"" << key << "\": " << value;
+        if (++statIndex < monitoringStats.size()) json << ",";
+        json << "\n";
+    }
+    
+    json << "  },\n";
+    json << "  \"healthy_instances\": [\n";
+    
+    auto healthyInstances = getHealthyInstances();
+    for (size_t i = 0; i < healthyInstances.size(); ++i) {
+        json << "    \"" << healthyInstances[i] << "\"";
+        if (i < healthyInstances.size() - 1) json << ",";
+        json << "\n";
+    }
+    
+    json << "  ],\n";
+    json << "  \"recommended_instance\": \"" << getRecommendedInstance() << "\"\n";
+    json << "}";
+    return json.str();
+}
+
+std::string STTHealthChecker::formatAlertsJSON(const std::vector<HealthAlert>& alerts) {
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"active_alerts_count\": " << alerts.size() << ",\n";
+    json << "  \"alerts\": [\n";
+    
+    for (size_t i = 0; i < alerts.size(); ++i) {
+        const auto& alert = alerts[i];
+        json << "    {\n";
+        json << "      \"alert_id\": \"" << alert.alert_id << "\",\n";
+        json << "      \"component_name\": \"" << alert.component_name << "\",\n";
+        json << "      \"severity\": \"" << statusName(alert.severity) << "\",\n";
+        json << "      \"message\": \"" << alert.message << "\",\n";
+        json << "      \"timestamp\": " << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   alert.timestamp.time_since_epoch()).count() << ",\n";
+        json << "      \"acknowledged\": " << (alert.acknowledged ? "true" : "false") << ",\n";
+        json << "      \"context\": {\n";
+        
+        size_t contextIndex = 0;
+        for (const auto& [key, value] : alert.context) {
+            json << "        \"" << key << "\": \"" << value << "\"";
+            if (++contextIndex < alert.context.size()) json << ",";
+            json << "\n";
+        }
+        
+        json << "      }\n";
+        json << "    }";
+        if (i < alerts.size() - 1) json << ",";
+        json << "\n";
+    }
+    
+    json << "  ]\n";
+    json << "}";
+    return json.str();
+}
+
+void STTHealthChecker::publishSnapshot() {
+    // Publishers are serialised so versions and history stay in order;
+    // readers never take this lock
+    std::lock_guard<std::mutex> publishLock(publish_mutex_);
+    
+    auto snapshot = std::make_shared<HealthSnapshot>();
+    snapshot->version = ++snapshot_version_;
+    snapshot->published_at = std::chrono::steady_clock::now();
+    
+    {
+        std::lock_guard<std::mutex> lock(health_mutex_);
+        snapshot->overall_status = current_health_.overall_status;
+        snapshot->overall_message = current_health_.overall_message;
+        snapshot->timestamp = current_health_.timestamp;
+        snapshot->total_check_time_ms = current_health_.total_check_time_ms;
+        snapshot->detailed.json = formatHealthStatusJSON(current_health_);
+        
+        size_t length = 0;
+        for (const auto& fragment : history_fragments_) {
+            length += fragment.second.size() + 2;
+        }
+        snapshot->history_entries.reserve(length);
+        snapshot->history_offsets.reserve(history_fragments_.size());
+        for (const auto& fragment : history_fragments_) {
+            if (!snapshot->history_entries.empty()) {
+                snapshot->history_entries += ",\n";
+            }
+            snapshot->history_offsets.emplace_back(fragment.first, snapshot->history_entries.size());
+            snapshot->history_entries += fragment.second;
+        }
+        snapshot->history_appended = history_appended_;
+    }
+    
+    snapshot->can_accept_requests = canAcceptNewRequests();
+    snapshot->system_load_factor = getSystemLoadFactor();
+    snapshot->metrics.json = formatMetricsJSON();
+    snapshot->alerts.json = formatAlertsJSON(getActiveAlerts());
+    
+    snapshot->history.json = historyBody(HealthSnapshot::DEFAULT_HISTORY_HOURS,
+                                         snapshot->history_offsets.size(),
+                                         snapshot->history_entries.data(),
+                                         snapshot->history_entries.size());
+    snapshot->history.etag = "\"history-" + std::to_string(snapshot->history_appended) + "-" +
+                             std::to_string(snapshot->history_offsets.size()) + "-" +
+                             std::to_string(HealthSnapshot::DEFAULT_HISTORY_HOURS) + "\"";
+    for (auto* body : {&snapshot->detailed, &snapshot->metrics, &snapshot->alerts}) {
+        body->etag = HealthSnapshot::makeETag(body->json);
+    }
+    
+    std::atomic_store(&snapshot_, std::shared_ptr<const HealthSnapshot>(std::move(snapshot)));
+}
+
 // HealthCheckTimer implementation
 
 HealthCheckTimer::HealthCheckTimer(const std::string& checkName)
@@ -1,5 +1,7 @@
 #include "stt/stt_performance_tracker.hpp"
 #include "utils/logging.hpp"
+#include "utils/metrics_registry.hpp"
+#include "utils/trace_recorder.hpp"
 #include <algorithm>
 #include <chrono>
 
@@ -8,6 +10,16 @@ using utils::Logger;
 
 namespace stt {
 
+namespace {
+
+Histogram& stageHistogram(const std::string& stage) {
+    return MetricsRegistry::getInstance().histogram(
+        "speechrnt_stt_stage_duration_seconds", "Latency of each STT pipeline stage",
+        MetricsRegistry::latencyBuckets(), {{"stage", stage}});
+}
+
+} // namespace
+
 STTPerformanceTracker::STTPerformanceTracker()
     : enabled_(true)
     , detailedTracking_(true)
@@ -71,6 +83,15 @@ void STTPerformanceTracker::recordVADProcessing(uint64_t sessionId, double laten
     }
     
     // Record global VAD metrics
+    static Histogram& vadHistogram = MetricsRegistry::getInstance().histogram(
+        "speechrnt_vad_duration_seconds", "Voice activity detection latency per frame",
+        MetricsRegistry::latencyBuckets());
+    static Counter& vadStateChanges = MetricsRegistry::getInstance().counter(
+        "speechrnt_vad_state_changes", "Speech/silence transitions detected by VAD");
+    vadHistogram.observe(latencyMs / 1000.0);
+    if (stateChanged) {
+        vadStateChanges.inc();
+    }
     performanceMonitor_.recordVADMetrics(latencyMs, accuracy, stateChanged);
     
     if (detailedTracking_.load()) {
@@ -91,6 +112,9 @@ void STTPerformanceTracker::recordPreprocessing(uint64_t sessionId, double laten
     std::map<std::string, std::string> tags;
     tags["audio_length_ms"] = std::to_string(audioLengthMs);
     
+    static Histogram& histogram = stageHistogram("preprocessing");
+    histogram.observe(latencyMs / 1000.0);
+    TraceRecorder::recordElapsed("stt.preprocessing", latencyMs);
     performanceMonitor_.recordLatency(PerformanceMonitor::METRIC_STT_PREPROCESSING_LATENCY, latencyMs, tags);
     
     if (detailedTracking_.load()) {
@@ -114,6 +138,15 @@ void STTPerformanceTracker::recordInference(uint64_t sessionId, double latencyMs
     }
     tags["use_gpu"] = useGPU ? "true" : "false";
     
+    static Histogram& histogram = stageHistogram("inference");
+    histogram.observe(latencyMs / 1000.0);
+    TraceRecorder::recordElapsed("stt.inference", latencyMs);
+    MetricsRegistry::getInstance()
+        .histogram("speechrnt_model_duration_seconds", "Inference latency per component and model",
+                   MetricsRegistry::latencyBuckets(),
+                   {{"component", "stt"}, {"model", modelType.empty() ? "default" : modelType},
+                    {"device", useGPU ? "gpu" : "cpu"}})
+        .observe(latencyMs / 1000.0);
     performanceMonitor_.recordLatency(PerformanceMonitor::METRIC_STT_INFERENCE_LATENCY, latencyMs, tags);
     
     if (detailedTracking_.load()) {
@@ -134,6 +167,9 @@ void STTPerformanceTracker::recordPostprocessing(uint64_t sessionId, double late
     std::map<std::string, std::string> tags;
     tags["text_length"] = std::to_string(textLength);
     
+    static Histogram& histogram = stageHistogram("postprocessing");
+    histogram.observe(latencyMs / 1000.0);
+    TraceRecorder::recordElapsed("stt.postprocessing", latencyMs);
     performanceMonitor_.recordLatency(PerformanceMonitor::METRIC_STT_POSTPROCESSING_LATENCY, latencyMs, tags);
     
     if (detailedTracking_.load()) {
@@ -184,6 +220,8 @@ void STTPerformanceTracker::recordStreamingUpdate(uint64_t sessionId, double upd
     }
     
     // Record global streaming metrics
+    static Histogram& histogram = stageHistogram("streaming");
+    histogram.observe(updateLatencyMs / 1000.0);
     performanceMonitor_.recordStreamingUpdate(updateLatencyMs, std::abs(textDelta), isIncremental);
     
     if (detailedTracking_.load()) {
@@ -251,6 +289,7 @@ void STTPerformanceTracker::recordLanguageDetection(double detectionLatencyMs, f
     }
     
     performanceMonitor_.recordLanguageDetection(detectionLatencyMs, confidence, detectedLanguage);
+    TraceRecorder::recordElapsed("language_detection", detectionLatencyMs);
     
     // Track language switching
     if (!previousLanguage.empty() && previousLanguage != detectedLanguage) {
@@ -1,4 +1,5 @@
 #include "stt/transcription_manager.hpp"
+#include "core/admission_controller.hpp"
 #include "stt/whisper_stt.hpp"
 #include <iostream>
 #include <chrono>
@@ -59,6 +60,7 @@ void TranscriptionManager::submitTranscription(const TranscriptionRequest& reque
         std::lock_guard<std::mutex> lock(queue_mutex_);
         request_queue_.push(request);
     }
+    ::core::AdmissionController::getInstance().adjustQueueDepth(::core::AdmissionStage::TRANSCRIPTION, 1);
     
     queue_condition_.notify_one();
 }
@@ -128,6 +130,13 @@ void TranscriptionManager::stop() {
         worker_thread_.join();
     }
     
+    // Requests left behind are never processed
+    size_t abandoned = getQueueSize();
+    if (abandoned > 0) {
+        ::core::AdmissionController::getInstance().adjustQueueDepth(
+            ::core::AdmissionStage::TRANSCRIPTION, -static_cast<int>(abandoned));
+    }
+    
     running_ = false;
     std::cout << "TranscriptionManager stopped" << std::endl;
 }
@@ -169,6 +178,7 @@ void TranscriptionManager::workerLoop() {
             request = std::move(request_queue_.front());
             request_queue_.pop();
         }
+        ::core::AdmissionController::getInstance().adjustQueueDepth(::core::AdmissionStage::TRANSCRIPTION, -1);
         
         // Process the request
         processRequest(request);
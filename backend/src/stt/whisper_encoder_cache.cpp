@@ -0,0 +1,103 @@
+#include "stt/whisper_encoder_cache.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace stt {
+
+WhisperEncoderCache::Fingerprint WhisperEncoderCache::fingerprint(const std::vector<float>& audio) {
+    // FNV-1a over the raw sample bits; cheap next to a single encoder pass
+    Fingerprint result;
+    result.samples = audio.size();
+    uint64_t hash = 14695981039346656037ull;
+    for (float sample : audio) {
+        uint32_t bits;
+        std::memcpy(&bits, &sample, sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ull;
+    }
+    result.hash = hash;
+    return result;
+}
+
+WhisperEncoderCache::WhisperEncoderCache(size_t capacity)
+    : capacity_(std::max<size_t>(capacity, 1)) {
+}
+
+void WhisperEncoderCache::storeFinal(const Fingerprint& audio, const TranscriptionResult& result) {
+    Entry& entry = touch(audio);
+    entry.hasFinal = true;
+    entry.final = result;
+}
+
+bool WhisperEncoderCache::findFinal(const Fingerprint& audio, TranscriptionResult& result) {
+    Entry* entry = find(audio);
+    if (!entry || !entry->hasFinal) {
+        return false;
+    }
+    result = entry->final;
+    return true;
+}
+
+void WhisperEncoderCache::storeCandidates(const Fingerprint& audio, int maxCandidates,
+                                          const std::vector<TranscriptionResult>& candidates) {
+    Entry& entry = touch(audio);
+    entry.maxCandidates = maxCandidates;
+    entry.candidates = candidates;
+}
+
+bool WhisperEncoderCache::findCandidates(const Fingerprint& audio, int maxCandidates,
+                                         std::vector<TranscriptionResult>& candidates) {
+    Entry* entry = find(audio);
+    if (!entry || entry->maxCandidates <= 0 || entry->maxCandidates < maxCandidates) {
+        return false;
+    }
+    // A larger earlier request serves a smaller one; candidates are sorted best first
+    candidates.assign(entry->candidates.begin(),
+                      entry->candidates.begin() + std::min(entry->candidates.size(),
+                                                           static_cast<size_t>(maxCandidates)));
+    stats_.candidateHits++;
+    return true;
+}
+
+void WhisperEncoderCache::markEncoded(const Fingerprint& audio, const std::string& language) {
+    encoded_ = audio;
+    encodedLanguage_ = language;
+    encodedValid_ = true;
+    stats_.encodes++;
+}
+
+bool WhisperEncoderCache::isEncoded(const Fingerprint& audio) const {
+    return encodedValid_ && encoded_ == audio;
+}
+
+void WhisperEncoderCache::clear() {
+    entries_.clear();
+    encodedValid_ = false;
+}
+
+WhisperEncoderCache::Entry& WhisperEncoderCache::touch(const Fingerprint& audio) {
+    auto it = std::find_if(entries_.begin(), entries_.end(),
+                           [&](const Entry& entry) { return entry.audio == audio; });
+    if (it != entries_.end()) {
+        entries_.splice(entries_.begin(), entries_, it);
+        return entries_.front();
+    }
+
+    entries_.emplace_front();
+    entries_.front().audio = audio;
+    while (entries_.size() > capacity_) {
+        entries_.pop_back();
+    }
+    return entries_.front();
+}
+
+WhisperEncoderCache::Entry* WhisperEncoderCache::find(const Fingerprint& audio) {
+    auto it = std::find_if(entries_.begin(), entries_.end(),
+                           [&](const Entry& entry) { return entry.audio == audio; });
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it);
+    return &entries_.front();
+}
+
+} // namespace stt
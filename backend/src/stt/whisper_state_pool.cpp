@@ -0,0 +1,166 @@
+#include "stt/whisper_state_pool.hpp"
+#include "utils/logging.hpp"
+#include <algorithm>
+
+namespace stt {
+
+WhisperStatePool::WhisperStatePool() : ctx_(nullptr), threadsPerState_(1) {}
+
+WhisperStatePool::~WhisperStatePool() { shutdown(); }
+
+bool WhisperStatePool::initialize(const std::string& modelPath, size_t stateCount,
+                                  int threadsPerState, bool useGPU) {
+    shutdown();
+
+    if (stateCount == 0) {
+        setError("State pool needs at least one state");
+        return false;
+    }
+
+#ifdef WHISPER_AVAILABLE
+    whisper_context_params ctxParams = whisper_context_default_params();
+    ctxParams.use_gpu = useGPU;
+
+    // Load the weights without a default state; every slot gets its own
+    ctx_ = whisper_init_from_file_with_params_no_state(modelPath.c_str(), ctxParams);
+    if (!ctx_) {
+        setError("Failed to load whisper model: " + modelPath);
+        return false;
+    }
+
+    for (size_t i = 0; i < stateCount; ++i) {
+        whisper_state* state = whisper_init_state(ctx_);
+        if (!state) {
+            setError("Failed to allocate whisper state " + std::to_string(i));
+            shutdown();
+            return false;
+        }
+        states_.push_back(state);
+    }
+
+    threadsPerState_ = std::max(1, threadsPerState);
+    speechrnt::utils::Logger::info("WhisperStatePool loaded " + modelPath + " with " +
+                                   std::to_string(stateCount) + " states x " +
+                                   std::to_string(threadsPerState_) + " threads");
+    return true;
+#else
+    (void)modelPath;
+    (void)threadsPerState;
+    (void)useGPU;
+    setError("Whisper support not compiled in");
+    return false;
+#endif
+}
+
+bool WhisperStatePool::transcribe(size_t slot, const std::vector<float>& audio,
+                                  const std::string& language, bool wordTimings,
+                                  std::vector<TranscriptionResult>& segments) {
+    segments.clear();
+    if (slot >= states_.size()) {
+        setError("Invalid whisper state slot " + std::to_string(slot));
+        return false;
+    }
+    if (audio.empty()) {
+        return true;
+    }
+
+#ifdef WHISPER_AVAILABLE
+    whisper_state* state = states_[slot];
+
+    whisper_full_params params = whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
+    params.n_threads = threadsPerState_;
+    params.print_progress = false;
+    params.print_realtime = false;
+    params.print_special = false;
+    params.print_timestamps = false;
+    params.no_context = true; // Segments are decoded independently and out of order
+    params.token_timestamps = wordTimings;
+    params.language = language.empty() ? "auto" : language.c_str();
+
+    int rc = whisper_full_with_state(ctx_, state, params, audio.data(),
+                                     static_cast<int>(audio.size()));
+    if (rc != 0) {
+        setError("whisper_full_with_state failed with code " + std::to_string(rc));
+        return false;
+    }
+
+    const int segmentCount = whisper_full_n_segments_from_state(state);
+    segments.reserve(static_cast<size_t>(segmentCount));
+
+    for (int i = 0; i < segmentCount; ++i) {
+        TranscriptionResult segment;
+        const char* text = whisper_full_get_segment_text_from_state(state, i);
+        segment.text = text ? text : "";
+        segment.start_time_ms = whisper_full_get_segment_t0_from_state(state, i) * 10;
+        segment.end_time_ms = whisper_full_get_segment_t1_from_state(state, i) * 10;
+        segment.is_partial = false;
+
+        // Segment confidence is the mean token probability
+        const int tokenCount = whisper_full_n_tokens_from_state(state, i);
+        float probabilitySum = 0.0f;
+        int counted = 0;
+        for (int j = 0; j < tokenCount; ++j) {
+            whisper_token_data token = whisper_full_get_token_data_from_state(state, i, j);
+            const char* tokenText = whisper_full_get_token_text_from_state(ctx_, state, i, j);
+            if (!tokenText || tokenText[0] == '[' || (tokenText[0] == '<' && tokenText[1] == '|')) {
+                continue; // Special tokens
+            }
+            probabilitySum += token.p;
+            ++counted;
+
+            if (wordTimings) {
+                // A leading space starts a new word; other tokens continue it
+                if (tokenText[0] == ' ' || segment.word_timings.empty()) {
+                    segment.word_timings.emplace_back(std::string(tokenText), token.t0 * 10,
+                                                      token.t1 * 10, token.p);
+                } else {
+                    auto& word = segment.word_timings.back();
+                    word.word += tokenText;
+                    word.end_ms = token.t1 * 10;
+                    word.confidence = std::min(word.confidence, token.p);
+                }
+            }
+        }
+
+        segment.confidence = counted > 0 ? probabilitySum / counted : 0.0f;
+        segment.quality_metrics.average_token_probability = segment.confidence;
+        segment.detected_language = whisper_lang_str(whisper_full_lang_id_from_state(state));
+        segments.push_back(std::move(segment));
+    }
+
+    return true;
+#else
+    (void)language;
+    (void)wordTimings;
+    setError("Whisper support not compiled in");
+    return false;
+#endif
+}
+
+void WhisperStatePool::shutdown() {
+#ifdef WHISPER_AVAILABLE
+    for (whisper_state* state : states_) {
+        whisper_free_state(state);
+    }
+    if (ctx_) {
+        whisper_free(ctx_);
+    }
+#endif
+    states_.clear();
+    ctx_ = nullptr;
+}
+
+std::string WhisperStatePool::getLastError() const {
+    std::lock_guard<std::mutex> lock(errorMutex_);
+    return lastError_;
+}
+
+void WhisperStatePool::setError(const std::string& error) {
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        lastError_ = error;
+    }
+    speechrnt::utils::Logger::error("WhisperStatePool: " + error);
+}
+
+} // namespace stt
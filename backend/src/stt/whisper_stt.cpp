@@ -16,6 +16,7 @@
 #include <numeric>
 #include <sstream>
 #include <cctype>
+#include <cmath>
 
 #ifdef WHISPER_AVAILABLE
 #include "whisper.h"
@@ -176,6 +177,7 @@ void WhisperSTT::transcribe(const std::vector<float>& audioData, TranscriptionCa
             }
             
             // Run whisper inference with proper parameters
+            encoderCache_.invalidateEncoder();
             int result = whisper_full(ctx_, *params_, audioData.data(), static_cast<int>(audioData.size()));
             
             if (result != 0) {
@@ -199,7 +201,12 @@ void WhisperSTT::transcribe(const std::vector<float>& audioData, TranscriptionCa
                 return;
             }
             
-            processTranscriptionResult(callback, false);
+            // Candidate generation over the same audio starts from this result
+            auto audio = WhisperEncoderCache::fingerprint(audioData);
+            processTranscriptionResult([this, audio, callback](const TranscriptionResult& final) {
+                encoderCache_.storeFinal(audio, final);
+                callback(final);
+            }, false);
             utils::PerformanceMonitor::getInstance().recordCounter("stt.transcriptions_completed");
             
         } catch (const std::exception& e) {
@@ -273,6 +280,7 @@ void WhisperSTT::transcribeLive(const std::vector<float>& audioData, Transcripti
                 return;
             }
             
+            encoderCache_.invalidateEncoder();
             int result = whisper_full(ctx_, live_params, audioData.data(), static_cast<int>(audioData.size()));
             
             if (result != 0) {
@@ -445,6 +453,11 @@ void WhisperSTT::setTranscriptionCompleteCallback(TranscriptionCompleteCallback
     transcriptionCompleteCallback_ = callback;
 }
 
+WhisperEncoderCache::Stats WhisperSTT::getEncoderCacheStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return encoderCache_.getStats();
+}
+
 bool WhisperSTT::validateModel() {
 #ifdef WHISPER_AVAILABLE
     if (!ctx_) {
@@ -801,6 +814,13 @@ void WhisperSTT::addAudioChunk(uint32_t utteranceId, const std::vector<float>& a
     if (!initialized_ || audio.empty()) {
         return;
     }
+    addAudioChunk(utteranceId, ::audio::AudioSegment::copyOf(audio));
+}
+
+void WhisperSTT::addAudioChunk(uint32_t utteranceId, const ::audio::AudioSegment& audio) {
+    if (!initialized_ || audio.empty()) {
+        return;
+    }
     
     std::lock_guard<std::mutex> lock(streamingMutex_);
     
@@ -815,8 +835,8 @@ void WhisperSTT::addAudioChunk(uint32_t utteranceId, const std::vector<float>& a
     if (audioBufferManager_) {
         audioBufferManager_->addAudioData(utteranceId, audio);
     } else {
-        // Fallback: accumulate in memory
-        state.accumulatedAudio.insert(state.accumulatedAudio.end(), audio.begin(), audio.end());
+        // Fallback: accumulate in memory, sharing the segment's blocks
+        state.accumulatedAudio.append(audio);
     }
     
     state.totalAudioSamples += audio.size();
@@ -953,6 +973,7 @@ void WhisperSTT::processStreamingAudio(uint32_t utteranceId, StreamingState& sta
             streaming_params.duration_ms = 0;            // Process entire chunk
             
             // Run whisper inference
+            encoderCache_.invalidateEncoder();
             int result = whisper_full(ctx_, streaming_params, audioChunk.data(), static_cast<int>(audioChunk.size()));
             
             if (result != 0) {
@@ -966,7 +987,11 @@ void WhisperSTT::processStreamingAudio(uint32_t utteranceId, StreamingState& sta
             auto it = streamingStates_.find(utteranceId);
             if (it != streamingStates_.end() && it->second->callback) {
                 // Create a callback that will handle the result
-                auto callback = [this, utteranceId, isPartial](const TranscriptionResult& result) {
+                auto audio = WhisperEncoderCache::fingerprint(audioChunk);
+                auto callback = [this, utteranceId, isPartial, audio](const TranscriptionResult& result) {
+                    if (!isPartial) {
+                        encoderCache_.storeFinal(audio, result);
+                    }
                     std::lock_guard<std::mutex> lock(streamingMutex_);
                     auto stateIt = streamingStates_.find(utteranceId);
                     if (stateIt != streamingStates_.end()) {
@@ -1095,7 +1120,7 @@ std::vector<float> WhisperSTT::getStreamingAudioChunk(uint32_t utteranceId, cons
         return audioBufferManager_->getRecentAudio(utteranceId, sampleCount);
     } else {
         // Fallback: return accumulated audio
-        return state.accumulatedAudio;
+        return state.accumulatedAudio.snapshot().toVector();
     }
 }
 
@@ -1402,6 +1427,7 @@ bool WhisperSTT::initializeWithQuantization(const std::string& modelPath, Quanti
     
     // Use the quantized context as the main context
     ctx_ = getQuantizedContext(level);
+    encoderCache_.clear();
     if (!ctx_) {
         last_error_ = "Failed to get quantized context for level: " + quantizationManager_->levelToString(level);
         return false;
@@ -1478,6 +1504,7 @@ bool WhisperSTT::initializeWithQuantizationGPU(const std::string& modelPath, Qua
     
     // Use the quantized context as the main context
     ctx_ = getQuantizedContext(level);
+    encoderCache_.clear();
     if (!ctx_) {
         last_error_ = "Failed to get quantized GPU context for level: " + quantizationManager_->levelToString(level);
         gpu_enabled_ = false;
@@ -2439,73 +2466,69 @@ sperSTT::generateTranscriptionCandidates(const std::vector<float>& audioData, st
     std::lock_guard<std::mutex> lock(mutex_);
     
     try {
-        // Generate multiple candidates using different sampling strategies
-        std::vector<whisper_full_params> candidateParams;
-        
-        // Candidate 1: Greedy decoding (most confident)
-        whisper_full_params greedyParams = *params_;
-        greedyParams.strategy = WHISPER_SAMPLING_GREEDY;
-        candidateParams.push_back(greedyParams);
+        auto audio = WhisperEncoderCache::fingerprint(audioData);
+        if (encoderCache_.findCandidates(audio, maxCandidates, candidates)) {
+            speechrnt::utils::Logger::debug("Reused " + std::to_string(candidates.size()) + " cached transcription candidates");
+            return;
+        }
         
-        // Candidate 2: Beam search with different beam size
+        // Candidate 1: greedy decoding, the same pass as the final result
+        // Further candidates sample the decoder at rising temperatures
+        std::vector<float> temperatures = {0.0f};
         if (maxCandidates > 1) {
-            whisper_full_params beamParams = *params_;
-            beamParams.strategy = WHISPER_SAMPLING_BEAM_SEARCH;
-            beamParams.beam_search.beam_size = 3;
-            candidateParams.push_back(beamParams);
+            temperatures.push_back(std::min(1.0f, temperature_ + 0.3f));
         }
-        
-        // Candidate 3: Higher temperature for more diversity
         if (maxCandidates > 2) {
-            whisper_full_params tempParams = *params_;
-            tempParams.temperature = std::min(1.0f, temperature_ + 0.3f);
-            candidateParams.push_back(tempParams);
+            temperatures.push_back(std::min(1.0f, temperature_ + 0.6f));
+        }
+        
+        TranscriptionResult finalResult;
+        bool haveFinal = encoderCache_.findFinal(audio, finalResult);
+        std::string language = params_->language ? params_->language : "";
+        if (language.empty() || language == "auto") {
+            language = haveFinal && !finalResult.detected_language.empty()
+                ? finalResult.detected_language : currentDetectedLanguage_;
         }
         
-        // Generate candidates
-        for (size_t i = 0; i < candidateParams.size() && i < static_cast<size_t>(maxCandidates); ++i) {
-            int result = whisper_full(ctx_, candidateParams[i], audioData.data(), static_cast<int>(audioData.size()));
+        // Longer audio spans several encoder windows; only whisper_full handles that
+        bool singleWindow = audioData.size() <= 30 * WHISPER_SAMPLE_RATE;
+        
+        for (size_t i = 0; i < temperatures.size(); ++i) {
+            if (i == 0 && haveFinal) {
+                encoderCache_.recordFinalReuse();
+                candidates.push_back(finalResult);
+                continue;
+            }
             
-            if (result == 0) {
-                TranscriptionResult candidate;
+            TranscriptionResult candidate;
+            bool decoded = false;
+            if (singleWindow) {
+                if (encoderCache_.isEncoded(audio)) {
+                    encoderCache_.recordEncoderReuse();
+                    language = encoderCache_.getEncodedLanguage();
+                } else if (!encodeForCandidates(audioData, audio, language)) {
+                    break;
+                }
+                decoded = decodeCandidate(language, temperatures[i], static_cast<uint32_t>(audio.hash + i), candidate);
+            } else {
+                decoded = runCandidateFullPass(audioData, temperatures[i], candidate);
+            }
+            
+            if (decoded && !candidate.text.empty()) {
+                candidate.is_partial = false;
+                candidate.start_time_ms = 0;
+                candidate.end_time_ms = static_cast<int64_t>(audioData.size() * 1000 / 16000);
                 
-                // Extract transcription result
-                const int n_segments = whisper_full_n_segments(ctx_);
-                if (n_segments > 0) {
-                    std::string combined_text;
-                    float total_confidence = 0.0f;
-                    int valid_segments = 0;
-                    
-                    for (int j = 0; j < n_segments; ++j) {
-                        const char* text = whisper_full_get_segment_text(ctx_, j);
-                        if (text && strlen(text) > 0) {
-                            if (!combined_text.empty()) {
-                                combined_text += " ";
-                            }
-                            combined_text += text;
-                            
-                            float segment_confidence = calculateSegmentConfidence(j);
-                            total_confidence += segment_confidence;
-                            valid_segments++;
-                        }
-                    }
-                    
-                    if (valid_segments > 0) {
-                        candidate.text = combined_text;
-                        candidate.confidence = total_confidence / valid_segments;
-                        candidate.is_partial = false;
-                        candidate.start_time_ms = 0;
-                        candidate.end_time_ms = static_cast<int64_t>(audioData.size() * 1000 / 16000);
-                        
-                        // Add language detection information
-                        updateTranscriptionResultWithLanguage(candidate);
-                        
-                        // Enhance with confidence information
-                        enhanceTranscriptionResultWithConfidence(candidate, audioData, 0.0f);
-                        
-                        candidates.push_back(candidate);
-                    }
+                // Add language detection information
+                updateTranscriptionResultWithLanguage(candidate);
+                if (singleWindow && !language.empty()) {
+                    candidate.detected_language = language;
                 }
+                
+                // Enhance with confidence information
+                enhanceTranscriptionResultWithConfidence(candidate, audioData, 0.0f);
+                
+                candidates.push_back(candidate);
             }
         }
         
@@ -2515,6 +2538,10 @@ sperSTT::generateTranscriptionCandidates(const std::vector<float>& audioData, st
                       return a.confidence > b.confidence;
                   });
         
+        if (candidates.size() == temperatures.size()) {
+            encoderCache_.storeCandidates(audio, maxCandidates, candidates);
+        }
+        
     } catch (const std::exception& e) {
         speechrnt::utils::Logger::error("Exception during candidate generation: " + std::string(e.what()));
     }
@@ -2538,6 +2565,144 @@ sperSTT::generateTranscriptionCandidates(const std::vector<float>& audioData, st
     speechrnt::utils::Logger::debug("Generated " + std::to_string(candidates.size()) + " transcription candidates");
 }
 
+#ifdef WHISPER_AVAILABLE
+bool WhisperSTT::encodeForCandidates(const std::vector<float>& audioData, const WhisperEncoderCache::Fingerprint& audio, std::string& language) {
+    encoderCache_.invalidateEncoder();
+    if (whisper_pcm_to_mel(ctx_, audioData.data(), static_cast<int>(audioData.size()), n_threads_) != 0) {
+        speechrnt::utils::Logger::error("Failed to compute mel spectrogram for candidate generation");
+        return false;
+    }
+    
+    if (language.empty() && whisper_is_multilingual(ctx_)) {
+        // Detection runs the encoder on the mel as part of its work
+        std::vector<float> langProbs(whisper_lang_max_id() + 1, 0.0f);
+        int langId = whisper_lang_auto_detect(ctx_, 0, n_threads_, langProbs.data());
+        if (langId < 0) {
+            speechrnt::utils::Logger::error("Language detection failed during candidate generation");
+            return false;
+        }
+        language = whisper_lang_str(langId);
+    } else if (whisper_encode(ctx_, 0, n_threads_) != 0) {
+        speechrnt::utils::Logger::error("Whisper encoder failed during candidate generation");
+        return false;
+    }
+    
+    encoderCache_.markEncoded(audio, language);
+    return true;
+}
+
+bool WhisperSTT::decodeCandidate(const std::string& language, float temperature, uint32_t seed, TranscriptionResult& candidate) {
+    const int n_vocab = whisper_n_vocab(ctx_);
+    const whisper_token eot = whisper_token_eot(ctx_);
+    
+    std::vector<whisper_token> prompt = {whisper_token_sot(ctx_)};
+    if (whisper_is_multilingual(ctx_)) {
+        int langId = whisper_lang_id(language.c_str());
+        if (langId >= 0) {
+            prompt.push_back(whisper_token_lang(ctx_, langId));
+        }
+        prompt.push_back(translate_to_english_ ? whisper_token_translate(ctx_) : whisper_token_transcribe(ctx_));
+    }
+    prompt.push_back(whisper_token_not(ctx_));
+    
+    if (whisper_decode(ctx_, prompt.data(), static_cast<int>(prompt.size()), 0, n_threads_) != 0) {
+        return false;
+    }
+    
+    std::mt19937 rng(seed);
+    std::vector<float> probs(static_cast<size_t>(eot) + 1);
+    int nPast = static_cast<int>(prompt.size());
+    int lastBatch = nPast;
+    int maxTokens = max_tokens_ > 0 ? max_tokens_ : whisper_n_text_ctx(ctx_) / 2;
+    
+    std::string text;
+    float probabilitySum = 0.0f;
+    int tokenCount = 0;
+    
+    for (int step = 0; step < maxTokens; ++step) {
+        // Logits of the last decoded position; timestamps and other special
+        // tokens past end-of-text are never sampled, nor is an empty result
+        const float* logits = whisper_get_logits(ctx_) + static_cast<size_t>(lastBatch - 1) * n_vocab;
+        int allowed = step == 0 ? eot : eot + 1;
+        
+        float maxLogit = *std::max_element(logits, logits + allowed);
+        float sum = 0.0f;
+        for (int t = 0; t < allowed; ++t) {
+            probs[t] = std::exp(logits[t] - maxLogit);
+            sum += probs[t];
+        }
+        
+        whisper_token token;
+        if (temperature <= 0.0f) {
+            token = static_cast<whisper_token>(std::max_element(probs.begin(), probs.begin() + allowed) - probs.begin());
+        } else {
+            std::vector<double> weights(allowed);
+            for (int t = 0; t < allowed; ++t) {
+                weights[t] = std::exp((logits[t] - maxLogit) / temperature);
+            }
+            std::discrete_distribution<int> sample(weights.begin(), weights.end());
+            token = sample(rng);
+        }
+        
+        if (token == eot) {
+            break;
+        }
+        
+        text += whisper_token_to_str(ctx_, token);
+        probabilitySum += probs[token] / sum;
+        tokenCount++;
+        
+        if (whisper_decode(ctx_, &token, 1, nPast, n_threads_) != 0) {
+            return false;
+        }
+        nPast++;
+        lastBatch = 1;
+    }
+    
+    size_t begin = text.find_first_not_of(' ');
+    candidate.text = begin == std::string::npos ? "" : text.substr(begin);
+    candidate.confidence = tokenCount > 0 ? probabilitySum / tokenCount : 0.0f;
+    return true;
+}
+
+bool WhisperSTT::runCandidateFullPass(const std::vector<float>& audioData, float temperature, TranscriptionResult& candidate) {
+    whisper_full_params candidateParams = *params_;
+    candidateParams.strategy = WHISPER_SAMPLING_GREEDY;
+    candidateParams.temperature = temperature;
+    
+    encoderCache_.invalidateEncoder();
+    if (whisper_full(ctx_, candidateParams, audioData.data(), static_cast<int>(audioData.size())) != 0) {
+        return false;
+    }
+    
+    // Extract transcription result
+    std::string combined_text;
+    float total_confidence = 0.0f;
+    int valid_segments = 0;
+    
+    const int n_segments = whisper_full_n_segments(ctx_);
+    for (int j = 0; j < n_segments; ++j) {
+        const char* text = whisper_full_get_segment_text(ctx_, j);
+        if (text && strlen(text) > 0) {
+            if (!combined_text.empty()) {
+                combined_text += " ";
+            }
+            combined_text += text;
+            
+            total_confidence += calculateSegmentConfidence(j);
+            valid_segments++;
+        }
+    }
+    
+    if (valid_segments == 0) {
+        return false;
+    }
+    candidate.text = combined_text;
+    candidate.confidence = total_confidence / valid_segments;
+    return true;
+}
+#endif
+
 void WhisperSTT::triggerTranslationPipeline(uint32_t utteranceId, const TranscriptionResult& result, const std::vector<TranscriptionResult>& candidates) {
     if (transcriptionCompleteCallback_) {
         try {
@@ -1,8 +1,13 @@
 #include "tts/piper_tts.hpp"
+#include "utils/metrics_registry.hpp"
+#include "utils/performance_monitor.hpp"
+#include "utils/trace_recorder.hpp"
 #include <algorithm>
 #include <array>
+#include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -12,7 +17,45 @@ namespace fs = std::filesystem;
 namespace speechrnt {
 namespace tts {
 
-PiperTTS::PiperTTS() : initialized_(false), speed_(1.0f), volume_(1.0f) {}
+namespace {
+
+// Clause punctuation only ends a unit once the unit has this many bytes, so
+// short interjections are not synthesized on their own
+constexpr size_t MIN_CLAUSE_UNIT_CHARS = 24;
+
+// UTF-8 full-width sentence terminators: 。！？
+constexpr std::array<const char *, 3> WIDE_TERMINATORS = {
+    "\xE3\x80\x82", "\xEF\xBC\x81", "\xEF\xBC\x9F"};
+
+bool endsWithWideTerminator(const std::string &text) {
+  for (const char *terminator : WIDE_TERMINATORS) {
+    size_t length = std::strlen(terminator);
+    if (text.size() >= length &&
+        text.compare(text.size() - length, length, terminator) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string trim(const std::string &text) {
+  size_t begin = 0;
+  size_t end = text.size();
+  while (begin < end && std::isspace(static_cast<unsigned char>(text[begin]))) {
+    ++begin;
+  }
+  while (end > begin &&
+         std::isspace(static_cast<unsigned char>(text[end - 1]))) {
+    --end;
+  }
+  return text.substr(begin, end - begin);
+}
+
+} // namespace
+
+PiperTTS::PiperTTS()
+    : initialized_(false), speed_(1.0f), volume_(1.0f),
+      streaming_lookahead_(2) {}
 
 PiperTTS::~PiperTTS() { cleanup(); }
 
@@ -143,34 +186,70 @@ VoiceInfo PiperTTS::createVoiceInfo(const std::string &voiceId,
 
 SynthesisResult PiperTTS::synthesize(const std::string &text,
                                      const std::string &voiceId) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::string voice;
+  SynthesisCommand command;
+  std::string error;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!prepareSynthesis(voiceId, voice, command, error)) {
+      SynthesisResult result;
+      result.success = false;
+      result.errorMessage = error;
+      return result;
+    }
+  }
 
+  auto start = std::chrono::steady_clock::now();
+  SynthesisResult result;
+  {
+    utils::TraceSpan span("tts.synthesize");
+    result = performSynthesis(command, text, voice);
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  static utils::Histogram &stageHistogram =
+      utils::MetricsRegistry::getInstance().histogram(
+          "speechrnt_pipeline_stage_duration_seconds",
+          "Latency of pipeline stages and end-to-end paths",
+          utils::MetricsRegistry::latencyBuckets(), {{"stage", "tts"}});
+  stageHistogram.observe(seconds);
+  utils::MetricsRegistry::getInstance()
+      .histogram("speechrnt_model_duration_seconds",
+                 "Inference latency per component and model",
+                 utils::MetricsRegistry::latencyBuckets(),
+                 {{"component", "tts"}, {"model", voice}, {"device", "cpu"}})
+      .observe(seconds);
+  return result;
+}
+
+bool PiperTTS::prepareSynthesis(const std::string &voiceId, std::string &voice,
+                                SynthesisCommand &command,
+                                std::string &error) const {
   if (!initialized_) {
-    SynthesisResult result;
-    result.success = false;
-    result.errorMessage = "Piper TTS not initialized";
-    return result;
+    error = "Piper TTS not initialized";
+    return false;
   }
 
-  std::string voice = voiceId.empty() ? default_voice_id_ : voiceId;
+  voice = voiceId.empty() ? default_voice_id_ : voiceId;
 
   // Check if voice exists
   if (voice_map_.find(voice) == voice_map_.end()) {
-    SynthesisResult result;
-    result.success = false;
-    result.errorMessage = "Voice not found: " + voice;
-    return result;
+    error = "Voice not found: " + voice;
+    return false;
   }
 
-  return performSynthesis(text, voice);
+  command.binaryPath = piper_binary_path_;
+  command.modelFile = model_dir_ + "/" + voice + ".onnx";
+  command.speed = speed_;
+  return true;
 }
 
-SynthesisResult PiperTTS::performSynthesis(const std::string &text,
+SynthesisResult PiperTTS::performSynthesis(const SynthesisCommand &command,
+                                           const std::string &text,
                                            const std::string &voiceId) {
   SynthesisResult result;
 
-  std::string modelFile = model_dir_ + "/" + voiceId + ".onnx";
-
   // Construct command: echo "text" | piper --model model.onnx --output_file -
   // Note: We need to be careful with shell escaping for the text
 
@@ -184,11 +263,11 @@ SynthesisResult PiperTTS::performSynthesis(const std::string &text,
     pos += 2;
   }
 
-  std::string cmd = "echo \"" + escapedText + "\" | " + piper_binary_path_ +
-                    " --model " + modelFile + " --output_file -";
+  std::string cmd = "echo \"" + escapedText + "\" | " + command.binaryPath +
+                    " --model " + command.modelFile + " --output_file -";
 
-  if (speed_ != 1.0f) {
-    cmd += " --length_scale " + std::to_string(1.0f / speed_);
+  if (command.speed != 1.0f) {
+    cmd += " --length_scale " + std::to_string(1.0f / command.speed);
   }
 
   FILE *pipe = popen(cmd.c_str(), "r");
@@ -259,6 +338,139 @@ void PiperTTS::synthesizeWithCallback(const std::string &text,
   }).detach();
 }
 
+std::shared_ptr<StreamingSynthesis>
+PiperTTS::synthesizeStreaming(const std::string &text,
+                              SynthesisUnitCallback callback,
+                              const std::string &voiceId) {
+  auto handle = std::make_shared<StreamingSynthesis>();
+
+  std::string voice;
+  SynthesisCommand command;
+  std::string error;
+  size_t lookahead = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prepareSynthesis(voiceId, voice, command, error);
+    lookahead = streaming_lookahead_;
+  }
+
+  std::vector<std::string> units = splitIntoUnits(text);
+  if (error.empty() && units.empty()) {
+    error = "Nothing to synthesize";
+  }
+  if (!error.empty()) {
+    SynthesisResult result;
+    result.success = false;
+    result.errorMessage = error;
+    callback(result, 0, true);
+    handle->markDone();
+    return handle;
+  }
+
+  utils::TraceContext trace;
+  if (utils::TraceRecorder::isEnabled()) {
+    trace = utils::TraceRecorder::current();
+  }
+
+  // The worker only touches copies, so it may outlive this engine
+  std::thread([handle, callback, command, voice, lookahead, trace,
+               units = std::move(units)]() {
+    utils::ScopedTraceContext traceScope(trace);
+    std::deque<std::future<SynthesisResult>> inFlight;
+    size_t launched = 0;
+
+    for (size_t index = 0; index < units.size(); ++index) {
+      // Keep the next units synthesizing while this one is delivered
+      while (launched < units.size() && inFlight.size() <= lookahead) {
+        inFlight.push_back(std::async(
+            std::launch::async,
+            [command, voice, trace, unit = units[launched]]() {
+              utils::TraceSpan span("tts.unit", trace);
+              return performSynthesis(command, unit, voice);
+            }));
+        ++launched;
+      }
+
+      auto &next = inFlight.front();
+      while (next.wait_for(std::chrono::milliseconds(20)) !=
+                 std::future_status::ready &&
+             !handle->isCancelled()) {
+      }
+      if (handle->isCancelled()) {
+        break;
+      }
+
+      SynthesisResult unit = next.get();
+      inFlight.pop_front();
+      bool isLast = index + 1 == units.size() || !unit.success;
+
+      handle->markUnitDelivered();
+      if (index == 0) {
+        utils::PerformanceMonitor::getInstance().recordLatency(
+            "tts.time_to_first_audio_ms", handle->getTimeToFirstAudioMs());
+      }
+      callback(unit, index, isLast);
+
+      if (isLast || handle->isCancelled()) {
+        break;
+      }
+    }
+
+    // Syntheses still running after a cancel are drained here, after the
+    // caller has been released
+    handle->markDone();
+  }).detach();
+
+  return handle;
+}
+
+std::vector<std::string> PiperTTS::splitIntoUnits(const std::string &text,
+                                                  size_t maxUnitChars) {
+  std::vector<std::string> units;
+  std::string current;
+
+  auto flush = [&]() {
+    std::string unit = trim(current);
+    if (!unit.empty()) {
+      units.push_back(std::move(unit));
+    }
+    current.clear();
+  };
+
+  for (size_t i = 0; i < text.size(); ++i) {
+    char c = text[i];
+    current += c;
+
+    bool atBoundary = i + 1 == text.size() ||
+                      std::isspace(static_cast<unsigned char>(text[i + 1]));
+    bool sentenceEnd = ((c == '.' || c == '!' || c == '?') && atBoundary) ||
+                       endsWithWideTerminator(current);
+    bool clauseEnd = (c == ',' || c == ';' || c == ':') && atBoundary &&
+                     current.size() >= MIN_CLAUSE_UNIT_CHARS;
+
+    if (sentenceEnd || clauseEnd) {
+      flush();
+    } else if (current.size() >= maxUnitChars) {
+      // Carry the partial last word over into the next unit
+      size_t space = current.find_last_of(" \t\n");
+      if (space != std::string::npos && space > 0) {
+        std::string rest = current.substr(space + 1);
+        current.erase(space);
+        flush();
+        current = std::move(rest);
+      }
+    }
+  }
+  flush();
+
+  return units;
+}
+
+void PiperTTS::setStreamingLookahead(size_t units) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  streaming_lookahead_ = units;
+}
+
 std::vector<VoiceInfo> PiperTTS::getAvailableVoices() const {
   std::lock_guard<std::mutex> lock(mutex_);
   return available_voices_;
@@ -1,4 +1,6 @@
 #include "utils/advanced_debug.hpp"
+#include "audio/frame_features.hpp"
+#include "audio/signal_statistics.hpp"
 #include "utils/logging.hpp"
 #include <algorithm>
 #include <random>
@@ -549,9 +551,10 @@ AudioCharacteristics AdvancedDebugManager::analyzeAudioCharacteristics(const std
     characteristics.sourceInfo = sourceInfo;
     
     // Signal analysis
-    characteristics.rmsLevel = calculateRMS(audioData);
-    characteristics.peakLevel = calculatePeak(audioData);
-    characteristics.zeroCrossingRate = calculateZeroCrossingRate(audioData);
+    auto stats = audio::SignalStatistics::compute(audioData);
+    characteristics.rmsLevel = stats.rms();
+    characteristics.peakLevel = stats.peak;
+    characteristics.zeroCrossingRate = stats.zeroCrossingRate();
     
     // Quality indicators
     characteristics.hasClipping = characteristics.peakLevel >= 0.95;
@@ -582,9 +585,17 @@ AudioCharacteristics AdvancedDebugManager::analyzeAudioCharacteristics(const std
         characteristics.signalToNoiseRatio = 0.0;
     }
     
-    // Calculate MFCC coefficients (simplified version)
+    // MFCC and spectrum share one analysis of the first frame
+    audio::FrameAnalysisConfig frameConfig;
+    frameConfig.sampleRate = sampleRate;
+    frameConfig.frameSize = std::min(audioData.size(), static_cast<size_t>(1024));
+    frameConfig.hopSize = frameConfig.frameSize;
+    audio::FrameFeatures frame(audio::FrameAnalysisTables::create(frameConfig),
+                               audioData.data(), frameConfig.frameSize);
+    
+    // Calculate MFCC coefficients
     try {
-        characteristics.mfccCoefficients = calculateMFCC(audioData, sampleRate);
+        characteristics.mfccCoefficients = calculateMFCC(frame);
     } catch (const std::exception&) {
         // If MFCC calculation fails, continue without it
         characteristics.mfccCoefficients.clear();
@@ -592,7 +603,7 @@ AudioCharacteristics AdvancedDebugManager::analyzeAudioCharacteristics(const std
     
     // Calculate frequency spectrum
     try {
-        characteristics.frequencySpectrum = calculateFFT(audioData);
+        characteristics.frequencySpectrum = calculateFFT(frame);
         
         // Calculate spectral centroid and rolloff from spectrum
         if (!characteristics.frequencySpectrum.empty()) {
@@ -922,108 +933,15 @@ void AdvancedDebugManager::notifyCallbacks(const std::string& component, DebugLe
     }
 }
 
-double AdvancedDebugManager::calculateRMS(const std::vector<float>& audioData) {
-    if (audioData.empty()) {
-        return 0.0;
-    }
-    
-    double sum = 0.0;
-    for (float sample : audioData) {
-        sum += sample * sample;
-    }
-    
-    return std::sqrt(sum / audioData.size());
-}
-
-double AdvancedDebugManager::calculatePeak(const std::vector<float>& audioData) {
-    if (audioData.empty()) {
-        return 0.0;
-    }
-    
-    float maxVal = 0.0f;
-    for (float sample : audioData) {
-        maxVal = std::max(maxVal, std::abs(sample));
-    }
-    
-    return static_cast<double>(maxVal);
-}
-
-double AdvancedDebugManager::calculateZeroCrossingRate(const std::vector<float>& audioData) {
-    if (audioData.size() < 2) {
-        return 0.0;
-    }
-    
-    int zeroCrossings = 0;
-    for (size_t i = 1; i < audioData.size(); ++i) {
-        if ((audioData[i] >= 0) != (audioData[i-1] >= 0)) {
-            zeroCrossings++;
-        }
-    }
-    
-    return static_cast<double>(zeroCrossings) / (audioData.size() - 1);
-}
-
-std::vector<double> AdvancedDebugManager::calculateMFCC(const std::vector<float>& audioData, int sampleRate) {
-    // Simplified MFCC calculation - in a real implementation, you would use a proper DSP library
-    std::vector<double> mfcc(13, 0.0);
-    
-    if (audioData.empty()) {
-        return mfcc;
-    }
-    
-    // This is a placeholder implementation
-    // Real MFCC calculation would involve:
-    // 1. Pre-emphasis
-    // 2. Windowing
-    // 3. FFT
-    // 4. Mel filter bank
-    // 5. Log
-    // 6. DCT
-    
-    // For now, just return some basic spectral features as approximation
-    double energy = 0.0;
-    for (float sample : audioData) {
-        energy += sample * sample;
-    }
-    
-    mfcc[0] = std::log(energy + 1e-10); // Log energy
-    
-    // Fill remaining coefficients with simplified calculations
-    for (int i = 1; i < 13; ++i) {
-        mfcc[i] = energy * std::cos(i * M_PI / 13.0) * 0.1;
-    }
-    
-    return mfcc;
+std::vector<double> AdvancedDebugManager::calculateMFCC(audio::FrameFeatures& frame) {
+    const auto& mfcc = frame.mfcc();
+    return std::vector<double>(mfcc.begin(), mfcc.end());
 }
 
-std::vector<double> AdvancedDebugManager::calculateFFT(const std::vector<float>& audioData) {
-    // Simplified FFT calculation - in a real implementation, you would use FFTW or similar
-    std::vector<double> spectrum;
-    
-    if (audioData.empty()) {
-        return spectrum;
-    }
-    
-    // This is a placeholder implementation
-    // Real FFT would provide proper frequency domain representation
-    
-    size_t fftSize = std::min(audioData.size(), static_cast<size_t>(1024));
-    spectrum.resize(fftSize / 2);
-    
-    // Simple magnitude spectrum approximation
-    for (size_t i = 0; i < spectrum.size(); ++i) {
-        double real = 0.0, imag = 0.0;
-        
-        for (size_t j = 0; j < fftSize; ++j) {
-            double angle = -2.0 * M_PI * i * j / fftSize;
-            real += audioData[j] * std::cos(angle);
-            imag += audioData[j] * std::sin(angle);
-        }
-        
-        spectrum[i] = std::sqrt(real * real + imag * imag);
-    }
-    
-    return spectrum;
+std::vector<double> AdvancedDebugManager::calculateFFT(audio::FrameFeatures& frame) {
+    // Bins below Nyquist, so bin i sits at i * sampleRate / (2 * size)
+    const auto& magnitude = frame.magnitudeSpectrum();
+    return std::vector<double>(magnitude.begin(), magnitude.end() - (magnitude.empty() ? 0 : 1));
 }
 
 } // namespace utils
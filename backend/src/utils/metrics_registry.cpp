@@ -0,0 +1,335 @@
+#include "utils/metrics_registry.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace speechrnt {
+namespace utils {
+
+namespace {
+
+// Shortest round-trip form, independent of the global locale
+void appendNumber(std::string& out, double value) {
+    if (std::isnan(value)) {
+        out += "NaN";
+    } else if (std::isinf(value)) {
+        out += value > 0 ? "+Inf" : "-Inf";
+    } else {
+        char buffer[32];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
+    }
+}
+
+void appendNumber(std::string& out, uint64_t value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+void appendEscaped(std::string& out, const std::string& text) {
+    for (char c : text) {
+        if (c == '\\') {
+            out += "\\\\";
+        } else if (c == '"') {
+            out += "\\\"";
+        } else if (c == '\n') {
+            out += "\\n";
+        } else {
+            out += c;
+        }
+    }
+}
+
+// Name followed by "{labels}", or by nothing when there are no labels
+void appendSeriesName(std::string& out, const std::string& name, const char* suffix,
+                      const std::string& labels, const std::string& extraLabel = {}) {
+    out += name;
+    out += suffix;
+    if (labels.empty() && extraLabel.empty()) {
+        return;
+    }
+    out += '{';
+    out += labels;
+    if (!labels.empty() && !extraLabel.empty()) {
+        out += ',';
+    }
+    out += extraLabel;
+    out += '}';
+}
+
+} // namespace
+
+void Gauge::add(double amount) {
+    double current = value_.load(std::memory_order_relaxed);
+    while (!value_.compare_exchange_weak(current, current + amount, std::memory_order_relaxed)) {
+    }
+}
+
+Histogram::Histogram(std::vector<double> bounds)
+    : bounds_(std::move(bounds))
+    , buckets_(new std::atomic<uint64_t>[bounds_.size() + 1]) {
+    std::sort(bounds_.begin(), bounds_.end());
+    for (size_t i = 0; i <= bounds_.size(); ++i) {
+        buckets_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::observe(double value) {
+    // Buckets are inclusive upper bounds ("le")
+    size_t index = std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin();
+    buckets_[index].fetch_add(1, std::memory_order_relaxed);
+    double current = sum_.load(std::memory_order_relaxed);
+    while (!sum_.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t Histogram::count() const {
+    uint64_t total = 0;
+    for (size_t i = 0; i <= bounds_.size(); ++i) {
+        total += bucketCount(i);
+    }
+    return total;
+}
+
+struct MetricsRegistry::Series {
+    std::string labels;              // Rendered once: key="value",...
+    std::unique_ptr<Counter> counter;
+    std::unique_ptr<Gauge> gauge;
+    std::unique_ptr<Histogram> histogram;
+    std::vector<std::string> bucketLabels; // le="..." per histogram bound
+    std::atomic<Series*> next{nullptr};
+};
+
+struct MetricsRegistry::Family {
+    std::string name;
+    std::string help;
+    Type type;
+    std::atomic<Series*> head{nullptr};
+    Series* tail = nullptr;
+    std::atomic<Family*> next{nullptr};
+};
+
+MetricsRegistry& MetricsRegistry::getInstance() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+MetricsRegistry::~MetricsRegistry() {
+    Family* family = head_.load(std::memory_order_acquire);
+    while (family) {
+        Series* series = family->head.load(std::memory_order_acquire);
+        while (series) {
+            Series* nextSeries = series->next.load(std::memory_order_relaxed);
+            delete series;
+            series = nextSeries;
+        }
+        Family* nextFamily = family->next.load(std::memory_order_relaxed);
+        delete family;
+        family = nextFamily;
+    }
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help,
+                                  const MetricLabels& labels) {
+    return *series(Type::COUNTER, name, help, labels, nullptr).counter;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help,
+                              const MetricLabels& labels) {
+    return *series(Type::GAUGE, name, help, labels, nullptr).gauge;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name, const std::string& help,
+                                      const std::vector<double>& bounds,
+                                      const MetricLabels& labels) {
+    return *series(Type::HISTOGRAM, name, help, labels, &bounds).histogram;
+}
+
+MetricsRegistry::Series& MetricsRegistry::series(Type type, const std::string& name,
+                                                 const std::string& help,
+                                                 const MetricLabels& labels,
+                                                 const std::vector<double>* bounds) {
+    std::string rendered = renderLabels(labels);
+
+    // Fast path: the series exists, no lock taken
+    Family* family = findFamily(name);
+    if (family && family->type == type) {
+        if (Series* existing = findSeries(*family, rendered)) {
+            return *existing;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(registrationMutex_);
+    family = findFamily(name);
+    if (!family) {
+        family = new Family();
+        family->name = name;
+        family->help = help;
+        family->type = type;
+        if (tail_) {
+            tail_->next.store(family, std::memory_order_release);
+        } else {
+            head_.store(family, std::memory_order_release);
+        }
+        tail_ = family;
+    } else if (family->type != type) {
+        throw std::logic_error("Metric " + name + " is already registered with another type");
+    }
+
+    if (Series* existing = findSeries(*family, rendered)) {
+        return *existing;
+    }
+
+    Series* created = new Series();
+    created->labels = std::move(rendered);
+    switch (type) {
+    case Type::COUNTER:
+        created->counter = std::make_unique<Counter>();
+        break;
+    case Type::GAUGE:
+        created->gauge = std::make_unique<Gauge>();
+        break;
+    case Type::HISTOGRAM:
+        created->histogram = std::make_unique<Histogram>(*bounds);
+        for (double bound : created->histogram->bounds()) {
+            std::string label = "le=\"";
+            appendNumber(label, bound);
+            label += '"';
+            created->bucketLabels.push_back(std::move(label));
+        }
+        created->bucketLabels.push_back("le=\"+Inf\"");
+        break;
+    }
+
+    // Fully built before it is linked, so readers never see a partial series
+    if (family->tail) {
+        family->tail->next.store(created, std::memory_order_release);
+    } else {
+        family->head.store(created, std::memory_order_release);
+    }
+    family->tail = created;
+    return *created;
+}
+
+MetricsRegistry::Family* MetricsRegistry::findFamily(const std::string& name) const {
+    for (Family* family = head_.load(std::memory_order_acquire); family;
+         family = family->next.load(std::memory_order_acquire)) {
+        if (family->name == name) {
+            return family;
+        }
+    }
+    return nullptr;
+}
+
+MetricsRegistry::Series* MetricsRegistry::findSeries(const Family& family, const std::string& labels) {
+    for (Series* series = family.head.load(std::memory_order_acquire); series;
+         series = series->next.load(std::memory_order_acquire)) {
+        if (series->labels == labels) {
+            return series;
+        }
+    }
+    return nullptr;
+}
+
+std::string MetricsRegistry::renderLabels(const MetricLabels& labels) {
+    std::string rendered;
+    for (const auto& label : labels) {
+        if (!rendered.empty()) {
+            rendered += ',';
+        }
+        rendered += label.first;
+        rendered += "=\"";
+        appendEscaped(rendered, label.second);
+        rendered += '"';
+    }
+    return rendered;
+}
+
+void MetricsRegistry::exposeOpenMetrics(std::string& out) const {
+    out.clear();
+    out.reserve(lastExpositionSize_.load(std::memory_order_relaxed) + 256);
+
+    for (Family* family = head_.load(std::memory_order_acquire); family;
+         family = family->next.load(std::memory_order_acquire)) {
+        out += "# TYPE ";
+        out += family->name;
+        switch (family->type) {
+        case Type::COUNTER:
+            out += " counter\n";
+            break;
+        case Type::GAUGE:
+            out += " gauge\n";
+            break;
+        case Type::HISTOGRAM:
+            out += " histogram\n";
+            break;
+        }
+        out += "# HELP ";
+        out += family->name;
+        out += ' ';
+        appendEscaped(out, family->help);
+        out += '\n';
+
+        for (Series* series = family->head.load(std::memory_order_acquire); series;
+             series = series->next.load(std::memory_order_acquire)) {
+            switch (family->type) {
+            case Type::COUNTER:
+                appendSeriesName(out, family->name, "_total", series->labels);
+                out += ' ';
+                appendNumber(out, series->counter->value());
+                out += '\n';
+                break;
+            case Type::GAUGE:
+                appendSeriesName(out, family->name, "", series->labels);
+                out += ' ';
+                appendNumber(out, series->gauge->value());
+                out += '\n';
+                break;
+            case Type::HISTOGRAM: {
+                const Histogram& histogram = *series->histogram;
+                uint64_t cumulative = 0;
+                for (size_t i = 0; i < series->bucketLabels.size(); ++i) {
+                    cumulative += histogram.bucketCount(i);
+                    appendSeriesName(out, family->name, "_bucket", series->labels,
+                                     series->bucketLabels[i]);
+                    out += ' ';
+                    appendNumber(out, cumulative);
+                    out += '\n';
+                }
+                // Buckets are read one by one while observers run; the
+                // count is their total so the exposition stays consistent
+                appendSeriesName(out, family->name, "_count", series->labels);
+                out += ' ';
+                appendNumber(out, cumulative);
+                out += '\n';
+                appendSeriesName(out, family->name, "_sum", series->labels);
+                out += ' ';
+                appendNumber(out, histogram.sum());
+                out += '\n';
+                break;
+            }
+            }
+        }
+    }
+    out += "# EOF\n";
+    lastExpositionSize_.store(out.size(), std::memory_order_relaxed);
+}
+
+std::string MetricsRegistry::exposeOpenMetrics() const {
+    std::string out;
+    exposeOpenMetrics(out);
+    return out;
+}
+
+const std::vector<double>& MetricsRegistry::latencyBuckets() {
+    static const std::vector<double> buckets = {
+        0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1,
+        0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0
+    };
+    return buckets;
+}
+
+} // namespace utils
+} // namespace speechrnt
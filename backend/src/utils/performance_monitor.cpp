@@ -1,11 +1,14 @@
 #include "utils/performance_monitor.hpp"
 #include "utils/logging.hpp"
 #include "utils/gpu_manager.hpp"
+#include "utils/metrics_registry.hpp"
+#include "utils/system_resource_sampler.hpp"
 #include <algorithm>
 #include <numeric>
 #include <sstream>
 #include <fstream>
 #include <cmath>
+#include <unordered_map>
 
 using namespace utils;
 
@@ -14,7 +17,6 @@ using namespace utils;
 #include <windows.h>
 #include <psapi.h>
 #elif __linux__
-#include <sys/sysinfo.h>
 #include <unistd.h>
 #elif __APPLE__
 #include <sys/types.h>
@@ -62,6 +64,33 @@ const std::string PerformanceMonitor::METRIC_VAD_RESPONSE_TIME = "vad.response_t
 const std::string PerformanceMonitor::METRIC_VAD_STATE_CHANGES = "vad.state_changes_count";
 const std::string PerformanceMonitor::METRIC_VAD_SPEECH_DETECTION_RATE = "vad.speech_detection_rate";
 
+// Pipeline latencies mirrored into the /metrics histograms. STT stages,
+// VAD, MT and TTS synthesis feed their own series at the source, so they
+// are not here.
+Histogram* PerformanceMonitor::pipelineStageHistogram(const std::string& metricName) {
+    static const std::unordered_map<std::string, Histogram*> histograms = [] {
+        std::unordered_map<std::string, Histogram*> table;
+        auto add = [&table](const std::string& name, const std::string& stage) {
+            table[name] = &MetricsRegistry::getInstance().histogram(
+                "speechrnt_pipeline_stage_duration_seconds",
+                "Latency of pipeline stages and end-to-end paths",
+                MetricsRegistry::latencyBuckets(), {{"stage", stage}});
+        };
+        add(METRIC_STT_LATENCY, "stt");
+        add(METRIC_END_TO_END_LATENCY, "end_to_end");
+        add(METRIC_WEBSOCKET_LATENCY, "websocket");
+        add(METRIC_STT_LANGUAGE_DETECTION_LATENCY, "language_detection");
+        add("tts.time_to_first_audio_ms", "tts_first_audio");
+        add("session.time_to_first_audio_ms", "session_first_audio");
+        add("audio.capture_to_utterance_latency_ms", "capture_to_utterance");
+        add("audio.streaming_processing_latency_ms", "audio_streaming");
+        return table;
+    }();
+
+    auto it = histograms.find(metricName);
+    return it != histograms.end() ? it->second : nullptr;
+}
+
 LatencyTimer::LatencyTimer(const std::string& metricName)
     : metricName_(metricName)
     , startTime_(std::chrono::steady_clock::now())
@@ -143,6 +172,11 @@ void PerformanceMonitor::recordMetric(const std::string& name, double value,
 
 void PerformanceMonitor::recordLatency(const std::string& name, double latencyMs,
                                      const std::map<std::string, std::string>& tags) {
+    if (enabled_.load()) {
+        if (Histogram* histogram = pipelineStageHistogram(name)) {
+            histogram->observe(latencyMs / 1000.0);
+        }
+    }
     recordMetric(name, latencyMs, "ms", tags);
     totalLatencyMeasurements_++;
 }
@@ -499,41 +533,33 @@ void PerformanceMonitor::setMaxDataPoints(size_t maxPoints) {
 }
 
 void PerformanceMonitor::startSystemMetricsCollection() {
-    if (systemMetricsRunning_.load()) {
+    if (systemMetricsRunning_.exchange(true)) {
         return;
     }
     
-    systemMetricsRunning_ = true;
-    systemMetricsThread_ = std::make_unique<std::thread>([this]() {
-        Logger::info("System metrics collection started");
-        
-        while (systemMetricsRunning_.load()) {
+    SystemResourceSampler::getInstance().ensureStarted(std::chrono::milliseconds(collectionIntervalMs_));
+    systemMetricsTimer_ = TimerService::getInstance().schedulePeriodic(
+        "performance_monitor.system_metrics", std::chrono::milliseconds(collectionIntervalMs_), [this]() {
             try {
                 collectSystemMetrics();
                 collectGPUMetrics();
-                
-                std::this_thread::sleep_for(std::chrono::milliseconds(collectionIntervalMs_));
             } catch (const std::exception& e) {
                 Logger::warn("Error collecting system metrics: " + std::string(e.what()));
             }
-        }
-        
-        Logger::info("System metrics collection stopped");
-    });
+        }, true);
+    
+    Logger::info("System metrics collection started");
 }
 
 void PerformanceMonitor::stopSystemMetricsCollection() {
-    if (!systemMetricsRunning_.load()) {
+    if (!systemMetricsRunning_.exchange(false)) {
         return;
     }
     
-    systemMetricsRunning_ = false;
-    
-    if (systemMetricsThread_ && systemMetricsThread_->joinable()) {
-        systemMetricsThread_->join();
-    }
+    TimerService::getInstance().cancel(systemMetricsTimer_);
+    systemMetricsTimer_ = TimerService::INVALID_TIMER;
     
-    systemMetricsThread_.reset();
+    Logger::info("System metrics collection stopped");
 }
 
 void PerformanceMonitor::cleanup() {
@@ -575,9 +601,9 @@ void PerformanceMonitor::collectMemoryMetrics() {
         recordMetric(METRIC_MEMORY_USAGE, usedMemoryMB, "MB");
     }
 #elif __linux__
-    struct sysinfo memInfo;
-    if (sysinfo(&memInfo) == 0) {
-        double usedMemoryMB = static_cast<double>(memInfo.totalram - memInfo.freeram) * memInfo.mem_unit / (1024 * 1024);
+    auto snapshot = SystemResourceSampler::getInstance().getSnapshot();
+    if (snapshot.totalMemoryMB > 0) {
+        double usedMemoryMB = static_cast<double>(snapshot.totalMemoryMB - snapshot.freeMemoryMB);
         recordMetric(METRIC_MEMORY_USAGE, usedMemoryMB, "MB");
     }
 #elif __APPLE__
@@ -638,36 +664,8 @@ void PerformanceMonitor::collectCPUMetrics() {
     }
     
 #elif __linux__
-    static unsigned long long lastTotalTime = 0;
-    static unsigned long long lastIdleTime = 0;
-    static bool firstCall = true;
-    
-    std::ifstream procStat("/proc/stat");
-    if (procStat.is_open()) {
-        std::string line;
-        if (std::getline(procStat, line)) {
-            std::istringstream iss(line);
-            std::string cpu;
-            unsigned long long user, nice, system, idle, iowait, irq, softirq, steal;
-            
-            if (iss >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal) {
-                unsigned long long totalTime = user + nice + system + idle + iowait + irq + softirq + steal;
-                
-                if (!firstCall && totalTime > lastTotalTime) {
-                    unsigned long long totalDiff = totalTime - lastTotalTime;
-                    unsigned long long idleDiff = idle - lastIdleTime;
-                    
-                    if (totalDiff > 0) {
-                        cpuUsage = (static_cast<double>(totalDiff - idleDiff) / static_cast<double>(totalDiff)) * 100.0;
-                    }
-                }
-                
-                lastTotalTime = totalTime;
-                lastIdleTime = idle;
-                firstCall = false;
-            }
-        }
-    }
+    // The shared sampler already tracks /proc/stat deltas between its ticks
+    cpuUsage = SystemResourceSampler::getInstance().getSnapshot().cpuUsage * 100.0;
     
 #elif __APPLE__
     static host_cpu_load_info_data_t lastCpuInfo;
@@ -0,0 +1,280 @@
+#include "utils/system_resource_sampler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/statvfs.h>
+#include <unistd.h>
+#endif
+
+namespace speechrnt {
+namespace utils {
+
+namespace {
+
+int64_t steadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+SystemResourceSampler& SystemResourceSampler::getInstance() {
+    // Leaked for the same reason as TimerService: consumers read it from their destructors
+    static SystemResourceSampler* instance = new SystemResourceSampler();
+    return *instance;
+}
+
+SystemResourceSampler::SystemResourceSampler()
+    : sequence_(0)
+    , sampleCount_(0)
+    , timerId_(TimerService::INVALID_TIMER)
+    , interval_(0) {
+    for (auto& word : words_) {
+        word.store(0, std::memory_order_relaxed);
+    }
+}
+
+SystemResourceSampler::~SystemResourceSampler() {
+    stop();
+}
+
+void SystemResourceSampler::ensureStarted(std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    if (timerId_ != TimerService::INVALID_TIMER) {
+        if (interval < interval_) {
+            interval_ = interval;
+            TimerService::getInstance().reschedule(timerId_, interval);
+        }
+        return;
+    }
+
+    interval_ = interval;
+    timerId_ = TimerService::getInstance().schedulePeriodic(
+        "system_resource_sampler", interval, [this]() { sampleNow(); }, true);
+}
+
+void SystemResourceSampler::stop() {
+    TimerService::TimerId id;
+    {
+        std::lock_guard<std::mutex> lock(controlMutex_);
+        id = timerId_;
+        timerId_ = TimerService::INVALID_TIMER;
+    }
+    if (id != TimerService::INVALID_TIMER) {
+        TimerService::getInstance().cancel(id);
+    }
+}
+
+bool SystemResourceSampler::isRunning() const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    return timerId_ != TimerService::INVALID_TIMER;
+}
+
+SystemResourceSnapshot SystemResourceSampler::getSnapshot() {
+    SystemResourceSnapshot snapshot;
+    for (int attempt = 0; ; ++attempt) {
+        if (tryRead(snapshot)) {
+            break;
+        }
+        if (attempt > 8) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (snapshot.sampleCount == 0) {
+        return sampleNow();
+    }
+    return snapshot;
+}
+
+SystemResourceSnapshot SystemResourceSampler::sampleNow() {
+    std::lock_guard<std::mutex> lock(sampleMutex_);
+    SystemResourceSnapshot snapshot = collect();
+    snapshot.sampleCount = ++sampleCount_;
+    publish(snapshot);
+    return snapshot;
+}
+
+void SystemResourceSampler::publish(const SystemResourceSnapshot& snapshot) {
+    uint64_t buffer[SNAPSHOT_WORDS] = {};
+    std::memcpy(buffer, &snapshot, sizeof(snapshot));
+
+    uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < SNAPSHOT_WORDS; ++i) {
+        words_[i].store(buffer[i], std::memory_order_relaxed);
+    }
+    sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+bool SystemResourceSampler::tryRead(SystemResourceSnapshot& snapshot) const {
+    uint64_t before = sequence_.load(std::memory_order_acquire);
+    if (before & 1) {
+        return false;
+    }
+
+    uint64_t buffer[SNAPSHOT_WORDS];
+    for (size_t i = 0; i < SNAPSHOT_WORDS; ++i) {
+        buffer[i] = words_[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence_.load(std::memory_order_relaxed) != before) {
+        return false;
+    }
+
+    std::memcpy(&snapshot, buffer, sizeof(snapshot));
+    return true;
+}
+
+SystemResourceSnapshot SystemResourceSampler::collect() {
+    SystemResourceSnapshot snapshot;
+    snapshot.timestampMs = steadyNowMs();
+    snapshot.cpuCount = std::max(1u, std::thread::hardware_concurrency());
+
+#ifdef __linux__
+    CounterState current;
+    current.timestampMs = snapshot.timestampMs;
+
+    // System CPU: aggregate line of /proc/stat
+    std::ifstream procStat("/proc/stat");
+    std::string line;
+    if (procStat.is_open() && std::getline(procStat, line)) {
+        std::istringstream iss(line);
+        std::string cpu;
+        unsigned long long user = 0, nice = 0, system = 0, idle = 0;
+        unsigned long long iowait = 0, irq = 0, softirq = 0, steal = 0;
+        if (iss >> cpu >> user >> nice >> system >> idle) {
+            iss >> iowait >> irq >> softirq >> steal;
+            current.cpuIdle = idle + iowait;
+            current.cpuTotal = user + nice + system + idle + iowait + irq + softirq + steal;
+        }
+    }
+
+    // Process CPU, threads and RSS: fields after the parenthesised command name
+    std::ifstream selfStat("/proc/self/stat");
+    if (selfStat.is_open() && std::getline(selfStat, line)) {
+        size_t close = line.rfind(')');
+        if (close != std::string::npos) {
+            std::istringstream iss(line.substr(close + 2));
+            std::string field;
+            unsigned long long utime = 0, stime = 0, threads = 0, rssPages = 0;
+            // Field 3 (state) is the first after the name; utime is field 14
+            for (int index = 3; index <= 24 && (iss >> field); ++index) {
+                switch (index) {
+                    case 14: utime = std::stoull(field); break;
+                    case 15: stime = std::stoull(field); break;
+                    case 20: threads = std::stoull(field); break;
+                    case 24: rssPages = std::stoull(field); break;
+                    default: break;
+                }
+            }
+            current.processTicks = utime + stime;
+            snapshot.processThreads = static_cast<uint32_t>(threads);
+            snapshot.processRssMB = rssPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) / (1024 * 1024);
+        }
+    }
+
+    std::ifstream meminfo("/proc/meminfo");
+    uint64_t memTotalKB = 0, memFreeKB = 0, memAvailableKB = 0;
+    bool haveAvailable = false;
+    while (meminfo.is_open() && std::getline(meminfo, line)) {
+        std::istringstream iss(line);
+        std::string key;
+        uint64_t value = 0;
+        if (!(iss >> key >> value)) {
+            continue;
+        }
+        if (key == "MemTotal:") {
+            memTotalKB = value;
+        } else if (key == "MemFree:") {
+            memFreeKB = value;
+        } else if (key == "MemAvailable:") {
+            memAvailableKB = value;
+            haveAvailable = true;
+            break;
+        }
+    }
+    if (!haveAvailable) {
+        memAvailableKB = memFreeKB;
+    }
+    snapshot.totalMemoryMB = memTotalKB / 1024;
+    snapshot.availableMemoryMB = memAvailableKB / 1024;
+    snapshot.freeMemoryMB = memFreeKB / 1024;
+    if (memTotalKB > 0) {
+        snapshot.memoryUsage = static_cast<float>(memTotalKB - std::min(memAvailableKB, memTotalKB)) / memTotalKB;
+    }
+
+    std::ifstream loadavg("/proc/loadavg");
+    if (loadavg.is_open()) {
+        loadavg >> snapshot.loadAverage1m;
+    }
+
+    // Network totals: two header lines, then "iface: rx_bytes ... (8 rx fields) tx_bytes ..."
+    std::ifstream netDev("/proc/net/dev");
+    int lineNumber = 0;
+    while (netDev.is_open() && std::getline(netDev, line)) {
+        if (++lineNumber <= 2) {
+            continue;
+        }
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::string name = line.substr(0, colon);
+        name.erase(0, name.find_first_not_of(' '));
+        if (name == "lo") {
+            continue;
+        }
+        std::istringstream iss(line.substr(colon + 1));
+        uint64_t fields[9] = {};
+        for (auto& field : fields) {
+            iss >> field;
+        }
+        current.rxBytes += fields[0];
+        current.txBytes += fields[8];
+    }
+    snapshot.networkRxBytes = current.rxBytes;
+    snapshot.networkTxBytes = current.txBytes;
+
+    struct statvfs fs;
+    if (statvfs("/", &fs) == 0 && fs.f_blocks > 0) {
+        unsigned long long total = static_cast<unsigned long long>(fs.f_blocks) * fs.f_frsize;
+        unsigned long long available = static_cast<unsigned long long>(fs.f_bavail) * fs.f_frsize;
+        snapshot.diskUsage = static_cast<float>(total - std::min(available, total)) / total;
+    }
+
+    // Rates from the previous sample
+    if (counters_.valid) {
+        if (current.cpuTotal > counters_.cpuTotal) {
+            double total = static_cast<double>(current.cpuTotal - counters_.cpuTotal);
+            double idle = static_cast<double>(current.cpuIdle - std::min(current.cpuIdle, counters_.cpuIdle));
+            snapshot.cpuUsage = static_cast<float>(std::clamp((total - idle) / total, 0.0, 1.0));
+        }
+
+        double elapsedSec = (current.timestampMs - counters_.timestampMs) / 1000.0;
+        if (elapsedSec > 0.0) {
+            double clockTicks = static_cast<double>(sysconf(_SC_CLK_TCK));
+            double processSec = (current.processTicks - std::min(current.processTicks, counters_.processTicks)) / clockTicks;
+            snapshot.processCpuUsage = static_cast<float>(
+                std::clamp(processSec / (elapsedSec * snapshot.cpuCount), 0.0, 1.0));
+            snapshot.networkRxBytesPerSec =
+                (current.rxBytes - std::min(current.rxBytes, counters_.rxBytes)) / elapsedSec;
+            snapshot.networkTxBytesPerSec =
+                (current.txBytes - std::min(current.txBytes, counters_.txBytes)) / elapsedSec;
+        }
+    }
+    current.valid = true;
+    counters_ = current;
+#endif
+
+    return snapshot;
+}
+
+} // namespace utils
+} // namespace speechrnt
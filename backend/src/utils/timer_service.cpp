@@ -0,0 +1,321 @@
+#include "utils/timer_service.hpp"
+#include "utils/logging.hpp"
+#include <algorithm>
+
+namespace speechrnt {
+namespace utils {
+
+TimerService& TimerService::getInstance() {
+    // Never destroyed: components cancel their timers from their own
+    // destructors, which may run after a function-local static would be gone
+    static TimerService* instance = new TimerService();
+    return *instance;
+}
+
+TimerService::TimerService(std::chrono::milliseconds tick)
+    : tick_(std::max(tick, std::chrono::milliseconds(1)))
+    , epoch_(std::chrono::steady_clock::now())
+    , nextTick_(0)
+    , wakeTick_(NO_EXPIRY)
+    , nextId_(1)
+    , started_(false)
+    , stopping_(false) {
+}
+
+TimerService::~TimerService() {
+    shutdown();
+}
+
+TimerService::TimerId TimerService::schedulePeriodic(const std::string& name, std::chrono::milliseconds interval,
+                                                     Callback callback, bool runImmediately) {
+    interval = std::max(interval, tick_);
+    return addTimer(name, runImmediately ? std::chrono::milliseconds(0) : interval, interval, std::move(callback));
+}
+
+TimerService::TimerId TimerService::scheduleOnce(const std::string& name, std::chrono::milliseconds delay,
+                                                 Callback callback) {
+    return addTimer(name, delay, std::chrono::milliseconds(0), std::move(callback));
+}
+
+TimerService::TimerId TimerService::addTimer(const std::string& name, std::chrono::milliseconds delay,
+                                             std::chrono::milliseconds interval, Callback callback) {
+    if (!callback) {
+        return INVALID_TIMER;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_) {
+        return INVALID_TIMER;
+    }
+    ensureStarted();
+
+    auto timer = std::make_shared<Timer>();
+    timer->id = nextId_++;
+    timer->name = name;
+    timer->callback = std::move(callback);
+    timer->intervalTicks = interval.count() > 0 ? toTicks(interval) : 0;
+
+    if (delay.count() <= 0) {
+        // Due now: skip the wheel entirely
+        timer->expiryTick = currentTick();
+        due_.push_back(timer);
+        workerCondition_.notify_one();
+    } else {
+        // Expire at the first tick boundary at or after now + delay
+        timer->expiryTick = currentTick() + toTicks(delay) + 1;
+        insertTimer(timer);
+    }
+
+    timers_[timer->id] = timer;
+    return timer->id;
+}
+
+bool TimerService::reschedule(TimerId id, std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = timers_.find(id);
+    if (it == timers_.end() || it->second->intervalTicks == 0) {
+        return false;
+    }
+    it->second->intervalTicks = toTicks(std::max(interval, tick_));
+    return true;
+}
+
+bool TimerService::cancel(TimerId id) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = timers_.find(id);
+    if (it == timers_.end()) {
+        return false;
+    }
+
+    TimerPtr timer = it->second;
+    timers_.erase(it);
+    timer->active = false;
+    timer->armed = false;
+
+    if (std::this_thread::get_id() != workerThreadId_) {
+        idleCondition_.wait(lock, [&timer] { return !timer->running; });
+    }
+    return true;
+}
+
+void TimerService::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    wheelCondition_.notify_all();
+    workerCondition_.notify_all();
+
+    if (wheelThread_.joinable()) {
+        wheelThread_.join();
+    }
+    if (workerThread_.joinable() && workerThread_.get_id() != std::this_thread::get_id()) {
+        workerThread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& level : wheel_) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    timers_.clear();
+    due_.clear();
+}
+
+size_t TimerService::getTimerCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return timers_.size();
+}
+
+TimerService::Stats TimerService::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats = stats_;
+    stats.activeTimers = timers_.size();
+    return stats;
+}
+
+void TimerService::ensureStarted() {
+    if (started_) {
+        return;
+    }
+    started_ = true;
+    nextTick_ = currentTick();
+    wheelThread_ = std::thread(&TimerService::wheelLoop, this);
+    workerThread_ = std::thread(&TimerService::workerLoop, this);
+    workerThreadId_ = workerThread_.get_id();
+}
+
+void TimerService::insertTimer(const TimerPtr& timer) {
+    timer->expiryTick = std::max(timer->expiryTick, nextTick_);
+    uint64_t delta = timer->expiryTick - nextTick_;
+
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+
+    // Beyond the wheel horizon: park in the furthest top-level slot and
+    // re-file on every cascade until the real expiry comes into range
+    uint64_t horizon = (uint64_t(1) << (SLOT_BITS * WHEEL_LEVELS)) - 1;
+    uint64_t slotTick = std::min(timer->expiryTick, nextTick_ + horizon);
+    size_t slot = static_cast<size_t>((slotTick >> (SLOT_BITS * level)) & SLOT_MASK);
+
+    wheel_[level][slot].push_back(timer);
+    timer->armed = true;
+
+    if (timer->expiryTick < wakeTick_) {
+        wheelCondition_.notify_one();
+    }
+}
+
+void TimerService::cascade(int level, size_t slot) {
+    std::vector<TimerPtr> entries;
+    entries.swap(wheel_[level][slot]);
+    for (auto& timer : entries) {
+        if (timer->active && timer->armed) {
+            insertTimer(timer);
+            stats_.cascades++;
+        }
+    }
+}
+
+void TimerService::advanceTo(uint64_t tick) {
+    bool queued = false;
+
+    while (nextTick_ <= tick) {
+        size_t index = static_cast<size_t>(nextTick_ & SLOT_MASK);
+
+        // Entering a new lap of a level pulls the matching upper slot down
+        if (index == 0) {
+            for (int level = 1; level < WHEEL_LEVELS; ++level) {
+                size_t slot = static_cast<size_t>((nextTick_ >> (SLOT_BITS * level)) & SLOT_MASK);
+                cascade(level, slot);
+                if (slot != 0) {
+                    break;
+                }
+            }
+        }
+
+        std::vector<TimerPtr> entries;
+        entries.swap(wheel_[0][index]);
+        for (auto& timer : entries) {
+            if (!timer->active || !timer->armed) {
+                continue;
+            }
+            if (timer->expiryTick <= nextTick_) {
+                timer->armed = false;
+                due_.push_back(timer);
+                queued = true;
+            } else {
+                insertTimer(timer);
+            }
+        }
+
+        stats_.ticksAdvanced++;
+        nextTick_++;
+    }
+
+    if (queued) {
+        workerCondition_.notify_one();
+    }
+}
+
+uint64_t TimerService::earliestExpiry() const {
+    uint64_t earliest = NO_EXPIRY;
+    for (const auto& entry : timers_) {
+        if (entry.second->armed) {
+            earliest = std::min(earliest, entry.second->expiryTick);
+        }
+    }
+    return earliest;
+}
+
+uint64_t TimerService::currentTick() const {
+    auto elapsed = std::chrono::steady_clock::now() - epoch_;
+    return static_cast<uint64_t>(elapsed / tick_);
+}
+
+uint64_t TimerService::toTicks(std::chrono::milliseconds duration) const {
+    return static_cast<uint64_t>((duration.count() + tick_.count() - 1) / tick_.count());
+}
+
+void TimerService::wheelLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stopping_) {
+        uint64_t now = currentTick();
+        if (now >= nextTick_) {
+            advanceTo(now);
+        }
+
+        // Sleep straight through empty ticks to the next expiry; the
+        // intervening ticks are processed in one catch-up pass on wake
+        wakeTick_ = earliestExpiry();
+        if (wakeTick_ == NO_EXPIRY) {
+            wheelCondition_.wait(lock);
+        } else {
+            wheelCondition_.wait_until(lock, epoch_ + tick_ * wakeTick_);
+        }
+        stats_.wakeups++;
+    }
+}
+
+void TimerService::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        workerCondition_.wait(lock, [this] { return stopping_ || !due_.empty(); });
+        if (stopping_) {
+            break;
+        }
+
+        TimerPtr timer = due_.front();
+        due_.pop_front();
+        if (!timer->active) {
+            continue;
+        }
+
+        timer->running = true;
+        lock.unlock();
+
+        auto start = std::chrono::steady_clock::now();
+        try {
+            timer->callback();
+        } catch (const std::exception& e) {
+            Logger::warn("Timer '" + timer->name + "' failed: " + e.what());
+        } catch (...) {
+            Logger::warn("Timer '" + timer->name + "' failed with unknown error");
+        }
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        lock.lock();
+        timer->running = false;
+        stats_.callbacksRun++;
+        stats_.maxCallbackMs = std::max(stats_.maxCallbackMs, elapsedMs);
+
+        if (timer->active && timer->intervalTicks > 0) {
+            // Fixed rate from the previous expiry; overrun periods are skipped
+            uint64_t now = currentTick();
+            uint64_t next = timer->expiryTick + timer->intervalTicks;
+            if (next <= now) {
+                uint64_t missed = (now - next) / timer->intervalTicks + 1;
+                next += missed * timer->intervalTicks;
+                stats_.missedRuns += missed;
+            }
+            timer->expiryTick = next;
+            insertTimer(timer);
+        } else if (timer->active) {
+            timer->active = false;
+            timers_.erase(timer->id);
+        }
+
+        idleCondition_.notify_all();
+    }
+}
+
+} // namespace utils
+} // namespace speechrnt
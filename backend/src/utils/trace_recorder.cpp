@@ -0,0 +1,339 @@
+#include "utils/trace_recorder.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+namespace speechrnt {
+namespace utils {
+
+namespace {
+
+thread_local TraceContext t_current;
+
+std::chrono::steady_clock::time_point traceEpoch() {
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+void appendInteger(std::string& out, uint64_t value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+// Chrome trace times are microseconds; keep nanosecond precision
+void appendMicros(std::string& out, int64_t ns) {
+    if (ns < 0) {
+        out += '-';
+        ns = -ns;
+    }
+    appendInteger(out, static_cast<uint64_t>(ns / 1000));
+    char fraction[5] = {'.', '0', '0', '0', '\0'};
+    int64_t remainder = ns % 1000;
+    fraction[1] = static_cast<char>('0' + remainder / 100);
+    fraction[2] = static_cast<char>('0' + remainder / 10 % 10);
+    fraction[3] = static_cast<char>('0' + remainder % 10);
+    out += fraction;
+}
+
+void appendJsonString(std::string& out, const char* text) {
+    out += '"';
+    for (const char* c = text; *c; ++c) {
+        unsigned char ch = static_cast<unsigned char>(*c);
+        if (ch == '"' || ch == '\\') {
+            out += '\\';
+            out += *c;
+        } else if (ch < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+            out += escaped;
+        } else {
+            out += *c;
+        }
+    }
+    out += '"';
+}
+
+struct SpanCopy {
+    const char* name;
+    uint64_t trace_id;
+    int64_t start_ns;
+    int64_t end_ns;
+    uint32_t tid;
+};
+
+} // namespace
+
+/**
+ * One thread's ring. Each slot is guarded by a sequence number (odd while
+ * being written) so export can copy slots while the owner overwrites them
+ * and discard the ones it raced with.
+ */
+struct TraceRecorder::ThreadBuffer {
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> trace_id{0};
+        std::atomic<int64_t> start_ns{0};
+        std::atomic<int64_t> end_ns{0};
+    };
+
+    uint32_t tid = 0;
+    std::atomic<uint64_t> written{0};
+    Slot slots[RING_CAPACITY];
+    ThreadBuffer* next = nullptr;
+};
+
+TraceRecorder& TraceRecorder::getInstance() {
+    static TraceRecorder instance;
+    return instance;
+}
+
+TraceRecorder::~TraceRecorder() {
+    ThreadBuffer* buffer = buffers_.load(std::memory_order_acquire);
+    while (buffer) {
+        ThreadBuffer* next = buffer->next;
+        delete buffer;
+        buffer = next;
+    }
+}
+
+void TraceRecorder::enable(uint32_t sample_every) {
+    sample_every_.store(sample_every, std::memory_order_relaxed);
+    traceEpoch();
+    enabled_.store(true, std::memory_order_release);
+}
+
+void TraceRecorder::disable() {
+    enabled_.store(false, std::memory_order_release);
+    triggered_.store(0, std::memory_order_relaxed);
+}
+
+void TraceRecorder::traceNext(uint32_t count) {
+    triggered_.fetch_add(count, std::memory_order_relaxed);
+    traceEpoch();
+    enabled_.store(true, std::memory_order_release);
+}
+
+TraceContext TraceRecorder::beginUtterance(const std::string& session_id, uint32_t utterance_id) {
+    if (!isEnabled()) {
+        return {};
+    }
+
+    bool sampled = false;
+    uint32_t triggered = triggered_.load(std::memory_order_relaxed);
+    while (triggered > 0) {
+        if (triggered_.compare_exchange_weak(triggered, triggered - 1, std::memory_order_relaxed)) {
+            sampled = true;
+            break;
+        }
+    }
+    if (!sampled) {
+        uint32_t every = sample_every_.load(std::memory_order_relaxed);
+        sampled = every > 0 && utterances_seen_.fetch_add(1, std::memory_order_relaxed) % every == 0;
+    }
+    if (!sampled) {
+        return {};
+    }
+
+    TraceContext context;
+    context.trace_id = next_trace_id_.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(labels_mutex_);
+    labels_[context.trace_id] = UtteranceLabel{session_id, utterance_id};
+    if (labels_.size() > MAX_LABELS) {
+        labels_.erase(labels_.begin());
+    }
+    return context;
+}
+
+TraceContext TraceRecorder::current() {
+    return t_current;
+}
+
+void TraceRecorder::setCurrent(const TraceContext& context) {
+    t_current = context;
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::threadBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        buffer = new ThreadBuffer();
+        buffer->tid = next_thread_index_.fetch_add(1, std::memory_order_relaxed);
+        ThreadBuffer* head = buffers_.load(std::memory_order_relaxed);
+        do {
+            buffer->next = head;
+        } while (!buffers_.compare_exchange_weak(head, buffer, std::memory_order_release,
+                                                 std::memory_order_relaxed));
+    }
+    return *buffer;
+}
+
+void TraceRecorder::record(const char* name, const TraceContext& context, int64_t start_ns, int64_t end_ns) {
+    if (!context.sampled()) {
+        return;
+    }
+
+    ThreadBuffer& buffer = threadBuffer();
+    uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    ThreadBuffer::Slot& slot = buffer.slots[index % RING_CAPACITY];
+
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.trace_id.store(context.trace_id, std::memory_order_relaxed);
+    slot.start_ns.store(start_ns, std::memory_order_relaxed);
+    slot.end_ns.store(end_ns, std::memory_order_relaxed);
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    buffer.written.store(index + 1, std::memory_order_release);
+
+    spans_recorded_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TraceRecorder::recordElapsedSlow(const char* name, double elapsed_ms) {
+    TraceContext context = current();
+    if (!context.sampled()) {
+        return;
+    }
+    int64_t end = now();
+    record(name, context, end - static_cast<int64_t>(elapsed_ms * 1e6), end);
+}
+
+int64_t TraceRecorder::now() {
+    return toTraceTime(std::chrono::steady_clock::now());
+}
+
+int64_t TraceRecorder::toTraceTime(std::chrono::steady_clock::time_point time_point) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point - traceEpoch()).count();
+}
+
+void TraceRecorder::exportChromeTrace(std::string& out) const {
+    int64_t cleared_at = cleared_at_ns_.load(std::memory_order_relaxed);
+
+    std::vector<SpanCopy> spans;
+    for (ThreadBuffer* buffer = buffers_.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+        uint64_t written = buffer->written.load(std::memory_order_acquire);
+        uint64_t first = written > RING_CAPACITY ? written - RING_CAPACITY : 0;
+        for (uint64_t index = first; index < written; ++index) {
+            const ThreadBuffer::Slot& slot = buffer->slots[index % RING_CAPACITY];
+            uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            SpanCopy span{slot.name.load(std::memory_order_relaxed),
+                          slot.trace_id.load(std::memory_order_relaxed),
+                          slot.start_ns.load(std::memory_order_relaxed),
+                          slot.end_ns.load(std::memory_order_relaxed),
+                          buffer->tid};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+            // Overwritten while we read it, or already reused for a newer span
+            if (before != after || before != 2 * index + 2 || span.end_ns < cleared_at) {
+                continue;
+            }
+            spans.push_back(span);
+        }
+    }
+    std::sort(spans.begin(), spans.end(), [](const SpanCopy& a, const SpanCopy& b) {
+        return a.start_ns < b.start_ns;
+    });
+
+    std::map<uint64_t, UtteranceLabel> labels;
+    {
+        std::lock_guard<std::mutex> lock(labels_mutex_);
+        labels = labels_;
+    }
+
+    out.clear();
+    out.reserve(spans.size() * 160 + 256);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"speechrnt\"}}";
+
+    auto appendArgs = [&](uint64_t trace_id) {
+        out += ",\"args\":{\"trace_id\":";
+        appendInteger(out, trace_id);
+        auto label = labels.find(trace_id);
+        if (label != labels.end()) {
+            out += ",\"session\":";
+            appendJsonString(out, label->second.session_id.c_str());
+            out += ",\"utterance\":";
+            appendInteger(out, label->second.utterance_id);
+        }
+        out += '}';
+    };
+
+    // Extent of each utterance across all threads
+    std::unordered_map<uint64_t, std::pair<int64_t, int64_t>> extents;
+    for (const SpanCopy& span : spans) {
+        auto inserted = extents.emplace(span.trace_id, std::make_pair(span.start_ns, span.end_ns));
+        if (!inserted.second) {
+            inserted.first->second.first = std::min(inserted.first->second.first, span.start_ns);
+            inserted.first->second.second = std::max(inserted.first->second.second, span.end_ns);
+        }
+
+        out += ",{\"name\":";
+        appendJsonString(out, span.name ? span.name : "");
+        out += ",\"cat\":\"pipeline\",\"ph\":\"X\",\"ts\":";
+        appendMicros(out, span.start_ns);
+        out += ",\"dur\":";
+        appendMicros(out, span.end_ns - span.start_ns);
+        out += ",\"pid\":1,\"tid\":";
+        appendInteger(out, span.tid);
+        appendArgs(span.trace_id);
+        out += '}';
+    }
+
+    std::vector<std::pair<uint64_t, std::pair<int64_t, int64_t>>> utterances(extents.begin(), extents.end());
+    std::sort(utterances.begin(), utterances.end());
+    for (const auto& utterance : utterances) {
+        std::string name = "utterance";
+        auto label = labels.find(utterance.first);
+        if (label != labels.end()) {
+            name += ' ';
+            name += std::to_string(label->second.utterance_id);
+        }
+        for (const char* phase : {"b", "e"}) {
+            out += ",{\"name\":";
+            appendJsonString(out, name.c_str());
+            out += ",\"cat\":\"utterance\",\"ph\":\"";
+            out += phase;
+            out += "\",\"id\":";
+            appendInteger(out, utterance.first);
+            out += ",\"ts\":";
+            appendMicros(out, phase[0] == 'b' ? utterance.second.first : utterance.second.second);
+            out += ",\"pid\":1,\"tid\":0";
+            if (phase[0] == 'b') {
+                appendArgs(utterance.first);
+            }
+            out += '}';
+        }
+    }
+    out += "]}\n";
+}
+
+std::string TraceRecorder::exportChromeTrace() const {
+    std::string out;
+    exportChromeTrace(out);
+    return out;
+}
+
+bool TraceRecorder::dumpChromeTrace(const std::string& path) const {
+    std::string trace;
+    exportChromeTrace(trace);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(trace.data(), static_cast<std::streamsize>(trace.size()));
+    return static_cast<bool>(file);
+}
+
+void TraceRecorder::clear() {
+    cleared_at_ns_.store(now(), std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(labels_mutex_);
+    labels_.clear();
+}
+
+} // namespace utils
+} // namespace speechrnt
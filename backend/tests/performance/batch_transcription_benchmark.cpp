@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "stt/advanced/batch_processing_manager.hpp"
+#include "stt/whisper_state_pool.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <thread>
+
+using namespace stt;
+using namespace stt::advanced;
+
+namespace {
+
+// Burns one core for a fixed fraction of the audio duration, standing in for a
+// decoder with a known real-time factor
+class SimulatedTranscriber : public SegmentTranscriber {
+public:
+    SimulatedTranscriber(size_t slots, double realtimeFactor) : slots_(slots), realtimeFactor_(realtimeFactor) {}
+
+    size_t getSlotCount() const override { return slots_; }
+
+    bool transcribeSegment(size_t, const std::vector<float>& audio, const std::string&, bool,
+                           std::vector<TranscriptionResult>& results) override {
+        double audioSeconds = audio.size() / 16000.0;
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(audioSeconds * realtimeFactor_));
+        volatile float sink = 0.0f;
+        while (std::chrono::steady_clock::now() < deadline) {
+            for (size_t i = 0; i < audio.size(); i += 64) {
+                sink = sink + audio[i];
+            }
+        }
+
+        TranscriptionResult result;
+        result.text = "segment";
+        result.end_time_ms = static_cast<int64_t>(audioSeconds * 1000.0);
+        result.confidence = 0.9f;
+        results.push_back(result);
+        return true;
+    }
+
+private:
+    size_t slots_;
+    double realtimeFactor_;
+};
+
+} // namespace
+
+class BatchTranscriptionBenchmark : public ::testing::Test {
+protected:
+    static constexpr int SAMPLE_RATE = 16000;
+    static constexpr int AUDIO_SECONDS = 600;
+
+    void SetUp() override {
+        dir_ = std::filesystem::temp_directory_path() / "batch_transcription_benchmark";
+        std::filesystem::remove_all(dir_);
+        std::filesystem::create_directories(dir_);
+        inputPath_ = (dir_ / "lecture.wav").string();
+        writeSpeechLikeWav(inputPath_, AUDIO_SECONDS);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir_);
+    }
+
+    // Four-second phrases separated by 800 ms pauses
+    static void writeSpeechLikeWav(const std::string& path, int seconds) {
+        std::mt19937 gen(42);
+        std::normal_distribution<float> noise(0.0f, 0.01f);
+
+        size_t frames = static_cast<size_t>(SAMPLE_RATE) * seconds;
+        std::vector<int16_t> pcm(frames);
+        double phase = 0.0;
+        for (size_t i = 0; i < frames; ++i) {
+            double t = static_cast<double>(i) / SAMPLE_RATE;
+            bool speaking = std::fmod(t, 4.8) < 4.0;
+            phase += 2.0 * M_PI * (140.0 + 30.0 * std::sin(2.0 * M_PI * 0.7 * t)) / SAMPLE_RATE;
+            float sample = speaking ? static_cast<float>(0.3 * std::sin(phase) + 0.1 * std::sin(3 * phase)) : 0.0f;
+            sample += speaking ? noise(gen) : noise(gen) * 0.05f;
+            pcm[i] = static_cast<int16_t>(std::max(-1.0f, std::min(1.0f, sample)) * 32767.0f);
+        }
+
+        std::ofstream out(path, std::ios::binary);
+        auto write32 = [&](uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); };
+        auto write16 = [&](uint16_t v) { out.write(reinterpret_cast<const char*>(&v), 2); };
+        uint32_t dataBytes = static_cast<uint32_t>(frames * 2);
+        out.write("RIFF", 4);
+        write32(36 + dataBytes);
+        out.write("WAVEfmt ", 8);
+        write32(16);
+        write16(1);
+        write16(1);
+        write32(SAMPLE_RATE);
+        write32(SAMPLE_RATE * 2);
+        write16(2);
+        write16(16);
+        out.write("data", 4);
+        write32(dataBytes);
+        out.write(reinterpret_cast<const char*>(pcm.data()), dataBytes);
+    }
+
+    // Runs one job and returns audio-hours per wall-clock hour per core
+    double runJob(std::shared_ptr<SegmentTranscriber> transcriber, const std::string& label) {
+        BatchProcessingManager manager(transcriber);
+        BatchProcessingConfig config;
+        config.maxConcurrentJobs = 1;
+        config.setStringParameter("outputDirectory", (dir_ / ("out_" + label)).string());
+        EXPECT_TRUE(manager.initialize(config));
+
+        BatchJobRequest request;
+        request.jobName = label;
+        request.inputFiles = {inputPath_};
+        request.config.outputFormat = "srt";
+
+        auto start = std::chrono::steady_clock::now();
+        uint32_t jobId = manager.submitBatchJob(request);
+        EXPECT_TRUE(manager.waitForJob(jobId, std::chrono::minutes(10)));
+        double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        BatchJobResult result = manager.getJobResult(jobId);
+        EXPECT_EQ(result.finalStatus, BatchJobStatus::COMPLETED);
+
+        double cores = static_cast<double>(transcriber->getSlotCount() * transcriber->getThreadsPerSlot());
+        double perCore = (AUDIO_SECONDS / wallSeconds) / cores;
+        std::cout << label << ": " << AUDIO_SECONDS << " s of audio in " << wallSeconds << " s wall, "
+                  << AUDIO_SECONDS / wallSeconds << "x real time, " << perCore
+                  << " audio-hours per wall-hour per core (" << cores << " cores)" << std::endl;
+        return perCore;
+    }
+
+    std::filesystem::path dir_;
+    std::string inputPath_;
+};
+
+TEST_F(BatchTranscriptionBenchmark, ReadAndSegmentThroughput) {
+    auto start = std::chrono::steady_clock::now();
+    MappedAudioFile file;
+    ASSERT_TRUE(file.open(inputPath_));
+    auto segments = VadSegmenter().segment(file);
+
+    std::vector<float> audio;
+    size_t samples = 0;
+    for (const auto& segment : segments) {
+        file.readMonoResampled(segment.startFrame, segment.endFrame - segment.startFrame, SAMPLE_RATE, audio);
+        samples += audio.size();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Mapped read + VAD: " << segments.size() << " segments covering " << samples / double(SAMPLE_RATE)
+              << " s in " << seconds * 1000.0 << " ms (" << AUDIO_SECONDS / seconds << "x real time)"
+              << std::endl;
+
+    // Phrases are 4 s long with 800 ms pauses, so every pause is a boundary
+    EXPECT_NEAR(static_cast<double>(segments.size()), AUDIO_SECONDS / 4.8, 2.0);
+    // Front end overhead must stay negligible next to any decoder
+    EXPECT_GT(AUDIO_SECONDS / seconds, 200.0);
+}
+
+TEST_F(BatchTranscriptionBenchmark, ScalesAcrossDecoderSlots) {
+    const double realtimeFactor = 0.02;
+    size_t maxSlots = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+
+    double singleSlot = runJob(std::make_shared<SimulatedTranscriber>(1, realtimeFactor), "slots_1");
+    double ideal = 1.0 / realtimeFactor;
+    EXPECT_GT(singleSlot, ideal * 0.8);
+
+    for (size_t slots = 2; slots <= maxSlots; slots *= 2) {
+        double perCore = runJob(std::make_shared<SimulatedTranscriber>(slots, realtimeFactor),
+                                "slots_" + std::to_string(slots));
+        // Per-core throughput should hold as decoder slots are added
+        EXPECT_GT(perCore, singleSlot * 0.7);
+    }
+}
+
+TEST_F(BatchTranscriptionBenchmark, WhisperStatePoolThroughput) {
+    const char* modelPath = std::getenv("SPEECHRNT_WHISPER_MODEL");
+    if (!modelPath) {
+        GTEST_SKIP() << "Set SPEECHRNT_WHISPER_MODEL to benchmark a real model";
+    }
+
+    size_t slots = std::max(1u, std::thread::hardware_concurrency() / 2);
+    auto pool = std::make_shared<WhisperStatePool>();
+    if (!pool->initialize(modelPath, slots, 2)) {
+        GTEST_SKIP() << pool->getLastError();
+    }
+
+    runJob(std::make_shared<WhisperSegmentTranscriber>(pool), "whisper_" + std::to_string(slots) + "x2");
+}
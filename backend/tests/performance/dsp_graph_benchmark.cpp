@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "audio/audio_preprocessor.hpp"
+#include "audio/dsp_graph.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+
+// Counts heap allocations made by this process while counting is switched on
+namespace {
+std::atomic<bool> countAllocations{false};
+std::atomic<size_t> allocationCount{0};
+}
+
+void* operator new(size_t size) {
+    if (countAllocations.load(std::memory_order_relaxed)) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+using namespace audio;
+
+class DspGraphBenchmark : public ::testing::Test {
+protected:
+    static constexpr int SAMPLE_RATE = 16000;
+    static constexpr size_t FRAME = 320; // 20 ms
+    static constexpr size_t FRAMES = 500;
+
+    void SetUp() override {
+        std::mt19937 gen(42);
+        std::normal_distribution<float> noise(0.0f, 0.01f);
+        signal_.resize(FRAME * FRAMES);
+        for (size_t i = 0; i < signal_.size(); ++i) {
+            double t = static_cast<double>(i) / SAMPLE_RATE;
+            signal_[i] = static_cast<float>(0.2 * std::sin(2.0 * M_PI * 150.0 * t) *
+                                            (0.5 + 0.5 * std::sin(2.0 * M_PI * 3.0 * t))) + noise(gen);
+        }
+    }
+
+    struct Measurement {
+        double nsPerFrame;
+        double allocationsPerFrame;
+    };
+
+    template <typename Fn>
+    Measurement measure(Fn&& perFrame) {
+        // Warm-up pass lets lazily sized state settle before counting
+        for (size_t f = 0; f < 10; ++f) perFrame(f);
+
+        allocationCount = 0;
+        countAllocations = true;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t f = 0; f < FRAMES; ++f) perFrame(f);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        countAllocations = false;
+
+        return {std::chrono::duration<double, std::nano>(elapsed).count() / FRAMES,
+                static_cast<double>(allocationCount.load()) / FRAMES};
+    }
+
+    std::vector<float> signal_;
+};
+
+TEST_F(DspGraphBenchmark, VectorChainBaseline) {
+    // The per-stage vector APIs the preprocessor used to chain together
+    NoiseReductionFilter noise(SAMPLE_RATE);
+    VolumeNormalizer volume(SAMPLE_RATE);
+
+    std::vector<float> output;
+    auto result = measure([&](size_t f) {
+        std::vector<float> frame(signal_.begin() + f * FRAME, signal_.begin() + (f + 1) * FRAME);
+        auto gated = noise.processNoiseGate(frame);
+        auto gained = volume.processAGC(gated);
+        output = volume.processCompression(gained);
+    });
+
+    std::cout << "Vector chain (gate + AGC + compressor): " << result.nsPerFrame << " ns/frame, "
+              << result.allocationsPerFrame << " allocations/frame" << std::endl;
+    EXPECT_GE(result.allocationsPerFrame, 3.0);
+}
+
+TEST_F(DspGraphBenchmark, PreprocessorInPlaceHasZeroAllocations) {
+    AudioPreprocessingConfig config;
+    config.enableAdaptiveProcessing = false;
+    config.enableQualityAnalysis = false;
+    config.enableEchoCancellation = true;
+    AudioPreprocessor preprocessor(config, SAMPLE_RATE);
+    preprocessor.initializeRealTimeProcessing(FRAME);
+
+    std::vector<float> frame(FRAME);
+    auto result = measure([&](size_t f) {
+        std::copy(signal_.begin() + (f % FRAMES) * FRAME, signal_.begin() + (f % FRAMES + 1) * FRAME,
+                  frame.begin());
+        preprocessor.preprocessRealTimeChunkInPlace(frame);
+    });
+
+    std::cout << "AudioPreprocessor in place (spectral subtraction + dynamics + LMS): "
+              << result.nsPerFrame << " ns/frame (" << result.nsPerFrame / 20e6 * 100.0
+              << "% of real time), " << result.allocationsPerFrame << " allocations/frame" << std::endl;
+    EXPECT_EQ(result.allocationsPerFrame, 0.0);
+}
+
+TEST_F(DspGraphBenchmark, FusedDynamicsVersusChainedNodes) {
+    FusedDynamicsNode::Config config;
+    config.enableDeEsser = true;
+    config.enableLimiter = true;
+
+    DspGraph chained;
+    chained.addNode(std::make_unique<AutomaticGainNode>(config.targetRMS));
+    chained.addNode(std::make_unique<CompressorNode>(config.compressionRatio, config.compressionThreshold,
+                                                     config.attackSeconds, config.releaseSeconds));
+    chained.addNode(std::make_unique<DeEsserNode>());
+    chained.addNode(std::make_unique<LimiterNode>(config.limiterThreshold));
+    chained.prepare(SAMPLE_RATE, FRAME);
+
+    DspGraph fused;
+    fused.addNode(std::make_unique<FusedDynamicsNode>(config));
+    fused.prepare(SAMPLE_RATE, FRAME);
+
+    std::vector<float> frame(FRAME);
+    auto runGraph = [&](DspGraph& graph) {
+        return measure([&](size_t f) {
+            std::copy(signal_.begin() + (f % FRAMES) * FRAME, signal_.begin() + (f % FRAMES + 1) * FRAME,
+                      frame.begin());
+            graph.process(frame);
+        });
+    };
+
+    auto chainedResult = runGraph(chained);
+    auto fusedResult = runGraph(fused);
+
+    std::cout << "Dynamics chained: " << chainedResult.nsPerFrame << " ns/frame, fused: "
+              << fusedResult.nsPerFrame << " ns/frame" << std::endl;
+    EXPECT_EQ(chainedResult.allocationsPerFrame, 0.0);
+    EXPECT_EQ(fusedResult.allocationsPerFrame, 0.0);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "utils/metrics_registry.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace speechrnt::utils;
+
+class MetricsExpositionBenchmark : public ::testing::Test {
+protected:
+    static constexpr int SCRAPES = 200;
+
+    void SetUp() override {
+        // Roughly the series a busy server registers
+        const char* stages[] = {"vad", "preprocessing", "inference", "postprocessing", "streaming"};
+        for (const char* stage : stages) {
+            histograms_.push_back(&registry_.histogram("speechrnt_stt_stage_duration_seconds", "STT stages",
+                                                       MetricsRegistry::latencyBuckets(), {{"stage", stage}}));
+        }
+        for (int model = 0; model < 20; ++model) {
+            histograms_.push_back(&registry_.histogram(
+                "speechrnt_model_duration_seconds", "Per model", MetricsRegistry::latencyBuckets(),
+                {{"component", "mt"}, {"model", "pair" + std::to_string(model)}, {"device", "cpu"}}));
+        }
+        for (int queue = 0; queue < 5; ++queue) {
+            registry_.gauge("speechrnt_queue_depth", "Queues", {{"queue", std::to_string(queue)}}).set(queue);
+            registry_.counter("speechrnt_cache_requests", "Caches", {{"cache", std::to_string(queue)}}).inc();
+        }
+    }
+
+    double medianScrapeUs() {
+        std::vector<double> samples;
+        std::string out;
+        for (int i = 0; i < SCRAPES; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            registry_.exposeOpenMetrics(out);
+            samples.push_back(std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    MetricsRegistry registry_;
+    std::vector<Histogram*> histograms_;
+};
+
+TEST_F(MetricsExpositionBenchmark, ScrapeCostIndependentOfTraffic) {
+    double idle = medianScrapeUs();
+
+    for (int i = 0; i < 2000000; ++i) {
+        histograms_[i % histograms_.size()]->observe((i % 1000) * 0.0001);
+    }
+    double busy = medianScrapeUs();
+
+    std::cout << "Scrape of " << histograms_.size() << " histograms: idle " << idle << " us, after 2M observations "
+              << busy << " us" << std::endl;
+    EXPECT_LT(busy, idle * 2.0 + 20.0);
+}
+
+TEST_F(MetricsExpositionBenchmark, ObserveCostUnderConcurrentScrapes) {
+    constexpr int OBSERVATIONS = 1000000;
+    Histogram& histogram = *histograms_[2];
+
+    auto measure = [&] {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < OBSERVATIONS; ++i) {
+            histogram.observe((i % 1000) * 0.0001);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+               OBSERVATIONS;
+    };
+
+    double quiet = measure();
+    std::atomic<bool> done{false};
+    std::thread scraper([&] {
+        std::string out;
+        while (!done.load(std::memory_order_relaxed)) {
+            registry_.exposeOpenMetrics(out);
+        }
+    });
+    double scraped = measure();
+    done = true;
+    scraper.join();
+
+    std::cout << "observe(): " << quiet << " ns alone, " << scraped << " ns during continuous scrapes"
+              << std::endl;
+    EXPECT_LT(scraped, 1000.0);
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include "audio/opus_codec.hpp"
+#include "core/audio_frame_envelope.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace audio;
+
+class OpusCodecBenchmark : public ::testing::Test {
+protected:
+    void SetUp() override {
+        speech16k_ = generateSpeechLikeSignal(16000, 10);
+        speech22k_ = generateSpeechLikeSignal(22050, 10);
+    }
+
+    // Harmonic series with a wandering pitch plus noise, gated into syllables
+    static std::vector<float> generateSpeechLikeSignal(int sampleRate, int seconds) {
+        std::mt19937 gen(42);
+        std::normal_distribution<float> noise(0.0f, 0.02f);
+
+        std::vector<float> signal(static_cast<size_t>(sampleRate) * seconds);
+        double phase = 0.0;
+        for (size_t i = 0; i < signal.size(); ++i) {
+            double t = static_cast<double>(i) / sampleRate;
+            double pitch = 140.0 + 30.0 * std::sin(2.0 * M_PI * 0.7 * t);
+            phase += 2.0 * M_PI * pitch / sampleRate;
+            double voiced = 0.0;
+            for (int h = 1; h <= 6; ++h) {
+                voiced += std::sin(h * phase) / h;
+            }
+            double envelope = 0.5 + 0.5 * std::sin(2.0 * M_PI * 4.0 * t);
+            signal[i] = static_cast<float>(0.25 * voiced * envelope) + noise(gen);
+        }
+        return signal;
+    }
+
+    static double seconds(std::chrono::steady_clock::duration d) {
+        return std::chrono::duration<double>(d).count();
+    }
+
+    std::vector<float> speech16k_;
+    std::vector<float> speech22k_;
+};
+
+TEST_F(OpusCodecBenchmark, PcmEnvelopeBaseline) {
+    // 20 ms PCM16 frames at 16 kHz, as legacy clients stream today
+    const size_t frameSamples = 320;
+    std::string payload(frameSamples * sizeof(int16_t), '\0');
+
+    core::AudioFrameHeader header;
+    size_t totalBytes = 0;
+    size_t frames = speech16k_.size() / frameSamples;
+    for (size_t i = 0; i < frames; ++i) {
+        header.sequenceNumber = static_cast<uint32_t>(i);
+        totalBytes += core::AudioFrameEnvelope::serialize(header, payload).size();
+    }
+
+    double kbps = totalBytes * 8.0 / 10.0 / 1000.0;
+    std::cout << "PCM16 @16kHz enveloped: " << kbps << " kbps per stream" << std::endl;
+    EXPECT_NEAR(kbps, 256.0 + 24 * 8 * 50 / 1000.0, 1.0);
+}
+
+TEST_F(OpusCodecBenchmark, IngestCostAndBandwidthPerStream) {
+    if (!OpusStreamDecoder::isAvailable()) {
+        GTEST_SKIP() << "Built without Opus support";
+    }
+
+    OpusCodecConfig config;
+    config.sampleRate = 16000;
+    config.bitrate = 24000;
+    config.frameDurationMs = 20;
+
+    OpusStreamEncoder encoder;
+    ASSERT_TRUE(encoder.initialize(config));
+    std::vector<std::vector<uint8_t>> packets;
+    encoder.encode(speech16k_, 16000, packets);
+    encoder.flush(packets);
+    ASSERT_FALSE(packets.empty());
+
+    size_t compressedBytes = 0;
+    for (const auto& packet : packets) {
+        compressedBytes += packet.size() + core::AudioFrameEnvelope::HEADER_SIZE;
+    }
+
+    OpusStreamDecoder decoder;
+    ASSERT_TRUE(decoder.initialize(16000, 1));
+    std::vector<float> decoded;
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& packet : packets) {
+        ASSERT_TRUE(decoder.decode(
+            std::string_view(reinterpret_cast<const char*>(packet.data()), packet.size()), decoded));
+    }
+    double decodeSeconds = seconds(std::chrono::steady_clock::now() - start);
+
+    double kbps = compressedBytes * 8.0 / 10.0 / 1000.0;
+    double cpuPerStream = decodeSeconds / 10.0;
+    std::cout << "Opus ingest @24kbps: " << kbps << " kbps per stream (PCM16: 256 kbps), "
+              << cpuPerStream * 100.0 << "% of one core per stream, ~"
+              << static_cast<int>(1.0 / cpuPerStream) << " streams per core" << std::endl;
+
+    EXPECT_LT(kbps, 40.0);
+    EXPECT_LT(cpuPerStream, 0.05);
+}
+
+TEST_F(OpusCodecBenchmark, TtsEgressCostAndBandwidth) {
+    if (!OpusStreamDecoder::isAvailable()) {
+        GTEST_SKIP() << "Built without Opus support";
+    }
+
+    OpusCodecConfig config;
+    config.sampleRate = OpusStreamEncoder::nearestSupportedSampleRate(22050);
+    config.bitrate = 32000;
+    config.frameDurationMs = 20;
+
+    OpusStreamEncoder encoder;
+    ASSERT_TRUE(encoder.initialize(config));
+
+    // Feed TTS output in 100 ms blocks, as a streaming synthesizer would
+    std::vector<std::vector<uint8_t>> packets;
+    const size_t block = 2205;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t offset = 0; offset < speech22k_.size(); offset += block) {
+        size_t end = std::min(offset + block, speech22k_.size());
+        std::vector<float> chunk(speech22k_.begin() + offset, speech22k_.begin() + end);
+        encoder.encode(chunk, 22050, packets);
+    }
+    encoder.flush(packets);
+    double encodeSeconds = seconds(std::chrono::steady_clock::now() - start);
+
+    size_t compressedBytes = 0;
+    for (const auto& packet : packets) {
+        compressedBytes += packet.size() + core::AudioFrameEnvelope::HEADER_SIZE;
+    }
+
+    double kbps = compressedBytes * 8.0 / 10.0 / 1000.0;
+    double pcmKbps = 22050 * 16 / 1000.0;
+    double cpuPerStream = encodeSeconds / 10.0;
+    std::cout << "Opus TTS egress @32kbps: " << kbps << " kbps per stream (PCM16 WAV: " << pcmKbps
+              << " kbps), " << cpuPerStream * 100.0 << "% of one core per stream" << std::endl;
+
+    // 10 s at 20 ms frames, resampled to 24 kHz
+    EXPECT_NEAR(static_cast<double>(packets.size()), 500.0, 2.0);
+    EXPECT_LT(kbps, pcmKbps / 5.0);
+    EXPECT_LT(cpuPerStream, 0.1);
+}
+
+TEST_F(OpusCodecBenchmark, ConcurrentDecodeStreams) {
+    if (!OpusStreamDecoder::isAvailable()) {
+        GTEST_SKIP() << "Built without Opus support";
+    }
+
+    OpusCodecConfig config;
+    OpusStreamEncoder encoder;
+    ASSERT_TRUE(encoder.initialize(config));
+    std::vector<std::vector<uint8_t>> packets;
+    encoder.encode(speech16k_, 16000, packets);
+    encoder.flush(packets);
+
+    const int streams = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+    std::atomic<size_t> framesDecoded{0};
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int s = 0; s < streams; ++s) {
+        threads.emplace_back([&]() {
+            OpusStreamDecoder decoder;
+            if (!decoder.initialize(16000, 1)) {
+                return;
+            }
+            std::vector<float> decoded;
+            for (const auto& packet : packets) {
+                if (decoder.decode(std::string_view(reinterpret_cast<const char*>(packet.data()),
+                                                    packet.size()),
+                                   decoded)) {
+                    framesDecoded++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double elapsed = seconds(std::chrono::steady_clock::now() - start);
+
+    double audioSeconds = framesDecoded.load() * config.frameDurationMs / 1000.0;
+    std::cout << streams << " concurrent streams decoded " << audioSeconds
+              << " s of audio in " << elapsed << " s (" << audioSeconds / elapsed
+              << "x real time aggregate)" << std::endl;
+
+    EXPECT_EQ(framesDecoded.load(), packets.size() * streams);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "mt/quality_manager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace speechrnt::mt;
+
+class QualityAssessmentBenchmark : public ::testing::Test {
+protected:
+    static constexpr size_t ITERATIONS = 2000;
+    // A short sentence through a small Marian model or on GPU; assessment
+    // must stay under 1% of it
+    static constexpr double MT_LATENCY_US = 5000.0;
+
+    void SetUp() override {
+        manager_.initialize();
+        pairs_ = {
+            {"Hello, how are you today?", "Hola, ¿cómo estás hoy?"},
+            {"The meeting has been moved to Thursday afternoon; please update your calendar.",
+             "La reunión se ha trasladado al jueves por la tarde; por favor, actualice su calendario."},
+            {"I can't find the report that you sent me yesterday, could you send it again?",
+             "Je ne trouve pas le rapport que vous m'avez envoyé hier, pourriez-vous le renvoyer ?"},
+            {"We will review the results and get back to you by the end of the week.",
+             "Мы рассмотрим результаты и свяжемся с вами до конца недели."},
+            {"Thank you very much for your help.", "Vielen Dank für Ihre Hilfe."},
+        };
+    }
+
+    QualityManager manager_;
+    std::vector<std::pair<std::string, std::string>> pairs_;
+};
+
+TEST_F(QualityAssessmentBenchmark, AssessmentCostPerTranslation) {
+    std::vector<double> samples;
+    samples.reserve(ITERATIONS);
+    float sink = 0.0f;
+
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+        const auto& pair = pairs_[i % pairs_.size()];
+        auto start = std::chrono::steady_clock::now();
+        auto metrics = manager_.assessTranslationQuality(pair.first, pair.second, "en", "es");
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        sink += metrics.overallConfidence;
+        samples.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    double median = samples[samples.size() / 2];
+    double p99 = samples[samples.size() * 99 / 100];
+    std::cout << "Quality assessment: median " << median << " us, p99 " << p99 << " us ("
+              << 100.0 * median / MT_LATENCY_US << "% of a " << MT_LATENCY_US / 1000.0
+              << " ms translation)" << std::endl;
+
+    EXPECT_GT(sink, 0.0f);
+    EXPECT_LT(median, MT_LATENCY_US * 0.01);
+}
+
+TEST_F(QualityAssessmentBenchmark, CandidateGenerationCost) {
+    const auto& pair = pairs_[1];
+    auto start = std::chrono::steady_clock::now();
+    size_t candidates = 0;
+    for (size_t i = 0; i < ITERATIONS / 10; ++i) {
+        candidates += manager_.generateTranslationCandidates(pair.first, pair.second, "en", "es", 3).size();
+    }
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+                (ITERATIONS / 10);
+    std::cout << "Candidate generation: " << us << " us per call" << std::endl;
+    EXPECT_GT(candidates, 0u);
+}
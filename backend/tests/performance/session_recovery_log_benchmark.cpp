@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "core/session_recovery.hpp"
+#include "core/session_recovery_log.hpp"
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace core;
+
+class SessionRecoveryLogBenchmark : public ::testing::Test {
+protected:
+    static constexpr size_t SESSION_COUNT = 50000;
+    static constexpr size_t ACTIVITY_PER_SESSION = 5;
+    // Records between group commits, about a 100 ms window at a busy server
+    static constexpr size_t RECORDS_PER_SYNC = 4096;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "speechrnt_session_recovery_benchmark";
+        std::filesystem::remove_all(testDir);
+        basePath = (testDir / "sessions.db").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(testDir);
+    }
+
+    static SessionRecoveryData makeSession(size_t index) {
+        SessionRecoveryData data;
+        data.session_id = "session_" + std::to_string(index);
+        data.client_id = "client_" + std::to_string(index);
+        data.created_at = std::chrono::steady_clock::now();
+        data.last_activity = data.created_at;
+        data.source_lang = "en";
+        data.target_lang = "es";
+        data.voice_id = "female_voice_1";
+        data.is_active = true;
+        data.pending_utterances = {1, 2};
+        data.last_known_state = "listening";
+        data.custom_data["region"] = "eu-west";
+        return data;
+    }
+
+    static double secondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Populate the log the way a server would and return the live sessions
+    SessionRecoveryMap writeWorkload(SessionRecoveryLog& log, double& seconds) {
+        SessionRecoveryMap sessions;
+        sessions.reserve(SESSION_COUNT);
+        size_t records = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < SESSION_COUNT; ++i) {
+            auto data = std::make_shared<SessionRecoveryData>(makeSession(i));
+            log.recordStore(*data);
+            sessions[data->session_id] = data;
+            if (++records % RECORDS_PER_SYNC == 0) {
+                log.sync();
+            }
+        }
+        for (size_t round = 0; round < ACTIVITY_PER_SESSION; ++round) {
+            for (auto& pair : sessions) {
+                pair.second->last_activity = std::chrono::steady_clock::now();
+                log.recordActivity(pair.first, pair.second->last_activity);
+                if (++records % RECORDS_PER_SYNC == 0) {
+                    log.sync();
+                }
+            }
+        }
+        log.sync();
+        seconds = secondsSince(start);
+        return sessions;
+    }
+
+    std::filesystem::path testDir;
+    std::string basePath;
+};
+
+TEST_F(SessionRecoveryLogBenchmark, AppendThroughput) {
+    SessionRecoveryLog log(basePath);
+    SessionRecoveryMap recovered;
+    ASSERT_TRUE(log.open(recovered));
+
+    double seconds = 0.0;
+    auto sessions = writeWorkload(log, seconds);
+    auto stats = log.getStatistics();
+    double records = static_cast<double>(stats.records_appended);
+    std::cout << "WAL append: " << records / seconds << " records/s, "
+              << stats.syncs << " syncs, " << stats.wal_bytes / (1024.0 * 1024.0) << " MiB" << std::endl;
+
+    // What every change used to cost: rewriting the whole store
+    std::string snapshot;
+    auto start = std::chrono::steady_clock::now();
+    SessionRecoveryLog::encodeSnapshot(sessions, log.rotate(), snapshot);
+    double encodeSeconds = secondsSince(start);
+    ASSERT_TRUE(log.installSnapshot(snapshot, log.getStatistics().generation));
+    double fullSeconds = secondsSince(start);
+    std::cout << "Full snapshot of " << SESSION_COUNT << " sessions: " << fullSeconds * 1000.0
+              << " ms (" << encodeSeconds * 1000.0 << " ms encoding under the lock), "
+              << snapshot.size() / (1024.0 * 1024.0) << " MiB" << std::endl;
+
+    EXPECT_EQ(stats.records_appended, SESSION_COUNT * (1 + ACTIVITY_PER_SESSION));
+    EXPECT_GT(records / seconds, 100000.0);
+}
+
+TEST_F(SessionRecoveryLogBenchmark, RecoveryTime) {
+    double seconds = 0.0;
+    {
+        SessionRecoveryLog log(basePath);
+        SessionRecoveryMap recovered;
+        ASSERT_TRUE(log.open(recovered));
+        writeWorkload(log, seconds);
+    }
+
+    // Log replay only
+    {
+        SessionRecoveryLog log(basePath);
+        SessionRecoveryMap recovered;
+        ASSERT_TRUE(log.open(recovered));
+        auto stats = log.getStatistics();
+        std::cout << "Replay of " << stats.records_replayed << " records: "
+                  << stats.recovery_time.count() / 1000.0 << " ms" << std::endl;
+        EXPECT_EQ(recovered.size(), SESSION_COUNT);
+
+        uint64_t generation = log.rotate();
+        std::string snapshot;
+        SessionRecoveryLog::encodeSnapshot(recovered, generation, snapshot);
+        ASSERT_TRUE(log.installSnapshot(snapshot, generation));
+        for (auto& pair : recovered) {
+            log.recordActivity(pair.first, std::chrono::steady_clock::now());
+        }
+    }
+
+    // Snapshot plus one activity round in the log
+    SessionRecoveryLog log(basePath);
+    SessionRecoveryMap recovered;
+    ASSERT_TRUE(log.open(recovered));
+    auto stats = log.getStatistics();
+    std::cout << "Snapshot + replay of " << stats.records_replayed << " records: "
+              << stats.recovery_time.count() / 1000.0 << " ms" << std::endl;
+    EXPECT_EQ(recovered.size(), SESSION_COUNT);
+    EXPECT_LT(stats.recovery_time, std::chrono::seconds(2));
+}
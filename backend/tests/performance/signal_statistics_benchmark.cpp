@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "audio/signal_statistics.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+using namespace audio;
+
+class SignalStatisticsBenchmark : public ::testing::Test {
+protected:
+    static constexpr int SAMPLE_RATE = 16000;
+    static constexpr size_t ITERATIONS = 2000;
+
+    void SetUp() override {
+        std::mt19937 gen(42);
+        std::normal_distribution<float> noise(0.0f, 0.01f);
+        signal_.resize(SAMPLE_RATE);
+        for (size_t i = 0; i < signal_.size(); ++i) {
+            double t = static_cast<double>(i) / SAMPLE_RATE;
+            signal_[i] = static_cast<float>(0.3 * std::sin(2.0 * M_PI * 180.0 * t) *
+                                            (0.5 + 0.5 * std::sin(2.0 * M_PI * 2.0 * t))) + noise(gen);
+        }
+    }
+
+    void TearDown() override {
+        SignalStatistics::setActiveLevel(SignalStatistics::getSupportedLevel());
+    }
+
+    // Nanoseconds per call over `size` samples
+    template <typename Fn>
+    double measure(size_t size, Fn&& fn) {
+        volatile float sink = 0.0f;
+        for (size_t i = 0; i < 50; ++i) sink = sink + fn(signal_.data(), size);
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            sink = sink + fn(signal_.data() + (i * 64) % (signal_.size() - size + 1), size);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / ITERATIONS;
+    }
+
+    // The separate scalar passes AudioQualityAssessor used to make
+    static float separatePasses(const float* samples, size_t count) {
+        float sum = 0.0f, peak = 0.0f;
+        size_t crossings = 0, clipped = 0, silent = 0;
+        for (size_t i = 0; i < count; ++i) sum += samples[i] * samples[i];
+        for (size_t i = 0; i < count; ++i) peak = std::max(peak, std::abs(samples[i]));
+        for (size_t i = 1; i < count; ++i) crossings += (samples[i] >= 0.0f) != (samples[i - 1] >= 0.0f);
+        for (size_t i = 0; i < count; ++i) clipped += std::abs(samples[i]) >= 0.95f;
+        for (size_t i = 0; i < count; ++i) silent += std::abs(samples[i]) < 0.01f;
+        return std::sqrt(sum / count) + peak + crossings + clipped + silent;
+    }
+
+    static float fused(const float* samples, size_t count) {
+        auto stats = SignalStatistics::compute(samples, count);
+        return stats.rms() + stats.peak + stats.zeroCrossings + stats.clippedSamples + stats.silentSamples;
+    }
+
+    std::vector<float> signal_;
+};
+
+TEST_F(SignalStatisticsBenchmark, FusedKernelsPerLevel) {
+    // A 32 ms analysis frame and a one-second quality assessment buffer
+    for (size_t size : {512u, 16000u}) {
+        double baseline = measure(size, separatePasses);
+        std::cout << size << " samples, five scalar passes: " << baseline << " ns ("
+                  << size * sizeof(float) / baseline << " GB/s)" << std::endl;
+
+        double best = baseline;
+        for (auto level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+            if (SignalStatistics::setActiveLevel(level) != level) {
+                continue;
+            }
+            double ns = measure(size, fused);
+            best = std::min(best, ns);
+            std::cout << size << " samples, fused " << simdLevelName(level) << ": " << ns << " ns ("
+                      << size * sizeof(float) / ns << " GB/s, " << baseline / ns << "x)" << std::endl;
+        }
+
+        SignalStatistics::setActiveLevel(SignalStatistics::getSupportedLevel());
+        EXPECT_LT(best, baseline);
+    }
+}
@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include "core/translation_pipeline.hpp"
+#include "core/task_queue.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+using namespace speechrnt;
+
+namespace {
+
+class IdleSTT : public stt::STTInterface {
+public:
+    bool initialize(const std::string&, int) override { return true; }
+    void transcribe(const std::vector<float>&, TranscriptionCallback) override {}
+    void transcribeLive(const std::vector<float>&, TranscriptionCallback) override {}
+    void setLanguage(const std::string&) override {}
+    void setTranslateToEnglish(bool) override {}
+    void setTemperature(float) override {}
+    void setMaxTokens(int) override {}
+    void setLanguageDetectionEnabled(bool) override {}
+    void setLanguageDetectionThreshold(float) override {}
+    void setAutoLanguageSwitching(bool) override {}
+    bool isInitialized() const override { return true; }
+    std::string getLastError() const override { return ""; }
+};
+
+// Sleeps a fixed cost plus a per-word cost, like an encoder-decoder whose
+// decode time grows with output length, and accounts every call
+class TimedTranslator : public mt::TranslationInterface {
+public:
+    static constexpr int BASE_MS = 4;
+    static constexpr int PER_WORD_MS = 3;
+
+    bool initialize(const std::string&, const std::string&) override { return true; }
+
+    mt::TranslationResult translate(const std::string& text) override {
+        std::istringstream stream(text);
+        std::string word;
+        size_t words = 0;
+        while (stream >> word) ++words;
+
+        int cost = BASE_MS + PER_WORD_MS * static_cast<int>(words);
+        std::this_thread::sleep_for(std::chrono::milliseconds(cost));
+        calls_++;
+        computeMs_ += cost;
+
+        mt::TranslationResult result;
+        result.translatedText = "[" + text + "]";
+        result.confidence = 0.9f;
+        result.success = true;
+        return result;
+    }
+
+    std::future<mt::TranslationResult> translateAsync(const std::string& text) override {
+        return std::async(std::launch::async, [this, text]() { return translate(text); });
+    }
+    bool supportsLanguagePair(const std::string&, const std::string&) const override { return true; }
+    std::vector<std::string> getSupportedSourceLanguages() const override { return {"en"}; }
+    std::vector<std::string> getSupportedTargetLanguages(const std::string&) const override { return {"es"}; }
+    bool isReady() const override { return true; }
+    void cleanup() override {}
+    std::vector<mt::TranslationResult> translateBatch(const std::vector<std::string>& texts) override {
+        std::vector<mt::TranslationResult> results;
+        for (const auto& text : texts) results.push_back(translate(text));
+        return results;
+    }
+    std::future<std::vector<mt::TranslationResult>> translateBatchAsync(const std::vector<std::string>& texts) override {
+        return std::async(std::launch::async, [this, texts]() { return translateBatch(texts); });
+    }
+    bool startStreamingTranslation(const std::string&, const std::string&, const std::string&) override { return false; }
+    mt::TranslationResult addStreamingText(const std::string&, const std::string&, bool) override { return {}; }
+    mt::TranslationResult finalizeStreamingTranslation(const std::string&) override { return {}; }
+    void cancelStreamingTranslation(const std::string&) override {}
+    bool hasStreamingSession(const std::string&) const override { return false; }
+
+    size_t calls() const { return calls_; }
+    long computeMs() const { return computeMs_; }
+
+private:
+    std::atomic<size_t> calls_{0};
+    std::atomic<long> computeMs_{0};
+};
+
+// Utterances as a recognizer would stream them: one word per partial, an
+// occasional misheard last word fixed in the next partial, and a repeated
+// partial once the speaker pauses
+const std::vector<std::string> CORPUS = {
+    "good morning, I would like to book a table for two people tonight",
+    "the train to the airport leaves every fifteen minutes from platform four",
+    "could you tell me where the nearest pharmacy is",
+    "we are still waiting for the delivery, it was supposed to arrive yesterday",
+    "please send me the report before the meeting on thursday afternoon",
+    "my flight has been delayed, so I will be late for dinner",
+    "how much does it cost to rent a car for a week",
+    "the weather tomorrow will be sunny with a light breeze in the morning",
+    "I lost my wallet somewhere between the hotel and the museum",
+    "thank you very much for your help, have a nice evening",
+};
+
+std::vector<std::string> splitWords(const std::string& text) {
+    std::istringstream stream(text);
+    std::vector<std::string> words;
+    std::string word;
+    while (stream >> word) words.push_back(word);
+    return words;
+}
+
+std::string joinWords(const std::vector<std::string>& words, size_t count) {
+    std::string text;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) text += ' ';
+        text += words[i];
+    }
+    return text;
+}
+
+stt::TranscriptionResult transcript(const std::string& text, bool partial) {
+    stt::TranscriptionResult result;
+    result.text = text;
+    result.confidence = 0.95f;
+    result.is_partial = partial;
+    result.meets_confidence_threshold = true;
+    return result;
+}
+
+} // namespace
+
+class SpeculativeTranslationBenchmark : public ::testing::Test {
+protected:
+    static constexpr auto PARTIAL_INTERVAL = std::chrono::milliseconds(40);
+
+    struct Outcome {
+        double meanLatencyMs = 0.0;
+        double maxLatencyMs = 0.0;
+        size_t mtCalls = 0;
+        long mtComputeMs = 0;
+        core::TranslationPipeline::Statistics stats{};
+    };
+
+    Outcome replay(bool speculative) {
+        auto translator = std::make_shared<TimedTranslator>();
+        auto queue = std::make_shared<core::TaskQueue>();
+        core::ThreadPool pool(2);
+        pool.start(queue);
+
+        core::TranslationPipelineConfig config;
+        config.enable_confidence_gating = false;
+        config.enable_multiple_candidates = false;
+        config.enable_language_detection = false;
+        config.enable_preliminary_translation = speculative;
+
+        core::TranslationPipeline pipeline(config);
+        EXPECT_TRUE(pipeline.initialize(std::make_shared<IdleSTT>(), translator, nullptr, queue));
+
+        std::mutex mutex;
+        std::condition_variable done;
+        std::unordered_map<uint32_t, std::chrono::steady_clock::time_point> finished;
+        pipeline.setTranslationCompleteCallback([&](const core::PipelineResult& result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished[result.utterance_id] = std::chrono::steady_clock::now();
+            done.notify_all();
+        });
+
+        std::vector<double> latencies;
+        for (size_t u = 0; u < CORPUS.size(); ++u) {
+            uint32_t id = static_cast<uint32_t>(u + 1);
+            auto words = splitWords(CORPUS[u]);
+
+            for (size_t k = 1; k <= words.size(); ++k) {
+                std::string text = joinWords(words, k);
+                if (k % 5 == 0 && k < words.size()) {
+                    // Misheard tail, corrected by the next partial
+                    text = joinWords(words, k - 1) + " uh";
+                }
+                pipeline.processPartialTranscription(id, "replay", transcript(text, true));
+                std::this_thread::sleep_for(PARTIAL_INTERVAL);
+            }
+            // Pause before the endpoint: the full text shows up once more
+            pipeline.processPartialTranscription(id, "replay", transcript(CORPUS[u], true));
+            std::this_thread::sleep_for(PARTIAL_INTERVAL);
+
+            auto endOfSpeech = std::chrono::steady_clock::now();
+            pipeline.processTranscriptionResult(id, "replay", transcript(CORPUS[u], false));
+
+            std::unique_lock<std::mutex> lock(mutex);
+            bool completed = done.wait_for(lock, std::chrono::seconds(5), [&]() { return finished.count(id) > 0; });
+            EXPECT_TRUE(completed) << "utterance " << id;
+            if (completed) {
+                latencies.push_back(std::chrono::duration<double, std::milli>(finished[id] - endOfSpeech).count());
+            }
+        }
+
+        Outcome outcome;
+        if (!latencies.empty()) {
+            outcome.meanLatencyMs = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+            outcome.maxLatencyMs = *std::max_element(latencies.begin(), latencies.end());
+        }
+        outcome.stats = pipeline.getStatistics();
+
+        pipeline.shutdown();
+        pool.stop();
+        outcome.mtCalls = translator->calls();
+        outcome.mtComputeMs = translator->computeMs();
+        return outcome;
+    }
+};
+
+TEST_F(SpeculativeTranslationBenchmark, EndOfSpeechLatencyVersusComputeOnReplayedCorpus) {
+    Outcome baseline = replay(false);
+    Outcome speculative = replay(true);
+
+    std::cout << "\n=== Speculative Translation (" << CORPUS.size() << " utterances) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::setw(14) << "mode" << std::setw(14) << "mean ms" << std::setw(12) << "max ms"
+              << std::setw(12) << "MT calls" << std::setw(14) << "MT compute" << std::endl;
+    std::cout << std::setw(14) << "final only" << std::setw(14) << baseline.meanLatencyMs
+              << std::setw(12) << baseline.maxLatencyMs << std::setw(12) << baseline.mtCalls
+              << std::setw(12) << baseline.mtComputeMs << "ms" << std::endl;
+    std::cout << std::setw(14) << "speculative" << std::setw(14) << speculative.meanLatencyMs
+              << std::setw(12) << speculative.maxLatencyMs << std::setw(12) << speculative.mtCalls
+              << std::setw(12) << speculative.mtComputeMs << "ms" << std::endl;
+    std::cout << "Reused " << speculative.stats.speculative_reused
+              << ", extended " << speculative.stats.speculative_extended
+              << ", discarded " << speculative.stats.speculative_discarded
+              << ", speculative MT " << speculative.stats.speculative_mt_time.count() << "ms" << std::endl;
+    std::cout << "Latency x" << std::setprecision(2) << speculative.meanLatencyMs / baseline.meanLatencyMs
+              << " for MT compute x" << static_cast<double>(speculative.mtComputeMs) / baseline.mtComputeMs
+              << std::endl;
+
+    EXPECT_EQ(baseline.mtCalls, CORPUS.size());
+    EXPECT_GT(speculative.stats.speculative_reused + speculative.stats.speculative_extended, 0u);
+    EXPECT_LT(speculative.meanLatencyMs, baseline.meanLatencyMs);
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "utils/trace_recorder.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace speechrnt::utils;
+
+class TraceOverheadBenchmark : public ::testing::Test {
+protected:
+    static constexpr int SPANS = 2000000;
+
+    void TearDown() override {
+        recorder_.disable();
+        recorder_.clear();
+    }
+
+    // Cost of opening and closing one span on the current context
+    static double nsPerSpan() {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < SPANS; ++i) {
+            TraceSpan span("stage");
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / SPANS;
+    }
+
+    TraceRecorder& recorder_ = TraceRecorder::getInstance();
+};
+
+TEST_F(TraceOverheadBenchmark, SpanCost) {
+    recorder_.disable();
+    double disabled = nsPerSpan();
+
+    recorder_.enable(1);
+    double unsampled = nsPerSpan();
+
+    ScopedTraceContext scope(recorder_.beginUtterance("session", 1));
+    double sampled = nsPerSpan();
+
+    std::cout << "Span cost: " << disabled << " ns disabled, " << unsampled << " ns unsampled, "
+              << sampled << " ns sampled" << std::endl;
+    EXPECT_LT(disabled, 5.0);
+    EXPECT_LT(sampled, 500.0);
+}
+
+TEST_F(TraceOverheadBenchmark, ExportOfFullRing) {
+    recorder_.enable(1);
+    TraceContext context = recorder_.beginUtterance("session", 1);
+    for (size_t i = 0; i < TraceRecorder::RING_CAPACITY; ++i) {
+        TraceSpan span("stage", context);
+    }
+
+    std::string trace;
+    auto start = std::chrono::steady_clock::now();
+    recorder_.exportChromeTrace(trace);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Export of " << TraceRecorder::RING_CAPACITY << " spans: " << ms << " ms, "
+              << trace.size() / 1024.0 << " KiB" << std::endl;
+    EXPECT_LT(ms, 100.0);
+}
@@ -0,0 +1,317 @@
+#include <gtest/gtest.h>
+#include "core/websocket_server.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace core;
+
+namespace {
+
+/**
+ * Minimal blocking WebSocket client: HTTP upgrade plus masked text frames
+ */
+class LoadClient {
+public:
+    ~LoadClient() { close(); }
+
+    bool connect(int port) {
+        fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        int one = 1;
+        ::setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        timeval timeout{5, 0};
+        ::setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(static_cast<uint16_t>(port));
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            close();
+            return false;
+        }
+
+        std::string request =
+            "GET / HTTP/1.1\r\n"
+            "Host: localhost\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+            "Sec-WebSocket-Version: 13\r\n\r\n";
+        if (!writeAll(request.data(), request.size())) {
+            close();
+            return false;
+        }
+
+        // Read up to the end of the response headers; anything after is frame data
+        std::string response;
+        char c;
+        while (response.size() < 4096) {
+            if (::recv(fd_, &c, 1, 0) != 1) {
+                close();
+                return false;
+            }
+            response += c;
+            if (response.size() >= 4 && response.compare(response.size() - 4, 4, "\r\n\r\n") == 0) {
+                break;
+            }
+        }
+        if (response.find(" 101 ") == std::string::npos) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    bool sendText(const std::string& payload) {
+        std::string frame;
+        frame += static_cast<char>(0x81);
+        if (payload.size() < 126) {
+            frame += static_cast<char>(0x80 | payload.size());
+        } else {
+            frame += static_cast<char>(0x80 | 126);
+            frame += static_cast<char>((payload.size() >> 8) & 0xFF);
+            frame += static_cast<char>(payload.size() & 0xFF);
+        }
+        const unsigned char mask[4] = {0x12, 0x34, 0x56, 0x78};
+        frame.append(reinterpret_cast<const char*>(mask), 4);
+        for (size_t i = 0; i < payload.size(); ++i) {
+            frame += static_cast<char>(payload[i] ^ mask[i % 4]);
+        }
+        return writeAll(frame.data(), frame.size());
+    }
+
+    /**
+     * Read the next server frame (servers never mask)
+     */
+    bool readFrame(std::string& payload) {
+        unsigned char header[2];
+        if (!readAll(header, 2)) {
+            return false;
+        }
+        uint64_t length = header[1] & 0x7F;
+        if (length == 126) {
+            unsigned char ext[2];
+            if (!readAll(ext, 2)) return false;
+            length = (static_cast<uint64_t>(ext[0]) << 8) | ext[1];
+        } else if (length == 127) {
+            unsigned char ext[8];
+            if (!readAll(ext, 8)) return false;
+            length = 0;
+            for (unsigned char b : ext) length = (length << 8) | b;
+        }
+        payload.resize(length);
+        return length == 0 || readAll(&payload[0], length);
+    }
+
+    void close() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+private:
+    bool writeAll(const void* data, size_t size) {
+        const char* p = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t n = ::send(fd_, p, size, MSG_NOSIGNAL);
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool readAll(void* data, size_t size) {
+        char* p = static_cast<char*>(data);
+        while (size > 0) {
+            ssize_t n = ::recv(fd_, p, size, 0);
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    int fd_ = -1;
+};
+
+} // namespace
+
+/**
+ * Connection and ping/pong throughput for 1, 2 and 4 event loops
+ *
+ * Needs the server built against real uWebSockets/uSockets. The bundled
+ * development stub in third_party never opens a listen socket, so against
+ * it the benchmark skips and reports no numbers.
+ */
+class WebSocketLoadBenchmark : public ::testing::Test {
+protected:
+    static constexpr int CLIENTS = 32;             // Stays under the admission session limit
+    static constexpr int CONNECTS_PER_CLIENT = 20;
+    static constexpr int MESSAGES_PER_CLIENT = 500;
+    static constexpr int PIPELINE_DEPTH = 16;      // Pings in flight per client
+
+    struct Result {
+        double connectionsPerSecond = 0.0;
+        double messagesPerSecond = 0.0;
+        int failures = 0;
+    };
+
+    bool startServer(size_t loops, int port) {
+        server_ = std::make_unique<WebSocketServer>(port, loops);
+        server_->start();
+        serverThread_ = std::thread([this]() { server_->run(); });
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::chrono::steady_clock::now() < deadline) {
+            LoadClient probe;
+            if (probe.connect(port)) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        stopServer();
+        return false;
+    }
+
+    void stopServer() {
+        if (server_) {
+            server_->stop();
+        }
+        if (serverThread_.joinable()) {
+            serverThread_.join();
+        }
+        server_.reset();
+    }
+
+    void TearDown() override { stopServer(); }
+
+    Result measure(int port) {
+        Result result;
+        std::atomic<int> failures{0};
+
+        // Connection churn: upgrade, read the admission status, disconnect
+        auto start = std::chrono::steady_clock::now();
+        runClients([&](int) {
+            for (int i = 0; i < CONNECTS_PER_CLIENT; ++i) {
+                LoadClient client;
+                std::string frame;
+                if (!client.connect(port) || !client.readFrame(frame)) {
+                    ++failures;
+                }
+            }
+        });
+        double seconds = elapsedSeconds(start);
+        result.connectionsPerSecond = CLIENTS * CONNECTS_PER_CLIENT / seconds;
+
+        // Message round trips: ping -> pong over persistent connections
+        start = std::chrono::steady_clock::now();
+        runClients([&](int) {
+            LoadClient client;
+            if (!client.connect(port)) {
+                ++failures;
+                return;
+            }
+            const std::string ping = "{\"type\":\"ping\"}";
+            int sent = 0;
+            int received = 0;
+            std::string frame;
+            while (received < MESSAGES_PER_CLIENT) {
+                while (sent < MESSAGES_PER_CLIENT && sent - received < PIPELINE_DEPTH) {
+                    if (!client.sendText(ping)) {
+                        ++failures;
+                        return;
+                    }
+                    ++sent;
+                }
+                if (!client.readFrame(frame)) {
+                    ++failures;
+                    return;
+                }
+                if (frame.find("\"pong\"") != std::string::npos) {
+                    ++received;
+                }
+            }
+        });
+        seconds = elapsedSeconds(start);
+        result.messagesPerSecond = CLIENTS * MESSAGES_PER_CLIENT / seconds;
+        result.failures = failures;
+        return result;
+    }
+
+    template <typename Fn>
+    void runClients(Fn&& body) {
+        std::vector<std::thread> threads;
+        for (int c = 0; c < CLIENTS; ++c) {
+            threads.emplace_back(body, c);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::unique_ptr<WebSocketServer> server_;
+    std::thread serverThread_;
+};
+
+TEST_F(WebSocketLoadBenchmark, ThroughputScalesWithLoopCount) {
+    const std::vector<size_t> loopCounts = {1, 2, 4};
+    std::vector<Result> results;
+
+    std::cout << "\n=== WebSocket Load (" << CLIENTS << " clients) ===" << std::endl;
+    std::cout << std::setw(8) << "loops" << std::setw(16) << "connections/s"
+              << std::setw(16) << "messages/s" << std::endl;
+
+    for (size_t i = 0; i < loopCounts.size(); ++i) {
+        // Fresh port per run so sockets lingering from the last server don't interfere
+        int port = 18480 + static_cast<int>(i);
+        if (!startServer(loopCounts[i], port)) {
+            GTEST_SKIP() << "WebSocket server not reachable on port " << port
+                         << " (built against the uWS development stub, which does not listen;"
+                         << " loop scaling not measured)";
+        }
+        EXPECT_EQ(server_->getLoopCount(), loopCounts[i]);
+
+        Result result = measure(port);
+        stopServer();
+
+        EXPECT_EQ(result.failures, 0) << "loops=" << loopCounts[i];
+        results.push_back(result);
+        std::cout << std::setw(8) << loopCounts[i]
+                  << std::setw(16) << std::fixed << std::setprecision(0) << result.connectionsPerSecond
+                  << std::setw(16) << result.messagesPerSecond << std::endl;
+    }
+
+    double connectionScaling = results.back().connectionsPerSecond / results.front().connectionsPerSecond;
+    double messageScaling = results.back().messagesPerSecond / results.front().messagesPerSecond;
+    std::cout << std::setprecision(2) << "Scaling " << loopCounts.front() << " -> " << loopCounts.back()
+              << " loops: connections x" << connectionScaling
+              << ", messages x" << messageScaling << std::endl;
+
+    // The clients share the machine with the server, so only expect a clear
+    // gain when there are cores to spare for both
+    if (std::thread::hardware_concurrency() >= 8) {
+        EXPECT_GT(messageScaling, 1.3);
+        EXPECT_GT(connectionScaling, 1.3);
+    }
+}
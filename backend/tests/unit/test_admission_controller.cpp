@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "core/admission_controller.hpp"
+#include "core/message_protocol.hpp"
+
+using namespace core;
+
+namespace {
+
+AdmissionConfig singleWorkerConfig() {
+    AdmissionConfig config;
+    config.workerCount = 1;
+    return config;
+}
+
+} // namespace
+
+TEST(AdmissionControllerTest, IdlePipelineAdmitsAtFullQuality) {
+    AdmissionController controller(singleWorkerConfig());
+
+    auto result = controller.admitSession("a");
+    EXPECT_EQ(result.decision, AdmissionDecision::ADMIT);
+    EXPECT_TRUE(result.profile.isFullQuality());
+    EXPECT_LE(result.predictedLatencyMs, controller.getConfig().latencySloMs);
+    EXPECT_TRUE(controller.canAcceptWork());
+    EXPECT_EQ(controller.getStats().activeSessions, 1u);
+}
+
+TEST(AdmissionControllerTest, DegradesBeforeRejecting) {
+    AdmissionController controller(singleWorkerConfig());
+    ASSERT_EQ(controller.admitSession("a").decision, AdmissionDecision::ADMIT);
+
+    // A second full-quality session would push one worker past the target
+    auto second = controller.admitSession("b");
+    EXPECT_EQ(second.decision, AdmissionDecision::DEGRADE);
+    EXPECT_FALSE(second.profile.partialResults);
+    EXPECT_LE(second.predictedLatencyMs, controller.getConfig().latencySloMs);
+
+    AdmissionResult last;
+    for (int i = 0; i < 10; ++i) {
+        last = controller.admitSession("extra" + std::to_string(i));
+        if (last.decision == AdmissionDecision::REJECT) {
+            break;
+        }
+    }
+    EXPECT_EQ(last.decision, AdmissionDecision::REJECT);
+    EXPECT_FALSE(last.reason.empty());
+    EXPECT_GE(last.retryAfterMs, controller.getConfig().minRetryAfterMs);
+
+    auto stats = controller.getStats();
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_GE(stats.degradedSessions, 1u);
+    EXPECT_EQ(stats.lastDecision.decision, AdmissionDecision::REJECT);
+}
+
+TEST(AdmissionControllerTest, SessionLimitAndRelease) {
+    AdmissionConfig config;
+    config.maxSessions = 1;
+    AdmissionController controller(config);
+
+    EXPECT_NE(controller.admitSession("a").decision, AdmissionDecision::REJECT);
+    EXPECT_EQ(controller.admitSession("b").decision, AdmissionDecision::REJECT);
+
+    controller.releaseSession("a");
+    EXPECT_NE(controller.admitSession("b").decision, AdmissionDecision::REJECT);
+}
+
+TEST(AdmissionControllerTest, MeasuredOverloadShedsWorkAndRejects) {
+    AdmissionConfig config;
+    config.workerCount = 2;
+    AdmissionController controller(config);
+    controller.admitSession("a");
+
+    // Several seconds of STT work inside one second on two workers
+    for (int i = 0; i < 5; ++i) {
+        controller.recordServiceTime(AdmissionStage::TRANSCRIPTION, 1500.0);
+    }
+
+    auto stats = controller.getStats();
+    EXPECT_NEAR(stats.serviceTimeMs[0], 1500.0, 1e-6);
+    EXPECT_GT(stats.utilization, 1.0);
+    EXPECT_FALSE(stats.acceptingWork);
+    EXPECT_FALSE(controller.canAcceptWork());
+    EXPECT_EQ(controller.evaluateNewSession().decision, AdmissionDecision::REJECT);
+}
+
+TEST(AdmissionControllerTest, QueueDepthRaisesPredictedLatency) {
+    AdmissionController controller(singleWorkerConfig());
+    double idle = controller.getStats().predictedLatencyMs;
+
+    controller.adjustQueueDepth(AdmissionStage::TRANSLATION, 10);
+    EXPECT_EQ(controller.getStats().queueDepth[1], 10u);
+    EXPECT_GT(controller.getStats().predictedLatencyMs, idle);
+
+    // Depth never goes negative
+    controller.adjustQueueDepth(AdmissionStage::TRANSLATION, -20);
+    EXPECT_EQ(controller.getStats().queueDepth[1], 0u);
+    EXPECT_DOUBLE_EQ(controller.getStats().predictedLatencyMs, idle);
+}
+
+TEST(AdmissionControllerTest, StatusMessageRoundTrip) {
+    AdmissionStatusMessage message("degrade", "Reduced quality");
+    message.setPartialResults(false);
+    message.setReducedModel(true);
+    message.setRetryAfterMs(0);
+
+    std::string json = message.serialize();
+    EXPECT_TRUE(MessageProtocol::validateMessage(json));
+    EXPECT_EQ(MessageProtocol::getMessageType(json), MessageType::ADMISSION_STATUS);
+
+    auto parsed = MessageProtocol::parseMessage(json);
+    auto* status = dynamic_cast<AdmissionStatusMessage*>(parsed.get());
+    ASSERT_NE(status, nullptr);
+    EXPECT_EQ(status->getDecision(), "degrade");
+    EXPECT_EQ(status->getReason(), "Reduced quality");
+    EXPECT_FALSE(status->getPartialResults());
+    EXPECT_TRUE(status->getReducedModel());
+    EXPECT_TRUE(status->getSpeechSynthesis());
+}
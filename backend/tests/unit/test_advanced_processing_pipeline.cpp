@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include "stt/advanced/advanced_processing_pipeline.hpp"
+#include "core/task_queue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+
+using namespace stt::advanced;
+
+namespace {
+
+// Sleeps for a fixed time and declares the data flow the real stage would
+class SleepingStage : public PipelineStageProcessor {
+public:
+    SleepingStage(PipelineStage stage, std::vector<PipelineData> inputs, std::vector<PipelineData> outputs,
+                  int sleepMs, int failuresBeforeSuccess = 0)
+        : stage_(stage), inputs_(std::move(inputs)), outputs_(std::move(outputs)), sleepMs_(sleepMs),
+          failuresLeft_(failuresBeforeSuccess) {}
+
+    PipelineStage getStageType() const override { return stage_; }
+
+    PipelineStageResult processStage(PipelineExecutionContext& context) override {
+        calls++;
+        startedAt = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(sleepMs_));
+        finishedAt = std::chrono::steady_clock::now();
+        if (stage_ == PipelineStage::TRANSCRIPTION) {
+            context.baseTranscription.text = "hello";
+        }
+        if (failuresLeft_ < 0 || failuresLeft_-- > 0) {
+            PipelineStageResult result(stage_, false, 0.0f);
+            result.errorMessage = "simulated failure";
+            return result;
+        }
+        return PipelineStageResult(stage_, true, 0.0f);
+    }
+
+    bool canSkipStage(const PipelineExecutionContext&) const override { return false; }
+    std::vector<PipelineStage> getStageDependencies() const override { return {}; }
+    std::vector<PipelineData> getStageInputs() const override { return inputs_; }
+    std::vector<PipelineData> getStageOutputs() const override { return outputs_; }
+    bool validatePrerequisites(const PipelineExecutionContext&) const override { return true; }
+    float getEstimatedProcessingTime(const PipelineExecutionContext&) const override {
+        return static_cast<float>(sleepMs_);
+    }
+    bool isInitialized() const override { return true; }
+    std::string getLastError() const override { return ""; }
+
+    std::atomic<int> calls{0};
+    std::chrono::steady_clock::time_point startedAt;
+    std::chrono::steady_clock::time_point finishedAt;
+
+private:
+    PipelineStage stage_;
+    std::vector<PipelineData> inputs_;
+    std::vector<PipelineData> outputs_;
+    int sleepMs_;
+    int failuresLeft_;
+};
+
+const std::vector<PipelineStage> kStages = {
+    PipelineStage::AUDIO_PREPROCESSING, PipelineStage::REALTIME_ANALYSIS, PipelineStage::SPEAKER_DIARIZATION,
+    PipelineStage::EMOTION_ANALYSIS, PipelineStage::TRANSCRIPTION, PipelineStage::CONTEXTUAL_ENHANCEMENT,
+    PipelineStage::RESULT_FINALIZATION};
+
+// Critical path is preprocessing -> transcription -> contextual = 140 ms of 320 ms total
+std::map<PipelineStage, SleepingStage*> registerSleepingStages(AdvancedProcessingPipeline& pipeline,
+                                                               int transcriptionFailures = 0) {
+    std::map<PipelineStage, SleepingStage*> stages;
+    auto add = [&](PipelineStage stage, std::vector<PipelineData> in, std::vector<PipelineData> out, int ms,
+                   int failures = 0) {
+        auto processor = std::make_unique<SleepingStage>(stage, std::move(in), std::move(out), ms, failures);
+        stages[stage] = processor.get();
+        EXPECT_TRUE(pipeline.registerStageProcessor(std::move(processor)));
+    };
+    add(PipelineStage::AUDIO_PREPROCESSING, {PipelineData::ORIGINAL_AUDIO}, {PipelineData::PROCESSED_AUDIO}, 40);
+    add(PipelineStage::REALTIME_ANALYSIS, {PipelineData::PROCESSED_AUDIO}, {PipelineData::REALTIME_METRICS}, 60);
+    add(PipelineStage::SPEAKER_DIARIZATION, {PipelineData::PROCESSED_AUDIO}, {PipelineData::SPEAKER_INFO}, 60);
+    add(PipelineStage::EMOTION_ANALYSIS, {PipelineData::PROCESSED_AUDIO}, {PipelineData::EMOTION}, 60);
+    add(PipelineStage::TRANSCRIPTION, {PipelineData::PROCESSED_AUDIO}, {PipelineData::BASE_TRANSCRIPTION}, 80,
+        transcriptionFailures);
+    add(PipelineStage::CONTEXTUAL_ENHANCEMENT, {PipelineData::BASE_TRANSCRIPTION},
+        {PipelineData::CONTEXTUAL_ENHANCEMENT}, 20);
+    add(PipelineStage::RESULT_FINALIZATION,
+        {PipelineData::REALTIME_METRICS, PipelineData::SPEAKER_INFO, PipelineData::EMOTION,
+         PipelineData::CONTEXTUAL_ENHANCEMENT},
+        {PipelineData::FINAL_RESULT}, 0);
+    return stages;
+}
+
+AudioProcessingRequest makeRequest() {
+    AudioProcessingRequest request;
+    request.utteranceId = 7;
+    request.audioData.assign(16000, 0.1f);
+    return request;
+}
+
+PipelineConfig makeConfig(bool parallel) {
+    PipelineConfig config;
+    config.enabledStages = kStages;
+    config.enableParallelProcessing = parallel;
+    config.enableStageRetry = false;
+    return config;
+}
+
+double runMs(AdvancedProcessingPipeline& pipeline, AdvancedTranscriptionResult& result) {
+    auto start = std::chrono::steady_clock::now();
+    result = pipeline.processAudio(makeRequest());
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+class AdvancedProcessingPipelineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        executor_ = std::make_shared<speechrnt::core::TaskQueue>();
+        pool_ = std::make_unique<speechrnt::core::ThreadPool>(4);
+        pool_->start(executor_);
+    }
+
+    void TearDown() override {
+        pool_->stop();
+    }
+
+    std::shared_ptr<speechrnt::core::TaskQueue> executor_;
+    std::unique_ptr<speechrnt::core::ThreadPool> pool_;
+};
+
+TEST_F(AdvancedProcessingPipelineTest, BuildsGraphFromDeclaredData) {
+    AdvancedProcessingPipeline pipeline;
+    ASSERT_TRUE(pipeline.initialize(makeConfig(true)));
+    registerSleepingStages(pipeline);
+
+    using Stages = std::vector<PipelineStage>;
+    EXPECT_EQ(pipeline.getStagePredecessors(PipelineStage::AUDIO_PREPROCESSING), Stages{});
+    EXPECT_EQ(pipeline.getStagePredecessors(PipelineStage::SPEAKER_DIARIZATION),
+              Stages{PipelineStage::AUDIO_PREPROCESSING});
+    EXPECT_EQ(pipeline.getStagePredecessors(PipelineStage::EMOTION_ANALYSIS),
+              Stages{PipelineStage::AUDIO_PREPROCESSING});
+    EXPECT_EQ(pipeline.getStagePredecessors(PipelineStage::CONTEXTUAL_ENHANCEMENT),
+              Stages{PipelineStage::TRANSCRIPTION});
+    EXPECT_EQ(pipeline.getStagePredecessors(PipelineStage::RESULT_FINALIZATION).size(), 4u);
+
+    // Disabled producers drop out of the graph instead of blocking consumers
+    pipeline.setStageEnabled(PipelineStage::AUDIO_PREPROCESSING, false);
+    EXPECT_EQ(pipeline.getStagePredecessors(PipelineStage::TRANSCRIPTION), Stages{});
+}
+
+TEST_F(AdvancedProcessingPipelineTest, IndependentStagesRunConcurrently) {
+    AdvancedProcessingPipeline pipeline;
+    pipeline.setExecutor(executor_);
+    ASSERT_TRUE(pipeline.initialize(makeConfig(true)));
+    registerSleepingStages(pipeline);
+
+    AdvancedTranscriptionResult result;
+    double wallMs = runMs(pipeline, result);
+    EXPECT_EQ(result.text, "hello");
+
+    // Latency follows the critical path (140 ms) rather than the sum (320 ms)
+    EXPECT_GE(wallMs, 140.0);
+    EXPECT_LT(wallMs, 230.0);
+
+    auto transcription = pipeline.getStageMetrics(PipelineStage::TRANSCRIPTION);
+    EXPECT_EQ(transcription["executions"], 1.0f);
+    EXPECT_NEAR(transcription["averageMs"], 80.0f, 30.0f);
+    EXPECT_NE(pipeline.getPipelineStats().find("\"parallelSpeedup\":"), std::string::npos);
+}
+
+TEST_F(AdvancedProcessingPipelineTest, StagesStartAfterTheirInputsFinish) {
+    AdvancedProcessingPipeline pipeline;
+    pipeline.setExecutor(executor_);
+    ASSERT_TRUE(pipeline.initialize(makeConfig(true)));
+    auto stages = registerSleepingStages(pipeline);
+
+    AdvancedTranscriptionResult result;
+    runMs(pipeline, result);
+
+    for (PipelineStage stage : kStages) {
+        EXPECT_EQ(stages[stage]->calls, 1) << static_cast<int>(stage);
+        for (PipelineStage predecessor : pipeline.getStagePredecessors(stage)) {
+            EXPECT_LE(stages[predecessor]->finishedAt, stages[stage]->startedAt) << static_cast<int>(stage);
+        }
+    }
+
+    // Diarization, emotion and transcription overlap once the audio is preprocessed
+    auto* diarization = stages[PipelineStage::SPEAKER_DIARIZATION];
+    auto* emotion = stages[PipelineStage::EMOTION_ANALYSIS];
+    auto* transcription = stages[PipelineStage::TRANSCRIPTION];
+    auto lastStart = std::max({diarization->startedAt, emotion->startedAt, transcription->startedAt});
+    auto firstFinish = std::min({diarization->finishedAt, emotion->finishedAt, transcription->finishedAt});
+    EXPECT_LT(lastStart, firstFinish);
+}
+
+TEST_F(AdvancedProcessingPipelineTest, SequentialModeRunsOnCaller) {
+    AdvancedProcessingPipeline pipeline;
+    ASSERT_TRUE(pipeline.initialize(makeConfig(false)));
+    registerSleepingStages(pipeline);
+
+    AdvancedTranscriptionResult result;
+    double wallMs = runMs(pipeline, result);
+    EXPECT_EQ(result.text, "hello");
+    EXPECT_GE(wallMs, 320.0);
+}
+
+TEST_F(AdvancedProcessingPipelineTest, SaturatedExecutorDoesNotDeadlock) {
+    // A queue nobody serves: the calling thread ends up running every stage
+    auto idle = std::make_shared<speechrnt::core::TaskQueue>();
+    AdvancedProcessingPipeline pipeline;
+    pipeline.setExecutor(idle);
+    ASSERT_TRUE(pipeline.initialize(makeConfig(true)));
+    registerSleepingStages(pipeline);
+
+    AdvancedTranscriptionResult result;
+    runMs(pipeline, result);
+    EXPECT_EQ(result.text, "hello");
+    EXPECT_EQ(pipeline.getStageMetrics(PipelineStage::RESULT_FINALIZATION)["executions"], 1.0f);
+}
+
+TEST_F(AdvancedProcessingPipelineTest, RetriesThenAbortsDependentsWhenSkippingDisabled) {
+    AdvancedProcessingPipeline pipeline;
+    pipeline.setExecutor(executor_);
+    PipelineConfig config = makeConfig(true);
+    config.enableStageRetry = true;
+    config.maxRetryAttempts = 2;
+    config.enableStageSkipping = false;
+    ASSERT_TRUE(pipeline.initialize(config));
+    auto stages = registerSleepingStages(pipeline, -1);
+
+    AdvancedTranscriptionResult result;
+    runMs(pipeline, result);
+    EXPECT_EQ(stages[PipelineStage::TRANSCRIPTION]->calls, 3);
+
+    auto transcription = pipeline.getStageMetrics(PipelineStage::TRANSCRIPTION);
+    EXPECT_EQ(transcription["failures"], 1.0f);
+    EXPECT_EQ(pipeline.getStageMetrics(PipelineStage::CONTEXTUAL_ENHANCEMENT)["skips"], 1.0f);
+    EXPECT_NE(pipeline.getLastError().find("transcription"), std::string::npos);
+}
+
+TEST_F(AdvancedProcessingPipelineTest, RejectsCyclicDeclarations) {
+    AdvancedProcessingPipeline pipeline;
+    ASSERT_TRUE(pipeline.initialize(makeConfig(true)));
+    registerSleepingStages(pipeline);
+
+    auto cyclic = std::make_unique<SleepingStage>(PipelineStage::AUDIO_PREPROCESSING,
+                                                  std::vector<PipelineData>{PipelineData::BASE_TRANSCRIPTION},
+                                                  std::vector<PipelineData>{PipelineData::PROCESSED_AUDIO}, 0);
+    EXPECT_FALSE(pipeline.registerStageProcessor(std::move(cyclic)));
+    EXPECT_NE(pipeline.getLastError().find("cycle"), std::string::npos);
+
+    // The previous graph stays in place
+    AdvancedTranscriptionResult result;
+    runMs(pipeline, result);
+    EXPECT_EQ(result.text, "hello");
+}
+
+TEST_F(AdvancedProcessingPipelineTest, DefaultStagesSkipMissingComponents) {
+    AdvancedProcessingPipeline pipeline;
+    ASSERT_TRUE(pipeline.initialize(PipelineConfig()));
+
+    AudioProcessingRequest request = makeRequest();
+    request.enableAllFeatures = true;
+    EXPECT_FLOAT_EQ(pipeline.getEstimatedProcessingTime(request), 0.1f);
+
+    AdvancedTranscriptionResult result = pipeline.processAudio(request);
+    EXPECT_TRUE(result.text.empty());
+    EXPECT_FALSE(result.hasEmotionAnalysis);
+    EXPECT_EQ(pipeline.getStageMetrics(PipelineStage::TRANSCRIPTION)["skips"], 1.0f);
+    EXPECT_EQ(pipeline.getStageMetrics(PipelineStage::RESULT_FINALIZATION)["executions"], 1.0f);
+}
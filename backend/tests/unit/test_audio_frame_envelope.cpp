@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include "core/audio_frame_envelope.hpp"
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace core;
+
+namespace {
+
+std::string pcm16(std::initializer_list<int16_t> samples) {
+    std::string bytes(samples.size() * sizeof(int16_t), '\0');
+    std::memcpy(&bytes[0], samples.begin(), bytes.size());
+    return bytes;
+}
+
+std::string frame(uint32_t sequence, const std::string& payload, uint16_t flags = 0) {
+    AudioFrameHeader header;
+    header.sequenceNumber = sequence;
+    header.flags = flags;
+    header.captureTimestampUs = 1700000000000000ull + sequence;
+    auto bytes = AudioFrameEnvelope::serialize(header, payload);
+    return std::string(bytes.begin(), bytes.end());
+}
+
+AudioFrameView parsed(const std::string& data) {
+    AudioFrameView view;
+    EXPECT_EQ(AudioFrameEnvelope::parse(data, view), AudioFrameParseResult::ENVELOPE);
+    return view;
+}
+
+} // namespace
+
+TEST(AudioFrameEnvelopeTest, RoundTripsHeaderFields) {
+    AudioFrameHeader header;
+    header.codec = AudioFrameCodec::PCM_F32LE;
+    header.sampleRate = 48000;
+    header.flags = AudioFrameFlags::END_OF_UTTERANCE;
+    header.sequenceNumber = 0xA1B2C3D4;
+    header.captureTimestampUs = 0x0102030405060708ull;
+
+    auto bytes = AudioFrameEnvelope::serialize(header, "abcd");
+    ASSERT_EQ(bytes.size(), AudioFrameEnvelope::HEADER_SIZE + 4);
+
+    std::string data(bytes.begin(), bytes.end());
+    AudioFrameView view;
+    ASSERT_EQ(AudioFrameEnvelope::parse(data, view), AudioFrameParseResult::ENVELOPE);
+    EXPECT_TRUE(view.hasEnvelope);
+    EXPECT_EQ(view.header.codec, AudioFrameCodec::PCM_F32LE);
+    EXPECT_EQ(view.header.sampleRate, 48000u);
+    EXPECT_TRUE(view.header.hasFlag(AudioFrameFlags::END_OF_UTTERANCE));
+    EXPECT_EQ(view.header.sequenceNumber, 0xA1B2C3D4u);
+    EXPECT_EQ(view.header.captureTimestampUs, 0x0102030405060708ull);
+    EXPECT_EQ(view.payload, "abcd");
+
+    // Payload aliases the input buffer
+    EXPECT_EQ(view.payload.data(), data.data() + AudioFrameEnvelope::HEADER_SIZE);
+}
+
+TEST(AudioFrameEnvelopeTest, RawFramesAreLegacy) {
+    std::string raw = pcm16({100, -100, 2000, -2000});
+    AudioFrameView view;
+    EXPECT_EQ(AudioFrameEnvelope::parse(raw, view), AudioFrameParseResult::LEGACY_RAW);
+    EXPECT_FALSE(view.hasEnvelope);
+    EXPECT_EQ(view.payload.size(), raw.size());
+}
+
+TEST(AudioFrameEnvelopeTest, RejectsInvalidHeaders) {
+    std::string data = frame(1, pcm16({1, 2}));
+    AudioFrameView view;
+
+    EXPECT_EQ(AudioFrameEnvelope::parse(data.substr(0, 10), view), AudioFrameParseResult::MALFORMED);
+
+    std::string badVersion = data;
+    badVersion[4] = 9;
+    EXPECT_EQ(AudioFrameEnvelope::parse(badVersion, view), AudioFrameParseResult::MALFORMED);
+
+    std::string badRate = data;
+    badRate[7] = 0;
+    EXPECT_EQ(AudioFrameEnvelope::parse(badRate, view), AudioFrameParseResult::MALFORMED);
+}
+
+TEST(AudioFrameEnvelopeTest, SkipsExtendedHeaderFields) {
+    std::string data = frame(7, pcm16({5}));
+    data.insert(AudioFrameEnvelope::HEADER_SIZE, "XYZW");
+    data[5] = static_cast<char>(AudioFrameEnvelope::HEADER_SIZE + 4);
+
+    AudioFrameView view = parsed(data);
+    EXPECT_EQ(view.header.sequenceNumber, 7u);
+    EXPECT_EQ(view.payload, pcm16({5}));
+}
+
+TEST(AudioFrameSequencerTest, DeliversInOrderFramesImmediately) {
+    AudioFrameSequencer sequencer;
+    std::vector<AudioFrameSequencer::OrderedFrame> ready;
+
+    for (uint32_t seq = 10; seq < 15; ++seq) {
+        std::string data = frame(seq, pcm16({16384, -16384}));
+        ASSERT_TRUE(sequencer.push(parsed(data), ready));
+    }
+
+    ASSERT_EQ(ready.size(), 5u);
+    EXPECT_EQ(ready.front().sequenceNumber, 10u);
+    EXPECT_FLOAT_EQ(ready.front().samples[0], 0.5f);
+    EXPECT_FLOAT_EQ(ready.front().samples[1], -0.5f);
+    EXPECT_EQ(sequencer.getStatistics().framesInOrder, 5u);
+}
+
+TEST(AudioFrameSequencerTest, ReordersOutOfSequenceFrames) {
+    AudioFrameSequencer sequencer;
+    std::vector<AudioFrameSequencer::OrderedFrame> ready;
+
+    std::string f0 = frame(0, pcm16({0})), f1 = frame(1, pcm16({1})), f2 = frame(2, pcm16({2}),
+                                                                                 AudioFrameFlags::END_OF_UTTERANCE);
+    sequencer.push(parsed(f0), ready);
+    sequencer.push(parsed(f2), ready);
+    EXPECT_EQ(ready.size(), 1u);
+
+    sequencer.push(parsed(f1), ready);
+    ASSERT_EQ(ready.size(), 3u);
+    EXPECT_EQ(ready[1].sequenceNumber, 1u);
+    EXPECT_EQ(ready[2].sequenceNumber, 2u);
+    EXPECT_TRUE(ready[2].endOfUtterance);
+
+    auto stats = sequencer.getStatistics();
+    EXPECT_EQ(stats.framesReordered, 2u);
+    EXPECT_EQ(stats.framesLost, 0u);
+}
+
+TEST(AudioFrameSequencerTest, SkipsLostFramesAfterGapWait) {
+    AudioFrameSequencer sequencer(50, 500, 20);
+    std::vector<AudioFrameSequencer::OrderedFrame> ready;
+
+    std::string f0 = frame(0, pcm16({0})), f2 = frame(2, pcm16({2})), f3 = frame(3, pcm16({3}));
+    sequencer.push(parsed(f0), ready);
+    sequencer.push(parsed(f2), ready);
+    EXPECT_EQ(ready.size(), 1u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    sequencer.push(parsed(f3), ready);
+    ASSERT_EQ(ready.size(), 3u);
+    EXPECT_EQ(ready[1].sequenceNumber, 2u);
+    EXPECT_EQ(sequencer.getStatistics().framesLost, 1u);
+
+    // Frame 1 finally arrives and is discarded as late
+    std::string f1 = frame(1, pcm16({1}));
+    sequencer.push(parsed(f1), ready);
+    EXPECT_EQ(ready.size(), 3u);
+    EXPECT_EQ(sequencer.getStatistics().framesLate, 1u);
+}
+
+TEST(AudioFrameSequencerTest, RejectsUnsupportedPayloads) {
+    AudioFrameSequencer sequencer;
+    std::vector<AudioFrameSequencer::OrderedFrame> ready;
+
+    std::string odd = frame(0, std::string(3, '\0'));
+    EXPECT_FALSE(sequencer.push(parsed(odd), ready));
+
+    AudioFrameHeader header;
+    header.codec = AudioFrameCodec::OPUS;
+    auto bytes = AudioFrameEnvelope::serialize(header, "opus");
+    std::string opus(bytes.begin(), bytes.end());
+    EXPECT_FALSE(sequencer.push(parsed(opus), ready));
+    EXPECT_TRUE(ready.empty());
+}
+
+TEST(AudioFrameSequencerTest, DecodesCompressedFramesInOrderAndConcealsLoss) {
+    AudioFrameSequencer sequencer(50, 500, 20);
+    std::vector<std::string> decodedPayloads;
+    sequencer.setCompressedDecoder([&](std::string_view payload, std::vector<float>& samples) {
+        decodedPayloads.emplace_back(payload.empty() ? "<plc>" : std::string(payload));
+        samples.assign(4, payload.empty() ? 0.0f : 1.0f);
+        return true;
+    });
+
+    auto opusFrame = [](uint32_t sequence, const std::string& packet) {
+        AudioFrameHeader header;
+        header.codec = AudioFrameCodec::OPUS;
+        header.sequenceNumber = sequence;
+        auto bytes = AudioFrameEnvelope::serialize(header, packet);
+        return std::string(bytes.begin(), bytes.end());
+    };
+
+    std::vector<AudioFrameSequencer::OrderedFrame> ready;
+    std::string f0 = opusFrame(0, "p0"), f2 = opusFrame(2, "p2"), f1 = opusFrame(1, "p1");
+    std::string f4 = opusFrame(4, "p4"), f5 = opusFrame(5, "p5");
+
+    sequencer.push(parsed(f0), ready);
+    sequencer.push(parsed(f2), ready);
+    sequencer.push(parsed(f1), ready);
+    EXPECT_EQ(decodedPayloads, (std::vector<std::string>{"p0", "p1", "p2"}));
+
+    // Frame 3 never arrives: after the gap wait it is concealed before frame 4
+    sequencer.push(parsed(f4), ready);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    sequencer.push(parsed(f5), ready);
+
+    EXPECT_EQ(decodedPayloads, (std::vector<std::string>{"p0", "p1", "p2", "<plc>", "p4", "p5"}));
+    ASSERT_EQ(ready.size(), 6u);
+    EXPECT_EQ(ready[3].sequenceNumber, 3u);
+    EXPECT_EQ(sequencer.getStatistics().framesConcealed, 1u);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "audio/audio_segment.hpp"
+#include "audio/audio_buffer_manager.hpp"
+#include <vector>
+
+using namespace audio;
+
+namespace {
+
+std::vector<float> ramp(size_t samples, float start = 0.0f) {
+    std::vector<float> audio(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        audio[i] = start + static_cast<float>(i);
+    }
+    return audio;
+}
+
+} // namespace
+
+TEST(AudioSegmentTest, CopyOfSpansPooledBlocks) {
+    auto samples = ramp(AudioBlockPool::BLOCK_SAMPLES * 2 + 100);
+    auto segment = AudioSegment::copyOf(samples);
+
+    EXPECT_EQ(segment.size(), samples.size());
+    EXPECT_EQ(segment.chunks().size(), 3u);
+    EXPECT_EQ(segment.contiguousData(), nullptr);
+    EXPECT_EQ(segment.toVector(), samples);
+}
+
+TEST(AudioSegmentTest, SliceAndTailShareBlocks) {
+    auto samples = ramp(AudioBlockPool::BLOCK_SAMPLES + 1000);
+    auto segment = AudioSegment::copyOf(samples);
+
+    auto middle = segment.slice(AudioBlockPool::BLOCK_SAMPLES - 10, 20);
+    ASSERT_EQ(middle.size(), 20u);
+    EXPECT_EQ(middle.chunks()[0].block, segment.chunks()[0].block);
+    auto values = middle.toVector();
+    EXPECT_FLOAT_EQ(values.front(), samples[AudioBlockPool::BLOCK_SAMPLES - 10]);
+    EXPECT_FLOAT_EQ(values.back(), samples[AudioBlockPool::BLOCK_SAMPLES + 9]);
+
+    auto last = segment.tail(100);
+    ASSERT_NE(last.contiguousData(), nullptr);
+    EXPECT_FLOAT_EQ(last.contiguousData()[0], samples[samples.size() - 100]);
+    EXPECT_EQ(segment.tail(samples.size() * 2).size(), samples.size());
+    EXPECT_TRUE(segment.slice(samples.size(), 10).empty());
+}
+
+TEST(AudioSegmentTest, AppendRejoinsAdjacentViews) {
+    auto segment = AudioSegment::copyOf(ramp(1000));
+    AudioSegment joined = segment.slice(0, 400);
+    joined.append(segment.slice(400, 600));
+
+    EXPECT_EQ(joined.size(), 1000u);
+    EXPECT_EQ(joined.chunks().size(), 1u);
+    EXPECT_EQ(joined.toVector(), segment.toVector());
+}
+
+TEST(AudioSegmentTest, BuilderSnapshotIsStableWhileAppending) {
+    AudioSegmentBuilder builder;
+    builder.append(ramp(100));
+    auto early = builder.snapshot();
+
+    builder.append(ramp(AudioBlockPool::BLOCK_SAMPLES, 100.0f));
+    EXPECT_EQ(early.size(), 100u);
+    EXPECT_EQ(early.toVector(), ramp(100));
+
+    auto all = builder.release();
+    EXPECT_EQ(all.size(), AudioBlockPool::BLOCK_SAMPLES + 100);
+    EXPECT_EQ(all.toVector(), ramp(AudioBlockPool::BLOCK_SAMPLES + 100));
+    EXPECT_TRUE(builder.empty());
+}
+
+TEST(AudioSegmentTest, CopyStatsCountIngestAndMaterialization) {
+    AudioSegment::resetCopyStats();
+    auto segment = AudioSegment::copyOf(ramp(16000));
+
+    // Passing the utterance through several owners copies nothing
+    AudioBufferManager manager{AudioBufferManager::BufferConfig()};
+    manager.createUtterance(1);
+    manager.addAudioData(1, segment);
+    auto buffered = manager.getBufferedSegment(1);
+    auto shared = buffered.slice(0, buffered.size());
+    EXPECT_EQ(AudioSegment::getCopyStats().materializedSamples, 0u);
+
+    shared.toVector();
+    auto stats = AudioSegment::getCopyStats();
+    EXPECT_EQ(stats.ingestedSamples, 16000u);
+    EXPECT_EQ(stats.materializedSamples, 16000u);
+    EXPECT_EQ(stats.copiedBytes(), 2u * 16000u * sizeof(float));
+}
+
+TEST(AudioSegmentTest, BlocksReturnToPool) {
+    auto& pool = AudioBlockPool::instance();
+    {
+        auto segment = AudioSegment::copyOf(ramp(AudioBlockPool::BLOCK_SAMPLES * 3));
+        EXPECT_EQ(segment.chunks().size(), 3u);
+    }
+    size_t pooled = pool.getPooledBlocks();
+    EXPECT_GE(pooled, 3u);
+
+    auto reused = AudioSegment::copyOf(ramp(AudioBlockPool::BLOCK_SAMPLES));
+    EXPECT_EQ(pool.getPooledBlocks(), pooled - 1);
+}
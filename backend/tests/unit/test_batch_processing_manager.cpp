@@ -0,0 +1,357 @@
+#include <gtest/gtest.h>
+#include "stt/advanced/batch_processing_manager.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace stt;
+using namespace stt::advanced;
+
+namespace {
+
+void writeWav(const std::string& path, const std::vector<float>& interleaved, int sampleRate, int channels) {
+    std::ofstream out(path, std::ios::binary);
+    auto write32 = [&](uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); };
+    auto write16 = [&](uint16_t v) { out.write(reinterpret_cast<const char*>(&v), 2); };
+
+    uint32_t dataBytes = static_cast<uint32_t>(interleaved.size() * 2);
+    out.write("RIFF", 4);
+    write32(36 + dataBytes);
+    out.write("WAVE", 4);
+    out.write("fmt ", 4);
+    write32(16);
+    write16(1);
+    write16(static_cast<uint16_t>(channels));
+    write32(static_cast<uint32_t>(sampleRate));
+    write32(static_cast<uint32_t>(sampleRate * channels * 2));
+    write16(static_cast<uint16_t>(channels * 2));
+    write16(16);
+    out.write("data", 4);
+    write32(dataBytes);
+    for (float sample : interleaved) {
+        auto value = static_cast<int16_t>(std::lround(sample * 32767.0f));
+        write16(static_cast<uint16_t>(value));
+    }
+}
+
+// Alternating tone and silence, each span given in seconds
+std::vector<float> toneBursts(const std::vector<std::pair<float, bool>>& spans, int sampleRate) {
+    std::vector<float> samples;
+    for (const auto& span : spans) {
+        size_t count = static_cast<size_t>(span.first * sampleRate);
+        for (size_t i = 0; i < count; ++i) {
+            samples.push_back(span.second ? 0.3f * std::sin(2.0f * static_cast<float>(M_PI) * 220.0f * i / sampleRate)
+                                          : 0.0005f * ((i % 7) / 7.0f - 0.5f));
+        }
+    }
+    return samples;
+}
+
+// Reports one result per segment and counts decodes; optionally fails one segment
+class FakeSegmentTranscriber : public SegmentTranscriber {
+public:
+    explicit FakeSegmentTranscriber(size_t slots, int64_t failAtMs = -1) : slots_(slots), failAtMs_(failAtMs) {}
+
+    size_t getSlotCount() const override { return slots_; }
+
+    bool transcribeSegment(size_t, const std::vector<float>& audio, const std::string&, bool,
+                           std::vector<TranscriptionResult>& results) override {
+        decodes++;
+        TranscriptionResult result;
+        result.start_time_ms = 0;
+        result.end_time_ms = static_cast<int64_t>(audio.size() / 16);
+        result.confidence = 0.9f;
+        result.text = " words " + std::to_string(audio.size() / 1600);
+        if (failAtMs_ >= 0 && failNext_.exchange(false)) {
+            return false;
+        }
+        results.push_back(result);
+        return true;
+    }
+
+    void failOnce() { failNext_ = true; }
+
+    std::atomic<int> decodes{0};
+
+private:
+    size_t slots_;
+    int64_t failAtMs_;
+    std::atomic<bool> failNext_{false};
+};
+
+} // namespace
+
+class BatchProcessingManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = std::filesystem::temp_directory_path() /
+               ("batch_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(dir_);
+        std::filesystem::create_directories(dir_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir_);
+    }
+
+    std::string path(const std::string& name) const { return (dir_ / name).string(); }
+
+    BatchProcessingConfig makeConfig() const {
+        BatchProcessingConfig config;
+        config.maxConcurrentJobs = 1;
+        config.setStringParameter("outputDirectory", path("out"));
+        return config;
+    }
+
+    std::filesystem::path dir_;
+};
+
+TEST_F(BatchProcessingManagerTest, MappedFileDownmixesStereo) {
+    writeWav(path("stereo.wav"), {0.5f, -0.5f, 0.25f, 0.25f}, 8000, 2);
+
+    MappedAudioFile file;
+    ASSERT_TRUE(file.open(path("stereo.wav")));
+    EXPECT_EQ(file.getSampleRate(), 8000);
+    EXPECT_EQ(file.getChannels(), 2);
+    EXPECT_EQ(file.getFrameCount(), 2u);
+
+    std::vector<float> mono;
+    file.readMono(0, 10, mono);
+    ASSERT_EQ(mono.size(), 2u);
+    EXPECT_NEAR(mono[0], 0.0f, 1e-3f);
+    EXPECT_NEAR(mono[1], 0.25f, 1e-3f);
+
+    std::vector<float> resampled;
+    file.readMonoResampled(0, 2, 16000, resampled);
+    EXPECT_EQ(resampled.size(), 4u);
+}
+
+TEST_F(BatchProcessingManagerTest, MappedFileRejectsNonWav) {
+    std::ofstream(path("bogus.wav")) << "definitely not audio";
+
+    MappedAudioFile file;
+    EXPECT_FALSE(file.open(path("bogus.wav")));
+    EXPECT_FALSE(file.getLastError().empty());
+    EXPECT_FALSE(file.open(path("missing.wav")));
+}
+
+TEST_F(BatchProcessingManagerTest, SegmenterSplitsAtSilence) {
+    writeWav(path("bursts.wav"), toneBursts({{0.5f, false}, {1.0f, true}, {1.5f, false}, {1.0f, true}, {0.5f, false}}, 16000),
+             16000, 1);
+
+    MappedAudioFile file;
+    ASSERT_TRUE(file.open(path("bursts.wav")));
+    auto segments = VadSegmenter().segment(file);
+
+    ASSERT_EQ(segments.size(), 2u);
+    // Speech at 0.5-1.5 s and 3.0-4.0 s, padded by 200 ms
+    EXPECT_NEAR(segments[0].startFrame / 16000.0, 0.3, 0.05);
+    EXPECT_NEAR(segments[0].endFrame / 16000.0, 1.7, 0.05);
+    EXPECT_NEAR(segments[1].startFrame / 16000.0, 2.8, 0.05);
+    EXPECT_NEAR(segments[1].endFrame / 16000.0, 4.2, 0.05);
+}
+
+TEST_F(BatchProcessingManagerTest, SegmenterCapsSegmentLength) {
+    VadSegmenter::Config config;
+    config.maxSegmentSeconds = 10.0f;
+    VadSegmenter segmenter(config);
+
+    // 35 s of uninterrupted speech energy
+    std::vector<float> energies(35000 / 30, -20.0f);
+    auto segments = segmenter.segmentEnergies(energies, 480, energies.size() * 480);
+
+    ASSERT_GE(segments.size(), 4u);
+    for (size_t i = 0; i < segments.size(); ++i) {
+        EXPECT_LE(segments[i].endFrame - segments[i].startFrame, 10u * 16000u);
+        if (i > 0) {
+            EXPECT_EQ(segments[i].startFrame, segments[i - 1].endFrame);
+        }
+    }
+    EXPECT_EQ(segments.back().endFrame, energies.size() * 480);
+}
+
+TEST_F(BatchProcessingManagerTest, FormatsSrtAndVtt) {
+    TranscriptOutputFormatter formatter;
+    ASSERT_TRUE(formatter.initialize());
+
+    TranscriptionResult first;
+    first.text = " Hello there.";
+    first.start_time_ms = 1500;
+    first.end_time_ms = 3250;
+    TranscriptionResult silent;
+    silent.text = "  ";
+    TranscriptionResult second;
+    second.text = "General Kenobi";
+    second.start_time_ms = 3723004;
+    second.end_time_ms = 3725000;
+
+    std::string srt = formatter.formatSegments({first, silent, second}, "srt");
+    EXPECT_EQ(srt,
+              "1\n00:00:01,500 --> 00:00:03,250\nHello there.\n\n"
+              "2\n01:02:03,004 --> 01:02:05,000\nGeneral Kenobi\n\n");
+
+    std::string vtt = formatter.formatSegments({first}, "vtt");
+    EXPECT_EQ(vtt, "WEBVTT\n\n00:00:01.500 --> 00:00:03.250\nHello there.\n\n");
+
+    std::string json = formatter.formatSegments({first, second}, "json");
+    EXPECT_NE(json.find("\"text\":\"Hello there. General Kenobi\""), std::string::npos);
+}
+
+TEST_F(BatchProcessingManagerTest, CheckpointRoundTrip) {
+    AudioSegment segment;
+    segment.startFrame = 100;
+    segment.endFrame = 900;
+
+    TranscriptionResult result;
+    result.start_time_ms = 10;
+    result.end_time_ms = 50;
+    result.confidence = 0.5f;
+    result.text = "tab\there\nnewline \\ slash";
+
+    {
+        BatchCheckpoint checkpoint;
+        ASSERT_TRUE(checkpoint.open(path("job.checkpoint")));
+        ASSERT_TRUE(checkpoint.recordSegment("a.wav", 3, segment, {result}));
+        ASSERT_TRUE(checkpoint.recordSegment("a.wav", 4, segment, {}));
+        ASSERT_TRUE(checkpoint.recordFileComplete("b.wav", "out/b.srt"));
+    }
+    // Simulate a crash in the middle of a record
+    std::ofstream(path("job.checkpoint"), std::ios::app) << "S\ta.wav\t5\t1\t";
+
+    BatchCheckpoint reloaded;
+    ASSERT_TRUE(reloaded.open(path("job.checkpoint")));
+    EXPECT_TRUE(reloaded.isFileComplete("b.wav"));
+    EXPECT_FALSE(reloaded.isFileComplete("a.wav"));
+    EXPECT_EQ(reloaded.getOutputFile("b.wav"), "out/b.srt");
+
+    const auto* record = reloaded.findSegment("a.wav", 3);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->startFrame, 100u);
+    EXPECT_EQ(record->endFrame, 900u);
+    ASSERT_EQ(record->results.size(), 1u);
+    EXPECT_EQ(record->results[0].text, result.text);
+    EXPECT_EQ(record->results[0].end_time_ms, 50);
+
+    const auto* empty = reloaded.findSegment("a.wav", 4);
+    ASSERT_NE(empty, nullptr);
+    EXPECT_TRUE(empty->results.empty());
+    EXPECT_EQ(reloaded.findSegment("a.wav", 5), nullptr);
+}
+
+TEST_F(BatchProcessingManagerTest, TranscribesFilesInSegmentOrder) {
+    writeWav(path("talk.wav"),
+             toneBursts({{0.4f, true}, {1.0f, false}, {1.0f, true}, {1.0f, false}, {2.0f, true}, {1.0f, false}, {0.5f, true}}, 16000),
+             16000, 1);
+
+    auto transcriber = std::make_shared<FakeSegmentTranscriber>(4);
+    BatchProcessingManager manager(transcriber);
+    ASSERT_TRUE(manager.initialize(makeConfig()));
+
+    BatchJobRequest request;
+    request.inputFiles = {path("talk.wav")};
+    request.config.outputFormat = "srt";
+    std::atomic<int> fileCallbacks{0};
+    request.fileCompletionCallback = [&](const FileProcessingResult& result) {
+        EXPECT_TRUE(result.success);
+        fileCallbacks++;
+    };
+
+    uint32_t jobId = manager.submitBatchJob(request);
+    ASSERT_NE(jobId, 0u);
+    ASSERT_TRUE(manager.waitForJob(jobId, std::chrono::seconds(10)));
+
+    BatchJobResult result = manager.getJobResult(jobId);
+    EXPECT_EQ(result.finalStatus, BatchJobStatus::COMPLETED);
+    EXPECT_EQ(result.successfulFiles, 1u);
+    ASSERT_EQ(result.outputFiles.size(), 1u);
+    EXPECT_EQ(fileCallbacks.load(), 1);
+    EXPECT_EQ(transcriber->decodes.load(), 4);
+
+    std::ifstream in(result.outputFiles[0]);
+    std::string srt((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    size_t cue1 = srt.find("1\n00:00:00,000");
+    size_t cue2 = srt.find("2\n00:00:01,2");
+    size_t cue3 = srt.find("3\n00:00:03,2");
+    size_t cue4 = srt.find("4\n00:00:06,2");
+    EXPECT_NE(cue1, std::string::npos);
+    EXPECT_LT(cue1, cue2);
+    EXPECT_LT(cue2, cue3);
+    EXPECT_LT(cue3, cue4);
+    EXPECT_NE(cue4, std::string::npos);
+
+    // Successful jobs clean up their checkpoint
+    EXPECT_FALSE(std::filesystem::exists(BatchProcessingManager::getCheckpointPath(request, path("out"))));
+    EXPECT_NE(manager.getProcessingStats().find("\"segmentsTranscribed\":4"), std::string::npos);
+}
+
+TEST_F(BatchProcessingManagerTest, ResumesFromCheckpoint) {
+    writeWav(path("talk.wav"),
+             toneBursts({{1.0f, true}, {1.0f, false}, {1.0f, true}, {1.0f, false}, {1.0f, true}}, 16000),
+             16000, 1);
+
+    BatchJobRequest request;
+    request.jobName = "nightly";
+    request.inputFiles = {path("talk.wav")};
+    request.config.outputFormat = "json";
+
+    {
+        // First run loses one segment, leaving the file unfinished
+        auto transcriber = std::make_shared<FakeSegmentTranscriber>(1, 0);
+        transcriber->failOnce();
+        BatchProcessingManager manager(transcriber);
+        auto config = makeConfig();
+        config.enableParallelProcessing = false;
+        ASSERT_TRUE(manager.initialize(config));
+
+        uint32_t jobId = manager.submitBatchJob(request);
+        ASSERT_TRUE(manager.waitForJob(jobId, std::chrono::seconds(10)));
+        EXPECT_EQ(manager.getJobResult(jobId).finalStatus, BatchJobStatus::FAILED);
+        EXPECT_EQ(transcriber->decodes.load(), 3);
+    }
+    ASSERT_TRUE(std::filesystem::exists(BatchProcessingManager::getCheckpointPath(request, path("out"))));
+
+    auto transcriber = std::make_shared<FakeSegmentTranscriber>(2);
+    BatchProcessingManager manager(transcriber);
+    ASSERT_TRUE(manager.initialize(makeConfig()));
+
+    uint32_t jobId = manager.submitBatchJob(request);
+    ASSERT_TRUE(manager.waitForJob(jobId, std::chrono::seconds(10)));
+    EXPECT_EQ(manager.getJobResult(jobId).finalStatus, BatchJobStatus::COMPLETED);
+    // Only the segment that failed is decoded again
+    EXPECT_EQ(transcriber->decodes.load(), 1);
+    EXPECT_NE(manager.getProcessingStats().find("\"segmentsResumed\":2"), std::string::npos);
+}
+
+TEST_F(BatchProcessingManagerTest, CancelsQueuedJob) {
+    writeWav(path("talk.wav"), toneBursts({{1.0f, true}}, 16000), 16000, 1);
+
+    auto transcriber = std::make_shared<FakeSegmentTranscriber>(1);
+    BatchProcessingManager manager(transcriber);
+    ASSERT_TRUE(manager.initialize(makeConfig()));
+
+    BatchJobRequest request;
+    request.inputFiles = {path("talk.wav")};
+    uint32_t first = manager.submitBatchJob(request);
+    ASSERT_TRUE(manager.pauseBatchJob(first));
+    uint32_t second = manager.submitBatchJob(request);
+
+    EXPECT_TRUE(manager.cancelBatchJob(second));
+    EXPECT_EQ(manager.getJobProgress(second).status, BatchJobStatus::CANCELLED);
+
+    ASSERT_TRUE(manager.resumeBatchJob(first));
+    ASSERT_TRUE(manager.waitForJob(first, std::chrono::seconds(10)));
+    EXPECT_EQ(manager.getJobResult(first).finalStatus, BatchJobStatus::COMPLETED);
+}
+
+TEST_F(BatchProcessingManagerTest, RejectsJobsWithoutInput) {
+    BatchProcessingManager uninitialized;
+    EXPECT_FALSE(uninitialized.initialize(BatchProcessingConfig()));
+
+    BatchProcessingManager manager(std::make_shared<FakeSegmentTranscriber>(1));
+    ASSERT_TRUE(manager.initialize(makeConfig()));
+    EXPECT_EQ(manager.submitBatchJob(BatchJobRequest()), 0u);
+    EXPECT_FALSE(manager.getLastError().empty());
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include "audio/dsp_graph.hpp"
+#include "audio/audio_preprocessor.hpp"
+#include <cmath>
+#include <random>
+
+using namespace audio;
+
+namespace {
+
+std::vector<float> makeSpeechLike(size_t count, int sampleRate, float amplitude = 0.3f) {
+    std::mt19937 gen(7);
+    std::normal_distribution<float> noise(0.0f, 0.01f);
+    std::vector<float> samples(count);
+    for (size_t i = 0; i < count; ++i) {
+        float t = static_cast<float>(i) / sampleRate;
+        samples[i] = amplitude * (std::sin(2.0f * static_cast<float>(M_PI) * 180.0f * t) +
+                                  0.4f * std::sin(2.0f * static_cast<float>(M_PI) * 6000.0f * t)) +
+                     noise(gen);
+    }
+    return samples;
+}
+
+// Records the block sizes it is handed
+class ProbeNode : public DspNode {
+public:
+    explicit ProbeNode(size_t quantum = 1) : quantum_(quantum) {}
+    const char* getName() const override { return "probe"; }
+    size_t getBlockQuantum() const override { return quantum_; }
+    void prepare(int, size_t blockSize) override { preparedBlockSize = blockSize; }
+    void process(SampleSpan block) override { blockSizes.push_back(block.size()); }
+    void reset() override { resets++; }
+
+    size_t preparedBlockSize = 0;
+    std::vector<size_t> blockSizes;
+    int resets = 0;
+
+private:
+    size_t quantum_;
+};
+
+} // namespace
+
+TEST(DspGraphTest, SubspanClampsToEnd) {
+    std::vector<float> samples(10, 1.0f);
+    SampleSpan span(samples);
+
+    EXPECT_EQ(span.subspan(4, 3).size(), 3u);
+    EXPECT_EQ(span.subspan(8, 5).size(), 2u);
+    EXPECT_TRUE(span.subspan(10, 1).empty());
+
+    span.subspan(2, 2)[1] = 5.0f;
+    EXPECT_FLOAT_EQ(samples[3], 5.0f);
+}
+
+TEST(DspGraphTest, NegotiatesBlockSizeOnce) {
+    DspGraph graph;
+    auto* first = static_cast<ProbeNode*>(graph.addNode(std::make_unique<ProbeNode>(4)));
+    auto* second = static_cast<ProbeNode*>(graph.addNode(std::make_unique<ProbeNode>(6)));
+
+    EXPECT_EQ(graph.prepare(16000, 320), 324u);
+    EXPECT_EQ(first->preparedBlockSize, 324u);
+    EXPECT_EQ(second->preparedBlockSize, 324u);
+
+    std::vector<float> samples(700);
+    graph.process(samples);
+    EXPECT_EQ(first->blockSizes, (std::vector<size_t>{324, 324, 52}));
+    EXPECT_EQ(graph.getBlocksProcessed(), 3u);
+
+    second->setBypassed(true);
+    graph.process(samples);
+    EXPECT_EQ(second->blockSizes.size(), 3u);
+    EXPECT_EQ(first->blockSizes.size(), 6u);
+
+    EXPECT_EQ(graph.findNode("probe"), first);
+    graph.reset();
+    EXPECT_EQ(first->resets, 1);
+}
+
+TEST(DspGraphTest, FusedDynamicsMatchesChainedNodes) {
+    const int sampleRate = 16000;
+    auto input = makeSpeechLike(sampleRate, sampleRate, 0.6f);
+
+    FusedDynamicsNode::Config config;
+    config.enableDeEsser = true;
+    config.enableLimiter = true;
+
+    DspGraph chained;
+    chained.addNode(std::make_unique<AutomaticGainNode>(config.targetRMS));
+    chained.addNode(std::make_unique<CompressorNode>(config.compressionRatio, config.compressionThreshold,
+                                                     config.attackSeconds, config.releaseSeconds));
+    chained.addNode(std::make_unique<DeEsserNode>());
+    chained.addNode(std::make_unique<LimiterNode>(config.limiterThreshold));
+    chained.prepare(sampleRate, 320);
+
+    DspGraph fused;
+    fused.addNode(std::make_unique<FusedDynamicsNode>(config));
+    fused.prepare(sampleRate, 320);
+
+    std::vector<float> a = input;
+    std::vector<float> b = input;
+    chained.process(a);
+    fused.process(b);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        ASSERT_NEAR(a[i], b[i], 1e-6f) << "sample " << i;
+    }
+    for (float sample : b) {
+        EXPECT_LE(std::abs(sample), config.limiterThreshold);
+    }
+}
+
+TEST(DspGraphTest, AgcConvergesTowardsTarget) {
+    DspGraph graph;
+    auto* agc = static_cast<AutomaticGainNode*>(graph.addNode(std::make_unique<AutomaticGainNode>(0.1f)));
+    graph.prepare(16000, 320);
+
+    auto quiet = makeSpeechLike(16000 * 3, 16000, 0.02f);
+    graph.process(quiet);
+
+    EXPECT_GT(agc->getCurrentGain(), 3.0f);
+    float sum = 0.0f;
+    for (size_t i = quiet.size() - 1600; i < quiet.size(); ++i) {
+        sum += quiet[i] * quiet[i];
+    }
+    EXPECT_NEAR(std::sqrt(sum / 1600), 0.1f, 0.03f);
+}
+
+TEST(DspGraphTest, SpectralSubtractionIsTransparentWithoutNoiseProfile) {
+    DspGraph graph;
+    graph.addNode(std::make_unique<SpectralSubtractionNode>(512));
+    graph.prepare(16000, 160);
+    ASSERT_EQ(graph.getLatencySamples(), 512u);
+
+    auto input = makeSpeechLike(8000, 16000);
+    std::vector<float> output = input;
+    graph.process(output);
+
+    // Periodic Hann at 50% overlap reconstructs exactly, delayed by one frame
+    for (size_t i = 1024; i < output.size(); ++i) {
+        ASSERT_NEAR(output[i], input[i - 512], 1e-4f) << "sample " << i;
+    }
+}
+
+TEST(DspGraphTest, SpectralSubtractionRemovesStationaryNoise) {
+    std::mt19937 gen(3);
+    std::normal_distribution<float> noise(0.0f, 0.05f);
+    std::vector<float> noiseOnly(16000);
+    for (float& sample : noiseOnly) sample = noise(gen);
+
+    SpectralSubtractionNode node(512, 2.0f, 0.01f);
+    node.prepare(16000, 512);
+    for (size_t offset = 0; offset + 512 <= noiseOnly.size(); offset += 256) {
+        node.updateNoiseProfile(SampleSpan(noiseOnly).subspan(offset, 512));
+    }
+
+    std::vector<float> moreNoise(16000);
+    for (float& sample : moreNoise) sample = noise(gen);
+    float before = 0.0f;
+    for (float sample : moreNoise) before += sample * sample;
+
+    node.process(moreNoise);
+    float after = 0.0f;
+    for (float sample : moreNoise) after += sample * sample;
+
+    EXPECT_LT(after, before * 0.25f);
+}
+
+TEST(DspGraphTest, NlmsCancelsDelayedCopy) {
+    DspGraph graph;
+    graph.addNode(std::make_unique<EchoCancellerNode>(EchoCancellerNode::Mode::NLMS, 64, 0.5f));
+    graph.prepare(16000, 256);
+
+    // Signal with a strong echo 20 samples later; the predictable part is removed
+    std::mt19937 gen(11);
+    std::normal_distribution<float> source(0.0f, 0.1f);
+    std::vector<float> dry(32000);
+    for (float& sample : dry) sample = source(gen);
+    std::vector<float> wet(dry.size());
+    for (size_t i = 0; i < dry.size(); ++i) {
+        wet[i] = dry[i] + (i >= 20 ? 0.6f * dry[i - 20] : 0.0f);
+    }
+
+    std::vector<float> processed = wet;
+    graph.process(processed);
+
+    float wetEnergy = 0.0f, residual = 0.0f;
+    for (size_t i = 24000; i < wet.size(); ++i) {
+        wetEnergy += wet[i] * wet[i];
+        residual += processed[i] * processed[i];
+    }
+    EXPECT_LT(residual, wetEnergy * 0.9f);
+}
+
+TEST(DspGraphTest, PreprocessorInPlaceMatchesCopyingPath) {
+    AudioPreprocessingConfig config;
+    config.enableAdaptiveProcessing = false;
+    config.enableQualityAnalysis = false;
+    config.noiseReduction.enableSpectralSubtraction = false;
+
+    AudioPreprocessor copying(config, 16000);
+    AudioPreprocessor inPlace(config, 16000);
+    EXPECT_EQ(inPlace.getDspGraph().getNodeCount(), 2u);
+
+    auto input = makeSpeechLike(16000, 16000, 0.05f);
+    for (size_t offset = 0; offset < input.size(); offset += 320) {
+        std::vector<float> chunk(input.begin() + offset, input.begin() + offset + 320);
+        std::vector<float> expected = copying.preprocessRealTimeChunk(chunk);
+        inPlace.preprocessRealTimeChunkInPlace(chunk);
+        ASSERT_EQ(expected, chunk);
+    }
+
+    EXPECT_EQ(inPlace.getStatistics().totalSamplesProcessed, input.size());
+}
+
+TEST(DspGraphTest, PreprocessorKeepsStateAcrossParameterChanges) {
+    AudioPreprocessingConfig config;
+    config.enableAdaptiveProcessing = false;
+    config.enableQualityAnalysis = false;
+    AudioPreprocessor preprocessor(config, 16000);
+    EXPECT_EQ(preprocessor.getProcessingLatencySamples(), 512u);
+
+    const DspNode* before = preprocessor.getDspGraph().findNode("dynamics");
+    config.volumeNormalization.targetRMS = 0.2f;
+    preprocessor.setConfig(config);
+    EXPECT_EQ(preprocessor.getDspGraph().findNode("dynamics"), before);
+
+    config.enableNoiseReduction = false;
+    config.enableEchoCancellation = true;
+    preprocessor.setConfig(config);
+    EXPECT_EQ(preprocessor.getDspGraph().findNode("spectral_subtraction"), nullptr);
+    EXPECT_NE(preprocessor.getDspGraph().findNode("echo_canceller"), nullptr);
+    EXPECT_EQ(preprocessor.getProcessingLatencySamples(), 0u);
+}
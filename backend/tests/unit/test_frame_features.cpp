@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "audio/frame_features.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace audio;
+
+namespace {
+
+std::vector<float> sine(float frequency, size_t samples, int sampleRate = 16000, float amplitude = 0.5f) {
+    std::vector<float> audio(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        audio[i] = amplitude * std::sin(2.0f * 3.14159265f * frequency * i / sampleRate);
+    }
+    return audio;
+}
+
+size_t computations(const std::array<uint64_t, FRAME_FEATURE_COUNT>& counts, FrameFeature feature) {
+    size_t index = 0;
+    for (uint32_t bits = static_cast<uint32_t>(feature); bits > 1; bits >>= 1) ++index;
+    return counts[index];
+}
+
+size_t computations(const FrameFeatureBus::Stats& stats, FrameFeature feature) {
+    return computations(stats.computations, feature);
+}
+
+} // namespace
+
+TEST(FrameFeaturesTest, TimeDomainFeatures) {
+    FrameFeatureBus bus;
+    auto audio = sine(1000.0f, 512);
+    auto frame = bus.analyze(audio);
+
+    EXPECT_NEAR(frame.rms(), 0.5f / std::sqrt(2.0f), 0.01f);
+    EXPECT_NEAR(frame.peak(), 0.5f, 0.01f);
+    // Two crossings per period, 16 samples per period
+    EXPECT_NEAR(frame.zeroCrossingRate(), 2.0f / 16.0f, 0.01f);
+}
+
+TEST(FrameFeaturesTest, SpectrumPeaksAtToneFrequency) {
+    FrameFeatureBus bus;
+    auto frame = bus.analyze(sine(1000.0f, 512));
+
+    const auto& magnitude = frame.magnitudeSpectrum();
+    ASSERT_EQ(magnitude.size(), 257u);
+    size_t peak = std::max_element(magnitude.begin(), magnitude.end()) - magnitude.begin();
+    EXPECT_NEAR(frame.binFrequency(peak), 1000.0f, 16000.0f / 512);
+    EXPECT_NEAR(frame.spectralCentroid(), 1000.0f, 150.0f);
+    EXPECT_LT(frame.spectralFlatness(), 0.2f);
+
+    EXPECT_EQ(frame.mfcc().size(), 13u);
+    EXPECT_EQ(frame.melEnergies().size(), 26u);
+}
+
+TEST(FrameFeaturesTest, FeaturesAreComputedOnce) {
+    FrameFeatureBus bus;
+    auto frame = bus.analyze(sine(440.0f, 512));
+
+    frame.spectralCentroid();
+    frame.spectralBandwidth();
+    frame.mfcc();
+    frame.spectralCentroid();
+
+    EXPECT_EQ(computations(frame.getComputationCounts(), FrameFeature::MAGNITUDE_SPECTRUM), 1u);
+    EXPECT_EQ(computations(frame.getComputationCounts(), FrameFeature::SPECTRAL_CENTROID), 1u);
+    EXPECT_TRUE(hasFeature(frame.computed(), FrameFeature::POWER_SPECTRUM));
+    EXPECT_FALSE(hasFeature(frame.computed(), FrameFeature::ZERO_CROSSING_RATE));
+}
+
+TEST(FrameFeatureBusTest, FramesPushedAudioAtHop) {
+    FrameAnalysisConfig config;
+    config.frameSize = 256;
+    config.hopSize = 128;
+    FrameFeatureBus bus(config);
+
+    std::vector<uint64_t> indices;
+    bus.subscribe(static_cast<FrameFeatureSet>(FrameFeature::RMS),
+                  [&](FrameFeatures& frame) { indices.push_back(frame.index()); });
+
+    auto audio = sine(500.0f, 1000);
+    // Uneven chunks must frame the same as one push
+    EXPECT_EQ(bus.push(audio.data(), 100), 0u);
+    bus.push(audio.data() + 100, 300);
+    bus.push(audio.data() + 400, 600);
+
+    // Frames start at 0, 128, ..., 640 (the last one ending at 896)
+    ASSERT_EQ(indices.size(), 6u);
+    EXPECT_EQ(indices.front(), 0u);
+    EXPECT_EQ(indices.back(), 5u);
+    EXPECT_EQ(bus.getStats().frames, 6u);
+}
+
+TEST(FrameFeatureBusTest, SubscribersShareOneComputationPerFrame) {
+    FrameFeatureBus bus;
+    float centroidSeen = 0.0f, centroidAgain = 0.0f;
+    size_t mfccSize = 0;
+
+    bus.subscribe(FrameFeature::RMS | FrameFeature::SPECTRAL_CENTROID,
+                  [&](FrameFeatures& frame) { centroidSeen = frame.spectralCentroid(); });
+    bus.subscribe(FrameFeature::SPECTRAL_CENTROID | FrameFeature::MFCC,
+                  [&](FrameFeatures& frame) {
+                      centroidAgain = frame.spectralCentroid();
+                      mfccSize = frame.mfcc().size();
+                  });
+    // Reads a feature nobody declared: computed lazily, once
+    bus.subscribe(0, [&](FrameFeatures& frame) { frame.zeroCrossingRate(); frame.zeroCrossingRate(); });
+
+    auto audio = sine(800.0f, 512 * 4);
+    EXPECT_EQ(bus.push(audio), 4u);
+
+    auto stats = bus.getStats();
+    EXPECT_EQ(stats.frames, 4u);
+    EXPECT_EQ(computations(stats, FrameFeature::MAGNITUDE_SPECTRUM), 4u);
+    EXPECT_EQ(computations(stats, FrameFeature::SPECTRAL_CENTROID), 4u);
+    EXPECT_EQ(computations(stats, FrameFeature::MFCC), 4u);
+    EXPECT_EQ(computations(stats, FrameFeature::ZERO_CROSSING_RATE), 4u);
+    EXPECT_EQ(computations(stats, FrameFeature::PEAK), 0u);
+    EXPECT_FLOAT_EQ(centroidSeen, centroidAgain);
+    EXPECT_EQ(mfccSize, 13u);
+}
+
+TEST(FrameFeatureBusTest, UnsubscribeNarrowsDeclaredFeatures) {
+    FrameFeatureBus bus;
+    auto rms = bus.subscribe(static_cast<FrameFeatureSet>(FrameFeature::RMS), [](FrameFeatures&) {});
+    auto mfcc = bus.subscribe(static_cast<FrameFeatureSet>(FrameFeature::MFCC), [](FrameFeatures&) {});
+    EXPECT_EQ(bus.getDeclaredFeatures(), FrameFeature::RMS | FrameFeature::MFCC);
+
+    bus.unsubscribe(mfcc);
+    EXPECT_EQ(bus.getDeclaredFeatures(), static_cast<FrameFeatureSet>(FrameFeature::RMS));
+    EXPECT_EQ(bus.getSubscriberCount(), 1u);
+
+    // Only what is still declared gets computed
+    bus.push(sine(300.0f, 512));
+    auto stats = bus.getStats();
+    EXPECT_EQ(computations(stats, FrameFeature::RMS), 1u);
+    EXPECT_EQ(computations(stats, FrameFeature::MAGNITUDE_SPECTRUM), 0u);
+
+    bus.unsubscribe(rms);
+    EXPECT_EQ(bus.getDeclaredFeatures(), 0u);
+}
@@ -90,6 +90,9 @@ public:
         testStreamingTranslation();
         translator->cleanup();
         
+        testIncrementalStreamingTranslation();
+        translator->cleanup();
+        
         testTranslationCaching();
         translator->cleanup();
         
@@ -667,6 +670,42 @@ private:
         std::cout << "  ✓ Streaming translation working correctly" << std::endl;
     }
 
+    void testIncrementalStreamingTranslation() {
+        std::cout << "Testing incremental streaming translation..." << std::endl;
+        assert_true(translator->initialize("en", "es"), "Should initialize for incremental streaming test");
+        
+        const std::string sessionId = "incremental_session";
+        assert_true(translator->startStreamingTranslation(sessionId, "en", "es"), "Should start streaming session");
+        
+        // Words arrive one at a time, the last one unterminated until the next chunk
+        const std::vector<std::string> chunks = {
+            "good", " friend", " the", " house", " is", " big", " and", " the", " car", " small."
+        };
+        std::string emitted;
+        for (const auto& chunk : chunks) {
+            auto partial = translator->addStreamingText(sessionId, chunk, false);
+            assert_true(partial.success, "Incremental streaming text should succeed");
+            assert_true(partial.isPartialResult, "Should be partial result");
+            assert_true(partial.translatedText.compare(0, emitted.size(), emitted) == 0,
+                        "Committed translation should only ever be extended");
+            emitted = partial.translatedText;
+        }
+        
+        auto afterFirstWords = translator->addStreamingText(sessionId, " water", false);
+        assert_true(afterFirstWords.translatedText.compare(0, emitted.size(), emitted) == 0,
+                    "A new window should keep the closed sentence");
+        
+        auto finalResult = translator->finalizeStreamingTranslation(sessionId);
+        assert_true(finalResult.success, "Final result should succeed");
+        assert_true(finalResult.isStreamingComplete, "Final result should be complete");
+        assert_true(finalResult.translatedText.compare(0, emitted.size(), emitted) == 0,
+                    "Final translation should extend the streamed text");
+        assert_true(finalResult.translatedText.size() > emitted.size(), "Final translation should cover the open window");
+        assert_false(translator->hasStreamingSession(sessionId), "Session should be cleaned up");
+        
+        std::cout << "  ✓ Incremental streaming translation working correctly" << std::endl;
+    }
+    
     void testTranslationCaching() {
         std::cout << "Testing translation caching..." << std::endl;
         assert_true(translator->initialize("en", "es"), "Should initialize for caching test");
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "utils/metrics_registry.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace speechrnt::utils;
+
+TEST(MetricsRegistryTest, RegistrationReturnsTheSameSeries) {
+    MetricsRegistry registry;
+    Counter& first = registry.counter("requests", "Requests", {{"route", "a"}});
+    Counter& again = registry.counter("requests", "Requests", {{"route", "a"}});
+    Counter& other = registry.counter("requests", "Requests", {{"route", "b"}});
+    EXPECT_EQ(&first, &again);
+    EXPECT_NE(&first, &other);
+    EXPECT_THROW(registry.gauge("requests", "Requests"), std::logic_error);
+}
+
+TEST(MetricsRegistryTest, HistogramBucketsAreInclusiveUpperBounds) {
+    MetricsRegistry registry;
+    Histogram& histogram = registry.histogram("latency_seconds", "Latency", {0.1, 1.0});
+    histogram.observe(0.05);
+    histogram.observe(0.1);
+    histogram.observe(0.5);
+    histogram.observe(7.0);
+
+    EXPECT_EQ(histogram.bucketCount(0), 2u);
+    EXPECT_EQ(histogram.bucketCount(1), 1u);
+    EXPECT_EQ(histogram.bucketCount(2), 1u);
+    EXPECT_EQ(histogram.count(), 4u);
+    EXPECT_DOUBLE_EQ(histogram.sum(), 7.65);
+}
+
+TEST(MetricsRegistryTest, ExposesOpenMetricsText) {
+    MetricsRegistry registry;
+    registry.counter("speechrnt_cache_requests", "Cache lookups", {{"cache", "tm"}, {"result", "hit"}}).inc(3);
+    registry.gauge("speechrnt_queue_depth", "Queued items").set(2);
+    Histogram& histogram = registry.histogram("speechrnt_stage_seconds", "Stage \"latency\"",
+                                              {0.01, 0.1}, {{"stage", "vad"}});
+    histogram.observe(0.005);
+    histogram.observe(0.05);
+
+    std::string text = registry.exposeOpenMetrics();
+    EXPECT_NE(text.find("# TYPE speechrnt_cache_requests counter\n"), std::string::npos);
+    EXPECT_NE(text.find("speechrnt_cache_requests_total{cache=\"tm\",result=\"hit\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE speechrnt_queue_depth gauge\n"), std::string::npos);
+    EXPECT_NE(text.find("\nspeechrnt_queue_depth 2\n"), std::string::npos);
+    EXPECT_NE(text.find("# HELP speechrnt_stage_seconds Stage \\\"latency\\\"\n"), std::string::npos);
+    EXPECT_NE(text.find("speechrnt_stage_seconds_bucket{stage=\"vad\",le=\"0.01\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("speechrnt_stage_seconds_bucket{stage=\"vad\",le=\"0.1\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("speechrnt_stage_seconds_bucket{stage=\"vad\",le=\"+Inf\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("speechrnt_stage_seconds_count{stage=\"vad\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("speechrnt_stage_seconds_sum{stage=\"vad\"} 0.055\n"), std::string::npos);
+    ASSERT_GE(text.size(), 6u);
+    EXPECT_EQ(text.substr(text.size() - 6), "# EOF\n");
+}
+
+TEST(MetricsRegistryTest, ScrapesRunConcurrentlyWithRecordingAndRegistration) {
+    MetricsRegistry registry;
+    Histogram& shared = registry.histogram("shared_seconds", "Shared", MetricsRegistry::latencyBuckets());
+    constexpr int THREADS = 4;
+    constexpr int OBSERVATIONS = 20000;
+
+    std::atomic<bool> done{false};
+    std::thread scraper([&] {
+        std::string out;
+        while (!done.load()) {
+            registry.exposeOpenMetrics(out);
+            EXPECT_EQ(out.substr(out.size() - 6), "# EOF\n");
+        }
+    });
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&, t] {
+            Counter& own = registry.counter("per_model", "Per model", {{"model", std::to_string(t)}});
+            for (int i = 0; i < OBSERVATIONS; ++i) {
+                shared.observe(0.002);
+                own.inc();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    done = true;
+    scraper.join();
+
+    EXPECT_EQ(shared.count(), static_cast<uint64_t>(THREADS * OBSERVATIONS));
+    EXPECT_NEAR(shared.sum(), 0.002 * THREADS * OBSERVATIONS, 1e-6);
+    for (int t = 0; t < THREADS; ++t) {
+        EXPECT_EQ(registry.counter("per_model", "Per model", {{"model", std::to_string(t)}}).value(),
+                  static_cast<uint64_t>(OBSERVATIONS));
+    }
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "utils/mpsc_queue.hpp"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using speechrnt::utils::MpscQueue;
+
+TEST(MpscQueueTest, PopsInPushOrder) {
+    MpscQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+
+    int value = 0;
+    EXPECT_FALSE(queue.pop(value));
+
+    for (int i = 0; i < 5; ++i) {
+        queue.push(i);
+    }
+    EXPECT_FALSE(queue.empty());
+
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MpscQueueTest, MovesValuesAndFreesOnDestruction) {
+    auto tracked = std::make_shared<int>(7);
+    {
+        MpscQueue<std::shared_ptr<int>> queue;
+        queue.push(tracked);
+        queue.push(tracked);
+
+        std::shared_ptr<int> out;
+        ASSERT_TRUE(queue.pop(out));
+        EXPECT_EQ(*out, 7);
+        out.reset();
+        // One copy still queued
+        EXPECT_EQ(tracked.use_count(), 2);
+    }
+    EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(MpscQueueTest, ConcurrentProducersKeepPerProducerOrder) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+
+    MpscQueue<std::pair<int, int>> queue;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p]() {
+            while (!go) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                queue.push({p, i});
+            }
+        });
+    }
+
+    go = true;
+    std::vector<int> next(PRODUCERS, 0);
+    int received = 0;
+    std::pair<int, int> item;
+    while (received < PRODUCERS * PER_PRODUCER) {
+        if (!queue.pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(item.second, next[item.first]) << "producer " << item.first;
+        ++next[item.first];
+        ++received;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.empty());
+    for (int p = 0; p < PRODUCERS; ++p) {
+        EXPECT_EQ(next[p], PER_PRODUCER);
+    }
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "core/outbound_queue.hpp"
+#include <string>
+
+using namespace core;
+
+namespace {
+
+std::string transcript(int utteranceId, const std::string& text, bool partial) {
+    return "{\"data\":{\"isPartial\":" + std::string(partial ? "true" : "false") +
+           ",\"text\":\"" + text + "\",\"utteranceId\":" + std::to_string(utteranceId) +
+           "},\"type\":\"transcription_update\"}";
+}
+
+std::string translation(int utteranceId, const std::string& text, bool partial) {
+    return "{\"data\":{\"isPartial\":" + std::string(partial ? "true" : "false") +
+           ",\"originalText\":\"\",\"translatedText\":\"" + text +
+           "\",\"utteranceId\":" + std::to_string(utteranceId) +
+           "},\"type\":\"translation_result\"}";
+}
+
+OutboundQueue::Message message(const std::string& payload) {
+    return OutboundQueue::classify(payload, false);
+}
+
+std::string popPayload(OutboundQueue& queue) {
+    const auto* front = queue.front();
+    std::string payload = front ? front->payload : "";
+    queue.pop();
+    return payload;
+}
+
+} // namespace
+
+TEST(OutboundQueueTest, ClassifiesMessages) {
+    auto partial = message(transcript(7, "hel", true));
+    EXPECT_EQ(partial.priority, OutboundPriority::PARTIAL);
+    EXPECT_EQ(partial.utteranceId, 7);
+
+    auto final = message(transcript(7, "hello", false));
+    EXPECT_EQ(final.priority, OutboundPriority::HIGH);
+    EXPECT_EQ(final.utteranceId, 7);
+
+    // Pretty-printed JSON from the pipeline integration classifies the same way
+    auto pretty = message("{\n  \"type\": \"translation_result\",\n  \"utteranceId\": 7\n}");
+    EXPECT_EQ(pretty.priority, OutboundPriority::HIGH);
+    EXPECT_EQ(pretty.utteranceId, 7);
+    EXPECT_TRUE(pretty.translation);
+
+    auto partialTranslation = message(translation(7, "ho", true));
+    EXPECT_EQ(partialTranslation.priority, OutboundPriority::PARTIAL);
+    EXPECT_EQ(partialTranslation.utteranceId, 7);
+    EXPECT_TRUE(partialTranslation.translation);
+    EXPECT_FALSE(partial.translation);
+
+    auto audio = OutboundQueue::classify("\"isPartial\":true", true);
+    EXPECT_EQ(audio.priority, OutboundPriority::HIGH);
+}
+
+TEST(OutboundQueueTest, KeepsOnlyLatestPartialPerUtterance) {
+    OutboundQueue queue;
+    EXPECT_EQ(queue.push(message(transcript(1, "a", true))), OutboundQueue::PushResult::QUEUED);
+    EXPECT_EQ(queue.push(message(transcript(2, "x", true))), OutboundQueue::PushResult::QUEUED);
+    EXPECT_EQ(queue.push(message(transcript(1, "ab", true))), OutboundQueue::PushResult::COALESCED);
+    EXPECT_EQ(queue.push(message(transcript(1, "abc", true))), OutboundQueue::PushResult::COALESCED);
+
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(popPayload(queue), transcript(1, "abc", true));
+    EXPECT_EQ(popPayload(queue), transcript(2, "x", true));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.bytes(), 0u);
+    EXPECT_EQ(queue.counters()->snapshot().coalesced, 2u);
+}
+
+TEST(OutboundQueueTest, FinalsGoFirstAndSupersedePartials) {
+    OutboundQueue queue;
+    queue.push(message(transcript(1, "a", true)));
+    queue.push(message(transcript(2, "x", true)));
+    queue.push(message(transcript(1, "abc", false)));
+    queue.push(message("{\"type\":\"translation_result\"}"));
+
+    EXPECT_EQ(queue.size(), 3u);
+    EXPECT_EQ(popPayload(queue), transcript(1, "abc", false));
+    EXPECT_EQ(popPayload(queue), "{\"type\":\"translation_result\"}");
+    EXPECT_EQ(popPayload(queue), transcript(2, "x", true));
+    EXPECT_EQ(queue.front(), nullptr);
+}
+
+TEST(OutboundQueueTest, CoalescesPartialTranslationsApartFromTranscripts) {
+    OutboundQueue queue;
+    queue.push(message(transcript(1, "hel", true)));
+    queue.push(message(translation(1, "ho", true)));
+    EXPECT_EQ(queue.push(message(translation(1, "hol", true))), OutboundQueue::PushResult::COALESCED);
+    EXPECT_EQ(queue.push(message(translation(1, "hola", true))), OutboundQueue::PushResult::COALESCED);
+    EXPECT_EQ(queue.size(), 2u);
+
+    // The final transcript replaces its partial but not the translation
+    queue.push(message(transcript(1, "hello", false)));
+    EXPECT_EQ(queue.size(), 2u);
+
+    EXPECT_EQ(popPayload(queue), transcript(1, "hello", false));
+    EXPECT_EQ(popPayload(queue), translation(1, "hola", true));
+    EXPECT_TRUE(queue.empty());
+
+    // The final translation supersedes the pending partial one
+    queue.push(message(translation(2, "ad", true)));
+    queue.push(message(translation(2, "adios", false)));
+    EXPECT_EQ(queue.size(), 1u);
+    EXPECT_EQ(popPayload(queue), translation(2, "adios", false));
+    EXPECT_EQ(queue.counters()->snapshot().coalesced, 4u);
+}
+
+TEST(OutboundQueueTest, CapsEvictPartialsBeforeRefusing) {
+    OutboundQueueConfig config;
+    config.maxMessages = 3;
+    OutboundQueue queue(config);
+
+    queue.push(message(transcript(1, "a", true)));
+    queue.push(message(transcript(2, "b", true)));
+    queue.push(message("{\"type\":\"audio_start\"}"));
+    queue.push(OutboundQueue::classify(std::string(100, 'x'), true));
+
+    auto stats = queue.counters()->snapshot();
+    EXPECT_EQ(stats.droppedPartials, 1u);
+    EXPECT_EQ(stats.queuedMessages, 3u);
+
+    // The last partial makes room; after that high priority traffic is refused
+    EXPECT_EQ(queue.push(message("{\"type\":\"translation_result\"}")), OutboundQueue::PushResult::QUEUED);
+    EXPECT_EQ(queue.counters()->snapshot().droppedPartials, 2u);
+    EXPECT_EQ(queue.push(message("{\"type\":\"error\"}")), OutboundQueue::PushResult::OVERFLOW);
+
+    stats = queue.counters()->snapshot();
+    EXPECT_EQ(stats.dropped, 1u);
+    EXPECT_EQ(stats.queuedMessages, 3u);
+    EXPECT_EQ(stats.queuedBytes, queue.bytes());
+    EXPECT_EQ(popPayload(queue), "{\"type\":\"audio_start\"}");
+}
+
+TEST(OutboundQueueTest, ByteCapAndHighWaterMark) {
+    OutboundQueueConfig config;
+    config.maxBytes = 64;
+    config.socketHighWaterBytes = 1024;
+    OutboundQueue queue(config);
+
+    EXPECT_TRUE(queue.canWrite(0));
+    EXPECT_FALSE(queue.canWrite(1024));
+
+    EXPECT_EQ(queue.push(OutboundQueue::classify(std::string(60, 'a'), true)), OutboundQueue::PushResult::QUEUED);
+    EXPECT_EQ(queue.push(OutboundQueue::classify(std::string(10, 'b'), true)), OutboundQueue::PushResult::OVERFLOW);
+    EXPECT_EQ(queue.bytes(), 60u);
+
+    queue.pop();
+    queue.recordSent(512);
+    auto stats = queue.counters()->snapshot();
+    EXPECT_EQ(stats.sent, 1u);
+    EXPECT_EQ(stats.socketBufferedBytes, 512u);
+    EXPECT_EQ(stats.queuedBytes, 0u);
+}
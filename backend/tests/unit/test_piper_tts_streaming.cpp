@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "tts/piper_tts.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace speechrnt::tts;
+
+class PiperTTSStreamingTest : public ::testing::Test {};
+
+TEST_F(PiperTTSStreamingTest, SplitsOnSentenceTerminators) {
+    auto units = PiperTTS::splitIntoUnits("Hello there. How are you? I am fine!");
+
+    ASSERT_EQ(units.size(), 3u);
+    EXPECT_EQ(units[0], "Hello there.");
+    EXPECT_EQ(units[1], "How are you?");
+    EXPECT_EQ(units[2], "I am fine!");
+}
+
+TEST_F(PiperTTSStreamingTest, KeepsDecimalsAndShortClausesTogether) {
+    auto units = PiperTTS::splitIntoUnits("Yes, it costs 3.50 euros. Thanks");
+
+    ASSERT_EQ(units.size(), 2u);
+    EXPECT_EQ(units[0], "Yes, it costs 3.50 euros.");
+    EXPECT_EQ(units[1], "Thanks");
+}
+
+TEST_F(PiperTTSStreamingTest, BreaksLongSentencesAtClauses) {
+    auto units = PiperTTS::splitIntoUnits(
+        "When the train finally arrived at the station, everyone rushed to the doors at once.");
+
+    ASSERT_EQ(units.size(), 2u);
+    EXPECT_EQ(units[0], "When the train finally arrived at the station,");
+    EXPECT_EQ(units[1], "everyone rushed to the doors at once.");
+}
+
+TEST_F(PiperTTSStreamingTest, BreaksRunOnTextAtWordBoundary) {
+    std::string text;
+    for (int i = 0; i < 20; ++i) {
+        text += "word ";
+    }
+
+    auto units = PiperTTS::splitIntoUnits(text, 32);
+
+    ASSERT_GT(units.size(), 1u);
+    for (const auto& unit : units) {
+        EXPECT_LE(unit.size(), 32u);
+        EXPECT_NE(unit.back(), ' ');
+    }
+}
+
+TEST_F(PiperTTSStreamingTest, SplitsFullWidthTerminators) {
+    auto units = PiperTTS::splitIntoUnits("\xE4\xBD\xA0\xE5\xA5\xBD\xE3\x80\x82\xE8\xB0\xA2\xE8\xB0\xA2\xEF\xBC\x81");
+
+    ASSERT_EQ(units.size(), 2u);
+    EXPECT_EQ(units[0], "\xE4\xBD\xA0\xE5\xA5\xBD\xE3\x80\x82");
+    EXPECT_EQ(units[1], "\xE8\xB0\xA2\xE8\xB0\xA2\xEF\xBC\x81");
+}
+
+TEST_F(PiperTTSStreamingTest, EmptyTextHasNoUnits) {
+    EXPECT_TRUE(PiperTTS::splitIntoUnits("").empty());
+    EXPECT_TRUE(PiperTTS::splitIntoUnits("   ").empty());
+}
+
+TEST_F(PiperTTSStreamingTest, UninitializedEngineReportsErrorUnit) {
+    PiperTTS tts;
+    std::atomic<int> calls{0};
+    bool success = true;
+    bool last = false;
+
+    auto handle = tts.synthesizeStreaming("Hello.", [&](const SynthesisResult& unit, size_t, bool isLast) {
+        calls++;
+        success = unit.success;
+        last = isLast;
+    });
+
+    ASSERT_TRUE(handle);
+    EXPECT_TRUE(handle->wait(std::chrono::milliseconds(1000)));
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_FALSE(success);
+    EXPECT_TRUE(last);
+}
+
+TEST_F(PiperTTSStreamingTest, HandleTracksFirstAudioAndCancellation) {
+    StreamingSynthesis handle;
+    EXPECT_LT(handle.getTimeToFirstAudioMs(), 0.0);
+    EXPECT_FALSE(handle.wait(std::chrono::milliseconds(1)));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    handle.markUnitDelivered();
+    handle.markUnitDelivered();
+    EXPECT_GE(handle.getTimeToFirstAudioMs(), 5.0);
+    EXPECT_EQ(handle.getUnitsDelivered(), 2u);
+
+    handle.cancel();
+    EXPECT_TRUE(handle.isCancelled());
+
+    std::thread finisher([&]() { handle.markDone(); });
+    EXPECT_TRUE(handle.wait(std::chrono::milliseconds(1000)));
+    EXPECT_TRUE(handle.isDone());
+    finisher.join();
+}
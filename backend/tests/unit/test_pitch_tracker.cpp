@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "audio/pitch_tracker.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace audio;
+
+namespace {
+
+std::vector<float> tone(float frequency, size_t samples, int sampleRate = 16000) {
+    std::vector<float> audio(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        float phase = 2.0f * 3.14159265f * frequency * i / sampleRate;
+        // Harmonics make the fundamental's neighbours compete, as in speech
+        audio[i] = 0.4f * std::sin(phase) + 0.2f * std::sin(2.0f * phase) + 0.1f * std::sin(3.0f * phase);
+    }
+    return audio;
+}
+
+} // namespace
+
+TEST(PitchTrackerTest, TracksToneFrequency) {
+    for (float frequency : {95.0f, 180.0f, 260.0f, 440.0f}) {
+        PitchTracker tracker;
+        auto audio = tone(frequency, 16000);
+        auto estimate = tracker.analyze(audio.data(), 1024);
+        EXPECT_TRUE(estimate.voiced) << frequency;
+        EXPECT_NEAR(estimate.frequency, frequency, frequency * 0.01f);
+        EXPECT_GT(estimate.clarity, 0.9f);
+    }
+}
+
+TEST(PitchTrackerTest, SilenceAndNoiseAreUnvoiced) {
+    PitchTracker tracker;
+    std::vector<float> silence(1024, 0.0f);
+    EXPECT_FALSE(tracker.analyze(silence.data(), silence.size()).voiced);
+
+    std::mt19937 gen(3);
+    std::normal_distribution<float> noise(0.0f, 0.3f);
+    std::vector<float> hiss(1024);
+    for (float& sample : hiss) sample = noise(gen);
+    EXPECT_FALSE(tracker.analyze(hiss.data(), hiss.size()).voiced);
+}
+
+TEST(PitchTrackerTest, ChunkedPushMatchesSinglePush) {
+    auto audio = tone(200.0f, 8000);
+    PitchTracker whole;
+    std::vector<PitchEstimate> expected;
+    whole.push(audio, [&](const PitchEstimate& e) { expected.push_back(e); });
+
+    PitchTracker chunked;
+    std::vector<PitchEstimate> actual;
+    for (size_t i = 0; i < audio.size(); i += 160) {
+        size_t count = std::min<size_t>(160, audio.size() - i);
+        chunked.push(audio.data() + i, count, [&](const PitchEstimate& e) { actual.push_back(e); });
+    }
+
+    // Frames start every hop once the first window is full
+    ASSERT_EQ(expected.size(), (8000 - 1024) / 512 + 1);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].frameIndex, i);
+        EXPECT_FLOAT_EQ(actual[i].frequency, expected[i].frequency);
+    }
+    EXPECT_EQ(chunked.getContour().voicedFrames, expected.size());
+}
+
+TEST(PitchTrackerTest, MergedDeltasMatchWholeContour) {
+    // A glide from 150 to 250 Hz with a pause in the middle
+    std::vector<float> audio;
+    for (float frequency : {150.0f, 170.0f, 0.0f, 220.0f, 250.0f}) {
+        auto part = frequency > 0.0f ? tone(frequency, 4000) : std::vector<float>(4000, 0.0f);
+        audio.insert(audio.end(), part.begin(), part.end());
+    }
+
+    PitchTracker tracker;
+    PitchContour merged;
+    for (size_t i = 0; i < audio.size(); i += 1000) {
+        PitchContour delta;
+        tracker.push(audio.data() + i, 1000, [&](const PitchEstimate& e) { delta.add(e); });
+        merged.merge(delta);
+    }
+
+    const auto& whole = tracker.getContour();
+    EXPECT_EQ(merged.frames, whole.frames);
+    EXPECT_EQ(merged.voicedFrames, whole.voicedFrames);
+    EXPECT_NEAR(merged.mean, whole.mean, 1e-3);
+    EXPECT_NEAR(merged.stdDev(), whole.stdDev(), 1e-3f);
+    EXPECT_FLOAT_EQ(merged.range(), whole.range());
+    EXPECT_EQ(merged.periodChanges, whole.periodChanges);
+    EXPECT_NEAR(merged.jitter(), whole.jitter(), 1e-6f);
+
+    EXPECT_LT(whole.voicedRatio(), 1.0f);
+    EXPECT_NEAR(whole.minFrequency, 150.0f, 3.0f);
+    EXPECT_NEAR(whole.maxFrequency, 250.0f, 3.0f);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "audio/realtime_audio_analyzer.hpp"
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace audio;
+
+namespace {
+
+constexpr uint32_t SAMPLE_RATE = 16000;
+
+std::vector<float> tone(size_t samples, float amplitude = 0.5f) {
+    std::vector<float> audio(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        audio[i] = amplitude * static_cast<float>(std::sin(2.0 * M_PI * 440.0 * i / SAMPLE_RATE));
+    }
+    return audio;
+}
+
+} // namespace
+
+TEST(RealTimeAudioAnalyzerTest, CallerThreadAnalysesWholeFrames) {
+    RealTimeAudioAnalyzer analyzer(SAMPLE_RATE, 512);
+    analyzer.setAnalysisThreading(AnalysisThreading::CALLER_THREAD);
+    ASSERT_TRUE(analyzer.initialize());
+
+    // Chunks that do not line up with frames; the partial frame waits
+    auto audio = tone(1600);
+    for (size_t offset = 0; offset < audio.size(); offset += 100) {
+        analyzer.processAudioChunk(audio.data() + offset, 100);
+    }
+
+    EXPECT_EQ(analyzer.getPerformanceMetrics().totalSamplesProcessed, 1536u);
+    EXPECT_EQ(analyzer.getCurrentMetrics().sequenceNumber, 3u);
+    EXPECT_NEAR(analyzer.getCurrentLevels().currentLevel, 0.5f / std::sqrt(2.0f), 0.01f);
+
+    // Single samples complete the fourth frame
+    for (size_t i = 0; i < 512 - 64; ++i) {
+        analyzer.processAudioSample(0.1f);
+    }
+    EXPECT_EQ(analyzer.getCurrentMetrics().sequenceNumber, 4u);
+    analyzer.shutdown();
+}
+
+TEST(RealTimeAudioAnalyzerTest, CallbacksAreRateLimited) {
+    RealTimeAudioAnalyzer analyzer(SAMPLE_RATE, 256);
+    analyzer.setAnalysisThreading(AnalysisThreading::CALLER_THREAD);
+    analyzer.setUpdateInterval(std::chrono::milliseconds(50));
+    ASSERT_TRUE(analyzer.initialize());
+
+    int levelCallbacks = 0;
+    int spectralCallbacks = 0;
+    analyzer.registerLevelsCallback([&](const AudioLevelMetrics &) { levelCallbacks++; });
+    analyzer.registerSpectralCallback([&](const SpectralAnalysis &) { spectralCallbacks++; });
+
+    // 64 frames of 16 ms; callbacks fire once 50 ms of audio has built up
+    analyzer.processAudioChunk(tone(256 * 64));
+    EXPECT_EQ(analyzer.getCurrentMetrics().sequenceNumber, 64u);
+    EXPECT_EQ(levelCallbacks, 16);
+    EXPECT_EQ(spectralCallbacks, 16);
+    analyzer.shutdown();
+}
+
+TEST(RealTimeAudioAnalyzerTest, WorkerDrainsQueuedFrames) {
+    RealTimeAudioAnalyzer analyzer(SAMPLE_RATE, 1024);
+    analyzer.setUpdateInterval(std::chrono::milliseconds(5));
+    ASSERT_TRUE(analyzer.initialize());
+    EXPECT_EQ(analyzer.getAnalysisThreading(), AnalysisThreading::WORKER);
+
+    auto audio = tone(3200);
+    for (size_t offset = 0; offset < audio.size(); offset += 320) {
+        analyzer.processAudioChunk(audio.data() + offset, 320);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (analyzer.getPerformanceMetrics().totalSamplesProcessed < 3072 &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    analyzer.shutdown();
+
+    auto performance = analyzer.getPerformanceMetrics();
+    EXPECT_EQ(performance.totalSamplesProcessed, 3072u);
+    EXPECT_EQ(performance.droppedSamples, 0u);
+    EXPECT_EQ(analyzer.getCurrentMetrics().sequenceNumber, 3u);
+}
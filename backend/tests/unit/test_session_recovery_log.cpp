@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "core/session_recovery.hpp"
+#include "core/session_recovery_log.hpp"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+using namespace core;
+
+class SessionRecoveryLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "speechrnt_session_recovery_log_test";
+        std::filesystem::remove_all(testDir);
+        basePath = (testDir / "sessions.db").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(testDir);
+    }
+
+    SessionRecoveryData makeSession(const std::string& id) {
+        SessionRecoveryData data;
+        data.session_id = id;
+        data.client_id = "client-" + id;
+        data.created_at = std::chrono::steady_clock::now();
+        data.last_activity = data.created_at;
+        data.source_lang = "en";
+        data.target_lang = "es";
+        data.voice_id = "female_voice_1";
+        data.is_active = true;
+        data.pending_utterances = {3, 5, 8};
+        data.last_known_state = "listening";
+        data.custom_data["topic"] = "support";
+        data.recovery_attempts = 1;
+        return data;
+    }
+
+    SessionRecoveryMap reopen() {
+        SessionRecoveryLog log(basePath);
+        SessionRecoveryMap sessions;
+        EXPECT_TRUE(log.open(sessions));
+        return sessions;
+    }
+
+    std::filesystem::path testDir;
+    std::string basePath;
+};
+
+TEST_F(SessionRecoveryLogTest, ReplaysStoreActivityAndRemove) {
+    auto later = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    {
+        SessionRecoveryLog log(basePath);
+        SessionRecoveryMap sessions;
+        ASSERT_TRUE(log.open(sessions));
+        EXPECT_TRUE(sessions.empty());
+
+        log.recordStore(makeSession("a"));
+        log.recordStore(makeSession("b"));
+        log.recordStore(makeSession("c"));
+        log.recordActivity("b", later);
+        log.recordRemove("c");
+
+        // Nothing reaches the file before the group commit
+        EXPECT_EQ(std::filesystem::file_size(basePath + ".wal.1"), 0u);
+        EXPECT_TRUE(log.sync());
+        EXPECT_GT(std::filesystem::file_size(basePath + ".wal.1"), 0u);
+        EXPECT_EQ(log.getStatistics().records_appended, 5u);
+    }
+
+    auto sessions = reopen();
+    ASSERT_EQ(sessions.size(), 2u);
+    ASSERT_TRUE(sessions.count("b"));
+    const auto& b = *sessions["b"];
+    EXPECT_EQ(b.client_id, "client-b");
+    EXPECT_EQ(b.voice_id, "female_voice_1");
+    EXPECT_EQ(b.pending_utterances, (std::vector<uint32_t>{3, 5, 8}));
+    EXPECT_EQ(b.custom_data.at("topic"), "support");
+    EXPECT_EQ(b.recovery_attempts, 1);
+    EXPECT_TRUE(b.is_active);
+    EXPECT_LT(std::chrono::abs(b.last_activity - later), std::chrono::milliseconds(50));
+    EXPECT_FALSE(sessions.count("c"));
+}
+
+TEST_F(SessionRecoveryLogTest, CompactionReplacesCoveredSegments) {
+    {
+        SessionRecoveryLog log(basePath);
+        SessionRecoveryMap sessions;
+        ASSERT_TRUE(log.open(sessions));
+        for (int i = 0; i < 10; ++i) {
+            auto data = makeSession("s" + std::to_string(i));
+            log.recordStore(data);
+            sessions[data.session_id] = std::make_shared<SessionRecoveryData>(data);
+        }
+
+        uint64_t generation = log.rotate();
+        ASSERT_EQ(generation, 2u);
+        std::string snapshot;
+        SessionRecoveryLog::encodeSnapshot(sessions, generation, snapshot);
+        ASSERT_TRUE(log.installSnapshot(snapshot, generation));
+        EXPECT_FALSE(std::filesystem::exists(basePath + ".wal.1"));
+        EXPECT_TRUE(std::filesystem::exists(basePath + ".snapshot"));
+
+        // Changes after the rotation land in the new segment
+        log.recordRemove("s0");
+        log.recordStore(makeSession("s10"));
+        log.close();
+    }
+
+    SessionRecoveryLog log(basePath);
+    SessionRecoveryMap sessions;
+    ASSERT_TRUE(log.open(sessions));
+    EXPECT_EQ(sessions.size(), 10u);
+    EXPECT_FALSE(sessions.count("s0"));
+    EXPECT_TRUE(sessions.count("s10"));
+    EXPECT_EQ(log.getStatistics().records_replayed, 12u);
+    EXPECT_EQ(log.getStatistics().compactions, 0u);
+}
+
+TEST_F(SessionRecoveryLogTest, TruncatesTornTail) {
+    {
+        SessionRecoveryLog log(basePath);
+        SessionRecoveryMap sessions;
+        ASSERT_TRUE(log.open(sessions));
+        log.recordStore(makeSession("kept"));
+        log.close();
+    }
+    size_t intact = std::filesystem::file_size(basePath + ".wal.1");
+    {
+        std::ofstream segment(basePath + ".wal.1", std::ios::binary | std::ios::app);
+        segment << "partial record";
+    }
+
+    auto sessions = reopen();
+    EXPECT_EQ(sessions.size(), 1u);
+    EXPECT_TRUE(sessions.count("kept"));
+    EXPECT_EQ(std::filesystem::file_size(basePath + ".wal.1"), intact);
+}
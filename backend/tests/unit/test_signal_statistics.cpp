@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "audio/signal_statistics.hpp"
+#include <random>
+#include <vector>
+
+using namespace audio;
+
+namespace {
+
+// Speech-like bursts separated by near-silence, with a few clipped samples
+std::vector<float> burstySignal(size_t samples, unsigned seed = 7) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> noise(0.0f, 0.3f);
+    std::vector<float> audio(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        bool burst = (i / 700) % 3 != 0;
+        audio[i] = burst ? noise(gen) : noise(gen) * 0.005f;
+    }
+    for (size_t i = 123; i < samples; i += 997) {
+        audio[i] = (i % 2) ? 1.0f : -1.0f;
+    }
+    return audio;
+}
+
+class SignalStatisticsTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        SignalStatistics::setActiveLevel(SignalStatistics::getSupportedLevel());
+    }
+};
+
+} // namespace
+
+TEST_F(SignalStatisticsTest, ScalarMatchesDefinitions) {
+    SignalStatistics::setActiveLevel(SimdLevel::SCALAR);
+    std::vector<float> audio = {0.5f, -0.5f, 0.0f, 0.001f, -0.002f, 0.0f, 0.96f, -0.3f};
+    auto stats = SignalStatistics::compute(audio);
+
+    EXPECT_EQ(stats.count, audio.size());
+    EXPECT_FLOAT_EQ(stats.peak, 0.96f);
+    // + - + + - + + -
+    EXPECT_EQ(stats.zeroCrossings, 5u);
+    EXPECT_EQ(stats.clippedSamples, 1u);
+    EXPECT_EQ(stats.silentSamples, 4u);
+    EXPECT_EQ(stats.silenceRuns, 1u);
+    EXPECT_EQ(stats.longestSilenceRun, 4u);
+    EXPECT_NEAR(stats.sumSquares, 0.25 + 0.25 + 0.000001 + 0.000004 + 0.9216 + 0.09, 1e-6);
+}
+
+TEST_F(SignalStatisticsTest, EveryLevelMatchesScalar) {
+    // Odd lengths exercise the scalar tail after the vector loop
+    for (size_t length : {1u, 3u, 17u, 1000u, 4099u, 48001u}) {
+        auto audio = burstySignal(length);
+        SignalStatistics::setActiveLevel(SimdLevel::SCALAR);
+        auto expected = SignalStatistics::compute(audio);
+
+        for (auto level : {SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+            if (SignalStatistics::setActiveLevel(level) != level) {
+                continue;
+            }
+            SCOPED_TRACE(std::string(simdLevelName(level)) + " length " + std::to_string(length));
+            auto stats = SignalStatistics::compute(audio);
+            EXPECT_EQ(stats.count, expected.count);
+            EXPECT_EQ(stats.peak, expected.peak);
+            EXPECT_EQ(stats.zeroCrossings, expected.zeroCrossings);
+            EXPECT_EQ(stats.clippedSamples, expected.clippedSamples);
+            EXPECT_EQ(stats.silentSamples, expected.silentSamples);
+            EXPECT_EQ(stats.silenceRuns, expected.silenceRuns);
+            EXPECT_EQ(stats.longestSilenceRun, expected.longestSilenceRun);
+            EXPECT_NEAR(stats.sumSquares, expected.sumSquares, expected.sumSquares * 1e-5 + 1e-9);
+        }
+    }
+}
+
+TEST_F(SignalStatisticsTest, DerivedMeasures) {
+    std::vector<float> audio(16000, 0.25f);
+    auto stats = SignalStatistics::compute(audio);
+    EXPECT_NEAR(stats.rms(), 0.25f, 1e-5f);
+    EXPECT_FLOAT_EQ(stats.zeroCrossingRate(), 0.0f);
+    EXPECT_FLOAT_EQ(stats.silentFraction(), 0.0f);
+
+    auto empty = SignalStatistics::compute(nullptr, 0);
+    EXPECT_EQ(empty.count, 0u);
+    EXPECT_FLOAT_EQ(empty.rms(), 0.0f);
+}
+
+TEST_F(SignalStatisticsTest, ForcedLevelIsClampedToSupport) {
+    auto supported = SignalStatistics::getSupportedLevel();
+    EXPECT_EQ(SignalStatistics::setActiveLevel(SimdLevel::AVX512), supported);
+    EXPECT_EQ(SignalStatistics::getActiveLevel(), supported);
+    EXPECT_EQ(SignalStatistics::setActiveLevel(SimdLevel::SCALAR), SimdLevel::SCALAR);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "utils/spsc_ring_buffer.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using speechrnt::utils::SpscRingBuffer;
+
+TEST(SpscRingBufferTest, BlocksWrapAroundInOrder) {
+    SpscRingBuffer<int> ring(6);
+    EXPECT_EQ(ring.capacity(), 8u);
+    EXPECT_TRUE(ring.empty());
+
+    std::vector<int> out(8);
+    int next = 0;
+    int expected = 0;
+    // Blocks of 5 through a ring of 8 straddle the wrap on most pushes
+    for (int round = 0; round < 10; ++round) {
+        std::vector<int> block = {next, next + 1, next + 2, next + 3, next + 4};
+        ASSERT_EQ(ring.push(block.data(), block.size()), 5u);
+        next += 5;
+        EXPECT_EQ(ring.size(), 5u);
+
+        ASSERT_EQ(ring.pop(out.data(), out.size()), 5u);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(out[i], expected++);
+        }
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingBufferTest, PushStopsWhenFull) {
+    SpscRingBuffer<float> ring(4);
+    std::vector<float> block = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    EXPECT_EQ(ring.push(block.data(), block.size()), 4u);
+    EXPECT_FALSE(ring.push(7.0f));
+
+    float value = 0.0f;
+    ASSERT_TRUE(ring.pop(value));
+    EXPECT_FLOAT_EQ(value, 1.0f);
+    EXPECT_TRUE(ring.push(7.0f));
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(SpscRingBufferTest, ConcurrentProducerAndConsumer) {
+    constexpr uint32_t TOTAL = 200000;
+    SpscRingBuffer<uint32_t> ring(1024);
+
+    std::thread producer([&]() {
+        std::vector<uint32_t> block(97);
+        uint32_t next = 0;
+        while (next < TOTAL) {
+            size_t count = std::min<size_t>(block.size(), TOTAL - next);
+            for (size_t i = 0; i < count; ++i) {
+                block[i] = next + static_cast<uint32_t>(i);
+            }
+            size_t written = 0;
+            while (written < count) {
+                written += ring.push(block.data() + written, count - written);
+            }
+            next += static_cast<uint32_t>(count);
+        }
+    });
+
+    std::vector<uint32_t> out(61);
+    uint32_t expected = 0;
+    while (expected < TOTAL) {
+        size_t count = ring.pop(out.data(), out.size());
+        if (count == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(out[i], expected++);
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
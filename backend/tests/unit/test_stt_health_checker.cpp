@@ -290,6 +290,49 @@ TEST_F(STTHealthCheckerTest, EnableDisableTest) {
     EXPECT_NE(healthStatus.overall_status, stt::HealthStatus::UNKNOWN);
 }
 
+TEST_F(STTHealthCheckerTest, SnapshotPublishedAfterEachCheck) {
+    auto initial = health_checker_->getSnapshot();
+    ASSERT_NE(initial, nullptr);
+    
+    health_checker_->checkHealth(false);
+    auto snapshot = health_checker_->getSnapshot();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_GT(snapshot->version, initial->version);
+    EXPECT_NE(snapshot->overall_status, stt::HealthStatus::UNKNOWN);
+    EXPECT_NE(snapshot->detailed.json.find("\"overall_status\""), std::string::npos);
+    EXPECT_NE(snapshot->metrics.json.find("\"health_metrics\""), std::string::npos);
+    EXPECT_NE(snapshot->alerts.json.find("\"active_alerts_count\""), std::string::npos);
+    EXPECT_EQ(snapshot->detailed.etag, stt::HealthSnapshot::makeETag(snapshot->detailed.json));
+    
+    // Earlier snapshots stay valid for readers still holding them
+    EXPECT_FALSE(initial->history.json.empty());
+}
+
+TEST_F(STTHealthCheckerTest, SnapshotHistoryAndETags) {
+    health_checker_->checkHealth(false);
+    auto first = health_checker_->getSnapshot();
+    
+    // Alert changes republish without touching the history
+    health_checker_->clearAcknowledgedAlerts();
+    auto republished = health_checker_->getSnapshot();
+    EXPECT_GT(republished->version, first->version);
+    EXPECT_EQ(republished->history.etag, first->history.etag);
+    EXPECT_EQ(republished->history.json, first->history.json);
+    
+    health_checker_->checkHealth(false);
+    auto second = health_checker_->getSnapshot();
+    EXPECT_NE(second->history.etag, first->history.etag);
+    EXPECT_EQ(second->history_offsets.size(), first->history_offsets.size() + 1);
+    EXPECT_NE(second->history.json.find("\"hours_requested\": 24"), std::string::npos);
+    
+    auto lastHour = second->historyFor(1);
+    EXPECT_NE(lastHour.json.find("\"hours_requested\": 1"), std::string::npos);
+    EXPECT_NE(lastHour.json.find("\"entries_count\": " + std::to_string(second->history_offsets.size())),
+              std::string::npos);
+    EXPECT_NE(lastHour.etag, second->history.etag);
+    EXPECT_EQ(second->historyFor(1).etag, lastHour.etag);
+}
+
 // Test the RAII timer helper
 TEST_F(STTHealthCheckerTest, HealthCheckTimerTest) {
     auto start = std::chrono::steady_clock::now();
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "mt/text_tokenizer.hpp"
+#include <string>
+
+using speechrnt::mt::TokenizedText;
+
+TEST(TextTokenizerTest, SplitsWordsAndTrimsTrailingPunctuation) {
+    std::string text = "  Hello, (world) it's 42...\tdone!";
+    TokenizedText tokenized(text);
+
+    ASSERT_EQ(tokenized.tokens().size(), 5u);
+    EXPECT_EQ(tokenized.token(0), "Hello");
+    EXPECT_EQ(tokenized.token(1), "(world");
+    EXPECT_EQ(tokenized.token(2), "it's");
+    EXPECT_EQ(tokenized.token(3), "42");
+    EXPECT_EQ(tokenized.token(4), "done");
+
+    const auto& tokens = tokenized.tokens();
+    EXPECT_TRUE(tokens[0].flags & TokenizedText::TOKEN_CAPITALIZED);
+    EXPECT_TRUE(tokens[0].flags & TokenizedText::TOKEN_ENDS_LOWERCASE);
+    EXPECT_TRUE(tokens[1].flags & TokenizedText::TOKEN_HAS_SYMBOL);
+    EXPECT_TRUE(tokens[3].flags & TokenizedText::TOKEN_HAS_DIGIT);
+    EXPECT_FALSE(tokens[4].flags & TokenizedText::TOKEN_CAPITALIZED);
+}
+
+TEST(TextTokenizerTest, CountsUtf8CharactersNotBytes) {
+    std::string text = "¿Cómo estás? Привет";
+    TokenizedText tokenized(text);
+
+    ASSERT_EQ(tokenized.tokens().size(), 3u);
+    EXPECT_EQ(tokenized.token(0), "¿Cómo");
+    EXPECT_EQ(tokenized.tokens()[0].characters, 5u);
+    EXPECT_EQ(tokenized.tokens()[2].characters, 6u);
+    EXPECT_TRUE(tokenized.tokens()[2].flags & TokenizedText::TOKEN_NON_ASCII);
+    EXPECT_FALSE(tokenized.tokens()[2].flags & TokenizedText::TOKEN_HAS_SYMBOL);
+    EXPECT_EQ(tokenized.characterCount(), 19u);
+    EXPECT_TRUE(tokenized.hasNonAscii());
+}
+
+TEST(TextTokenizerTest, SegmentsSentences) {
+    std::string text = "First one. Second?! 第三句。 trailing words";
+    TokenizedText tokenized(text);
+
+    const auto& sentences = tokenized.sentences();
+    ASSERT_EQ(sentences.size(), 4u);
+    EXPECT_EQ(tokenized.terminatedSentenceCount(), 3u);
+    EXPECT_EQ(text.substr(sentences[0].offset, sentences[0].length), "First one.");
+    EXPECT_EQ(text.substr(sentences[1].offset, sentences[1].length), "Second?!");
+    EXPECT_EQ(text.substr(sentences[2].offset, sentences[2].length), "第三句。");
+    EXPECT_EQ(text.substr(sentences[3].offset, sentences[3].length), "trailing words");
+    EXPECT_FALSE(sentences[3].terminated);
+}
+
+TEST(TextTokenizerTest, FoldedHashIgnoresAsciiCase) {
+    TokenizedText tokenized("Word word WORD other");
+    const auto& tokens = tokenized.tokens();
+    EXPECT_EQ(tokens[0].foldedHash, tokens[1].foldedHash);
+    EXPECT_EQ(tokens[1].foldedHash, tokens[2].foldedHash);
+    EXPECT_NE(tokens[0].foldedHash, tokens[3].foldedHash);
+    EXPECT_EQ(tokenized.distinctLetterCount(), 7u);
+}
+
+TEST(TextTokenizerTest, ReuseReplacesPreviousText) {
+    TokenizedText tokenized("one two three.");
+    tokenized.tokenize("");
+    EXPECT_TRUE(tokenized.tokens().empty());
+    EXPECT_TRUE(tokenized.sentences().empty());
+    EXPECT_EQ(tokenized.characterCount(), 0u);
+
+    tokenized.tokenize("again");
+    ASSERT_EQ(tokenized.tokens().size(), 1u);
+    EXPECT_EQ(tokenized.token(0), "again");
+    EXPECT_EQ(tokenized.terminatedSentenceCount(), 0u);
+}
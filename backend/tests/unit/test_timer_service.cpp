@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include "utils/timer_service.hpp"
+#include "utils/system_resource_sampler.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace speechrnt::utils;
+using namespace std::chrono_literals;
+
+TEST(TimerServiceTest, PeriodicTimerRepeatsUntilCancelled) {
+    TimerService service(1ms);
+    std::atomic<int> runs{0};
+
+    auto id = service.schedulePeriodic("counter", 10ms, [&runs]() { runs++; });
+    ASSERT_NE(id, TimerService::INVALID_TIMER);
+    std::this_thread::sleep_for(115ms);
+
+    EXPECT_TRUE(service.cancel(id));
+    int afterCancel = runs.load();
+    EXPECT_GE(afterCancel, 5);
+    EXPECT_LE(afterCancel, 12);
+
+    std::this_thread::sleep_for(30ms);
+    EXPECT_EQ(runs.load(), afterCancel);
+    EXPECT_FALSE(service.cancel(id));
+    EXPECT_EQ(service.getTimerCount(), 0u);
+}
+
+TEST(TimerServiceTest, OneShotFiresOnceAfterDelay) {
+    TimerService service(1ms);
+    std::atomic<int> runs{0};
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<long long> firedAfterMs{-1};
+
+    service.scheduleOnce("once", 30ms, [&]() {
+        firedAfterMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        runs++;
+    });
+
+    std::this_thread::sleep_for(80ms);
+    EXPECT_EQ(runs.load(), 1);
+    EXPECT_GE(firedAfterMs.load(), 30);
+    EXPECT_EQ(service.getTimerCount(), 0u);
+}
+
+TEST(TimerServiceTest, TimersBeyondFirstLevelCascadeInOrder) {
+    // With 1 ms ticks the first level spans 64 ms, so these land on upper levels
+    TimerService service(1ms);
+    std::mutex mutex;
+    std::vector<int> order;
+
+    for (int delay : {150, 90, 40, 300}) {
+        service.scheduleOnce("delay", std::chrono::milliseconds(delay), [&, delay]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(delay);
+        });
+    }
+
+    std::this_thread::sleep_for(400ms);
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(order, (std::vector<int>{40, 90, 150, 300}));
+    EXPECT_GT(service.getStats().cascades, 0u);
+}
+
+TEST(TimerServiceTest, IdleWheelSleepsThroughEmptyTicks) {
+    TimerService service(1ms);
+    std::atomic<int> runs{0};
+    service.schedulePeriodic("slow", 100ms, [&runs]() { runs++; });
+
+    std::this_thread::sleep_for(350ms);
+    auto stats = service.getStats();
+
+    EXPECT_EQ(runs.load(), 3);
+    EXPECT_GE(stats.ticksAdvanced, 300u);
+    EXPECT_LT(stats.wakeups, 20u);
+}
+
+TEST(TimerServiceTest, CancelWaitsForRunningCallbackAndAllowsSelfCancel) {
+    TimerService service(1ms);
+    std::atomic<bool> inCallback{false};
+    std::atomic<bool> finished{false};
+
+    auto slow = service.schedulePeriodic("slow", 5ms, [&]() {
+        inCallback = true;
+        std::this_thread::sleep_for(40ms);
+        finished = true;
+    }, true);
+
+    while (!inCallback) {
+        std::this_thread::sleep_for(1ms);
+    }
+    service.cancel(slow);
+    EXPECT_TRUE(finished.load());
+
+    std::atomic<int> selfRuns{0};
+    TimerService::TimerId self = TimerService::INVALID_TIMER;
+    std::atomic<bool> scheduled{false};
+    self = service.schedulePeriodic("self", 5ms, [&]() {
+        while (!scheduled) {
+            std::this_thread::yield();
+        }
+        selfRuns++;
+        service.cancel(self);
+    });
+    scheduled = true;
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(selfRuns.load(), 1);
+}
+
+TEST(TimerServiceTest, OverrunningTimerSkipsMissedRuns) {
+    TimerService service(1ms);
+    std::atomic<int> runs{0};
+
+    auto id = service.schedulePeriodic("overrun", 10ms, [&runs]() {
+        runs++;
+        std::this_thread::sleep_for(35ms);
+    });
+
+    std::this_thread::sleep_for(200ms);
+    service.cancel(id);
+
+    EXPECT_LE(runs.load(), 6);
+    EXPECT_GT(service.getStats().missedRuns, 0u);
+}
+
+TEST(TimerServiceTest, ShutdownRejectsNewTimers) {
+    TimerService service(1ms);
+    service.schedulePeriodic("idle", 1000ms, []() {});
+    service.shutdown();
+
+    EXPECT_EQ(service.schedulePeriodic("late", 10ms, []() {}), TimerService::INVALID_TIMER);
+    EXPECT_EQ(service.getTimerCount(), 0u);
+}
+
+TEST(SystemResourceSamplerTest, SnapshotReportsPlausibleValues) {
+    SystemResourceSampler sampler;
+    auto first = sampler.getSnapshot();
+    EXPECT_EQ(first.sampleCount, 1u);
+    EXPECT_GE(first.cpuCount, 1u);
+
+    std::this_thread::sleep_for(20ms);
+    auto second = sampler.sampleNow();
+    EXPECT_EQ(second.sampleCount, 2u);
+    EXPECT_GE(second.cpuUsage, 0.0f);
+    EXPECT_LE(second.cpuUsage, 1.0f);
+    EXPECT_GE(second.processCpuUsage, 0.0f);
+    EXPECT_LE(second.processCpuUsage, 1.0f);
+    EXPECT_LE(second.memoryUsage, 1.0f);
+#ifdef __linux__
+    EXPECT_GT(second.totalMemoryMB, 0u);
+    EXPECT_GT(second.processThreads, 0u);
+#endif
+}
+
+TEST(SystemResourceSamplerTest, ReadersNeverSeeTornSnapshots) {
+    SystemResourceSampler sampler;
+    sampler.sampleNow();
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back([&]() {
+            uint64_t lastCount = 0;
+            while (!stop) {
+                auto snapshot = sampler.getSnapshot();
+                // Counts only move forward and every sample has a timestamp
+                if (snapshot.sampleCount < lastCount || snapshot.timestampMs == 0) {
+                    torn++;
+                }
+                lastCount = snapshot.sampleCount;
+            }
+        });
+    }
+
+    for (int i = 0; i < 50; ++i) {
+        sampler.sampleNow();
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(sampler.getSnapshot().sampleCount, 51u);
+}
+
+TEST(SystemResourceSamplerTest, PeriodicSamplingRunsOnSharedTimer) {
+    auto& sampler = SystemResourceSampler::getInstance();
+    sampler.ensureStarted(20ms);
+    EXPECT_TRUE(sampler.isRunning());
+
+    std::this_thread::sleep_for(70ms);
+    EXPECT_GE(sampler.getSnapshot().sampleCount, 3u);
+
+    sampler.stop();
+    EXPECT_FALSE(sampler.isRunning());
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "core/task_queue.hpp"
+#include "utils/trace_recorder.hpp"
+#include <future>
+#include <memory>
+#include <string>
+
+using namespace speechrnt::utils;
+
+namespace {
+
+size_t countOf(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+class TraceRecorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        recorder.disable();
+        recorder.clear();
+    }
+
+    void TearDown() override {
+        recorder.disable();
+        recorder.clear();
+    }
+
+    TraceRecorder& recorder = TraceRecorder::getInstance();
+};
+
+TEST_F(TraceRecorderTest, DisabledTracingRecordsNothing) {
+    uint64_t before = recorder.getSpansRecorded();
+    EXPECT_FALSE(recorder.beginUtterance("session", 1).sampled());
+    {
+        ScopedTraceContext scope(TraceContext{42});
+        TraceSpan span("stt");
+        EXPECT_FALSE(TraceRecorder::current().sampled());
+    }
+    EXPECT_EQ(recorder.getSpansRecorded(), before);
+    EXPECT_EQ(countOf(recorder.exportChromeTrace(), "\"ph\":\"X\""), 0u);
+}
+
+TEST_F(TraceRecorderTest, SamplesOneInNAndTriggeredUtterances) {
+    recorder.enable(4);
+    int sampled = 0;
+    for (uint32_t id = 0; id < 16; ++id) {
+        sampled += recorder.beginUtterance("session", id).sampled() ? 1 : 0;
+    }
+    EXPECT_EQ(sampled, 4);
+
+    recorder.enable(0);
+    recorder.traceNext(2);
+    EXPECT_TRUE(recorder.beginUtterance("session", 100).sampled());
+    EXPECT_TRUE(recorder.beginUtterance("session", 101).sampled());
+    EXPECT_FALSE(recorder.beginUtterance("session", 102).sampled());
+}
+
+TEST_F(TraceRecorderTest, TaskQueueCarriesContextToWorkers) {
+    recorder.enable(1);
+    TraceContext context = recorder.beginUtterance("session-\"7\"", 7);
+    ASSERT_TRUE(context.sampled());
+
+    auto queue = std::make_shared<speechrnt::core::TaskQueue>();
+    speechrnt::core::ThreadPool pool(2);
+    pool.start(queue);
+
+    std::promise<TraceContext> seen;
+    {
+        ScopedTraceContext scope(context);
+        TraceSpan span("speech");
+        queue->enqueue([&seen] {
+            TraceSpan work("mt");
+            seen.set_value(TraceRecorder::current());
+        });
+    }
+    EXPECT_EQ(seen.get_future().get().trace_id, context.trace_id);
+    pool.stop();
+
+    std::string trace = recorder.exportChromeTrace();
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(trace.find("\"name\":\"speech\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"task_queue.wait\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"mt\""), std::string::npos);
+    EXPECT_NE(trace.find("\"session\":\"session-\\\"7\\\"\",\"utterance\":7"), std::string::npos);
+    EXPECT_EQ(countOf(trace, "\"cat\":\"utterance\""), 2u);
+    EXPECT_EQ(trace.substr(trace.size() - 3), "]}\n");
+}
+
+TEST_F(TraceRecorderTest, RingKeepsTheNewestSpans) {
+    recorder.enable(1);
+    TraceContext context = recorder.beginUtterance("session", 1);
+    int64_t base = TraceRecorder::now();
+    for (size_t i = 0; i < TraceRecorder::RING_CAPACITY + 100; ++i) {
+        int64_t start = base + static_cast<int64_t>(i);
+        recorder.record(i < 100 ? "old" : "new", context, start, start + 1500);
+    }
+
+    std::string trace = recorder.exportChromeTrace();
+    EXPECT_EQ(countOf(trace, "\"name\":\"old\""), 0u);
+    EXPECT_EQ(countOf(trace, "\"name\":\"new\""), TraceRecorder::RING_CAPACITY);
+    EXPECT_EQ(countOf(trace, "\"dur\":1.500"), TraceRecorder::RING_CAPACITY);
+
+    recorder.clear();
+    EXPECT_EQ(countOf(recorder.exportChromeTrace(), "\"ph\":\"X\""), 0u);
+}
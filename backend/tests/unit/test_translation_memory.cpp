@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "mt/translation_memory.hpp"
+#include <filesystem>
+#include <memory>
+
+using namespace speechrnt::mt;
+
+class TranslationMemoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "speechrnt_translation_memory_test";
+        std::filesystem::remove_all(testDir);
+        memory = std::make_unique<TranslationMemory>();
+        ASSERT_TRUE(memory->open(testDir.string()));
+    }
+
+    void TearDown() override {
+        memory.reset();
+        std::filesystem::remove_all(testDir);
+    }
+
+    TranslationMemory::Entry makeEntry(const std::string& text, float confidence = 0.9f) {
+        TranslationMemory::Entry entry;
+        entry.translatedText = text;
+        entry.confidence = confidence;
+        return entry;
+    }
+
+    std::filesystem::path testDir;
+    std::unique_ptr<TranslationMemory> memory;
+};
+
+TEST_F(TranslationMemoryTest, StoreAndLookup) {
+    EXPECT_TRUE(memory->store("Good morning", "en", "es", "v1", makeEntry("Buenos días")));
+
+    TranslationMemory::Entry entry;
+    ASSERT_TRUE(memory->lookup("Good morning", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "Buenos días");
+    EXPECT_FLOAT_EQ(entry.confidence, 0.9f);
+
+    EXPECT_FALSE(memory->lookup("Good night", "en", "es", "v1", entry));
+}
+
+TEST_F(TranslationMemoryTest, KeyIncludesLanguagePairAndModelVersion) {
+    memory->store("Hello", "en", "es", "v1", makeEntry("Hola"));
+
+    TranslationMemory::Entry entry;
+    EXPECT_FALSE(memory->lookup("Hello", "en", "fr", "v1", entry));
+    EXPECT_FALSE(memory->lookup("Hello", "en", "es", "v2", entry));
+    EXPECT_TRUE(memory->lookup("Hello", "en", "es", "v1", entry));
+}
+
+TEST_F(TranslationMemoryTest, SourceTextIsNormalized) {
+    memory->store("  Thank   you ", "en", "es", "v1", makeEntry("Gracias"));
+
+    TranslationMemory::Entry entry;
+    ASSERT_TRUE(memory->lookup("thank you", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "Gracias");
+
+    EXPECT_EQ(TranslationMemory::normalizeText("\tHELLO\n World  "), "hello world");
+}
+
+TEST_F(TranslationMemoryTest, PersistsAcrossReopen) {
+    for (int i = 0; i < 2000; ++i) {
+        ASSERT_TRUE(memory->store("phrase " + std::to_string(i), "en", "es", "v1",
+                                  makeEntry("frase " + std::to_string(i))));
+    }
+    memory->close();
+
+    TranslationMemory reopened;
+    ASSERT_TRUE(reopened.open(testDir.string()));
+    EXPECT_EQ(reopened.getStatistics().entryCount, 2000u);
+
+    TranslationMemory::Entry entry;
+    ASSERT_TRUE(reopened.lookup("phrase 1234", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "frase 1234");
+}
+
+TEST_F(TranslationMemoryTest, RebuildsMissingIndexFromLog) {
+    memory->store("Please", "en", "es", "v1", makeEntry("Por favor"));
+    memory->close();
+
+    std::filesystem::remove(testDir / "translation_memory.idx");
+
+    TranslationMemory reopened;
+    ASSERT_TRUE(reopened.open(testDir.string()));
+
+    TranslationMemory::Entry entry;
+    ASSERT_TRUE(reopened.lookup("Please", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "Por favor");
+}
+
+TEST_F(TranslationMemoryTest, CompactionDropsSupersededRecords) {
+    memory->store("Yes", "en", "es", "v1", makeEntry("Si"));
+    memory->store("Yes", "en", "es", "v1", makeEntry("Sí"));
+    memory->store("No", "en", "es", "v1", makeEntry("No"));
+
+    auto before = memory->getStatistics();
+    EXPECT_EQ(before.entryCount, 2u);
+    EXPECT_GT(before.staleBytes, 0u);
+
+    ASSERT_TRUE(memory->compact());
+
+    auto after = memory->getStatistics();
+    EXPECT_EQ(after.entryCount, 2u);
+    EXPECT_EQ(after.staleBytes, 0u);
+    EXPECT_LT(after.logBytes, before.logBytes);
+
+    TranslationMemory::Entry entry;
+    ASSERT_TRUE(memory->lookup("Yes", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "Sí");
+}
+
+TEST_F(TranslationMemoryTest, ExportAndImportWarmCache) {
+    memory->store("Excuse me", "en", "es", "v1", makeEntry("Disculpe"));
+    memory->store("Good evening", "en", "es", "v1", makeEntry("Buenas noches"));
+
+    auto exportPath = testDir / "warm_cache.tm";
+    EXPECT_EQ(memory->exportTo(exportPath.string()), 2);
+
+    auto replicaDir = testDir / "replica";
+    TranslationMemory replica;
+    ASSERT_TRUE(replica.open(replicaDir.string()));
+    replica.store("Excuse me", "en", "es", "v1", makeEntry("Perdón"));
+
+    // Existing entries win unless overwrite is requested
+    EXPECT_EQ(replica.importFrom(exportPath.string()), 1);
+
+    TranslationMemory::Entry entry;
+    ASSERT_TRUE(replica.lookup("Excuse me", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "Perdón");
+    ASSERT_TRUE(replica.lookup("Good evening", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "Buenas noches");
+
+    EXPECT_EQ(replica.importFrom(exportPath.string(), true), 2);
+    ASSERT_TRUE(replica.lookup("Excuse me", "en", "es", "v1", entry));
+    EXPECT_EQ(entry.translatedText, "Disculpe");
+}
+
+TEST_F(TranslationMemoryTest, HitRateStatistics) {
+    memory->store("Hello", "en", "es", "v1", makeEntry("Hola"));
+
+    TranslationMemory::Entry entry;
+    memory->lookup("Hello", "en", "es", "v1", entry);
+    memory->lookup("Goodbye", "en", "es", "v1", entry);
+
+    auto stats = memory->getStatistics();
+    EXPECT_EQ(stats.lookups, 2u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_FLOAT_EQ(stats.getHitRate(), 50.0f);
+}
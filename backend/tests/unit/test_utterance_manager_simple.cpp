@@ -312,6 +312,47 @@ bool testConcurrentProcessing() {
     return true;
 }
 
+// Test that a synthesis callback taking over TTS skips blocking synthesis
+bool testSynthesisHandoff() {
+    std::cout << "Testing synthesis hand-off..." << std::endl;
+    
+    auto task_queue = std::make_shared<TaskQueue>();
+    auto thread_pool = std::make_unique<ThreadPool>(2);
+    thread_pool->start(task_queue);
+    
+    UtteranceManager manager;
+    manager.initialize(task_queue);
+    
+    std::atomic<int> handoffs{0};
+    manager.setSynthesisCallback([&](const UtteranceData& utterance) {
+        handoffs++;
+        // Take over only the first session's utterances
+        return utterance.session_id == "streamed";
+    });
+    
+    uint32_t streamed_id = manager.createUtterance("streamed");
+    uint32_t fallback_id = manager.createUtterance("fallback");
+    for (uint32_t id : {streamed_id, fallback_id}) {
+        manager.addAudioData(id, std::vector<float>(100, 0.5f));
+        manager.setLanguageConfig(id, "en", "es", "voice1");
+        ASSERT_TRUE(manager.processUtterance(id));
+    }
+    
+    // Wait for processing to complete
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    
+    ASSERT_EQ(handoffs.load(), 2);
+    ASSERT_EQ(manager.getUtteranceState(streamed_id), UtteranceState::COMPLETE);
+    ASSERT_EQ(manager.getUtteranceState(fallback_id), UtteranceState::COMPLETE);
+    ASSERT_TRUE(manager.getUtterance(streamed_id)->synthesized_audio.empty());
+    ASSERT_FALSE(manager.getUtterance(fallback_id)->synthesized_audio.empty());
+    
+    thread_pool->stop();
+    manager.shutdown();
+    task_queue->shutdown();
+    return true;
+}
+
 // Test capacity limits
 bool testCapacityLimits() {
     std::cout << "Testing capacity limits..." << std::endl;
@@ -400,6 +441,7 @@ int main() {
     all_passed &= testSessionManagement();
     all_passed &= testStatistics();
     all_passed &= testConcurrentProcessing();
+    all_passed &= testSynthesisHandoff();
     all_passed &= testCapacityLimits();
     all_passed &= testCleanup();
     
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "core/utterance_store.hpp"
+#include <thread>
+#include <vector>
+
+using namespace speechrnt::core;
+
+class UtteranceStoreTest : public ::testing::Test {
+protected:
+    UtteranceStore store;
+};
+
+TEST_F(UtteranceStoreTest, CreateAndSnapshot) {
+    uint32_t id = store.create("session1");
+    ASSERT_NE(id, 0u);
+    EXPECT_TRUE(store.contains(id));
+
+    UtteranceState state;
+    ASSERT_TRUE(store.getState(id, state));
+    EXPECT_EQ(state, UtteranceState::LISTENING);
+
+    UtteranceData snapshot(0, "");
+    ASSERT_TRUE(store.snapshot(id, snapshot));
+    EXPECT_EQ(snapshot.id, id);
+    EXPECT_EQ(snapshot.session_id, "session1");
+    EXPECT_EQ(store.activeCount(), 1u);
+}
+
+TEST_F(UtteranceStoreTest, UpdatePayloadAndState) {
+    uint32_t id = store.create("session1");
+
+    ASSERT_TRUE(store.update(id, [](UtteranceState& state, UtterancePayload& payload) {
+        payload.transcript = "Hello world";
+        payload.audio_buffer.assign(160, 0.5f);
+        state = UtteranceState::TRANSCRIBING;
+    }));
+
+    UtteranceData snapshot(0, "");
+    ASSERT_TRUE(store.snapshot(id, snapshot));
+    EXPECT_EQ(snapshot.transcript, "Hello world");
+    EXPECT_EQ(snapshot.audio_buffer.size(), 160u);
+    EXPECT_EQ(snapshot.state, UtteranceState::TRANSCRIBING);
+
+    auto counts = store.getCounts();
+    EXPECT_EQ(counts.active, 1u);
+    EXPECT_EQ(counts.processing, 1u);
+    EXPECT_EQ(counts.finished, 0u);
+
+    store.update(id, [](UtteranceState& state, UtterancePayload&) {
+        state = UtteranceState::COMPLETE;
+    });
+    counts = store.getCounts();
+    EXPECT_EQ(counts.active, 0u);
+    EXPECT_EQ(counts.processing, 0u);
+    EXPECT_EQ(counts.finished, 1u);
+}
+
+TEST_F(UtteranceStoreTest, StaleIdsAreRejectedAfterReuse) {
+    uint32_t first = store.create("session1");
+    store.update(first, [](UtteranceState& state, UtterancePayload&) {
+        state = UtteranceState::COMPLETE;
+    });
+    EXPECT_EQ(store.removeFinishedOlderThan(std::chrono::seconds(-1)), 1u);
+    EXPECT_FALSE(store.contains(first));
+
+    // The freed slot is reused with a new generation
+    uint32_t second = store.create("session1");
+    EXPECT_NE(second, first);
+    EXPECT_TRUE(store.contains(second));
+    EXPECT_FALSE(store.update(first, [](UtteranceState&, UtterancePayload&) {}));
+}
+
+TEST_F(UtteranceStoreTest, SessionListsAndActiveQueries) {
+    std::vector<uint32_t> session1;
+    for (int i = 0; i < 5; ++i) {
+        session1.push_back(store.create("session1"));
+    }
+    uint32_t other = store.create("session2");
+
+    EXPECT_EQ(store.sessionIds("session1"), session1);
+    EXPECT_EQ(store.sessionSnapshots("session2").size(), 1u);
+
+    store.update(session1[0], [](UtteranceState& state, UtterancePayload&) {
+        state = UtteranceState::ERROR;
+    });
+    auto active = store.activeIds();
+    EXPECT_EQ(active.size(), 5u);
+    EXPECT_EQ(std::count(active.begin(), active.end(), session1[0]), 0);
+    EXPECT_EQ(std::count(active.begin(), active.end(), other), 1);
+
+    EXPECT_EQ(store.removeSession("session1"), 5u);
+    EXPECT_TRUE(store.sessionIds("session1").empty());
+    EXPECT_EQ(store.activeCount(), 1u);
+    EXPECT_TRUE(store.contains(other));
+}
+
+TEST_F(UtteranceStoreTest, CleanupOnlyRemovesExpiredFinished) {
+    uint32_t active = store.create("session1");
+    uint32_t finished = store.create("session1");
+    store.update(finished, [](UtteranceState& state, UtterancePayload&) {
+        state = UtteranceState::COMPLETE;
+    });
+
+    EXPECT_EQ(store.removeFinishedOlderThan(std::chrono::hours(1)), 0u);
+    EXPECT_EQ(store.removeFinishedOlderThan(std::chrono::seconds(-1)), 1u);
+    EXPECT_TRUE(store.contains(active));
+    EXPECT_FALSE(store.contains(finished));
+}
+
+TEST_F(UtteranceStoreTest, ScalesToManyConcurrentUtterances) {
+    const int sessions = 100;
+    const int perSession = 120;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([this, t, sessions, perSession]() {
+            for (int s = t; s < sessions; s += 4) {
+                std::string session = "session" + std::to_string(s);
+                for (int i = 0; i < perSession; ++i) {
+                    uint32_t id = store.create(session);
+                    if (i % 2 == 0) {
+                        store.update(id, [](UtteranceState& state, UtterancePayload&) {
+                            state = UtteranceState::COMPLETE;
+                        });
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto counts = store.getCounts();
+    EXPECT_EQ(counts.stored, static_cast<size_t>(sessions * perSession));
+    EXPECT_EQ(counts.active, static_cast<size_t>(sessions * perSession / 2));
+    EXPECT_EQ(store.activeIds().size(), counts.active);
+    EXPECT_EQ(store.sessionIds("session42").size(), static_cast<size_t>(perSession));
+}
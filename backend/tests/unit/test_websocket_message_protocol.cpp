@@ -102,6 +102,16 @@ TEST_F(MessageProtocolTest, CreateAudioStartMessage) {
     EXPECT_NE(json.find("\"duration\":2.5"), std::string::npos);
 }
 
+TEST_F(MessageProtocolTest, AudioStartMessageSegments) {
+    AudioStartMessage audioStart(101, 0.8);
+    EXPECT_EQ(audioStart.serialize().find("segmentIndex"), std::string::npos);
+
+    audioStart.setSegment(2, false);
+    std::string json = audioStart.serialize();
+    EXPECT_NE(json.find("\"segmentIndex\":2"), std::string::npos);
+    EXPECT_NE(json.find("\"finalSegment\":false"), std::string::npos);
+}
+
 // Test error message
 TEST_F(MessageProtocolTest, CreateErrorMessage) {
     ErrorMessage error("Translation failed", "TRANSLATION_ERROR", 202);
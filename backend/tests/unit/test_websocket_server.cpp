@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 #include "core/websocket_server.hpp"
+#include "core/client_session.hpp"
+#include "core/utterance_manager.hpp"
+#include "tts/tts_interface.hpp"
+#include <atomic>
+#include <cstring>
+#include <mutex>
 #include <thread>
 #include <chrono>
+#include <unordered_map>
 
 class WebSocketServerTest : public ::testing::Test {
 protected:
@@ -47,5 +54,214 @@ TEST_F(WebSocketServerTest, ServerStopWithoutStart) {
     EXPECT_NO_THROW(server->stop());
 }
 
+namespace {
+
+// Mono 16 kHz PCM16 WAV of the given number of samples
+std::vector<uint8_t> makeWav(size_t samples) {
+    auto put = [](std::vector<uint8_t>& out, uint32_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    };
+    uint32_t dataBytes = static_cast<uint32_t>(samples * 2);
+    std::vector<uint8_t> wav;
+    wav.insert(wav.end(), {'R', 'I', 'F', 'F'});
+    put(wav, 36 + dataBytes, 4);
+    wav.insert(wav.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    put(wav, 16, 4);
+    put(wav, 1, 2);       // PCM
+    put(wav, 1, 2);       // Mono
+    put(wav, 16000, 4);
+    put(wav, 32000, 4);
+    put(wav, 2, 2);
+    put(wav, 16, 2);
+    wav.insert(wav.end(), {'d', 'a', 't', 'a'});
+    put(wav, dataBytes, 4);
+    wav.resize(wav.size() + dataBytes, 0);
+    return wav;
+}
+
+class FakeTTSEngine : public speechrnt::tts::TTSInterface {
+public:
+    bool initialize(const std::string&, const std::string&) override { return true; }
+
+    speechrnt::tts::SynthesisResult synthesize(const std::string& text, const std::string& voiceId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        synthesized.push_back(text);
+        speechrnt::tts::SynthesisResult result;
+        result.audioData = makeWav(1600);
+        result.duration = 0.1f;
+        result.sampleRate = 16000;
+        result.voiceId = voiceId;
+        result.success = true;
+        return result;
+    }
+
+    std::shared_ptr<speechrnt::tts::StreamingSynthesis> synthesizeStreaming(
+        const std::string& text, SynthesisUnitCallback callback, const std::string& voiceId) override {
+        streamed++;
+        return TTSInterface::synthesizeStreaming(text, std::move(callback), voiceId);
+    }
+
+    std::future<speechrnt::tts::SynthesisResult> synthesizeAsync(const std::string& text,
+                                                                 const std::string& voiceId) override {
+        return std::async(std::launch::deferred, [=] { return synthesize(text, voiceId); });
+    }
+    void synthesizeWithCallback(const std::string& text, SynthesisCallback callback,
+                                const std::string& voiceId) override {
+        callback(synthesize(text, voiceId));
+    }
+
+    std::vector<speechrnt::tts::VoiceInfo> getAvailableVoices() const override {
+        speechrnt::tts::VoiceInfo voice;
+        voice.id = "fake";
+        voice.isAvailable = true;
+        return {voice};
+    }
+    std::vector<speechrnt::tts::VoiceInfo> getVoicesForLanguage(const std::string&) const override {
+        return getAvailableVoices();
+    }
+    bool setDefaultVoice(const std::string&) override { return true; }
+    std::string getDefaultVoice() const override { return "fake"; }
+    void setSynthesisParameters(float, float, float) override {}
+    bool isReady() const override { return true; }
+    std::string getLastError() const override { return ""; }
+    void cleanup() override {}
+
+    std::vector<std::string> texts() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return synthesized;
+    }
+
+    std::atomic<int> streamed{0};
+
+private:
+    std::mutex mutex_;
+    std::vector<std::string> synthesized;
+};
+
+// Stands in for the event loops: sessions are registered directly and
+// sends are recorded instead of written to a socket
+class RecordingServer : public core::WebSocketServer {
+public:
+    RecordingServer() : core::WebSocketServer(8082, 1) {}
+
+    void addSession(const std::shared_ptr<core::ClientSession>& session) {
+        session->setWebSocketServer(this);
+        sessions_[session->getSessionId()] = session;
+    }
+
+    void sendMessage(const std::string& sessionId, const std::string& message) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        messages_[sessionId].push_back(message);
+    }
+
+    void sendBinaryMessage(const std::string& sessionId, const std::vector<uint8_t>& data) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        binaryBytes_[sessionId] += data.size();
+    }
+
+    std::vector<std::string> messages(const std::string& sessionId) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return messages_[sessionId];
+    }
+
+    size_t binaryBytes(const std::string& sessionId) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return binaryBytes_[sessionId];
+    }
+
+protected:
+    std::shared_ptr<core::ClientSession> findSession(const std::string& sessionId) const override {
+        auto it = sessions_.find(sessionId);
+        return it != sessions_.end() ? it->second : nullptr;
+    }
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<core::ClientSession>> sessions_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::vector<std::string>> messages_;
+    std::unordered_map<std::string, size_t> binaryBytes_;
+};
+
+bool hasAudioStart(const std::vector<std::string>& messages, uint32_t utteranceId) {
+    for (const auto& message : messages) {
+        if (message.find("audio_start") != std::string::npos &&
+            message.find(std::to_string(utteranceId)) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST(WebSocketServerSynthesisTest, RoutesSynthesizedSpeechToOwningSession) {
+    using namespace speechrnt::core;
+
+    auto taskQueue = std::make_shared<TaskQueue>();
+    ThreadPool threadPool(2);
+    threadPool.start(taskQueue);
+
+    auto manager = std::make_shared<UtteranceManager>();
+    manager->initialize(taskQueue);
+    auto managerEngine = std::make_shared<FakeTTSEngine>();
+    manager->setTTSEngine(managerEngine);
+
+    std::atomic<int> ownerCompletions{0};
+    manager->setCompleteCallback([&](const UtteranceData&) { ownerCompletions++; });
+
+    auto sessionEngine = std::make_shared<FakeTTSEngine>();
+    auto streamed = std::make_shared<core::ClientSession>("streamed");
+    streamed->setTTSEngine(sessionEngine);
+    // No engine of its own, so the manager synthesizes its reply whole
+    auto whole = std::make_shared<core::ClientSession>("whole");
+
+    {
+        RecordingServer server;
+        server.addSession(streamed);
+        server.addSession(whole);
+        server.attachUtteranceManager(manager);
+
+        uint32_t streamedId = manager->createUtterance("streamed");
+        uint32_t wholeId = manager->createUtterance("whole");
+        for (uint32_t id : {streamedId, wholeId}) {
+            manager->addAudioData(id, std::vector<float>(1600, 0.1f));
+            manager->setLanguageConfig(id, "en", "es", "fake");
+            ASSERT_TRUE(manager->processUtterance(id));
+        }
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (ownerCompletions.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(ownerCompletions.load(), 2);
+
+        // Streamed through the session's engine, not synthesized by the manager
+        EXPECT_EQ(sessionEngine->streamed.load(), 1);
+        ASSERT_EQ(sessionEngine->texts().size(), 1u);
+        EXPECT_EQ(sessionEngine->texts()[0], manager->getUtterance(streamedId)->translation);
+        EXPECT_TRUE(manager->getUtterance(streamedId)->synthesized_audio.empty());
+        EXPECT_TRUE(hasAudioStart(server.messages("streamed"), streamedId));
+        EXPECT_GT(server.binaryBytes("streamed"), 0u);
+
+        // Synthesized whole by the manager and sent on completion
+        ASSERT_EQ(managerEngine->texts().size(), 1u);
+        EXPECT_EQ(managerEngine->texts()[0], manager->getUtterance(wholeId)->translation);
+        EXPECT_TRUE(hasAudioStart(server.messages("whole"), wholeId));
+        EXPECT_EQ(server.binaryBytes("whole"), manager->getUtterance(wholeId)->synthesized_audio.size());
+    }
+
+    // The owner's complete callback is restored once the server is gone
+    auto restored = manager->getCompleteCallback();
+    ASSERT_TRUE(restored);
+    restored(UtteranceData(0, "streamed"));
+    EXPECT_EQ(ownerCompletions.load(), 3);
+
+    threadPool.stop();
+    manager->shutdown();
+    taskQueue->shutdown();
+}
+
 // Note: More comprehensive integration tests would require actual WebSocket clients
 // These would be better placed in integration tests with real network connections
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "stt/whisper_encoder_cache.hpp"
+#include <vector>
+
+using namespace stt;
+
+namespace {
+
+std::vector<float> tone(size_t samples, float amplitude) {
+    std::vector<float> audio(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        audio[i] = amplitude * (static_cast<float>(i % 40) - 20.0f) / 20.0f;
+    }
+    return audio;
+}
+
+TranscriptionResult result(const std::string& text, float confidence) {
+    TranscriptionResult transcription;
+    transcription.text = text;
+    transcription.confidence = confidence;
+    transcription.is_partial = false;
+    return transcription;
+}
+
+} // namespace
+
+TEST(WhisperEncoderCacheTest, FingerprintTracksSamples) {
+    auto audio = tone(16000, 0.5f);
+    auto same = WhisperEncoderCache::fingerprint(audio);
+    EXPECT_EQ(same, WhisperEncoderCache::fingerprint(audio));
+
+    auto changed = audio;
+    changed[8000] += 0.001f;
+    EXPECT_NE(same, WhisperEncoderCache::fingerprint(changed));
+
+    auto longer = audio;
+    longer.push_back(0.0f);
+    EXPECT_NE(same, WhisperEncoderCache::fingerprint(longer));
+}
+
+TEST(WhisperEncoderCacheTest, FinalResultIsReturnedForSameAudio) {
+    WhisperEncoderCache cache;
+    auto audio = WhisperEncoderCache::fingerprint(tone(16000, 0.5f));
+    auto other = WhisperEncoderCache::fingerprint(tone(16000, 0.25f));
+
+    TranscriptionResult found;
+    EXPECT_FALSE(cache.findFinal(audio, found));
+
+    cache.storeFinal(audio, result("hello world", 0.9f));
+    ASSERT_TRUE(cache.findFinal(audio, found));
+    EXPECT_EQ(found.text, "hello world");
+    EXPECT_FLOAT_EQ(found.confidence, 0.9f);
+    EXPECT_FALSE(cache.findFinal(other, found));
+}
+
+TEST(WhisperEncoderCacheTest, LargerCandidateSetServesSmallerRequest) {
+    WhisperEncoderCache cache;
+    auto audio = WhisperEncoderCache::fingerprint(tone(16000, 0.5f));
+    std::vector<TranscriptionResult> candidates;
+
+    EXPECT_FALSE(cache.findCandidates(audio, 3, candidates));
+
+    cache.storeCandidates(audio, 3, {result("a", 0.9f), result("b", 0.8f), result("c", 0.7f)});
+    ASSERT_TRUE(cache.findCandidates(audio, 2, candidates));
+    ASSERT_EQ(candidates.size(), 2u);
+    EXPECT_EQ(candidates[0].text, "a");
+    EXPECT_EQ(candidates[1].text, "b");
+
+    // More candidates than were generated need another pass
+    EXPECT_FALSE(cache.findCandidates(audio, 5, candidates));
+    EXPECT_EQ(cache.getStats().candidateHits, 1u);
+}
+
+TEST(WhisperEncoderCacheTest, FinalAndCandidatesShareEntry) {
+    WhisperEncoderCache cache;
+    auto audio = WhisperEncoderCache::fingerprint(tone(16000, 0.5f));
+
+    cache.storeFinal(audio, result("final", 0.9f));
+    cache.storeCandidates(audio, 2, {result("final", 0.9f), result("alt", 0.6f)});
+    EXPECT_EQ(cache.size(), 1u);
+
+    TranscriptionResult found;
+    EXPECT_TRUE(cache.findFinal(audio, found));
+}
+
+TEST(WhisperEncoderCacheTest, EvictsLeastRecentlyUsed) {
+    WhisperEncoderCache cache(2);
+    auto first = WhisperEncoderCache::fingerprint(tone(16000, 0.1f));
+    auto second = WhisperEncoderCache::fingerprint(tone(16000, 0.2f));
+    auto third = WhisperEncoderCache::fingerprint(tone(16000, 0.3f));
+
+    cache.storeFinal(first, result("first", 0.9f));
+    cache.storeFinal(second, result("second", 0.9f));
+
+    TranscriptionResult found;
+    ASSERT_TRUE(cache.findFinal(first, found));   // first is now most recent
+
+    cache.storeFinal(third, result("third", 0.9f));
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_TRUE(cache.findFinal(first, found));
+    EXPECT_FALSE(cache.findFinal(second, found));
+    EXPECT_TRUE(cache.findFinal(third, found));
+}
+
+TEST(WhisperEncoderCacheTest, EncoderStateFollowsLastEncode) {
+    WhisperEncoderCache cache;
+    auto audio = WhisperEncoderCache::fingerprint(tone(16000, 0.5f));
+    auto other = WhisperEncoderCache::fingerprint(tone(16000, 0.25f));
+
+    EXPECT_FALSE(cache.isEncoded(audio));
+
+    cache.markEncoded(audio, "en");
+    EXPECT_TRUE(cache.isEncoded(audio));
+    EXPECT_FALSE(cache.isEncoded(other));
+    EXPECT_EQ(cache.getEncodedLanguage(), "en");
+    EXPECT_EQ(cache.getStats().encodes, 1u);
+
+    // Any other whisper pass overwrites the state
+    cache.invalidateEncoder();
+    EXPECT_FALSE(cache.isEncoded(audio));
+
+    cache.markEncoded(other, "de");
+    EXPECT_TRUE(cache.isEncoded(other));
+    cache.clear();
+    EXPECT_FALSE(cache.isEncoded(other));
+    EXPECT_EQ(cache.size(), 0u);
+}
@@ -42,10 +42,22 @@ enum SendStatus : int {
     BACKPRESSURE
 };
 
+// One event loop per thread; defer() is the only thread-safe entry point
+struct Loop {
+    static Loop* get() {
+        static thread_local Loop loop;
+        return &loop;
+    }
+    // The development stub has no loop to wake, so deferred work runs inline
+    void defer(std::function<void()> cb) { cb(); }
+};
+
 template<bool SSL>
 struct WebSocket {
     SendStatus send(std::string_view message, OpCode opCode = OpCode::TEXT) { return SUCCESS; }
+    void end(int /*code*/ = 0, std::string_view /*message*/ = {}) {}
     void close() {}
+    unsigned int getBufferedAmount() const { return 0; }
     void* getUserData() { return userData_; }
     
 private:
@@ -58,6 +70,7 @@ struct TemplatedApp {
         std::function<void(HttpResponse*, HttpRequest*, void*)> upgrade;
         std::function<void(WebSocket<SSL>*)> open;
         std::function<void(WebSocket<SSL>*, std::string_view, OpCode)> message;
+        std::function<void(WebSocket<SSL>*)> drain;
         std::function<void(WebSocket<SSL>*, int, std::string_view)> close;
         size_t maxCompressedSize = 0;
         size_t maxBackpressure = 0;
@@ -67,6 +80,7 @@ struct TemplatedApp {
     TemplatedApp* get(std::string pattern, std::function<void(HttpResponse*, HttpRequest*)> handler) { return this; }
     TemplatedApp* listen(int port, std::function<void(void*)> handler) { return this; }
     void run() {}
+    void close() {}
 };
 
 using App = TemplatedApp<false>;
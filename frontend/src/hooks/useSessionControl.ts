@@ -132,6 +132,11 @@ export const useSessionControl = () => {
         case 'translation_result':
           setCurrentTranslatedText(message.data.translatedText);
           
+          // Streamed while the user is still speaking; the final one follows
+          if (message.data.isPartial) {
+            break;
+          }
+          
           // Add to conversation history
           addConversationEntry({
             utteranceId: message.data.utteranceId,
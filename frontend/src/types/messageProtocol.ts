@@ -51,6 +51,7 @@ export interface TranslationResultMessage extends BaseMessage {
     originalText: string;
     translatedText: string;
     utteranceId: number;
+    isPartial?: boolean;
   };
 }
 